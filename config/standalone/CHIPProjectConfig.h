@@ -66,6 +66,10 @@
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 0
 #endif
 
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_ALLOCATOR
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_ALLOCATOR 1
+#endif
+
 #ifndef CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT
 #define CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT 4
 #endif
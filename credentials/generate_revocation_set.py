@@ -23,11 +23,14 @@
 
 import base64
 import dataclasses
+import hashlib
 import json
 import logging
 import os
+import struct
 import subprocess
 import sys
+import tempfile
 import unittest
 from enum import Enum
 from typing import Optional
@@ -97,6 +100,12 @@ class RevocationSet:
 OID_VENDOR_ID = x509.ObjectIdentifier("1.3.6.1.4.1.37244.2.1")
 OID_PRODUCT_ID = x509.ObjectIdentifier("1.3.6.1.4.1.37244.2.2")
 
+# Binary revocation set index, see src/credentials/attestation_verifier/RevocationSetIndex.h
+REVOCATION_SET_INDEX_MAGIC = b'MRSI'
+REVOCATION_SET_INDEX_VERSION = 1
+REVOCATION_SET_INDEX_AKID_LENGTH = 20
+REVOCATION_SET_INDEX_MAX_SERIAL_LENGTH = 20
+
 PRODUCTION_NODE_URL = "https://on.dcl.csa-iot.org:26657"
 PRODUCTION_NODE_URL_REST = "https://on.dcl.csa-iot.org"
 TEST_NODE_URL_REST = "https://on.test-net.dcl.csa-iot.org"
@@ -852,6 +861,61 @@ class LocalFilesDclClient(DclClientInterface):
         return None
 
 
+def get_revocation_set_index_entries(revocation_set: dict) -> list[bytes]:
+    """Get the binary index entries for one revocation set entry of the JSON revocation set.
+
+    The CRL signer (or its delegator) is cross-validated against the issuer name and AKID here, so
+    that readers of the index only need to look up (issuer, AKID, serial number) triplets.
+    Entries that fail cross-validation or contain malformed values are skipped.
+    """
+    if revocation_set.get('type') != 'revocation_set':
+        logging.warning(f"Skipping entry of unsupported type: {revocation_set.get('type')}")
+        return []
+
+    issuer_name = revocation_set['issuer_name']
+    akid_hex = revocation_set['issuer_subject_key_id']
+
+    signer_b64 = revocation_set.get('crl_signer_delegator') or revocation_set['crl_signer_cert']
+    try:
+        signer = x509.load_der_x509_certificate(base64.b64decode(signer_b64))
+        signer_matches = (get_skid(signer) == akid_hex) and (get_b64_name(signer.subject) == issuer_name)
+    except (ValueError, ExtensionNotFound):
+        signer_matches = False
+    if not signer_matches:
+        logging.warning(f"Skipping revocation set of issuer {issuer_name}: CRL signer does not match issuer name and AKID")
+        return []
+
+    akid = bytes.fromhex(akid_hex)
+    if len(akid) != REVOCATION_SET_INDEX_AKID_LENGTH:
+        logging.warning(f"Skipping revocation set with invalid AKID: {akid_hex}")
+        return []
+
+    issuer_hash = hashlib.sha256(base64.b64decode(issuer_name)).digest()
+
+    entries = []
+    for serial_hex in revocation_set.get('revoked_serial_numbers', []):
+        try:
+            serial = bytes.fromhex(serial_hex)
+        except ValueError:
+            serial = b''
+        if not 0 < len(serial) <= REVOCATION_SET_INDEX_MAX_SERIAL_LENGTH:
+            logging.warning(f"Skipping invalid serial number: {serial_hex}")
+            continue
+        entries.append(issuer_hash + akid + bytes([len(serial)]) + serial.ljust(REVOCATION_SET_INDEX_MAX_SERIAL_LENGTH, b'\0'))
+
+    return entries
+
+
+def build_revocation_set_index(revocation_sets: list[dict]) -> bytes:
+    """Build the sorted binary index of a JSON revocation set."""
+    entries = set()
+    for revocation_set in revocation_sets:
+        entries.update(get_revocation_set_index_entries(revocation_set))
+
+    header = REVOCATION_SET_INDEX_MAGIC + bytes([REVOCATION_SET_INDEX_VERSION, 0, 0, 0]) + struct.pack('<I', len(entries))
+    return header + b''.join(sorted(entries))
+
+
 @click.group()
 def cli():
     pass
@@ -996,6 +1060,34 @@ def from_dcl(use_main_net_dcld: str, use_test_net_dcld: str, use_main_net_http:
         json.dump([revocation.asDict() for revocation in revocation_set], outfile, indent=4)
 
 
+@cli.command('compile')
+@click.help_option('-h', '--help')
+@click.option('--input', 'input_file', required=True, type=click.File('r'), help='Path to a JSON revocation set, as generated by from-dcl.')
+@click.option('--output', required=True, type=str, metavar='FILEPATH', help='Output filename of the binary revocation set index.')
+@click.option('--log-level', default='INFO', show_default=True, type=click.Choice(__LOG_LEVELS__.keys(),
+                                                                                 case_sensitive=False), callback=lambda c, p, v: __LOG_LEVELS__[v],
+              help='Determines the verbosity of script output')
+def compile_revocation_set(input_file, output: str, log_level: str):
+    """Compile a JSON revocation set into the binary index used by IndexedDACRevocationDelegate."""
+    logging.basicConfig(
+        level=log_level,
+        format='%(asctime)s %(name)s %(levelname)-7s %(message)s',
+        datefmt='%Y-%m-%d %H:%M:%S'
+    )
+
+    index = build_revocation_set_index(json.load(input_file))
+
+    # Replace the output atomically: readers may have the previous index memory-mapped.
+    output_dir = os.path.dirname(os.path.abspath(output))
+    with tempfile.NamedTemporaryFile('wb', dir=output_dir, delete=False) as outfile:
+        outfile.write(index)
+        temporary_path = outfile.name
+    os.replace(temporary_path, output)
+
+    entry_count = struct.unpack_from('<I', index, len(REVOCATION_SET_INDEX_MAGIC) + 4)[0]
+    logging.info(f"Wrote {entry_count} revoked certificates to {output}")
+
+
 class TestRevocationSetGeneration(unittest.TestCase):
     """Test class for revocation set generation"""
 
@@ -1069,6 +1161,26 @@ class TestRevocationSetGeneration(unittest.TestCase):
 
         self.compare_revocation_sets(revocation_set, self.get_expected_revocation_set(2))
 
+    def test_revocation_set_index(self):
+        """Test compilation of the JSON revocation set into the binary index"""
+        with open(os.path.join(self.test_base_dir, 'test/revoked-attestation-certificates/revocation-sets/revocation-set.json'), 'r') as f:
+            revocation_sets = json.load(f)
+
+        index = build_revocation_set_index(revocation_sets)
+        entry_length = 32 + REVOCATION_SET_INDEX_AKID_LENGTH + 1 + REVOCATION_SET_INDEX_MAX_SERIAL_LENGTH
+
+        self.assertEqual(index[:4], REVOCATION_SET_INDEX_MAGIC)
+        self.assertEqual(index[4], REVOCATION_SET_INDEX_VERSION)
+        entry_count = struct.unpack_from('<I', index, 8)[0]
+        self.assertEqual(len(index), 12 + entry_count * entry_length)
+
+        entries = [index[12 + i * entry_length:12 + (i + 1) * entry_length] for i in range(entry_count)]
+        self.assertEqual(entries, sorted(set(entries)))
+
+        expected_count = len({(s['issuer_name'], s['issuer_subject_key_id'], serial)
+                              for s in revocation_sets for serial in s['revoked_serial_numbers']})
+        self.assertEqual(entry_count, expected_count)
+
 
 if __name__ == "__main__":
     if len(sys.argv) > 1 and sys.argv[1] == 'test':
@@ -21,6 +21,7 @@
 #include <commands/icd/ICDCommand.h>
 #include <controller/CHIPDeviceControllerFactory.h>
 #include <credentials/attestation_verifier/FileAttestationTrustStore.h>
+#include <credentials/attestation_verifier/IndexedDACRevocationDelegate.h>
 #include <credentials/attestation_verifier/TestDACRevocationDelegateImpl.h>
 #include <data-model-providers/codegen/Instance.h>
 #include <lib/core/CHIPConfig.h>
@@ -99,6 +100,14 @@ CHIP_ERROR GetAttestationRevocationDelegate(const char * revocationSetPath,
         return CHIP_NO_ERROR;
     }
 
+    if (chip::Credentials::IndexedDACRevocationDelegate::IsRevocationSetIndexFile(revocationSetPath))
+    {
+        static chip::Credentials::IndexedDACRevocationDelegate indexedDacRevocationDelegate;
+        ReturnErrorOnFailure(indexedDacRevocationDelegate.SetRevocationSetIndexPath(revocationSetPath));
+        *revocationDelegate = &indexedDacRevocationDelegate;
+        return CHIP_NO_ERROR;
+    }
+
     static chip::Credentials::TestDACRevocationDelegateImpl testDacRevocationDelegate;
     ReturnErrorOnFailure(testDacRevocationDelegate.SetDeviceAttestationRevocationSetPath(revocationSetPath));
     *revocationDelegate = &testDacRevocationDelegate;
@@ -165,6 +174,9 @@ CHIP_ERROR CHIPCommand::MaybeSetUpStack()
     }
     ReturnLogErrorOnFailure(DeviceControllerFactory::GetInstance().Init(factoryInitParams));
 
+    // Derive the PASE verifier and check CASE certificates and signatures on the background workers.
+    ReturnLogErrorOnFailure(chip::DeviceLayer::PlatformMgr().StartBackgroundEventLoopTask());
+
     auto systemState = chip::Controller::DeviceControllerFactory::GetInstance().GetSystemState();
     VerifyOrReturnError(nullptr != systemState, CHIP_ERROR_INCORRECT_STATE);
 
@@ -87,7 +87,8 @@ public:
                     "Only allow trusted CD verifying keys (disallow test keys). If not provided or 0 (\"false\"), untrusted CD "
                     "verifying keys are allowed. If 1 (\"true\"), test keys are disallowed.");
         AddArgument("dac-revocation-set-path", &mDacRevocationSetPath,
-                    "Path to JSON file containing the device attestation revocation set. "
+                    "Path to JSON file containing the device attestation revocation set, or to a revocation set index "
+                    "compiled from it with 'generate_revocation_set.py compile'. "
                     "This argument caches the path to the revocation set. Once set, this will be used by all commands in "
                     "interactive mode.");
 #if CHIP_CONFIG_TRANSPORT_TRACE_ENABLED
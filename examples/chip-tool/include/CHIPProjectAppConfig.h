@@ -51,6 +51,7 @@
 #define CHIP_CONFIG_SECURITY_TEST_MODE 0
 
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 0
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_ALLOCATOR 1
 
 #define CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY 1
 
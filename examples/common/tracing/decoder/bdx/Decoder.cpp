@@ -266,6 +266,11 @@ void DecodeAndPrintTransferControl(const char * header, BitFlags<TransferControl
     {
         Log("Async");
     }
+
+    if (flags.Has(TransferControlFlags::kWindowed))
+    {
+        Log("Windowed");
+    }
 }
 
 void DecodeAndPrintRangeControl(const char * header, BitFlags<RangeControlFlags> & flags)
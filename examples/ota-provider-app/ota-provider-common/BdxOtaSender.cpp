@@ -22,14 +22,34 @@
 #include <lib/support/CHIPMemString.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/Flags.h>
+#include <platform/CHIPDeviceLayer.h>
 #include <protocols/bdx/BdxTransferSession.h>
 
+#if !CHIP_BDX_READ_AHEAD_BLOCK_SOURCE
 #include <fstream>
+#endif
 
 using chip::bdx::StatusCode;
 using chip::bdx::TransferControlFlags;
 using chip::bdx::TransferSession;
 
+#if CHIP_BDX_READ_AHEAD_BLOCK_SOURCE
+using chip::bdx::ReadAheadBlockSource;
+using chip::bdx::ReadAheadFileReader;
+
+namespace {
+
+// Shared by all transfers so that requestors downloading the same image reuse each other's reads.
+ReadAheadFileReader gReadAheadReader;
+
+CHIP_ERROR DispatchToMatterThread(void (*work)(intptr_t), intptr_t arg)
+{
+    return chip::DeviceLayer::PlatformMgr().ScheduleWork(work, arg);
+}
+
+} // namespace
+#endif // CHIP_BDX_READ_AHEAD_BLOCK_SOURCE
+
 BdxOtaSender::BdxOtaSender()
 {
     memset(mFileDesignator, 0, chip::bdx::kMaxFileDesignatorLen);
@@ -122,72 +142,36 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
         memcpy(mFileDesignator, fd, fdl);
         mFileDesignator[fdl] = 0;
 
+#if CHIP_BDX_READ_AHEAD_BLOCK_SOURCE
+        if (gReadAheadReader.MaxBlockSize() < mTransfer.GetTransferBlockSize())
+        {
+            // The provider runs a single BdxOtaSender, whose previous source was closed by Reset(), so the reader is idle here.
+            gReadAheadReader.Shutdown();
+            err = gReadAheadReader.Init(DispatchToMatterThread, mTransfer.GetTransferBlockSize());
+            VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(BDX, "Read-ahead init failed: %" CHIP_ERROR_FORMAT, err.Format());
+                           mTransfer.AbortTransfer(StatusCode::kUnknown));
+        }
+
+        // Start reading the image now so the first BlockQuery is served from memory.
+        err = mBlockSource.Open(gReadAheadReader, mFileDesignator, mTransfer.GetTransferBlockSize(), mTransfer.GetStartOffset(),
+                                mTransfer.GetTransferLength(), ReadAheadBlockSource::kDefaultReadAheadDepth, this);
+        VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(BDX, "OTA file open failed: %" CHIP_ERROR_FORMAT, err.Format());
+                       mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown));
+        mNumBytesSent = static_cast<uint32_t>(mTransfer.GetStartOffset());
+#endif // CHIP_BDX_READ_AHEAD_BLOCK_SOURCE
+
         break;
     }
     case TransferSession::OutputEventType::kQueryReceived:
     case TransferSession::OutputEventType::kQueryWithSkipReceived: {
-        TransferSession::BlockData blockData;
-        uint16_t blockSize   = mTransfer.GetTransferBlockSize();
-        uint16_t bytesToRead = blockSize;
         uint64_t bytesToSkip = 0;
 
         if (event.EventType == TransferSession::OutputEventType::kQueryWithSkipReceived)
         {
             bytesToSkip = event.bytesToSkip.BytesToSkip;
         }
-        uint64_t seekOffset = mNumBytesSent + bytesToSkip;
-
-        // TODO: This should be a utility function in TransferSession
-        if ((mTransfer.GetTransferLength() > 0) && ((seekOffset + blockSize) > mTransfer.GetTransferLength()))
-        {
-            // cast should be safe because of condition above
-            bytesToRead = static_cast<uint16_t>(mTransfer.GetTransferLength() - seekOffset);
-        }
-
-        chip::System::PacketBufferHandle blockBuf = chip::System::PacketBufferHandle::New(bytesToRead);
-        if (blockBuf.IsNull())
-        {
-            // TODO(#13981): AbortTransfer() needs to support GeneralStatusCode failures as well as BDX specific errors.
-            mTransfer.AbortTransfer(StatusCode::kUnknown);
-            return;
-        }
-
-        std::ifstream otaFile(mFileDesignator, std::ifstream::in);
-        if (!otaFile.good())
-        {
-            ChipLogError(BDX, "OTA file open failed");
-            mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
-            return;
-        }
-
-        if (seekOffset > static_cast<uint64_t>(std::numeric_limits<std::streamoff>::max()))
-        {
-            ChipLogError(BDX, "Seek offset too large");
-            mTransfer.AbortTransfer(StatusCode::kLengthTooLarge);
-            return;
-        }
-        otaFile.seekg(static_cast<std::streamoff>(seekOffset));
-        otaFile.read(reinterpret_cast<char *>(blockBuf->Start()), bytesToRead);
-        if (!(otaFile.good() || otaFile.eof()))
-        {
-            ChipLogError(BDX, "OTA file read failed");
-            mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
-            return;
-        }
-
-        blockData.Data   = blockBuf->Start();
-        blockData.Length = static_cast<size_t>(otaFile.gcount());
-        blockData.IsEof  = (blockData.Length < blockSize) ||
-            (seekOffset + static_cast<uint64_t>(blockData.Length) == mTransfer.GetTransferLength() || (otaFile.peek() == EOF));
-        mNumBytesSent = static_cast<uint32_t>(seekOffset + blockData.Length);
-        otaFile.close();
-
-        err = mTransfer.PrepareBlock(blockData);
-        if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(BDX, "PrepareBlock failed: %" CHIP_ERROR_FORMAT, err.Format());
-            mTransfer.AbortTransfer(StatusCode::kUnknown);
-        }
+        mPendingOffset = mNumBytesSent + bytesToSkip;
+        SendPendingBlock();
         break;
     }
     case TransferSession::OutputEventType::kAckReceived:
@@ -216,6 +200,106 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
     }
 }
 
+#if CHIP_BDX_READ_AHEAD_BLOCK_SOURCE
+void BdxOtaSender::SendPendingBlock()
+{
+    chip::ByteSpan block;
+    TransferSession::BlockData blockData;
+
+    CHIP_ERROR err = mBlockSource.GetBlock(mPendingOffset, block, blockData.IsEof);
+    if (err == CHIP_ERROR_IN_PROGRESS)
+    {
+        // OnBlockReady() will resume once the worker thread has read the block.
+        return;
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(BDX, "OTA file read failed: %" CHIP_ERROR_FORMAT, err.Format());
+        mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
+        return;
+    }
+
+    blockData.Data   = block.data();
+    blockData.Length = block.size();
+    mNumBytesSent    = static_cast<uint32_t>(mPendingOffset + blockData.Length);
+
+    // PrepareBlock copies the data into the outgoing message, so the block may be released afterwards.
+    err = mTransfer.PrepareBlock(blockData);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(BDX, "PrepareBlock failed: %" CHIP_ERROR_FORMAT, err.Format());
+        mTransfer.AbortTransfer(StatusCode::kUnknown);
+    }
+}
+
+void BdxOtaSender::OnBlockReady(ReadAheadBlockSource & source)
+{
+    VerifyOrReturn(mInitialized);
+    SendPendingBlock();
+    ScheduleImmediatePoll();
+}
+#else
+void BdxOtaSender::SendPendingBlock()
+{
+    TransferSession::BlockData blockData;
+    uint16_t blockSize   = mTransfer.GetTransferBlockSize();
+    uint16_t bytesToRead = blockSize;
+    uint64_t seekOffset  = mPendingOffset;
+
+    // TODO: This should be a utility function in TransferSession
+    if ((mTransfer.GetTransferLength() > 0) && ((seekOffset + blockSize) > mTransfer.GetTransferLength()))
+    {
+        // cast should be safe because of condition above
+        bytesToRead = static_cast<uint16_t>(mTransfer.GetTransferLength() - seekOffset);
+    }
+
+    chip::System::PacketBufferHandle blockBuf = chip::System::PacketBufferHandle::New(bytesToRead);
+    if (blockBuf.IsNull())
+    {
+        // TODO(#13981): AbortTransfer() needs to support GeneralStatusCode failures as well as BDX specific errors.
+        mTransfer.AbortTransfer(StatusCode::kUnknown);
+        return;
+    }
+
+    std::ifstream otaFile(mFileDesignator, std::ifstream::in);
+    if (!otaFile.good())
+    {
+        ChipLogError(BDX, "OTA file open failed");
+        mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
+        return;
+    }
+
+    if (seekOffset > static_cast<uint64_t>(std::numeric_limits<std::streamoff>::max()))
+    {
+        ChipLogError(BDX, "Seek offset too large");
+        mTransfer.AbortTransfer(StatusCode::kLengthTooLarge);
+        return;
+    }
+    otaFile.seekg(static_cast<std::streamoff>(seekOffset));
+    otaFile.read(reinterpret_cast<char *>(blockBuf->Start()), bytesToRead);
+    if (!(otaFile.good() || otaFile.eof()))
+    {
+        ChipLogError(BDX, "OTA file read failed");
+        mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
+        return;
+    }
+
+    blockData.Data   = blockBuf->Start();
+    blockData.Length = static_cast<size_t>(otaFile.gcount());
+    blockData.IsEof  = (blockData.Length < blockSize) ||
+        (seekOffset + static_cast<uint64_t>(blockData.Length) == mTransfer.GetTransferLength() || (otaFile.peek() == EOF));
+    mNumBytesSent = static_cast<uint32_t>(seekOffset + blockData.Length);
+    otaFile.close();
+
+    CHIP_ERROR err = mTransfer.PrepareBlock(blockData);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(BDX, "PrepareBlock failed: %" CHIP_ERROR_FORMAT, err.Format());
+        mTransfer.AbortTransfer(StatusCode::kUnknown);
+    }
+}
+#endif // CHIP_BDX_READ_AHEAD_BLOCK_SOURCE
+
 /* Reset() calls bdx::TransferSession::Reset() which sets the output event type to
  * TransferSession::OutputEventType::kNone. So, bdx::TransferFacilitator::PollForOutput()
  * will call HandleTransferSessionOutput() with event TransferSession::OutputEventType::kNone.
@@ -226,6 +310,9 @@ void BdxOtaSender::Reset()
     mFabricIndex.ClearValue();
     mNodeId.ClearValue();
     ResetTransfer();
+#if CHIP_BDX_READ_AHEAD_BLOCK_SOURCE
+    mBlockSource.Close();
+#endif
     if (mExchangeCtx != nullptr)
     {
         mExchangeCtx->Close();
@@ -233,7 +320,8 @@ void BdxOtaSender::Reset()
     }
 
     mInitialized  = false;
-    mNumBytesSent = 0;
+    mNumBytesSent  = 0;
+    mPendingOffset = 0;
     memset(mFileDesignator, 0, chip::bdx::kMaxFileDesignatorLen);
 }
 
@@ -20,7 +20,20 @@
 
 #pragma once
 
+// Set by the bdx library on the platforms that build the read-ahead block source.
+#ifndef CHIP_BDX_READ_AHEAD_BLOCK_SOURCE
+#define CHIP_BDX_READ_AHEAD_BLOCK_SOURCE 0
+#endif
+
+#if CHIP_BDX_READ_AHEAD_BLOCK_SOURCE
+#include <protocols/bdx/BdxReadAheadBlockSource.h>
+#endif
+
+#if CHIP_BDX_READ_AHEAD_BLOCK_SOURCE
+class BdxOtaSender : public chip::bdx::Responder, public chip::bdx::ReadAheadBlockSource::Callback
+#else
 class BdxOtaSender : public chip::bdx::Responder
+#endif
 {
 public:
     BdxOtaSender();
@@ -34,8 +47,24 @@ private:
     // Inherited from bdx::TransferFacilitator
     void HandleTransferSessionOutput(chip::bdx::TransferSession::OutputEvent & event) override;
 
+#if CHIP_BDX_READ_AHEAD_BLOCK_SOURCE
+    // Inherited from bdx::ReadAheadBlockSource::Callback
+    void OnBlockReady(chip::bdx::ReadAheadBlockSource & source) override;
+#endif
+
+    // Sends the block at mPendingOffset if it has been read, otherwise waits for OnBlockReady().  Without the read-ahead
+    // block source, the block is read synchronously.
+    void SendPendingBlock();
+
     void Reset();
 
+#if CHIP_BDX_READ_AHEAD_BLOCK_SOURCE
+    // Image blocks are read and prefetched off the Matter thread, shared with other transfers of the same file.
+    chip::bdx::ReadAheadBlockSource mBlockSource;
+#endif
+
+    uint64_t mPendingOffset = 0;
+
     // Null-terminated string representing file designator
     char mFileDesignator[chip::bdx::kMaxFileDesignatorLen];
 
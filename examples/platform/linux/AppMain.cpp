@@ -23,6 +23,9 @@
 
 #include <app/InteractionModelEngine.h>
 #include <app/clusters/network-commissioning/network-commissioning.h>
+#include <app/persistence/AttributePersistenceProviderInstance.h>
+#include <app/persistence/DefaultAttributePersistenceProvider.h>
+#include <app/persistence/WriteBackAttributePersistenceProvider.h>
 #include <app/server/Dnssd.h>
 #include <app/server/Server.h>
 #include <app/util/endpoint-config-api.h>
@@ -121,6 +124,7 @@
 #endif
 #include <app/TestEventTriggerDelegate.h>
 
+#include <optional>
 #include <signal.h>
 
 #include "AppMain.h"
@@ -142,6 +146,7 @@
 #endif // CHIP_DEVICE_LAYER_TARGET_DARWIN
 
 #if CHIP_DEVICE_LAYER_TARGET_LINUX
+#include <platform/Linux/CounterFileStore.h>
 #include <platform/Linux/NetworkCommissioningDriver.h>
 #endif // CHIP_DEVICE_LAYER_TARGET_LINUX
 
@@ -317,6 +322,16 @@ LinuxCommissionableDataProvider gCommissionableDataProvider;
 chip::DeviceLayer::DeviceInfoProviderImpl gExampleDeviceInfoProvider;
 chip::DeviceLayer::AllClustersExampleDeviceInfoProviderImpl gAllClustersExampleDeviceInfoProvider;
 
+// Attribute persistence caching the writes, when enabled by --attribute-write-back-delay-ms.
+constexpr size_t kAttributeWriteBackMaxDirtyBytes = 4096;
+app::DefaultAttributePersistenceProvider gAttributePersister;
+std::optional<app::WriteBackAttributePersistenceProvider> gWriteBackAttributePersister;
+
+#if CHIP_DEVICE_LAYER_TARGET_LINUX && defined(CHIP_CONFIG_KVS_PATH)
+// Counter leases of the event number and group message counters, shut down after the server detached its counters.
+DeviceLayer::PersistedStorage::CounterFileStore gCounterFileStore;
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX && defined(CHIP_CONFIG_KVS_PATH)
+
 void EventHandler(const DeviceLayer::ChipDeviceEvent * event, intptr_t arg)
 {
     (void) arg;
@@ -618,6 +633,10 @@ int ChipLinuxAppInit(int argc, char * const argv[], OptionSet * customOptions,
     err = DeviceLayer::PlatformMgr().InitChipStack();
     SuccessOrExit(err);
 
+    // Run the session establishment crypto (CASE certificate and signature checks) on the background workers.
+    err = DeviceLayer::PlatformMgr().StartBackgroundEventLoopTask();
+    SuccessOrExit(err);
+
     // Init the commissionable data provider based on command line options
     // to handle custom verifiers, discriminators, etc.
     err = chip::examples::InitCommissionableDataProvider(gCommissionableDataProvider, LinuxDeviceOptions::GetInstance());
@@ -783,6 +802,17 @@ void ChipLinuxAppMainLoop(AppMainLoopImplementation * impl)
     VerifyOrDie(initParams.InitializeStaticResourcesBeforeServerInit() == CHIP_NO_ERROR);
     initParams.dataModelProvider = app::CodegenDataModelProviderInstance(initParams.persistentStorageDelegate);
 
+    if (LinuxDeviceOptions::GetInstance().attributeWriteBackDelay.HasValue())
+    {
+        // Installed before the data model provider starts up, which would install a write-through persister otherwise.
+        VerifyOrDie(gAttributePersister.Init(initParams.persistentStorageDelegate) == CHIP_NO_ERROR);
+        gWriteBackAttributePersister.emplace(
+            gAttributePersister, DeviceLayer::SystemLayer(),
+            app::WriteBackAttributePersistenceProvider::Config{ LinuxDeviceOptions::GetInstance().attributeWriteBackDelay.Value(),
+                                                                kAttributeWriteBackMaxDirtyBytes });
+        app::SetAttributePersistenceProvider(&gWriteBackAttributePersister.value());
+    }
+
 #if CHIP_CONFIG_TERMS_AND_CONDITIONS_REQUIRED
     if (LinuxDeviceOptions::GetInstance().tcVersion.HasValue() && LinuxDeviceOptions::GetInstance().tcRequired.HasValue())
     {
@@ -905,6 +935,24 @@ void ChipLinuxAppMainLoop(AppMainLoopImplementation * impl)
 
     initParams.testEventTriggerDelegate = &sTestEventTriggerDelegate;
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX && defined(CHIP_CONFIG_KVS_PATH)
+    // Keep the event number and group message counters next to the KVS, in a file that is updated in place rather than
+    // rewritten with the whole KVS every time a counter reserves a new range of values.
+    {
+        const char * kvsPath = LinuxDeviceOptions::GetInstance().KVS;
+        std::string counterFilePath((kvsPath != nullptr) ? kvsPath : CHIP_CONFIG_KVS_PATH);
+        counterFilePath += "-counters";
+
+        CHIP_ERROR counterErr = gCounterFileStore.Init(counterFilePath.c_str(), initParams.persistentStorageDelegate);
+        if (counterErr != CHIP_NO_ERROR)
+        {
+            ChipLogError(AppServer, "Counter file init failed: %" CHIP_ERROR_FORMAT, counterErr.Format());
+            chipDie();
+        }
+        initParams.counterLeaseStore = &gCounterFileStore;
+    }
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX && defined(CHIP_CONFIG_KVS_PATH)
+
     chip::app::RuntimeOptionsProvider::Instance().SetSimulateNoInternalTime(
         LinuxDeviceOptions::GetInstance().mSimulateNoInternalTime);
 
@@ -1035,6 +1083,16 @@ void ChipLinuxAppMainLoop(AppMainLoopImplementation * impl)
 
     Server::GetInstance().Shutdown();
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX && defined(CHIP_CONFIG_KVS_PATH)
+    gCounterFileStore.Shutdown();
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX && defined(CHIP_CONFIG_KVS_PATH)
+
+    if (gWriteBackAttributePersister.has_value())
+    {
+        // Write the cached attribute values while the system layer still runs.
+        gWriteBackAttributePersister->Shutdown();
+    }
+
 #if CHIP_DEVICE_CONFIG_ENABLE_BOTH_COMMISSIONER_AND_COMMISSIONEE
     // Commissioner shutdown call shuts down entire stack, including the platform manager.
     ShutdownCommissioner();
@@ -91,6 +91,7 @@ enum
     kDeviceOption_Command,
     kDeviceOption_PICS,
     kDeviceOption_KVS,
+    kDeviceOption_AttributeWriteBackDelay,
     kDeviceOption_InterfaceId,
     kDeviceOption_AppPipe,
     kDeviceOption_Spake2pVerifierBase64,
@@ -199,6 +200,7 @@ OptionDef sDeviceOptionDefs[] = {
     { "command", kArgumentRequired, kDeviceOption_Command },
     { "PICS", kArgumentRequired, kDeviceOption_PICS },
     { "KVS", kArgumentRequired, kDeviceOption_KVS },
+    { "attribute-write-back-delay-ms", kArgumentRequired, kDeviceOption_AttributeWriteBackDelay },
     { "interface-id", kArgumentRequired, kDeviceOption_InterfaceId },
     { "app-pipe", kArgumentRequired, kDeviceOption_AppPipe },
 #if CHIP_CONFIG_TRANSPORT_TRACE_ENABLED
@@ -359,6 +361,10 @@ const char * sDeviceOptionHelp =
     "  --KVS <filepath>\n"
     "       A file to store Key Value Store items.\n"
     "\n"
+    "  --attribute-write-back-delay-ms <milliseconds>\n"
+    "       Cache the writes of non-volatile attributes, and write them to the Key Value Store at most this long after they\n"
+    "       change, and on exit. Attributes changing several times within the delay are written once.\n"
+    "\n"
     "  --interface-id <interface>\n"
     "       A interface id to advertise on.\n"
     "\n"
@@ -711,6 +717,20 @@ bool HandleOption(const char * aProgram, OptionSet * aOptions, int aIdentifier,
         LinuxDeviceOptions::GetInstance().KVS = aValue;
         break;
 
+    case kDeviceOption_AttributeWriteBackDelay: {
+        uint32_t value = static_cast<uint32_t>(strtoul(aValue, nullptr, 0));
+        if (value < 1)
+        {
+            PrintArgError("%s: invalid value specified for attribute-write-back-delay-ms: %s\n", aProgram, aValue);
+            retval = false;
+        }
+        else
+        {
+            LinuxDeviceOptions::GetInstance().attributeWriteBackDelay.SetValue(chip::System::Clock::Milliseconds32(value));
+        }
+        break;
+    }
+
     case kDeviceOption_AppPipe:
         LinuxDeviceOptions::GetInstance().app_pipe = aValue;
         break;
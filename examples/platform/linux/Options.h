@@ -113,6 +113,7 @@ struct LinuxDeviceOptions
     chip::Optional<std::string> productName;
     chip::Optional<std::string> hardwareVersionString;
     chip::Optional<std::string> serialNumber;
+    chip::Optional<chip::System::Clock::Milliseconds32> attributeWriteBackDelay;
     static LinuxDeviceOptions & GetInstance();
 };
 
@@ -0,0 +1,860 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/BatchedSubscriptionResumptionStorage.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+bool PathsEqual(const SubscriptionResumptionStorage::AttributePathParamsValues & a,
+                const SubscriptionResumptionStorage::AttributePathParamsValues & b)
+{
+    return (a.mEndpointId == b.mEndpointId) && (a.mClusterId == b.mClusterId) && (a.mAttributeId == b.mAttributeId);
+}
+
+bool PathsEqual(const SubscriptionResumptionStorage::EventPathParamsValues & a,
+                const SubscriptionResumptionStorage::EventPathParamsValues & b)
+{
+    return (a.mEndpointId == b.mEndpointId) && (a.mClusterId == b.mClusterId) && (a.mEventId == b.mEventId) &&
+        (a.mIsUrgentEvent == b.mIsUrgentEvent);
+}
+
+template <typename PathType>
+CHIP_ERROR CopyPaths(const Platform::ScopedMemoryBufferWithSize<PathType> & source,
+                     Platform::ScopedMemoryBufferWithSize<PathType> & destination)
+{
+    destination.Free();
+    if (source.AllocatedSize() == 0)
+    {
+        return CHIP_NO_ERROR;
+    }
+    destination.Calloc(source.AllocatedSize());
+    VerifyOrReturnError(destination.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    memcpy(destination.Get(), source.Get(), source.AllocatedSize() * sizeof(PathType));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR WritePath(TLV::TLVWriter & writer, const SubscriptionResumptionStorage::AttributePathParamsValues & path)
+{
+    ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), path.mEndpointId));
+    ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), path.mClusterId));
+    return writer.Put(TLV::AnonymousTag(), path.mAttributeId);
+}
+
+CHIP_ERROR WritePath(TLV::TLVWriter & writer, const SubscriptionResumptionStorage::EventPathParamsValues & path)
+{
+    ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), path.mIsUrgentEvent));
+    ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), path.mEndpointId));
+    ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), path.mClusterId));
+    return writer.Put(TLV::AnonymousTag(), path.mEventId);
+}
+
+template <typename T>
+CHIP_ERROR ReadNextAnonymous(TLV::TLVReader & reader, T & value)
+{
+    ReturnErrorOnFailure(reader.Next(TLV::AnonymousTag()));
+    return reader.Get(value);
+}
+
+CHIP_ERROR ReadPath(TLV::TLVReader & reader, SubscriptionResumptionStorage::AttributePathParamsValues & path)
+{
+    ReturnErrorOnFailure(ReadNextAnonymous(reader, path.mEndpointId));
+    ReturnErrorOnFailure(ReadNextAnonymous(reader, path.mClusterId));
+    return ReadNextAnonymous(reader, path.mAttributeId);
+}
+
+CHIP_ERROR ReadPath(TLV::TLVReader & reader, SubscriptionResumptionStorage::EventPathParamsValues & path)
+{
+    ReturnErrorOnFailure(ReadNextAnonymous(reader, path.mIsUrgentEvent));
+    ReturnErrorOnFailure(ReadNextAnonymous(reader, path.mEndpointId));
+    ReturnErrorOnFailure(ReadNextAnonymous(reader, path.mClusterId));
+    return ReadNextAnonymous(reader, path.mEventId);
+}
+
+constexpr size_t ElementsPerPath(const SubscriptionResumptionStorage::AttributePathParamsValues *)
+{
+    return 3;
+}
+
+constexpr size_t ElementsPerPath(const SubscriptionResumptionStorage::EventPathParamsValues *)
+{
+    return 4;
+}
+
+/**
+ * Reads a list of flattened path sets. `indexMap[i]` is set to the table index acquired for the
+ * i-th set in the list. The caller owns one reference per mapped index.
+ */
+template <typename PathType, typename Table>
+CHIP_ERROR ReadPathSets(TLV::TLVReader & reader, TLV::Tag tag, Table & table,
+                        Platform::ScopedMemoryBufferWithSize<uint16_t> & indexMap)
+{
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_List, tag));
+    TLV::TLVType listType;
+    ReturnErrorOnFailure(reader.EnterContainer(listType));
+
+    size_t setCount = 0;
+    ReturnErrorOnFailure(reader.CountRemainingInContainer(&setCount));
+    indexMap.Free();
+    if (setCount > 0)
+    {
+        indexMap.Calloc(setCount);
+        VerifyOrReturnError(indexMap.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+        for (size_t i = 0; i < setCount; i++)
+        {
+            indexMap[i] = BatchedSubscriptionResumptionStorage::kNoPathSet;
+        }
+    }
+
+    for (size_t setIndex = 0; setIndex < setCount; setIndex++)
+    {
+        ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, TLV::AnonymousTag()));
+        TLV::TLVType arrayType;
+        ReturnErrorOnFailure(reader.EnterContainer(arrayType));
+
+        size_t elementCount = 0;
+        ReturnErrorOnFailure(reader.CountRemainingInContainer(&elementCount));
+        constexpr size_t kElementsPerPath = ElementsPerPath(static_cast<const PathType *>(nullptr));
+        VerifyOrReturnError((elementCount % kElementsPerPath) == 0, CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+        Platform::ScopedMemoryBufferWithSize<PathType> paths;
+        size_t pathCount = elementCount / kElementsPerPath;
+        if (pathCount > 0)
+        {
+            paths.Calloc(pathCount);
+            VerifyOrReturnError(paths.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+        }
+        for (size_t pathIndex = 0; pathIndex < pathCount; pathIndex++)
+        {
+            ReturnErrorOnFailure(ReadPath(reader, paths[pathIndex]));
+        }
+        ReturnErrorOnFailure(reader.ExitContainer(arrayType));
+
+        ReturnErrorOnFailure(table.Acquire(paths.Get(), paths.AllocatedSize(), indexMap[setIndex]));
+    }
+
+    return reader.ExitContainer(listType);
+}
+
+} // namespace
+
+constexpr System::Clock::Timeout BatchedSubscriptionResumptionStorage::kDefaultCommitDelay;
+constexpr TLV::Tag BatchedSubscriptionResumptionStorage::kRecordVersionTag;
+constexpr TLV::Tag BatchedSubscriptionResumptionStorage::kAttributePathSetsTag;
+constexpr TLV::Tag BatchedSubscriptionResumptionStorage::kEventPathSetsTag;
+constexpr TLV::Tag BatchedSubscriptionResumptionStorage::kSubscriptionsTag;
+constexpr TLV::Tag BatchedSubscriptionResumptionStorage::kAttributePathSetRefTag;
+constexpr TLV::Tag BatchedSubscriptionResumptionStorage::kEventPathSetRefTag;
+constexpr TLV::Tag BatchedSubscriptionResumptionStorage::kBatchResumptionRetryTag;
+
+template <typename PathType>
+CHIP_ERROR BatchedSubscriptionResumptionStorage::PathSetTable<PathType>::Acquire(const PathType * paths, size_t count,
+                                                                                 uint16_t & outIndex)
+{
+    outIndex = kNoPathSet;
+    if (count == 0)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    uint16_t freeIndex = kNoPathSet;
+    for (uint16_t index = 0; index < kMaxSets; index++)
+    {
+        Entry & set = mSets[index];
+        if (set.mRefCount == 0)
+        {
+            if (freeIndex == kNoPathSet)
+            {
+                freeIndex = index;
+            }
+            continue;
+        }
+        if (set.mPaths.AllocatedSize() != count)
+        {
+            continue;
+        }
+
+        bool equal = true;
+        for (size_t i = 0; equal && i < count; i++)
+        {
+            equal = PathsEqual(set.mPaths[i], paths[i]);
+        }
+        if (equal)
+        {
+            set.mRefCount++;
+            outIndex = index;
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    VerifyOrReturnError(freeIndex != kNoPathSet, CHIP_ERROR_NO_MEMORY);
+
+    Entry & set = mSets[freeIndex];
+    set.mPaths.Calloc(count);
+    VerifyOrReturnError(set.mPaths.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    memcpy(set.mPaths.Get(), paths, count * sizeof(PathType));
+    set.mRefCount = 1;
+    outIndex      = freeIndex;
+    return CHIP_NO_ERROR;
+}
+
+template <typename PathType>
+void BatchedSubscriptionResumptionStorage::PathSetTable<PathType>::Release(uint16_t index)
+{
+    VerifyOrReturn(index < kMaxSets && mSets[index].mRefCount > 0);
+    if (--mSets[index].mRefCount == 0)
+    {
+        mSets[index].mPaths.Free();
+    }
+}
+
+template <typename PathType>
+void BatchedSubscriptionResumptionStorage::PathSetTable<PathType>::Clear()
+{
+    for (auto & set : mSets)
+    {
+        set.mPaths.Free();
+        set.mRefCount = 0;
+    }
+}
+
+template <typename PathType>
+size_t BatchedSubscriptionResumptionStorage::PathSetTable<PathType>::Count() const
+{
+    size_t count = 0;
+    for (const auto & set : mSets)
+    {
+        count += (set.mRefCount > 0) ? 1 : 0;
+    }
+    return count;
+}
+
+template class BatchedSubscriptionResumptionStorage::PathSetTable<SubscriptionResumptionStorage::AttributePathParamsValues>;
+template class BatchedSubscriptionResumptionStorage::PathSetTable<SubscriptionResumptionStorage::EventPathParamsValues>;
+
+size_t BatchedSubscriptionResumptionStorage::BatchedSubscriptionInfoIterator::Count()
+{
+    return mStorage.ResidentCount();
+}
+
+bool BatchedSubscriptionResumptionStorage::BatchedSubscriptionInfoIterator::Next(SubscriptionInfo & output)
+{
+    for (; mNextIndex < MATTER_ARRAY_SIZE(mStorage.mEntries); mNextIndex++)
+    {
+        const Entry & entry = mStorage.mEntries[mNextIndex];
+        if (!entry.mInUse)
+        {
+            continue;
+        }
+
+        output.mNodeId         = entry.mNodeId;
+        output.mFabricIndex    = entry.mFabricIndex;
+        output.mSubscriptionId = entry.mSubscriptionId;
+#if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+        output.mResumptionRetries = entry.mResumptionRetries;
+#endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+        output.mMinInterval    = entry.mMinInterval;
+        output.mMaxInterval    = entry.mMaxInterval;
+        output.mFabricFiltered = entry.mFabricFiltered;
+
+        output.mAttributePaths.Free();
+        output.mEventPaths.Free();
+
+        const auto * attributePaths = mStorage.mAttributePathSets.Get(entry.mAttributePathSet);
+        const auto * eventPaths     = mStorage.mEventPathSets.Get(entry.mEventPathSet);
+        CHIP_ERROR err              = CHIP_NO_ERROR;
+        if (attributePaths != nullptr)
+        {
+            err = CopyPaths(*attributePaths, output.mAttributePaths);
+        }
+        if (err == CHIP_NO_ERROR && eventPaths != nullptr)
+        {
+            err = CopyPaths(*eventPaths, output.mEventPaths);
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "Failed to copy subscription paths at index %u error %" CHIP_ERROR_FORMAT,
+                         static_cast<unsigned>(mNextIndex), err.Format());
+            continue;
+        }
+
+        mNextIndex++;
+        return true;
+    }
+
+    return false;
+}
+
+void BatchedSubscriptionResumptionStorage::BatchedSubscriptionInfoIterator::Release()
+{
+    mStorage.mBatchedIterators.ReleaseObject(this);
+}
+
+BatchedSubscriptionResumptionStorage::~BatchedSubscriptionResumptionStorage()
+{
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(OnCommitTimer, this);
+    }
+}
+
+CHIP_ERROR BatchedSubscriptionResumptionStorage::Init(PersistentStorageDelegate * storage, System::Layer * systemLayer,
+                                                      System::Clock::Timeout commitDelay)
+{
+    VerifyOrReturnError(storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    mStorage     = storage;
+    mSystemLayer = systemLayer;
+    mCommitDelay = commitDelay;
+    mDirty       = false;
+
+    for (auto & entry : mEntries)
+    {
+        entry = Entry();
+    }
+    mAttributePathSets.Clear();
+    mEventPathSets.Clear();
+
+    CHIP_ERROR err = LoadRecord();
+    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        ChipLogError(DataManagement, "Failed to load subscription resumption record: %" CHIP_ERROR_FORMAT, err.Format());
+        for (auto & entry : mEntries)
+        {
+            entry = Entry();
+        }
+        mAttributePathSets.Clear();
+        mEventPathSets.Clear();
+        mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::SubscriptionResumptionBatch().KeyName());
+    }
+
+    return MigrateLegacyEntries();
+}
+
+void BatchedSubscriptionResumptionStorage::Shutdown()
+{
+    VerifyOrReturn(mStorage != nullptr);
+
+    if (mDirty)
+    {
+        CHIP_ERROR err = Commit();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "Failed to commit subscription resumption record: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+    }
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(OnCommitTimer, this);
+        mSystemLayer = nullptr;
+    }
+
+    for (auto & entry : mEntries)
+    {
+        entry = Entry();
+    }
+    mAttributePathSets.Clear();
+    mEventPathSets.Clear();
+    mStorage = nullptr;
+}
+
+CHIP_ERROR BatchedSubscriptionResumptionStorage::MigrateLegacyEntries()
+{
+    uint16_t countMax = CHIP_IM_MAX_NUM_SUBSCRIPTIONS;
+    uint16_t len      = sizeof(countMax);
+    CHIP_ERROR err =
+        mStorage->SyncGetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumptionMaxCount().KeyName(), &countMax, len);
+    if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        // Legacy storage always records the max count alongside its entries.
+        return CHIP_NO_ERROR;
+    }
+
+    Platform::ScopedMemoryBuffer<bool> migrated;
+    migrated.Calloc(countMax);
+    VerifyOrReturnError(countMax == 0 || migrated.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    bool complete = true;
+    for (uint16_t subscriptionIndex = 0; subscriptionIndex < countMax; subscriptionIndex++)
+    {
+        SubscriptionInfo subscriptionInfo;
+        err = SimpleSubscriptionResumptionStorage::Load(subscriptionIndex, subscriptionInfo);
+        if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+        {
+            continue;
+        }
+        if (err != CHIP_NO_ERROR && err != CHIP_ERROR_NO_MEMORY)
+        {
+            // Unreadable entries are dropped, as SimpleSubscriptionResumptionStorage does.
+            ChipLogError(DataManagement, "Dropping unreadable legacy subscription at index %u: %" CHIP_ERROR_FORMAT,
+                         static_cast<unsigned>(subscriptionIndex), err.Format());
+            SimpleSubscriptionResumptionStorage::Delete(subscriptionIndex);
+            continue;
+        }
+        if (err == CHIP_NO_ERROR)
+        {
+            err = Store(subscriptionInfo);
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "Keeping legacy subscription at index %u: %" CHIP_ERROR_FORMAT,
+                         static_cast<unsigned>(subscriptionIndex), err.Format());
+            complete = false;
+            continue;
+        }
+        migrated[subscriptionIndex] = true;
+        mDirty                      = true;
+    }
+
+    // Legacy entries are only deleted once the batched record holding them is durable.
+    if (mDirty)
+    {
+        ReturnErrorOnFailure(Commit());
+    }
+    for (uint16_t subscriptionIndex = 0; subscriptionIndex < countMax; subscriptionIndex++)
+    {
+        if (migrated[subscriptionIndex])
+        {
+            SimpleSubscriptionResumptionStorage::Delete(subscriptionIndex);
+        }
+    }
+
+    // Entries left behind are tried again on the next Init.
+    if (complete)
+    {
+        DeleteMaxCount();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BatchedSubscriptionResumptionStorage::LoadRecord()
+{
+    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
+    backingBuffer.Calloc(MaxRecordSize());
+    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    uint16_t len = static_cast<uint16_t>(MaxRecordSize());
+    ReturnErrorOnFailure(
+        mStorage->SyncGetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumptionBatch().KeyName(), backingBuffer.Get(), len));
+
+    TLV::ScopedBufferTLVReader reader(std::move(backingBuffer), len);
+
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
+    TLV::TLVType recordType;
+    ReturnErrorOnFailure(reader.EnterContainer(recordType));
+
+    uint8_t version;
+    ReturnErrorOnFailure(reader.Next(kRecordVersionTag));
+    ReturnErrorOnFailure(reader.Get(version));
+    VerifyOrReturnError(version == kRecordVersion, CHIP_ERROR_VERSION_MISMATCH);
+
+    // Each set read from storage holds one reference until every subscription has been loaded.
+    Platform::ScopedMemoryBufferWithSize<uint16_t> attributeSetMap;
+    Platform::ScopedMemoryBufferWithSize<uint16_t> eventSetMap;
+    CHIP_ERROR err = ReadPathSets<AttributePathParamsValues>(reader, kAttributePathSetsTag, mAttributePathSets, attributeSetMap);
+    SuccessOrExit(err);
+    err = ReadPathSets<EventPathParamsValues>(reader, kEventPathSetsTag, mEventPathSets, eventSetMap);
+    SuccessOrExit(err);
+
+    {
+        TLV::TLVType subscriptionsType;
+        err = reader.Next(TLV::kTLVType_List, kSubscriptionsTag);
+        SuccessOrExit(err);
+        err = reader.EnterContainer(subscriptionsType);
+        SuccessOrExit(err);
+        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        {
+            err = LoadSubscription(reader, attributeSetMap.Get(), attributeSetMap.AllocatedSize(), eventSetMap.Get(),
+                                   eventSetMap.AllocatedSize());
+            SuccessOrExit(err);
+        }
+        VerifyOrExit(err == CHIP_END_OF_TLV, /* err holds the decode failure */);
+        err = reader.ExitContainer(subscriptionsType);
+        SuccessOrExit(err);
+    }
+
+    err = reader.ExitContainer(recordType);
+
+exit:
+    for (size_t i = 0; i < attributeSetMap.AllocatedSize(); i++)
+    {
+        mAttributePathSets.Release(attributeSetMap[i]);
+    }
+    for (size_t i = 0; i < eventSetMap.AllocatedSize(); i++)
+    {
+        mEventPathSets.Release(eventSetMap[i]);
+    }
+    return err;
+}
+
+CHIP_ERROR BatchedSubscriptionResumptionStorage::LoadSubscription(TLV::TLVReader & reader, const uint16_t * attributeSetMap,
+                                                                  size_t attributeSetCount, const uint16_t * eventSetMap,
+                                                                  size_t eventSetCount)
+{
+    VerifyOrReturnError(reader.GetType() == TLV::kTLVType_Structure, CHIP_ERROR_WRONG_TLV_TYPE);
+
+    Entry * entry = nullptr;
+    for (auto & candidate : mEntries)
+    {
+        if (!candidate.mInUse)
+        {
+            entry = &candidate;
+            break;
+        }
+    }
+    if (entry == nullptr)
+    {
+        // CHIP_IM_MAX_NUM_SUBSCRIPTIONS shrank since the record was written: drop the excess.
+        return CHIP_NO_ERROR;
+    }
+
+    Entry loaded;
+    TLV::TLVType subscriptionType;
+    ReturnErrorOnFailure(reader.EnterContainer(subscriptionType));
+
+    ReturnErrorOnFailure(reader.Next(kPeerNodeIdTag));
+    ReturnErrorOnFailure(reader.Get(loaded.mNodeId));
+    ReturnErrorOnFailure(reader.Next(kFabricIndexTag));
+    ReturnErrorOnFailure(reader.Get(loaded.mFabricIndex));
+    ReturnErrorOnFailure(reader.Next(kSubscriptionIdTag));
+    ReturnErrorOnFailure(reader.Get(loaded.mSubscriptionId));
+    ReturnErrorOnFailure(reader.Next(kMinIntervalTag));
+    ReturnErrorOnFailure(reader.Get(loaded.mMinInterval));
+    ReturnErrorOnFailure(reader.Next(kMaxIntervalTag));
+    ReturnErrorOnFailure(reader.Get(loaded.mMaxInterval));
+    ReturnErrorOnFailure(reader.Next(kFabricFilteredTag));
+    ReturnErrorOnFailure(reader.Get(loaded.mFabricFiltered));
+
+    uint16_t attributeSetPosition = kNoPathSet;
+    uint16_t eventSetPosition     = kNoPathSet;
+    loaded.mResumptionRetries     = 0;
+
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        TLV::Tag tag = reader.GetTag();
+        if (tag == kAttributePathSetRefTag)
+        {
+            ReturnErrorOnFailure(reader.Get(attributeSetPosition));
+            VerifyOrReturnError(attributeSetPosition < attributeSetCount, CHIP_ERROR_INVALID_TLV_ELEMENT);
+        }
+        else if (tag == kEventPathSetRefTag)
+        {
+            ReturnErrorOnFailure(reader.Get(eventSetPosition));
+            VerifyOrReturnError(eventSetPosition < eventSetCount, CHIP_ERROR_INVALID_TLV_ELEMENT);
+        }
+        else if (tag == kBatchResumptionRetryTag)
+        {
+            ReturnErrorOnFailure(reader.Get(loaded.mResumptionRetries));
+        }
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    ReturnErrorOnFailure(reader.ExitContainer(subscriptionType));
+
+    // Take a reference on behalf of the subscription; the position map holds its own until loading is done.
+    if (attributeSetPosition != kNoPathSet)
+    {
+        const auto * paths = mAttributePathSets.Get(attributeSetMap[attributeSetPosition]);
+        VerifyOrReturnError(paths != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        ReturnErrorOnFailure(mAttributePathSets.Acquire(paths->Get(), paths->AllocatedSize(), loaded.mAttributePathSet));
+    }
+    if (eventSetPosition != kNoPathSet)
+    {
+        const auto * paths = mEventPathSets.Get(eventSetMap[eventSetPosition]);
+        VerifyOrReturnError(paths != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        CHIP_ERROR acquireErr = mEventPathSets.Acquire(paths->Get(), paths->AllocatedSize(), loaded.mEventPathSet);
+        if (acquireErr != CHIP_NO_ERROR)
+        {
+            mAttributePathSets.Release(loaded.mAttributePathSet);
+            return acquireErr;
+        }
+    }
+
+    loaded.mInUse = true;
+    *entry        = loaded;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BatchedSubscriptionResumptionStorage::WriteRecord(TLV::TLVWriter & writer)
+{
+    // Path sets are written compacted: positions in the record may differ from table indices.
+    uint16_t attributeSetPositions[PathSetTable<AttributePathParamsValues>::kMaxSets];
+    uint16_t eventSetPositions[PathSetTable<EventPathParamsValues>::kMaxSets];
+
+    TLV::TLVType recordType;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, recordType));
+    ReturnErrorOnFailure(writer.Put(kRecordVersionTag, kRecordVersion));
+
+    TLV::TLVType listType;
+    TLV::TLVType arrayType;
+    uint16_t position = 0;
+    ReturnErrorOnFailure(writer.StartContainer(kAttributePathSetsTag, TLV::kTLVType_List, listType));
+    for (uint16_t index = 0; index < MATTER_ARRAY_SIZE(attributeSetPositions); index++)
+    {
+        attributeSetPositions[index] = kNoPathSet;
+        const auto * paths           = mAttributePathSets.Get(index);
+        if (paths == nullptr)
+        {
+            continue;
+        }
+
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, arrayType));
+        for (size_t i = 0; i < paths->AllocatedSize(); i++)
+        {
+            ReturnErrorOnFailure(WritePath(writer, (*paths)[i]));
+        }
+        ReturnErrorOnFailure(writer.EndContainer(arrayType));
+        attributeSetPositions[index] = position++;
+    }
+    ReturnErrorOnFailure(writer.EndContainer(listType));
+
+    position = 0;
+    ReturnErrorOnFailure(writer.StartContainer(kEventPathSetsTag, TLV::kTLVType_List, listType));
+    for (uint16_t index = 0; index < MATTER_ARRAY_SIZE(eventSetPositions); index++)
+    {
+        eventSetPositions[index] = kNoPathSet;
+        const auto * paths       = mEventPathSets.Get(index);
+        if (paths == nullptr)
+        {
+            continue;
+        }
+
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, arrayType));
+        for (size_t i = 0; i < paths->AllocatedSize(); i++)
+        {
+            ReturnErrorOnFailure(WritePath(writer, (*paths)[i]));
+        }
+        ReturnErrorOnFailure(writer.EndContainer(arrayType));
+        eventSetPositions[index] = position++;
+    }
+    ReturnErrorOnFailure(writer.EndContainer(listType));
+
+    ReturnErrorOnFailure(writer.StartContainer(kSubscriptionsTag, TLV::kTLVType_List, listType));
+    for (const auto & entry : mEntries)
+    {
+        if (!entry.mInUse)
+        {
+            continue;
+        }
+
+        TLV::TLVType subscriptionType;
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, subscriptionType));
+        ReturnErrorOnFailure(writer.Put(kPeerNodeIdTag, entry.mNodeId));
+        ReturnErrorOnFailure(writer.Put(kFabricIndexTag, entry.mFabricIndex));
+        ReturnErrorOnFailure(writer.Put(kSubscriptionIdTag, entry.mSubscriptionId));
+        ReturnErrorOnFailure(writer.Put(kMinIntervalTag, entry.mMinInterval));
+        ReturnErrorOnFailure(writer.Put(kMaxIntervalTag, entry.mMaxInterval));
+        ReturnErrorOnFailure(writer.Put(kFabricFilteredTag, entry.mFabricFiltered));
+        if (entry.mAttributePathSet != kNoPathSet)
+        {
+            ReturnErrorOnFailure(writer.Put(kAttributePathSetRefTag, attributeSetPositions[entry.mAttributePathSet]));
+        }
+        if (entry.mEventPathSet != kNoPathSet)
+        {
+            ReturnErrorOnFailure(writer.Put(kEventPathSetRefTag, eventSetPositions[entry.mEventPathSet]));
+        }
+        if (entry.mResumptionRetries != 0)
+        {
+            ReturnErrorOnFailure(writer.Put(kBatchResumptionRetryTag, entry.mResumptionRetries));
+        }
+        ReturnErrorOnFailure(writer.EndContainer(subscriptionType));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(listType));
+
+    return writer.EndContainer(recordType);
+}
+
+CHIP_ERROR BatchedSubscriptionResumptionStorage::Commit()
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(OnCommitTimer, this);
+    }
+
+    if (ResidentCount() == 0)
+    {
+        CHIP_ERROR err = mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::SubscriptionResumptionBatch().KeyName());
+        VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND, err);
+        mDirty = false;
+        return CHIP_NO_ERROR;
+    }
+
+    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
+    backingBuffer.Calloc(MaxRecordSize());
+    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), MaxRecordSize());
+    ReturnErrorOnFailure(WriteRecord(writer));
+
+    const auto len = writer.GetLengthWritten();
+    VerifyOrReturnError(CanCastTo<uint16_t>(len), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    writer.Finalize(backingBuffer);
+
+    ReturnErrorOnFailure(mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::SubscriptionResumptionBatch().KeyName(),
+                                                   backingBuffer.Get(), static_cast<uint16_t>(len)));
+    mDirty = false;
+    return CHIP_NO_ERROR;
+}
+
+void BatchedSubscriptionResumptionStorage::OnCommitTimer(System::Layer * layer, void * appState)
+{
+    auto * self    = static_cast<BatchedSubscriptionResumptionStorage *>(appState);
+    CHIP_ERROR err = self->Commit();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Deferred subscription resumption commit failed: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+CHIP_ERROR BatchedSubscriptionResumptionStorage::MarkDirty()
+{
+    mDirty = true;
+    if (mSystemLayer == nullptr)
+    {
+        return Commit();
+    }
+
+    // Never push an already-armed commit further out: a steady stream of updates must still be persisted.
+    if (!mSystemLayer->IsTimerActive(OnCommitTimer, this))
+    {
+        CHIP_ERROR err = mSystemLayer->StartTimer(mCommitDelay, OnCommitTimer, this);
+        if (err != CHIP_NO_ERROR)
+        {
+            return Commit();
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+size_t BatchedSubscriptionResumptionStorage::ResidentCount() const
+{
+    size_t count = 0;
+    for (const auto & entry : mEntries)
+    {
+        count += entry.mInUse ? 1 : 0;
+    }
+    return count;
+}
+
+SubscriptionResumptionStorage::SubscriptionInfoIterator * BatchedSubscriptionResumptionStorage::IterateSubscriptions()
+{
+    return mBatchedIterators.CreateObject(*this);
+}
+
+void BatchedSubscriptionResumptionStorage::Remove(Entry & entry)
+{
+    mAttributePathSets.Release(entry.mAttributePathSet);
+    mEventPathSets.Release(entry.mEventPathSet);
+    entry = Entry();
+}
+
+CHIP_ERROR BatchedSubscriptionResumptionStorage::Store(SubscriptionInfo & subscriptionInfo)
+{
+    Entry * target = nullptr;
+    for (auto & entry : mEntries)
+    {
+        if (entry.Matches(subscriptionInfo.mNodeId, subscriptionInfo.mFabricIndex, subscriptionInfo.mSubscriptionId))
+        {
+            target = &entry;
+            break;
+        }
+        if (target == nullptr && !entry.mInUse)
+        {
+            target = &entry;
+        }
+    }
+    VerifyOrReturnError(target != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    Entry updated;
+    updated.mNodeId         = subscriptionInfo.mNodeId;
+    updated.mFabricIndex    = subscriptionInfo.mFabricIndex;
+    updated.mSubscriptionId = subscriptionInfo.mSubscriptionId;
+#if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+    updated.mResumptionRetries = subscriptionInfo.mResumptionRetries;
+#else
+    updated.mResumptionRetries = 0;
+#endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
+    updated.mMinInterval    = subscriptionInfo.mMinInterval;
+    updated.mMaxInterval    = subscriptionInfo.mMaxInterval;
+    updated.mFabricFiltered = subscriptionInfo.mFabricFiltered;
+
+    ReturnErrorOnFailure(mAttributePathSets.Acquire(subscriptionInfo.mAttributePaths.Get(),
+                                                    subscriptionInfo.mAttributePaths.AllocatedSize(), updated.mAttributePathSet));
+    CHIP_ERROR err = mEventPathSets.Acquire(subscriptionInfo.mEventPaths.Get(), subscriptionInfo.mEventPaths.AllocatedSize(),
+                                            updated.mEventPathSet);
+    if (err != CHIP_NO_ERROR)
+    {
+        mAttributePathSets.Release(updated.mAttributePathSet);
+        return err;
+    }
+
+    // The previous entry is only replaced once the new one is complete, a failure above leaves it untouched.
+    if (target->mInUse)
+    {
+        Remove(*target);
+    }
+    updated.mInUse = true;
+    *target        = updated;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BatchedSubscriptionResumptionStorage::Save(SubscriptionInfo & subscriptionInfo)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    ReturnErrorOnFailure(Store(subscriptionInfo));
+    return MarkDirty();
+}
+
+CHIP_ERROR BatchedSubscriptionResumptionStorage::Delete(NodeId nodeId, FabricIndex fabricIndex, SubscriptionId subscriptionId)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    for (auto & entry : mEntries)
+    {
+        if (entry.Matches(nodeId, fabricIndex, subscriptionId))
+        {
+            Remove(entry);
+            return MarkDirty();
+        }
+    }
+    return CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND;
+}
+
+CHIP_ERROR BatchedSubscriptionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    bool removed = false;
+    for (auto & entry : mEntries)
+    {
+        if (entry.mInUse && entry.mFabricIndex == fabricIndex)
+        {
+            Remove(entry);
+            removed = true;
+        }
+    }
+    return removed ? MarkDirty() : CHIP_NO_ERROR;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,228 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines an implementation of SubscriptionResumptionStorage that keeps
+ *      all subscriptions resident in RAM and persists them as a single versioned
+ *      record, with attribute and event path lists deduplicated across subscriptions.
+ */
+
+#pragma once
+
+#include <app/SimpleSubscriptionResumptionStorage.h>
+
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * A SubscriptionResumptionStorage that writes a single compact record to the PersistentStorageDelegate.
+ *
+ * Compared to SimpleSubscriptionResumptionStorage:
+ *   - Subscriptions are held in RAM, so iteration and Save/Delete lookups never touch storage.
+ *   - Identical attribute/event path lists (very common for controllers that subscribe with the
+ *     same path set on every node) are stored once and referenced by index.
+ *   - When a System::Layer is provided, writes are deferred by `commitDelay` and coalesced, so a
+ *     burst of subscription establishments results in a single storage write.
+ *
+ * Subscriptions persisted by SimpleSubscriptionResumptionStorage are migrated into the batched
+ * record on Init. Legacy entries that do not fit are kept and tried again on the next Init.
+ */
+class BatchedSubscriptionResumptionStorage : public SimpleSubscriptionResumptionStorage
+{
+public:
+    static constexpr System::Clock::Timeout kDefaultCommitDelay = System::Clock::Milliseconds32(500);
+    static constexpr uint16_t kNoPathSet                       = UINT16_MAX;
+
+    ~BatchedSubscriptionResumptionStorage();
+
+    /**
+     * Initialize the storage and load any previously persisted subscriptions.
+     *
+     * @param storage      backend used for persistence
+     * @param systemLayer  if non-null, commits are deferred on this layer's timers; otherwise every
+     *                     mutation is committed synchronously.
+     * @param commitDelay  delay between the first pending mutation and the commit
+     */
+    CHIP_ERROR Init(PersistentStorageDelegate * storage, System::Layer * systemLayer,
+                    System::Clock::Timeout commitDelay = kDefaultCommitDelay);
+    CHIP_ERROR Init(PersistentStorageDelegate * storage) { return Init(storage, nullptr); }
+
+    /**
+     * Cancel any pending deferred commit and release all resident state. Pending changes are
+     * committed first.
+     */
+    void Shutdown();
+
+    SubscriptionInfoIterator * IterateSubscriptions() override;
+
+    CHIP_ERROR Save(SubscriptionInfo & subscriptionInfo) override;
+
+    CHIP_ERROR Delete(NodeId nodeId, FabricIndex fabricIndex, SubscriptionId subscriptionId) override;
+
+    CHIP_ERROR DeleteAll(FabricIndex fabricIndex) override;
+
+    /**
+     * Write pending changes to storage immediately, cancelling any deferred commit.
+     */
+    CHIP_ERROR Commit();
+
+    bool HasPendingCommit() const { return mDirty; }
+
+    /**
+     * Number of distinct attribute path lists currently referenced by resident subscriptions.
+     */
+    size_t AttributePathSetCount() const { return mAttributePathSets.Count(); }
+
+    /**
+     * Number of distinct event path lists currently referenced by resident subscriptions.
+     */
+    size_t EventPathSetCount() const { return mEventPathSets.Count(); }
+
+protected:
+    static constexpr uint8_t kRecordVersion = 1;
+
+    template <typename PathType>
+    class PathSetTable
+    {
+    public:
+        // One spare set, so that a subscription acquires its new paths before releasing its old ones.
+        static constexpr size_t kMaxSets = CHIP_IM_MAX_NUM_SUBSCRIPTIONS + 1;
+
+        /**
+         * Find or allocate a set equal to `paths`. On success the set's reference count is
+         * incremented and its index returned in `outIndex`. Empty lists map to kNoPathSet.
+         */
+        CHIP_ERROR Acquire(const PathType * paths, size_t count, uint16_t & outIndex);
+        void Release(uint16_t index);
+        void Clear();
+
+        const Platform::ScopedMemoryBufferWithSize<PathType> * Get(uint16_t index) const
+        {
+            return (index < kMaxSets && mSets[index].mRefCount > 0) ? &mSets[index].mPaths : nullptr;
+        }
+        size_t Count() const;
+
+    private:
+        struct Entry
+        {
+            Platform::ScopedMemoryBufferWithSize<PathType> mPaths;
+            uint16_t mRefCount = 0;
+        };
+        Entry mSets[kMaxSets];
+    };
+
+    struct Entry
+    {
+        bool mInUse = false;
+        NodeId mNodeId;
+        FabricIndex mFabricIndex;
+        SubscriptionId mSubscriptionId;
+        uint32_t mResumptionRetries;
+        uint16_t mMinInterval;
+        uint16_t mMaxInterval;
+        bool mFabricFiltered;
+        uint16_t mAttributePathSet = kNoPathSet;
+        uint16_t mEventPathSet     = kNoPathSet;
+
+        bool Matches(NodeId nodeId, FabricIndex fabricIndex, SubscriptionId subscriptionId) const
+        {
+            return mInUse && mNodeId == nodeId && mFabricIndex == fabricIndex && mSubscriptionId == subscriptionId;
+        }
+    };
+
+    class BatchedSubscriptionInfoIterator : public SubscriptionInfoIterator
+    {
+    public:
+        BatchedSubscriptionInfoIterator(BatchedSubscriptionResumptionStorage & storage) : mStorage(storage) {}
+        size_t Count() override;
+        bool Next(SubscriptionInfo & output) override;
+        void Release() override;
+
+    private:
+        BatchedSubscriptionResumptionStorage & mStorage;
+        size_t mNextIndex = 0;
+    };
+
+    static constexpr size_t MaxRecordSize()
+    {
+        // Paths are bounded by the IM engine path pool shared by all subscriptions.
+        return TLV::EstimateStructOverhead(
+            sizeof(kRecordVersion),
+            TLV::EstimateStructOverhead(sizeof(EndpointId), sizeof(ClusterId), sizeof(AttributeId)) *
+                CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS,
+            TLV::EstimateStructOverhead(sizeof(uint8_t), sizeof(EndpointId), sizeof(ClusterId), sizeof(EventId)) *
+                CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS,
+            TLV::EstimateStructOverhead(MaxScopedNodeIdSize(), sizeof(SubscriptionId), sizeof(uint16_t), sizeof(uint16_t),
+                                        sizeof(bool), sizeof(uint16_t), sizeof(uint16_t), sizeof(uint32_t)) *
+                CHIP_IM_MAX_NUM_SUBSCRIPTIONS);
+    }
+
+    // Single record stored under DefaultStorageKeyAllocator::SubscriptionResumptionBatch():
+    //   Structure of:
+    //     Version
+    //     List of: (attribute path sets, referenced by position)
+    //       Array of: Endpoint ID, Cluster ID, Attribute ID, ... (flattened triples)
+    //     List of: (event path sets, referenced by position)
+    //       Array of: Urgent flag, Endpoint ID, Cluster ID, Event ID, ... (flattened quads)
+    //     List of:
+    //       Structure of: (Subscription info)
+    //         Node ID
+    //         Fabric Index
+    //         Subscription ID
+    //         Min interval
+    //         Max interval
+    //         Fabric filtered boolean
+    //         Attribute path set position (optional)
+    //         Event path set position (optional)
+    //         Resumption retries
+    static constexpr TLV::Tag kRecordVersionTag        = TLV::ContextTag(1);
+    static constexpr TLV::Tag kAttributePathSetsTag    = TLV::ContextTag(2);
+    static constexpr TLV::Tag kEventPathSetsTag        = TLV::ContextTag(3);
+    static constexpr TLV::Tag kSubscriptionsTag        = TLV::ContextTag(4);
+    static constexpr TLV::Tag kAttributePathSetRefTag  = TLV::ContextTag(7);
+    static constexpr TLV::Tag kEventPathSetRefTag      = TLV::ContextTag(8);
+    static constexpr TLV::Tag kBatchResumptionRetryTag = TLV::ContextTag(9);
+
+    CHIP_ERROR LoadRecord();
+    CHIP_ERROR LoadSubscription(TLV::TLVReader & reader, const uint16_t * attributeSetMap, size_t attributeSetCount,
+                                const uint16_t * eventSetMap, size_t eventSetCount);
+    CHIP_ERROR WriteRecord(TLV::TLVWriter & writer);
+    CHIP_ERROR MigrateLegacyEntries();
+
+    CHIP_ERROR Store(SubscriptionInfo & subscriptionInfo);
+    void Remove(Entry & entry);
+    CHIP_ERROR MarkDirty();
+    static void OnCommitTimer(System::Layer * layer, void * appState);
+
+    size_t ResidentCount() const;
+
+    Entry mEntries[CHIP_IM_MAX_NUM_SUBSCRIPTIONS];
+    PathSetTable<AttributePathParamsValues> mAttributePathSets;
+    PathSetTable<EventPathParamsValues> mEventPathSets;
+    ObjectPool<BatchedSubscriptionInfoIterator, kIteratorsMax> mBatchedIterators;
+
+    System::Layer * mSystemLayer = nullptr;
+    System::Clock::Timeout mCommitDelay;
+    bool mDirty = false;
+};
+
+} // namespace app
+} // namespace chip
@@ -47,6 +47,7 @@
 #include <lib/core/Global.h>
 #include <lib/core/TLVUtilities.h>
 #include <lib/support/CHIPFaultInjection.h>
+#include <lib/support/CHIPMemTracking.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/FibonacciUtils.h>
 #include <lib/support/ReadOnlyBuffer.h>
@@ -1049,6 +1050,8 @@ CHIP_ERROR InteractionModelEngine::OnMessageReceived(Messaging::ExchangeContext
 
     Protocols::InteractionModel::Status status = Status::Failure;
 
+    Platform::ScopedMemoryTag memoryTag(Platform::MemoryTag::kInteractionModel);
+
     // Ensure that DataModel::Provider has access to the exchange the message was received on.
     CurrentExchangeValueScope scopedExchangeContext(*this, apExchangeContext);
 
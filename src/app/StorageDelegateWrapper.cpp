@@ -24,9 +24,8 @@ CHIP_ERROR StorageDelegateWrapper::WriteValue(const StorageKeyName & aKey, const
 {
     VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    // TODO: we may want to have a small cache for values that change a lot, so
-    //  we only write them once a bunch of changes happen or on timer or
-    //  shutdown.
+    // Values that change a lot can be cached in front of this, see
+    // WriteBackAttributePersistenceProvider.
     if (!CanCastTo<uint16_t>(aValue.size()))
     {
         return CHIP_ERROR_BUFFER_TOO_SMALL;
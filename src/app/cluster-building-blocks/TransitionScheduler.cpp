@@ -0,0 +1,198 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/cluster-building-blocks/TransitionScheduler.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+#include <chrono>
+
+namespace chip {
+namespace app {
+
+using namespace System::Clock;
+
+namespace {
+
+Timestamp RoundUpToGranularity(Timestamp deadline)
+{
+    constexpr Timestamp::rep kGranularity = CHIP_CONFIG_TRANSITION_SCHEDULER_GRANULARITY_MS;
+    static_assert(kGranularity > 0, "CHIP_CONFIG_TRANSITION_SCHEDULER_GRANULARITY_MS must be positive");
+    return Timestamp(((deadline.count() + kGranularity - 1) / kGranularity) * kGranularity);
+}
+
+} // namespace
+
+TransitionScheduler::~TransitionScheduler()
+{
+    // The system layer may already be gone, only drop the steps.
+    mEntries.ReleaseAll();
+}
+
+TransitionScheduler & TransitionScheduler::GetInstance()
+{
+    static TransitionScheduler sInstance;
+    return sInstance;
+}
+
+CHIP_ERROR TransitionScheduler::StartTimer(System::Layer & layer, Timeout delay, System::TimerCompleteCallback onComplete,
+                                           void * appState)
+{
+    VerifyOrReturnError(onComplete != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (mLayer != &layer)
+    {
+        if (mLayer != nullptr && mTimerArmed)
+        {
+            mLayer->CancelTimer(HandleTick, this);
+            mTimerArmed = false;
+        }
+        mLayer = &layer;
+    }
+
+    if (mInTick && onComplete == mRunningCallback && appState == mRunningAppState)
+    {
+        // The common case of a step scheduling the next one.
+        mRunningCallback = nullptr;
+    }
+    else
+    {
+        CancelTimer(onComplete, appState);
+    }
+
+    const Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    // Steps without delay run on the next tick as they are; the others share the tick of their window.
+    const Timestamp deadline = (delay == Timeout::zero()) ? now : RoundUpToGranularity(now + delay);
+
+    Entry * entry = mEntries.CreateObject(onComplete, appState, deadline, mSequence);
+    if (entry == nullptr)
+    {
+        return layer.StartTimer(delay, onComplete, appState);
+    }
+    mActiveCount++;
+
+    // The tick re-arms the timer once all its steps have run.
+    VerifyOrReturnError(!mInTick, CHIP_NO_ERROR);
+    // The timer is gone if the system layer was shut down since it was armed.
+    VerifyOrReturnError(!mTimerArmed || deadline < mTimerDeadline || !mLayer->IsTimerActive(HandleTick, this), CHIP_NO_ERROR);
+
+    CHIP_ERROR err = ArmTimer(deadline, now);
+    if (err != CHIP_NO_ERROR)
+    {
+        mEntries.ReleaseObject(entry);
+        mActiveCount--;
+    }
+    return err;
+}
+
+void TransitionScheduler::CancelTimer(System::TimerCompleteCallback onComplete, void * appState)
+{
+    Entry * entry = Find(onComplete, appState);
+    if (entry != nullptr)
+    {
+        mEntries.ReleaseObject(entry);
+        mActiveCount--;
+    }
+    else if (mLayer != nullptr)
+    {
+        // The step may have fallen back to its own timer.
+        mLayer->CancelTimer(onComplete, appState);
+    }
+}
+
+void TransitionScheduler::Shutdown()
+{
+    mEntries.ReleaseAll();
+    mActiveCount = 0;
+    if (mLayer != nullptr && mTimerArmed)
+    {
+        mLayer->CancelTimer(HandleTick, this);
+    }
+    mTimerArmed = false;
+    mLayer      = nullptr;
+}
+
+void TransitionScheduler::HandleTick(System::Layer * layer, void * appState)
+{
+    static_cast<TransitionScheduler *>(appState)->RunDueSteps();
+}
+
+void TransitionScheduler::RunDueSteps()
+{
+    mTimerArmed = false;
+    mInTick     = true;
+
+    const Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    // Steps scheduled by the callbacks below get this sequence number, and wait for the next tick.
+    const uint32_t tickSequence = ++mSequence;
+
+    mEntries.ForEachActiveObject([&](Entry * entry) {
+        if (entry->sequence != tickSequence && entry->deadline <= now)
+        {
+            System::TimerCompleteCallback onComplete = entry->onComplete;
+            void * appState                          = entry->appState;
+            mEntries.ReleaseObject(entry);
+            mActiveCount--;
+
+            mRunningCallback = onComplete;
+            mRunningAppState = appState;
+            onComplete(mLayer, appState);
+            mRunningCallback = nullptr;
+        }
+        return Loop::Continue;
+    });
+
+    mInTick = false;
+
+    VerifyOrReturn(mActiveCount > 0 && mLayer != nullptr);
+
+    Timestamp earliest = Timestamp::max();
+    mEntries.ForEachActiveObject([&](Entry * entry) {
+        earliest = std::min(earliest, entry->deadline);
+        return Loop::Continue;
+    });
+    LogErrorOnFailure(ArmTimer(earliest, System::SystemClock().GetMonotonicTimestamp()));
+}
+
+CHIP_ERROR TransitionScheduler::ArmTimer(Timestamp deadline, Timestamp now)
+{
+    const Timeout delay = (deadline > now) ? std::chrono::duration_cast<Timeout>(deadline - now) : Timeout::zero();
+    ReturnErrorOnFailure(mLayer->StartTimer(delay, HandleTick, this));
+    mTimerArmed    = true;
+    mTimerDeadline = deadline;
+    return CHIP_NO_ERROR;
+}
+
+TransitionScheduler::Entry * TransitionScheduler::Find(System::TimerCompleteCallback onComplete, void * appState)
+{
+    Entry * found = nullptr;
+    mEntries.ForEachActiveObject([&](Entry * entry) {
+        if (entry->onComplete == onComplete && entry->appState == appState)
+        {
+            found = entry;
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+    return found;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,119 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/Pool.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Shared timer for the periodic steps of attribute transitions (level, hue/saturation, XY, color temperature...).
+ *
+ * Clusters that move an attribute over time typically re-arm a timer per endpoint for every step of the
+ * transition.  When many endpoints transition at once (e.g. after a group command or a scene recall on a
+ * bridge), that is one system timer per endpoint, each firing on its own.
+ *
+ * The scheduler instead keeps the steps in a pool and arms a single system timer for the earliest of them.
+ * Step deadlines are rounded up to CHIP_CONFIG_TRANSITION_SCHEDULER_GRANULARITY_MS, so steps that fall in the
+ * same window run back to back from one tick.  Steps are never run early.
+ *
+ * `StartTimer()` and `CancelTimer()` mirror the `System::Layer` methods of the same name, so clusters can switch
+ * to the scheduler without changing their timer callbacks.  If the pool is exhausted, the step falls back to
+ * its own system timer.
+ *
+ * All methods must be called from the Matter thread.
+ */
+class TransitionScheduler
+{
+public:
+    TransitionScheduler() = default;
+    ~TransitionScheduler();
+
+    TransitionScheduler(const TransitionScheduler &)             = delete;
+    TransitionScheduler & operator=(const TransitionScheduler &) = delete;
+
+    /**
+     * Returns the scheduler shared by the clusters of the application.
+     */
+    static TransitionScheduler & GetInstance();
+
+    /**
+     * Runs `onComplete(&layer, appState)` after at least `delay`, replacing any step already scheduled for the
+     * same callback and state, like `System::Layer::StartTimer()`.
+     */
+    CHIP_ERROR StartTimer(System::Layer & layer, System::Clock::Timeout delay, System::TimerCompleteCallback onComplete,
+                          void * appState);
+
+    /**
+     * Cancels the step scheduled for the callback and state, if any, like `System::Layer::CancelTimer()`.
+     */
+    void CancelTimer(System::TimerCompleteCallback onComplete, void * appState);
+
+    /**
+     * Cancels all the steps.
+     */
+    void Shutdown();
+
+    /**
+     * Returns the number of steps waiting for a tick.
+     */
+    size_t ActiveCount() const { return mActiveCount; }
+
+private:
+    struct Entry
+    {
+        Entry(System::TimerCompleteCallback aOnComplete, void * aAppState, System::Clock::Timestamp aDeadline, uint32_t aSequence) :
+            onComplete(aOnComplete), appState(aAppState), deadline(aDeadline), sequence(aSequence)
+        {}
+
+        System::TimerCompleteCallback onComplete;
+        void * appState;
+        System::Clock::Timestamp deadline;
+        // Steps scheduled during a tick wait for the next one.
+        uint32_t sequence;
+    };
+
+    static void HandleTick(System::Layer * layer, void * appState);
+    void RunDueSteps();
+    CHIP_ERROR ArmTimer(System::Clock::Timestamp deadline, System::Clock::Timestamp now);
+    Entry * Find(System::TimerCompleteCallback onComplete, void * appState);
+
+    ObjectPool<Entry, CHIP_CONFIG_TRANSITION_SCHEDULER_POOL_SIZE> mEntries;
+    System::Layer * mLayer = nullptr;
+    size_t mActiveCount    = 0;
+    uint32_t mSequence     = 0;
+    // Deadline the system timer is armed for, if mTimerArmed.
+    System::Clock::Timestamp mTimerDeadline;
+    bool mTimerArmed = false;
+    bool mInTick     = false;
+    // Step whose callback is running.  It is no longer in the pool, so rescheduling it needs no lookup.
+    System::TimerCompleteCallback mRunningCallback = nullptr;
+    void * mRunningAppState                        = nullptr;
+};
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,288 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/cluster-building-blocks/TransitionScheduler.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayerImpl.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::System::Clock;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+/**
+ * System layer whose timers only fire from FireTimers(), at the time of the mock clock.
+ */
+class FakeTimerLayer : public System::LayerImpl
+{
+public:
+    CHIP_ERROR StartTimer(Timeout delay, System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        CancelTimer(onComplete, appState);
+        mTimers.push_back({ System::SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState });
+        mStartedTimers++;
+        return CHIP_NO_ERROR;
+    }
+
+    void CancelTimer(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        for (auto it = mTimers.begin(); it != mTimers.end(); ++it)
+        {
+            if (it->onComplete == onComplete && it->appState == appState)
+            {
+                mTimers.erase(it);
+                return;
+            }
+        }
+    }
+
+    bool IsTimerActive(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        for (const Timer & timer : mTimers)
+        {
+            if (timer.onComplete == onComplete && timer.appState == appState)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Fires the timers that are due, in the order they were started.
+    void FireTimers()
+    {
+        const Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+        std::vector<Timer> due;
+        for (auto it = mTimers.begin(); it != mTimers.end();)
+        {
+            if (it->deadline <= now)
+            {
+                due.push_back(*it);
+                it = mTimers.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        for (const Timer & timer : due)
+        {
+            timer.onComplete(this, timer.appState);
+        }
+    }
+
+    size_t PendingTimers() const { return mTimers.size(); }
+    size_t StartedTimers() const { return mStartedTimers; }
+
+private:
+    struct Timer
+    {
+        Timestamp deadline;
+        System::TimerCompleteCallback onComplete;
+        void * appState;
+    };
+
+    std::vector<Timer> mTimers;
+    size_t mStartedTimers = 0;
+};
+
+/**
+ * An endpoint moving an attribute by one step per tick, rescheduling itself like the level and color clusters.
+ */
+struct FakeTransition
+{
+    TransitionScheduler * scheduler;
+    Timeout stepDelay;
+    size_t remainingSteps;
+    size_t stepsRun = 0;
+    uint16_t level  = 0;
+
+    static void Step(System::Layer * layer, void * appState)
+    {
+        auto * transition = static_cast<FakeTransition *>(appState);
+        transition->stepsRun++;
+        transition->level = static_cast<uint16_t>(transition->level + 7);
+        if (--transition->remainingSteps > 0)
+        {
+            EXPECT_EQ(transition->scheduler->StartTimer(*layer, transition->stepDelay, Step, transition), CHIP_NO_ERROR);
+        }
+    }
+};
+
+class TestTransitionScheduler : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        mRealClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&mMockClock);
+        mMockClock.SetMonotonic(1000_ms64);
+    }
+
+    void TearDown() override
+    {
+        mScheduler.Shutdown();
+        System::Clock::Internal::SetSystemClockForTesting(mRealClock);
+    }
+
+    void AdvanceAndFire(Milliseconds64 increment)
+    {
+        mMockClock.AdvanceMonotonic(increment);
+        mLayer.FireTimers();
+    }
+
+protected:
+    System::Clock::ClockBase * mRealClock = nullptr;
+    System::Clock::Internal::MockClock mMockClock;
+    FakeTimerLayer mLayer;
+    TransitionScheduler mScheduler;
+};
+
+TEST_F(TestTransitionScheduler, RunsStepsAfterTheirDelay)
+{
+    FakeTransition transition{ &mScheduler, 100_ms32, 3 };
+
+    EXPECT_EQ(mScheduler.StartTimer(mLayer, 100_ms32, FakeTransition::Step, &transition), CHIP_NO_ERROR);
+    EXPECT_EQ(mScheduler.ActiveCount(), 1u);
+
+    AdvanceAndFire(99_ms64);
+    EXPECT_EQ(transition.stepsRun, 0u);
+
+    AdvanceAndFire(1_ms64);
+    EXPECT_EQ(transition.stepsRun, 1u);
+    EXPECT_EQ(mScheduler.ActiveCount(), 1u);
+
+    AdvanceAndFire(100_ms64);
+    AdvanceAndFire(100_ms64);
+    EXPECT_EQ(transition.stepsRun, 3u);
+    EXPECT_EQ(mScheduler.ActiveCount(), 0u);
+    EXPECT_EQ(mLayer.PendingTimers(), 0u);
+}
+
+TEST_F(TestTransitionScheduler, StepsInTheSameWindowShareATick)
+{
+    static_assert(CHIP_CONFIG_TRANSITION_SCHEDULER_GRANULARITY_MS == 10, "The test assumes 10 ms windows");
+
+    FakeTransition first{ &mScheduler, 100_ms32, 1 };
+    FakeTransition second{ &mScheduler, 100_ms32, 1 };
+    FakeTransition later{ &mScheduler, 100_ms32, 1 };
+
+    // Both are due in the window ending at 1110 ms, the third one in the next window.
+    mMockClock.SetMonotonic(1003_ms64);
+    EXPECT_EQ(mScheduler.StartTimer(mLayer, 100_ms32, FakeTransition::Step, &first), CHIP_NO_ERROR);
+    mMockClock.SetMonotonic(1008_ms64);
+    EXPECT_EQ(mScheduler.StartTimer(mLayer, 100_ms32, FakeTransition::Step, &second), CHIP_NO_ERROR);
+    mMockClock.SetMonotonic(1012_ms64);
+    EXPECT_EQ(mScheduler.StartTimer(mLayer, 100_ms32, FakeTransition::Step, &later), CHIP_NO_ERROR);
+
+    // One system timer for all of them.
+    EXPECT_EQ(mLayer.PendingTimers(), 1u);
+
+    mMockClock.SetMonotonic(1108_ms64);
+    mLayer.FireTimers();
+    EXPECT_EQ(first.stepsRun, 0u);
+
+    mMockClock.SetMonotonic(1110_ms64);
+    mLayer.FireTimers();
+    EXPECT_EQ(first.stepsRun, 1u);
+    EXPECT_EQ(second.stepsRun, 1u);
+    EXPECT_EQ(later.stepsRun, 0u);
+    EXPECT_EQ(mLayer.PendingTimers(), 1u);
+
+    AdvanceAndFire(10_ms64);
+    EXPECT_EQ(later.stepsRun, 1u);
+    EXPECT_EQ(mLayer.PendingTimers(), 0u);
+}
+
+TEST_F(TestTransitionScheduler, ReplacesAndCancelsSteps)
+{
+    FakeTransition transition{ &mScheduler, 100_ms32, 1 };
+    FakeTransition other{ &mScheduler, 100_ms32, 1 };
+
+    // Starting a step again replaces it.
+    EXPECT_EQ(mScheduler.StartTimer(mLayer, 100_ms32, FakeTransition::Step, &transition), CHIP_NO_ERROR);
+    EXPECT_EQ(mScheduler.StartTimer(mLayer, 200_ms32, FakeTransition::Step, &transition), CHIP_NO_ERROR);
+    EXPECT_EQ(mScheduler.StartTimer(mLayer, 100_ms32, FakeTransition::Step, &other), CHIP_NO_ERROR);
+    EXPECT_EQ(mScheduler.ActiveCount(), 2u);
+
+    AdvanceAndFire(100_ms64);
+    EXPECT_EQ(transition.stepsRun, 0u);
+    EXPECT_EQ(other.stepsRun, 1u);
+
+    mScheduler.CancelTimer(FakeTransition::Step, &transition);
+    EXPECT_EQ(mScheduler.ActiveCount(), 0u);
+
+    AdvanceAndFire(100_ms64);
+    EXPECT_EQ(transition.stepsRun, 0u);
+}
+
+TEST_F(TestTransitionScheduler, StepsWithoutDelayRunOncePerTick)
+{
+    // A step rescheduling itself without delay runs on the next tick, not in a loop within the same one.
+    FakeTransition transition{ &mScheduler, 0_ms32, 3 };
+
+    EXPECT_EQ(mScheduler.StartTimer(mLayer, 0_ms32, FakeTransition::Step, &transition), CHIP_NO_ERROR);
+    mLayer.FireTimers();
+    EXPECT_EQ(transition.stepsRun, 1u);
+    mLayer.FireTimers();
+    EXPECT_EQ(transition.stepsRun, 2u);
+    mLayer.FireTimers();
+    EXPECT_EQ(transition.stepsRun, 3u);
+    EXPECT_EQ(mScheduler.ActiveCount(), 0u);
+}
+
+TEST_F(TestTransitionScheduler, PooledStepsShareOneSystemTimerPerTick)
+{
+    constexpr size_t kTicks = 5;
+
+    std::vector<FakeTransition> transitions(CHIP_CONFIG_TRANSITION_SCHEDULER_POOL_SIZE,
+                                            FakeTransition{ &mScheduler, 100_ms32, kTicks });
+    for (auto & transition : transitions)
+    {
+        EXPECT_EQ(mScheduler.StartTimer(mLayer, 100_ms32, FakeTransition::Step, &transition), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(mLayer.PendingTimers(), 1u);
+
+    const size_t startedTimers = mLayer.StartedTimers();
+    for (size_t tick = 0; tick < kTicks; tick++)
+    {
+        AdvanceAndFire(100_ms64);
+    }
+
+    for (auto & transition : transitions)
+    {
+        EXPECT_EQ(transition.stepsRun, kTicks);
+    }
+    EXPECT_EQ(mScheduler.ActiveCount(), 0u);
+    EXPECT_LE(mLayer.StartedTimers() - startedTimers, kTicks);
+}
+
+} // namespace
@@ -0,0 +1,214 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+
+/**
+ *    @file
+ *      Measures the cost of the ticks of TransitionScheduler, and the number
+ *      of system timers they start, for an increasing number of endpoints
+ *      transitioning at once.
+ *
+ *      Usage: transition-tick-benchmark
+ */
+
+#include <app/cluster-building-blocks/TransitionScheduler.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayerImpl.h>
+
+#include <chrono>
+#include <stdlib.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::System::Clock;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+constexpr size_t kEndpointCounts[] = { 1, 10, 100, 200 };
+constexpr size_t kTicks            = 50;
+
+/**
+ * System layer whose timers only fire from FireTimers(), at the time of the mock clock.
+ */
+class FakeTimerLayer : public System::LayerImpl
+{
+public:
+    CHIP_ERROR StartTimer(Timeout delay, System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        CancelTimer(onComplete, appState);
+        mTimers.push_back({ System::SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState });
+        mStartedTimers++;
+        return CHIP_NO_ERROR;
+    }
+
+    void CancelTimer(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        for (auto it = mTimers.begin(); it != mTimers.end(); ++it)
+        {
+            if (it->onComplete == onComplete && it->appState == appState)
+            {
+                mTimers.erase(it);
+                return;
+            }
+        }
+    }
+
+    bool IsTimerActive(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        for (const Timer & timer : mTimers)
+        {
+            if (timer.onComplete == onComplete && timer.appState == appState)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Fires the timers that are due, in the order they were started.
+    void FireTimers()
+    {
+        const Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+        std::vector<Timer> due;
+        for (auto it = mTimers.begin(); it != mTimers.end();)
+        {
+            if (it->deadline <= now)
+            {
+                due.push_back(*it);
+                it = mTimers.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        for (const Timer & timer : due)
+        {
+            timer.onComplete(this, timer.appState);
+        }
+    }
+
+    size_t PendingTimers() const { return mTimers.size(); }
+    size_t StartedTimers() const { return mStartedTimers; }
+
+private:
+    struct Timer
+    {
+        Timestamp deadline;
+        System::TimerCompleteCallback onComplete;
+        void * appState;
+    };
+
+    std::vector<Timer> mTimers;
+    size_t mStartedTimers = 0;
+};
+
+/**
+ * An endpoint moving an attribute by one step per tick, rescheduling itself like the level and color clusters.
+ */
+struct FakeTransition
+{
+    TransitionScheduler * scheduler;
+    Timeout stepDelay;
+    size_t remainingSteps;
+    size_t stepsRun = 0;
+
+    static void Step(System::Layer * layer, void * appState)
+    {
+        auto * transition = static_cast<FakeTransition *>(appState);
+        transition->stepsRun++;
+        if (--transition->remainingSteps > 0)
+        {
+            VerifyOrDie(transition->scheduler->StartTimer(*layer, transition->stepDelay, Step, transition) == CHIP_NO_ERROR);
+        }
+    }
+};
+
+CHIP_ERROR RunTicks(System::Clock::Internal::MockClock & clock, size_t endpointCount)
+{
+    FakeTimerLayer layer;
+    TransitionScheduler scheduler;
+
+    std::vector<FakeTransition> transitions(endpointCount, FakeTransition{ &scheduler, 100_ms32, kTicks });
+    for (auto & transition : transitions)
+    {
+        ReturnErrorOnFailure(scheduler.StartTimer(layer, 100_ms32, FakeTransition::Step, &transition));
+    }
+
+    const size_t startedTimers = layer.StartedTimers();
+    auto start                 = std::chrono::steady_clock::now();
+    for (size_t tick = 0; tick < kTicks; tick++)
+    {
+        clock.AdvanceMonotonic(100_ms64);
+        layer.FireTimers();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    for (auto & transition : transitions)
+    {
+        VerifyOrReturnError(transition.stepsRun == kTicks, CHIP_ERROR_INTERNAL);
+    }
+    VerifyOrReturnError(scheduler.ActiveCount() == 0, CHIP_ERROR_INTERNAL);
+
+    ChipLogProgress(Zcl, "Transition ticks with %u active endpoints: %.2f us per tick, %.1f system timers per tick",
+                    static_cast<unsigned>(endpointCount),
+                    std::chrono::duration<double, std::micro>(elapsed).count() / static_cast<double>(kTicks),
+                    static_cast<double>(layer.StartedTimers() - startedTimers) / static_cast<double>(kTicks));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RunBenchmark()
+{
+    // Timers fire at the time of the mock clock, so that ticks are not slowed down by real delays.
+    System::Clock::ClockBase * realClock = &System::SystemClock();
+    System::Clock::Internal::MockClock mockClock;
+    System::Clock::Internal::SetSystemClockForTesting(&mockClock);
+    mockClock.SetMonotonic(1000_ms64);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    for (size_t endpointCount : kEndpointCounts)
+    {
+        err = RunTicks(mockClock, endpointCount);
+        if (err != CHIP_NO_ERROR)
+        {
+            break;
+        }
+    }
+
+    System::Clock::Internal::SetSystemClockForTesting(realClock);
+    return err;
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    CHIP_ERROR err = RunBenchmark();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Zcl, "Transition tick benchmark failed: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    Platform::MemoryShutdown();
+    return (err == CHIP_NO_ERROR) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
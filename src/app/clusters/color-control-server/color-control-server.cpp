@@ -21,6 +21,7 @@
 #include <app-common/zap-generated/attributes/Accessors.h>
 #include <app/CommandHandler.h>
 #include <app/ConcreteCommandPath.h>
+#include <app/cluster-building-blocks/TransitionScheduler.h>
 #include <app/util/attribute-storage.h>
 #include <app/util/config.h>
 #include <lib/core/Optional.h>
@@ -399,7 +400,9 @@ void ColorControlServer::timerCallback(System::Layer *, void * callbackContext)
 
 void ColorControlServer::scheduleTimerCallbackMs(EmberEventControl * control, uint32_t delayMs)
 {
-    CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(chip::System::Clock::Milliseconds32(delayMs), timerCallback, control);
+    // Transitions of all the endpoints (and of the level control cluster) advance from the same timer ticks.
+    CHIP_ERROR err = TransitionScheduler::GetInstance().StartTimer(
+        DeviceLayer::SystemLayer(), chip::System::Clock::Milliseconds32(delayMs), timerCallback, control);
 
     if (err != CHIP_NO_ERROR)
     {
@@ -409,7 +412,7 @@ void ColorControlServer::scheduleTimerCallbackMs(EmberEventControl * control, ui
 
 void ColorControlServer::cancelEndpointTimerCallback(EmberEventControl * control)
 {
-    DeviceLayer::SystemLayer().CancelTimer(timerCallback, control);
+    TransitionScheduler::GetInstance().CancelTimer(timerCallback, control);
 }
 
 void ColorControlServer::cancelEndpointTimerCallback(EndpointId endpoint)
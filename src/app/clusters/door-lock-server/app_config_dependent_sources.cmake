@@ -16,6 +16,8 @@
 TARGET_SOURCES(
   ${APP_TARGET}
   PRIVATE
+    "${CLUSTER_DIR}/door-lock-credential-index.cpp"
+    "${CLUSTER_DIR}/door-lock-credential-index.h"
     "${CLUSTER_DIR}/door-lock-server-callback.cpp"
     "${CLUSTER_DIR}/door-lock-server.cpp"
 )
\ No newline at end of file
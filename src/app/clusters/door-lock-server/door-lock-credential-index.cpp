@@ -0,0 +1,237 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "door-lock-credential-index.h"
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/TypeTraits.h>
+
+namespace chip {
+namespace app {
+namespace Clusters {
+namespace DoorLock {
+
+namespace {
+
+constexpr uint32_t kFnvOffsetBasis = 2166136261u;
+constexpr uint32_t kFnvPrime       = 16777619u;
+// Largest power of two that fits the uint16_t bucket count
+constexpr uint16_t kMaxBucketCount = 1u << 15;
+
+uint32_t FnvHash(uint32_t hash, uint8_t byte)
+{
+    return (hash ^ byte) * kFnvPrime;
+}
+
+} // namespace
+
+CHIP_ERROR CredentialIndex::Init(uint16_t capacity)
+{
+    VerifyOrReturnError(!IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(capacity > 0 && capacity < kNone, CHIP_ERROR_INVALID_ARGUMENT);
+
+    uint16_t bucketCount = 1;
+    while (bucketCount < capacity && bucketCount < kMaxBucketCount)
+    {
+        bucketCount = static_cast<uint16_t>(bucketCount << 1);
+    }
+
+    mEntries     = static_cast<Entry *>(Platform::MemoryCalloc(capacity, sizeof(Entry)));
+    mSlotBuckets = static_cast<uint16_t *>(Platform::MemoryCalloc(bucketCount, sizeof(uint16_t)));
+    mDataBuckets = static_cast<uint16_t *>(Platform::MemoryCalloc(bucketCount, sizeof(uint16_t)));
+    if (mEntries == nullptr || mSlotBuckets == nullptr || mDataBuckets == nullptr)
+    {
+        Shutdown();
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    mCapacity    = capacity;
+    mBucketCount = bucketCount;
+    Clear();
+    return CHIP_NO_ERROR;
+}
+
+void CredentialIndex::Shutdown()
+{
+    Platform::MemoryFree(mEntries);
+    Platform::MemoryFree(mSlotBuckets);
+    Platform::MemoryFree(mDataBuckets);
+    mEntries     = nullptr;
+    mSlotBuckets = nullptr;
+    mDataBuckets = nullptr;
+    mCapacity    = 0;
+    mBucketCount = 0;
+    mFreeList    = kNone;
+    mCount       = 0;
+}
+
+void CredentialIndex::Clear()
+{
+    VerifyOrReturn(IsInitialized());
+
+    for (uint16_t i = 0; i < mBucketCount; i++)
+    {
+        mSlotBuckets[i] = kNone;
+        mDataBuckets[i] = kNone;
+    }
+    for (uint16_t i = 0; i < mCapacity; i++)
+    {
+        mEntries[i].nextBySlot = static_cast<uint16_t>(i + 1 < mCapacity ? i + 1 : kNone);
+    }
+    mFreeList = 0;
+    mCount    = 0;
+}
+
+CHIP_ERROR CredentialIndex::SetCredential(CredentialTypeEnum type, uint16_t credentialIndex, const ByteSpan & credentialData)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    uint16_t entryIndex = FindEntry(type, credentialIndex);
+    if (entryIndex != kNone)
+    {
+        UnlinkByData(entryIndex);
+    }
+    else
+    {
+        VerifyOrReturnError(mFreeList != kNone, CHIP_ERROR_NO_MEMORY);
+        entryIndex = mFreeList;
+        mFreeList  = mEntries[entryIndex].nextBySlot;
+
+        const uint16_t bucket = SlotBucket(type, credentialIndex);
+        Entry & entry         = mEntries[entryIndex];
+        entry.type            = type;
+        entry.credentialIndex = credentialIndex;
+        entry.userIndex       = kNoUser;
+        entry.nextBySlot      = mSlotBuckets[bucket];
+        mSlotBuckets[bucket]  = entryIndex;
+        mCount++;
+    }
+
+    mEntries[entryIndex].dataHash = HashData(type, credentialData);
+    LinkByData(entryIndex);
+    return CHIP_NO_ERROR;
+}
+
+void CredentialIndex::RemoveCredential(CredentialTypeEnum type, uint16_t credentialIndex)
+{
+    VerifyOrReturn(IsInitialized());
+
+    // Unlink the entry from its slot bucket
+    for (uint16_t * link = &mSlotBuckets[SlotBucket(type, credentialIndex)]; *link != kNone; link = &mEntries[*link].nextBySlot)
+    {
+        const uint16_t entryIndex = *link;
+        if (mEntries[entryIndex].type == type && mEntries[entryIndex].credentialIndex == credentialIndex)
+        {
+            *link = mEntries[entryIndex].nextBySlot;
+            UnlinkByData(entryIndex);
+
+            mEntries[entryIndex].nextBySlot = mFreeList;
+            mFreeList                       = entryIndex;
+            mCount--;
+            return;
+        }
+    }
+}
+
+void CredentialIndex::SetUser(CredentialTypeEnum type, uint16_t credentialIndex, uint16_t userIndex)
+{
+    const uint16_t entryIndex = FindEntry(type, credentialIndex);
+    VerifyOrReturn(entryIndex != kNone);
+    mEntries[entryIndex].userIndex = userIndex;
+}
+
+void CredentialIndex::RemoveUser(uint16_t userIndex)
+{
+    VerifyOrReturn(IsInitialized() && userIndex != kNoUser);
+
+    // Users own a handful of credentials, walking the slot buckets finds them without a reverse index
+    for (uint16_t bucket = 0; bucket < mBucketCount; bucket++)
+    {
+        for (uint16_t i = mSlotBuckets[bucket]; i != kNone; i = mEntries[i].nextBySlot)
+        {
+            if (mEntries[i].userIndex == userIndex)
+            {
+                mEntries[i].userIndex = kNoUser;
+            }
+        }
+    }
+}
+
+bool CredentialIndex::FindCredential(CredentialTypeEnum type, uint16_t credentialIndex, uint16_t & userIndex) const
+{
+    const uint16_t entryIndex = FindEntry(type, credentialIndex);
+    VerifyOrReturnValue(entryIndex != kNone, false);
+    userIndex = mEntries[entryIndex].userIndex;
+    return true;
+}
+
+uint32_t CredentialIndex::HashData(CredentialTypeEnum type, const ByteSpan & credentialData)
+{
+    uint32_t hash = FnvHash(kFnvOffsetBasis, to_underlying(type));
+    for (uint8_t byte : credentialData)
+    {
+        hash = FnvHash(hash, byte);
+    }
+    return hash;
+}
+
+uint16_t CredentialIndex::SlotBucket(CredentialTypeEnum type, uint16_t credentialIndex) const
+{
+    // Consecutive indexes of a type land in consecutive buckets
+    const uint32_t key = (static_cast<uint32_t>(to_underlying(type)) * 0x9E37u) + credentialIndex;
+    return static_cast<uint16_t>(key & (mBucketCount - 1));
+}
+
+uint16_t CredentialIndex::FindEntry(CredentialTypeEnum type, uint16_t credentialIndex) const
+{
+    VerifyOrReturnValue(IsInitialized(), kNone);
+
+    for (uint16_t i = mSlotBuckets[SlotBucket(type, credentialIndex)]; i != kNone; i = mEntries[i].nextBySlot)
+    {
+        if (mEntries[i].type == type && mEntries[i].credentialIndex == credentialIndex)
+        {
+            return i;
+        }
+    }
+    return kNone;
+}
+
+void CredentialIndex::LinkByData(uint16_t entryIndex)
+{
+    const uint16_t bucket           = static_cast<uint16_t>(mEntries[entryIndex].dataHash & (mBucketCount - 1));
+    mEntries[entryIndex].nextByData = mDataBuckets[bucket];
+    mDataBuckets[bucket]            = entryIndex;
+}
+
+void CredentialIndex::UnlinkByData(uint16_t entryIndex)
+{
+    const uint16_t bucket = static_cast<uint16_t>(mEntries[entryIndex].dataHash & (mBucketCount - 1));
+    for (uint16_t * link = &mDataBuckets[bucket]; *link != kNone; link = &mEntries[*link].nextByData)
+    {
+        if (*link == entryIndex)
+        {
+            *link = mEntries[entryIndex].nextByData;
+            return;
+        }
+    }
+}
+
+} // namespace DoorLock
+} // namespace Clusters
+} // namespace app
+} // namespace chip
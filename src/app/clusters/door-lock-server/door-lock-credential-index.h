@@ -0,0 +1,161 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app-common/zap-generated/cluster-enums.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Iterators.h>
+#include <lib/support/Span.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+namespace Clusters {
+namespace DoorLock {
+
+/**
+ * In-memory index of the PIN and RFID credentials of a door lock endpoint.
+ *
+ * The door lock server finds credentials by their data (duplicate check of SetCredential, PIN verification of remote
+ * operations) and the user a credential belongs to by walking the whole users and credentials databases, which are usually
+ * backed by persistent storage.  With thousands of credentials, every such lookup is thousands of storage reads.
+ *
+ * The index maps a credential slot (type and index) to the user it belongs to, and a hash of the credential data to the slots
+ * holding data with that hash.  It does not keep the credential data itself: lookups by data return candidate slots, which the
+ * caller confirms against the credentials database with a single read each.
+ *
+ * All methods must be called from the Matter thread.
+ */
+class CredentialIndex
+{
+public:
+    static constexpr uint16_t kNoUser = 0;
+
+    CredentialIndex() = default;
+    ~CredentialIndex() { Shutdown(); }
+
+    CredentialIndex(const CredentialIndex &)             = delete;
+    CredentialIndex & operator=(const CredentialIndex &) = delete;
+
+    /**
+     * Returns whether credentials of the type are kept in the index.  Lookups of other types must walk the databases.
+     */
+    static bool IsIndexedType(CredentialTypeEnum type)
+    {
+        return type == CredentialTypeEnum::kPin || type == CredentialTypeEnum::kRfid;
+    }
+
+    /**
+     * Allocates an empty index for up to `capacity` credentials.
+     */
+    CHIP_ERROR Init(uint16_t capacity);
+    void Shutdown();
+    bool IsInitialized() const { return mEntries != nullptr; }
+
+    /**
+     * Removes all the credentials, keeping the allocated capacity.
+     */
+    void Clear();
+
+    /**
+     * Adds the credential in the slot, or updates its data.  The user of the slot, if any, is kept.
+     *
+     * @retval CHIP_ERROR_NO_MEMORY if the index is full.
+     */
+    CHIP_ERROR SetCredential(CredentialTypeEnum type, uint16_t credentialIndex, const ByteSpan & credentialData);
+    void RemoveCredential(CredentialTypeEnum type, uint16_t credentialIndex);
+
+    /**
+     * Links the credential in the slot, if any, to a user, or unlinks it if `userIndex` is kNoUser.
+     */
+    void SetUser(CredentialTypeEnum type, uint16_t credentialIndex, uint16_t userIndex);
+
+    /**
+     * Unlinks all the credentials of the user.
+     */
+    void RemoveUser(uint16_t userIndex);
+
+    /**
+     * Returns whether the slot holds a credential, and the user it belongs to (kNoUser if none).
+     */
+    bool FindCredential(CredentialTypeEnum type, uint16_t credentialIndex, uint16_t & userIndex) const;
+
+    /**
+     * Calls `callback(credentialIndex, userIndex)` for each slot of the type whose data may be `credentialData`, until it returns
+     * Loop::Break.  Different data may share a hash, so the data of each candidate must be confirmed by the caller.
+     *
+     * @return Loop::Break if the callback stopped the iteration, Loop::Finish otherwise.
+     */
+    template <typename Callback>
+    Loop ForEachCandidate(CredentialTypeEnum type, const ByteSpan & credentialData, Callback callback) const
+    {
+        VerifyOrReturnValue(IsInitialized(), Loop::Finish);
+
+        const uint32_t dataHash = HashData(type, credentialData);
+        for (uint16_t i = mDataBuckets[dataHash & (mBucketCount - 1)]; i != kNone; i = mEntries[i].nextByData)
+        {
+            const Entry & entry = mEntries[i];
+            if (entry.dataHash == dataHash && entry.type == type &&
+                callback(entry.credentialIndex, entry.userIndex) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+        }
+        return Loop::Finish;
+    }
+
+    size_t Count() const { return mCount; }
+
+private:
+    static constexpr uint16_t kNone = UINT16_MAX;
+
+    struct Entry
+    {
+        uint32_t dataHash;
+        uint16_t credentialIndex;
+        uint16_t userIndex;
+        // Next entry in the same slot bucket, or in the free list
+        uint16_t nextBySlot;
+        uint16_t nextByData;
+        CredentialTypeEnum type;
+    };
+
+    static uint32_t HashData(CredentialTypeEnum type, const ByteSpan & credentialData);
+    uint16_t SlotBucket(CredentialTypeEnum type, uint16_t credentialIndex) const;
+    uint16_t FindEntry(CredentialTypeEnum type, uint16_t credentialIndex) const;
+    void LinkByData(uint16_t entryIndex);
+    void UnlinkByData(uint16_t entryIndex);
+
+    Entry * mEntries        = nullptr;
+    uint16_t * mSlotBuckets = nullptr;
+    uint16_t * mDataBuckets = nullptr;
+    uint16_t mCapacity      = 0;
+    // Power of two
+    uint16_t mBucketCount = 0;
+    uint16_t mFreeList    = kNone;
+    size_t mCount         = 0;
+};
+
+} // namespace DoorLock
+} // namespace Clusters
+} // namespace app
+} // namespace chip
@@ -36,6 +36,7 @@
 #include <app/ConcreteAttributePath.h>
 #include <app/ConcreteCommandPath.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
 
 using namespace chip;
 using namespace chip::app;
@@ -116,6 +117,9 @@ CHIP_ERROR DoorLockServer::InitEndpoint(EndpointId endpointId, Delegate * delega
     endpointContext->lockoutEndTimestamp    = endpointContext->lockoutEndTimestamp.zero();
     endpointContext->wrongCodeEntryAttempts = 0;
     endpointContext->delegate               = delegate;
+#if DOOR_LOCK_SERVER_USE_CREDENTIAL_INDEX
+    endpointContext->credentialIndexStale = true;
+#endif
     return CHIP_NO_ERROR;
 }
 
@@ -129,6 +133,10 @@ void DoorLockServer::ShutdownEndpoint(EndpointId endpointId)
     }
 
     endpointContext->delegate = nullptr;
+#if DOOR_LOCK_SERVER_USE_CREDENTIAL_INDEX
+    endpointContext->credentialIndex.Shutdown();
+    endpointContext->credentialIndexStale = true;
+#endif
 }
 
 CHIP_ERROR DoorLockServer::SetDelegate(chip::EndpointId endpointId, chip::app::Clusters::DoorLock::Delegate * delegate)
@@ -150,6 +158,19 @@ CHIP_ERROR DoorLockServer::SetDelegate(chip::EndpointId endpointId, chip::app::C
     return CHIP_NO_ERROR;
 }
 
+void DoorLockServer::InvalidateCredentialIndex(chip::EndpointId endpointId)
+{
+#if DOOR_LOCK_SERVER_USE_CREDENTIAL_INDEX
+    auto * endpointContext = getContext(endpointId);
+    if (endpointContext)
+    {
+        endpointContext->credentialIndexStale = true;
+    }
+#else
+    IgnoreUnusedVariable(endpointId);
+#endif
+}
+
 bool DoorLockServer::SetLockState(chip::EndpointId endpointId, DlLockState newLockState)
 {
     return SetAttribute(endpointId, Attributes::LockState::Id, Attributes::LockState::Set, newLockState);
@@ -724,40 +745,12 @@ void DoorLockServer::setCredentialCommandHandler(
     }
 
     // appclusters, 5.2.4.41.1: we should return DUPLICATE in the response if we're trying to create duplicated credential entry
-    for (uint16_t i = 1; CredentialTypeEnum::kProgrammingPIN != credentialType && (i <= maxNumberOfCredentials); ++i)
-    {
-        // Ignore the slot we are trying to set, because setting a credential to
-        // the same value as it already has should be just fine.
-        //
-        // This is not clearly defined in the spec;
-        // https://github.com/CHIP-Specifications/connectedhomeip-spec/issues/11707
-        // tracks that.
-        if (i == credentialIndex)
-        {
-            continue;
-        }
-
-        EmberAfPluginDoorLockCredentialInfo currentCredential;
-        if (!emberAfPluginDoorLockGetCredential(commandPath.mEndpointId, i, credentialType, currentCredential))
-        {
-            ChipLogProgress(Zcl,
-                            "[SetCredential] Unable to get the credential to exclude duplicated entry "
-                            "[endpointId=%d,credentialType=%u,credentialIndex=%d]",
-                            commandPath.mEndpointId, to_underlying(credentialType), i);
-            sendSetCredentialResponse(commandObj, commandPath, DlStatus::kFailure, 0, nextAvailableCredentialSlot);
-            return;
-        }
-        if (DlCredentialStatus::kAvailable != currentCredential.status && currentCredential.credentialType == credentialType &&
-            currentCredential.credentialData.data_equal(credentialData))
-        {
-            ChipLogProgress(Zcl,
-                            "[SetCredential] Credential with the same data and type already exist "
-                            "[endpointId=%d,credentialType=%u,dataLength=%u,existingCredentialIndex=%d,credentialIndex=%d]",
-                            commandPath.mEndpointId, to_underlying(credentialType),
-                            static_cast<unsigned int>(credentialData.size()), i, credentialIndex);
-            sendSetCredentialResponse(commandObj, commandPath, DlStatus::kDuplicate, 0, nextAvailableCredentialSlot);
-            return;
-        }
+    status =
+        findDuplicateCredential(commandPath.mEndpointId, credentialType, credentialData, credentialIndex, maxNumberOfCredentials);
+    if (DlStatus::kSuccess != status)
+    {
+        sendSetCredentialResponse(commandObj, commandPath, status, 0, nextAvailableCredentialSlot);
+        return;
     }
 
     EmberAfPluginDoorLockCredentialInfo existingCredential;
@@ -1859,6 +1852,18 @@ bool DoorLockServer::findUnoccupiedCredentialSlot(chip::EndpointId endpointId, C
 bool DoorLockServer::findUserIndexByCredential(chip::EndpointId endpointId, CredentialTypeEnum credentialType,
                                                uint16_t credentialIndex, uint16_t & userIndex)
 {
+#if DOOR_LOCK_SERVER_USE_CREDENTIAL_INDEX
+    auto * index = CredentialIndex::IsIndexedType(credentialType) ? getCredentialIndex(endpointId) : nullptr;
+    if (index != nullptr)
+    {
+        uint16_t indexedUser = CredentialIndex::kNoUser;
+        VerifyOrReturnValue(index->FindCredential(credentialType, credentialIndex, indexedUser), false);
+        VerifyOrReturnValue(indexedUser != CredentialIndex::kNoUser, false);
+        userIndex = indexedUser;
+        return true;
+    }
+#endif
+
     uint16_t maxNumberOfUsers = 0;
     VerifyOrReturnError(GetAttribute(endpointId, Attributes::NumberOfTotalUsersSupported::Id,
                                      Attributes::NumberOfTotalUsersSupported::Get, maxNumberOfUsers),
@@ -1897,6 +1902,41 @@ bool DoorLockServer::findUserIndexByCredential(chip::EndpointId endpointId, Cred
                                                chip::ByteSpan credentialData, uint16_t & userIndex, uint16_t & credentialIndex,
                                                EmberAfPluginDoorLockUserInfo & userInfo)
 {
+#if DOOR_LOCK_SERVER_USE_CREDENTIAL_INDEX
+    auto * index = CredentialIndex::IsIndexedType(credentialType) ? getCredentialIndex(endpointId) : nullptr;
+    if (index != nullptr)
+    {
+        bool found = false;
+        index->ForEachCandidate(credentialType, credentialData, [&](uint16_t candidateIndex, uint16_t candidateUser) {
+            VerifyOrReturnValue(candidateUser != CredentialIndex::kNoUser, Loop::Continue);
+
+            EmberAfPluginDoorLockCredentialInfo credentialInfo;
+            if (!emberAfPluginDoorLockGetCredential(endpointId, candidateIndex, credentialType, credentialInfo))
+            {
+                ChipLogError(Zcl,
+                             "[findUserIndexByCredential] Unable to get credential: app error "
+                             "[userIndex=%d,credentialIndex=%d,credentialType=%u]",
+                             candidateUser, candidateIndex, to_underlying(credentialType));
+                return Loop::Break;
+            }
+            VerifyOrReturnValue(credentialInfo.status == DlCredentialStatus::kOccupied &&
+                                    credentialInfo.credentialData.data_equal(credentialData),
+                                Loop::Continue);
+
+            if (!emberAfPluginDoorLockGetUser(endpointId, candidateUser, userInfo))
+            {
+                ChipLogError(Zcl, "[findUserIndexByCredential] Unable to get user: app error [userIndex=%d]", candidateUser);
+                return Loop::Break;
+            }
+            userIndex       = candidateUser;
+            credentialIndex = candidateIndex;
+            found           = true;
+            return Loop::Break;
+        });
+        return found;
+    }
+#endif
+
     uint16_t maxNumberOfUsers = 0;
     VerifyOrReturnError(GetAttribute(endpointId, Attributes::NumberOfTotalUsersSupported::Id,
                                      Attributes::NumberOfTotalUsersSupported::Get, maxNumberOfUsers),
@@ -1957,6 +1997,203 @@ bool DoorLockServer::findUserIndexByCredential(chip::EndpointId endpointId, Cred
     return false;
 }
 
+DlStatus DoorLockServer::findDuplicateCredential(chip::EndpointId endpointId, CredentialTypeEnum credentialType,
+                                                 const chip::ByteSpan & credentialData, uint16_t credentialIndex,
+                                                 uint16_t maxNumberOfCredentials)
+{
+    VerifyOrReturnValue(CredentialTypeEnum::kProgrammingPIN != credentialType, DlStatus::kSuccess);
+
+    // Ignore the slot we are trying to set, because setting a credential to
+    // the same value as it already has should be just fine.
+    //
+    // This is not clearly defined in the spec;
+    // https://github.com/CHIP-Specifications/connectedhomeip-spec/issues/11707
+    // tracks that.
+    auto checkSlot = [&](uint16_t i) {
+        EmberAfPluginDoorLockCredentialInfo currentCredential;
+        if (!emberAfPluginDoorLockGetCredential(endpointId, i, credentialType, currentCredential))
+        {
+            ChipLogProgress(Zcl,
+                            "[SetCredential] Unable to get the credential to exclude duplicated entry "
+                            "[endpointId=%d,credentialType=%u,credentialIndex=%d]",
+                            endpointId, to_underlying(credentialType), i);
+            return DlStatus::kFailure;
+        }
+        if (DlCredentialStatus::kAvailable != currentCredential.status && currentCredential.credentialType == credentialType &&
+            currentCredential.credentialData.data_equal(credentialData))
+        {
+            ChipLogProgress(Zcl,
+                            "[SetCredential] Credential with the same data and type already exist "
+                            "[endpointId=%d,credentialType=%u,dataLength=%u,existingCredentialIndex=%d,credentialIndex=%d]",
+                            endpointId, to_underlying(credentialType), static_cast<unsigned int>(credentialData.size()), i,
+                            credentialIndex);
+            return DlStatus::kDuplicate;
+        }
+        return DlStatus::kSuccess;
+    };
+
+    DlStatus status = DlStatus::kSuccess;
+#if DOOR_LOCK_SERVER_USE_CREDENTIAL_INDEX
+    auto * index = CredentialIndex::IsIndexedType(credentialType) ? getCredentialIndex(endpointId) : nullptr;
+    if (index != nullptr)
+    {
+        // Only the slots holding data with the same hash may be duplicates
+        index->ForEachCandidate(credentialType, credentialData, [&](uint16_t i, uint16_t) {
+            VerifyOrReturnValue(i != credentialIndex, Loop::Continue);
+            status = checkSlot(i);
+            return (DlStatus::kSuccess == status) ? Loop::Continue : Loop::Break;
+        });
+        return status;
+    }
+#endif
+
+    for (uint16_t i = 1; i <= maxNumberOfCredentials && DlStatus::kSuccess == status; ++i)
+    {
+        if (i != credentialIndex)
+        {
+            status = checkSlot(i);
+        }
+    }
+    return status;
+}
+
+bool DoorLockServer::setUser(chip::EndpointId endpointId, uint16_t userIndex, chip::FabricIndex creator, chip::FabricIndex modifier,
+                             const chip::CharSpan & userName, uint32_t uniqueId, UserStatusEnum userStatus, UserTypeEnum usertype,
+                             CredentialRuleEnum credentialRule, const CredentialStruct * credentials, size_t totalCredentials)
+{
+    bool success = emberAfPluginDoorLockSetUser(endpointId, userIndex, creator, modifier, userName, uniqueId, userStatus, usertype,
+                                                credentialRule, credentials, totalCredentials);
+#if DOOR_LOCK_SERVER_USE_CREDENTIAL_INDEX
+    auto * endpointContext = getContext(endpointId);
+    VerifyOrReturnValue(endpointContext != nullptr && !endpointContext->credentialIndexStale, success);
+    if (!success)
+    {
+        // The application may have partially updated the user
+        endpointContext->credentialIndexStale = true;
+        return false;
+    }
+
+    auto & index = endpointContext->credentialIndex;
+    index.RemoveUser(userIndex);
+    for (size_t i = 0; UserStatusEnum::kAvailable != userStatus && i < totalCredentials; ++i)
+    {
+        index.SetUser(credentials[i].credentialType, credentials[i].credentialIndex, userIndex);
+    }
+#endif
+    return success;
+}
+
+bool DoorLockServer::setCredential(chip::EndpointId endpointId, uint16_t credentialIndex, chip::FabricIndex creator,
+                                   chip::FabricIndex modifier, DlCredentialStatus credentialStatus,
+                                   CredentialTypeEnum credentialType, const chip::ByteSpan & credentialData)
+{
+    bool success = emberAfPluginDoorLockSetCredential(endpointId, credentialIndex, creator, modifier, credentialStatus,
+                                                      credentialType, credentialData);
+#if DOOR_LOCK_SERVER_USE_CREDENTIAL_INDEX
+    auto * endpointContext = getContext(endpointId);
+    VerifyOrReturnValue(endpointContext != nullptr && !endpointContext->credentialIndexStale, success);
+    VerifyOrReturnValue(CredentialIndex::IsIndexedType(credentialType), success);
+
+    auto & index = endpointContext->credentialIndex;
+    if (!success)
+    {
+        endpointContext->credentialIndexStale = true;
+    }
+    else if (DlCredentialStatus::kAvailable == credentialStatus)
+    {
+        index.RemoveCredential(credentialType, credentialIndex);
+    }
+    else if (index.SetCredential(credentialType, credentialIndex, credentialData) != CHIP_NO_ERROR)
+    {
+        endpointContext->credentialIndexStale = true;
+    }
+#endif
+    return success;
+}
+
+#if DOOR_LOCK_SERVER_USE_CREDENTIAL_INDEX
+CredentialIndex * DoorLockServer::getCredentialIndex(chip::EndpointId endpointId)
+{
+    auto * endpointContext = getContext(endpointId);
+    VerifyOrReturnValue(endpointContext != nullptr, nullptr);
+
+    if (endpointContext->credentialIndexStale)
+    {
+        CHIP_ERROR err = buildCredentialIndex(endpointId, endpointContext->credentialIndex);
+        if (err != CHIP_NO_ERROR)
+        {
+            // Walk the databases until the next rebuild attempt
+            ChipLogError(Zcl, "[getCredentialIndex] Unable to build the credential index [endpointId=%d]: %" CHIP_ERROR_FORMAT,
+                         endpointId, err.Format());
+            endpointContext->credentialIndex.Shutdown();
+            return nullptr;
+        }
+        endpointContext->credentialIndexStale = false;
+    }
+
+    return endpointContext->credentialIndex.IsInitialized() ? &endpointContext->credentialIndex : nullptr;
+}
+
+CHIP_ERROR DoorLockServer::buildCredentialIndex(chip::EndpointId endpointId, CredentialIndex & index)
+{
+    constexpr CredentialTypeEnum kIndexedTypes[] = { CredentialTypeEnum::kPin, CredentialTypeEnum::kRfid };
+
+    uint16_t maxNumberOfCredentials[MATTER_ARRAY_SIZE(kIndexedTypes)] = {};
+    uint32_t capacity                                                 = 0;
+    for (size_t t = 0; t < MATTER_ARRAY_SIZE(kIndexedTypes); ++t)
+    {
+        if (credentialTypeSupported(endpointId, kIndexedTypes[t]) &&
+            !getMaxNumberOfCredentials(endpointId, kIndexedTypes[t], maxNumberOfCredentials[t]))
+        {
+            maxNumberOfCredentials[t] = 0;
+        }
+        capacity += maxNumberOfCredentials[t];
+    }
+
+    index.Shutdown();
+    // Nothing to index: the databases are walked, which is cheap
+    VerifyOrReturnError(capacity > 0, CHIP_NO_ERROR);
+    VerifyOrReturnError(CanCastTo<uint16_t>(capacity), CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(index.Init(static_cast<uint16_t>(capacity)));
+
+    for (size_t t = 0; t < MATTER_ARRAY_SIZE(kIndexedTypes); ++t)
+    {
+        for (uint16_t i = 1; i <= maxNumberOfCredentials[t]; ++i)
+        {
+            EmberAfPluginDoorLockCredentialInfo credential;
+            VerifyOrReturnError(emberAfPluginDoorLockGetCredential(endpointId, i, kIndexedTypes[t], credential),
+                                CHIP_ERROR_INTERNAL);
+            if (DlCredentialStatus::kAvailable != credential.status && credential.credentialType == kIndexedTypes[t])
+            {
+                ReturnErrorOnFailure(index.SetCredential(kIndexedTypes[t], i, credential.credentialData));
+            }
+        }
+    }
+
+    uint16_t maxNumberOfUsers = 0;
+    VerifyOrReturnError(GetAttribute(endpointId, Attributes::NumberOfTotalUsersSupported::Id,
+                                     Attributes::NumberOfTotalUsersSupported::Get, maxNumberOfUsers),
+                        CHIP_ERROR_INTERNAL);
+    for (uint16_t i = 1; i <= maxNumberOfUsers; ++i)
+    {
+        EmberAfPluginDoorLockUserInfo user;
+        VerifyOrReturnError(emberAfPluginDoorLockGetUser(endpointId, i, user), CHIP_ERROR_INTERNAL);
+        if (UserStatusEnum::kAvailable == user.userStatus)
+        {
+            continue;
+        }
+        for (const auto & credential : user.credentials)
+        {
+            index.SetUser(credential.credentialType, credential.credentialIndex, i);
+        }
+    }
+
+    ChipLogProgress(Zcl, "Door Lock credential index built [endpointId=%d,credentials=%u]", endpointId,
+                    static_cast<unsigned>(index.Count()));
+    return CHIP_NO_ERROR;
+}
+#endif // DOOR_LOCK_SERVER_USE_CREDENTIAL_INDEX
+
 ClusterStatusCode DoorLockServer::createUser(chip::EndpointId endpointId, chip::FabricIndex creatorFabricIdx,
                                              chip::NodeId sourceNodeId, uint16_t userIndex,
                                              const Nullable<chip::CharSpan> & userName, const Nullable<uint32_t> & userUniqueId,
@@ -1991,8 +2228,8 @@ ClusterStatusCode DoorLockServer::createUser(chip::EndpointId endpointId, chip::
         newTotalCredentials = 1;
     }
 
-    if (!emberAfPluginDoorLockSetUser(endpointId, userIndex, creatorFabricIdx, creatorFabricIdx, newUserName, newUserUniqueId,
-                                      newUserStatus, newUserType, newCredentialRule, newCredentials, newTotalCredentials))
+    if (!setUser(endpointId, userIndex, creatorFabricIdx, creatorFabricIdx, newUserName, newUserUniqueId, newUserStatus,
+                 newUserType, newCredentialRule, newCredentials, newTotalCredentials))
     {
         ChipLogProgress(Zcl,
                         "[createUser] Unable to create user: app error "
@@ -2063,9 +2300,8 @@ Status DoorLockServer::modifyUser(chip::EndpointId endpointId, chip::FabricIndex
     auto newUserType         = userType.IsNull() ? user.userType : userType.Value();
     auto newCredentialRule   = credentialRule.IsNull() ? user.credentialRule : credentialRule.Value();
 
-    if (!emberAfPluginDoorLockSetUser(endpointId, userIndex, user.createdBy, modifierFabricIndex, newUserName, newUserUniqueId,
-                                      newUserStatus, newUserType, newCredentialRule, user.credentials.data(),
-                                      user.credentials.size()))
+    if (!setUser(endpointId, userIndex, user.createdBy, modifierFabricIndex, newUserName, newUserUniqueId, newUserStatus,
+                 newUserType, newCredentialRule, user.credentials.data(), user.credentials.size()))
     {
         ChipLogError(Zcl,
                      "[modifyUser] Unable to modify the user: app error "
@@ -2110,9 +2346,8 @@ Status DoorLockServer::clearUser(chip::EndpointId endpointId, chip::FabricIndex
             Zcl, "[ClearUser] Clearing associated credential [endpointId=%d,userIndex=%d,credentialType=%u,credentialIndex=%d]",
             endpointId, userIndex, to_underlying(credential.credentialType), credential.credentialIndex);
 
-        if (!emberAfPluginDoorLockSetCredential(endpointId, credential.credentialIndex, kUndefinedFabricIndex,
-                                                kUndefinedFabricIndex, DlCredentialStatus::kAvailable, credential.credentialType,
-                                                chip::ByteSpan()))
+        if (!setCredential(endpointId, credential.credentialIndex, kUndefinedFabricIndex, kUndefinedFabricIndex,
+                           DlCredentialStatus::kAvailable, credential.credentialType, chip::ByteSpan()))
         {
             ChipLogError(Zcl,
                          "[ClearUser] Unable to remove credentials associated with user - internal error "
@@ -2133,9 +2368,8 @@ Status DoorLockServer::clearUser(chip::EndpointId endpointId, chip::FabricIndex
     }
 
     // Remove the user entry
-    if (!emberAfPluginDoorLockSetUser(endpointId, userIndex, kUndefinedFabricIndex, kUndefinedFabricIndex, ""_span, 0,
-                                      UserStatusEnum::kAvailable, UserTypeEnum::kUnrestrictedUser, CredentialRuleEnum::kSingle,
-                                      nullptr, 0))
+    if (!setUser(endpointId, userIndex, kUndefinedFabricIndex, kUndefinedFabricIndex, ""_span, 0, UserStatusEnum::kAvailable,
+                 UserTypeEnum::kUnrestrictedUser, CredentialRuleEnum::kSingle, nullptr, 0))
     {
         return Status::Failure;
     }
@@ -2182,9 +2416,8 @@ bool DoorLockServer::clearFabricFromUsers(chip::EndpointId endpointId, chip::Fab
             user.lastModifiedBy = kUndefinedFabricIndex;
         }
 
-        if (!emberAfPluginDoorLockSetUser(endpointId, userIndex, user.createdBy, user.lastModifiedBy, user.userName,
-                                          user.userUniqueId, user.userStatus, user.userType, user.credentialRule,
-                                          user.credentials.data(), user.credentials.size()))
+        if (!setUser(endpointId, userIndex, user.createdBy, user.lastModifiedBy, user.userName, user.userUniqueId, user.userStatus,
+                     user.userType, user.credentialRule, user.credentials.data(), user.credentials.size()))
         {
             ChipLogError(
                 Zcl,
@@ -2223,8 +2456,8 @@ DlStatus DoorLockServer::createNewCredentialAndUser(chip::EndpointId endpointId,
         return DlStatus::kFailure;
     }
 
-    if (!emberAfPluginDoorLockSetCredential(endpointId, credential.credentialIndex, creatorFabricIdx, creatorFabricIdx,
-                                            DlCredentialStatus::kOccupied, credential.credentialType, credentialData))
+    if (!setCredential(endpointId, credential.credentialIndex, creatorFabricIdx, creatorFabricIdx, DlCredentialStatus::kOccupied,
+                       credential.credentialType, credentialData))
     {
         ChipLogProgress(Zcl,
                         "[SetCredential] Unable to set the credential: app error "
@@ -2299,8 +2532,8 @@ DlStatus DoorLockServer::createNewCredentialAndAddItToUser(chip::EndpointId endp
         return status;
     }
 
-    if (!emberAfPluginDoorLockSetCredential(endpointId, credential.credentialIndex, modifierFabricIdx, modifierFabricIdx,
-                                            DlCredentialStatus::kOccupied, credential.credentialType, credentialData))
+    if (!setCredential(endpointId, credential.credentialIndex, modifierFabricIdx, modifierFabricIdx, DlCredentialStatus::kOccupied,
+                       credential.credentialType, credentialData))
     {
         ChipLogProgress(Zcl,
                         "[SetCredential] Unable to set the credential: app error "
@@ -2375,9 +2608,8 @@ DlStatus DoorLockServer::addCredentialToUser(chip::EndpointId endpointId, chip::
     memcpy(newCredentials.Get(), user.credentials.data(), sizeof(CredentialStruct) * user.credentials.size());
     newCredentials[user.credentials.size()] = credential;
 
-    if (!emberAfPluginDoorLockSetUser(endpointId, userIndex, user.createdBy, modifierFabricIdx, user.userName, user.userUniqueId,
-                                      user.userStatus, user.userType, user.credentialRule, newCredentials.Get(),
-                                      user.credentials.size() + 1))
+    if (!setUser(endpointId, userIndex, user.createdBy, modifierFabricIdx, user.userName, user.userUniqueId, user.userStatus,
+                 user.userType, user.credentialRule, newCredentials.Get(), user.credentials.size() + 1))
     {
         ChipLogProgress(Zcl,
                         "[AddCredentialToUser] Unable to add credential to user: credential with this index is already associated "
@@ -2444,9 +2676,8 @@ DlStatus DoorLockServer::modifyCredentialForUser(chip::EndpointId endpointId, ch
                 "[endpointId=%d,userIndex=%d,credentialType=%d,credentialIndex=%d]",
                 endpointId, userIndex, to_underlying(credential.credentialType), credential.credentialIndex);
 
-            if (!emberAfPluginDoorLockSetUser(endpointId, userIndex, user.createdBy, modifierFabricIdx, user.userName,
-                                              user.userUniqueId, user.userStatus, user.userType, user.credentialRule,
-                                              newCredentials.Get(), user.credentials.size()))
+            if (!setUser(endpointId, userIndex, user.createdBy, modifierFabricIdx, user.userName, user.userUniqueId,
+                         user.userStatus, user.userType, user.credentialRule, newCredentials.Get(), user.credentials.size()))
             {
                 ChipLogProgress(
                     Zcl,
@@ -2638,8 +2869,8 @@ DlStatus DoorLockServer::modifyProgrammingPIN(chip::EndpointId endpointId, chip:
         return DlStatus::kFailure;
     }
 
-    if (!emberAfPluginDoorLockSetCredential(endpointId, credentialIndex, existingCredential.createdBy, modifierFabricIndex,
-                                            existingCredential.status, existingCredential.credentialType, credentialData))
+    if (!setCredential(endpointId, credentialIndex, existingCredential.createdBy, modifierFabricIndex, existingCredential.status,
+                       existingCredential.credentialType, credentialData))
     {
         ChipLogProgress(Zcl,
                         "[SetCredential] Unable to modify the credential: app error "
@@ -2682,8 +2913,8 @@ DlStatus DoorLockServer::modifyCredential(chip::EndpointId endpointId, chip::Fab
 
     if (DlStatus::kSuccess == status)
     {
-        if (!emberAfPluginDoorLockSetCredential(endpointId, credentialIndex, existingCredential.createdBy, modifierFabricIndex,
-                                                existingCredential.status, existingCredential.credentialType, credentialData))
+        if (!setCredential(endpointId, credentialIndex, existingCredential.createdBy, modifierFabricIndex,
+                           existingCredential.status, existingCredential.credentialType, credentialData))
         {
             ChipLogProgress(Zcl,
                             "[SetCredential] Unable to modify the credential: app error "
@@ -3078,8 +3309,8 @@ Status DoorLockServer::clearCredential(chip::EndpointId endpointId, chip::Fabric
     }
 
     // 3. If the user wasn't deleted, delete the credential and adjust the list of credentials for related user in the storage
-    if (!emberAfPluginDoorLockSetCredential(endpointId, credentialIndex, kUndefinedFabricIndex, kUndefinedFabricIndex,
-                                            DlCredentialStatus::kAvailable, credentialType, chip::ByteSpan()))
+    if (!setCredential(endpointId, credentialIndex, kUndefinedFabricIndex, kUndefinedFabricIndex, DlCredentialStatus::kAvailable,
+                       credentialType, chip::ByteSpan()))
     {
         ChipLogError(Zcl,
                      "[clearCredential] Unable to clear credential - couldn't write new credential to database "
@@ -3109,9 +3340,9 @@ Status DoorLockServer::clearCredential(chip::EndpointId endpointId, chip::Fabric
         newCredentials[newCredentialsCount++] = c;
     }
 
-    if (!emberAfPluginDoorLockSetUser(endpointId, relatedUserIndex, relatedUser.createdBy, modifier, relatedUser.userName,
-                                      relatedUser.userUniqueId, relatedUser.userStatus, relatedUser.userType,
-                                      relatedUser.credentialRule, newCredentials.Get(), newCredentialsCount))
+    if (!setUser(endpointId, relatedUserIndex, relatedUser.createdBy, modifier, relatedUser.userName, relatedUser.userUniqueId,
+                 relatedUser.userStatus, relatedUser.userType, relatedUser.credentialRule, newCredentials.Get(),
+                 newCredentialsCount))
     {
         ChipLogError(Zcl,
                      "[clearCredential] Unable to clear credential for related user - unable to update database "
@@ -3317,8 +3548,8 @@ bool DoorLockServer::clearFabricFromCredentials(chip::EndpointId endpointId, Cre
             credential.lastModifiedBy = kUndefinedFabricIndex;
         }
 
-        if (!emberAfPluginDoorLockSetCredential(endpointId, credentialIndex, credential.createdBy, credential.lastModifiedBy,
-                                                credential.status, credential.credentialType, credential.credentialData))
+        if (!setCredential(endpointId, credentialIndex, credential.createdBy, credential.lastModifiedBy, credential.status,
+                           credential.credentialType, credential.credentialData))
         {
             ChipLogError(Zcl,
                          "[clearFabricFromCredentials] Unable to clear fabric from credential - internal error "
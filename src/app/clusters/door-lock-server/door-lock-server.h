@@ -43,6 +43,19 @@
 #define DOOR_LOCK_USE_LOCAL_BUFFER 0
 #endif
 
+/**
+ * Keep an in-memory index of the PIN and RFID credentials of each endpoint, so that finding a credential by its data or the
+ * user of a credential does not walk the whole users and credentials databases.  The index is built from the databases on
+ * first use after InitEndpoint, and updated by the server as it sets users and credentials.
+ */
+#ifndef DOOR_LOCK_SERVER_USE_CREDENTIAL_INDEX
+#define DOOR_LOCK_SERVER_USE_CREDENTIAL_INDEX 0
+#endif
+
+#if DOOR_LOCK_SERVER_USE_CREDENTIAL_INDEX
+#include "door-lock-credential-index.h"
+#endif
+
 using chip::Optional;
 using chip::app::Clusters::DoorLock::AlarmCodeEnum;
 using chip::app::Clusters::DoorLock::CredentialRuleEnum;
@@ -85,12 +98,18 @@ static constexpr size_t DOOR_LOCK_USER_NAME_BUFFER_SIZE =
 
 struct EmberAfPluginDoorLockCredentialInfo;
 struct EmberAfPluginDoorLockUserInfo;
+enum class DlCredentialStatus : uint8_t;
 
 struct EmberAfDoorLockEndpointContext
 {
     chip::System::Clock::Timestamp lockoutEndTimestamp;
     int wrongCodeEntryAttempts;
     chip::app::Clusters::DoorLock::Delegate * delegate = nullptr;
+#if DOOR_LOCK_SERVER_USE_CREDENTIAL_INDEX
+    chip::app::Clusters::DoorLock::CredentialIndex credentialIndex;
+    // Set when the index no longer matches the databases and must be rebuilt before its next use
+    bool credentialIndexStale = true;
+#endif
 };
 
 /**
@@ -128,6 +147,13 @@ public:
      */
     CHIP_ERROR SetDelegate(chip::EndpointId endpointId, chip::app::Clusters::DoorLock::Delegate * delegate);
 
+    /**
+     * Must be called by the application after it changes the users or credentials databases itself, rather than through the
+     * cluster commands, so that the credential index (see DOOR_LOCK_SERVER_USE_CREDENTIAL_INDEX) is rebuilt before its next use.
+     * Does nothing if the index is disabled.
+     */
+    void InvalidateCredentialIndex(chip::EndpointId endpointId);
+
     /**
      * Updates the LockState attribute with new value and sends LockOperation event.
      *
@@ -328,6 +354,27 @@ private:
     bool findUserIndexByCredential(chip::EndpointId endpointId, CredentialTypeEnum credentialType, chip::ByteSpan credentialData,
                                    uint16_t & userIndex, uint16_t & credentialIndex, EmberAfPluginDoorLockUserInfo & userInfo);
 
+    DlStatus findDuplicateCredential(chip::EndpointId endpointId, CredentialTypeEnum credentialType,
+                                     const chip::ByteSpan & credentialData, uint16_t credentialIndex,
+                                     uint16_t maxNumberOfCredentials);
+
+    // Wrappers of emberAfPluginDoorLockSetUser/emberAfPluginDoorLockSetCredential keeping the credential index up to date.
+    bool setUser(chip::EndpointId endpointId, uint16_t userIndex, chip::FabricIndex creator, chip::FabricIndex modifier,
+                 const chip::CharSpan & userName, uint32_t uniqueId, UserStatusEnum userStatus, UserTypeEnum usertype,
+                 CredentialRuleEnum credentialRule, const CredentialStruct * credentials, size_t totalCredentials);
+    bool setCredential(chip::EndpointId endpointId, uint16_t credentialIndex, chip::FabricIndex creator,
+                       chip::FabricIndex modifier, DlCredentialStatus credentialStatus, CredentialTypeEnum credentialType,
+                       const chip::ByteSpan & credentialData);
+
+#if DOOR_LOCK_SERVER_USE_CREDENTIAL_INDEX
+    /**
+     * Returns the credential index of the endpoint, rebuilding it if needed, or nullptr if it is not available, in which case
+     * the databases must be walked.
+     */
+    chip::app::Clusters::DoorLock::CredentialIndex * getCredentialIndex(chip::EndpointId endpointId);
+    CHIP_ERROR buildCredentialIndex(chip::EndpointId endpointId, chip::app::Clusters::DoorLock::CredentialIndex & index);
+#endif
+
     chip::Protocols::InteractionModel::ClusterStatusCode
     createUser(chip::EndpointId endpointId, chip::FabricIndex creatorFabricIdx, chip::NodeId sourceNodeId, uint16_t userIndex,
                const Nullable<chip::CharSpan> & userName, const Nullable<uint32_t> & userUniqueId,
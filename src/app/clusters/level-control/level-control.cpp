@@ -26,6 +26,7 @@
 #include <app/CommandHandler.h>
 #include <app/ConcreteCommandPath.h>
 #include <app/cluster-building-blocks/QuieterReporting.h>
+#include <app/cluster-building-blocks/TransitionScheduler.h>
 #include <app/util/attribute-storage.h>
 #include <app/util/config.h>
 #include <app/util/util.h>
@@ -324,8 +325,10 @@ static uint32_t computeCallbackWaitTimeMs(CallbackScheduleState & callbackSchedu
 
 static void scheduleTimerCallbackMs(EndpointId endpoint, uint32_t delayMs)
 {
-    CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(chip::System::Clock::Milliseconds32(delayMs), timerCallback,
-                                                           reinterpret_cast<void *>(static_cast<uintptr_t>(endpoint)));
+    // Transitions of all the endpoints (and of the color control cluster) advance from the same timer ticks.
+    CHIP_ERROR err =
+        TransitionScheduler::GetInstance().StartTimer(DeviceLayer::SystemLayer(), chip::System::Clock::Milliseconds32(delayMs),
+                                                      timerCallback, reinterpret_cast<void *>(static_cast<uintptr_t>(endpoint)));
 
     if (err != CHIP_NO_ERROR)
     {
@@ -335,7 +338,7 @@ static void scheduleTimerCallbackMs(EndpointId endpoint, uint32_t delayMs)
 
 static void cancelEndpointTimerCallback(EndpointId endpoint)
 {
-    DeviceLayer::SystemLayer().CancelTimer(timerCallback, reinterpret_cast<void *>(static_cast<uintptr_t>(endpoint)));
+    TransitionScheduler::GetInstance().CancelTimer(timerCallback, reinterpret_cast<void *>(static_cast<uintptr_t>(endpoint)));
 }
 
 static EmberAfLevelControlState * getState(EndpointId endpoint)
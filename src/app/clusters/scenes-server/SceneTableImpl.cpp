@@ -100,12 +100,14 @@ template class chip::app::Storage::FabricTableImpl<SceneTableBase::SceneStorageI
 
 CHIP_ERROR DefaultSceneTableImpl::Init(PersistentStorageDelegate & storage)
 {
+    EvictAllCachedScenes();
     return FabricTableImpl::Init(storage);
 }
 
 void DefaultSceneTableImpl::Finish()
 {
     UnregisterAllHandlers();
+    EvictAllCachedScenes();
     FabricTableImpl::Finish();
 }
 
@@ -133,26 +135,46 @@ CHIP_ERROR DefaultSceneTableImpl::SetSceneTableEntry(FabricIndex fabric_index, c
 {
     // Scene data is small, buffer can be allocated on stack
     PersistentStore<Serializer::kEntryMaxBytes()> writeBuffer;
-    return this->SetTableEntry(fabric_index, entry.mStorageId, entry.mStorageData, writeBuffer);
+    CHIP_ERROR err = this->SetTableEntry(fabric_index, entry.mStorageId, entry.mStorageData, writeBuffer);
+    if (CHIP_NO_ERROR == err)
+    {
+        CacheScene(fabric_index, entry);
+    }
+    else
+    {
+        // The entry in storage may or may not have been updated
+        EvictCachedScene(fabric_index, mEndpointId, entry.mStorageId);
+    }
+    return err;
 }
 
 CHIP_ERROR DefaultSceneTableImpl::GetSceneTableEntry(FabricIndex fabric_index, SceneStorageId scene_id, SceneTableEntry & entry)
 {
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    if (GetCachedScene(fabric_index, scene_id, entry))
+    {
+        return CHIP_NO_ERROR;
+    }
+
     // All data is copied to SceneTableEntry, buffer can be allocated on stack
     PersistentStore<Serializer::kEntryMaxBytes()> store;
     ReturnErrorOnFailure(this->GetTableEntry(fabric_index, scene_id, entry.mStorageData, store));
     entry.mStorageId = scene_id;
+    CacheScene(fabric_index, entry);
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR DefaultSceneTableImpl::RemoveSceneTableEntry(FabricIndex fabric_index, SceneStorageId scene_id)
 {
+    EvictCachedScene(fabric_index, mEndpointId, scene_id);
     return this->RemoveTableEntry(fabric_index, scene_id);
 }
 
 CHIP_ERROR DefaultSceneTableImpl::RemoveSceneTableEntryAtPosition(EndpointId endpoint, FabricIndex fabric_index,
                                                                   SceneIndex scene_idx)
 {
+    // The scene at this position is not known without loading the fabric's scene map, drop all the fabric's scenes instead
+    EvictCachedScenes(fabric_index, endpoint);
     return this->RemoveTableEntryAtPosition(endpoint, fabric_index, scene_idx);
 }
 
@@ -193,6 +215,8 @@ CHIP_ERROR DefaultSceneTableImpl::DeleteAllScenesInGroup(FabricIndex fabric_inde
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    EvictCachedScenesInGroup(fabric_index, mEndpointId, group_id);
+
     FabricSceneData fabric(mEndpointId, fabric_index, mMaxPerFabric, mMaxPerEndpoint);
 
     CHIP_ERROR err = fabric.Load(this->mStorage);
@@ -306,11 +330,13 @@ CHIP_ERROR DefaultSceneTableImpl::SceneApplyEFS(const SceneTableEntry & scene)
 
 CHIP_ERROR DefaultSceneTableImpl::RemoveFabric(FabricIndex fabric_index)
 {
+    EvictCachedScenes(fabric_index, kInvalidEndpointId);
     return FabricTableImpl::RemoveFabric(fabric_index);
 }
 
 CHIP_ERROR DefaultSceneTableImpl::RemoveEndpoint()
 {
+    EvictCachedScenes(kUndefinedFabricIndex, mEndpointId);
     return FabricTableImpl::RemoveEndpoint();
 }
 
@@ -334,6 +360,121 @@ void DefaultSceneTableImpl::SetTableSize(uint16_t endpointSceneTableSize)
     FabricTableImpl::SetTableSize(endpointSceneTableSize, static_cast<uint16_t>((endpointSceneTableSize - 1) / 2));
 }
 
+#if CHIP_CONFIG_SCENES_CACHE_SIZE > 0
+
+DefaultSceneTableImpl::CachedScene * DefaultSceneTableImpl::FindCachedScene(FabricIndex fabric_index, EndpointId endpoint,
+                                                                            const SceneStorageId & scene_id)
+{
+    for (auto & cached : mCache)
+    {
+        if (cached.Matches(fabric_index, endpoint) && cached.mEntry.mStorageId == scene_id)
+        {
+            return &cached;
+        }
+    }
+    return nullptr;
+}
+
+bool DefaultSceneTableImpl::GetCachedScene(FabricIndex fabric_index, const SceneStorageId & scene_id, SceneTableEntry & entry)
+{
+    CachedScene * cached = FindCachedScene(fabric_index, mEndpointId, scene_id);
+    VerifyOrReturnValue(nullptr != cached, false);
+
+    cached->mLastUse = ++mCacheUseCounter;
+    entry            = cached->mEntry;
+    return true;
+}
+
+void DefaultSceneTableImpl::CacheScene(FabricIndex fabric_index, const SceneTableEntry & entry)
+{
+    VerifyOrReturn(kUndefinedFabricIndex != fabric_index && kInvalidEndpointId != mEndpointId);
+
+    CachedScene * slot = FindCachedScene(fabric_index, mEndpointId, entry.mStorageId);
+    if (nullptr == slot)
+    {
+        // Use a free slot, or replace the least recently used scene
+        slot = &mCache[0];
+        for (auto & cached : mCache)
+        {
+            if (!cached.IsValid())
+            {
+                slot = &cached;
+                break;
+            }
+            if (cached.mLastUse < slot->mLastUse)
+            {
+                slot = &cached;
+            }
+        }
+    }
+
+    slot->mFabricIndex = fabric_index;
+    slot->mEndpointId  = mEndpointId;
+    slot->mEntry       = entry;
+    slot->mLastUse     = ++mCacheUseCounter;
+}
+
+void DefaultSceneTableImpl::EvictCachedScene(FabricIndex fabric_index, EndpointId endpoint, const SceneStorageId & scene_id)
+{
+    CachedScene * cached = FindCachedScene(fabric_index, endpoint, scene_id);
+    if (nullptr != cached)
+    {
+        cached->Clear();
+    }
+}
+
+/// @brief Evicts the cached scenes of a fabric on an endpoint. kUndefinedFabricIndex and kInvalidEndpointId act as wildcards.
+void DefaultSceneTableImpl::EvictCachedScenes(FabricIndex fabric_index, EndpointId endpoint)
+{
+    for (auto & cached : mCache)
+    {
+        if ((kUndefinedFabricIndex == fabric_index || cached.mFabricIndex == fabric_index) &&
+            (kInvalidEndpointId == endpoint || cached.mEndpointId == endpoint))
+        {
+            cached.Clear();
+        }
+    }
+}
+
+void DefaultSceneTableImpl::EvictCachedScenesInGroup(FabricIndex fabric_index, EndpointId endpoint, GroupId group_id)
+{
+    for (auto & cached : mCache)
+    {
+        if (cached.Matches(fabric_index, endpoint) && cached.mEntry.mStorageId.mGroupId == group_id)
+        {
+            cached.Clear();
+        }
+    }
+}
+
+void DefaultSceneTableImpl::EvictAllCachedScenes()
+{
+    for (auto & cached : mCache)
+    {
+        cached.Clear();
+    }
+    mCacheUseCounter = 0;
+}
+
+#else // CHIP_CONFIG_SCENES_CACHE_SIZE > 0
+
+bool DefaultSceneTableImpl::GetCachedScene(FabricIndex fabric_index, const SceneStorageId & scene_id, SceneTableEntry & entry)
+{
+    return false;
+}
+
+void DefaultSceneTableImpl::CacheScene(FabricIndex fabric_index, const SceneTableEntry & entry) {}
+
+void DefaultSceneTableImpl::EvictCachedScene(FabricIndex fabric_index, EndpointId endpoint, const SceneStorageId & scene_id) {}
+
+void DefaultSceneTableImpl::EvictCachedScenes(FabricIndex fabric_index, EndpointId endpoint) {}
+
+void DefaultSceneTableImpl::EvictCachedScenesInGroup(FabricIndex fabric_index, EndpointId endpoint, GroupId group_id) {}
+
+void DefaultSceneTableImpl::EvictAllCachedScenes() {}
+
+#endif // CHIP_CONFIG_SCENES_CACHE_SIZE > 0
+
 namespace {
 
 static DefaultSceneTableImpl gSceneTableImpl;
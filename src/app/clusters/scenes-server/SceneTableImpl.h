@@ -107,6 +107,43 @@ protected:
 
     // wrapper function around emberAfGetClusterCountForEndpoint to allow override when testing
     virtual uint8_t GetClusterCountFromEndpoint();
+
+private:
+    // Write-through cache of decoded scenes, see CHIP_CONFIG_SCENES_CACHE_SIZE. Storage stays the source of truth: entries are
+    // only added once they are persisted, and evicted whenever the matching scenes are removed from storage.
+    bool GetCachedScene(FabricIndex fabric_index, const SceneStorageId & scene_id, SceneTableEntry & entry);
+    void CacheScene(FabricIndex fabric_index, const SceneTableEntry & entry);
+    void EvictCachedScene(FabricIndex fabric_index, EndpointId endpoint, const SceneStorageId & scene_id);
+    void EvictCachedScenes(FabricIndex fabric_index, EndpointId endpoint);
+    void EvictCachedScenesInGroup(FabricIndex fabric_index, EndpointId endpoint, GroupId group_id);
+    void EvictAllCachedScenes();
+
+#if CHIP_CONFIG_SCENES_CACHE_SIZE > 0
+    struct CachedScene
+    {
+        FabricIndex mFabricIndex = kUndefinedFabricIndex;
+        EndpointId mEndpointId   = kInvalidEndpointId;
+        SceneTableEntry mEntry;
+        // Value of mCacheUseCounter when the scene was last used; the least recently used scene is replaced first
+        uint32_t mLastUse = 0;
+
+        bool IsValid() const { return mFabricIndex != kUndefinedFabricIndex; }
+        void Clear()
+        {
+            mFabricIndex = kUndefinedFabricIndex;
+            mEndpointId  = kInvalidEndpointId;
+        }
+        bool Matches(FabricIndex fabric_index, EndpointId endpoint) const
+        {
+            return mFabricIndex == fabric_index && mEndpointId == endpoint;
+        }
+    };
+
+    CachedScene * FindCachedScene(FabricIndex fabric_index, EndpointId endpoint, const SceneStorageId & scene_id);
+
+    CachedScene mCache[CHIP_CONFIG_SCENES_CACHE_SIZE];
+    uint32_t mCacheUseCounter = 0;
+#endif // CHIP_CONFIG_SCENES_CACHE_SIZE > 0
 }; // class DefaultSceneTableImpl
 
 /// @brief Gets a pointer to the instance of Scene Table Impl, providing EndpointId and Table Size for said endpoint
@@ -0,0 +1,109 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/data-model/StructFieldCodec.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+namespace DataModel {
+
+namespace {
+
+CHIP_ERROR EncodeFields(TLV::TLVWriter & writer, TLV::Tag tag, Span<const StructFieldDescriptor> fields, const void * object,
+                        bool includeSensitive, bool includeFabricIndex)
+{
+    TLV::TLVType outer;
+    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
+
+    for (const StructFieldDescriptor & field : fields)
+    {
+        if ((field.kind == StructFieldKind::kFabricSensitive && !includeSensitive) ||
+            (field.kind == StructFieldKind::kFabricIndex && !includeFabricIndex))
+        {
+            continue;
+        }
+        // The codec only reads the object when given a writer.
+        ReturnErrorOnFailure(field.codec(&writer, nullptr, TLV::ContextTag(field.contextTag), const_cast<void *>(object)));
+    }
+
+    return writer.EndContainer(outer);
+}
+
+} // namespace
+
+CHIP_ERROR EncodeStructFields(TLV::TLVWriter & writer, TLV::Tag tag, Span<const StructFieldDescriptor> fields,
+                              const void * object)
+{
+    return EncodeFields(writer, tag, fields, object, true, true);
+}
+
+CHIP_ERROR EncodeFabricScopedStructFields(TLV::TLVWriter & writer, TLV::Tag tag, Span<const StructFieldDescriptor> fields,
+                                          const void * object, FabricIndex fabricIndex,
+                                          const Optional<FabricIndex> & accessingFabricIndex)
+{
+    const bool includeSensitive = !accessingFabricIndex.HasValue() || (accessingFabricIndex.Value() == fabricIndex);
+    return EncodeFields(writer, tag, fields, object, includeSensitive, accessingFabricIndex.HasValue());
+}
+
+CHIP_ERROR DecodeStructFields(TLV::TLVReader & reader, Span<const StructFieldDescriptor> fields, void * object)
+{
+    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
+
+    TLV::TLVType outer;
+    ReturnErrorOnFailure(reader.EnterContainer(outer));
+
+    const size_t fieldCount = fields.size();
+    size_t expected         = 0;
+
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        const TLV::Tag tag = reader.GetTag();
+        if (!TLV::IsContextTag(tag))
+        {
+            continue;
+        }
+
+        // Context tags are 8-bit.
+        const uint8_t contextTag = static_cast<uint8_t>(TLV::TagNumFromTag(tag));
+
+        size_t index = expected;
+        if (index >= fieldCount || fields[index].contextTag != contextTag)
+        {
+            for (index = 0; index < fieldCount && fields[index].contextTag != contextTag; index++)
+            {
+            }
+            if (index == fieldCount)
+            {
+                continue;
+            }
+        }
+
+        ReturnErrorOnFailure(fields[index].codec(nullptr, &reader, tag, object));
+        expected = index + 1;
+    }
+    VerifyOrReturnError(err == CHIP_ERROR_END_OF_TLV, err);
+
+    return reader.ExitContainer(outer);
+}
+
+} // namespace DataModel
+} // namespace app
+} // namespace chip
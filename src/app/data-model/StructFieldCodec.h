@@ -0,0 +1,120 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/data-model/Decode.h>
+#include <app/data-model/Encode.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/Optional.h>
+#include <lib/core/TLV.h>
+#include <lib/support/Span.h>
+
+#include <cstdint>
+
+namespace chip {
+namespace app {
+namespace DataModel {
+
+/// How a struct field takes part in the encoding of a fabric-scoped struct.
+enum class StructFieldKind : uint8_t
+{
+    kRegular,         ///< Always encoded
+    kFabricSensitive, ///< Omitted when read by another fabric than the one of the struct
+    kFabricIndex,     ///< The fabric index field (tag 254), only encoded for reads
+};
+
+/// Describes a field of a cluster struct for the generic struct encoder and decoder below.
+///
+/// Generated cluster objects define a constant table of descriptors, in field order, for the structs listed in
+/// StructsWithFieldDescriptorTables (src/app/common/templates/config-data.yaml), so that the encoding and decoding loops
+/// are shared by those structs instead of being expanded for each of them.  The tables cost flash, so other structs keep
+/// the expanded code.
+struct StructFieldDescriptor
+{
+    /// Encodes the field of the `Type` at `object` when `writer` is set, else decodes the field of the `DecodableType` at
+    /// `object` from `reader`.  A single function per field keeps the tables and the code small.
+    using CodecFunction = CHIP_ERROR (*)(TLV::TLVWriter * writer, TLV::TLVReader * reader, TLV::Tag tag, void * object);
+
+    uint8_t contextTag;
+    StructFieldKind kind;
+    CodecFunction codec;
+};
+
+namespace detail {
+
+template <typename MemberPointer>
+struct StructMemberTraits;
+
+template <typename C, typename M>
+struct StructMemberTraits<M C::*>
+{
+    using Class = C;
+};
+
+template <auto EncodableMember, auto DecodableMember>
+CHIP_ERROR EncodeOrDecodeStructMember(TLV::TLVWriter * writer, TLV::TLVReader * reader, TLV::Tag tag, void * object)
+{
+    if (writer != nullptr)
+    {
+        using Class = typename StructMemberTraits<decltype(EncodableMember)>::Class;
+        return DataModel::Encode(*writer, tag, static_cast<const Class *>(object)->*EncodableMember);
+    }
+
+    using Class = typename StructMemberTraits<decltype(DecodableMember)>::Class;
+    return DataModel::Decode(*reader, static_cast<Class *>(object)->*DecodableMember);
+}
+
+} // namespace detail
+
+/// Descriptor of a field stored in `EncodableMember` of the `Type` of a struct and in `DecodableMember` of its `DecodableType`,
+/// e.g. `StructField<Fields::kPrivilege, &Type::privilege, &DecodableType::privilege>`.
+template <auto kTag, auto EncodableMember, auto DecodableMember, StructFieldKind kKind = StructFieldKind::kRegular>
+inline constexpr StructFieldDescriptor StructField = { static_cast<uint8_t>(kTag), kKind,
+                                                       &detail::EncodeOrDecodeStructMember<EncodableMember, DecodableMember> };
+
+template <auto kTag, auto EncodableMember, auto DecodableMember>
+inline constexpr StructFieldDescriptor FabricSensitiveStructField =
+    StructField<kTag, EncodableMember, DecodableMember, StructFieldKind::kFabricSensitive>;
+
+template <auto kTag, auto EncodableMember, auto DecodableMember>
+inline constexpr StructFieldDescriptor FabricIndexStructField =
+    StructField<kTag, EncodableMember, DecodableMember, StructFieldKind::kFabricIndex>;
+
+/// Encodes the fields of `object` as a structure.
+CHIP_ERROR EncodeStructFields(TLV::TLVWriter & writer, TLV::Tag tag, Span<const StructFieldDescriptor> fields,
+                              const void * object);
+
+/// Encodes the fields of the fabric-scoped struct `object`, which belongs to `fabricIndex`.  `accessingFabricIndex` is missing for
+/// writes, and is the fabric of the reader for reads: fabric-sensitive fields are then only included for the fabric of the
+/// struct, and the fabric index field is only included for reads.
+CHIP_ERROR EncodeFabricScopedStructFields(TLV::TLVWriter & writer, TLV::Tag tag, Span<const StructFieldDescriptor> fields,
+                                          const void * object, FabricIndex fabricIndex,
+                                          const Optional<FabricIndex> & accessingFabricIndex);
+
+/// Decodes the structure the reader is positioned on into the fields of `object`.
+///
+/// Each element is first matched against the field after the previously decoded one, as every encoder writes the fields in
+/// order.  Fields arriving in another order are still found by tag, unknown context tags and other tags are skipped.
+CHIP_ERROR DecodeStructFields(TLV::TLVReader & reader, Span<const StructFieldDescriptor> fields, void * object);
+
+} // namespace DataModel
+} // namespace app
+} // namespace chip
@@ -0,0 +1,178 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Compares the encode and decode cost of a few cluster structs with the
+ *      descriptor-driven struct codec of the generated cluster objects and
+ *      with the per-field reference implementations.
+ *
+ *      Usage: struct-field-codec-benchmark
+ */
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/data-model/tests/StructFieldCodecReference.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <chrono>
+#include <stdlib.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+using namespace chip::app::Testing;
+
+namespace {
+
+namespace AccessControlTargetStruct = AccessControl::Structs::AccessControlTargetStruct;
+
+constexpr size_t kBenchmarkIterations = 20000;
+constexpr FabricIndex kFabricIndex    = 1;
+
+const uint64_t kSubjects[] = { 0x0102030405060708, 0x1122334455667788 };
+
+const uint8_t kEpochKey[] = { 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf };
+
+template <typename Encoder, typename Decoder>
+CHIP_ERROR Measure(const char * name, Encoder && encoder, Decoder && decoder)
+{
+    uint8_t buffer[256];
+    TLV::TLVWriter writer;
+    size_t encodedLength = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kBenchmarkIterations; i++)
+    {
+        writer.Init(buffer);
+        ReturnErrorOnFailure(encoder(writer));
+        encodedLength = writer.GetLengthWritten();
+    }
+    const double encodeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kBenchmarkIterations; i++)
+    {
+        TLV::TLVReader reader;
+        reader.Init(buffer, encodedLength);
+        ReturnErrorOnFailure(reader.Next());
+        ReturnErrorOnFailure(decoder(reader));
+    }
+    const double decodeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    ChipLogProgress(Zcl, "%s (%u bytes): encode %.0f ns, decode %.0f ns", name, static_cast<unsigned>(encodedLength),
+                    encodeSeconds * 1e9 / kBenchmarkIterations, decodeSeconds * 1e9 / kBenchmarkIterations);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RunBenchmark()
+{
+    AccessControlTargetStruct::Type targets[2];
+    targets[0].cluster.SetNonNull(static_cast<ClusterId>(0x0006));
+    targets[0].endpoint.SetNull();
+    targets[0].deviceType.SetNull();
+    targets[1].cluster.SetNull();
+    targets[1].endpoint.SetNonNull(static_cast<EndpointId>(1));
+    targets[1].deviceType.SetNull();
+
+    AccessControlEntryStruct::Type entry;
+    entry.privilege = AccessControl::AccessControlEntryPrivilegeEnum::kAdminister;
+    entry.authMode  = AccessControl::AccessControlEntryAuthModeEnum::kCase;
+    entry.subjects.SetNonNull(DataModel::List<const uint64_t>(kSubjects));
+    entry.targets.SetNonNull(DataModel::List<const AccessControlTargetStruct::Type>(targets));
+    entry.fabricIndex = kFabricIndex;
+
+    GroupKeyMapStruct::Type groupKeyMap;
+    groupKeyMap.groupId       = 0x0101;
+    groupKeyMap.groupKeySetID = 0x01a1;
+    groupKeyMap.fabricIndex   = kFabricIndex;
+
+    GroupKeySetStruct::Type groupKeySet;
+    groupKeySet.groupKeySetID          = 0x01a1;
+    groupKeySet.groupKeySecurityPolicy = GroupKeyManagement::GroupKeySecurityPolicyEnum::kTrustFirst;
+    groupKeySet.epochKey0.SetNonNull(ByteSpan(kEpochKey));
+    groupKeySet.epochStartTime0.SetNonNull(1110000);
+    groupKeySet.epochKey1.SetNull();
+    groupKeySet.epochStartTime1.SetNull();
+    groupKeySet.epochKey2.SetNull();
+    groupKeySet.epochStartTime2.SetNull();
+
+    const auto readAccess = MakeOptional(kFabricIndex);
+
+    ReturnErrorOnFailure(Measure(
+        "AccessControlEntryStruct, descriptors",
+        [&](TLV::TLVWriter & writer) { return entry.EncodeForRead(writer, TLV::AnonymousTag(), kFabricIndex); },
+        [](TLV::TLVReader & reader) {
+            AccessControlEntryStruct::DecodableType value;
+            return value.Decode(reader);
+        }));
+    ReturnErrorOnFailure(Measure(
+        "AccessControlEntryStruct, reference",
+        [&](TLV::TLVWriter & writer) { return ReferenceEncode(entry, writer, TLV::AnonymousTag(), readAccess); },
+        [](TLV::TLVReader & reader) {
+            AccessControlEntryStruct::DecodableType value;
+            return ReferenceDecode(value, reader);
+        }));
+
+    ReturnErrorOnFailure(Measure(
+        "GroupKeyMapStruct, descriptors",
+        [&](TLV::TLVWriter & writer) { return groupKeyMap.EncodeForRead(writer, TLV::AnonymousTag(), kFabricIndex); },
+        [](TLV::TLVReader & reader) {
+            GroupKeyMapStruct::Type value;
+            return value.Decode(reader);
+        }));
+    ReturnErrorOnFailure(Measure(
+        "GroupKeyMapStruct, reference",
+        [&](TLV::TLVWriter & writer) { return ReferenceEncode(groupKeyMap, writer, TLV::AnonymousTag(), readAccess); },
+        [](TLV::TLVReader & reader) {
+            GroupKeyMapStruct::Type value;
+            return ReferenceDecode(value, reader);
+        }));
+
+    ReturnErrorOnFailure(Measure(
+        "GroupKeySetStruct, descriptors", [&](TLV::TLVWriter & writer) { return groupKeySet.Encode(writer, TLV::AnonymousTag()); },
+        [](TLV::TLVReader & reader) {
+            GroupKeySetStruct::Type value;
+            return value.Decode(reader);
+        }));
+    return Measure(
+        "GroupKeySetStruct, reference",
+        [&](TLV::TLVWriter & writer) { return ReferenceEncode(groupKeySet, writer, TLV::AnonymousTag()); },
+        [](TLV::TLVReader & reader) {
+            GroupKeySetStruct::Type value;
+            return ReferenceDecode(value, reader);
+        });
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    CHIP_ERROR err = RunBenchmark();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Zcl, "Struct field codec benchmark failed: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    Platform::MemoryShutdown();
+    return (err == CHIP_NO_ERROR) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,202 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Reference encoders and decoders of a few cluster structs, shared by the
+ *      struct codec tests and benchmark.
+ *
+ *      This is what the generated code used to expand to for every struct:
+ *      per-field encoder calls and a decode loop matching the context tags.
+ */
+
+#pragma once
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/WrappedStructEncoder.h>
+#include <lib/core/TLV.h>
+
+namespace chip {
+namespace app {
+namespace Testing {
+
+namespace AccessControlEntryStruct = Clusters::AccessControl::Structs::AccessControlEntryStruct;
+namespace GroupKeyMapStruct        = Clusters::GroupKeyManagement::Structs::GroupKeyMapStruct;
+namespace GroupKeySetStruct        = Clusters::GroupKeyManagement::Structs::GroupKeySetStruct;
+
+inline CHIP_ERROR ReferenceEncode(const GroupKeyMapStruct::Type & value, TLV::TLVWriter & writer, TLV::Tag tag,
+                           const Optional<FabricIndex> & accessingFabricIndex)
+{
+    DataModel::WrappedStructEncoder encoder{ writer, tag };
+    encoder.Encode(to_underlying(GroupKeyMapStruct::Fields::kGroupId), value.groupId);
+    encoder.Encode(to_underlying(GroupKeyMapStruct::Fields::kGroupKeySetID), value.groupKeySetID);
+    if (accessingFabricIndex.HasValue())
+    {
+        encoder.Encode(to_underlying(GroupKeyMapStruct::Fields::kFabricIndex), value.fabricIndex);
+    }
+    return encoder.Finalize();
+}
+
+inline CHIP_ERROR ReferenceDecode(GroupKeyMapStruct::Type & value, TLV::TLVReader & reader)
+{
+    Clusters::detail::StructDecodeIterator iterator(reader);
+    while (true)
+    {
+        uint8_t contextTag = 0;
+        CHIP_ERROR err     = iterator.Next(contextTag);
+        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
+        ReturnErrorOnFailure(err);
+
+        if (contextTag == to_underlying(GroupKeyMapStruct::Fields::kGroupId))
+        {
+            err = DataModel::Decode(reader, value.groupId);
+        }
+        else if (contextTag == to_underlying(GroupKeyMapStruct::Fields::kGroupKeySetID))
+        {
+            err = DataModel::Decode(reader, value.groupKeySetID);
+        }
+        else if (contextTag == to_underlying(GroupKeyMapStruct::Fields::kFabricIndex))
+        {
+            err = DataModel::Decode(reader, value.fabricIndex);
+        }
+        ReturnErrorOnFailure(err);
+    }
+}
+
+inline CHIP_ERROR ReferenceEncode(const GroupKeySetStruct::Type & value, TLV::TLVWriter & writer, TLV::Tag tag)
+{
+    DataModel::WrappedStructEncoder encoder{ writer, tag };
+    encoder.Encode(to_underlying(GroupKeySetStruct::Fields::kGroupKeySetID), value.groupKeySetID);
+    encoder.Encode(to_underlying(GroupKeySetStruct::Fields::kGroupKeySecurityPolicy), value.groupKeySecurityPolicy);
+    encoder.Encode(to_underlying(GroupKeySetStruct::Fields::kEpochKey0), value.epochKey0);
+    encoder.Encode(to_underlying(GroupKeySetStruct::Fields::kEpochStartTime0), value.epochStartTime0);
+    encoder.Encode(to_underlying(GroupKeySetStruct::Fields::kEpochKey1), value.epochKey1);
+    encoder.Encode(to_underlying(GroupKeySetStruct::Fields::kEpochStartTime1), value.epochStartTime1);
+    encoder.Encode(to_underlying(GroupKeySetStruct::Fields::kEpochKey2), value.epochKey2);
+    encoder.Encode(to_underlying(GroupKeySetStruct::Fields::kEpochStartTime2), value.epochStartTime2);
+    return encoder.Finalize();
+}
+
+inline CHIP_ERROR ReferenceDecode(GroupKeySetStruct::Type & value, TLV::TLVReader & reader)
+{
+    Clusters::detail::StructDecodeIterator iterator(reader);
+    while (true)
+    {
+        uint8_t contextTag = 0;
+        CHIP_ERROR err     = iterator.Next(contextTag);
+        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
+        ReturnErrorOnFailure(err);
+
+        if (contextTag == to_underlying(GroupKeySetStruct::Fields::kGroupKeySetID))
+        {
+            err = DataModel::Decode(reader, value.groupKeySetID);
+        }
+        else if (contextTag == to_underlying(GroupKeySetStruct::Fields::kGroupKeySecurityPolicy))
+        {
+            err = DataModel::Decode(reader, value.groupKeySecurityPolicy);
+        }
+        else if (contextTag == to_underlying(GroupKeySetStruct::Fields::kEpochKey0))
+        {
+            err = DataModel::Decode(reader, value.epochKey0);
+        }
+        else if (contextTag == to_underlying(GroupKeySetStruct::Fields::kEpochStartTime0))
+        {
+            err = DataModel::Decode(reader, value.epochStartTime0);
+        }
+        else if (contextTag == to_underlying(GroupKeySetStruct::Fields::kEpochKey1))
+        {
+            err = DataModel::Decode(reader, value.epochKey1);
+        }
+        else if (contextTag == to_underlying(GroupKeySetStruct::Fields::kEpochStartTime1))
+        {
+            err = DataModel::Decode(reader, value.epochStartTime1);
+        }
+        else if (contextTag == to_underlying(GroupKeySetStruct::Fields::kEpochKey2))
+        {
+            err = DataModel::Decode(reader, value.epochKey2);
+        }
+        else if (contextTag == to_underlying(GroupKeySetStruct::Fields::kEpochStartTime2))
+        {
+            err = DataModel::Decode(reader, value.epochStartTime2);
+        }
+        ReturnErrorOnFailure(err);
+    }
+}
+
+inline CHIP_ERROR ReferenceEncode(const AccessControlEntryStruct::Type & value, TLV::TLVWriter & writer, TLV::Tag tag,
+                           const Optional<FabricIndex> & accessingFabricIndex)
+{
+    bool includeSensitive = !accessingFabricIndex.HasValue() || (accessingFabricIndex.Value() == value.fabricIndex);
+
+    DataModel::WrappedStructEncoder encoder{ writer, tag };
+    if (includeSensitive)
+    {
+        encoder.Encode(to_underlying(AccessControlEntryStruct::Fields::kPrivilege), value.privilege);
+        encoder.Encode(to_underlying(AccessControlEntryStruct::Fields::kAuthMode), value.authMode);
+        encoder.Encode(to_underlying(AccessControlEntryStruct::Fields::kSubjects), value.subjects);
+        encoder.Encode(to_underlying(AccessControlEntryStruct::Fields::kTargets), value.targets);
+        encoder.Encode(to_underlying(AccessControlEntryStruct::Fields::kAuxiliaryType), value.auxiliaryType);
+    }
+    if (accessingFabricIndex.HasValue())
+    {
+        encoder.Encode(to_underlying(AccessControlEntryStruct::Fields::kFabricIndex), value.fabricIndex);
+    }
+    return encoder.Finalize();
+}
+
+inline CHIP_ERROR ReferenceDecode(AccessControlEntryStruct::DecodableType & value, TLV::TLVReader & reader)
+{
+    Clusters::detail::StructDecodeIterator iterator(reader);
+    while (true)
+    {
+        uint8_t contextTag = 0;
+        CHIP_ERROR err     = iterator.Next(contextTag);
+        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
+        ReturnErrorOnFailure(err);
+
+        if (contextTag == to_underlying(AccessControlEntryStruct::Fields::kPrivilege))
+        {
+            err = DataModel::Decode(reader, value.privilege);
+        }
+        else if (contextTag == to_underlying(AccessControlEntryStruct::Fields::kAuthMode))
+        {
+            err = DataModel::Decode(reader, value.authMode);
+        }
+        else if (contextTag == to_underlying(AccessControlEntryStruct::Fields::kSubjects))
+        {
+            err = DataModel::Decode(reader, value.subjects);
+        }
+        else if (contextTag == to_underlying(AccessControlEntryStruct::Fields::kTargets))
+        {
+            err = DataModel::Decode(reader, value.targets);
+        }
+        else if (contextTag == to_underlying(AccessControlEntryStruct::Fields::kAuxiliaryType))
+        {
+            err = DataModel::Decode(reader, value.auxiliaryType);
+        }
+        else if (contextTag == to_underlying(AccessControlEntryStruct::Fields::kFabricIndex))
+        {
+            err = DataModel::Decode(reader, value.fabricIndex);
+        }
+        ReturnErrorOnFailure(err);
+    }
+}
+
+} // namespace Testing
+} // namespace app
+} // namespace chip
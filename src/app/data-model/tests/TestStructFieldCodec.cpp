@@ -0,0 +1,229 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Checks for the descriptor-driven struct codec used by the generated
+ *      cluster objects.
+ *
+ *      The codec and the reference implementations must produce and accept the
+ *      same TLV.
+ */
+
+#include <algorithm>
+
+#include <pw_unit_test/framework.h>
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/data-model/StructFieldCodec.h>
+#include <app/data-model/tests/StructFieldCodecReference.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLV.h>
+#include <lib/support/Span.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+using namespace chip::app::Testing;
+
+namespace AccessControlTargetStruct = AccessControl::Structs::AccessControlTargetStruct;
+
+constexpr FabricIndex kFabricIndex = 1;
+
+// Sample values.
+
+const uint64_t kSubjects[] = { 0x0102030405060708, 0x1122334455667788 };
+
+const uint8_t kEpochKey[] = { 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf };
+
+class TestStructFieldCodec : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        mTargets[0].cluster.SetNonNull(static_cast<ClusterId>(0x0006));
+        mTargets[0].endpoint.SetNull();
+        mTargets[0].deviceType.SetNull();
+        mTargets[1].cluster.SetNull();
+        mTargets[1].endpoint.SetNonNull(static_cast<EndpointId>(1));
+        mTargets[1].deviceType.SetNull();
+
+        mEntry.privilege = AccessControl::AccessControlEntryPrivilegeEnum::kAdminister;
+        mEntry.authMode  = AccessControl::AccessControlEntryAuthModeEnum::kCase;
+        mEntry.subjects.SetNonNull(DataModel::List<const uint64_t>(kSubjects));
+        mEntry.targets.SetNonNull(DataModel::List<const AccessControlTargetStruct::Type>(mTargets));
+        mEntry.fabricIndex = kFabricIndex;
+
+        mGroupKeyMap.groupId       = 0x0101;
+        mGroupKeyMap.groupKeySetID = 0x01a1;
+        mGroupKeyMap.fabricIndex   = kFabricIndex;
+
+        mGroupKeySet.groupKeySetID          = 0x01a1;
+        mGroupKeySet.groupKeySecurityPolicy = GroupKeyManagement::GroupKeySecurityPolicyEnum::kTrustFirst;
+        mGroupKeySet.epochKey0.SetNonNull(ByteSpan(kEpochKey));
+        mGroupKeySet.epochStartTime0.SetNonNull(1110000);
+        mGroupKeySet.epochKey1.SetNull();
+        mGroupKeySet.epochStartTime1.SetNull();
+        mGroupKeySet.epochKey2.SetNull();
+        mGroupKeySet.epochStartTime2.SetNull();
+    }
+
+protected:
+    template <typename Encoder>
+    static ByteSpan Encode(MutableByteSpan buffer, Encoder && encoder)
+    {
+        TLV::TLVWriter writer;
+        writer.Init(buffer);
+        EXPECT_EQ(encoder(writer), CHIP_NO_ERROR);
+        EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+        return buffer.SubSpan(0, writer.GetLengthWritten());
+    }
+
+    template <typename T, typename Decoder>
+    static CHIP_ERROR Decode(ByteSpan encoded, T & value, Decoder && decoder)
+    {
+        TLV::TLVReader reader;
+        reader.Init(encoded);
+        ReturnErrorOnFailure(reader.Next());
+        return decoder(value, reader);
+    }
+
+    AccessControlTargetStruct::Type mTargets[2];
+    AccessControlEntryStruct::Type mEntry;
+    GroupKeyMapStruct::Type mGroupKeyMap;
+    GroupKeySetStruct::Type mGroupKeySet;
+};
+
+TEST_F(TestStructFieldCodec, EncodesLikeReference)
+{
+    uint8_t buffer[256];
+    uint8_t referenceBuffer[256];
+
+    for (const Optional<FabricIndex> & accessingFabricIndex :
+         { Optional<FabricIndex>(), MakeOptional(kFabricIndex), MakeOptional(static_cast<FabricIndex>(kFabricIndex + 1)) })
+    {
+        ByteSpan encoded = Encode(MutableByteSpan(buffer), [&](TLV::TLVWriter & writer) {
+            return accessingFabricIndex.HasValue() ? mEntry.EncodeForRead(writer, TLV::AnonymousTag(), accessingFabricIndex.Value())
+                                                   : mEntry.EncodeForWrite(writer, TLV::AnonymousTag());
+        });
+        ByteSpan reference = Encode(MutableByteSpan(referenceBuffer), [&](TLV::TLVWriter & writer) {
+            return ReferenceEncode(mEntry, writer, TLV::AnonymousTag(), accessingFabricIndex);
+        });
+        EXPECT_TRUE(encoded.data_equal(reference));
+
+        encoded = Encode(MutableByteSpan(buffer), [&](TLV::TLVWriter & writer) {
+            return accessingFabricIndex.HasValue()
+                ? mGroupKeyMap.EncodeForRead(writer, TLV::AnonymousTag(), accessingFabricIndex.Value())
+                : mGroupKeyMap.EncodeForWrite(writer, TLV::AnonymousTag());
+        });
+        reference = Encode(MutableByteSpan(referenceBuffer), [&](TLV::TLVWriter & writer) {
+            return ReferenceEncode(mGroupKeyMap, writer, TLV::AnonymousTag(), accessingFabricIndex);
+        });
+        EXPECT_TRUE(encoded.data_equal(reference));
+    }
+
+    ByteSpan encoded = Encode(MutableByteSpan(buffer),
+                              [&](TLV::TLVWriter & writer) { return mGroupKeySet.Encode(writer, TLV::AnonymousTag()); });
+    ByteSpan reference = Encode(MutableByteSpan(referenceBuffer), [&](TLV::TLVWriter & writer) {
+        return ReferenceEncode(mGroupKeySet, writer, TLV::AnonymousTag());
+    });
+    EXPECT_TRUE(encoded.data_equal(reference));
+}
+
+TEST_F(TestStructFieldCodec, OmitsSensitiveFieldsForOtherFabrics)
+{
+    uint8_t buffer[256];
+    ByteSpan encoded = Encode(MutableByteSpan(buffer), [&](TLV::TLVWriter & writer) {
+        return mEntry.EncodeForRead(writer, TLV::AnonymousTag(), static_cast<FabricIndex>(kFabricIndex + 1));
+    });
+
+    AccessControlEntryStruct::DecodableType decoded;
+    decoded.authMode = AccessControl::AccessControlEntryAuthModeEnum::kGroup;
+    ASSERT_EQ(Decode(encoded, decoded, [](auto & value, TLV::TLVReader & reader) { return value.Decode(reader); }), CHIP_NO_ERROR);
+    EXPECT_EQ(decoded.authMode, AccessControl::AccessControlEntryAuthModeEnum::kGroup);
+    EXPECT_TRUE(decoded.subjects.IsNull());
+    EXPECT_EQ(decoded.fabricIndex, kFabricIndex);
+}
+
+TEST_F(TestStructFieldCodec, DecodesOutOfOrderAndUnknownFields)
+{
+    // GroupKeyMapStruct with its fields reversed, an unknown context tag and a profile tag in between.
+    uint8_t buffer[64];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+    TLV::TLVType outer;
+    ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Put(TLV::ContextTag(254), static_cast<uint8_t>(3)), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Put(TLV::ContextTag(2), static_cast<uint16_t>(0x0222)), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.PutString(TLV::ContextTag(17), "unknown"), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Put(TLV::ProfileTag(0x1234, 1), static_cast<uint8_t>(7)), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Put(TLV::ContextTag(1), static_cast<uint16_t>(0x0111)), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.EndContainer(outer), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+    ByteSpan encoded(buffer, writer.GetLengthWritten());
+
+    GroupKeyMapStruct::Type decoded;
+    ASSERT_EQ(Decode(encoded, decoded, [](auto & value, TLV::TLVReader & reader) { return value.Decode(reader); }), CHIP_NO_ERROR);
+    EXPECT_EQ(decoded.groupId, 0x0111);
+    EXPECT_EQ(decoded.groupKeySetID, 0x0222);
+    EXPECT_EQ(decoded.fabricIndex, 3);
+
+    GroupKeyMapStruct::Type reference;
+    ASSERT_EQ(Decode(encoded, reference, [](auto & value, TLV::TLVReader & reader) { return ReferenceDecode(value, reader); }),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(reference.groupId, decoded.groupId);
+    EXPECT_EQ(reference.groupKeySetID, decoded.groupKeySetID);
+    EXPECT_EQ(reference.fabricIndex, decoded.fabricIndex);
+}
+
+TEST_F(TestStructFieldCodec, RejectsInvalidInput)
+{
+    // Not a structure.
+    uint8_t buffer[64];
+    ByteSpan encoded = Encode(MutableByteSpan(buffer), [](TLV::TLVWriter & writer) {
+        return writer.Put(TLV::AnonymousTag(), static_cast<uint8_t>(1));
+    });
+    GroupKeyMapStruct::Type decoded;
+    EXPECT_EQ(Decode(encoded, decoded, [](auto & value, TLV::TLVReader & reader) { return value.Decode(reader); }),
+              CHIP_ERROR_WRONG_TLV_TYPE);
+
+    // A field of the wrong type.
+    encoded = Encode(MutableByteSpan(buffer), [](TLV::TLVWriter & writer) {
+        TLV::TLVType outer;
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer));
+        ReturnErrorOnFailure(writer.PutString(TLV::ContextTag(1), "group"));
+        return writer.EndContainer(outer);
+    });
+    EXPECT_EQ(Decode(encoded, decoded, [](auto & value, TLV::TLVReader & reader) { return value.Decode(reader); }),
+              CHIP_ERROR_WRONG_TLV_TYPE);
+
+    // A truncated structure.
+    encoded = Encode(MutableByteSpan(buffer), [&](TLV::TLVWriter & writer) {
+        return mGroupKeyMap.EncodeForRead(writer, TLV::AnonymousTag(), kFabricIndex);
+    });
+    for (size_t length = 1; length < encoded.size(); length++)
+    {
+        EXPECT_NE(Decode(encoded.SubSpan(0, length), decoded,
+                         [](auto & value, TLV::TLVReader & reader) { return value.Decode(reader); }),
+                  CHIP_NO_ERROR);
+    }
+}
+
+} // namespace
@@ -15,10 +15,12 @@
  *    limitations under the License.
  */
 
+#include <algorithm>
 #include <app/icd/client/DefaultICDClientStorage.h>
 #include <iterator>
 #include <lib/core/Global.h>
 #include <lib/support/Base64.h>
+#include <lib/support/BufferWriter.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/SafeInt.h>
@@ -35,6 +37,13 @@ constexpr size_t kFabricIndexMax = 255;
 
 constexpr size_t kMaxFabricListTlvLength = kFabricIndexTlvSize * kFabricIndexMax + kArrayOverHead;
 static_assert(kMaxFabricListTlvLength <= std::numeric_limits<uint16_t>::max(), "Expected size for fabric list TLV is too large!");
+
+// Nonces are random-looking, their first bytes are enough to tell the expected ones apart
+uint64_t NonceTag(const uint8_t * nonce)
+{
+    static_assert(chip::Crypto::CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES >= sizeof(uint64_t), "Nonce too short for its tag");
+    return chip::Encoding::LittleEndian::Get64(nonce);
+}
 } // namespace
 
 namespace chip {
@@ -50,8 +59,11 @@ CHIP_ERROR DefaultICDClientStorage::UpdateFabricList(FabricIndex fabricIndex)
     }
 
     mFabricList.push_back(fabricIndex);
+    ReturnErrorOnFailure(StoreFabricList());
 
-    return StoreFabricList();
+    // The fabric may have client infos stored before a reboot
+    ResidentFabric * fabric = nullptr;
+    return GetResidentFabric(fabricIndex, fabric);
 }
 
 CHIP_ERROR DefaultICDClientStorage::StoreFabricList()
@@ -106,7 +118,6 @@ DefaultICDClientStorage::ICDClientInfoIteratorImpl::ICDClientInfoIteratorImpl(De
 {
     mFabricListIndex = 0;
     mClientInfoIndex = 0;
-    mClientInfoVector.clear();
 }
 
 size_t DefaultICDClientStorage::ICDClientInfoIteratorImpl::Count()
@@ -114,14 +125,12 @@ size_t DefaultICDClientStorage::ICDClientInfoIteratorImpl::Count()
     size_t total = 0;
     for (auto & fabric_idx : mManager.mFabricList)
     {
-        size_t count          = 0;
-        size_t clientInfoSize = 0;
-        if (mManager.LoadCounter(fabric_idx, count, clientInfoSize) != CHIP_NO_ERROR)
+        ResidentFabric * fabric = nullptr;
+        if (mManager.GetResidentFabric(fabric_idx, fabric) != CHIP_NO_ERROR)
         {
             return 0;
         };
-        IgnoreUnusedVariable(clientInfoSize);
-        total += count;
+        total += fabric->clientInfos.size();
     }
 
     return total;
@@ -131,23 +140,19 @@ bool DefaultICDClientStorage::ICDClientInfoIteratorImpl::Next(ICDClientInfo & it
 {
     for (; mFabricListIndex < mManager.mFabricList.size(); mFabricListIndex++)
     {
-        if (mClientInfoVector.size() == 0)
+        ResidentFabric * fabric = nullptr;
+        if (mManager.GetResidentFabric(mManager.mFabricList[mFabricListIndex], fabric) != CHIP_NO_ERROR)
         {
-            size_t clientInfoSize = 0;
-            if (mManager.Load(mManager.mFabricList[mFabricListIndex], mClientInfoVector, clientInfoSize) != CHIP_NO_ERROR)
-            {
-                continue;
-            }
-            IgnoreUnusedVariable(clientInfoSize);
+            mClientInfoIndex = 0;
+            continue;
         }
-        if (mClientInfoIndex < mClientInfoVector.size())
+        if (mClientInfoIndex < fabric->clientInfos.size())
         {
-            item = mClientInfoVector[mClientInfoIndex];
+            item = fabric->clientInfos[mClientInfoIndex].clientInfo;
             mClientInfoIndex++;
             return true;
         }
         mClientInfoIndex = 0;
-        mClientInfoVector.clear();
     }
 
     return false;
@@ -169,7 +174,15 @@ CHIP_ERROR DefaultICDClientStorage::Init(PersistentStorageDelegate * clientInfoS
     {
         err = CHIP_NO_ERROR;
     }
-    return err;
+    ReturnErrorOnFailure(err);
+
+    for (auto & fabric_idx : mFabricList)
+    {
+        // A fabric failing to load is logged, and retried by the next operation on the fabric
+        ResidentFabric * fabric = nullptr;
+        (void) GetResidentFabric(fabric_idx, fabric);
+    }
+    return CHIP_NO_ERROR;
 }
 
 DefaultICDClientStorage::ICDClientInfoIterator * DefaultICDClientStorage::IterateICDClientInfo()
@@ -303,6 +316,116 @@ CHIP_ERROR DefaultICDClientStorage::Load(FabricIndex fabricIndex, std::vector<IC
     return reader.VerifyEndOfContainer();
 }
 
+CHIP_ERROR DefaultICDClientStorage::GetResidentFabric(FabricIndex fabricIndex, ResidentFabric *& fabric)
+{
+    for (auto & residentFabric : mResidentFabrics)
+    {
+        if (residentFabric.fabricIndex == fabricIndex)
+        {
+            fabric = &residentFabric;
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    std::vector<ICDClientInfo> clientInfoVector;
+    size_t clientInfoSize = MaxICDClientInfoSize();
+    CHIP_ERROR err        = Load(fabricIndex, clientInfoVector, clientInfoSize);
+    if (err != CHIP_NO_ERROR)
+    {
+        if (std::find(mUnloadableFabrics.begin(), mUnloadableFabrics.end(), fabricIndex) == mUnloadableFabrics.end())
+        {
+            ChipLogError(ICD, "Failed to load ICD client infos for fabric index %u: %" CHIP_ERROR_FORMAT, fabricIndex,
+                         err.Format());
+            mUnloadableFabrics.push_back(fabricIndex);
+        }
+        return err;
+    }
+    mUnloadableFabrics.erase(std::remove(mUnloadableFabrics.begin(), mUnloadableFabrics.end(), fabricIndex),
+                             mUnloadableFabrics.end());
+
+    ResidentFabric residentFabric;
+    residentFabric.fabricIndex    = fabricIndex;
+    residentFabric.clientInfoSize = clientInfoSize;
+    residentFabric.clientInfos.resize(clientInfoVector.size());
+    for (size_t i = 0; i < clientInfoVector.size(); i++)
+    {
+        residentFabric.clientInfos[i].clientInfo = clientInfoVector[i];
+        ExpectNextCheckIns(residentFabric.clientInfos[i]);
+    }
+    mResidentFabrics.push_back(std::move(residentFabric));
+    fabric = &mResidentFabrics.back();
+    return CHIP_NO_ERROR;
+}
+
+void DefaultICDClientStorage::RemoveResidentFabric(FabricIndex fabricIndex)
+{
+    for (auto fabric = mResidentFabrics.begin(); fabric != mResidentFabrics.end(); fabric++)
+    {
+        if (fabric->fabricIndex == fabricIndex)
+        {
+            for (auto & client : fabric->clientInfos)
+            {
+                ForgetExpectedCheckIns(client);
+            }
+            mResidentFabrics.erase(fabric);
+            return;
+        }
+    }
+}
+
+DefaultICDClientStorage::ResidentClientInfo * DefaultICDClientStorage::FindResidentClientInfo(const ScopedNodeId & peerNode)
+{
+    ResidentFabric * fabric = nullptr;
+    VerifyOrReturnValue(GetResidentFabric(peerNode.GetFabricIndex(), fabric) == CHIP_NO_ERROR, nullptr);
+    for (auto & client : fabric->clientInfos)
+    {
+        if (client.clientInfo.peer_node == peerNode)
+        {
+            return &client;
+        }
+    }
+    return nullptr;
+}
+
+void DefaultICDClientStorage::ExpectNextCheckIns(ResidentClientInfo & client)
+{
+#if CHIP_CONFIG_ICD_CLIENT_CHECK_IN_NONCE_WINDOW > 0
+    const ICDClientInfo & clientInfo = client.clientInfo;
+    client.expectedNonceCount        = 0;
+    for (size_t i = 0; i < client.expectedNonceTags.size(); i++)
+    {
+        // Counters following the last one received, wrapping like the counter of the ICD
+        const auto counter =
+            static_cast<Protocols::SecureChannel::CounterType>(clientInfo.start_icd_counter + clientInfo.offset + 1 + i);
+        uint8_t nonce[Crypto::CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES];
+        Encoding::LittleEndian::BufferWriter writer(nonce, sizeof(nonce));
+        if (Protocols::SecureChannel::CheckinMessage::GenerateCheckInMessageNonce(clientInfo.hmac_key_handle, counter, writer) !=
+            CHIP_NO_ERROR)
+        {
+            break;
+        }
+        const uint64_t tag                                    = NonceTag(nonce);
+        client.expectedNonceTags[client.expectedNonceCount++] = tag;
+        mExpectedCheckIns[tag]                                = clientInfo.peer_node;
+    }
+#endif // CHIP_CONFIG_ICD_CLIENT_CHECK_IN_NONCE_WINDOW > 0
+}
+
+void DefaultICDClientStorage::ForgetExpectedCheckIns(const ResidentClientInfo & client)
+{
+#if CHIP_CONFIG_ICD_CLIENT_CHECK_IN_NONCE_WINDOW > 0
+    for (size_t i = 0; i < client.expectedNonceCount; i++)
+    {
+        auto expected = mExpectedCheckIns.find(client.expectedNonceTags[i]);
+        // Another client may have taken over the tag
+        if (expected != mExpectedCheckIns.end() && expected->second == client.clientInfo.peer_node)
+        {
+            mExpectedCheckIns.erase(expected);
+        }
+    }
+#endif // CHIP_CONFIG_ICD_CLIENT_CHECK_IN_NONCE_WINDOW > 0
+}
+
 CHIP_ERROR DefaultICDClientStorage::SetKey(ICDClientInfo & clientInfo, const ByteSpan keyData)
 {
     VerifyOrReturnError(keyData.size() == sizeof(Crypto::Symmetric128BitsKeyByteArray), CHIP_ERROR_INVALID_ARGUMENT);
@@ -326,12 +449,14 @@ void DefaultICDClientStorage::RemoveKey(ICDClientInfo & clientInfo)
     mpKeyStore->DestroyKey(clientInfo.hmac_key_handle);
 }
 
-CHIP_ERROR DefaultICDClientStorage::SerializeToTlv(TLV::TLVWriter & writer, const std::vector<ICDClientInfo> & clientInfoVector)
+CHIP_ERROR DefaultICDClientStorage::SerializeToTlv(TLV::TLVWriter & writer,
+                                                   const std::vector<ResidentClientInfo> & clientInfoVector)
 {
     TLV::TLVType arrayType;
     ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, arrayType));
-    for (auto & clientInfo : clientInfoVector)
+    for (auto & residentClientInfo : clientInfoVector)
     {
+        const ICDClientInfo & clientInfo = residentClientInfo.clientInfo;
         TLV::TLVType ICDClientInfoContainerType;
         ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, ICDClientInfoContainerType));
         ReturnErrorOnFailure(writer.Put(TLV::ContextTag(ClientInfoTag::kPeerNodeId), clientInfo.peer_node.GetNodeId()));
@@ -365,21 +490,24 @@ bool DefaultICDClientStorage::FabricExists(FabricIndex fabricIndex)
 CHIP_ERROR DefaultICDClientStorage::StoreEntry(const ICDClientInfo & clientInfo)
 {
     VerifyOrReturnError(FabricExists(clientInfo.peer_node.GetFabricIndex()), CHIP_ERROR_INVALID_FABRIC_INDEX);
-    std::vector<ICDClientInfo> clientInfoVector;
-    size_t clientInfoSize = MaxICDClientInfoSize();
-    ReturnErrorOnFailure(Load(clientInfo.peer_node.GetFabricIndex(), clientInfoVector, clientInfoSize));
+    ResidentFabric * fabric = nullptr;
+    ReturnErrorOnFailure(GetResidentFabric(clientInfo.peer_node.GetFabricIndex(), fabric));
+    size_t clientInfoSize = fabric->clientInfoSize;
 
+    // Only apply the change in memory once it is stored
+    std::vector<ResidentClientInfo> clientInfoVector = fabric->clientInfos;
     for (auto it = clientInfoVector.begin(); it != clientInfoVector.end(); it++)
     {
-        if (clientInfo.peer_node.GetNodeId() == it->peer_node.GetNodeId())
+        if (clientInfo.peer_node.GetNodeId() == it->clientInfo.peer_node.GetNodeId())
         {
             ReturnErrorOnFailure(DecreaseEntryCountForFabric(clientInfo.peer_node.GetFabricIndex()));
             clientInfoVector.erase(it);
             break;
         }
     }
-    clientInfoVector.push_back(clientInfo);
-    size_t total = clientInfoSize * clientInfoVector.size() + kArrayOverHead;
+    clientInfoVector.emplace_back();
+    clientInfoVector.back().clientInfo = clientInfo;
+    size_t total                       = clientInfoSize * clientInfoVector.size() + kArrayOverHead;
     Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
     VerifyOrReturnError(backingBuffer.Calloc(total), CHIP_ERROR_NO_MEMORY);
     TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), total);
@@ -395,6 +523,18 @@ CHIP_ERROR DefaultICDClientStorage::StoreEntry(const ICDClientInfo & clientInfo)
         static_cast<uint16_t>(len)));
 
     ReturnErrorOnFailure(IncreaseEntryCountForFabric(clientInfo.peer_node.GetFabricIndex()));
+
+    for (auto & client : fabric->clientInfos)
+    {
+        if (client.clientInfo.peer_node == clientInfo.peer_node)
+        {
+            ForgetExpectedCheckIns(client);
+            break;
+        }
+    }
+    fabric->clientInfos = std::move(clientInfoVector);
+    ExpectNextCheckIns(fabric->clientInfos.back());
+
     ChipLogProgress(ICD,
                     "Store ICD entry successfully with peer nodeId " ChipLogFormatScopedNodeId
                     " and checkin nodeId " ChipLogFormatScopedNodeId,
@@ -448,23 +588,22 @@ CHIP_ERROR DefaultICDClientStorage::UpdateEntryCountForFabric(FabricIndex fabric
 CHIP_ERROR DefaultICDClientStorage::DeleteEntry(const ScopedNodeId & peerNode)
 {
     VerifyOrReturnError(FabricExists(peerNode.GetFabricIndex()), CHIP_NO_ERROR);
-    size_t clientInfoSize = 0;
-    std::vector<ICDClientInfo> clientInfoVector;
-    ReturnErrorOnFailure(Load(peerNode.GetFabricIndex(), clientInfoVector, clientInfoSize));
-    VerifyOrReturnError(clientInfoVector.size() > 0, CHIP_NO_ERROR);
+    ResidentFabric * fabric = nullptr;
+    ReturnErrorOnFailure(GetResidentFabric(peerNode.GetFabricIndex(), fabric));
+    size_t clientInfoSize = fabric->clientInfoSize;
+    VerifyOrReturnError(fabric->clientInfos.size() > 0, CHIP_NO_ERROR);
 
+    // Only apply the change in memory once it is stored, so that a failure leaves the entry in place
+    std::vector<ResidentClientInfo> clientInfoVector = fabric->clientInfos;
     for (auto it = clientInfoVector.begin(); it != clientInfoVector.end(); it++)
     {
-        if (peerNode.GetNodeId() == it->peer_node.GetNodeId())
+        if (peerNode.GetNodeId() == it->clientInfo.peer_node.GetNodeId())
         {
-            RemoveKey(*it);
-            it = clientInfoVector.erase(it);
+            clientInfoVector.erase(it);
             break;
         }
     }
 
-    ReturnErrorOnFailure(
-        mpClientInfoStore->SyncDeleteKeyValue(DefaultStorageKeyAllocator::ICDClientInfoKey(peerNode.GetFabricIndex()).KeyName()));
     size_t total = clientInfoSize * clientInfoVector.size() + kArrayOverHead;
     Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
     VerifyOrReturnError(backingBuffer.Calloc(total), CHIP_ERROR_NO_MEMORY);
@@ -476,11 +615,24 @@ CHIP_ERROR DefaultICDClientStorage::DeleteEntry(const ScopedNodeId & peerNode)
     VerifyOrReturnError(CanCastTo<uint16_t>(len), CHIP_ERROR_BUFFER_TOO_SMALL);
 
     ReturnErrorOnFailure(writer.Finalize(backingBuffer));
+    // Overwrite the list in place: deleting it first would lose every entry of the fabric if the write then failed
     ReturnErrorOnFailure(
         mpClientInfoStore->SyncSetKeyValue(DefaultStorageKeyAllocator::ICDClientInfoKey(peerNode.GetFabricIndex()).KeyName(),
                                            backingBuffer.Get(), static_cast<uint16_t>(len)));
 
     ReturnErrorOnFailure(DecreaseEntryCountForFabric(peerNode.GetFabricIndex()));
+
+    for (auto & client : fabric->clientInfos)
+    {
+        if (peerNode.GetNodeId() == client.clientInfo.peer_node.GetNodeId())
+        {
+            ForgetExpectedCheckIns(client);
+            RemoveKey(client.clientInfo);
+            break;
+        }
+    }
+    fabric->clientInfos = std::move(clientInfoVector);
+
     ChipLogProgress(ICD, "Remove ICD entry successfully with peer nodeId " ChipLogFormatScopedNodeId,
                     ChipLogValueScopedNodeId(peerNode));
     return CHIP_NO_ERROR;
@@ -490,14 +642,13 @@ CHIP_ERROR DefaultICDClientStorage::DeleteAllEntries(FabricIndex fabricIndex)
 {
     VerifyOrReturnError(FabricExists(fabricIndex), CHIP_NO_ERROR);
 
-    size_t clientInfoSize = 0;
-    std::vector<ICDClientInfo> clientInfoVector;
-    ReturnErrorOnFailure(Load(fabricIndex, clientInfoVector, clientInfoSize));
-    IgnoreUnusedVariable(clientInfoSize);
-    for (auto & clientInfo : clientInfoVector)
+    ResidentFabric * fabric = nullptr;
+    ReturnErrorOnFailure(GetResidentFabric(fabricIndex, fabric));
+    for (auto & client : fabric->clientInfos)
     {
-        RemoveKey(clientInfo);
+        RemoveKey(client.clientInfo);
     }
+    RemoveResidentFabric(fabricIndex);
     ReturnErrorOnFailure(
         mpClientInfoStore->SyncDeleteKeyValue(DefaultStorageKeyAllocator::ICDClientInfoKey(fabricIndex).KeyName()));
     ReturnErrorOnFailure(
@@ -527,19 +678,47 @@ CHIP_ERROR DefaultICDClientStorage::ProcessCheckInPayload(const ByteSpan & paylo
 {
     uint8_t appDataBuffer[kAppDataLength];
     MutableByteSpan appData(appDataBuffer);
-    auto * iterator = IterateICDClientInfo();
-    VerifyOrReturnError(iterator != nullptr, CHIP_ERROR_NO_MEMORY);
-    while (iterator->Next(clientInfo))
+
+#if CHIP_CONFIG_ICD_CLIENT_CHECK_IN_NONCE_WINDOW > 0
+    // The nonce leads the payload in clear, try the client expecting it first
+    if (payload.size() >= Crypto::CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES)
     {
-        CHIP_ERROR err = chip::Protocols::SecureChannel::CheckinMessage::ParseCheckinMessagePayload(
-            clientInfo.aes_key_handle, clientInfo.hmac_key_handle, payload, counter, appData);
-        if (CHIP_NO_ERROR == err)
+        auto expected = mExpectedCheckIns.find(NonceTag(payload.data()));
+        if (expected != mExpectedCheckIns.end())
         {
-            iterator->Release();
-            return CHIP_NO_ERROR;
+            ResidentClientInfo * client = FindResidentClientInfo(expected->second);
+            if (client != nullptr &&
+                chip::Protocols::SecureChannel::CheckinMessage::ParseCheckinMessagePayload(
+                    client->clientInfo.aes_key_handle, client->clientInfo.hmac_key_handle, payload, counter, appData) ==
+                    CHIP_NO_ERROR)
+            {
+                clientInfo = client->clientInfo;
+                return CHIP_NO_ERROR;
+            }
+        }
+    }
+#endif // CHIP_CONFIG_ICD_CLIENT_CHECK_IN_NONCE_WINDOW > 0
+
+    for (auto & fabric_idx : mFabricList)
+    {
+        // A fabric that failed to load is not read again for every check-in message, only by the next operation on the fabric
+        ResidentFabric * fabric = nullptr;
+        if (std::find(mUnloadableFabrics.begin(), mUnloadableFabrics.end(), fabric_idx) != mUnloadableFabrics.end() ||
+            GetResidentFabric(fabric_idx, fabric) != CHIP_NO_ERROR)
+        {
+            continue;
+        }
+        for (auto & client : fabric->clientInfos)
+        {
+            CHIP_ERROR err = chip::Protocols::SecureChannel::CheckinMessage::ParseCheckinMessagePayload(
+                client.clientInfo.aes_key_handle, client.clientInfo.hmac_key_handle, payload, counter, appData);
+            if (CHIP_NO_ERROR == err)
+            {
+                clientInfo = client.clientInfo;
+                return CHIP_NO_ERROR;
+            }
         }
     }
-    iterator->Release();
     return CHIP_ERROR_NOT_FOUND;
 }
 
@@ -549,6 +728,11 @@ void DefaultICDClientStorage::Shutdown()
     mpClientInfoStore = nullptr;
     mpKeyStore        = nullptr;
     mFabricList.clear();
+    mResidentFabrics.clear();
+    mUnloadableFabrics.clear();
+#if CHIP_CONFIG_ICD_CLIENT_CHECK_IN_NONCE_WINDOW > 0
+    mExpectedCheckIns.clear();
+#endif
 }
 
 } // namespace app
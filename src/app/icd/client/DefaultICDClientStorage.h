@@ -33,6 +33,10 @@
 #include <lib/core/TLV.h>
 #include <lib/support/CommonIterator.h>
 #include <lib/support/Pool.h>
+#include <protocols/secure_channel/CheckinMessage.h>
+
+#include <array>
+#include <unordered_map>
 #include <vector>
 
 // TODO: SymmetricKeystore is an alias for SessionKeystore, replace the below when sdk supports SymmetricKeystore
@@ -47,6 +51,10 @@ namespace app {
 
 /**
  * A DefaultICDClientStorage implementation of ICDClientStorage.
+ *
+ * The ICD client infos of each fabric are loaded from storage once, and kept in memory along with the nonces expected for the
+ * next check-in messages of each client (see CHIP_CONFIG_ICD_CLIENT_CHECK_IN_NONCE_WINDOW).  Changes are written through to
+ * storage, which stays the source of truth across reboots.
  */
 class DefaultICDClientStorage : public ICDClientStorage
 {
@@ -164,7 +172,6 @@ protected:
         DefaultICDClientStorage & mManager;
         size_t mFabricListIndex = 0;
         size_t mClientInfoIndex = 0;
-        std::vector<ICDClientInfo> mClientInfoVector;
     };
 
     static constexpr size_t MaxICDClientInfoSize()
@@ -185,6 +192,36 @@ protected:
 
 private:
     friend class ICDClientInfoIteratorImpl;
+
+    struct ResidentClientInfo
+    {
+        ICDClientInfo clientInfo;
+#if CHIP_CONFIG_ICD_CLIENT_CHECK_IN_NONCE_WINDOW > 0
+        // Keys of the client in mExpectedCheckIns
+        std::array<uint64_t, CHIP_CONFIG_ICD_CLIENT_CHECK_IN_NONCE_WINDOW> expectedNonceTags;
+        size_t expectedNonceCount = 0;
+#endif
+    };
+
+    struct ResidentFabric
+    {
+        FabricIndex fabricIndex = kUndefinedFabricIndex;
+        // Serialized size of each client info, as recorded in the counter of the fabric
+        size_t clientInfoSize = 0;
+        std::vector<ResidentClientInfo> clientInfos;
+    };
+
+    /**
+     * Returns the in-memory client infos of the fabric, loading them from storage on first use.  The pointer is only valid until
+     * the next call.
+     */
+    CHIP_ERROR GetResidentFabric(FabricIndex fabricIndex, ResidentFabric *& fabric);
+    void RemoveResidentFabric(FabricIndex fabricIndex);
+    ResidentClientInfo * FindResidentClientInfo(const ScopedNodeId & peerNode);
+
+    void ExpectNextCheckIns(ResidentClientInfo & client);
+    void ForgetExpectedCheckIns(const ResidentClientInfo & client);
+
     CHIP_ERROR StoreFabricList();
     CHIP_ERROR LoadFabricList();
     CHIP_ERROR LoadCounter(FabricIndex fabricIndex, size_t & count, size_t & clientInfoSize);
@@ -195,7 +232,7 @@ private:
     CHIP_ERROR DecreaseEntryCountForFabric(FabricIndex fabricIndex);
     CHIP_ERROR UpdateEntryCountForFabric(FabricIndex fabricIndex, bool increase);
 
-    CHIP_ERROR SerializeToTlv(TLV::TLVWriter & writer, const std::vector<ICDClientInfo> & clientInfoVector);
+    CHIP_ERROR SerializeToTlv(TLV::TLVWriter & writer, const std::vector<ResidentClientInfo> & clientInfoVector);
     CHIP_ERROR Load(FabricIndex fabricIndex, std::vector<ICDClientInfo> & clientInfoVector, size_t & clientInfoSize);
 
     ObjectPool<ICDClientInfoIteratorImpl, kIteratorsMax> mICDClientInfoIterators;
@@ -203,6 +240,13 @@ private:
     PersistentStorageDelegate * mpClientInfoStore = nullptr;
     Crypto::SymmetricKeystore * mpKeyStore        = nullptr;
     std::vector<FabricIndex> mFabricList;
+    std::vector<ResidentFabric> mResidentFabrics;
+    // Fabrics whose client infos failed to load, which check-in processing skips until an operation on the fabric loads them
+    std::vector<FabricIndex> mUnloadableFabrics;
+#if CHIP_CONFIG_ICD_CLIENT_CHECK_IN_NONCE_WINDOW > 0
+    // Clients by the first 8 bytes of the nonces of their next check-in messages
+    std::unordered_map<uint64_t, ScopedNodeId> mExpectedCheckIns;
+#endif
 };
 } // namespace app
 } // namespace chip
@@ -0,0 +1,252 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/persistence/WriteBackAttributePersistenceProvider.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <string.h>
+
+namespace chip {
+namespace app {
+
+WriteBackAttributePersistenceProvider::~WriteBackAttributePersistenceProvider()
+{
+    if (mFlushTimerScheduled)
+    {
+        mSystemLayer.CancelTimer(HandleFlushTimer, this);
+    }
+
+    while (mDirtyHead != nullptr)
+    {
+        DirtyValue * dirty = mDirtyHead;
+        mDirtyHead         = dirty->mNext;
+        Platform::Delete(dirty);
+    }
+}
+
+CHIP_ERROR WriteBackAttributePersistenceProvider::WriteValue(const ConcreteAttributePath & aPath, const ByteSpan & aValue)
+{
+    mMetrics.writesRequested++;
+
+    DirtyValue ** link = Find(aPath);
+
+    // While the persister fails, the cache stops growing past a bound.  Writing through also notices the persister
+    // accepting writes again.
+    if (mPersisterFailing && mDirtyBytes > mConfig.maxDirtyBytes * kMaxDirtyBytesFactorWhileFailing)
+    {
+        if (*link != nullptr)
+        {
+            Remove(link);
+        }
+        return WriteThrough(aPath, aValue);
+    }
+
+    if (*link != nullptr)
+    {
+        DirtyValue * dirty   = *link;
+        const size_t oldSize = dirty->mValue.AllocatedSize();
+        if (!dirty->Value().data_equal(aValue) && Store(*dirty, aValue) != CHIP_NO_ERROR)
+        {
+            // Drop the stale value, so that the next flush does not overwrite the value written through.
+            mDirtyBytes -= oldSize;
+            Remove(link);
+            return WriteThrough(aPath, aValue);
+        }
+
+        // The cached value is replaced before it was ever written.
+        mDirtyBytes = mDirtyBytes - oldSize + aValue.size();
+        mMetrics.writesAvoided++;
+    }
+    else
+    {
+        DirtyValue * dirty = Platform::New<DirtyValue>(aPath);
+        if (dirty == nullptr || Store(*dirty, aValue) != CHIP_NO_ERROR)
+        {
+            Platform::Delete(dirty);
+            return WriteThrough(aPath, aValue);
+        }
+        Append(dirty);
+    }
+
+    // While the persister fails, only the flush timer retries, rather than every write above the threshold.
+    if (mDirtyBytes > mConfig.maxDirtyBytes && !mPersisterFailing)
+    {
+        mMetrics.sizeFlushes++;
+        // The value is cached either way: a failed write is retried by the next flush.
+        Flush();
+        return CHIP_NO_ERROR;
+    }
+
+    ScheduleFlush();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR WriteBackAttributePersistenceProvider::ReadValue(const ConcreteAttributePath & aPath, MutableByteSpan & aValue)
+{
+    DirtyValue * dirty = *Find(aPath);
+    if (dirty == nullptr)
+    {
+        return mPersister.ReadValue(aPath, aValue);
+    }
+
+    return CopySpanToMutableSpan(dirty->Value(), aValue);
+}
+
+CHIP_ERROR WriteBackAttributePersistenceProvider::Flush()
+{
+    if (mFlushTimerScheduled)
+    {
+        mSystemLayer.CancelTimer(HandleFlushTimer, this);
+        mFlushTimerScheduled = false;
+    }
+
+    VerifyOrReturnError(mDirtyHead != nullptr, CHIP_NO_ERROR);
+    mMetrics.flushes++;
+
+    mPersisterFailing = false;
+    while (mDirtyHead != nullptr)
+    {
+        DirtyValue * dirty = mDirtyHead;
+        CHIP_ERROR err     = mPersister.WriteValue(dirty->mPath, dirty->Value());
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "Failed to write back attribute " ChipLogFormatMEI " of cluster " ChipLogFormatMEI
+                         " on endpoint %u: %" CHIP_ERROR_FORMAT,
+                         ChipLogValueMEI(dirty->mPath.mAttributeId), ChipLogValueMEI(dirty->mPath.mClusterId),
+                         dirty->mPath.mEndpointId, err.Format());
+            mMetrics.writesFailed++;
+            mPersisterFailing = true;
+            // Writing the values changed later would persist them before this one: retry them all later.
+            ScheduleFlush();
+            return err;
+        }
+
+        mMetrics.writesPerformed++;
+        Remove(&mDirtyHead);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR WriteBackAttributePersistenceProvider::Shutdown()
+{
+    CHIP_ERROR err = Flush();
+    if (mFlushTimerScheduled)
+    {
+        mSystemLayer.CancelTimer(HandleFlushTimer, this);
+        mFlushTimerScheduled = false;
+    }
+    LogMetrics();
+    return err;
+}
+
+void WriteBackAttributePersistenceProvider::LogMetrics() const
+{
+    ChipLogProgress(DataManagement,
+                    "Attribute write-back: %" PRIu32 " writes requested, %" PRIu32 " performed, %" PRIu32 " avoided, %" PRIu32
+                    " written through, %" PRIu32 " failed, in %" PRIu32 " flushes (%" PRIu32 " for size)",
+                    mMetrics.writesRequested, mMetrics.writesPerformed, mMetrics.writesAvoided, mMetrics.writesThrough,
+                    mMetrics.writesFailed, mMetrics.flushes, mMetrics.sizeFlushes);
+}
+
+CHIP_ERROR WriteBackAttributePersistenceProvider::WriteThrough(const ConcreteAttributePath & aPath, const ByteSpan & aValue)
+{
+    mMetrics.writesThrough++;
+    CHIP_ERROR err = mPersister.WriteValue(aPath, aValue);
+    if (err == CHIP_NO_ERROR)
+    {
+        // The persister accepts writes again: the size threshold flushes the cache from the next write.
+        mPersisterFailing = false;
+    }
+    return err;
+}
+
+void WriteBackAttributePersistenceProvider::HandleFlushTimer(System::Layer * layer, void * context)
+{
+    auto * self                = static_cast<WriteBackAttributePersistenceProvider *>(context);
+    self->mFlushTimerScheduled = false;
+    self->Flush();
+}
+
+WriteBackAttributePersistenceProvider::DirtyValue **
+WriteBackAttributePersistenceProvider::Find(const ConcreteAttributePath & aPath)
+{
+    DirtyValue ** link = &mDirtyHead;
+    while (*link != nullptr && (*link)->mPath != aPath)
+    {
+        link = &(*link)->mNext;
+    }
+    return link;
+}
+
+CHIP_ERROR WriteBackAttributePersistenceProvider::Store(DirtyValue & dirty, const ByteSpan & aValue)
+{
+    if (dirty.mValue.AllocatedSize() != aValue.size())
+    {
+        dirty.mValue.Free();
+        if (!aValue.empty())
+        {
+            dirty.mValue.Alloc(aValue.size());
+            VerifyOrReturnError(dirty.mValue, CHIP_ERROR_NO_MEMORY);
+        }
+    }
+
+    if (!aValue.empty())
+    {
+        memcpy(dirty.mValue.Get(), aValue.data(), aValue.size());
+    }
+    return CHIP_NO_ERROR;
+}
+
+void WriteBackAttributePersistenceProvider::Append(DirtyValue * dirty)
+{
+    *mDirtyTail = dirty;
+    mDirtyTail  = &dirty->mNext;
+    mDirtyCount++;
+    mDirtyBytes += DirtyValue::Footprint(dirty->mValue.AllocatedSize());
+}
+
+void WriteBackAttributePersistenceProvider::Remove(DirtyValue ** link)
+{
+    DirtyValue * dirty = *link;
+    *link              = dirty->mNext;
+    if (mDirtyTail == &dirty->mNext)
+    {
+        mDirtyTail = link;
+    }
+    mDirtyCount--;
+    mDirtyBytes -= DirtyValue::Footprint(dirty->mValue.AllocatedSize());
+    Platform::Delete(dirty);
+}
+
+void WriteBackAttributePersistenceProvider::ScheduleFlush()
+{
+    VerifyOrReturn(mDirtyHead != nullptr && !mFlushTimerScheduled);
+
+    CHIP_ERROR err = mSystemLayer.StartTimer(mConfig.flushDelay, HandleFlushTimer, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to schedule the attribute write-back: %" CHIP_ERROR_FORMAT, err.Format());
+        return;
+    }
+    mFlushTimerScheduled = true;
+}
+
+} // namespace app
+} // namespace chip
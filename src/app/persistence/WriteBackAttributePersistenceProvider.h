@@ -0,0 +1,166 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/persistence/AttributePersistenceProvider.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Decorator class for the AttributePersistenceProvider implementation that
+ * caches the writes of all attributes and writes them back in batches.
+ *
+ * Written values are kept in a dirty set, holding the latest value of each
+ * attribute, which is written to the decorated persister when it is flushed:
+ *
+ *   - by the flush timer, started by the first write after a flush, so that no
+ *     value stays in the cache longer than the flush delay,
+ *   - as soon as the dirty values hold more than the configured size,
+ *   - on Flush() or Shutdown(), e.g. before the application exits.
+ *
+ * An attribute that changes several times between flushes, such as the
+ * CurrentLevel attribute of the LevelControl cluster during a transition, is
+ * written once.  Reads return the cached value, if any.
+ *
+ * Each flush writes the dirty values in the order they were first changed, and
+ * a value only leaves the cache once the decorated persister accepted it.  A
+ * flush stops at the first write that fails, so that no value is persisted
+ * before a value changed earlier; the next flush retries from that value.
+ * While the decorated persister fails, the size threshold no longer triggers
+ * flushes and only the flush timer retries.  Once the dirty values hold more
+ * than kMaxDirtyBytesFactorWhileFailing times the configured size, further
+ * values are written through instead of cached, ahead of the older cached
+ * values; the first of them that succeeds re-enables the size threshold.  A
+ * crash loses the values written since the last flush, at most the flush delay.
+ */
+class WriteBackAttributePersistenceProvider : public AttributePersistenceProvider
+{
+public:
+    struct Config
+    {
+        /// Longest time a value stays in the cache before it is written back.
+        System::Clock::Milliseconds32 flushDelay;
+        /// Memory held by the dirty values, in bytes, above which the cache is flushed right away.
+        size_t maxDirtyBytes;
+    };
+
+    /// Multiple of Config::maxDirtyBytes the dirty values may reach while the decorated persister fails.
+    static constexpr size_t kMaxDirtyBytesFactorWhileFailing = 4;
+
+    struct Metrics
+    {
+        uint32_t writesRequested = 0; ///< Calls to WriteValue()
+        uint32_t writesPerformed = 0; ///< Values written to the decorated persister
+        uint32_t writesAvoided   = 0; ///< Values replaced, or written again unchanged, before being written back
+        uint32_t writesThrough   = 0; ///< Values written directly because they could not be cached, or the cache is full
+        uint32_t writesFailed    = 0; ///< Writes to the decorated persister that failed, and are retried
+        uint32_t flushes         = 0; ///< Flushes that had values to write
+        uint32_t sizeFlushes     = 0; ///< Flushes triggered by the size threshold
+    };
+
+    WriteBackAttributePersistenceProvider(AttributePersistenceProvider & persister, System::Layer & systemLayer,
+                                          const Config & config) :
+        mPersister(persister),
+        mSystemLayer(systemLayer), mConfig(config)
+    {}
+
+    /// Drops the cached values without writing them: call Shutdown() first to keep them.
+    ~WriteBackAttributePersistenceProvider() override;
+
+    WriteBackAttributePersistenceProvider(const WriteBackAttributePersistenceProvider &)             = delete;
+    WriteBackAttributePersistenceProvider & operator=(const WriteBackAttributePersistenceProvider &) = delete;
+
+    /*
+     * Cache the value, to be written by the next flush.  If the value cannot be
+     * cached for lack of memory, or the cache is full while the decorated
+     * persister fails, it is written to the decorated persister immediately.
+     */
+    CHIP_ERROR WriteValue(const ConcreteAttributePath & aPath, const ByteSpan & aValue) override;
+    CHIP_ERROR ReadValue(const ConcreteAttributePath & aPath, MutableByteSpan & aValue) override;
+
+    /**
+     * Write all the cached values to the decorated persister now.
+     *
+     * @return The error of the write that failed, if any.  The flush stops there,
+     *         and that value and the values changed after it stay in the cache.
+     */
+    CHIP_ERROR Flush();
+
+    /**
+     * Flush the cache and stop the flush timer.  Must be called before the
+     * system layer shuts down.
+     */
+    CHIP_ERROR Shutdown();
+
+    size_t GetDirtyCount() const { return mDirtyCount; }
+    size_t GetDirtyBytes() const { return mDirtyBytes; }
+
+    const Metrics & GetMetrics() const { return mMetrics; }
+    void ResetMetrics() { mMetrics = Metrics(); }
+
+    /// Log the metrics, e.g. to assess the flush delay and size of a product.
+    void LogMetrics() const;
+
+private:
+    struct DirtyValue
+    {
+        explicit DirtyValue(const ConcreteAttributePath & path) : mPath(path) {}
+
+        // Memory held by a dirty value of the given size.
+        static size_t Footprint(size_t size) { return sizeof(DirtyValue) + size; }
+
+        ByteSpan Value() const { return ByteSpan(mValue.Get(), mValue.AllocatedSize()); }
+
+        DirtyValue * mNext = nullptr;
+        const ConcreteAttributePath mPath;
+        Platform::ScopedMemoryBufferWithSize<uint8_t> mValue;
+    };
+
+    static void HandleFlushTimer(System::Layer * layer, void * context);
+
+    // Returns the link to the dirty value of the attribute, or to the end of the list if it is not dirty.
+    DirtyValue ** Find(const ConcreteAttributePath & aPath);
+    // Copies the value to the buffer of a dirty value.  On failure, the dirty value is left empty.
+    static CHIP_ERROR Store(DirtyValue & dirty, const ByteSpan & aValue);
+    // Writes the value to the decorated persister directly, bypassing the cache.
+    CHIP_ERROR WriteThrough(const ConcreteAttributePath & aPath, const ByteSpan & aValue);
+    void Append(DirtyValue * dirty);
+    void Remove(DirtyValue ** link);
+    void ScheduleFlush();
+
+    AttributePersistenceProvider & mPersister;
+    System::Layer & mSystemLayer;
+    const Config mConfig;
+
+    // Dirty values, in the order they were first changed.
+    DirtyValue * mDirtyHead   = nullptr;
+    DirtyValue ** mDirtyTail  = &mDirtyHead;
+    size_t mDirtyCount        = 0;
+    size_t mDirtyBytes        = 0;
+    bool mFlushTimerScheduled = false;
+    // Whether the last flush failed, which defers the flushes triggered by the size threshold to the flush timer.
+    bool mPersisterFailing = false;
+
+    Metrics mMetrics;
+};
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,332 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <pw_unit_test/framework.h>
+
+#include <app/ConcreteAttributePath.h>
+#include <app/persistence/DefaultAttributePersistenceProvider.h>
+#include <app/persistence/WriteBackAttributePersistenceProvider.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/Span.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <system/SystemLayerImpl.h>
+
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+
+/**
+ * System layer holding one timer, which only fires from FireTimer().
+ */
+class FakeTimerLayer : public System::LayerImpl
+{
+public:
+    CHIP_ERROR StartTimer(System::Clock::Timeout delay, System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        mDelay      = delay;
+        mOnComplete = onComplete;
+        mAppState   = appState;
+        return CHIP_NO_ERROR;
+    }
+
+    void CancelTimer(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        if (onComplete == mOnComplete && appState == mAppState)
+        {
+            mOnComplete = nullptr;
+        }
+    }
+
+    bool IsTimerActive(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return onComplete == mOnComplete && appState == mAppState;
+    }
+
+    bool HasTimer() const { return mOnComplete != nullptr; }
+
+    void FireTimer()
+    {
+        System::TimerCompleteCallback onComplete = mOnComplete;
+        mOnComplete                              = nullptr;
+        ASSERT_NE(onComplete, nullptr);
+        onComplete(this, mAppState);
+    }
+
+    System::Clock::Timeout mDelay;
+
+private:
+    System::TimerCompleteCallback mOnComplete = nullptr;
+    void * mAppState                          = nullptr;
+};
+
+/**
+ * Persister recording the paths it writes, in order.
+ */
+class RecordingPersister : public DefaultAttributePersistenceProvider
+{
+public:
+    CHIP_ERROR WriteValue(const ConcreteAttributePath & aPath, const ByteSpan & aValue) override
+    {
+        CHIP_ERROR err = DefaultAttributePersistenceProvider::WriteValue(aPath, aValue);
+        if (err == CHIP_NO_ERROR)
+        {
+            mWrites.push_back(aPath);
+        }
+        return err;
+    }
+
+    std::vector<ConcreteAttributePath> mWrites;
+};
+
+constexpr WriteBackAttributePersistenceProvider::Config kConfig = { System::Clock::Milliseconds32(5000), 1024 };
+
+const ConcreteAttributePath kLevelPath(1, 0x0008, 0x0000);
+const ConcreteAttributePath kOnOffPath(1, 0x0006, 0x0000);
+const ConcreteAttributePath kColorPath(2, 0x0300, 0x0007);
+
+class TestWriteBackAttributePersistenceProvider : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override { ASSERT_EQ(mPersister.Init(&mStorage), CHIP_NO_ERROR); }
+
+    std::string KeyOf(const ConcreteAttributePath & path)
+    {
+        return DefaultStorageKeyAllocator::AttributeValue(path.mEndpointId, path.mClusterId, path.mAttributeId).KeyName();
+    }
+
+    uint8_t ReadByte(AttributePersistenceProvider & provider, const ConcreteAttributePath & path)
+    {
+        uint8_t buffer[4] = {};
+        MutableByteSpan value(buffer);
+        EXPECT_EQ(provider.ReadValue(path, value), CHIP_NO_ERROR);
+        EXPECT_EQ(value.size(), 1u);
+        return buffer[0];
+    }
+
+protected:
+    TestPersistentStorageDelegate mStorage;
+    RecordingPersister mPersister;
+    FakeTimerLayer mLayer;
+};
+
+TEST_F(TestWriteBackAttributePersistenceProvider, TestCoalescesWritesUntilTheTimer)
+{
+    WriteBackAttributePersistenceProvider writeBack(mPersister, mLayer, kConfig);
+
+    for (uint8_t level = 1; level <= 100; level++)
+    {
+        EXPECT_EQ(writeBack.WriteValue(kLevelPath, ByteSpan(&level, 1)), CHIP_NO_ERROR);
+    }
+    const uint8_t on = 1;
+    EXPECT_EQ(writeBack.WriteValue(kOnOffPath, ByteSpan(&on, 1)), CHIP_NO_ERROR);
+
+    // Nothing is written yet, but reads see the latest values.
+    EXPECT_EQ(mStorage.GetNumKeys(), 0u);
+    EXPECT_EQ(writeBack.GetDirtyCount(), 2u);
+    EXPECT_EQ(ReadByte(writeBack, kLevelPath), 100);
+    EXPECT_EQ(ReadByte(writeBack, kOnOffPath), 1);
+
+    uint8_t buffer[1];
+    MutableByteSpan value(buffer);
+    EXPECT_EQ(writeBack.ReadValue(kColorPath, value), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    // One timer covers all the dirty values.
+    ASSERT_TRUE(mLayer.HasTimer());
+    EXPECT_EQ(mLayer.mDelay, System::Clock::Timeout(5000));
+    mLayer.FireTimer();
+
+    EXPECT_EQ(writeBack.GetDirtyCount(), 0u);
+    EXPECT_EQ(writeBack.GetDirtyBytes(), 0u);
+    EXPECT_FALSE(mLayer.HasTimer());
+    ASSERT_EQ(mPersister.mWrites.size(), 2u);
+    EXPECT_EQ(mPersister.mWrites[0], kLevelPath);
+    EXPECT_EQ(mPersister.mWrites[1], kOnOffPath);
+    EXPECT_EQ(ReadByte(mPersister, kLevelPath), 100);
+
+    const auto & metrics = writeBack.GetMetrics();
+    EXPECT_EQ(metrics.writesRequested, 101u);
+    EXPECT_EQ(metrics.writesPerformed, 2u);
+    EXPECT_EQ(metrics.writesAvoided, 99u);
+    EXPECT_EQ(metrics.flushes, 1u);
+
+    // The next write starts the timer again.
+    const uint8_t off = 0;
+    EXPECT_EQ(writeBack.WriteValue(kOnOffPath, ByteSpan(&off, 1)), CHIP_NO_ERROR);
+    EXPECT_TRUE(mLayer.HasTimer());
+}
+
+TEST_F(TestWriteBackAttributePersistenceProvider, TestFlushesAboveTheSizeThreshold)
+{
+    WriteBackAttributePersistenceProvider writeBack(mPersister, mLayer, { System::Clock::Milliseconds32(5000), 100 });
+
+    uint8_t buffer[100] = {};
+    EXPECT_EQ(writeBack.WriteValue(kColorPath, ByteSpan(buffer, 10)), CHIP_NO_ERROR);
+    EXPECT_EQ(mStorage.GetNumKeys(), 0u);
+    const size_t dirtyBytes = writeBack.GetDirtyBytes();
+    EXPECT_GT(dirtyBytes, 10u);
+
+    // Changing the size of a cached value is accounted for.
+    EXPECT_EQ(writeBack.WriteValue(kColorPath, ByteSpan(buffer, 20)), CHIP_NO_ERROR);
+    EXPECT_EQ(writeBack.GetDirtyBytes(), dirtyBytes + 10);
+    EXPECT_EQ(writeBack.WriteValue(kColorPath, ByteSpan(buffer, 10)), CHIP_NO_ERROR);
+    EXPECT_EQ(writeBack.GetDirtyBytes(), dirtyBytes);
+    EXPECT_EQ(mStorage.GetNumKeys(), 0u);
+
+    EXPECT_EQ(writeBack.WriteValue(kLevelPath, ByteSpan(buffer)), CHIP_NO_ERROR);
+    EXPECT_EQ(mStorage.GetNumKeys(), 2u);
+    EXPECT_EQ(writeBack.GetDirtyCount(), 0u);
+    EXPECT_EQ(writeBack.GetDirtyBytes(), 0u);
+    EXPECT_FALSE(mLayer.HasTimer());
+    EXPECT_EQ(writeBack.GetMetrics().sizeFlushes, 1u);
+}
+
+TEST_F(TestWriteBackAttributePersistenceProvider, TestRetriesFailedWrites)
+{
+    WriteBackAttributePersistenceProvider writeBack(mPersister, mLayer, kConfig);
+
+    const uint8_t level = 42;
+    const uint8_t on    = 1;
+    EXPECT_EQ(writeBack.WriteValue(kLevelPath, ByteSpan(&level, 1)), CHIP_NO_ERROR);
+    EXPECT_EQ(writeBack.WriteValue(kOnOffPath, ByteSpan(&on, 1)), CHIP_NO_ERROR);
+
+    mStorage.AddPoisonKey(KeyOf(kLevelPath));
+    EXPECT_NE(writeBack.Flush(), CHIP_NO_ERROR);
+
+    // The flush stops at the value that failed, so the value changed after it is not written first.
+    EXPECT_EQ(writeBack.GetDirtyCount(), 2u);
+    EXPECT_TRUE(mPersister.mWrites.empty());
+    EXPECT_EQ(ReadByte(writeBack, kLevelPath), 42);
+    ASSERT_TRUE(mLayer.HasTimer());
+
+    // The timer retries them, in order.
+    mStorage.ClearPoisonKeys();
+    mLayer.FireTimer();
+    EXPECT_EQ(writeBack.GetDirtyCount(), 0u);
+    ASSERT_EQ(mPersister.mWrites.size(), 2u);
+    EXPECT_EQ(mPersister.mWrites[0], kLevelPath);
+    EXPECT_EQ(mPersister.mWrites[1], kOnOffPath);
+    EXPECT_EQ(ReadByte(mPersister, kLevelPath), 42);
+
+    const auto & metrics = writeBack.GetMetrics();
+    EXPECT_EQ(metrics.writesFailed, 1u);
+    EXPECT_EQ(metrics.writesPerformed, 2u);
+    EXPECT_EQ(metrics.flushes, 2u);
+}
+
+TEST_F(TestWriteBackAttributePersistenceProvider, TestDefersSizeFlushesWhileFailing)
+{
+    WriteBackAttributePersistenceProvider writeBack(mPersister, mLayer, { System::Clock::Milliseconds32(5000), 64 });
+
+    uint8_t buffer[100] = {};
+    mStorage.AddPoisonKey(KeyOf(kLevelPath));
+    EXPECT_EQ(writeBack.WriteValue(kLevelPath, ByteSpan(buffer)), CHIP_NO_ERROR);
+    EXPECT_EQ(writeBack.GetMetrics().sizeFlushes, 1u);
+    EXPECT_EQ(writeBack.GetMetrics().writesFailed, 1u);
+    ASSERT_TRUE(mLayer.HasTimer());
+
+    // Writes above the threshold leave the retry to the timer while the persister fails.
+    for (uint8_t i = 1; i <= 10; i++)
+    {
+        buffer[0] = i;
+        EXPECT_EQ(writeBack.WriteValue(kLevelPath, ByteSpan(buffer)), CHIP_NO_ERROR);
+        EXPECT_EQ(writeBack.WriteValue(kColorPath, ByteSpan(buffer, i)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(writeBack.GetMetrics().sizeFlushes, 1u);
+    EXPECT_EQ(writeBack.GetMetrics().writesFailed, 1u);
+    EXPECT_EQ(writeBack.GetDirtyCount(), 2u);
+    EXPECT_TRUE(mLayer.HasTimer());
+
+    mStorage.ClearPoisonKeys();
+    mLayer.FireTimer();
+    EXPECT_EQ(writeBack.GetDirtyCount(), 0u);
+    ASSERT_EQ(mPersister.mWrites.size(), 2u);
+    EXPECT_EQ(mPersister.mWrites[0], kLevelPath);
+    EXPECT_EQ(mPersister.mWrites[1], kColorPath);
+
+    // Once the persister accepts writes again, the threshold flushes right away.
+    EXPECT_EQ(writeBack.WriteValue(kLevelPath, ByteSpan(buffer)), CHIP_NO_ERROR);
+    EXPECT_EQ(writeBack.GetMetrics().sizeFlushes, 2u);
+    EXPECT_EQ(writeBack.GetDirtyCount(), 0u);
+    EXPECT_FALSE(mLayer.HasTimer());
+}
+
+TEST_F(TestWriteBackAttributePersistenceProvider, TestWritesThroughWhenFullWhileFailing)
+{
+    constexpr size_t kMaxDirtyBytes = 64;
+    WriteBackAttributePersistenceProvider writeBack(mPersister, mLayer, { System::Clock::Milliseconds32(5000), kMaxDirtyBytes });
+
+    uint8_t buffer[100] = {};
+    mStorage.AddPoisonKey(KeyOf(kLevelPath));
+    mStorage.AddPoisonKey(KeyOf(kOnOffPath));
+    EXPECT_EQ(writeBack.WriteValue(kLevelPath, ByteSpan(buffer)), CHIP_NO_ERROR);
+    EXPECT_EQ(writeBack.GetMetrics().writesFailed, 1u);
+
+    // The cache grows up to its bound while the persister fails.
+    const size_t maxDirtyBytes = kMaxDirtyBytes * WriteBackAttributePersistenceProvider::kMaxDirtyBytesFactorWhileFailing;
+    for (AttributeId attributeId = 0; writeBack.GetDirtyBytes() <= maxDirtyBytes; attributeId++)
+    {
+        ASSERT_LT(attributeId, 10u);
+        EXPECT_EQ(writeBack.WriteValue(ConcreteAttributePath(3, 0x0300, attributeId), ByteSpan(buffer)), CHIP_NO_ERROR);
+    }
+    const size_t dirtyCount = writeBack.GetDirtyCount();
+    EXPECT_EQ(writeBack.GetMetrics().writesThrough, 0u);
+
+    // Past the bound, values are written through, and a failure is reported to the caller.
+    const uint8_t on = 1;
+    EXPECT_EQ(writeBack.WriteValue(kOnOffPath, ByteSpan(&on, 1)), CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    EXPECT_EQ(writeBack.GetDirtyCount(), dirtyCount);
+    EXPECT_EQ(writeBack.GetMetrics().writesThrough, 1u);
+    EXPECT_EQ(writeBack.GetMetrics().sizeFlushes, 1u);
+
+    // A value written through replaces the cached one, and its success re-enables the size threshold.
+    mStorage.ClearPoisonKeys();
+    const uint8_t level = 7;
+    EXPECT_EQ(writeBack.WriteValue(kLevelPath, ByteSpan(&level, 1)), CHIP_NO_ERROR);
+    EXPECT_EQ(writeBack.GetDirtyCount(), dirtyCount - 1);
+    EXPECT_EQ(writeBack.GetMetrics().writesThrough, 2u);
+    EXPECT_EQ(ReadByte(writeBack, kLevelPath), 7);
+    EXPECT_EQ(ReadByte(mPersister, kLevelPath), 7);
+
+    EXPECT_EQ(writeBack.WriteValue(kOnOffPath, ByteSpan(&on, 1)), CHIP_NO_ERROR);
+    EXPECT_EQ(writeBack.GetMetrics().sizeFlushes, 2u);
+    EXPECT_EQ(writeBack.GetDirtyCount(), 0u);
+    EXPECT_EQ(ReadByte(mPersister, kOnOffPath), 1);
+}
+
+TEST_F(TestWriteBackAttributePersistenceProvider, TestShutdownWritesEverything)
+{
+    WriteBackAttributePersistenceProvider writeBack(mPersister, mLayer, kConfig);
+
+    const uint8_t level = 3;
+    EXPECT_EQ(writeBack.WriteValue(kColorPath, ByteSpan()), CHIP_NO_ERROR);
+    EXPECT_EQ(writeBack.WriteValue(kLevelPath, ByteSpan(&level, 1)), CHIP_NO_ERROR);
+    EXPECT_EQ(writeBack.Shutdown(), CHIP_NO_ERROR);
+
+    EXPECT_FALSE(mLayer.HasTimer());
+    EXPECT_EQ(mStorage.GetNumKeys(), 2u);
+    EXPECT_EQ(ReadByte(mPersister, kLevelPath), 3);
+    EXPECT_TRUE(mStorage.HasKey(KeyOf(kColorPath)));
+}
+
+} // namespace
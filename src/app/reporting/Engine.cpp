@@ -34,6 +34,7 @@
 #include <app/util/MatterCallbacks.h>
 #include <lib/core/CHIPError.h>
 #include <lib/core/DataModelTypes.h>
+#include <lib/support/CHIPMemTracking.h>
 #include <lib/support/CodeUtils.h>
 #include <protocols/interaction_model/StatusCode.h>
 
@@ -729,6 +730,7 @@ exit:
 
 CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
 {
+    Platform::ScopedMemoryTag memoryTag(Platform::MemoryTag::kReporting);
     CHIP_ERROR err = CHIP_NO_ERROR;
     System::PacketBufferTLVWriter reportDataWriter;
     ReportDataMessage::Builder reportDataBuilder;
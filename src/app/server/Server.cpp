@@ -24,6 +24,7 @@
 #include <app/EventManagement.h>
 #include <app/InteractionModelEngine.h>
 #include <app/SafeAttributePersistenceProvider.h>
+#include <app/cluster-building-blocks/TransitionScheduler.h>
 #include <app/data-model-provider/Provider.h>
 #include <app/server/Dnssd.h>
 #include <app/server/EchoHandler.h>
@@ -38,6 +39,7 @@
 #include <lib/dnssd/ServiceNaming.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/LeasedCounter.h>
 #include <lib/support/PersistedCounter.h>
 #include <lib/support/TestGroupData.h>
 #include <lib/support/logging/CHIPLogging.h>
@@ -105,6 +107,7 @@ static uint8_t sInfoEventBuffer[CHIP_DEVICE_CONFIG_EVENT_LOGGING_INFO_BUFFER_SIZ
 static uint8_t sDebugEventBuffer[CHIP_DEVICE_CONFIG_EVENT_LOGGING_DEBUG_BUFFER_SIZE];
 static uint8_t sCritEventBuffer[CHIP_DEVICE_CONFIG_EVENT_LOGGING_CRIT_BUFFER_SIZE];
 static PersistedCounter<EventNumber> sGlobalEventIdCounter;
+static LeasedCounter<EventNumber> sLeasedEventIdCounter;
 static app::CircularEventBuffer sLoggingBuffer[CHIP_NUM_EVENT_LOGGING_BUFFERS];
 #endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
 
@@ -273,7 +276,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     SuccessOrExit(err);
 
     err = mSessions.Init(&DeviceLayer::SystemLayer(), &mTransports, &mMessageCounterManager, mDeviceStorage, &GetFabricTable(),
-                         *mSessionKeystore);
+                         *mSessionKeystore, initParams.counterLeaseStore);
     SuccessOrExit(err);
 
     err = mFabricDelegate.Init(this);
@@ -298,8 +301,19 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
 
 #if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
     // Initialize event logging subsystem
-    err = sGlobalEventIdCounter.Init(mDeviceStorage, DefaultStorageKeyAllocator::IMEventNumber(),
-                                     CHIP_DEVICE_CONFIG_EVENT_ID_COUNTER_EPOCH);
+    MonotonicallyIncreasingCounter<EventNumber> * eventNumberCounter;
+    if (initParams.counterLeaseStore != nullptr)
+    {
+        err                = sLeasedEventIdCounter.Init(*initParams.counterLeaseStore, CounterLeaseStore::Slot::kEventNumber,
+                                                        CHIP_DEVICE_CONFIG_EVENT_ID_COUNTER_EPOCH);
+        eventNumberCounter = &sLeasedEventIdCounter;
+    }
+    else
+    {
+        err                = sGlobalEventIdCounter.Init(mDeviceStorage, DefaultStorageKeyAllocator::IMEventNumber(),
+                                                        CHIP_DEVICE_CONFIG_EVENT_ID_COUNTER_EPOCH);
+        eventNumberCounter = &sGlobalEventIdCounter;
+    }
     SuccessOrExit(err);
 
     {
@@ -310,7 +324,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
         };
 
         err = app::EventManagement::GetInstance().Init(&mExchangeMgr, CHIP_NUM_EVENT_LOGGING_BUFFERS, &sLoggingBuffer[0],
-                                                       &logStorageResources[0], &sGlobalEventIdCounter,
+                                                       &logStorageResources[0], eventNumberCounter,
                                                        std::chrono::duration_cast<System::Clock::Milliseconds64>(mInitTimestamp),
                                                        &app::InteractionModelEngine::GetInstance()->GetReportingEngine());
 
@@ -685,6 +699,12 @@ void Server::Shutdown()
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
     app::InteractionModelEngine::GetInstance()->SetICDManager(nullptr);
 #endif // CHIP_CONFIG_ENABLE_ICD_SERVER
+    // Cancel the level and color transitions still running, so that their shared timer does not outlive the server.
+    app::TransitionScheduler::GetInstance().Shutdown();
+#if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+    // The counter lease store may be shut down or destroyed once the server is.
+    sLeasedEventIdCounter.Shutdown();
+#endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
     // Shut down any remaining sessions (and hence exchanges) before we do any
     // futher teardown.  CASE handshakes have been shut down already via
     // shutting down mCASESessionManager and mCASEServer above; shutting
@@ -44,6 +44,7 @@
 #include <crypto/PersistentStorageOperationalKeystore.h>
 #include <inet/InetConfig.h>
 #include <lib/core/CHIPConfig.h>
+#include <lib/support/CounterLeaseStore.h>
 #include <lib/support/SafeInt.h>
 #include <messaging/ExchangeMgr.h>
 #include <platform/DeviceInstanceInfoProvider.h>
@@ -167,6 +168,9 @@ struct ServerInitParams
     // Session resumption storage: Optional. Support session resumption when provided.
     // Must be initialized before being provided.
     app::SubscriptionResumptionStorage * subscriptionResumptionStorage = nullptr;
+    // Counter lease store: Optional. Keeps the event number and outgoing group message counters
+    // when provided, instead of persistentStorageDelegate. Must be initialized before being provided.
+    CounterLeaseStore * counterLeaseStore = nullptr;
     // Certificate validity policy: Optional. If none is injected, CHIPCert
     // enforces a default policy.
     Credentials::CertificateValidityPolicy * certificateValidityPolicy = nullptr;
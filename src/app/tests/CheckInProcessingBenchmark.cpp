@@ -0,0 +1,140 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures DefaultICDClientStorage::ProcessCheckInPayload with
+ *      thousands of registered clients spread over several fabrics, for
+ *      check-ins carrying the counter expected from the sender and for
+ *      check-ins that have every client tried.
+ *
+ *      Usage: check-in-processing-benchmark
+ */
+
+#include <app/icd/client/DefaultICDClientStorage.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <protocols/secure_channel/CheckinMessage.h>
+#include <system/SystemPacketBuffer.h>
+
+#include <chrono>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+// Clients are spread over fabrics, the client infos of a fabric are stored in a single value of at most 64 kB
+constexpr FabricIndex kFabricCount     = 16;
+constexpr size_t kClientsPerFabric     = 625;
+constexpr size_t kCheckInsPerIteration = 50;
+
+constexpr uint8_t kKeyBuffer[] = {
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+};
+
+CHIP_ERROR RegisterClients(DefaultICDClientStorage & manager, std::vector<ICDClientInfo> & clientInfos)
+{
+    for (FabricIndex fabricId = 1; fabricId <= kFabricCount; fabricId++)
+    {
+        ReturnErrorOnFailure(manager.UpdateFabricList(fabricId));
+        for (size_t i = 0; i < kClientsPerFabric; i++)
+        {
+            ICDClientInfo clientInfo;
+            clientInfo.peer_node = ScopedNodeId(static_cast<NodeId>(1000 + i), fabricId);
+            uint8_t key[sizeof(kKeyBuffer)];
+            memcpy(key, kKeyBuffer, sizeof(key));
+            key[0] = fabricId;
+            key[1] = static_cast<uint8_t>(i);
+            key[2] = static_cast<uint8_t>(i >> 8);
+            ReturnErrorOnFailure(manager.SetKey(clientInfo, ByteSpan(key)));
+            ReturnErrorOnFailure(manager.StoreEntry(clientInfo));
+            clientInfos.push_back(clientInfo);
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MeasureCheckIns(DefaultICDClientStorage & manager, const std::vector<ICDClientInfo> & clientInfos, uint32_t counter,
+                           double & usPerCheckIn)
+{
+    System::PacketBufferHandle buffer =
+        System::PacketBufferHandle::New(Protocols::SecureChannel::CheckinMessage::kMinPayloadSize);
+    VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kCheckInsPerIteration; i++)
+    {
+        const ICDClientInfo & sender = clientInfos[(i * 7919) % clientInfos.size()];
+        MutableByteSpan output{ buffer->Start(), buffer->MaxDataLength() };
+        ReturnErrorOnFailure(Protocols::SecureChannel::CheckinMessage::GenerateCheckinMessagePayload(
+            sender.aes_key_handle, sender.hmac_key_handle, counter, ByteSpan(), output));
+
+        ICDClientInfo decodeClientInfo;
+        uint32_t checkInCounter = 0;
+        ReturnErrorOnFailure(manager.ProcessCheckInPayload(output, decodeClientInfo, checkInCounter));
+        VerifyOrReturnError(decodeClientInfo.peer_node == sender.peer_node, CHIP_ERROR_INTERNAL);
+    }
+    usPerCheckIn = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() /
+        static_cast<double>(kCheckInsPerIteration);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RunBenchmark()
+{
+    TestPersistentStorageDelegate clientInfoStorage;
+    Crypto::DefaultSessionKeystore keystore;
+
+    DefaultICDClientStorage manager;
+    ReturnErrorOnFailure(manager.Init(&clientInfoStorage, &keystore));
+
+    std::vector<ICDClientInfo> clientInfos;
+    ReturnErrorOnFailure(RegisterClients(manager, clientInfos));
+
+    // The next counter of each client is expected, a counter far ahead has all the clients tried
+    double expectedUs = 0;
+    double fallbackUs = 0;
+    ReturnErrorOnFailure(MeasureCheckIns(manager, clientInfos, 1, expectedUs));
+    ReturnErrorOnFailure(MeasureCheckIns(manager, clientInfos, 1000, fallbackUs));
+
+    ChipLogProgress(DataManagement, "Check-in with %u clients: %.2f us with the expected counter, %.2f us with an unexpected one",
+                    static_cast<unsigned>(clientInfos.size()), expectedUs, fallbackUs);
+    manager.Shutdown();
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    CHIP_ERROR err = RunBenchmark();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Check-in processing benchmark failed: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    Platform::MemoryShutdown();
+    return (err == CHIP_NO_ERROR) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
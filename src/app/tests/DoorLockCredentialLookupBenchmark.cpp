@@ -0,0 +1,201 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures the duplicate check of SetCredential and the user lookup of
+ *      an unlock with PIN code, scanning the credentials database against
+ *      looking up the candidates in the door lock CredentialIndex.
+ *
+ *      Usage: door-lock-credential-lookup-benchmark
+ */
+
+#include <app/clusters/door-lock-server/door-lock-credential-index.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <array>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app::Clusters::DoorLock;
+
+namespace {
+
+constexpr uint16_t kCredentials = 5000;
+constexpr size_t kLookups       = 200;
+
+/**
+ * A credentials database of 8-digit PIN codes, each owned by its own user, as a lock application would keep them.
+ */
+struct FakeDatabase
+{
+    struct Credential
+    {
+        bool occupied = false;
+        std::array<uint8_t, 8> data;
+    };
+
+    explicit FakeDatabase(uint16_t count) : credentials(count + 1), users(count + 1)
+    {
+        for (uint16_t i = 1; i <= count; i++)
+        {
+            credentials[i].occupied = true;
+            char digits[9];
+            snprintf(digits, sizeof(digits), "%08u", static_cast<unsigned>(i) * 7919u % 100000000u);
+            memcpy(credentials[i].data.data(), digits, credentials[i].data.size());
+            users[i] = i;
+        }
+    }
+
+    // Mirrors the credential loop of SetCredential without the index
+    bool IsDuplicateByScan(ByteSpan data, uint16_t excludedIndex) const
+    {
+        for (uint16_t i = 1; i < credentials.size(); i++)
+        {
+            reads++;
+            if (i != excludedIndex && credentials[i].occupied && ByteSpan(credentials[i].data).data_equal(data))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool IsDuplicateByIndex(const CredentialIndex & index, ByteSpan data, uint16_t excludedIndex) const
+    {
+        return index.ForEachCandidate(CredentialTypeEnum::kPin, data, [&](uint16_t i, uint16_t) {
+            VerifyOrReturnValue(i != excludedIndex, Loop::Continue);
+            reads++;
+            return (credentials[i].occupied && ByteSpan(credentials[i].data).data_equal(data)) ? Loop::Break : Loop::Continue;
+        }) == Loop::Break;
+    }
+
+    // Mirrors findUserIndexByCredential without the index: every user, then each of its credentials
+    uint16_t FindUserByScan(ByteSpan data) const
+    {
+        for (uint16_t user = 1; user < users.size(); user++)
+        {
+            reads += 2;
+            const uint16_t i = users[user];
+            if (credentials[i].occupied && ByteSpan(credentials[i].data).data_equal(data))
+            {
+                return user;
+            }
+        }
+        return CredentialIndex::kNoUser;
+    }
+
+    uint16_t FindUserByIndex(const CredentialIndex & index, ByteSpan data) const
+    {
+        uint16_t found = CredentialIndex::kNoUser;
+        index.ForEachCandidate(CredentialTypeEnum::kPin, data, [&](uint16_t i, uint16_t user) {
+            reads += 2;
+            VerifyOrReturnValue(credentials[i].occupied && ByteSpan(credentials[i].data).data_equal(data), Loop::Continue);
+            found = user;
+            return Loop::Break;
+        });
+        return found;
+    }
+
+    std::vector<Credential> credentials;
+    // User of the same index owns the credential at users[i]
+    std::vector<uint16_t> users;
+    mutable size_t reads = 0;
+};
+
+template <typename Lookup>
+CHIP_ERROR Measure(const char * name, FakeDatabase & database, const std::vector<std::array<uint8_t, 8>> & pins, Lookup lookup)
+{
+    database.reads = 0;
+    size_t found   = 0;
+    auto begin     = std::chrono::steady_clock::now();
+    for (const auto & pin : pins)
+    {
+        found += lookup(ByteSpan(pin)) ? 1 : 0;
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+    VerifyOrReturnError(found == kLookups / 2, CHIP_ERROR_INTERNAL);
+
+    ChipLogProgress(Zcl, "%s at %u credentials: %.2f us, %.1f database reads per lookup", name,
+                    static_cast<unsigned>(kCredentials),
+                    std::chrono::duration<double, std::micro>(elapsed).count() / static_cast<double>(kLookups),
+                    static_cast<double>(database.reads) / static_cast<double>(kLookups));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RunBenchmark()
+{
+    FakeDatabase database(kCredentials);
+    CredentialIndex index;
+    ReturnErrorOnFailure(index.Init(kCredentials));
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint16_t i = 1; i <= kCredentials; i++)
+    {
+        ReturnErrorOnFailure(index.SetCredential(CredentialTypeEnum::kPin, i, ByteSpan(database.credentials[i].data)));
+        index.SetUser(CredentialTypeEnum::kPin, i, database.users[i]);
+    }
+    const auto buildTime = std::chrono::steady_clock::now() - start;
+    ChipLogProgress(Zcl, "Credential index of %u credentials built in %.2f ms", static_cast<unsigned>(kCredentials),
+                    std::chrono::duration<double, std::milli>(buildTime).count());
+
+    // Credentials spread over the database, half of the PIN codes are unknown
+    std::vector<std::array<uint8_t, 8>> pins;
+    for (size_t i = 0; i < kLookups; i++)
+    {
+        std::array<uint8_t, 8> pin = database.credentials[1 + (i * 37) % kCredentials].data;
+        if (i % 2)
+        {
+            pin[0] = 'x';
+        }
+        pins.push_back(pin);
+    }
+
+    // SetCredential of a new slot: is the data used by any other slot?
+    ReturnErrorOnFailure(Measure("SetCredential duplicate check by scan", database, pins,
+                                 [&](ByteSpan pin) { return database.IsDuplicateByScan(pin, 0); }));
+    ReturnErrorOnFailure(Measure("SetCredential duplicate check by index", database, pins,
+                                 [&](ByteSpan pin) { return database.IsDuplicateByIndex(index, pin, 0); }));
+    // Unlock with PIN: which user owns the data?
+    ReturnErrorOnFailure(Measure("Unlock user lookup by scan", database, pins,
+                                 [&](ByteSpan pin) { return database.FindUserByScan(pin) != CredentialIndex::kNoUser; }));
+    ReturnErrorOnFailure(Measure("Unlock user lookup by index", database, pins,
+                                 [&](ByteSpan pin) { return database.FindUserByIndex(index, pin) != CredentialIndex::kNoUser; }));
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    CHIP_ERROR err = RunBenchmark();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Zcl, "Door lock credential lookup benchmark failed: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    Platform::MemoryShutdown();
+    return (err == CHIP_NO_ERROR) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,647 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      In-process throughput benchmarks for the Interaction Model.
+ *
+ *      Each scenario runs a fixed number of interactions between two nodes over the loopback
+ *      transport and logs operations per second, the number of messages sent and the peak number
+ *      of packet buffers in use. Scenarios are run against both the codegen (ember) data model
+ *      provider and the code-driven data model provider so that server-side costs of the two can
+ *      be compared. A scenario fails only if its interactions fail; timings are informational.
+ *
+ *      The scenarios reuse the loopback AppContext fixture, so they are run by the unit test framework,
+ *      but they are not part of the unit tests.
+ *
+ *      Usage: interaction-model-throughput-benchmark
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app-common/zap-generated/ids/Attributes.h>
+#include <app/AttributeValueDecoder.h>
+#include <app/AttributeValueEncoder.h>
+#include <app/CommandHandlerInterface.h>
+#include <app/CommandHandlerInterfaceRegistry.h>
+#include <app/CommandSender.h>
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <app/WriteClient.h>
+#include <app/persistence/DefaultAttributePersistenceProvider.h>
+#include <app/server-cluster/AttributeListBuilder.h>
+#include <app/server-cluster/DefaultServerCluster.h>
+#include <app/server-cluster/ServerClusterInterfaceRegistry.h>
+#include <app/tests/AppTestContext.h>
+#include <app/util/mock/Constants.h>
+#include <app/util/mock/Functions.h>
+#include <app/util/mock/MockNodeConfig.h>
+#include <data-model-providers/codedriven/CodeDrivenDataModelProvider.h>
+#include <data-model-providers/codedriven/endpoint/SpanEndpoint.h>
+#include <data-model-providers/codegen/Instance.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMemTracking.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/UnitTest.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemStats.h>
+
+#include <algorithm>
+#include <chrono>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters::Globals::Attributes;
+using namespace chip::Protocols::InteractionModel;
+
+namespace {
+
+constexpr EndpointId kBenchmarkEndpoints[]  = { 1, 2, 3, 4 };
+constexpr size_t kBenchmarkEndpointCount    = MATTER_ARRAY_SIZE(kBenchmarkEndpoints);
+constexpr ClusterId kBenchmarkClusterId     = Test::MockClusterId(0x10);
+constexpr CommandId kBenchmarkCommandId     = 1;
+constexpr uint16_t kBenchmarkAttributeCount = 16;
+
+constexpr size_t kReadIterations         = 200;
+constexpr size_t kSubscriptionIterations = 200;
+constexpr size_t kInvokeIterations       = 200;
+constexpr size_t kWriteIterations        = 100;
+
+// Commands of a batch must target distinct paths, so a batch addresses each benchmark endpoint at most once.
+constexpr size_t kCommandsPerInvoke = std::min<size_t>(kBenchmarkEndpointCount, CHIP_CONFIG_MAX_PATHS_PER_INVOKE);
+constexpr size_t kInvokesInFlight   = std::min<size_t>(4, CHIP_IM_MAX_NUM_COMMAND_HANDLER);
+
+// Leaves room for only a couple of attribute data elements per WriteRequest so that writes are chunked.
+constexpr uint16_t kWriteReservedSize = static_cast<uint16_t>(kMaxSecureSduLengthBytes - 64);
+
+// Mock attribute 4 is a large list used to exercise chunking elsewhere, so start past the
+// ids with special mock behavior.
+constexpr AttributeId BenchmarkAttributeId(uint16_t index)
+{
+    return Test::MockAttributeId(static_cast<uint16_t>(0x10 + index));
+}
+
+constexpr DataModel::AttributeEntry BenchmarkAttributeEntry(uint16_t index)
+{
+    return DataModel::AttributeEntry(BenchmarkAttributeId(index), BitMask<DataModel::AttributeQualityFlags>(),
+                                     Access::Privilege::kView, Access::Privilege::kOperate);
+}
+
+constexpr DataModel::AttributeEntry kBenchmarkAttributeEntries[kBenchmarkAttributeCount] = {
+    BenchmarkAttributeEntry(0),  BenchmarkAttributeEntry(1),  BenchmarkAttributeEntry(2),  BenchmarkAttributeEntry(3),
+    BenchmarkAttributeEntry(4),  BenchmarkAttributeEntry(5),  BenchmarkAttributeEntry(6),  BenchmarkAttributeEntry(7),
+    BenchmarkAttributeEntry(8),  BenchmarkAttributeEntry(9),  BenchmarkAttributeEntry(10), BenchmarkAttributeEntry(11),
+    BenchmarkAttributeEntry(12), BenchmarkAttributeEntry(13), BenchmarkAttributeEntry(14), BenchmarkAttributeEntry(15),
+};
+
+const Test::MockNodeConfig & BenchmarkMockNodeConfig()
+{
+    using namespace chip::Test;
+
+    auto benchmarkCluster = [] {
+        return MockClusterConfig(kBenchmarkClusterId,
+                                 {
+                                     ClusterRevision::Id,
+                                     FeatureMap::Id,
+                                     BenchmarkAttributeId(0),
+                                     BenchmarkAttributeId(1),
+                                     BenchmarkAttributeId(2),
+                                     BenchmarkAttributeId(3),
+                                     BenchmarkAttributeId(4),
+                                     BenchmarkAttributeId(5),
+                                     BenchmarkAttributeId(6),
+                                     BenchmarkAttributeId(7),
+                                     BenchmarkAttributeId(8),
+                                     BenchmarkAttributeId(9),
+                                     BenchmarkAttributeId(10),
+                                     BenchmarkAttributeId(11),
+                                     BenchmarkAttributeId(12),
+                                     BenchmarkAttributeId(13),
+                                     BenchmarkAttributeId(14),
+                                     BenchmarkAttributeId(15),
+                                 },
+                                 /* events = */ {}, /* acceptedCommands = */ { kBenchmarkCommandId });
+    };
+
+    static const MockNodeConfig config({
+        MockEndpointConfig(kBenchmarkEndpoints[0], { benchmarkCluster() }),
+        MockEndpointConfig(kBenchmarkEndpoints[1], { benchmarkCluster() }),
+        MockEndpointConfig(kBenchmarkEndpoints[2], { benchmarkCluster() }),
+        MockEndpointConfig(kBenchmarkEndpoints[3], { benchmarkCluster() }),
+    });
+    return config;
+}
+
+/// Handles the benchmark command for the codegen provider, on all endpoints.
+class BenchmarkCommandHandler : public CommandHandlerInterface
+{
+public:
+    BenchmarkCommandHandler() : CommandHandlerInterface(NullOptional, kBenchmarkClusterId) {}
+
+    void InvokeCommand(HandlerContext & handlerContext) override
+    {
+        handlerContext.mCommandHandler.AddStatus(handlerContext.mRequestPath, Status::Success);
+        handlerContext.SetCommandHandled();
+    }
+};
+
+/// Code-driven equivalent of the mock ember benchmark cluster.
+class BenchmarkServerCluster : public DefaultServerCluster
+{
+public:
+    BenchmarkServerCluster(EndpointId endpoint) : DefaultServerCluster({ endpoint, kBenchmarkClusterId }) {}
+
+    DataModel::ActionReturnStatus ReadAttribute(const DataModel::ReadAttributeRequest & request,
+                                                AttributeValueEncoder & encoder) override
+    {
+        switch (request.path.mAttributeId)
+        {
+        case ClusterRevision::Id:
+            return encoder.Encode<uint16_t>(1);
+        case FeatureMap::Id:
+            return encoder.Encode<uint32_t>(0);
+        default: {
+            uint16_t index;
+            VerifyOrReturnError(AttributeIndex(request.path.mAttributeId, index), Status::UnsupportedAttribute);
+            return encoder.Encode(mValues[index]);
+        }
+        }
+    }
+
+    DataModel::ActionReturnStatus WriteAttribute(const DataModel::WriteAttributeRequest & request,
+                                                 AttributeValueDecoder & decoder) override
+    {
+        uint16_t index;
+        VerifyOrReturnError(AttributeIndex(request.path.mAttributeId, index), Status::UnsupportedAttribute);
+        ReturnErrorOnFailure(decoder.Decode(mValues[index]));
+        NotifyAttributeChanged(request.path.mAttributeId);
+        return Status::Success;
+    }
+
+    CHIP_ERROR Attributes(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<DataModel::AttributeEntry> & builder) override
+    {
+        AttributeListBuilder listBuilder(builder);
+        return listBuilder.Append(Span(kBenchmarkAttributeEntries), {});
+    }
+
+    CHIP_ERROR AcceptedCommands(const ConcreteClusterPath & path,
+                                ReadOnlyBufferBuilder<DataModel::AcceptedCommandEntry> & builder) override
+    {
+        ReturnErrorOnFailure(builder.EnsureAppendCapacity(1));
+        return builder.Append(DataModel::AcceptedCommandEntry(kBenchmarkCommandId));
+    }
+
+    std::optional<DataModel::ActionReturnStatus> InvokeCommand(const DataModel::InvokeRequest & request,
+                                                               TLV::TLVReader & input_arguments, CommandHandler * handler) override
+    {
+        return Status::Success;
+    }
+
+private:
+    static bool AttributeIndex(AttributeId attributeId, uint16_t & index)
+    {
+        VerifyOrReturnValue(attributeId >= BenchmarkAttributeId(0) &&
+                                attributeId < BenchmarkAttributeId(kBenchmarkAttributeCount),
+                            false);
+        index = static_cast<uint16_t>(attributeId - BenchmarkAttributeId(0));
+        return true;
+    }
+
+    uint32_t mValues[kBenchmarkAttributeCount] = {};
+};
+
+#if CHIP_CONFIG_MEMORY_TRACKING
+uint64_t TotalAllocationCount()
+{
+    uint64_t count = 0;
+    for (size_t i = 0; i < Platform::kMemoryTagCount; i++)
+    {
+        count += Platform::GetMemoryTagStats(static_cast<Platform::MemoryTag>(i)).allocationCount;
+    }
+    return count;
+}
+#endif // CHIP_CONFIG_MEMORY_TRACKING
+
+/// Counts the work done by a single benchmark scenario and logs it.
+class ThroughputMeter
+{
+public:
+    ThroughputMeter(const char * scenario, const char * provider) : mScenario(scenario), mProvider(provider)
+    {
+        mSentMessagesAtStart = chip::Test::AppContext::GetLoopback().mSentMessageCount;
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+        SYSTEM_STATS_RESET_HIGH_WATER_MARK_FOR_TESTING(System::Stats::kSystemLayer_NumPacketBufs);
+#endif
+#if CHIP_CONFIG_MEMORY_TRACKING
+        Platform::ResetMemoryTagPeaks();
+        mAllocationsAtStart = TotalAllocationCount();
+#endif
+        mStart = std::chrono::steady_clock::now();
+    }
+
+    void Report(size_t operations) const
+    {
+        auto elapsed   = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - mStart);
+        auto elapsedUs = static_cast<unsigned long long>(std::max<decltype(elapsed.count())>(elapsed.count(), 1));
+        auto messages  = chip::Test::AppContext::GetLoopback().mSentMessageCount - mSentMessagesAtStart;
+
+        long long peakPacketBuffers = -1;
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+        peakPacketBuffers = System::Stats::GetHighWatermarks()[System::Stats::kSystemLayer_NumPacketBufs];
+#endif
+
+        ChipLogProgress(Test, "%s [%s]: %u ops in %llu us, %llu ops/s, %u messages, peak packet buffers %lld", mScenario,
+                        mProvider, static_cast<unsigned>(operations), elapsedUs, operations * 1000000ull / elapsedUs,
+                        static_cast<unsigned>(messages), peakPacketBuffers);
+
+#if CHIP_CONFIG_MEMORY_TRACKING
+        const uint64_t allocations = TotalAllocationCount() - mAllocationsAtStart;
+        ChipLogProgress(Test, "%s [%s]: %llu heap allocations, %llu per op, peak %lu bytes for reporting, %lu bytes for IM",
+                        mScenario, mProvider, static_cast<unsigned long long>(allocations),
+                        static_cast<unsigned long long>(allocations / std::max<size_t>(operations, 1)),
+                        static_cast<unsigned long>(Platform::GetMemoryTagStats(Platform::MemoryTag::kReporting).peakBytes),
+                        static_cast<unsigned long>(Platform::GetMemoryTagStats(Platform::MemoryTag::kInteractionModel).peakBytes));
+#endif
+    }
+
+private:
+    const char * mScenario;
+    const char * mProvider;
+    uint32_t mSentMessagesAtStart;
+#if CHIP_CONFIG_MEMORY_TRACKING
+    uint64_t mAllocationsAtStart;
+#endif
+    std::chrono::steady_clock::time_point mStart;
+};
+
+class BenchmarkReadCallback : public ReadClient::Callback
+{
+public:
+    void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override
+    {
+        if (aStatus.IsSuccess())
+        {
+            mAttributeCount++;
+        }
+        else
+        {
+            mErrorCount++;
+        }
+    }
+
+    void OnReportEnd() override { mReportCount++; }
+    void OnError(CHIP_ERROR aError) override { mErrorCount++; }
+    void OnDone(ReadClient * apReadClient) override { mDoneCount++; }
+
+    size_t mAttributeCount = 0;
+    size_t mReportCount    = 0;
+    size_t mErrorCount     = 0;
+    size_t mDoneCount      = 0;
+};
+
+class BenchmarkCommandCallback : public CommandSender::ExtendableCallback
+{
+public:
+    void OnResponse(CommandSender * apCommandSender, const CommandSender::ResponseData & aResponseData) override
+    {
+        if (aResponseData.statusIB.IsSuccess())
+        {
+            mSuccessCount++;
+        }
+        else
+        {
+            mErrorCount++;
+        }
+    }
+
+    void OnError(const CommandSender * apCommandSender, const CommandSender::ErrorData & aErrorData) override { mErrorCount++; }
+    void OnDone(CommandSender * apCommandSender) override { mDoneCount++; }
+
+    size_t mSuccessCount = 0;
+    size_t mErrorCount   = 0;
+    size_t mDoneCount    = 0;
+};
+
+class BenchmarkWriteCallback : public WriteClient::Callback
+{
+public:
+    void OnResponse(const WriteClient * apWriteClient, const ConcreteDataAttributePath & aPath, StatusIB aStatus) override
+    {
+        if (aStatus.IsSuccess())
+        {
+            mSuccessCount++;
+        }
+        else
+        {
+            mErrorCount++;
+        }
+    }
+
+    void OnError(const WriteClient * apWriteClient, CHIP_ERROR aError) override { mErrorCount++; }
+    void OnDone(WriteClient * apWriteClient) override { mDoneCount++; }
+
+    size_t mSuccessCount = 0;
+    size_t mErrorCount   = 0;
+    size_t mDoneCount    = 0;
+};
+
+} // namespace
+
+class InteractionModelThroughputBenchmark : public Test::AppContext
+{
+protected:
+    void SetUp() override
+    {
+        AppContext::SetUp();
+        mOldProvider = InteractionModelEngine::GetInstance()->GetDataModelProvider();
+    }
+
+    void TearDown() override
+    {
+        InteractionModelEngine::GetInstance()->SetDataModelProvider(mOldProvider);
+        if (mUsingCodegen)
+        {
+            EXPECT_EQ(CommandHandlerInterfaceRegistry::Instance().UnregisterCommandHandler(&mCommandHandler), CHIP_NO_ERROR);
+            chip::Test::ResetMockNodeConfig();
+        }
+        AppContext::TearDown();
+    }
+
+    void UseCodegenProvider()
+    {
+        chip::Test::SetMockNodeConfig(BenchmarkMockNodeConfig());
+        ASSERT_EQ(CommandHandlerInterfaceRegistry::Instance().RegisterCommandHandler(&mCommandHandler), CHIP_NO_ERROR);
+        mUsingCodegen = true;
+        InteractionModelEngine::GetInstance()->SetDataModelProvider(CodegenDataModelProviderInstance(&mStorage));
+    }
+
+    void UseCodeDrivenProvider()
+    {
+        ASSERT_EQ(mAttributePersistence.Init(&mStorage), CHIP_NO_ERROR);
+        for (auto & registration : mClusterRegistrations)
+        {
+            ASSERT_EQ(mCodeDrivenProvider.AddCluster(registration), CHIP_NO_ERROR);
+        }
+        for (auto & registration : mEndpointRegistrations)
+        {
+            ASSERT_EQ(mCodeDrivenProvider.AddEndpoint(registration), CHIP_NO_ERROR);
+        }
+        InteractionModelEngine::GetInstance()->SetDataModelProvider(&mCodeDrivenProvider);
+    }
+
+    void RunWildcardReads(const char * provider);
+    void RunSubscriptionReports(const char * provider, size_t dirtyAttributes);
+    void RunBatchedInvokes(const char * provider);
+    void RunChunkedWrites(const char * provider);
+
+private:
+    DataModel::Provider * mOldProvider = nullptr;
+    bool mUsingCodegen                 = false;
+
+    TestPersistentStorageDelegate mStorage;
+    BenchmarkCommandHandler mCommandHandler;
+
+    DefaultAttributePersistenceProvider mAttributePersistence;
+    CodeDrivenDataModelProvider mCodeDrivenProvider{ mStorage, mAttributePersistence };
+    BenchmarkServerCluster mClusters[kBenchmarkEndpointCount] = { kBenchmarkEndpoints[0], kBenchmarkEndpoints[1],
+                                                                  kBenchmarkEndpoints[2], kBenchmarkEndpoints[3] };
+    ServerClusterRegistration mClusterRegistrations[kBenchmarkEndpointCount] = { mClusters[0], mClusters[1], mClusters[2],
+                                                                                 mClusters[3] };
+    SpanEndpoint mEndpoint = SpanEndpoint::Builder().Build();
+    EndpointInterfaceRegistration mEndpointRegistrations[kBenchmarkEndpointCount] = {
+        { mEndpoint, { kBenchmarkEndpoints[0], kInvalidEndpointId, DataModel::EndpointCompositionPattern::kFullFamily } },
+        { mEndpoint, { kBenchmarkEndpoints[1], kInvalidEndpointId, DataModel::EndpointCompositionPattern::kFullFamily } },
+        { mEndpoint, { kBenchmarkEndpoints[2], kInvalidEndpointId, DataModel::EndpointCompositionPattern::kFullFamily } },
+        { mEndpoint, { kBenchmarkEndpoints[3], kInvalidEndpointId, DataModel::EndpointCompositionPattern::kFullFamily } },
+    };
+};
+
+void InteractionModelThroughputBenchmark::RunWildcardReads(const char * provider)
+{
+    BenchmarkReadCallback callback;
+    AttributePathParams wildcardPath;
+
+    ThroughputMeter meter("Wildcard read", provider);
+    for (size_t i = 0; i < kReadIterations; i++)
+    {
+        ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+        readPrepareParams.mpAttributePathParamsList    = &wildcardPath;
+        readPrepareParams.mAttributePathParamsListSize = 1;
+
+        ReadClient readClient(InteractionModelEngine::GetInstance(), &GetExchangeManager(), callback,
+                              ReadClient::InteractionType::Read);
+        ASSERT_EQ(readClient.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+        DrainAndServiceIO();
+    }
+    meter.Report(kReadIterations);
+
+    EXPECT_EQ(callback.mErrorCount, 0u);
+    EXPECT_EQ(callback.mDoneCount, kReadIterations);
+    // Each endpoint reports the 16 benchmark attributes plus at least the 5 global attributes.
+    EXPECT_GE(callback.mAttributeCount, kReadIterations * kBenchmarkEndpointCount * (kBenchmarkAttributeCount + 5));
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+void InteractionModelThroughputBenchmark::RunSubscriptionReports(const char * provider, size_t dirtyAttributes)
+{
+    auto * engine = InteractionModelEngine::GetInstance();
+    BenchmarkReadCallback callback;
+
+    {
+        AttributePathParams clusterPath;
+        clusterPath.mClusterId = kBenchmarkClusterId;
+
+        ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+        readPrepareParams.mpAttributePathParamsList    = &clusterPath;
+        readPrepareParams.mAttributePathParamsListSize = 1;
+        readPrepareParams.mMinIntervalFloorSeconds     = 0;
+        readPrepareParams.mMaxIntervalCeilingSeconds   = 60;
+
+        ReadClient readClient(engine, &GetExchangeManager(), callback, ReadClient::InteractionType::Subscribe);
+        ASSERT_EQ(readClient.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+        DrainAndServiceIO();
+        ASSERT_EQ(callback.mReportCount, 1u);
+        ASSERT_EQ(engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe), 1u);
+
+        callback.mAttributeCount = 0;
+        callback.mReportCount    = 0;
+
+        char scenario[48];
+        snprintf(scenario, sizeof(scenario), "Subscription report, %u dirty", static_cast<unsigned>(dirtyAttributes));
+
+        ThroughputMeter meter(scenario, provider);
+        size_t nextAttribute = 0;
+        for (size_t i = 0; i < kSubscriptionIterations; i++)
+        {
+            for (size_t j = 0; j < dirtyAttributes; j++, nextAttribute++)
+            {
+                size_t attribute = nextAttribute % (kBenchmarkEndpointCount * kBenchmarkAttributeCount);
+                AttributePathParams dirtyPath(kBenchmarkEndpoints[attribute % kBenchmarkEndpointCount], kBenchmarkClusterId,
+                                              BenchmarkAttributeId(static_cast<uint16_t>(attribute / kBenchmarkEndpointCount)));
+                ASSERT_EQ(engine->GetReportingEngine().SetDirty(dirtyPath), CHIP_NO_ERROR);
+            }
+            DrainAndServiceIO();
+        }
+        meter.Report(kSubscriptionIterations);
+
+        EXPECT_EQ(callback.mReportCount, kSubscriptionIterations);
+        EXPECT_EQ(callback.mAttributeCount, kSubscriptionIterations * dirtyAttributes);
+    }
+
+    // Dropping the ReadClient does not tell the publisher, so tear down the handler explicitly.
+    engine->ShutdownAllSubscriptionHandlers();
+    DrainAndServiceIO();
+    EXPECT_EQ(callback.mErrorCount, 0u);
+    EXPECT_EQ(engine->GetNumActiveReadHandlers(), 0u);
+}
+
+void InteractionModelThroughputBenchmark::RunBatchedInvokes(const char * provider)
+{
+    BenchmarkCommandCallback callback;
+
+    ThroughputMeter meter("Batched invoke", provider);
+    for (size_t i = 0; i < kInvokeIterations; i += kInvokesInFlight)
+    {
+        // CommandSender needs a stable address until OnDone, so keep a full batch of them alive.
+        std::optional<CommandSender> senders[kInvokesInFlight];
+        for (auto & sender : senders)
+        {
+            sender.emplace(&callback, &GetExchangeManager());
+            if (kCommandsPerInvoke > 1)
+            {
+                CommandSender::ConfigParameters config;
+                config.SetRemoteMaxPathsPerInvoke(static_cast<uint16_t>(kCommandsPerInvoke));
+                ASSERT_EQ(sender->SetCommandSenderConfig(config), CHIP_NO_ERROR);
+            }
+
+            for (size_t command = 0; command < kCommandsPerInvoke; command++)
+            {
+                CommandPathParams commandPath(kBenchmarkEndpoints[command], /* group = */ 0, kBenchmarkClusterId,
+                                              kBenchmarkCommandId, CommandPathFlags::kEndpointIdValid);
+
+                CommandSender::PrepareCommandParameters prepareParams;
+                CommandSender::FinishCommandParameters finishParams;
+                prepareParams.SetStartDataStruct(true);
+                finishParams.SetEndDataStruct(true);
+                if (kCommandsPerInvoke > 1)
+                {
+                    prepareParams.SetCommandRef(static_cast<uint16_t>(command));
+                    finishParams.SetCommandRef(static_cast<uint16_t>(command));
+                }
+
+                ASSERT_EQ(sender->PrepareCommand(commandPath, prepareParams), CHIP_NO_ERROR);
+                ASSERT_EQ(sender->FinishCommand(finishParams), CHIP_NO_ERROR);
+            }
+            ASSERT_EQ(sender->SendCommandRequest(GetSessionBobToAlice()), CHIP_NO_ERROR);
+        }
+        DrainAndServiceIO();
+    }
+
+    size_t invokes = (kInvokeIterations + kInvokesInFlight - 1) / kInvokesInFlight * kInvokesInFlight;
+    meter.Report(invokes * kCommandsPerInvoke);
+
+    EXPECT_EQ(callback.mErrorCount, 0u);
+    EXPECT_EQ(callback.mDoneCount, invokes);
+    EXPECT_EQ(callback.mSuccessCount, invokes * kCommandsPerInvoke);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+void InteractionModelThroughputBenchmark::RunChunkedWrites(const char * provider)
+{
+    BenchmarkWriteCallback callback;
+    constexpr size_t kAttributesPerWrite = kBenchmarkAttributeCount;
+
+    ThroughputMeter meter("Chunked write", provider);
+    for (size_t i = 0; i < kWriteIterations; i++)
+    {
+        WriteClient writeClient(&GetExchangeManager(), &callback, NullOptional, kWriteReservedSize);
+        for (uint16_t attribute = 0; attribute < kAttributesPerWrite; attribute++)
+        {
+            AttributePathParams path(kBenchmarkEndpoints[i % kBenchmarkEndpointCount], kBenchmarkClusterId,
+                                     BenchmarkAttributeId(attribute));
+            ASSERT_EQ(writeClient.EncodeAttribute(path, static_cast<uint32_t>(i + attribute)), CHIP_NO_ERROR);
+        }
+        ASSERT_TRUE(writeClient.IsWriteRequestChunked());
+        ASSERT_EQ(writeClient.SendWriteRequest(GetSessionBobToAlice()), CHIP_NO_ERROR);
+        DrainAndServiceIO();
+    }
+    meter.Report(kWriteIterations * kAttributesPerWrite);
+
+    EXPECT_EQ(callback.mErrorCount, 0u);
+    EXPECT_EQ(callback.mDoneCount, kWriteIterations);
+    EXPECT_EQ(callback.mSuccessCount, kWriteIterations * kAttributesPerWrite);
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->GetNumActiveWriteHandlers(), 0u);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+TEST_F(InteractionModelThroughputBenchmark, WildcardReadCodegen)
+{
+    UseCodegenProvider();
+    RunWildcardReads("codegen");
+}
+
+TEST_F(InteractionModelThroughputBenchmark, WildcardReadCodeDriven)
+{
+    UseCodeDrivenProvider();
+    RunWildcardReads("code-driven");
+}
+
+TEST_F(InteractionModelThroughputBenchmark, SubscriptionReportCodegen)
+{
+    UseCodegenProvider();
+    RunSubscriptionReports("codegen", 1);
+    RunSubscriptionReports("codegen", kBenchmarkAttributeCount);
+    RunSubscriptionReports("codegen", kBenchmarkEndpointCount * kBenchmarkAttributeCount);
+}
+
+TEST_F(InteractionModelThroughputBenchmark, SubscriptionReportCodeDriven)
+{
+    UseCodeDrivenProvider();
+    RunSubscriptionReports("code-driven", 1);
+    RunSubscriptionReports("code-driven", kBenchmarkAttributeCount);
+    RunSubscriptionReports("code-driven", kBenchmarkEndpointCount * kBenchmarkAttributeCount);
+}
+
+TEST_F(InteractionModelThroughputBenchmark, BatchedInvokeCodegen)
+{
+    UseCodegenProvider();
+    RunBatchedInvokes("codegen");
+}
+
+TEST_F(InteractionModelThroughputBenchmark, BatchedInvokeCodeDriven)
+{
+    UseCodeDrivenProvider();
+    RunBatchedInvokes("code-driven");
+}
+
+TEST_F(InteractionModelThroughputBenchmark, ChunkedWriteCodegen)
+{
+    UseCodegenProvider();
+    RunChunkedWrites("codegen");
+}
+
+TEST_F(InteractionModelThroughputBenchmark, ChunkedWriteCodeDriven)
+{
+    UseCodeDrivenProvider();
+    RunChunkedWrites("code-driven");
+}
+
+int main()
+{
+    return chip::test::RunAllTests();
+}
@@ -0,0 +1,124 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures the latency of scene recalls from the scene table, loading
+ *      the scene from storage against reading it through the scene cache,
+ *      for several numbers of scenes in the fabric.
+ *
+ *      Usage: scene-recall-benchmark
+ */
+
+#include <app/clusters/scenes-server/SceneTableImpl.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <chrono>
+#include <stdlib.h>
+#include <vector>
+
+using namespace chip;
+
+using SceneTableImpl  = scenes::DefaultSceneTableImpl;
+using SceneTableEntry = SceneTableImpl::SceneTableEntry;
+using SceneStorageId  = SceneTableImpl::SceneStorageId;
+using SceneData       = SceneTableImpl::SceneData;
+
+namespace {
+
+constexpr EndpointId kEndpoint = 1;
+constexpr FabricIndex kFabric  = 1;
+constexpr GroupId kGroup       = 0x101;
+constexpr size_t kTableSizes[] = { 1, 4, scenes::kMaxScenesPerFabric };
+constexpr size_t kRecallRounds = 200;
+
+// Returns the average recall time in microseconds, dropping the cached scenes before each recall if `fromStorage`.
+CHIP_ERROR RecallAll(SceneTableImpl & sceneTable, PersistentStorageDelegate & storage, const std::vector<SceneTableEntry> & scenes,
+                     bool fromStorage, double & recallUs)
+{
+    SceneTableEntry scene;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t round = 0; round < kRecallRounds; round++)
+    {
+        for (const SceneTableEntry & entry : scenes)
+        {
+            if (fromStorage)
+            {
+                // Init() drops the cached scenes
+                ReturnErrorOnFailure(sceneTable.Init(storage));
+            }
+            ReturnErrorOnFailure(sceneTable.GetSceneTableEntry(kFabric, entry.mStorageId, scene));
+        }
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    recallUs = std::chrono::duration<double, std::micro>(elapsed).count() / static_cast<double>(kRecallRounds * scenes.size());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RunRecalls(size_t tableSize)
+{
+    TestPersistentStorageDelegate storage;
+    SceneTableImpl sceneTable;
+    ReturnErrorOnFailure(sceneTable.Init(storage));
+    sceneTable.SetEndpoint(kEndpoint);
+
+    std::vector<SceneTableEntry> scenes;
+    for (size_t i = 0; i < tableSize; i++)
+    {
+        scenes.emplace_back(SceneStorageId(static_cast<SceneId>(i + 1), kGroup), SceneData("Scene"_span, 1000));
+        ReturnErrorOnFailure(sceneTable.SetSceneTableEntry(kFabric, scenes.back()));
+    }
+
+    double fromStorageUs = 0;
+    double cachedUs      = 0;
+    ReturnErrorOnFailure(RecallAll(sceneTable, storage, scenes, true, fromStorageUs));
+    ReturnErrorOnFailure(RecallAll(sceneTable, storage, scenes, false, cachedUs));
+    ChipLogProgress(Zcl, "Scene recall with %u scenes in the fabric: %.2f us from storage, %.2f us through the cache",
+                    static_cast<unsigned>(tableSize), fromStorageUs, cachedUs);
+
+    ReturnErrorOnFailure(sceneTable.RemoveFabric(kFabric));
+    sceneTable.Finish();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RunBenchmark()
+{
+    for (size_t tableSize : kTableSizes)
+    {
+        ReturnErrorOnFailure(RunRecalls(tableSize));
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    CHIP_ERROR err = RunBenchmark();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Zcl, "Scene recall benchmark failed: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    Platform::MemoryShutdown();
+    return (err == CHIP_NO_ERROR) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
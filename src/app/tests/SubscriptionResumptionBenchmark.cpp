@@ -0,0 +1,188 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Compares the save/restore cost and the storage write count of
+ *      BatchedSubscriptionResumptionStorage against
+ *      SimpleSubscriptionResumptionStorage, for subscription churn well
+ *      above the resident capacity.
+ *
+ *      Usage: subscription-resumption-benchmark
+ */
+
+#include <app/BatchedSubscriptionResumptionStorage.h>
+#include <app/SimpleSubscriptionResumptionStorage.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+#include <inttypes.h>
+#include <stdlib.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+using SubscriptionInfo = SubscriptionResumptionStorage::SubscriptionInfo;
+
+constexpr size_t kSubscriptionSaves = 128;
+constexpr size_t kAttributePaths    = 3;
+
+class CountingStorageDelegate : public TestPersistentStorageDelegate
+{
+public:
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override
+    {
+        mWriteCount++;
+        return TestPersistentStorageDelegate::SyncSetKeyValue(key, value, size);
+    }
+
+    size_t mWriteCount = 0;
+};
+
+struct Result
+{
+    uint64_t saveUs    = 0;
+    uint64_t restoreUs = 0;
+    size_t writeCount  = 0;
+};
+
+uint64_t NowUs()
+{
+    return System::SystemClock().GetMonotonicMicroseconds64().count();
+}
+
+void FillPaths(SubscriptionInfo & info, size_t attributePathCount, size_t eventPathCount)
+{
+    info.mAttributePaths.Calloc(attributePathCount);
+    for (size_t i = 0; i < attributePathCount; i++)
+    {
+        info.mAttributePaths[i].mEndpointId  = static_cast<EndpointId>(1 + i % 4);
+        info.mAttributePaths[i].mClusterId   = static_cast<ClusterId>(0x0006 + i);
+        info.mAttributePaths[i].mAttributeId = static_cast<AttributeId>(i);
+    }
+    info.mEventPaths.Calloc(eventPathCount);
+    for (size_t i = 0; i < eventPathCount; i++)
+    {
+        info.mEventPaths[i].mEndpointId    = 0;
+        info.mEventPaths[i].mClusterId     = static_cast<ClusterId>(0x0028 + i);
+        info.mEventPaths[i].mEventId       = static_cast<EventId>(i);
+        info.mEventPaths[i].mIsUrgentEvent = (i % 2) == 0;
+    }
+}
+
+size_t CountSubscriptions(SubscriptionResumptionStorage & storage)
+{
+    SubscriptionInfo info;
+    size_t count  = 0;
+    auto iterator = storage.IterateSubscriptions();
+    while (iterator->Next(info))
+    {
+        count++;
+    }
+    iterator->Release();
+    return count;
+}
+
+CHIP_ERROR RunChurn(SubscriptionResumptionStorage & storage)
+{
+    SubscriptionInfo info = { .mNodeId = 5555, .mFabricIndex = 1, .mMinInterval = 1, .mMaxInterval = 60 };
+    for (size_t i = 0; i < kSubscriptionSaves; i++)
+    {
+        // Keep the resident set at capacity by recycling subscription IDs.
+        info.mSubscriptionId = static_cast<SubscriptionId>(i % CHIP_IM_MAX_NUM_SUBSCRIPTIONS);
+        FillPaths(info, kAttributePaths, 1);
+        ReturnErrorOnFailure(storage.Save(info));
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RunSimple(Result & result)
+{
+    CountingStorageDelegate kvs;
+    SimpleSubscriptionResumptionStorage storage;
+    ReturnErrorOnFailure(storage.Init(&kvs));
+
+    uint64_t start = NowUs();
+    ReturnErrorOnFailure(RunChurn(storage));
+    uint64_t saved = NowUs();
+    VerifyOrReturnError(CountSubscriptions(storage) == CHIP_IM_MAX_NUM_SUBSCRIPTIONS, CHIP_ERROR_INTERNAL);
+
+    result.saveUs     = saved - start;
+    result.restoreUs  = NowUs() - saved;
+    result.writeCount = kvs.mWriteCount;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RunBatched(Result & result)
+{
+    CountingStorageDelegate kvs;
+    BatchedSubscriptionResumptionStorage storage;
+    ReturnErrorOnFailure(storage.Init(&kvs));
+
+    uint64_t start = NowUs();
+    ReturnErrorOnFailure(RunChurn(storage));
+    result.saveUs = NowUs() - start;
+
+    // Restore includes loading the record from storage, as after a reboot.
+    BatchedSubscriptionResumptionStorage restoredStorage;
+    start = NowUs();
+    ReturnErrorOnFailure(restoredStorage.Init(&kvs));
+    VerifyOrReturnError(CountSubscriptions(restoredStorage) == CHIP_IM_MAX_NUM_SUBSCRIPTIONS, CHIP_ERROR_INTERNAL);
+    result.restoreUs  = NowUs() - start;
+    result.writeCount = kvs.mWriteCount;
+    return CHIP_NO_ERROR;
+}
+
+void LogResult(const char * name, const Result & result)
+{
+    ChipLogProgress(DataManagement, "Subscription resumption, %u saves: %s save %" PRIu64 "us restore %" PRIu64 "us writes %u",
+                    static_cast<unsigned>(kSubscriptionSaves), name, result.saveUs, result.restoreUs,
+                    static_cast<unsigned>(result.writeCount));
+}
+
+CHIP_ERROR RunBenchmark()
+{
+    Result simple;
+    ReturnErrorOnFailure(RunSimple(simple));
+    LogResult("simple", simple);
+
+    Result batched;
+    ReturnErrorOnFailure(RunBatched(batched));
+    LogResult("batched", batched);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    CHIP_ERROR err = RunBenchmark();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Subscription resumption benchmark failed: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    Platform::MemoryShutdown();
+    return (err == CHIP_NO_ERROR) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,342 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/BatchedSubscriptionResumptionStorage.h>
+#include <app/SimpleSubscriptionResumptionStorage.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <pw_unit_test/framework.h>
+
+namespace {
+
+using chip::app::BatchedSubscriptionResumptionStorage;
+using chip::app::SimpleSubscriptionResumptionStorage;
+using SubscriptionInfo = chip::app::SubscriptionResumptionStorage::SubscriptionInfo;
+
+class TestBatchedSubscriptionResumptionStorage : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+void FillPaths(SubscriptionInfo & info, size_t attributePathCount, size_t eventPathCount)
+{
+    info.mAttributePaths.Free();
+    info.mEventPaths.Free();
+    if (attributePathCount > 0)
+    {
+        info.mAttributePaths.Calloc(attributePathCount);
+        for (size_t i = 0; i < attributePathCount; i++)
+        {
+            info.mAttributePaths[i].mEndpointId  = static_cast<chip::EndpointId>(1 + i % 4);
+            info.mAttributePaths[i].mClusterId   = static_cast<chip::ClusterId>(0x0006 + i);
+            info.mAttributePaths[i].mAttributeId = static_cast<chip::AttributeId>(i);
+        }
+    }
+    if (eventPathCount > 0)
+    {
+        info.mEventPaths.Calloc(eventPathCount);
+        for (size_t i = 0; i < eventPathCount; i++)
+        {
+            info.mEventPaths[i].mEndpointId    = 0;
+            info.mEventPaths[i].mClusterId     = static_cast<chip::ClusterId>(0x0028 + i);
+            info.mEventPaths[i].mEventId       = static_cast<chip::EventId>(i);
+            info.mEventPaths[i].mIsUrgentEvent = (i % 2) == 0;
+        }
+    }
+}
+
+bool SamePaths(const SubscriptionInfo & a, const SubscriptionInfo & b)
+{
+    if ((a.mAttributePaths.AllocatedSize() != b.mAttributePaths.AllocatedSize()) ||
+        (a.mEventPaths.AllocatedSize() != b.mEventPaths.AllocatedSize()))
+    {
+        return false;
+    }
+    for (size_t i = 0; i < a.mAttributePaths.AllocatedSize(); i++)
+    {
+        if ((a.mAttributePaths[i].mEndpointId != b.mAttributePaths[i].mEndpointId) ||
+            (a.mAttributePaths[i].mClusterId != b.mAttributePaths[i].mClusterId) ||
+            (a.mAttributePaths[i].mAttributeId != b.mAttributePaths[i].mAttributeId))
+        {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < a.mEventPaths.AllocatedSize(); i++)
+    {
+        if ((a.mEventPaths[i].mEndpointId != b.mEventPaths[i].mEndpointId) ||
+            (a.mEventPaths[i].mClusterId != b.mEventPaths[i].mClusterId) ||
+            (a.mEventPaths[i].mEventId != b.mEventPaths[i].mEventId) ||
+            (a.mEventPaths[i].mIsUrgentEvent != b.mEventPaths[i].mIsUrgentEvent))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t CountSubscriptions(chip::app::SubscriptionResumptionStorage & storage)
+{
+    SubscriptionInfo info;
+    size_t count  = 0;
+    auto iterator = storage.IterateSubscriptions();
+    while (iterator->Next(info))
+    {
+        count++;
+    }
+    iterator->Release();
+    return count;
+}
+
+TEST_F(TestBatchedSubscriptionResumptionStorage, TestSaveRestoreRoundTrip)
+{
+    chip::TestPersistentStorageDelegate storage;
+
+    SubscriptionInfo saved = {
+        .mNodeId         = 1111,
+        .mFabricIndex    = 41,
+        .mSubscriptionId = 7,
+        .mMinInterval    = 1,
+        .mMaxInterval    = 11,
+        .mFabricFiltered = true,
+    };
+    FillPaths(saved, 3, 2);
+
+    {
+        BatchedSubscriptionResumptionStorage subscriptionStorage;
+        EXPECT_EQ(subscriptionStorage.Init(&storage), CHIP_NO_ERROR);
+        EXPECT_EQ(subscriptionStorage.Save(saved), CHIP_NO_ERROR);
+    }
+
+    // Only the single batched record is written.
+    EXPECT_EQ(storage.GetNumKeys(), 1u);
+    EXPECT_TRUE(storage.HasKey(chip::DefaultStorageKeyAllocator::SubscriptionResumptionBatch().KeyName()));
+
+    BatchedSubscriptionResumptionStorage restoredStorage;
+    EXPECT_EQ(restoredStorage.Init(&storage), CHIP_NO_ERROR);
+
+    SubscriptionInfo restored;
+    auto iterator = restoredStorage.IterateSubscriptions();
+    EXPECT_EQ(iterator->Count(), 1u);
+    ASSERT_TRUE(iterator->Next(restored));
+    EXPECT_FALSE(iterator->Next(restored));
+    iterator->Release();
+
+    EXPECT_EQ(restored.mNodeId, saved.mNodeId);
+    EXPECT_EQ(restored.mFabricIndex, saved.mFabricIndex);
+    EXPECT_EQ(restored.mSubscriptionId, saved.mSubscriptionId);
+    EXPECT_EQ(restored.mMinInterval, saved.mMinInterval);
+    EXPECT_EQ(restored.mMaxInterval, saved.mMaxInterval);
+    EXPECT_EQ(restored.mFabricFiltered, saved.mFabricFiltered);
+    EXPECT_TRUE(SamePaths(restored, saved));
+}
+
+TEST_F(TestBatchedSubscriptionResumptionStorage, TestPathSetsAreShared)
+{
+    chip::TestPersistentStorageDelegate storage;
+    BatchedSubscriptionResumptionStorage subscriptionStorage;
+    EXPECT_EQ(subscriptionStorage.Init(&storage), CHIP_NO_ERROR);
+
+    SubscriptionInfo info = { .mNodeId = 2222, .mFabricIndex = 1 };
+    FillPaths(info, 4, 1);
+    for (chip::SubscriptionId id = 0; id < 5; id++)
+    {
+        info.mSubscriptionId = id;
+        EXPECT_EQ(subscriptionStorage.Save(info), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(subscriptionStorage.AttributePathSetCount(), 1u);
+    EXPECT_EQ(subscriptionStorage.EventPathSetCount(), 1u);
+
+    // A different path list allocates a second set.
+    info.mSubscriptionId = 5;
+    FillPaths(info, 2, 0);
+    EXPECT_EQ(subscriptionStorage.Save(info), CHIP_NO_ERROR);
+    EXPECT_EQ(subscriptionStorage.AttributePathSetCount(), 2u);
+    EXPECT_EQ(subscriptionStorage.EventPathSetCount(), 1u);
+
+    // Re-saving with the shared list releases the private one.
+    FillPaths(info, 4, 1);
+    EXPECT_EQ(subscriptionStorage.Save(info), CHIP_NO_ERROR);
+    EXPECT_EQ(subscriptionStorage.AttributePathSetCount(), 1u);
+    EXPECT_EQ(CountSubscriptions(subscriptionStorage), 6u);
+
+    // Sharing survives a reload.
+    BatchedSubscriptionResumptionStorage restoredStorage;
+    EXPECT_EQ(restoredStorage.Init(&storage), CHIP_NO_ERROR);
+    EXPECT_EQ(CountSubscriptions(restoredStorage), 6u);
+    EXPECT_EQ(restoredStorage.AttributePathSetCount(), 1u);
+    EXPECT_EQ(restoredStorage.EventPathSetCount(), 1u);
+
+    EXPECT_EQ(restoredStorage.DeleteAll(1), CHIP_NO_ERROR);
+    EXPECT_EQ(restoredStorage.AttributePathSetCount(), 0u);
+    EXPECT_EQ(restoredStorage.EventPathSetCount(), 0u);
+    EXPECT_EQ(storage.GetNumKeys(), 0u);
+}
+
+TEST_F(TestBatchedSubscriptionResumptionStorage, TestDeleteAndCapacity)
+{
+    chip::TestPersistentStorageDelegate storage;
+    BatchedSubscriptionResumptionStorage subscriptionStorage;
+    EXPECT_EQ(subscriptionStorage.Init(&storage), CHIP_NO_ERROR);
+
+    SubscriptionInfo info = { .mNodeId = 3333, .mFabricIndex = 46 };
+    for (size_t i = 0; i < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; i++)
+    {
+        info.mSubscriptionId = static_cast<chip::SubscriptionId>(i);
+        EXPECT_EQ(subscriptionStorage.Save(info), CHIP_NO_ERROR);
+    }
+    info.mSubscriptionId = CHIP_IM_MAX_NUM_SUBSCRIPTIONS;
+    EXPECT_EQ(subscriptionStorage.Save(info), CHIP_ERROR_NO_MEMORY);
+
+    EXPECT_EQ(subscriptionStorage.Delete(3333, 46, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(subscriptionStorage.Delete(3333, 46, 0), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    EXPECT_EQ(subscriptionStorage.Save(info), CHIP_NO_ERROR);
+    EXPECT_EQ(CountSubscriptions(subscriptionStorage), static_cast<size_t>(CHIP_IM_MAX_NUM_SUBSCRIPTIONS));
+
+    EXPECT_EQ(subscriptionStorage.DeleteAll(45), CHIP_NO_ERROR);
+    EXPECT_EQ(CountSubscriptions(subscriptionStorage), static_cast<size_t>(CHIP_IM_MAX_NUM_SUBSCRIPTIONS));
+    EXPECT_EQ(subscriptionStorage.DeleteAll(46), CHIP_NO_ERROR);
+    EXPECT_EQ(CountSubscriptions(subscriptionStorage), 0u);
+}
+
+TEST_F(TestBatchedSubscriptionResumptionStorage, TestMigrateFromSimpleStorage)
+{
+    chip::TestPersistentStorageDelegate storage;
+
+    SubscriptionInfo legacy = {
+        .mNodeId         = 4444,
+        .mFabricIndex    = 44,
+        .mSubscriptionId = 4,
+        .mMinInterval    = 4,
+        .mMaxInterval    = 14,
+        .mFabricFiltered = false,
+    };
+    FillPaths(legacy, 2, 2);
+
+    {
+        SimpleSubscriptionResumptionStorage simpleStorage;
+        EXPECT_EQ(simpleStorage.Init(&storage), CHIP_NO_ERROR);
+        EXPECT_EQ(simpleStorage.Save(legacy), CHIP_NO_ERROR);
+    }
+
+    BatchedSubscriptionResumptionStorage subscriptionStorage;
+    EXPECT_EQ(subscriptionStorage.Init(&storage), CHIP_NO_ERROR);
+
+    // Legacy keys are gone, replaced by the batched record.
+    EXPECT_EQ(storage.GetNumKeys(), 1u);
+    EXPECT_TRUE(storage.HasKey(chip::DefaultStorageKeyAllocator::SubscriptionResumptionBatch().KeyName()));
+
+    SubscriptionInfo migrated;
+    auto iterator = subscriptionStorage.IterateSubscriptions();
+    ASSERT_TRUE(iterator->Next(migrated));
+    iterator->Release();
+    EXPECT_EQ(migrated.mNodeId, legacy.mNodeId);
+    EXPECT_EQ(migrated.mSubscriptionId, legacy.mSubscriptionId);
+    EXPECT_TRUE(SamePaths(migrated, legacy));
+}
+
+TEST_F(TestBatchedSubscriptionResumptionStorage, TestUpdatePathsAtCapacity)
+{
+    chip::TestPersistentStorageDelegate storage;
+    BatchedSubscriptionResumptionStorage subscriptionStorage;
+    EXPECT_EQ(subscriptionStorage.Init(&storage), CHIP_NO_ERROR);
+
+    // Every subscription holds its own attribute path set.
+    SubscriptionInfo info = { .mNodeId = 5555, .mFabricIndex = 1 };
+    for (size_t i = 0; i < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; i++)
+    {
+        info.mSubscriptionId = static_cast<chip::SubscriptionId>(i);
+        FillPaths(info, i + 1, 1);
+        EXPECT_EQ(subscriptionStorage.Save(info), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(subscriptionStorage.AttributePathSetCount(), static_cast<size_t>(CHIP_IM_MAX_NUM_SUBSCRIPTIONS));
+
+    // New paths are acquired before the old ones are released.
+    info.mSubscriptionId = 0;
+    FillPaths(info, CHIP_IM_MAX_NUM_SUBSCRIPTIONS + 1, 1);
+    EXPECT_EQ(subscriptionStorage.Save(info), CHIP_NO_ERROR);
+    EXPECT_EQ(subscriptionStorage.AttributePathSetCount(), static_cast<size_t>(CHIP_IM_MAX_NUM_SUBSCRIPTIONS));
+    EXPECT_EQ(CountSubscriptions(subscriptionStorage), static_cast<size_t>(CHIP_IM_MAX_NUM_SUBSCRIPTIONS));
+
+    SubscriptionInfo updated;
+    auto iterator = subscriptionStorage.IterateSubscriptions();
+    while (iterator->Next(updated) && updated.mSubscriptionId != 0)
+    {
+    }
+    iterator->Release();
+    EXPECT_EQ(updated.mSubscriptionId, 0u);
+    EXPECT_TRUE(SamePaths(updated, info));
+}
+
+TEST_F(TestBatchedSubscriptionResumptionStorage, TestMigrationKeepsEntriesThatDoNotFit)
+{
+    chip::TestPersistentStorageDelegate storage;
+
+    SubscriptionInfo info = { .mNodeId = 6666, .mFabricIndex = 1 };
+    FillPaths(info, 1, 0);
+    {
+        BatchedSubscriptionResumptionStorage subscriptionStorage;
+        EXPECT_EQ(subscriptionStorage.Init(&storage), CHIP_NO_ERROR);
+        for (size_t i = 0; i < CHIP_IM_MAX_NUM_SUBSCRIPTIONS; i++)
+        {
+            info.mSubscriptionId = static_cast<chip::SubscriptionId>(i);
+            EXPECT_EQ(subscriptionStorage.Save(info), CHIP_NO_ERROR);
+        }
+    }
+
+    info.mSubscriptionId = CHIP_IM_MAX_NUM_SUBSCRIPTIONS;
+    {
+        SimpleSubscriptionResumptionStorage simpleStorage;
+        EXPECT_EQ(simpleStorage.Init(&storage), CHIP_NO_ERROR);
+        EXPECT_EQ(simpleStorage.Save(info), CHIP_NO_ERROR);
+    }
+
+    // The resident set is full, the legacy subscription stays where it is.
+    {
+        BatchedSubscriptionResumptionStorage subscriptionStorage;
+        EXPECT_EQ(subscriptionStorage.Init(&storage), CHIP_NO_ERROR);
+        EXPECT_EQ(CountSubscriptions(subscriptionStorage), static_cast<size_t>(CHIP_IM_MAX_NUM_SUBSCRIPTIONS));
+        EXPECT_TRUE(storage.HasKey(chip::DefaultStorageKeyAllocator::SubscriptionResumption(0).KeyName()));
+        EXPECT_TRUE(storage.HasKey(chip::DefaultStorageKeyAllocator::SubscriptionResumptionMaxCount().KeyName()));
+
+        EXPECT_EQ(subscriptionStorage.Delete(6666, 1, 0), CHIP_NO_ERROR);
+    }
+
+    // Once there is room, the next Init migrates it.
+    BatchedSubscriptionResumptionStorage subscriptionStorage;
+    EXPECT_EQ(subscriptionStorage.Init(&storage), CHIP_NO_ERROR);
+    EXPECT_EQ(CountSubscriptions(subscriptionStorage), static_cast<size_t>(CHIP_IM_MAX_NUM_SUBSCRIPTIONS));
+    EXPECT_EQ(storage.GetNumKeys(), 1u);
+}
+
+TEST_F(TestBatchedSubscriptionResumptionStorage, TestCorruptRecordIsDiscarded)
+{
+    chip::TestPersistentStorageDelegate storage;
+    uint8_t junk[16] = { 0x15, 0x24, 0x01, 0x07 };
+    EXPECT_EQ(storage.SyncSetKeyValue(chip::DefaultStorageKeyAllocator::SubscriptionResumptionBatch().KeyName(), junk,
+                                      sizeof(junk)),
+              CHIP_NO_ERROR);
+
+    BatchedSubscriptionResumptionStorage subscriptionStorage;
+    EXPECT_EQ(subscriptionStorage.Init(&storage), CHIP_NO_ERROR);
+    EXPECT_EQ(CountSubscriptions(subscriptionStorage), 0u);
+    EXPECT_EQ(storage.GetNumKeys(), 0u);
+}
+
+} // namespace
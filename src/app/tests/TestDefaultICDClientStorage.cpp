@@ -55,6 +55,20 @@ struct TestClientInfo : public ICDClientInfo
     }
 };
 
+// Storage delegate counting the reads, to tell the fabrics loaded from storage
+class ReadCountingStorageDelegate : public TestPersistentStorageDelegate
+{
+public:
+    size_t mReads = 0;
+
+protected:
+    CHIP_ERROR SyncGetKeyValueInternal(const char * key, void * buffer, uint16_t & size) override
+    {
+        mReads++;
+        return TestPersistentStorageDelegate::SyncGetKeyValueInternal(key, buffer, size);
+    }
+};
+
 class TestDefaultICDClientStorage : public ::testing::Test
 {
 public:
@@ -395,3 +409,208 @@ TEST_F(TestDefaultICDClientStorage, TestProcessCheckInPayloadWithEmptyIcdStorage
     ByteSpan payload1{ buffer->Start(), buffer->DataLength() };
     EXPECT_EQ(manager.ProcessCheckInPayload(payload1, decodeClientInfo, checkInCounter), CHIP_ERROR_NOT_FOUND);
 }
+
+TEST_F(TestDefaultICDClientStorage, TestProcessCheckInPayloadWithExpectedNonce)
+{
+    FabricIndex fabricId = 1;
+    TestPersistentStorageDelegate clientInfoStorage;
+    TestSessionKeystoreImpl keystore;
+
+    DefaultICDClientStorage manager;
+    EXPECT_EQ(manager.Init(&clientInfoStorage, &keystore), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.UpdateFabricList(fabricId), CHIP_NO_ERROR);
+
+    ICDClientInfo clientInfo1;
+    clientInfo1.peer_node         = ScopedNodeId(6666, fabricId);
+    clientInfo1.start_icd_counter = 100;
+    EXPECT_EQ(manager.SetKey(clientInfo1, ByteSpan(kKeyBuffer1)), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.StoreEntry(clientInfo1), CHIP_NO_ERROR);
+    ICDClientInfo clientInfo2;
+    clientInfo2.peer_node = ScopedNodeId(6667, fabricId);
+    EXPECT_EQ(manager.SetKey(clientInfo2, ByteSpan(kKeyBuffer3)), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.StoreEntry(clientInfo2), CHIP_NO_ERROR);
+
+    System::PacketBufferHandle buffer = MessagePacketBuffer::New(chip::Protocols::SecureChannel::CheckinMessage::kMinPayloadSize);
+    auto checkIn = [&](const ICDClientInfo & sender, uint32_t counter, ICDClientInfo & decodeClientInfo,
+                       uint32_t & checkInCounter) {
+        MutableByteSpan output{ buffer->Start(), buffer->MaxDataLength() };
+        EXPECT_EQ(chip::Protocols::SecureChannel::CheckinMessage::GenerateCheckinMessagePayload(
+                      sender.aes_key_handle, sender.hmac_key_handle, counter, ByteSpan(), output),
+                  CHIP_NO_ERROR);
+        return manager.ProcessCheckInPayload(output, decodeClientInfo, checkInCounter);
+    };
+
+    // The counter following the last one received
+    ICDClientInfo decodeClientInfo;
+    uint32_t checkInCounter = 0;
+    EXPECT_EQ(checkIn(clientInfo1, 101, decodeClientInfo, checkInCounter), CHIP_NO_ERROR);
+    EXPECT_EQ(checkInCounter, 101u);
+    EXPECT_EQ(decodeClientInfo.peer_node, clientInfo1.peer_node);
+
+    // The expected counters move along with the stored offset
+    decodeClientInfo.offset = checkInCounter - decodeClientInfo.start_icd_counter;
+    EXPECT_EQ(manager.StoreEntry(decodeClientInfo), CHIP_NO_ERROR);
+    EXPECT_EQ(checkIn(clientInfo1, 102, decodeClientInfo, checkInCounter), CHIP_NO_ERROR);
+    EXPECT_EQ(checkInCounter, 102u);
+    EXPECT_EQ(decodeClientInfo.peer_node, clientInfo1.peer_node);
+    EXPECT_EQ(decodeClientInfo.offset, 1u);
+
+    // Counters beyond the expected ones are still matched, by trying all the clients
+    EXPECT_EQ(checkIn(clientInfo2, 1000, decodeClientInfo, checkInCounter), CHIP_NO_ERROR);
+    EXPECT_EQ(checkInCounter, 1000u);
+    EXPECT_EQ(decodeClientInfo.peer_node, clientInfo2.peer_node);
+
+    // The client infos and their expected counters are loaded again from storage
+    manager.Shutdown();
+    DefaultICDClientStorage manager1;
+    EXPECT_EQ(manager1.Init(&clientInfoStorage, &keystore), CHIP_NO_ERROR);
+    MutableByteSpan output{ buffer->Start(), buffer->MaxDataLength() };
+    EXPECT_EQ(chip::Protocols::SecureChannel::CheckinMessage::GenerateCheckinMessagePayload(
+                  clientInfo1.aes_key_handle, clientInfo1.hmac_key_handle, 102, ByteSpan(), output),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(manager1.ProcessCheckInPayload(output, decodeClientInfo, checkInCounter), CHIP_NO_ERROR);
+    EXPECT_EQ(checkInCounter, 102u);
+    EXPECT_EQ(decodeClientInfo.peer_node, clientInfo1.peer_node);
+
+    // Deleted clients are not matched anymore
+    EXPECT_EQ(manager1.DeleteEntry(clientInfo1.peer_node), CHIP_NO_ERROR);
+    EXPECT_EQ(manager1.ProcessCheckInPayload(output, decodeClientInfo, checkInCounter), CHIP_ERROR_NOT_FOUND);
+}
+
+TEST_F(TestDefaultICDClientStorage, TestDeleteEntryWithStorageFailure)
+{
+    FabricIndex fabricId = 1;
+    TestPersistentStorageDelegate clientInfoStorage;
+    TestSessionKeystoreImpl keystore;
+
+    DefaultICDClientStorage manager;
+    EXPECT_EQ(manager.Init(&clientInfoStorage, &keystore), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.UpdateFabricList(fabricId), CHIP_NO_ERROR);
+
+    ICDClientInfo clientInfo;
+    clientInfo.peer_node = ScopedNodeId(6666, fabricId);
+    EXPECT_EQ(manager.SetKey(clientInfo, ByteSpan(kKeyBuffer1)), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.StoreEntry(clientInfo), CHIP_NO_ERROR);
+
+    System::PacketBufferHandle buffer = MessagePacketBuffer::New(chip::Protocols::SecureChannel::CheckinMessage::kMinPayloadSize);
+    MutableByteSpan output{ buffer->Start(), buffer->MaxDataLength() };
+    EXPECT_EQ(chip::Protocols::SecureChannel::CheckinMessage::GenerateCheckinMessagePayload(
+                  clientInfo.aes_key_handle, clientInfo.hmac_key_handle, 1, ByteSpan(), output),
+              CHIP_NO_ERROR);
+    ICDClientInfo decodeClientInfo;
+    uint32_t checkInCounter = 0;
+
+    // A deletion that is not stored leaves the entry, and its key, in place
+    clientInfoStorage.SetRejectWrites(true);
+    EXPECT_NE(manager.DeleteEntry(clientInfo.peer_node), CHIP_NO_ERROR);
+    clientInfoStorage.SetRejectWrites(false);
+    EXPECT_EQ(manager.ProcessCheckInPayload(output, decodeClientInfo, checkInCounter), CHIP_NO_ERROR);
+    EXPECT_EQ(decodeClientInfo.peer_node, clientInfo.peer_node);
+    {
+        auto * iterator = manager.IterateICDClientInfo();
+        EXPECT_EQ(iterator->Count(), 1u);
+        iterator->Release();
+    }
+
+    EXPECT_EQ(manager.DeleteEntry(clientInfo.peer_node), CHIP_NO_ERROR);
+    EXPECT_EQ(manager.ProcessCheckInPayload(output, decodeClientInfo, checkInCounter), CHIP_ERROR_NOT_FOUND);
+    {
+        auto * iterator = manager.IterateICDClientInfo();
+        EXPECT_EQ(iterator->Count(), 0u);
+        iterator->Release();
+    }
+}
+
+TEST_F(TestDefaultICDClientStorage, TestProcessCheckInPayloadWithUnloadableFabric)
+{
+    FabricIndex fabricId = 1;
+    ReadCountingStorageDelegate clientInfoStorage;
+    TestSessionKeystoreImpl keystore;
+
+    ICDClientInfo clientInfo;
+    clientInfo.peer_node = ScopedNodeId(6666, fabricId);
+    {
+        DefaultICDClientStorage manager;
+        EXPECT_EQ(manager.Init(&clientInfoStorage, &keystore), CHIP_NO_ERROR);
+        EXPECT_EQ(manager.UpdateFabricList(fabricId), CHIP_NO_ERROR);
+        EXPECT_EQ(manager.SetKey(clientInfo, ByteSpan(kKeyBuffer1)), CHIP_NO_ERROR);
+        EXPECT_EQ(manager.StoreEntry(clientInfo), CHIP_NO_ERROR);
+        manager.Shutdown();
+    }
+
+    System::PacketBufferHandle buffer = MessagePacketBuffer::New(chip::Protocols::SecureChannel::CheckinMessage::kMinPayloadSize);
+    MutableByteSpan output{ buffer->Start(), buffer->MaxDataLength() };
+    EXPECT_EQ(chip::Protocols::SecureChannel::CheckinMessage::GenerateCheckinMessagePayload(
+                  clientInfo.aes_key_handle, clientInfo.hmac_key_handle, 1, ByteSpan(), output),
+              CHIP_NO_ERROR);
+    ICDClientInfo decodeClientInfo;
+    uint32_t checkInCounter = 0;
+
+    // The fabric fails to load on Init, and check-in messages do not read it again
+    clientInfoStorage.AddPoisonKey(DefaultStorageKeyAllocator::ICDClientInfoKey(fabricId).KeyName());
+    DefaultICDClientStorage manager;
+    EXPECT_EQ(manager.Init(&clientInfoStorage, &keystore), CHIP_NO_ERROR);
+    clientInfoStorage.mReads = 0;
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_EQ(manager.ProcessCheckInPayload(output, decodeClientInfo, checkInCounter), CHIP_ERROR_NOT_FOUND);
+    }
+    EXPECT_EQ(clientInfoStorage.mReads, 0u);
+
+    // The next operation on the fabric loads it again
+    clientInfoStorage.ClearPoisonKeys();
+    {
+        auto * iterator = manager.IterateICDClientInfo();
+        EXPECT_EQ(iterator->Count(), 1u);
+        iterator->Release();
+    }
+    EXPECT_EQ(manager.ProcessCheckInPayload(output, decodeClientInfo, checkInCounter), CHIP_NO_ERROR);
+    EXPECT_EQ(decodeClientInfo.peer_node, clientInfo.peer_node);
+}
+
+TEST_F(TestDefaultICDClientStorage, TestProcessCheckInPayloadAcrossFabrics)
+{
+    constexpr FabricIndex kFabricCount = 3;
+    constexpr size_t kClientsPerFabric = 4;
+    TestPersistentStorageDelegate clientInfoStorage;
+    TestSessionKeystoreImpl keystore;
+
+    DefaultICDClientStorage manager;
+    EXPECT_EQ(manager.Init(&clientInfoStorage, &keystore), CHIP_NO_ERROR);
+    std::vector<ICDClientInfo> clientInfos;
+    for (FabricIndex fabricId = 1; fabricId <= kFabricCount; fabricId++)
+    {
+        EXPECT_EQ(manager.UpdateFabricList(fabricId), CHIP_NO_ERROR);
+        for (size_t i = 0; i < kClientsPerFabric; i++)
+        {
+            ICDClientInfo clientInfo;
+            clientInfo.peer_node = ScopedNodeId(static_cast<NodeId>(1000 + i), fabricId);
+            uint8_t key[sizeof(kKeyBuffer1)];
+            memcpy(key, kKeyBuffer1, sizeof(key));
+            key[0] = fabricId;
+            key[1] = static_cast<uint8_t>(i);
+            ASSERT_EQ(manager.SetKey(clientInfo, ByteSpan(key)), CHIP_NO_ERROR);
+            ASSERT_EQ(manager.StoreEntry(clientInfo), CHIP_NO_ERROR);
+            clientInfos.push_back(clientInfo);
+        }
+    }
+
+    // The next counter of each client is expected, a counter far ahead has all the clients tried
+    System::PacketBufferHandle buffer = MessagePacketBuffer::New(chip::Protocols::SecureChannel::CheckinMessage::kMinPayloadSize);
+    for (uint32_t counter : { 1u, 1000u })
+    {
+        for (const ICDClientInfo & sender : clientInfos)
+        {
+            MutableByteSpan output{ buffer->Start(), buffer->MaxDataLength() };
+            EXPECT_EQ(chip::Protocols::SecureChannel::CheckinMessage::GenerateCheckinMessagePayload(
+                          sender.aes_key_handle, sender.hmac_key_handle, counter, ByteSpan(), output),
+                      CHIP_NO_ERROR);
+            ICDClientInfo decodeClientInfo;
+            uint32_t checkInCounter = 0;
+            EXPECT_EQ(manager.ProcessCheckInPayload(output, decodeClientInfo, checkInCounter), CHIP_NO_ERROR);
+            EXPECT_EQ(decodeClientInfo.peer_node, sender.peer_node);
+            EXPECT_EQ(checkInCounter, counter);
+        }
+    }
+    manager.Shutdown();
+}
@@ -0,0 +1,195 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/clusters/door-lock-server/door-lock-credential-index.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <vector>
+
+using namespace chip;
+using namespace chip::app::Clusters::DoorLock;
+
+namespace {
+
+constexpr uint8_t kPin1234[] = { '1', '2', '3', '4' };
+constexpr uint8_t kPin5678[] = { '5', '6', '7', '8' };
+
+std::vector<uint16_t> Candidates(const CredentialIndex & index, CredentialTypeEnum type, ByteSpan data)
+{
+    std::vector<uint16_t> candidates;
+    index.ForEachCandidate(type, data, [&](uint16_t credentialIndex, uint16_t) {
+        candidates.push_back(credentialIndex);
+        return Loop::Continue;
+    });
+    return candidates;
+}
+
+class TestDoorLockCredentialIndex : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestDoorLockCredentialIndex, TestInit)
+{
+    CredentialIndex index;
+    EXPECT_FALSE(index.IsInitialized());
+    EXPECT_EQ(index.SetCredential(CredentialTypeEnum::kPin, 1, ByteSpan(kPin1234)), CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_TRUE(Candidates(index, CredentialTypeEnum::kPin, ByteSpan(kPin1234)).empty());
+
+    EXPECT_EQ(index.Init(0), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(index.Init(10), CHIP_NO_ERROR);
+    EXPECT_TRUE(index.IsInitialized());
+    EXPECT_EQ(index.Init(10), CHIP_ERROR_INCORRECT_STATE);
+
+    index.Shutdown();
+    EXPECT_FALSE(index.IsInitialized());
+}
+
+TEST_F(TestDoorLockCredentialIndex, TestSetAndFindCredentials)
+{
+    CredentialIndex index;
+    ASSERT_EQ(index.Init(10), CHIP_NO_ERROR);
+
+    EXPECT_EQ(index.SetCredential(CredentialTypeEnum::kPin, 1, ByteSpan(kPin1234)), CHIP_NO_ERROR);
+    EXPECT_EQ(index.SetCredential(CredentialTypeEnum::kPin, 2, ByteSpan(kPin5678)), CHIP_NO_ERROR);
+    // Same data, different type
+    EXPECT_EQ(index.SetCredential(CredentialTypeEnum::kRfid, 1, ByteSpan(kPin1234)), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Count(), 3u);
+
+    uint16_t userIndex = 42;
+    EXPECT_TRUE(index.FindCredential(CredentialTypeEnum::kPin, 1, userIndex));
+    EXPECT_EQ(userIndex, CredentialIndex::kNoUser);
+    EXPECT_FALSE(index.FindCredential(CredentialTypeEnum::kPin, 3, userIndex));
+    EXPECT_FALSE(index.FindCredential(CredentialTypeEnum::kRfid, 2, userIndex));
+
+    EXPECT_EQ(Candidates(index, CredentialTypeEnum::kPin, ByteSpan(kPin1234)), std::vector<uint16_t>{ 1 });
+    EXPECT_EQ(Candidates(index, CredentialTypeEnum::kPin, ByteSpan(kPin5678)), std::vector<uint16_t>{ 2 });
+    EXPECT_EQ(Candidates(index, CredentialTypeEnum::kRfid, ByteSpan(kPin1234)), std::vector<uint16_t>{ 1 });
+    EXPECT_TRUE(Candidates(index, CredentialTypeEnum::kRfid, ByteSpan(kPin5678)).empty());
+
+    // Updating the data moves the slot to the new data
+    EXPECT_EQ(index.SetCredential(CredentialTypeEnum::kPin, 1, ByteSpan(kPin5678)), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Count(), 3u);
+    EXPECT_TRUE(Candidates(index, CredentialTypeEnum::kPin, ByteSpan(kPin1234)).empty());
+    auto candidates = Candidates(index, CredentialTypeEnum::kPin, ByteSpan(kPin5678));
+    EXPECT_EQ(candidates.size(), 2u);
+
+    index.RemoveCredential(CredentialTypeEnum::kPin, 1);
+    EXPECT_EQ(index.Count(), 2u);
+    EXPECT_FALSE(index.FindCredential(CredentialTypeEnum::kPin, 1, userIndex));
+    EXPECT_EQ(Candidates(index, CredentialTypeEnum::kPin, ByteSpan(kPin5678)), std::vector<uint16_t>{ 2 });
+
+    // Removing a missing credential does nothing
+    index.RemoveCredential(CredentialTypeEnum::kPin, 1);
+    EXPECT_EQ(index.Count(), 2u);
+
+    index.Clear();
+    EXPECT_EQ(index.Count(), 0u);
+    EXPECT_FALSE(index.FindCredential(CredentialTypeEnum::kPin, 2, userIndex));
+    EXPECT_TRUE(Candidates(index, CredentialTypeEnum::kPin, ByteSpan(kPin5678)).empty());
+}
+
+TEST_F(TestDoorLockCredentialIndex, TestUsers)
+{
+    CredentialIndex index;
+    ASSERT_EQ(index.Init(10), CHIP_NO_ERROR);
+
+    EXPECT_EQ(index.SetCredential(CredentialTypeEnum::kPin, 1, ByteSpan(kPin1234)), CHIP_NO_ERROR);
+    EXPECT_EQ(index.SetCredential(CredentialTypeEnum::kRfid, 1, ByteSpan(kPin5678)), CHIP_NO_ERROR);
+    EXPECT_EQ(index.SetCredential(CredentialTypeEnum::kPin, 2, ByteSpan(kPin5678)), CHIP_NO_ERROR);
+
+    index.SetUser(CredentialTypeEnum::kPin, 1, 3);
+    index.SetUser(CredentialTypeEnum::kRfid, 1, 3);
+    index.SetUser(CredentialTypeEnum::kPin, 2, 4);
+    // Users of missing credentials are ignored
+    index.SetUser(CredentialTypeEnum::kPin, 5, 4);
+    EXPECT_EQ(index.Count(), 3u);
+
+    uint16_t userIndex = 0;
+    EXPECT_TRUE(index.FindCredential(CredentialTypeEnum::kRfid, 1, userIndex));
+    EXPECT_EQ(userIndex, 3);
+
+    // The user is kept when the data changes
+    EXPECT_EQ(index.SetCredential(CredentialTypeEnum::kPin, 2, ByteSpan(kPin1234)), CHIP_NO_ERROR);
+    EXPECT_TRUE(index.FindCredential(CredentialTypeEnum::kPin, 2, userIndex));
+    EXPECT_EQ(userIndex, 4);
+
+    index.ForEachCandidate(CredentialTypeEnum::kPin, ByteSpan(kPin1234), [&](uint16_t credentialIndex, uint16_t user) {
+        EXPECT_EQ(user, credentialIndex == 1 ? 3 : 4);
+        return Loop::Continue;
+    });
+
+    index.RemoveUser(3);
+    EXPECT_TRUE(index.FindCredential(CredentialTypeEnum::kPin, 1, userIndex));
+    EXPECT_EQ(userIndex, CredentialIndex::kNoUser);
+    EXPECT_TRUE(index.FindCredential(CredentialTypeEnum::kRfid, 1, userIndex));
+    EXPECT_EQ(userIndex, CredentialIndex::kNoUser);
+    EXPECT_TRUE(index.FindCredential(CredentialTypeEnum::kPin, 2, userIndex));
+    EXPECT_EQ(userIndex, 4);
+}
+
+TEST_F(TestDoorLockCredentialIndex, TestCapacity)
+{
+    CredentialIndex index;
+    ASSERT_EQ(index.Init(3), CHIP_NO_ERROR);
+
+    uint8_t data[] = { 0 };
+    for (uint16_t i = 1; i <= 3; i++)
+    {
+        data[0] = static_cast<uint8_t>(i);
+        EXPECT_EQ(index.SetCredential(CredentialTypeEnum::kPin, i, ByteSpan(data)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(index.SetCredential(CredentialTypeEnum::kPin, 4, ByteSpan(data)), CHIP_ERROR_NO_MEMORY);
+    // Updating a credential needs no room
+    EXPECT_EQ(index.SetCredential(CredentialTypeEnum::kPin, 3, ByteSpan(kPin1234)), CHIP_NO_ERROR);
+
+    // Removed slots are reused
+    index.RemoveCredential(CredentialTypeEnum::kPin, 2);
+    EXPECT_EQ(index.SetCredential(CredentialTypeEnum::kPin, 4, ByteSpan(data)), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Count(), 3u);
+}
+
+TEST_F(TestDoorLockCredentialIndex, TestBreak)
+{
+    CredentialIndex index;
+    ASSERT_EQ(index.Init(10), CHIP_NO_ERROR);
+
+    for (uint16_t i = 1; i <= 5; i++)
+    {
+        EXPECT_EQ(index.SetCredential(CredentialTypeEnum::kPin, i, ByteSpan(kPin1234)), CHIP_NO_ERROR);
+    }
+
+    size_t calls = 0;
+    EXPECT_EQ(index.ForEachCandidate(CredentialTypeEnum::kPin, ByteSpan(kPin1234),
+                                     [&](uint16_t, uint16_t) {
+                                         calls++;
+                                         return Loop::Break;
+                                     }),
+              Loop::Break);
+    EXPECT_EQ(calls, 1u);
+    EXPECT_EQ(Candidates(index, CredentialTypeEnum::kPin, ByteSpan(kPin1234)).size(), 5u);
+}
+
+} // namespace
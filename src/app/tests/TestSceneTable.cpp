@@ -670,6 +670,20 @@ protected:
     uint8_t GetClusterCountFromEndpoint() override { return 3; }
 };
 
+// Storage delegate counting the reads, to tell cached scenes from scenes loaded from storage
+class ReadCountingStorageDelegate : public chip::TestPersistentStorageDelegate
+{
+public:
+    size_t mReads = 0;
+
+protected:
+    CHIP_ERROR SyncGetKeyValueInternal(const char * key, void * buffer, uint16_t & size) override
+    {
+        mReads++;
+        return TestPersistentStorageDelegate::SyncGetKeyValueInternal(key, buffer, size);
+    }
+};
+
 // Test Fixture Class
 class TestSceneTable : public ::testing::Test
 {
@@ -2298,4 +2312,68 @@ TEST_F(TestSceneTable, TestOTAChanges)
     EXPECT_EQ(1, fabric_capacity);
 }
 
+TEST_F(TestSceneTable, TestSceneCache)
+{
+    ReadCountingStorageDelegate storage;
+    TestSceneTableImpl sceneTable;
+    ASSERT_EQ(CHIP_NO_ERROR, sceneTable.Init(storage));
+    sceneTable.SetEndpoint(kTestEndpoint1);
+
+    SceneTableEntry scene;
+
+    // A stored scene is recalled without reading it back from storage
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, scene1));
+    storage.mReads = 0;
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetSceneTableEntry(kFabric1, sceneId1, scene));
+    EXPECT_EQ(scene, scene1);
+#if CHIP_CONFIG_SCENES_CACHE_SIZE > 0
+    EXPECT_EQ(0u, storage.mReads);
+#endif // CHIP_CONFIG_SCENES_CACHE_SIZE > 0
+
+    // Overwriting a scene updates the cached copy
+    SceneTableEntry updatedScene1(sceneId1, sceneData2);
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, updatedScene1));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetSceneTableEntry(kFabric1, sceneId1, scene));
+    EXPECT_EQ(scene, updatedScene1);
+
+    // The same scene ID on another fabric or endpoint is another scene
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable.GetSceneTableEntry(kFabric2, sceneId1, scene));
+    sceneTable.SetEndpoint(kTestEndpoint2);
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable.GetSceneTableEntry(kFabric1, sceneId1, scene));
+    sceneTable.SetEndpoint(kTestEndpoint1);
+
+    // Removed scenes are no longer recalled
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.RemoveSceneTableEntry(kFabric1, sceneId1));
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable.GetSceneTableEntry(kFabric1, sceneId1, scene));
+
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, scene2));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, scene3));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, scene5));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.DeleteAllScenesInGroup(kFabric1, kGroup1));
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable.GetSceneTableEntry(kFabric1, sceneId2, scene));
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable.GetSceneTableEntry(kFabric1, sceneId3, scene));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetSceneTableEntry(kFabric1, sceneId5, scene));
+    EXPECT_EQ(scene, scene5);
+
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.RemoveSceneTableEntryAtPosition(kTestEndpoint1, kFabric1, 0));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.RemoveFabric(kFabric1));
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable.GetSceneTableEntry(kFabric1, sceneId5, scene));
+
+    // A full fabric holds more scenes than the cache, the evicted ones are loaded from storage again
+    const SceneTableEntry * fabricScenes[] = { &scene1, &scene2, &scene3, &scene4, &scene5, &scene6, &scene7 };
+    static_assert(MATTER_ARRAY_SIZE(fabricScenes) == defaultTestFabricCapacity, "The test fills a whole fabric");
+    for (const SceneTableEntry * fabricScene : fabricScenes)
+    {
+        EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, *fabricScene));
+    }
+    for (const SceneTableEntry * fabricScene : fabricScenes)
+    {
+        EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetSceneTableEntry(kFabric1, fabricScene->mStorageId, scene));
+        EXPECT_EQ(scene, *fabricScene);
+    }
+
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.RemoveFabric(kFabric1));
+    sceneTable.Finish();
+}
+
 } // namespace TestScenes
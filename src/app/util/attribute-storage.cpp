@@ -268,6 +268,8 @@ void emberAfEndpointConfigure()
         }
     }
 #endif
+
+    emberMetadataStructureGeneration++;
 }
 
 void emberAfSetDynamicEndpointCount(uint16_t dynamicEndpointCount)
@@ -1472,6 +1474,7 @@ CHIP_ERROR SetParentEndpointForEndpoint(EndpointId childEndpoint, EndpointId par
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
     emAfEndpoints[childIndex].parentEndpointId = parentEndpoint;
+    emberMetadataStructureGeneration++;
     return CHIP_NO_ERROR;
 }
 
@@ -1483,6 +1486,7 @@ CHIP_ERROR SetFlatCompositionForEndpoint(EndpointId endpoint)
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
     emAfEndpoints[index].bitmask.Set(EmberAfEndpointOptions::isFlatComposition);
+    emberMetadataStructureGeneration++;
     return CHIP_NO_ERROR;
 }
 
@@ -1494,6 +1498,7 @@ CHIP_ERROR SetTreeCompositionForEndpoint(EndpointId endpoint)
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
     emAfEndpoints[index].bitmask.Clear(EmberAfEndpointOptions::isFlatComposition);
+    emberMetadataStructureGeneration++;
     return CHIP_NO_ERROR;
 }
 
@@ -471,17 +471,215 @@ ControllerDeviceInitParams DeviceController::GetControllerDeviceInitParams()
     };
 }
 
-DeviceCommissioner::DeviceCommissioner() :
-    mOnDeviceConnectedCallback(OnDeviceConnectedFn, this), mOnDeviceConnectionFailureCallback(OnDeviceConnectionFailureFn, this),
+namespace {
+// Transports over which we can only have one commissionee connection at a time.
+bool IsSingleConnectionTransport(Transport::Type type)
+{
+    return type == Transport::Type::kBle || type == Transport::Type::kWiFiPAF || type == Transport::Type::kNfc;
+}
+} // namespace
+
+DeviceCommissioner::DeviceCommissioner() : mSetUpCodePairer(this)
+{
+#if CHIP_DEVICE_CONFIG_ENABLE_JOINT_FABRIC
+    (void) mPeerAdminJFAdminClusterEndpointId;
+#endif // CHIP_DEVICE_CONFIG_ENABLE_JOINT_FABRIC
+}
+
+DeviceCommissioner::CommissioneeState::CommissioneeState(DeviceCommissioner & commissioner, NodeId nodeId) :
+    mDeviceCommissioner(commissioner), mNodeId(nodeId), mOnDeviceConnectedCallback(OnDeviceConnectedFn, this),
+    mOnDeviceConnectionFailureCallback(OnDeviceConnectionFailureFn, this),
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
     mOnDeviceConnectionRetryCallback(OnDeviceConnectionRetryFn, this),
 #endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+    mDefaultCommissioner(commissioner.mDefaultCommissioner)
+{}
+
+DeviceCommissioner::CommissioneeState::~CommissioneeState()
+{
+    VerifyOrReturn(mAsyncCallbacks != nullptr);
+    if (mAsyncCallbacks->mPending == 0)
+    {
+        Platform::Delete(mAsyncCallbacks);
+        return;
+    }
+    // The verifier or the issuer still holds on to the callbacks, which free themselves once called.
+    mAsyncCallbacks->mCommissionee = nullptr;
+}
+
+DeviceCommissioner::AsyncCallbacks::AsyncCallbacks(CommissioneeState * commissionee) :
+    mCommissionee(commissionee),
     mDeviceAttestationInformationVerificationCallback(OnDeviceAttestationInformationVerification, this),
-    mDeviceNOCChainCallback(OnDeviceNOCChainGeneration, this), mSetUpCodePairer(this)
+    mDeviceNOCChainCallback(OnDeviceNOCChainGeneration, this)
+{}
+
+DeviceCommissioner::CommissioneeState * DeviceCommissioner::AsyncCallbacks::Complete(void * context)
 {
-#if CHIP_DEVICE_CONFIG_ENABLE_JOINT_FABRIC
-    (void) mPeerAdminJFAdminClusterEndpointId;
-#endif // CHIP_DEVICE_CONFIG_ENABLE_JOINT_FABRIC
+    auto * callbacks                 = static_cast<AsyncCallbacks *>(context);
+    CommissioneeState * commissionee = callbacks->mCommissionee;
+    callbacks->mPending--;
+    if (commissionee == nullptr && callbacks->mPending == 0)
+    {
+        Platform::Delete(callbacks);
+    }
+    return commissionee;
+}
+
+void DeviceCommissioner::CommissioneeState::OnSessionEstablishmentError(CHIP_ERROR error)
+{
+    CommissioneeScope scope(mDeviceCommissioner, this);
+    mDeviceCommissioner.OnSessionEstablishmentError(error);
+}
+
+void DeviceCommissioner::CommissioneeState::OnSessionEstablished(const SessionHandle & session)
+{
+    CommissioneeScope scope(mDeviceCommissioner, this);
+    mDeviceCommissioner.OnSessionEstablished(session);
+}
+
+bool DeviceCommissioner::CommissioneeState::IsIdle()
+{
+    bool interactionsInProgress = mInvokeCancelFn || mWriteCancelFn || mOnDeviceConnectedCallback.IsRegistered();
+#if CHIP_CONFIG_ENABLE_READ_CLIENT
+    interactionsInProgress = interactionsInProgress || mReadClient;
+#endif // CHIP_CONFIG_ENABLE_READ_CLIENT
+    return mDeviceInPASEEstablishment == nullptr && !IsCommissioning() && !interactionsInProgress &&
+        mAsyncCallbacks->mPending == 0;
+}
+
+DeviceCommissioner::CommissioneeScope::CommissioneeScope(DeviceCommissioner & commissioner, CommissioneeState * commissionee) :
+    mCommissioner(commissioner), mCommissionee(commissionee), mPrevious(commissioner.mCommissionee)
+{
+    mCommissioner.mCommissionee = mCommissionee;
+    if (mCommissionee != nullptr)
+    {
+        mCommissionee->mScopeDepth++;
+    }
+}
+
+DeviceCommissioner::CommissioneeScope::~CommissioneeScope()
+{
+    mCommissioner.mCommissionee = mPrevious;
+    VerifyOrReturn(mCommissionee != nullptr);
+    if (--mCommissionee->mScopeDepth == 0 && mCommissionee->IsIdle())
+    {
+        mCommissioner.ReleaseCommissionee(mCommissionee);
+    }
+}
+
+DeviceCommissioner::CommissioneeState * DeviceCommissioner::FindCommissionee(NodeId nodeId)
+{
+    CommissioneeState * found = nullptr;
+    mCommissionees.ForEachActiveObject([&](CommissioneeState * commissionee) {
+        if (commissionee->mNodeId == nodeId)
+        {
+            found = commissionee;
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+    return found;
+}
+
+DeviceCommissioner::CommissioneeState * DeviceCommissioner::FindOrCreateCommissionee(NodeId nodeId)
+{
+    CommissioneeState * commissionee = FindCommissionee(nodeId);
+    VerifyOrReturnValue(commissionee == nullptr, commissionee);
+
+    commissionee = mCommissionees.CreateObject(*this, nodeId);
+    VerifyOrReturnValue(commissionee != nullptr, nullptr);
+
+    commissionee->mAsyncCallbacks = Platform::New<AsyncCallbacks>(commissionee);
+    if (commissionee->mAsyncCallbacks == nullptr)
+    {
+        mCommissionees.ReleaseObject(commissionee);
+        return nullptr;
+    }
+
+    if (UsesPerCommissioneeCommissioner())
+    {
+        // Start from the parameters set on the default commissioner, e.g. by PairDevice().
+        commissionee->mAutoCommissioner = Platform::MakeUnique<AutoCommissioner>();
+        if (!commissionee->mAutoCommissioner ||
+            commissionee->mAutoCommissioner->SetCommissioningParameters(mAutoCommissioner.GetCommissioningParameters()) !=
+                CHIP_NO_ERROR)
+        {
+            mCommissionees.ReleaseObject(commissionee);
+            return nullptr;
+        }
+        commissionee->mDefaultCommissioner = commissionee->mAutoCommissioner.get();
+    }
+    return commissionee;
+}
+
+DeviceCommissioner::CommissioneeState * DeviceCommissioner::ResolveCommissionee()
+{
+    VerifyOrReturnValue(mCommissionee == nullptr, mCommissionee);
+
+    CommissioneeState * found = nullptr;
+    size_t count              = 0;
+    mCommissionees.ForEachActiveObject([&](CommissioneeState * commissionee) {
+        if (commissionee->IsCommissioning())
+        {
+            found = commissionee;
+            count++;
+        }
+        return Loop::Continue;
+    });
+    return (count == 1) ? found : nullptr;
+}
+
+DeviceCommissioner::CommissioneeState * DeviceCommissioner::ResolveCommissionee(NodeId nodeId)
+{
+    VerifyOrReturnValue(mCommissionee == nullptr || mCommissionee->mNodeId != nodeId, mCommissionee);
+    return FindCommissionee(nodeId);
+}
+
+DeviceCommissioner::CommissioneeState * DeviceCommissioner::FindCommissioneeEstablishingPASE(Transport::Type transportType)
+{
+    CommissioneeState * found = nullptr;
+    mCommissionees.ForEachActiveObject([&](CommissioneeState * commissionee) {
+        CommissioneeDeviceProxy * device = commissionee->mDeviceInPASEEstablishment;
+        if (device != nullptr && device->GetDeviceTransportType() == transportType)
+        {
+            found = commissionee;
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+    return found;
+}
+
+bool DeviceCommissioner::CanEstablishPASE(Transport::Type transportType)
+{
+    size_t inProgress          = 0;
+    bool singleConnectionInUse = false;
+    mCommissionees.ForEachActiveObject([&](CommissioneeState * commissionee) {
+        if (commissionee->mDeviceInPASEEstablishment != nullptr)
+        {
+            inProgress++;
+            auto transportType    = commissionee->mDeviceInPASEEstablishment->GetDeviceTransportType();
+            singleConnectionInUse = singleConnectionInUse || IsSingleConnectionTransport(transportType);
+        }
+        return Loop::Continue;
+    });
+    VerifyOrReturnValue(!(singleConnectionInUse && IsSingleConnectionTransport(transportType)), false);
+    return inProgress < CHIP_CONFIG_MAX_CONCURRENT_COMMISSIONEES;
+}
+
+void DeviceCommissioner::ReleaseCommissionee(CommissioneeState * commissionee)
+{
+    if (mCommissionee == commissionee)
+    {
+        mCommissionee = nullptr;
+    }
+    mCommissionees.ReleaseObject(commissionee);
+}
+
+DevicePairingDelegate * DeviceCommissioner::PairingDelegateForCommissionee() const
+{
+    NodeId nodeId = (mCommissionee != nullptr) ? mCommissionee->mNodeId : kUndefinedNodeId;
+    return mSetUpCodePairer.ResolvePairingDelegate(nodeId, mPairingDelegate);
 }
 
 CHIP_ERROR DeviceCommissioner::Init(CommissionerInitParams params)
@@ -552,16 +750,7 @@ void DeviceCommissioner::Shutdown()
     ChipLogDetail(Controller, "Shutting down the commissioner");
 
     mSetUpCodePairer.StopPairing();
-
-    // Check to see if pairing in progress before shutting down
-    CommissioneeDeviceProxy * device = mDeviceInPASEEstablishment;
-    if (device != nullptr && device->IsSessionSetupInProgress())
-    {
-        ChipLogDetail(Controller, "Setup in progress, stopping setup before shutting down");
-        OnSessionEstablishmentError(CHIP_ERROR_CONNECTION_ABORTED);
-    }
-
-    CancelCommissioningInteractions();
+    StopCommissionees();
 
 #if CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY // make this commissioner discoverable
     if (mUdcTransportMgr != nullptr)
@@ -581,6 +770,36 @@ void DeviceCommissioner::Shutdown()
         [](uint32_t id, WiFiPAF::WiFiPafRole role) { DeviceLayer::ConnectivityMgr().WiFiPAFShutdown(id, role); });
 #endif
 
+    ReleaseCommissionees();
+
+    DeviceController::Shutdown();
+}
+
+void DeviceCommissioner::StopCommissionees()
+{
+    mCommissionees.ForEachActiveObject([this](CommissioneeState * commissionee) {
+        CommissioneeScope scope(*this, commissionee);
+
+        // Check to see if pairing in progress before shutting down
+        CommissioneeDeviceProxy * device = commissionee->mDeviceInPASEEstablishment;
+        if (device != nullptr && device->IsSessionSetupInProgress())
+        {
+            ChipLogDetail(Controller, "Setup in progress, stopping setup before shutting down");
+            OnSessionEstablishmentError(CHIP_ERROR_CONNECTION_ABORTED);
+        }
+
+        CancelCommissioningInteractions();
+
+        // Nothing will move this commissionee forward anymore. Once ReleaseCommissionees() released its devices, it is idle.
+        commissionee->mDeviceBeingCommissioned         = nullptr;
+        commissionee->mCommissioningStage              = CommissioningStage::kSecurePairing;
+        commissionee->mRunCommissioningAfterConnection = false;
+        return Loop::Continue;
+    });
+}
+
+void DeviceCommissioner::ReleaseCommissionees()
+{
     // Release everything from the commissionee device pool here.
     // Make sure to use ReleaseCommissioneeDevice so we don't keep dangling
     // pointers to the device objects.
@@ -589,7 +808,16 @@ void DeviceCommissioner::Shutdown()
         return Loop::Continue;
     });
 
-    DeviceController::Shutdown();
+    // Commissionees selected by a scope (if we are being shut down from one of their callbacks) are
+    // released when that scope ends. The callbacks still pending with the verifier or the issuer are
+    // detached from the commissionees released here, so that the pool is empty once Shutdown() returns.
+    mCommissionees.ForEachActiveObject([this](CommissioneeState * commissionee) {
+        if (commissionee->mScopeDepth == 0)
+        {
+            ReleaseCommissionee(commissionee);
+        }
+        return Loop::Continue;
+    });
 }
 
 CommissioneeDeviceProxy * DeviceCommissioner::FindCommissioneeDevice(NodeId id)
@@ -644,14 +872,17 @@ void DeviceCommissioner::ReleaseCommissioneeDevice(CommissioneeDeviceProxy * dev
 #endif
 
     // Make sure that there will be no dangling pointer
-    if (mDeviceInPASEEstablishment == device)
-    {
-        mDeviceInPASEEstablishment = nullptr;
-    }
-    if (mDeviceBeingCommissioned == device)
-    {
-        mDeviceBeingCommissioned = nullptr;
-    }
+    mCommissionees.ForEachActiveObject([device](CommissioneeState * commissionee) {
+        if (commissionee->mDeviceInPASEEstablishment == device)
+        {
+            commissionee->mDeviceInPASEEstablishment = nullptr;
+        }
+        if (commissionee->mDeviceBeingCommissioned == device)
+        {
+            commissionee->mDeviceBeingCommissioned = nullptr;
+        }
+        return Loop::Continue;
+    });
 
     // Release the commissionee device after we have nulled out our pointers,
     // because that can call back in to us with error notifications as the
@@ -730,8 +961,11 @@ CHIP_ERROR DeviceCommissioner::EstablishPASEConnection(NodeId remoteDeviceId, Re
     Messaging::ExchangeContext * exchangeCtxt = nullptr;
     Optional<SessionHandle> session;
 
+    CommissioneeScope scope(*this, FindOrCreateCommissionee(remoteDeviceId));
+
     VerifyOrExit(mState == State::Initialized, err = CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrExit(mDeviceInPASEEstablishment == nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(mCommissionee != nullptr, err = CHIP_ERROR_NO_MEMORY);
+    VerifyOrExit(mCommissionee->mDeviceInPASEEstablishment == nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
     // TODO(#13940): We need to specify the peer address for BLE transport in bindings.
     if (params.GetPeerAddress().GetTransportType() == Transport::Type::kBle ||
@@ -761,6 +995,12 @@ CHIP_ERROR DeviceCommissioner::EstablishPASEConnection(NodeId remoteDeviceId, Re
     }
 #endif // CHIP_DEVICE_CONFIG_ENABLE_WIFIPAF
 
+    if (!CanEstablishPASE(peerAddress.GetTransportType()))
+    {
+        ChipLogError(Controller, "Too many PASE sessions being established");
+        ExitNow(err = CHIP_ERROR_INCORRECT_STATE);
+    }
+
     current = FindCommissioneeDevice(peerAddress);
     if (current != nullptr)
     {
@@ -770,11 +1010,12 @@ CHIP_ERROR DeviceCommissioner::EstablishPASEConnection(NodeId remoteDeviceId, Re
             // working on one.
             if (current->IsSecureConnected())
             {
-                if (mPairingDelegate)
+                DevicePairingDelegate * pairingDelegate = PairingDelegateForCommissionee();
+                if (pairingDelegate)
                 {
                     // We already have an open secure session to this device, call the callback immediately and early return.
                     // We don't know what the right RendezvousParameters are here.
-                    mPairingDelegate->OnPairingComplete(CHIP_NO_ERROR, std::nullopt, std::nullopt);
+                    pairingDelegate->OnPairingComplete(CHIP_NO_ERROR, std::nullopt, std::nullopt);
                 }
                 MATTER_LOG_METRIC_END(kMetricDeviceCommissionerPASESession, CHIP_NO_ERROR);
                 return CHIP_NO_ERROR;
@@ -798,7 +1039,7 @@ CHIP_ERROR DeviceCommissioner::EstablishPASEConnection(NodeId remoteDeviceId, Re
     device = mCommissioneeDevicePool.CreateObject();
     VerifyOrExit(device != nullptr, err = CHIP_ERROR_NO_MEMORY);
 
-    mDeviceInPASEEstablishment = device;
+    mCommissionee->mDeviceInPASEEstablishment = device;
     device->Init(GetControllerDeviceInitParams(), remoteDeviceId, peerAddress);
     device->UpdateDeviceData(params.GetPeerAddress(), params.GetMRPConfig());
 
@@ -872,10 +1113,11 @@ CHIP_ERROR DeviceCommissioner::EstablishPASEConnection(NodeId remoteDeviceId, Re
     exchangeCtxt = mSystemState->ExchangeMgr()->NewContext(session.Value(), &device->GetPairing());
     VerifyOrExit(exchangeCtxt != nullptr, err = CHIP_ERROR_INTERNAL);
 
-    err = device->GetPairing().Pair(*mSystemState->SessionMgr(), params.GetSetupPINCode(), GetLocalMRPConfig(), exchangeCtxt, this);
+    err = device->GetPairing().Pair(*mSystemState->SessionMgr(), params.GetSetupPINCode(), GetLocalMRPConfig(), exchangeCtxt,
+                                     mCommissionee);
     SuccessOrExit(err);
 
-    mRendezvousParametersForPASEEstablishment = params;
+    mCommissionee->mRendezvousParametersForPASEEstablishment = params;
 
 exit:
     if (err != CHIP_NO_ERROR)
@@ -893,8 +1135,10 @@ exit:
 #if CONFIG_NETWORK_LAYER_BLE
 void DeviceCommissioner::OnDiscoveredDeviceOverBleSuccess(void * appState, BLE_CONNECTION_OBJECT connObj)
 {
-    auto self   = static_cast<DeviceCommissioner *>(appState);
-    auto device = self->mDeviceInPASEEstablishment;
+    auto self = static_cast<DeviceCommissioner *>(appState);
+    CommissioneeScope scope(*self, self->FindCommissioneeEstablishingPASE(Transport::Type::kBle));
+    VerifyOrReturn(self->mCommissionee != nullptr);
+    auto device = self->mCommissionee->mDeviceInPASEEstablishment;
 
     if (nullptr != device && device->GetDeviceTransportType() == Transport::Type::kBle)
     {
@@ -911,8 +1155,10 @@ void DeviceCommissioner::OnDiscoveredDeviceOverBleSuccess(void * appState, BLE_C
 
 void DeviceCommissioner::OnDiscoveredDeviceOverBleError(void * appState, CHIP_ERROR err)
 {
-    auto self   = static_cast<DeviceCommissioner *>(appState);
-    auto device = self->mDeviceInPASEEstablishment;
+    auto self = static_cast<DeviceCommissioner *>(appState);
+    CommissioneeScope scope(*self, self->FindCommissioneeEstablishingPASE(Transport::Type::kBle));
+    VerifyOrReturn(self->mCommissionee != nullptr);
+    auto device = self->mCommissionee->mDeviceInPASEEstablishment;
 
     if (nullptr != device && device->GetDeviceTransportType() == Transport::Type::kBle)
     {
@@ -921,9 +1167,10 @@ void DeviceCommissioner::OnDiscoveredDeviceOverBleError(void * appState, CHIP_ER
 
         // Callback is required when BLE discovery fails, otherwise the caller will always be in a suspended state
         // A better way to handle it should define a new error code
-        if (self->mPairingDelegate != nullptr)
+        DevicePairingDelegate * pairingDelegate = self->PairingDelegateForCommissionee();
+        if (pairingDelegate != nullptr)
         {
-            self->mPairingDelegate->OnPairingComplete(err, std::nullopt, std::nullopt);
+            pairingDelegate->OnPairingComplete(err, std::nullopt, std::nullopt);
         }
     }
 }
@@ -932,8 +1179,10 @@ void DeviceCommissioner::OnDiscoveredDeviceOverBleError(void * appState, CHIP_ER
 #if CHIP_DEVICE_CONFIG_ENABLE_WIFIPAF
 void DeviceCommissioner::OnWiFiPAFSubscribeComplete(void * appState)
 {
-    auto self   = reinterpret_cast<DeviceCommissioner *>(appState);
-    auto device = self->mDeviceInPASEEstablishment;
+    auto self = reinterpret_cast<DeviceCommissioner *>(appState);
+    CommissioneeScope scope(*self, self->FindCommissioneeEstablishingPASE(Transport::Type::kWiFiPAF));
+    VerifyOrReturn(self->mCommissionee != nullptr);
+    auto device = self->mCommissionee->mDeviceInPASEEstablishment;
 
     if (nullptr != device && device->GetDeviceTransportType() == Transport::Type::kWiFiPAF)
     {
@@ -949,8 +1198,10 @@ void DeviceCommissioner::OnWiFiPAFSubscribeComplete(void * appState)
 
 void DeviceCommissioner::OnWiFiPAFSubscribeError(void * appState, CHIP_ERROR err)
 {
-    auto self   = (DeviceCommissioner *) appState;
-    auto device = self->mDeviceInPASEEstablishment;
+    auto self = (DeviceCommissioner *) appState;
+    CommissioneeScope scope(*self, self->FindCommissioneeEstablishingPASE(Transport::Type::kWiFiPAF));
+    VerifyOrReturn(self->mCommissionee != nullptr);
+    auto device = self->mCommissionee->mDeviceInPASEEstablishment;
 
     if (nullptr != device && device->GetDeviceTransportType() == Transport::Type::kWiFiPAF)
     {
@@ -958,9 +1209,10 @@ void DeviceCommissioner::OnWiFiPAFSubscribeError(void * appState, CHIP_ERROR err
                      err.Format());
         self->ReleaseCommissioneeDevice(device);
         self->mRendezvousParametersForDeviceDiscoveredOverWiFiPAF = RendezvousParameters();
-        if (self->mPairingDelegate != nullptr)
+        DevicePairingDelegate * pairingDelegate = self->PairingDelegateForCommissionee();
+        if (pairingDelegate != nullptr)
         {
-            self->mPairingDelegate->OnPairingComplete(err, std::nullopt, std::nullopt);
+            pairingDelegate->OnPairingComplete(err, std::nullopt, std::nullopt);
         }
     }
 }
@@ -968,7 +1220,10 @@ void DeviceCommissioner::OnWiFiPAFSubscribeError(void * appState, CHIP_ERROR err
 
 CHIP_ERROR DeviceCommissioner::Commission(NodeId remoteDeviceId, CommissioningParameters & params)
 {
-    ReturnErrorOnFailureWithMetric(kMetricDeviceCommissionerCommission, mDefaultCommissioner->SetCommissioningParameters(params));
+    CommissioneeScope scope(*this, FindOrCreateCommissionee(remoteDeviceId));
+    VerifyOrReturnErrorWithMetric(kMetricDeviceCommissionerCommission, mCommissionee != nullptr, CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailureWithMetric(kMetricDeviceCommissionerCommission,
+                                   mCommissionee->mDefaultCommissioner->SetCommissioningParameters(params));
     auto errorCode = Commission(remoteDeviceId);
     VerifyOrDoWithMetric(kMetricDeviceCommissionerCommission, CHIP_NO_ERROR == errorCode, errorCode);
     return errorCode;
@@ -978,37 +1233,54 @@ CHIP_ERROR DeviceCommissioner::Commission(NodeId remoteDeviceId)
 {
     MATTER_TRACE_SCOPE("Commission", "DeviceCommissioner");
 
+    CommissioneeScope scope(*this, FindOrCreateCommissionee(remoteDeviceId));
+    VerifyOrReturnError(mCommissionee != nullptr, CHIP_ERROR_NO_MEMORY);
+
     CommissioneeDeviceProxy * device = FindCommissioneeDevice(remoteDeviceId);
     if (device == nullptr || (!device->IsSecureConnected() && !device->IsSessionSetupInProgress()))
     {
         ChipLogError(Controller, "Invalid device for commissioning " ChipLogFormatX64, ChipLogValueX64(remoteDeviceId));
         return CHIP_ERROR_INCORRECT_STATE;
     }
-    if (!device->IsSecureConnected() && device != mDeviceInPASEEstablishment)
+    if (!device->IsSecureConnected() && device != mCommissionee->mDeviceInPASEEstablishment)
     {
         // We should not end up in this state because we won't attempt to establish more than one connection at a time.
         ChipLogError(Controller, "Device is not connected and not being paired " ChipLogFormatX64, ChipLogValueX64(remoteDeviceId));
         return CHIP_ERROR_INCORRECT_STATE;
     }
 
-    if (mCommissioningStage != CommissioningStage::kSecurePairing)
+    if (mCommissionee->mCommissioningStage != CommissioningStage::kSecurePairing)
     {
         ChipLogError(Controller, "Commissioning already in progress (stage '%s') - not restarting",
-                     StageToString(mCommissioningStage));
+                     StageToString(mCommissionee->mCommissioningStage));
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    // Commissionees sharing the default commissioner have to take turns.
+    size_t maxConcurrent = UsesPerCommissioneeCommissioner() ? CHIP_CONFIG_MAX_CONCURRENT_COMMISSIONEES : 1;
+    size_t inProgress    = 0;
+    mCommissionees.ForEachActiveObject([&](CommissioneeState * commissionee) {
+        inProgress += (commissionee != mCommissionee && commissionee->IsCommissioning()) ? 1 : 0;
+        return Loop::Continue;
+    });
+    if (inProgress >= maxConcurrent)
+    {
+        ChipLogError(Controller, "Commissioning already in progress for %u device(s) - not starting",
+                     static_cast<unsigned>(inProgress));
         return CHIP_ERROR_INCORRECT_STATE;
     }
 
     ChipLogProgress(Controller, "Commission called for node ID 0x" ChipLogFormatX64, ChipLogValueX64(remoteDeviceId));
 
-    mDefaultCommissioner->SetOperationalCredentialsDelegate(mOperationalCredentialsDelegate);
+    mCommissionee->mDefaultCommissioner->SetOperationalCredentialsDelegate(mOperationalCredentialsDelegate);
     if (device->IsSecureConnected())
     {
         MATTER_LOG_METRIC_BEGIN(kMetricDeviceCommissionerCommission);
-        mDefaultCommissioner->StartCommissioning(this, device);
+        mCommissionee->mDefaultCommissioner->StartCommissioning(this, device);
     }
     else
     {
-        mRunCommissioningAfterConnection = true;
+        mCommissionee->mRunCommissioningAfterConnection = true;
     }
     return CHIP_NO_ERROR;
 }
@@ -1019,7 +1291,8 @@ DeviceCommissioner::ContinueCommissioningAfterDeviceAttestation(DeviceProxy * de
 {
     MATTER_TRACE_SCOPE("continueCommissioningDevice", "DeviceCommissioner");
 
-    if (device == nullptr || device != mDeviceBeingCommissioned)
+    CommissioneeScope scope(*this, (device != nullptr) ? ResolveCommissionee(device->GetDeviceId()) : nullptr);
+    if (device == nullptr || mCommissionee == nullptr || device != mCommissionee->mDeviceBeingCommissioned)
     {
         ChipLogError(Controller, "Invalid device for commissioning %p", device);
         return CHIP_ERROR_INCORRECT_STATE;
@@ -1030,14 +1303,14 @@ DeviceCommissioner::ContinueCommissioningAfterDeviceAttestation(DeviceProxy * de
         ChipLogError(Controller, "Couldn't find commissionee device");
         return CHIP_ERROR_INCORRECT_STATE;
     }
-    if (!commissioneeDevice->IsSecureConnected() || commissioneeDevice != mDeviceBeingCommissioned)
+    if (!commissioneeDevice->IsSecureConnected() || commissioneeDevice != mCommissionee->mDeviceBeingCommissioned)
     {
         ChipLogError(Controller, "Invalid device for commissioning after attestation failure: 0x" ChipLogFormatX64,
                      ChipLogValueX64(commissioneeDevice->GetDeviceId()));
         return CHIP_ERROR_INCORRECT_STATE;
     }
 
-    if (mCommissioningStage != CommissioningStage::kAttestationRevocationCheck)
+    if (mCommissionee->mCommissioningStage != CommissioningStage::kAttestationRevocationCheck)
     {
         ChipLogError(Controller, "Commissioning is not attestation verification phase");
         return CHIP_ERROR_INCORRECT_STATE;
@@ -1068,13 +1341,16 @@ CHIP_ERROR DeviceCommissioner::ContinueCommissioningAfterConnectNetworkRequest(N
 {
     MATTER_TRACE_SCOPE("continueCommissioningAfterConnectNetworkRequest", "DeviceCommissioner");
 
+    CommissioneeScope scope(*this, FindOrCreateCommissionee(remoteDeviceId));
+    VerifyOrReturnError(mCommissionee != nullptr, CHIP_ERROR_NO_MEMORY);
+
     // Move to kEvictPreviousCaseSessions stage since the next stage will be to find the device
     // on the operational network
-    mCommissioningStage = CommissioningStage::kEvictPreviousCaseSessions;
+    mCommissionee->mCommissioningStage = CommissioningStage::kEvictPreviousCaseSessions;
 
     // Setup device being commissioned
     CommissioneeDeviceProxy * device = nullptr;
-    if (!mDeviceBeingCommissioned)
+    if (!mCommissionee->mDeviceBeingCommissioned)
     {
         device = mCommissioneeDevicePool.CreateObject();
         if (!device)
@@ -1082,16 +1358,16 @@ CHIP_ERROR DeviceCommissioner::ContinueCommissioningAfterConnectNetworkRequest(N
 
         Transport::PeerAddress peerAddress = Transport::PeerAddress::UDP(Inet::IPAddress::Any);
         device->Init(GetControllerDeviceInitParams(), remoteDeviceId, peerAddress);
-        mDeviceBeingCommissioned = device;
+        mCommissionee->mDeviceBeingCommissioned = device;
     }
 
-    mDefaultCommissioner->SetOperationalCredentialsDelegate(mOperationalCredentialsDelegate);
+    mCommissionee->mDefaultCommissioner->SetOperationalCredentialsDelegate(mOperationalCredentialsDelegate);
 
     ChipLogProgress(Controller, "Continuing commissioning after connect to network complete for device ID 0x" ChipLogFormatX64,
                     ChipLogValueX64(remoteDeviceId));
 
     MATTER_LOG_METRIC_BEGIN(kMetricDeviceCommissioningOperationalSetup);
-    CHIP_ERROR err = mDefaultCommissioner->StartCommissioning(this, device);
+    CHIP_ERROR err = mCommissionee->mDefaultCommissioner->StartCommissioning(this, device);
     if (err != CHIP_NO_ERROR)
     {
         MATTER_LOG_METRIC_END(kMetricDeviceCommissioningOperationalSetup, err);
@@ -1107,10 +1383,15 @@ CHIP_ERROR DeviceCommissioner::StopPairing(NodeId remoteDeviceId)
 
     ChipLogProgress(Controller, "StopPairing called for node ID 0x" ChipLogFormatX64, ChipLogValueX64(remoteDeviceId));
 
+    CommissioneeScope scope(*this, FindCommissionee(remoteDeviceId));
+
     // If we're still in the process of discovering the device, just stop the SetUpCodePairer
     if (mSetUpCodePairer.StopPairing(remoteDeviceId))
     {
-        mRunCommissioningAfterConnection = false;
+        if (mCommissionee != nullptr)
+        {
+            mCommissionee->mRunCommissioningAfterConnection = false;
+        }
         OnSessionEstablishmentError(CHIP_ERROR_CANCELLED);
         return CHIP_NO_ERROR;
     }
@@ -1119,7 +1400,7 @@ CHIP_ERROR DeviceCommissioner::StopPairing(NodeId remoteDeviceId)
     CommissioneeDeviceProxy * device = FindCommissioneeDevice(remoteDeviceId);
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR);
 
-    if (mDeviceBeingCommissioned == device)
+    if (mCommissionee != nullptr && mCommissionee->mDeviceBeingCommissioned == device)
     {
         CancelCommissioningInteractions();
         CommissioningStageComplete(CHIP_ERROR_CANCELLED);
@@ -1133,37 +1414,37 @@ CHIP_ERROR DeviceCommissioner::StopPairing(NodeId remoteDeviceId)
 
 void DeviceCommissioner::CancelCommissioningInteractions()
 {
-    if (mReadClient)
+    if (mCommissionee->mReadClient)
     {
-        ChipLogDetail(Controller, "Cancelling read request for step '%s'", StageToString(mCommissioningStage));
-        mReadClient.reset(); // destructor cancels
-        mAttributeCache.reset();
+        ChipLogDetail(Controller, "Cancelling read request for step '%s'", StageToString(mCommissionee->mCommissioningStage));
+        mCommissionee->mReadClient.reset(); // destructor cancels
+        mCommissionee->mAttributeCache.reset();
     }
-    if (mInvokeCancelFn)
+    if (mCommissionee->mInvokeCancelFn)
     {
-        ChipLogDetail(Controller, "Cancelling command invocation for step '%s'", StageToString(mCommissioningStage));
-        mInvokeCancelFn();
-        mInvokeCancelFn = nullptr;
+        ChipLogDetail(Controller, "Cancelling command invocation for step '%s'", StageToString(mCommissionee->mCommissioningStage));
+        mCommissionee->mInvokeCancelFn();
+        mCommissionee->mInvokeCancelFn = nullptr;
     }
-    if (mWriteCancelFn)
+    if (mCommissionee->mWriteCancelFn)
     {
-        ChipLogDetail(Controller, "Cancelling write request for step '%s'", StageToString(mCommissioningStage));
-        mWriteCancelFn();
-        mWriteCancelFn = nullptr;
+        ChipLogDetail(Controller, "Cancelling write request for step '%s'", StageToString(mCommissionee->mCommissioningStage));
+        mCommissionee->mWriteCancelFn();
+        mCommissionee->mWriteCancelFn = nullptr;
     }
-    if (mOnDeviceConnectedCallback.IsRegistered())
+    if (mCommissionee->mOnDeviceConnectedCallback.IsRegistered())
     {
-        ChipLogDetail(Controller, "Cancelling CASE setup for step '%s'", StageToString(mCommissioningStage));
+        ChipLogDetail(Controller, "Cancelling CASE setup for step '%s'", StageToString(mCommissionee->mCommissioningStage));
         CancelCASECallbacks();
     }
 }
 
 void DeviceCommissioner::CancelCASECallbacks()
 {
-    mOnDeviceConnectedCallback.Cancel();
-    mOnDeviceConnectionFailureCallback.Cancel();
+    mCommissionee->mOnDeviceConnectedCallback.Cancel();
+    mCommissionee->mOnDeviceConnectionFailureCallback.Cancel();
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
-    mOnDeviceConnectionRetryCallback.Cancel();
+    mCommissionee->mOnDeviceConnectionRetryCallback.Cancel();
 #endif
 }
 
@@ -1177,16 +1458,18 @@ CHIP_ERROR DeviceCommissioner::UnpairDevice(NodeId remoteDeviceId)
 
 void DeviceCommissioner::RendezvousCleanup(CHIP_ERROR status)
 {
-    if (mDeviceInPASEEstablishment != nullptr)
+    if (mCommissionee != nullptr && mCommissionee->mDeviceInPASEEstablishment != nullptr)
     {
+        DevicePairingDelegate * pairingDelegate = PairingDelegateForCommissionee();
+
         // Release the commissionee device. For BLE, this is stored,
         // for IP commissioning, we have taken a reference to the
         // operational node to send the completion command.
-        ReleaseCommissioneeDevice(mDeviceInPASEEstablishment);
+        ReleaseCommissioneeDevice(mCommissionee->mDeviceInPASEEstablishment);
 
-        if (mPairingDelegate != nullptr)
+        if (pairingDelegate != nullptr)
         {
-            mPairingDelegate->OnPairingComplete(status, std::nullopt, std::nullopt);
+            pairingDelegate->OnPairingComplete(status, std::nullopt, std::nullopt);
         }
     }
 }
@@ -1195,11 +1478,15 @@ void DeviceCommissioner::OnSessionEstablishmentError(CHIP_ERROR err)
 {
     MATTER_LOG_METRIC_END(kMetricDeviceCommissionerPASESession, err);
 
-    mRendezvousParametersForPASEEstablishment.reset();
+    if (mCommissionee != nullptr)
+    {
+        mCommissionee->mRendezvousParametersForPASEEstablishment.reset();
+    }
 
-    if (mPairingDelegate != nullptr)
+    DevicePairingDelegate * pairingDelegate = PairingDelegateForCommissionee();
+    if (pairingDelegate != nullptr)
     {
-        mPairingDelegate->OnStatusUpdate(DevicePairingDelegate::SecurePairingFailed);
+        pairingDelegate->OnStatusUpdate(DevicePairingDelegate::SecurePairingFailed);
     }
 
     RendezvousCleanup(err);
@@ -1207,16 +1494,18 @@ void DeviceCommissioner::OnSessionEstablishmentError(CHIP_ERROR err)
 
 void DeviceCommissioner::OnSessionEstablished(const SessionHandle & session)
 {
+    VerifyOrReturn(mCommissionee != nullptr);
+
     // PASE session established.
-    CommissioneeDeviceProxy * device = mDeviceInPASEEstablishment;
+    CommissioneeDeviceProxy * device = mCommissionee->mDeviceInPASEEstablishment;
 
     // We are in the callback for this pairing. Reset so we can pair another device.
-    mDeviceInPASEEstablishment = nullptr;
+    mCommissionee->mDeviceInPASEEstablishment = nullptr;
 
     // Make sure to clear out mRendezvousParametersForPASEEstablishment no
     // matter what.
     std::optional<RendezvousParameters> paseParameters;
-    paseParameters.swap(mRendezvousParametersForPASEEstablishment);
+    paseParameters.swap(mCommissionee->mRendezvousParametersForPASEEstablishment);
 
     VerifyOrReturn(device != nullptr, OnSessionEstablishmentError(CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR));
 
@@ -1231,20 +1520,21 @@ void DeviceCommissioner::OnSessionEstablished(const SessionHandle & session)
     ChipLogDetail(Controller, "Remote device completed SPAKE2+ handshake");
 
     MATTER_LOG_METRIC_END(kMetricDeviceCommissionerPASESession, CHIP_NO_ERROR);
-    if (mPairingDelegate != nullptr)
+    DevicePairingDelegate * pairingDelegate = PairingDelegateForCommissionee();
+    if (pairingDelegate != nullptr)
     {
         // If we started with a string payload, then at this point mPairingDelegate is
         // mSetUpCodePairer, and it will provide the right SetupPayload argument to
         // OnPairingComplete as needed.  If mPairingDelegate is not
         // mSetUpCodePairer, then we don't have a SetupPayload to provide.
-        mPairingDelegate->OnPairingComplete(CHIP_NO_ERROR, paseParameters, std::nullopt);
+        pairingDelegate->OnPairingComplete(CHIP_NO_ERROR, paseParameters, std::nullopt);
     }
 
-    if (mRunCommissioningAfterConnection)
+    if (mCommissionee->mRunCommissioningAfterConnection)
     {
-        mRunCommissioningAfterConnection = false;
+        mCommissionee->mRunCommissioningAfterConnection = false;
         MATTER_LOG_METRIC_BEGIN(kMetricDeviceCommissionerCommission);
-        mDefaultCommissioner->StartCommissioning(this, device);
+        mCommissionee->mDefaultCommissioner->StartCommissioning(this, device);
     }
 }
 
@@ -1267,7 +1557,8 @@ void DeviceCommissioner::OnCertificateChainFailureResponse(void * context, CHIP_
     MATTER_TRACE_SCOPE("OnCertificateChainFailureResponse", "DeviceCommissioner");
     ChipLogProgress(Controller, "Device failed to receive the Certificate Chain request Response: %" CHIP_ERROR_FORMAT,
                     error.Format());
-    DeviceCommissioner * commissioner = reinterpret_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
     commissioner->CommissioningStageComplete(error);
 }
 
@@ -1276,7 +1567,8 @@ void DeviceCommissioner::OnCertificateChainResponse(
 {
     MATTER_TRACE_SCOPE("OnCertificateChainResponse", "DeviceCommissioner");
     ChipLogProgress(Controller, "Received certificate chain from the device");
-    DeviceCommissioner * commissioner = reinterpret_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
 
     CommissioningDelegate::CommissioningReport report;
     report.Set<RequestedCertificate>(RequestedCertificate(response.certificate));
@@ -1305,7 +1597,8 @@ void DeviceCommissioner::OnAttestationFailureResponse(void * context, CHIP_ERROR
     MATTER_TRACE_SCOPE("OnAttestationFailureResponse", "DeviceCommissioner");
     ChipLogProgress(Controller, "Device failed to receive the Attestation Information Response: %" CHIP_ERROR_FORMAT,
                     error.Format());
-    DeviceCommissioner * commissioner = reinterpret_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
     commissioner->CommissioningStageComplete(error);
 }
 
@@ -1314,7 +1607,8 @@ void DeviceCommissioner::OnAttestationResponse(void * context,
 {
     MATTER_TRACE_SCOPE("OnAttestationResponse", "DeviceCommissioner");
     ChipLogProgress(Controller, "Received Attestation Information from the device");
-    DeviceCommissioner * commissioner = reinterpret_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
 
     CommissioningDelegate::CommissioningReport report;
     report.Set<AttestationResponse>(AttestationResponse(data.attestationElements, data.attestationSignature));
@@ -1325,9 +1619,12 @@ void DeviceCommissioner::OnDeviceAttestationInformationVerification(
     void * context, const Credentials::DeviceAttestationVerifier::AttestationInfo & info, AttestationVerificationResult result)
 {
     MATTER_TRACE_SCOPE("OnDeviceAttestationInformationVerification", "DeviceCommissioner");
-    DeviceCommissioner * commissioner = reinterpret_cast<DeviceCommissioner *>(context);
+    CommissioneeState * commissionee = AsyncCallbacks::Complete(context);
+    VerifyOrReturn(commissionee != nullptr); // released, e.g. by Shutdown()
+    CommissioneeScope scope(commissionee);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
 
-    if (commissioner->mCommissioningStage == CommissioningStage::kAttestationVerification)
+    if (commissioner->mCommissionee->mCommissioningStage == CommissioningStage::kAttestationVerification)
     {
         // Check for revoked DAC Chain before calling delegate. Enter next stage.
 
@@ -1338,13 +1635,13 @@ void DeviceCommissioner::OnDeviceAttestationInformationVerification(
             result == AttestationVerificationResult::kSuccess ? CHIP_NO_ERROR : CHIP_ERROR_FAILED_DEVICE_ATTESTATION, report);
     }
 
-    if (!commissioner->mDeviceBeingCommissioned)
+    if (!commissioner->mCommissionee->mDeviceBeingCommissioned)
     {
         ChipLogError(Controller, "Device attestation verification result received when we're not commissioning a device");
         return;
     }
 
-    auto & params = commissioner->mDefaultCommissioner->GetCommissioningParameters();
+    auto & params                                                      = commissioner->GetCommissioningParameters();
     Credentials::DeviceAttestationDelegate * deviceAttestationDelegate = params.GetDeviceAttestationDelegate();
 
     if (params.GetCompletionStatus().attestationResult.HasValue())
@@ -1403,37 +1700,39 @@ void DeviceCommissioner::OnArmFailSafeExtendedForDeviceAttestation(
     void * context, const GeneralCommissioning::Commands::ArmFailSafeResponse::DecodableType &)
 {
     ChipLogProgress(Controller, "Successfully extended fail-safe timer to handle DA failure");
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
 
     // We have completed our command invoke, but we're not going to finish the
     // commissioning step until our client examines the attestation
     // information.  Clear out mInvokeCancelFn (which points at the
     // CommandSender we just finished using) now, so it's not dangling.
-    commissioner->mInvokeCancelFn = nullptr;
+    commissioner->mCommissionee->mInvokeCancelFn = nullptr;
 
     commissioner->HandleDeviceAttestationCompleted();
 }
 
 void DeviceCommissioner::HandleDeviceAttestationCompleted()
 {
-    if (!mDeviceBeingCommissioned)
+    if (!mCommissionee->mDeviceBeingCommissioned)
     {
         return;
     }
 
-    auto & params                                                      = mDefaultCommissioner->GetCommissioningParameters();
+    auto & params                                                      = GetCommissioningParameters();
     Credentials::DeviceAttestationDelegate * deviceAttestationDelegate = params.GetDeviceAttestationDelegate();
     if (deviceAttestationDelegate)
     {
         ChipLogProgress(Controller, "Device attestation completed, delegating continuation to client");
-        deviceAttestationDelegate->OnDeviceAttestationCompleted(this, mDeviceBeingCommissioned, *mAttestationDeviceInfo,
-                                                                mAttestationResult);
+        deviceAttestationDelegate->OnDeviceAttestationCompleted(this, mCommissionee->mDeviceBeingCommissioned,
+                                                                *mCommissionee->mAttestationDeviceInfo,
+                                                                mCommissionee->mAttestationResult);
     }
     else
     {
         ChipLogError(Controller, "Need to wait for device attestation delegate, but no delegate available. Failing commissioning");
         CommissioningDelegate::CommissioningReport report;
-        report.Set<AttestationErrorInfo>(mAttestationResult);
+        report.Set<AttestationErrorInfo>(mCommissionee->mAttestationResult);
         CommissioningStageComplete(CHIP_ERROR_INTERNAL, report);
     }
 }
@@ -1442,26 +1741,29 @@ void DeviceCommissioner::OnFailedToExtendedArmFailSafeDeviceAttestation(void * c
 {
     ChipLogProgress(Controller, "Failed to extend fail-safe timer to handle attestation failure: %" CHIP_ERROR_FORMAT,
                     error.Format());
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
 
     CommissioningDelegate::CommissioningReport report;
-    report.Set<AttestationErrorInfo>(commissioner->mAttestationResult);
+    report.Set<AttestationErrorInfo>(commissioner->mCommissionee->mAttestationResult);
     commissioner->CommissioningStageComplete(CHIP_ERROR_INTERNAL, report);
 }
 
 void DeviceCommissioner::OnICDManagementRegisterClientResponse(
     void * context, const app::Clusters::IcdManagement::Commands::RegisterClientResponse::DecodableType & data)
 {
-    CHIP_ERROR err                    = CHIP_NO_ERROR;
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
-    VerifyOrExit(commissioner != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(commissioner->mCommissioningStage == CommissioningStage::kICDRegistration, err = CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrExit(commissioner->mDeviceBeingCommissioned != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+    CommissioneeScope scope(context);
+    CHIP_ERROR err                          = CHIP_NO_ERROR;
+    DeviceCommissioner * commissioner       = scope.GetCommissioner();
+    CommissioneeState * commissionee        = commissioner->mCommissionee;
+    DevicePairingDelegate * pairingDelegate = commissioner->PairingDelegateForCommissionee();
+    VerifyOrExit(commissionee->mCommissioningStage == CommissioningStage::kICDRegistration, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(commissionee->mDeviceBeingCommissioned != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
-    if (commissioner->mPairingDelegate != nullptr)
+    if (pairingDelegate != nullptr)
     {
-        commissioner->mPairingDelegate->OnICDRegistrationComplete(
-            ScopedNodeId(commissioner->mDeviceBeingCommissioned->GetDeviceId(), commissioner->GetFabricIndex()), data.ICDCounter);
+        pairingDelegate->OnICDRegistrationComplete(
+            ScopedNodeId(commissionee->mDeviceBeingCommissioned->GetDeviceId(), commissioner->GetFabricIndex()), data.ICDCounter);
     }
 
 exit:
@@ -1472,17 +1774,19 @@ exit:
 void DeviceCommissioner::OnICDManagementStayActiveResponse(
     void * context, const app::Clusters::IcdManagement::Commands::StayActiveResponse::DecodableType & data)
 {
-    CHIP_ERROR err                    = CHIP_NO_ERROR;
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
-    VerifyOrExit(commissioner != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(commissioner->mCommissioningStage == CommissioningStage::kICDSendStayActive, err = CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrExit(commissioner->mDeviceBeingCommissioned != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+    CommissioneeScope scope(context);
+    CHIP_ERROR err                          = CHIP_NO_ERROR;
+    DeviceCommissioner * commissioner       = scope.GetCommissioner();
+    CommissioneeState * commissionee        = commissioner->mCommissionee;
+    DevicePairingDelegate * pairingDelegate = commissioner->PairingDelegateForCommissionee();
+    VerifyOrExit(commissionee->mCommissioningStage == CommissioningStage::kICDSendStayActive, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(commissionee->mDeviceBeingCommissioned != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
-    if (commissioner->mPairingDelegate != nullptr)
+    if (pairingDelegate != nullptr)
     {
-        commissioner->mPairingDelegate->OnICDStayActiveComplete(
+        pairingDelegate->OnICDStayActiveComplete(
 
-            ScopedNodeId(commissioner->mDeviceBeingCommissioned->GetDeviceId(), commissioner->GetFabricIndex()),
+            ScopedNodeId(commissionee->mDeviceBeingCommissioned->GetDeviceId(), commissioner->GetFabricIndex()),
             data.promisedActiveDuration);
     }
 
@@ -1516,7 +1820,7 @@ bool DeviceCommissioner::ExtendArmFailSafeInternal(DeviceProxy * proxy, Commissi
     CHIP_ERROR err = SendCommissioningCommand(proxy, request, onSuccess, onFailure, kRootEndpointId, commandTimeout, fireAndForget);
     if (err != CHIP_NO_ERROR)
     {
-        onFailure((!fireAndForget) ? this : nullptr, err);
+        onFailure((!fireAndForget) ? mCommissionee : nullptr, err);
         return true; // we have called onFailure already
     }
 
@@ -1528,12 +1832,13 @@ bool DeviceCommissioner::ExtendArmFailSafeInternal(DeviceProxy * proxy, Commissi
 void DeviceCommissioner::ExtendArmFailSafeForDeviceAttestation(const Credentials::DeviceAttestationVerifier::AttestationInfo & info,
                                                                Credentials::AttestationVerificationResult result)
 {
-    mAttestationResult = result;
+    mCommissionee->mAttestationResult = result;
 
-    auto & params                                                      = mDefaultCommissioner->GetCommissioningParameters();
+    auto & params                                                      = GetCommissioningParameters();
     Credentials::DeviceAttestationDelegate * deviceAttestationDelegate = params.GetDeviceAttestationDelegate();
 
-    mAttestationDeviceInfo = Platform::MakeUnique<Credentials::DeviceAttestationVerifier::AttestationDeviceInfo>(info);
+    mCommissionee->mAttestationDeviceInfo =
+        Platform::MakeUnique<Credentials::DeviceAttestationVerifier::AttestationDeviceInfo>(info);
 
     auto expiryLengthSeconds      = deviceAttestationDelegate->FailSafeExpiryTimeoutSecs();
     bool waitForFailsafeExtension = expiryLengthSeconds.HasValue();
@@ -1542,10 +1847,10 @@ void DeviceCommissioner::ExtendArmFailSafeForDeviceAttestation(const Credentials
         ChipLogProgress(Controller, "Changing fail-safe timer to %u seconds to handle DA failure", expiryLengthSeconds.Value());
         // Per spec, anything we do with the fail-safe armed must not time out
         // in less than kMinimumCommissioningStepTimeout.
-        waitForFailsafeExtension =
-            ExtendArmFailSafeInternal(mDeviceBeingCommissioned, mCommissioningStage, expiryLengthSeconds.Value(),
-                                      MakeOptional(kMinimumCommissioningStepTimeout), OnArmFailSafeExtendedForDeviceAttestation,
-                                      OnFailedToExtendedArmFailSafeDeviceAttestation, /* fireAndForget = */ false);
+        waitForFailsafeExtension = ExtendArmFailSafeInternal(
+            mCommissionee->mDeviceBeingCommissioned, mCommissionee->mCommissioningStage, expiryLengthSeconds.Value(),
+            MakeOptional(kMinimumCommissioningStepTimeout), OnArmFailSafeExtendedForDeviceAttestation,
+            OnFailedToExtendedArmFailSafeDeviceAttestation, /* fireAndForget = */ false);
     }
     else
     {
@@ -1564,7 +1869,13 @@ CHIP_ERROR DeviceCommissioner::ValidateAttestationInfo(const Credentials::Device
     VerifyOrReturnError(mState == State::Initialized, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mDeviceAttestationVerifier != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    mDeviceAttestationVerifier->VerifyAttestationInformation(info, &mDeviceAttestationInformationVerificationCallback);
+    CommissioneeScope scope(*this, ResolveCommissionee());
+    VerifyOrReturnError(mCommissionee != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    // Keeps the commissionee alive until the verifier calls back
+    mCommissionee->mAsyncCallbacks->mPending++;
+    mDeviceAttestationVerifier->VerifyAttestationInformation(
+        info, &mCommissionee->mAsyncCallbacks->mDeviceAttestationInformationVerificationCallback);
 
     // TODO: Validate Firmware Information
 
@@ -1577,8 +1888,11 @@ DeviceCommissioner::CheckForRevokedDACChain(const Credentials::DeviceAttestation
     MATTER_TRACE_SCOPE("CheckForRevokedDACChain", "DeviceCommissioner");
     VerifyOrReturnError(mState == State::Initialized, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mDeviceAttestationVerifier != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mCommissionee != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    mDeviceAttestationVerifier->CheckForRevokedDACChain(info, &mDeviceAttestationInformationVerificationCallback);
+    mCommissionee->mAsyncCallbacks->mPending++;
+    mDeviceAttestationVerifier->CheckForRevokedDACChain(
+        info, &mCommissionee->mAsyncCallbacks->mDeviceAttestationInformationVerificationCallback);
 
     return CHIP_NO_ERROR;
 }
@@ -1622,7 +1936,8 @@ void DeviceCommissioner::OnCSRFailureResponse(void * context, CHIP_ERROR error)
 {
     MATTER_TRACE_SCOPE("OnCSRFailureResponse", "DeviceCommissioner");
     ChipLogProgress(Controller, "Device failed to receive the CSR request Response: %" CHIP_ERROR_FORMAT, error.Format());
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
     commissioner->CommissioningStageComplete(error);
 }
 
@@ -1631,7 +1946,8 @@ void DeviceCommissioner::OnOperationalCertificateSigningRequest(
 {
     MATTER_TRACE_SCOPE("OnOperationalCertificateSigningRequest", "DeviceCommissioner");
     ChipLogProgress(Controller, "Received certificate signing request from the device");
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
 
     CommissioningDelegate::CommissioningReport report;
     report.Set<CSRResponse>(CSRResponse(data.NOCSRElements, data.attestationSignature));
@@ -1643,7 +1959,10 @@ void DeviceCommissioner::OnDeviceNOCChainGeneration(void * context, CHIP_ERROR s
                                                     Optional<NodeId> adminSubject)
 {
     MATTER_TRACE_SCOPE("OnDeviceNOCChainGeneration", "DeviceCommissioner");
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeState * commissionee = AsyncCallbacks::Complete(context);
+    VerifyOrReturn(commissionee != nullptr); // released, e.g. by Shutdown()
+    CommissioneeScope scope(commissionee);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
 
     // The placeholder IPK is not satisfactory, but is there to fill the NocChain struct on error. It will still fail.
     const uint8_t placeHolderIpk[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -1666,6 +1985,12 @@ void DeviceCommissioner::OnDeviceNOCChainGeneration(void * context, CHIP_ERROR s
                      status.Format());
     }
 
+    if (!commissioner->mCommissionee->mDeviceBeingCommissioned)
+    {
+        ChipLogError(Controller, "NOC chain received when we're not commissioning a device");
+        return;
+    }
+
     // TODO - Verify that the generated root cert matches with commissioner's root cert
     CommissioningDelegate::CommissioningReport report;
     report.Set<NocChain>(NocChain(noc, icac, rcac, ipk.HasValue() ? ipk.Value() : IdentityProtectionKeySpan(placeHolderIpk),
@@ -1701,6 +2026,9 @@ CHIP_ERROR DeviceCommissioner::ProcessCSR(DeviceProxy * proxy, const ByteSpan &
     MATTER_TRACE_SCOPE("ProcessOpCSR", "DeviceCommissioner");
     VerifyOrReturnError(mState == State::Initialized, CHIP_ERROR_INCORRECT_STATE);
 
+    CommissioneeScope scope(*this, ResolveCommissionee(proxy->GetDeviceId()));
+    VerifyOrReturnError(mCommissionee != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
     ChipLogProgress(Controller, "Getting certificate chain for the device from the issuer");
 
     P256PublicKey dacPubkey;
@@ -1717,8 +2045,16 @@ CHIP_ERROR DeviceCommissioner::ProcessCSR(DeviceProxy * proxy, const ByteSpan &
         mOperationalCredentialsDelegate->SetFabricIdForNextNOCRequest(GetFabricId());
     }
 
-    return mOperationalCredentialsDelegate->GenerateNOCChain(NOCSRElements, csrNonce, AttestationSignature, attestationChallenge,
-                                                             dac, pai, &mDeviceNOCChainCallback);
+    // Keeps the commissionee alive until the issuer calls back
+    mCommissionee->mAsyncCallbacks->mPending++;
+    CHIP_ERROR err = mOperationalCredentialsDelegate->GenerateNOCChain(NOCSRElements, csrNonce, AttestationSignature,
+                                                                       attestationChallenge, dac, pai,
+                                                                       &mCommissionee->mAsyncCallbacks->mDeviceNOCChainCallback);
+    if (err != CHIP_NO_ERROR)
+    {
+        mCommissionee->mAsyncCallbacks->mPending--;
+    }
+    return err;
 }
 
 CHIP_ERROR DeviceCommissioner::SendOperationalCertificate(DeviceProxy * device, const ByteSpan & nocCertBuf,
@@ -1783,7 +2119,8 @@ void DeviceCommissioner::OnAddNOCFailureResponse(void * context, CHIP_ERROR erro
     MATTER_TRACE_SCOPE("OnAddNOCFailureResponse", "DeviceCommissioner");
     ChipLogProgress(Controller, "Device failed to receive the operational certificate Response: %" CHIP_ERROR_FORMAT,
                     error.Format());
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
     commissioner->CommissioningStageComplete(error);
 }
 
@@ -1792,18 +2129,19 @@ void DeviceCommissioner::OnOperationalCertificateAddResponse(
 {
     MATTER_TRACE_SCOPE("OnOperationalCertificateAddResponse", "DeviceCommissioner");
     ChipLogProgress(Controller, "Device returned status %d on receiving the NOC", to_underlying(data.statusCode));
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
 
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     VerifyOrExit(commissioner->mState == State::Initialized, err = CHIP_ERROR_INCORRECT_STATE);
 
-    VerifyOrExit(commissioner->mDeviceBeingCommissioned != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(commissioner->mCommissionee->mDeviceBeingCommissioned != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
     err = ConvertFromOperationalCertStatus(data.statusCode);
     SuccessOrExit(err);
 
-    err = commissioner->OnOperationalCredentialsProvisioningCompletion(commissioner->mDeviceBeingCommissioned);
+    err = commissioner->OnOperationalCredentialsProvisioningCompletion(commissioner->mCommissionee->mDeviceBeingCommissioned);
 
 exit:
     if (err != CHIP_NO_ERROR)
@@ -1835,7 +2173,8 @@ void DeviceCommissioner::OnRootCertSuccessResponse(void * context, const chip::a
 {
     MATTER_TRACE_SCOPE("OnRootCertSuccessResponse", "DeviceCommissioner");
     ChipLogProgress(Controller, "Device confirmed that it has received the root certificate");
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
     commissioner->CommissioningStageComplete(CHIP_NO_ERROR);
 }
 
@@ -1843,7 +2182,8 @@ void DeviceCommissioner::OnRootCertFailureResponse(void * context, CHIP_ERROR er
 {
     MATTER_TRACE_SCOPE("OnRootCertFailureResponse", "DeviceCommissioner");
     ChipLogProgress(Controller, "Device failed to receive the root certificate Response: %" CHIP_ERROR_FORMAT, error.Format());
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
     commissioner->CommissioningStageComplete(error);
 }
 
@@ -1853,9 +2193,10 @@ CHIP_ERROR DeviceCommissioner::OnOperationalCredentialsProvisioningCompletion(De
     ChipLogProgress(Controller, "Operational credentials provisioned on device %p", device);
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
-    if (mPairingDelegate != nullptr)
+    DevicePairingDelegate * pairingDelegate = PairingDelegateForCommissionee();
+    if (pairingDelegate != nullptr)
     {
-        mPairingDelegate->OnStatusUpdate(DevicePairingDelegate::SecurePairingSuccess);
+        pairingDelegate->OnStatusUpdate(DevicePairingDelegate::SecurePairingSuccess);
     }
     CommissioningStageComplete(CHIP_NO_ERROR);
 
@@ -1934,14 +2275,16 @@ void DeviceCommissioner::OnNodeDiscovered(const chip::Dnssd::DiscoveredNodeData
 
 void DeviceCommissioner::OnBasicSuccess(void * context, const chip::app::DataModel::NullObjectType &)
 {
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
     commissioner->CommissioningStageComplete(CHIP_NO_ERROR);
 }
 
 void DeviceCommissioner::OnBasicFailure(void * context, CHIP_ERROR error)
 {
     ChipLogProgress(Controller, "Received failure response: %" CHIP_ERROR_FORMAT, error.Format());
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
     commissioner->CommissioningStageComplete(error);
 }
 
@@ -1965,7 +2308,7 @@ void DeviceCommissioner::CleanupCommissioning(DeviceProxy * proxy, NodeId nodeId
 {
     // At this point, proxy == mDeviceBeingCommissioned, nodeId == mDeviceBeingCommissioned->GetDeviceId()
 
-    mCommissioningCompletionStatus = completionStatus;
+    mCommissionee->mCommissioningCompletionStatus = completionStatus;
 
     if (completionStatus.err == CHIP_NO_ERROR)
     {
@@ -1988,7 +2331,7 @@ void DeviceCommissioner::CleanupCommissioning(DeviceProxy * proxy, NodeId nodeId
             ReleaseCommissioneeDevice(commissionee);
         }
         // Send the callbacks, we're done.
-        SendCommissioningCompleteCallbacks(nodeId, mCommissioningCompletionStatus);
+        SendCommissioningCompleteCallbacks(nodeId, mCommissionee->mCommissioningCompletionStatus);
     }
     else if (completionStatus.err == CHIP_ERROR_CANCELLED)
     {
@@ -2025,7 +2368,7 @@ void DeviceCommissioner::CleanupCommissioning(DeviceProxy * proxy, NodeId nodeId
         // We do not need to reset the failsafe here because we want to keep everything on the device up to this point, so just
         // send the completion callbacks (see "Commissioning Flows Error Handling" in the spec).
         CommissioningStageComplete(CHIP_NO_ERROR);
-        SendCommissioningCompleteCallbacks(nodeId, mCommissioningCompletionStatus);
+        SendCommissioningCompleteCallbacks(nodeId, mCommissionee->mCommissioningCompletionStatus);
     }
     else
     {
@@ -2048,14 +2391,16 @@ void DeviceCommissioner::OnDisarmFailsafe(void * context,
                                           const GeneralCommissioning::Commands::ArmFailSafeResponse::DecodableType & data)
 {
     ChipLogProgress(Controller, "Failsafe disarmed");
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
     commissioner->CleanupDoneAfterError();
 }
 
 void DeviceCommissioner::OnDisarmFailsafeFailure(void * context, CHIP_ERROR error)
 {
     ChipLogProgress(Controller, "Ignoring failure to disarm failsafe: %" CHIP_ERROR_FORMAT, error.Format());
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
     commissioner->CleanupDoneAfterError();
 }
 
@@ -2063,9 +2408,9 @@ void DeviceCommissioner::CleanupDoneAfterError()
 {
     // If someone nulled out our mDeviceBeingCommissioned, there's nothing else
     // to do here.
-    VerifyOrReturn(mDeviceBeingCommissioned != nullptr);
+    VerifyOrReturn(mCommissionee->mDeviceBeingCommissioned != nullptr);
 
-    NodeId nodeId = mDeviceBeingCommissioned->GetDeviceId();
+    NodeId nodeId = mCommissionee->mDeviceBeingCommissioned->GetDeviceId();
 
     // Signal completion - this will reset mDeviceBeingCommissioned.
     CommissioningStageComplete(CHIP_NO_ERROR);
@@ -2080,7 +2425,7 @@ void DeviceCommissioner::CleanupDoneAfterError()
     }
 
     // Invoke callbacks last, after we have cleared up all state.
-    SendCommissioningCompleteCallbacks(nodeId, mCommissioningCompletionStatus);
+    SendCommissioningCompleteCallbacks(nodeId, mCommissionee->mCommissioningCompletionStatus);
 }
 
 void DeviceCommissioner::SendCommissioningCompleteCallbacks(NodeId nodeId, const CompletionStatus & completionStatus)
@@ -2089,26 +2434,27 @@ void DeviceCommissioner::SendCommissioningCompleteCallbacks(NodeId nodeId, const
 
     ChipLogProgress(Controller, "Commissioning complete for node ID 0x" ChipLogFormatX64 ": %s", ChipLogValueX64(nodeId),
                     (completionStatus.err == CHIP_NO_ERROR ? "success" : completionStatus.err.AsString()));
-    mCommissioningStage = CommissioningStage::kSecurePairing;
+    mCommissionee->mCommissioningStage = CommissioningStage::kSecurePairing;
 
-    if (mPairingDelegate == nullptr)
+    DevicePairingDelegate * pairingDelegate = PairingDelegateForCommissionee();
+    if (pairingDelegate == nullptr)
     {
         return;
     }
 
-    mPairingDelegate->OnCommissioningComplete(nodeId, completionStatus.err);
+    pairingDelegate->OnCommissioningComplete(nodeId, completionStatus.err);
 
     PeerId peerId(GetCompressedFabricId(), nodeId);
     if (completionStatus.err == CHIP_NO_ERROR)
     {
-        mPairingDelegate->OnCommissioningSuccess(peerId);
+        pairingDelegate->OnCommissioningSuccess(peerId);
     }
     else
     {
         // TODO: We should propogate detailed error information (commissioningError, networkCommissioningStatus) from
         // completionStatus.
-        mPairingDelegate->OnCommissioningFailure(peerId, completionStatus.err, completionStatus.failedStage.ValueOr(kError),
-                                                 completionStatus.attestationResult);
+        pairingDelegate->OnCommissioningFailure(peerId, completionStatus.err, completionStatus.failedStage.ValueOr(kError),
+                                                completionStatus.attestationResult);
     }
 }
 
@@ -2116,35 +2462,38 @@ void DeviceCommissioner::CommissioningStageComplete(CHIP_ERROR err, Commissionin
 {
     // Once this stage is complete, reset mDeviceBeingCommissioned - this will be reset when the delegate calls the next step.
     MATTER_TRACE_SCOPE("CommissioningStageComplete", "DeviceCommissioner");
-    MATTER_LOG_METRIC_END(MetricKeyForCommissioningStage(mCommissioningStage), err);
-    VerifyOrDie(mDeviceBeingCommissioned);
+    CommissioneeScope scope(*this, ResolveCommissionee());
+    VerifyOrDie(mCommissionee != nullptr && mCommissionee->mDeviceBeingCommissioned);
+    MATTER_LOG_METRIC_END(MetricKeyForCommissioningStage(mCommissionee->mCommissioningStage), err);
 
-    NodeId nodeId            = mDeviceBeingCommissioned->GetDeviceId();
-    DeviceProxy * proxy      = mDeviceBeingCommissioned;
-    mDeviceBeingCommissioned = nullptr;
-    mInvokeCancelFn          = nullptr;
-    mWriteCancelFn           = nullptr;
+    NodeId nodeId                           = mCommissionee->mDeviceBeingCommissioned->GetDeviceId();
+    DeviceProxy * proxy                     = mCommissionee->mDeviceBeingCommissioned;
+    mCommissionee->mDeviceBeingCommissioned = nullptr;
+    mCommissionee->mInvokeCancelFn          = nullptr;
+    mCommissionee->mWriteCancelFn           = nullptr;
 
-    if (mPairingDelegate != nullptr)
+    DevicePairingDelegate * pairingDelegate = PairingDelegateForCommissionee();
+    if (pairingDelegate != nullptr)
     {
-        mPairingDelegate->OnCommissioningStatusUpdate(PeerId(GetCompressedFabricId(), nodeId), mCommissioningStage, err);
+        pairingDelegate->OnCommissioningStatusUpdate(PeerId(GetCompressedFabricId(), nodeId), mCommissionee->mCommissioningStage,
+                                                     err);
     }
 
-    if (mCommissioningDelegate == nullptr)
+    if (mCommissionee->mCommissioningDelegate == nullptr)
     {
         return;
     }
-    report.stageCompleted = mCommissioningStage;
-    CHIP_ERROR status     = mCommissioningDelegate->CommissioningStepFinished(err, report);
-    if (status != CHIP_NO_ERROR && mCommissioningStage != CommissioningStage::kCleanup)
+    report.stageCompleted = mCommissionee->mCommissioningStage;
+    CHIP_ERROR status     = mCommissionee->mCommissioningDelegate->CommissioningStepFinished(err, report);
+    if (status != CHIP_NO_ERROR && mCommissionee->mCommissioningStage != CommissioningStage::kCleanup)
     {
         // Commissioning delegate will only return error if it failed to perform the appropriate commissioning step.
         // In this case, we should complete the commissioning for it.
         CompletionStatus completionStatus;
-        completionStatus.err         = status;
-        completionStatus.failedStage = MakeOptional(report.stageCompleted);
-        mCommissioningStage          = CommissioningStage::kCleanup;
-        mDeviceBeingCommissioned     = proxy;
+        completionStatus.err                    = status;
+        completionStatus.failedStage            = MakeOptional(report.stageCompleted);
+        mCommissionee->mCommissioningStage      = CommissioningStage::kCleanup;
+        mCommissionee->mDeviceBeingCommissioned = proxy;
         CleanupCommissioning(proxy, nodeId, completionStatus);
     }
 }
@@ -2154,10 +2503,11 @@ void DeviceCommissioner::OnDeviceConnectedFn(void * context, Messaging::Exchange
 {
     // CASE session established.
     MATTER_LOG_METRIC_END(kMetricDeviceCommissioningOperationalSetup, CHIP_NO_ERROR);
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
-    VerifyOrDie(commissioner->mCommissioningStage == CommissioningStage::kFindOperationalForStayActive ||
-                commissioner->mCommissioningStage == CommissioningStage::kFindOperationalForCommissioningComplete);
-    VerifyOrDie(commissioner->mDeviceBeingCommissioned->GetDeviceId() == sessionHandle->GetPeer().GetNodeId());
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
+    VerifyOrDie(commissioner->mCommissionee->mCommissioningStage == CommissioningStage::kFindOperationalForStayActive ||
+                commissioner->mCommissionee->mCommissioningStage == CommissioningStage::kFindOperationalForCommissioningComplete);
+    VerifyOrDie(commissioner->mCommissionee->mDeviceBeingCommissioned->GetDeviceId() == sessionHandle->GetPeer().GetNodeId());
     commissioner->CancelCASECallbacks(); // ensure all CASE callbacks are unregistered
 
     CommissioningDelegate::CommissioningReport report;
@@ -2169,10 +2519,11 @@ void DeviceCommissioner::OnDeviceConnectionFailureFn(void * context, const Scope
 {
     // CASE session establishment failed.
     MATTER_LOG_METRIC_END(kMetricDeviceCommissioningOperationalSetup, error);
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
-    VerifyOrDie(commissioner->mCommissioningStage == CommissioningStage::kFindOperationalForStayActive ||
-                commissioner->mCommissioningStage == CommissioningStage::kFindOperationalForCommissioningComplete);
-    VerifyOrDie(commissioner->mDeviceBeingCommissioned->GetDeviceId() == peerId.GetNodeId());
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
+    VerifyOrDie(commissioner->mCommissionee->mCommissioningStage == CommissioningStage::kFindOperationalForStayActive ||
+                commissioner->mCommissionee->mCommissioningStage == CommissioningStage::kFindOperationalForCommissioningComplete);
+    VerifyOrDie(commissioner->mCommissionee->mDeviceBeingCommissioned->GetDeviceId() == peerId.GetNodeId());
     commissioner->CancelCASECallbacks(); // ensure all CASE callbacks are unregistered
 
     if (error != CHIP_NO_ERROR)
@@ -2211,10 +2562,11 @@ void DeviceCommissioner::OnDeviceConnectionRetryFn(void * context, const ScopedN
                  ".  Next retry expected to get a response to Sigma1 or fail within %d seconds",
                  ChipLogValueScopedNodeId(peerId), error.Format(), retryTimeout.count());
 
-    auto self = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * self = scope.GetCommissioner();
     VerifyOrDie(self->GetCommissioningStage() == CommissioningStage::kFindOperationalForStayActive ||
                 self->GetCommissioningStage() == CommissioningStage::kFindOperationalForCommissioningComplete);
-    VerifyOrDie(self->mDeviceBeingCommissioned->GetDeviceId() == peerId.GetNodeId());
+    VerifyOrDie(self->mCommissionee->mDeviceBeingCommissioned->GetDeviceId() == peerId.GetNodeId());
 
     // We need to do the fail-safe arming over the PASE session.
     auto * commissioneeDevice = self->FindCommissioneeDevice(peerId.GetNodeId());
@@ -2250,12 +2602,23 @@ void DeviceCommissioner::OnDeviceConnectionRetryFn(void * context, const ScopedN
 // ClusterStateCache::Callback / ReadClient::Callback
 void DeviceCommissioner::OnDone(app::ReadClient * readClient)
 {
-    VerifyOrDie(readClient != nullptr && readClient == mReadClient.get());
-    mReadClient.reset();
-    switch (mCommissioningStage)
+    CommissioneeState * owner = nullptr;
+    mCommissionees.ForEachActiveObject([&](CommissioneeState * commissionee) {
+        if (readClient != nullptr && readClient == commissionee->mReadClient.get())
+        {
+            owner = commissionee;
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+
+    CommissioneeScope scope(*this, owner);
+    VerifyOrDie(mCommissionee != nullptr);
+    mCommissionee->mReadClient.reset();
+    switch (mCommissionee->mCommissioningStage)
     {
     case CommissioningStage::kReadCommissioningInfo:
-        ContinueReadingCommissioningInfo(mCommissioningDelegate->GetCommissioningParameters());
+        ContinueReadingCommissioningInfo(mCommissionee->mCommissioningDelegate->GetCommissioningParameters());
         break;
     default:
         VerifyOrDie(false);
@@ -2310,12 +2673,13 @@ public:
 
 void DeviceCommissioner::ContinueReadingCommissioningInfo(const CommissioningParameters & params)
 {
-    VerifyOrDie(mCommissioningStage == CommissioningStage::kReadCommissioningInfo);
+    VerifyOrDie(mCommissionee->mCommissioningStage == CommissioningStage::kReadCommissioningInfo);
 
     // mReadCommissioningInfoProgress starts at 0 and counts the number of paths we have read.
     // A marker value is used to indicate that there are no further attributes to read.
-    static constexpr auto kReadProgressNoFurtherAttributes = std::numeric_limits<decltype(mReadCommissioningInfoProgress)>::max();
-    if (mReadCommissioningInfoProgress == kReadProgressNoFurtherAttributes)
+    using ReadProgress                                     = decltype(mCommissionee->mReadCommissioningInfoProgress);
+    static constexpr auto kReadProgressNoFurtherAttributes = std::numeric_limits<ReadProgress>::max();
+    if (mCommissionee->mReadCommissioningInfoProgress == kReadProgressNoFurtherAttributes)
     {
         FinishReadingCommissioningInfo(params);
         return;
@@ -2329,7 +2693,7 @@ void DeviceCommissioner::ContinueReadingCommissioningInfo(const CommissioningPar
     // memory to hold the complete list of attributes to read up front; however the logic to
     // determine the attributes to include must be deterministic since it runs multiple times.
     // The use of an immediately-invoked lambda is convenient for control flow.
-    ReadInteractionBuilder builder(mReadCommissioningInfoProgress);
+    ReadInteractionBuilder builder(mCommissionee->mReadCommissioningInfoProgress);
     [&]() -> void {
         // General Commissioning
         VerifyOrReturn(builder.AddAttributePath(kRootEndpointId, Clusters::GeneralCommissioning::Id,
@@ -2404,16 +2768,17 @@ void DeviceCommissioner::ContinueReadingCommissioningInfo(const CommissioningPar
     if (builder.exceeded())
     {
         // Keep track of the number of attributes we have read already so we can resume from there.
-        auto progress = mReadCommissioningInfoProgress + builder.size();
+        auto progress = mCommissionee->mReadCommissioningInfoProgress + builder.size();
         VerifyOrDie(progress < kReadProgressNoFurtherAttributes);
-        mReadCommissioningInfoProgress = static_cast<decltype(mReadCommissioningInfoProgress)>(progress);
+        mCommissionee->mReadCommissioningInfoProgress = static_cast<ReadProgress>(progress);
     }
     else
     {
-        mReadCommissioningInfoProgress = kReadProgressNoFurtherAttributes;
+        mCommissionee->mReadCommissioningInfoProgress = kReadProgressNoFurtherAttributes;
     }
 
-    SendCommissioningReadRequest(mDeviceBeingCommissioned, mCommissioningStepTimeout, builder.paths(), builder.size());
+    SendCommissioningReadRequest(mCommissionee->mDeviceBeingCommissioned, mCommissionee->mCommissioningStepTimeout, builder.paths(),
+                                 builder.size());
 }
 
 namespace {
@@ -2432,7 +2797,7 @@ void DeviceCommissioner::FinishReadingCommissioningInfo(const CommissioningParam
     // up returning an error (e.g. because some mandatory information was missing).
     CHIP_ERROR err = CHIP_NO_ERROR;
     ReadCommissioningInfo info;
-    info.attributes = mAttributeCache.get();
+    info.attributes = mCommissionee->mAttributeCache.get();
     AccumulateErrors(err, ParseGeneralCommissioningInfo(info));
     AccumulateErrors(err, ParseBasicInformation(info));
     AccumulateErrors(err, ParseNetworkCommissioningInfo(info));
@@ -2441,9 +2806,10 @@ void DeviceCommissioner::FinishReadingCommissioningInfo(const CommissioningParam
     AccumulateErrors(err, ParseICDInfo(info));
     AccumulateErrors(err, ParseExtraCommissioningInfo(info, params));
 
-    if (mPairingDelegate != nullptr && err == CHIP_NO_ERROR)
+    DevicePairingDelegate * pairingDelegate = PairingDelegateForCommissionee();
+    if (pairingDelegate != nullptr && err == CHIP_NO_ERROR)
     {
-        mPairingDelegate->OnReadCommissioningInfo(info);
+        pairingDelegate->OnReadCommissioningInfo(info);
     }
 
     CommissioningDelegate::CommissioningReport report;
@@ -2451,7 +2817,7 @@ void DeviceCommissioner::FinishReadingCommissioningInfo(const CommissioningParam
     CommissioningStageComplete(err, report);
 
     // Only release the attribute cache once `info` is no longer needed.
-    mAttributeCache.reset();
+    mCommissionee->mAttributeCache.reset();
 }
 
 CHIP_ERROR DeviceCommissioner::ParseGeneralCommissioningInfo(ReadCommissioningInfo & info)
@@ -2461,7 +2827,7 @@ CHIP_ERROR DeviceCommissioner::ParseGeneralCommissioningInfo(ReadCommissioningIn
     CHIP_ERROR err;
 
     BasicCommissioningInfo::TypeInfo::DecodableType basicInfo;
-    err = mAttributeCache->Get<BasicCommissioningInfo::TypeInfo>(kRootEndpointId, basicInfo);
+    err = mCommissionee->mAttributeCache->Get<BasicCommissioningInfo::TypeInfo>(kRootEndpointId, basicInfo);
     if (err == CHIP_NO_ERROR)
     {
         info.general.recommendedFailsafe = basicInfo.failSafeExpiryLengthSeconds;
@@ -2472,35 +2838,37 @@ CHIP_ERROR DeviceCommissioner::ParseGeneralCommissioningInfo(ReadCommissioningIn
         return_err = err;
     }
 
-    err = mAttributeCache->Get<RegulatoryConfig::TypeInfo>(kRootEndpointId, info.general.currentRegulatoryLocation);
+    err = mCommissionee->mAttributeCache->Get<RegulatoryConfig::TypeInfo>(kRootEndpointId, info.general.currentRegulatoryLocation);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Controller, "Failed to read RegulatoryConfig: %" CHIP_ERROR_FORMAT, err.Format());
         return_err = err;
     }
 
-    err = mAttributeCache->Get<LocationCapability::TypeInfo>(kRootEndpointId, info.general.locationCapability);
+    err = mCommissionee->mAttributeCache->Get<LocationCapability::TypeInfo>(kRootEndpointId, info.general.locationCapability);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Controller, "Failed to read LocationCapability: %" CHIP_ERROR_FORMAT, err.Format());
         return_err = err;
     }
 
-    err = mAttributeCache->Get<Breadcrumb::TypeInfo>(kRootEndpointId, info.general.breadcrumb);
+    err = mCommissionee->mAttributeCache->Get<Breadcrumb::TypeInfo>(kRootEndpointId, info.general.breadcrumb);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Controller, "Failed to read Breadcrumb: %" CHIP_ERROR_FORMAT, err.Format());
         return_err = err;
     }
 
-    err = mAttributeCache->Get<SupportsConcurrentConnection::TypeInfo>(kRootEndpointId, info.supportsConcurrentConnection);
+    err = mCommissionee->mAttributeCache->Get<SupportsConcurrentConnection::TypeInfo>(kRootEndpointId,
+                                                                                      info.supportsConcurrentConnection);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Controller, "Ignoring failure to read SupportsConcurrentConnection: %" CHIP_ERROR_FORMAT, err.Format());
         info.supportsConcurrentConnection = true; // default to true (concurrent), not a fatal error
     }
 
-    err = mAttributeCache->Get<IsCommissioningWithoutPower::TypeInfo>(kRootEndpointId, info.general.isCommissioningWithoutPower);
+    err = mCommissionee->mAttributeCache->Get<IsCommissioningWithoutPower::TypeInfo>(kRootEndpointId,
+                                                                                     info.general.isCommissioningWithoutPower);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Controller, "Ignoring failure to read IsCommissioningWithoutPower: %" CHIP_ERROR_FORMAT, err.Format());
@@ -2516,14 +2884,14 @@ CHIP_ERROR DeviceCommissioner::ParseBasicInformation(ReadCommissioningInfo & inf
     CHIP_ERROR return_err = CHIP_NO_ERROR;
     CHIP_ERROR err;
 
-    err = mAttributeCache->Get<VendorID::TypeInfo>(kRootEndpointId, info.basic.vendorId);
+    err = mCommissionee->mAttributeCache->Get<VendorID::TypeInfo>(kRootEndpointId, info.basic.vendorId);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Controller, "Failed to read VendorID: %" CHIP_ERROR_FORMAT, err.Format());
         return_err = err;
     }
 
-    err = mAttributeCache->Get<ProductID::TypeInfo>(kRootEndpointId, info.basic.productId);
+    err = mCommissionee->mAttributeCache->Get<ProductID::TypeInfo>(kRootEndpointId, info.basic.productId);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Controller, "Failed to read ProductID: %" CHIP_ERROR_FORMAT, err.Format());
@@ -2542,10 +2910,11 @@ CHIP_ERROR DeviceCommissioner::ParseNetworkCommissioningInfo(ReadCommissioningIn
     // Set the network cluster endpoints first so we can match up the connection
     // times. Note that here we don't know what endpoints the network
     // commissioning clusters might be on.
-    err = mAttributeCache->ForEachAttribute(NetworkCommissioning::Id, [this, &info](const ConcreteAttributePath & path) {
+    app::ClusterStateCache * attributeCache = mCommissionee->mAttributeCache.get();
+    err = attributeCache->ForEachAttribute(NetworkCommissioning::Id, [this, &info](const ConcreteAttributePath & path) {
         VerifyOrReturnError(path.mAttributeId == FeatureMap::Id, CHIP_NO_ERROR);
         BitFlags<NetworkCommissioning::Feature> features;
-        if (mAttributeCache->Get<FeatureMap::TypeInfo>(path, *features.RawStorage()) == CHIP_NO_ERROR)
+        if (mCommissionee->mAttributeCache->Get<FeatureMap::TypeInfo>(path, *features.RawStorage()) == CHIP_NO_ERROR)
         {
             if (features.Has(NetworkCommissioning::Feature::kWiFiNetworkInterface))
             {
@@ -2590,7 +2959,8 @@ CHIP_ERROR DeviceCommissioner::ParseNetworkCommissioningTimeouts(NetworkClusterI
 {
     using namespace NetworkCommissioning::Attributes;
 
-    CHIP_ERROR err = mAttributeCache->Get<ConnectMaxTimeSeconds::TypeInfo>(networkInfo.endpoint, networkInfo.minConnectionTime);
+    CHIP_ERROR err =
+        mCommissionee->mAttributeCache->Get<ConnectMaxTimeSeconds::TypeInfo>(networkInfo.endpoint, networkInfo.minConnectionTime);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Controller, "Failed to read %s ConnectMaxTimeSeconds (endpoint %u): %" CHIP_ERROR_FORMAT, networkType,
@@ -2598,7 +2968,7 @@ CHIP_ERROR DeviceCommissioner::ParseNetworkCommissioningTimeouts(NetworkClusterI
         return err;
     }
 
-    err = mAttributeCache->Get<ScanMaxTimeSeconds::TypeInfo>(networkInfo.endpoint, networkInfo.maxScanTime);
+    err = mCommissionee->mAttributeCache->Get<ScanMaxTimeSeconds::TypeInfo>(networkInfo.endpoint, networkInfo.maxScanTime);
     if (err != CHIP_NO_ERROR)
     {
         // We don't always read this attribute, and we read it as a wildcard, so
@@ -2624,7 +2994,7 @@ CHIP_ERROR DeviceCommissioner::ParseTimeSyncInfo(ReadCommissioningInfo & info)
 
     // If we fail to get the feature map, there's no viable time cluster, don't set anything.
     BitFlags<TimeSynchronization::Feature> featureMap;
-    err = mAttributeCache->Get<FeatureMap::TypeInfo>(kRootEndpointId, *featureMap.RawStorage());
+    err = mCommissionee->mAttributeCache->Get<FeatureMap::TypeInfo>(kRootEndpointId, *featureMap.RawStorage());
     if (err != CHIP_NO_ERROR)
     {
         info.requiresUTC               = false;
@@ -2640,14 +3010,14 @@ CHIP_ERROR DeviceCommissioner::ParseTimeSyncInfo(ReadCommissioningInfo & info)
 
     if (info.requiresTimeZone)
     {
-        err = mAttributeCache->Get<TimeZoneListMaxSize::TypeInfo>(kRootEndpointId, info.maxTimeZoneSize);
+        err = mCommissionee->mAttributeCache->Get<TimeZoneListMaxSize::TypeInfo>(kRootEndpointId, info.maxTimeZoneSize);
         if (err != CHIP_NO_ERROR)
         {
             // This information should be available, let's do our best with what we have, but we can't set
             // the time zone without this information
             info.requiresTimeZone = false;
         }
-        err = mAttributeCache->Get<DSTOffsetListMaxSize::TypeInfo>(kRootEndpointId, info.maxDSTSize);
+        err = mCommissionee->mAttributeCache->Get<DSTOffsetListMaxSize::TypeInfo>(kRootEndpointId, info.maxDSTSize);
         if (err != CHIP_NO_ERROR)
         {
             info.requiresTimeZone = false;
@@ -2656,7 +3026,7 @@ CHIP_ERROR DeviceCommissioner::ParseTimeSyncInfo(ReadCommissioningInfo & info)
     if (info.requiresDefaultNTP)
     {
         DefaultNTP::TypeInfo::DecodableType defaultNTP;
-        err = mAttributeCache->Get<DefaultNTP::TypeInfo>(kRootEndpointId, defaultNTP);
+        err = mCommissionee->mAttributeCache->Get<DefaultNTP::TypeInfo>(kRootEndpointId, defaultNTP);
         if (err == CHIP_NO_ERROR && (!defaultNTP.IsNull()) && (defaultNTP.Value().size() != 0))
         {
             info.requiresDefaultNTP = false;
@@ -2665,7 +3035,7 @@ CHIP_ERROR DeviceCommissioner::ParseTimeSyncInfo(ReadCommissioningInfo & info)
     if (info.requiresTrustedTimeSource)
     {
         TrustedTimeSource::TypeInfo::DecodableType trustedTimeSource;
-        err = mAttributeCache->Get<TrustedTimeSource::TypeInfo>(kRootEndpointId, trustedTimeSource);
+        err = mCommissionee->mAttributeCache->Get<TrustedTimeSource::TypeInfo>(kRootEndpointId, trustedTimeSource);
         if (err == CHIP_NO_ERROR && !trustedTimeSource.IsNull())
         {
             info.requiresTrustedTimeSource = false;
@@ -2683,7 +3053,8 @@ CHIP_ERROR DeviceCommissioner::ParseFabrics(ReadCommissioningInfo & info)
 
     // We might not have requested a Fabrics attribute at all, so not having a
     // value for it is not an error.
-    err = mAttributeCache->ForEachAttribute(OperationalCredentials::Id, [this, &info](const ConcreteAttributePath & path) {
+    app::ClusterStateCache * attributeCache = mCommissionee->mAttributeCache.get();
+    err = attributeCache->ForEachAttribute(OperationalCredentials::Id, [this, &info](const ConcreteAttributePath & path) {
         using namespace chip::app::Clusters::OperationalCredentials::Attributes;
         // this code is checking if the device is already on the commissioner's fabric.
         // if a matching fabric is found, then remember the nodeId so that the commissioner
@@ -2693,7 +3064,7 @@ CHIP_ERROR DeviceCommissioner::ParseFabrics(ReadCommissioningInfo & info)
         {
         case Fabrics::Id: {
             Fabrics::TypeInfo::DecodableType fabrics;
-            ReturnErrorOnFailure(this->mAttributeCache->Get<Fabrics::TypeInfo>(path, fabrics));
+            ReturnErrorOnFailure(this->mCommissionee->mAttributeCache->Get<Fabrics::TypeInfo>(path, fabrics));
             // this is a best effort attempt to find a matching fabric, so no error checking on iter
             auto iter = fabrics.begin();
             while (iter.Next())
@@ -2738,9 +3109,10 @@ CHIP_ERROR DeviceCommissioner::ParseFabrics(ReadCommissioningInfo & info)
         }
     });
 
-    if (mPairingDelegate != nullptr)
+    DevicePairingDelegate * pairingDelegate = PairingDelegateForCommissionee();
+    if (pairingDelegate != nullptr)
     {
-        mPairingDelegate->OnFabricCheck(info.remoteNodeId);
+        pairingDelegate->OnFabricCheck(info.remoteNodeId);
     }
 
     return return_err;
@@ -2755,7 +3127,7 @@ CHIP_ERROR DeviceCommissioner::ParseICDInfo(ReadCommissioningInfo & info)
     bool isICD                    = false;
 
     BitFlags<IcdManagement::Feature> featureMap;
-    err = mAttributeCache->Get<FeatureMap::TypeInfo>(kRootEndpointId, *featureMap.RawStorage());
+    err = mCommissionee->mAttributeCache->Get<FeatureMap::TypeInfo>(kRootEndpointId, *featureMap.RawStorage());
     if (err == CHIP_NO_ERROR)
     {
         info.icd.isLIT                  = featureMap.Has(IcdManagement::Feature::kLongIdleTimeSupport);
@@ -2772,7 +3144,8 @@ CHIP_ERROR DeviceCommissioner::ParseICDInfo(ReadCommissioningInfo & info)
     else if (err == CHIP_ERROR_IM_STATUS_CODE_RECEIVED)
     {
         app::StatusIB statusIB;
-        err = mAttributeCache->GetStatus(app::ConcreteAttributePath(kRootEndpointId, IcdManagement::Id, FeatureMap::Id), statusIB);
+        app::ConcreteAttributePath featureMapPath(kRootEndpointId, IcdManagement::Id, FeatureMap::Id);
+        err = mCommissionee->mAttributeCache->GetStatus(featureMapPath, statusIB);
         if (err == CHIP_NO_ERROR)
         {
             if (statusIB.mStatus == Protocols::InteractionModel::Status::UnsupportedCluster)
@@ -2796,7 +3169,8 @@ CHIP_ERROR DeviceCommissioner::ParseICDInfo(ReadCommissioningInfo & info)
         // Intentionally ignore errors since they are not mandatory.
         bool activeModeTriggerInstructionRequired = false;
 
-        err = mAttributeCache->Get<UserActiveModeTriggerHint::TypeInfo>(kRootEndpointId, info.icd.userActiveModeTriggerHint);
+        err = mCommissionee->mAttributeCache->Get<UserActiveModeTriggerHint::TypeInfo>(kRootEndpointId,
+                                                                                       info.icd.userActiveModeTriggerHint);
         if (err != CHIP_NO_ERROR)
         {
             ChipLogError(Controller, "IcdManagement.UserActiveModeTriggerHint expected, but failed to read.");
@@ -2814,7 +3188,7 @@ CHIP_ERROR DeviceCommissioner::ParseICDInfo(ReadCommissioningInfo & info)
 
         if (activeModeTriggerInstructionRequired)
         {
-            err = mAttributeCache->Get<UserActiveModeTriggerInstruction::TypeInfo>(kRootEndpointId,
+            err = mCommissionee->mAttributeCache->Get<UserActiveModeTriggerInstruction::TypeInfo>(kRootEndpointId,
                                                                                    info.icd.userActiveModeTriggerInstruction);
             if (err != CHIP_NO_ERROR)
             {
@@ -2834,14 +3208,14 @@ CHIP_ERROR DeviceCommissioner::ParseICDInfo(ReadCommissioningInfo & info)
         return CHIP_NO_ERROR;
     }
 
-    err = mAttributeCache->Get<IdleModeDuration::TypeInfo>(kRootEndpointId, info.icd.idleModeDuration);
+    err = mCommissionee->mAttributeCache->Get<IdleModeDuration::TypeInfo>(kRootEndpointId, info.icd.idleModeDuration);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Controller, "IcdManagement.IdleModeDuration expected, but failed to read: %" CHIP_ERROR_FORMAT, err.Format());
         return err;
     }
 
-    err = mAttributeCache->Get<ActiveModeDuration::TypeInfo>(kRootEndpointId, info.icd.activeModeDuration);
+    err = mCommissionee->mAttributeCache->Get<ActiveModeDuration::TypeInfo>(kRootEndpointId, info.icd.activeModeDuration);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Controller, "IcdManagement.ActiveModeDuration expected, but failed to read: %" CHIP_ERROR_FORMAT,
@@ -2849,7 +3223,7 @@ CHIP_ERROR DeviceCommissioner::ParseICDInfo(ReadCommissioningInfo & info)
         return err;
     }
 
-    err = mAttributeCache->Get<ActiveModeThreshold::TypeInfo>(kRootEndpointId, info.icd.activeModeThreshold);
+    err = mCommissionee->mAttributeCache->Get<ActiveModeThreshold::TypeInfo>(kRootEndpointId, info.icd.activeModeThreshold);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Controller, "IcdManagement.ActiveModeThreshold expected, but failed to read: %" CHIP_ERROR_FORMAT,
@@ -2872,7 +3246,8 @@ void DeviceCommissioner::OnArmFailSafe(void * context,
         report.Set<CommissioningErrorInfo>(data.errorCode);
     }
 
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
     commissioner->CommissioningStageComplete(err, report);
 }
 
@@ -2888,7 +3263,8 @@ void DeviceCommissioner::OnSetRegulatoryConfigResponse(
         err = CHIP_ERROR_INTERNAL;
         report.Set<CommissioningErrorInfo>(data.errorCode);
     }
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
     commissioner->CommissioningStageComplete(err, report);
 }
 
@@ -2904,7 +3280,8 @@ void DeviceCommissioner::OnSetTCAcknowledgementsResponse(
         err = CHIP_ERROR_INTERNAL;
         report.Set<CommissioningErrorInfo>(data.errorCode);
     }
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
     commissioner->CommissioningStageComplete(err, report);
 }
 
@@ -2913,7 +3290,8 @@ void DeviceCommissioner::OnSetTimeZoneResponse(void * context,
 {
     CommissioningDelegate::CommissioningReport report;
     CHIP_ERROR err                    = CHIP_NO_ERROR;
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
     TimeZoneResponseInfo info;
     info.requiresDSTOffsets = data.DSTOffsetRequired;
     report.Set<TimeZoneResponseInfo>(info);
@@ -2923,7 +3301,8 @@ void DeviceCommissioner::OnSetTimeZoneResponse(void * context,
 void DeviceCommissioner::OnSetUTCError(void * context, CHIP_ERROR error)
 {
     // For SetUTCTime, we don't actually care if the commissionee didn't want out time, that's its choice
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
     commissioner->CommissioningStageComplete(CHIP_NO_ERROR);
 }
 
@@ -2931,15 +3310,17 @@ void DeviceCommissioner::OnScanNetworksFailure(void * context, CHIP_ERROR error)
 {
     ChipLogProgress(Controller, "Received ScanNetworks failure response %" CHIP_ERROR_FORMAT, error.Format());
 
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
 
     // advance to the kNeedsNetworkCreds waiting step
     // clear error so that we don't abort the commissioning when ScanNetworks fails
     commissioner->CommissioningStageComplete(CHIP_NO_ERROR);
 
-    if (commissioner->GetPairingDelegate() != nullptr)
+    DevicePairingDelegate * pairingDelegate = commissioner->PairingDelegateForCommissionee();
+    if (pairingDelegate != nullptr)
     {
-        commissioner->GetPairingDelegate()->OnScanNetworksFailure(error);
+        pairingDelegate->OnScanNetworksFailure(error);
     }
 }
 
@@ -2952,20 +3333,31 @@ void DeviceCommissioner::OnScanNetworksResponse(void * context,
                     to_underlying(data.networkingStatus),
                     (data.debugText.HasValue() ? std::string(data.debugText.Value().data(), data.debugText.Value().size()).c_str()
                                                : "none provided"));
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
 
     // advance to the kNeedsNetworkCreds waiting step
     commissioner->CommissioningStageComplete(CHIP_NO_ERROR);
 
-    if (commissioner->GetPairingDelegate() != nullptr)
+    DevicePairingDelegate * pairingDelegate = commissioner->PairingDelegateForCommissionee();
+    if (pairingDelegate != nullptr)
     {
-        commissioner->GetPairingDelegate()->OnScanNetworksSuccess(data);
+        pairingDelegate->OnScanNetworksSuccess(data);
     }
 }
 
 CHIP_ERROR DeviceCommissioner::NetworkCredentialsReady()
 {
-    VerifyOrReturnError(mCommissioningStage == CommissioningStage::kNeedsNetworkCreds, CHIP_ERROR_INCORRECT_STATE);
+    CommissioneeScope scope(*this, ResolveCommissionee());
+    VerifyOrReturnError(mCommissionee != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    return NetworkCredentialsReady(mCommissionee->mNodeId);
+}
+
+CHIP_ERROR DeviceCommissioner::NetworkCredentialsReady(NodeId remoteDeviceId)
+{
+    CommissioneeScope scope(*this, ResolveCommissionee(remoteDeviceId));
+    VerifyOrReturnError(mCommissionee != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mCommissionee->mCommissioningStage == CommissioningStage::kNeedsNetworkCreds, CHIP_ERROR_INCORRECT_STATE);
 
     // need to advance to next step
     CommissioningStageComplete(CHIP_NO_ERROR);
@@ -2975,7 +3367,17 @@ CHIP_ERROR DeviceCommissioner::NetworkCredentialsReady()
 
 CHIP_ERROR DeviceCommissioner::ICDRegistrationInfoReady()
 {
-    VerifyOrReturnError(mCommissioningStage == CommissioningStage::kICDGetRegistrationInfo, CHIP_ERROR_INCORRECT_STATE);
+    CommissioneeScope scope(*this, ResolveCommissionee());
+    VerifyOrReturnError(mCommissionee != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    return ICDRegistrationInfoReady(mCommissionee->mNodeId);
+}
+
+CHIP_ERROR DeviceCommissioner::ICDRegistrationInfoReady(NodeId remoteDeviceId)
+{
+    CommissioneeScope scope(*this, ResolveCommissionee(remoteDeviceId));
+    VerifyOrReturnError(mCommissionee != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mCommissionee->mCommissioningStage == CommissioningStage::kICDGetRegistrationInfo,
+                        CHIP_ERROR_INCORRECT_STATE);
 
     // need to advance to next step
     CommissioningStageComplete(CHIP_NO_ERROR);
@@ -2983,6 +3385,46 @@ CHIP_ERROR DeviceCommissioner::ICDRegistrationInfoReady()
     return CHIP_NO_ERROR;
 }
 
+CommissioningStage DeviceCommissioner::GetCommissioningStage()
+{
+    CommissioneeState * commissionee = ResolveCommissionee();
+    return (commissionee != nullptr) ? commissionee->mCommissioningStage : CommissioningStage::kSecurePairing;
+}
+
+CommissioningStage DeviceCommissioner::GetCommissioningStage(NodeId remoteDeviceId)
+{
+    CommissioneeState * commissionee = ResolveCommissionee(remoteDeviceId);
+    return (commissionee != nullptr) ? commissionee->mCommissioningStage : CommissioningStage::kSecurePairing;
+}
+
+const CommissioningParameters & DeviceCommissioner::GetCommissioningParameters()
+{
+    CommissioneeState * commissionee = ResolveCommissionee();
+    CommissioningDelegate * delegate = (commissionee != nullptr) ? commissionee->mDefaultCommissioner : mDefaultCommissioner;
+    return delegate->GetCommissioningParameters();
+}
+
+const CommissioningParameters & DeviceCommissioner::GetCommissioningParameters(NodeId remoteDeviceId)
+{
+    CommissioneeState * commissionee = ResolveCommissionee(remoteDeviceId);
+    CommissioningDelegate * delegate = (commissionee != nullptr) ? commissionee->mDefaultCommissioner : mDefaultCommissioner;
+    return delegate->GetCommissioningParameters();
+}
+
+CHIP_ERROR DeviceCommissioner::UpdateCommissioningParameters(const CommissioningParameters & newParameters)
+{
+    CommissioneeState * commissionee = ResolveCommissionee();
+    CommissioningDelegate * delegate = (commissionee != nullptr) ? commissionee->mDefaultCommissioner : mDefaultCommissioner;
+    return delegate->SetCommissioningParameters(newParameters);
+}
+
+CHIP_ERROR DeviceCommissioner::UpdateCommissioningParameters(NodeId remoteDeviceId, const CommissioningParameters & newParameters)
+{
+    CommissioneeState * commissionee = ResolveCommissionee(remoteDeviceId);
+    CommissioningDelegate * delegate = (commissionee != nullptr) ? commissionee->mDefaultCommissioner : mDefaultCommissioner;
+    return delegate->SetCommissioningParameters(newParameters);
+}
+
 void DeviceCommissioner::OnNetworkConfigResponse(void * context,
                                                  const NetworkCommissioning::Commands::NetworkConfigResponse::DecodableType & data)
 {
@@ -2995,7 +3437,8 @@ void DeviceCommissioner::OnNetworkConfigResponse(void * context,
         err = CHIP_ERROR_INTERNAL;
         report.Set<NetworkCommissioningStatusInfo>(data.networkingStatus);
     }
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
     commissioner->CommissioningStageComplete(err, report);
 }
 
@@ -3011,7 +3454,8 @@ void DeviceCommissioner::OnConnectNetworkResponse(
         err = CHIP_ERROR_INTERNAL;
         report.Set<NetworkCommissioningStatusInfo>(data.networkingStatus);
     }
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
     commissioner->CommissioningStageComplete(err, report);
 }
 
@@ -3027,7 +3471,8 @@ void DeviceCommissioner::OnCommissioningCompleteResponse(
         err = CHIP_ERROR_INTERNAL;
         report.Set<CommissioningErrorInfo>(data.errorCode);
     }
-    DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
+    CommissioneeScope scope(context);
+    DeviceCommissioner * commissioner = scope.GetCommissioner();
     commissioner->CommissioningStageComplete(err, report);
 }
 
@@ -3040,10 +3485,10 @@ DeviceCommissioner::SendCommissioningCommand(DeviceProxy * device, const Request
 
 {
     // Default behavior is to make sequential, cancellable calls tracked via mInvokeCancelFn.
-    // Fire-and-forget calls are not cancellable and don't receive `this` as context in callbacks.
-    VerifyOrDie(fireAndForget || !mInvokeCancelFn); // we don't make parallel (cancellable) calls
+    // Fire-and-forget calls are not cancellable and don't receive the commissionee as context in callbacks.
+    VerifyOrDie(fireAndForget || !mCommissionee->mInvokeCancelFn); // we don't make parallel (cancellable) calls
 
-    void * context   = (!fireAndForget) ? this : nullptr;
+    void * context   = (!fireAndForget) ? mCommissionee : nullptr;
     auto onSuccessCb = [context, successCb](const app::ConcreteCommandPath & aPath, const app::StatusIB & aStatus,
                                             const typename RequestObjectT::ResponseType & responseData) {
         successCb(context, responseData);
@@ -3051,7 +3496,7 @@ DeviceCommissioner::SendCommissioningCommand(DeviceProxy * device, const Request
     auto onFailureCb = [context, failureCb](CHIP_ERROR aError) { failureCb(context, aError); };
 
     return InvokeCommandRequest(device->GetExchangeManager(), device->GetSecureSession().Value(), endpoint, request, onSuccessCb,
-                                onFailureCb, NullOptional, timeout, (!fireAndForget) ? &mInvokeCancelFn : nullptr);
+                                onFailureCb, NullOptional, timeout, (!fireAndForget) ? &mCommissionee->mInvokeCancelFn : nullptr);
 }
 
 template <typename AttrType>
@@ -3060,18 +3505,21 @@ CHIP_ERROR DeviceCommissioner::SendCommissioningWriteRequest(DeviceProxy * devic
                                                              WriteResponseSuccessCallback successCb,
                                                              WriteResponseFailureCallback failureCb)
 {
-    VerifyOrDie(!mWriteCancelFn); // we don't make parallel (cancellable) calls
-    auto onSuccessCb = [this, successCb](const app::ConcreteAttributePath & aPath) { successCb(this); };
-    auto onFailureCb = [this, failureCb](const app::ConcreteAttributePath * aPath, CHIP_ERROR aError) { failureCb(this, aError); };
+    VerifyOrDie(!mCommissionee->mWriteCancelFn); // we don't make parallel (cancellable) calls
+    CommissioneeState * commissionee = mCommissionee;
+    auto onSuccessCb = [commissionee, successCb](const app::ConcreteAttributePath & aPath) { successCb(commissionee); };
+    auto onFailureCb = [commissionee, failureCb](const app::ConcreteAttributePath * aPath, CHIP_ERROR aError) {
+        failureCb(commissionee, aError);
+    };
     return WriteAttribute(device->GetSecureSession().Value(), endpoint, cluster, attribute, requestData, onSuccessCb, onFailureCb,
                           /* aTimedWriteTimeoutMs = */ NullOptional, /* onDoneCb = */ nullptr, /* aDataVersion = */ NullOptional,
-                          /* outCancelFn = */ &mWriteCancelFn);
+                          /* outCancelFn = */ &mCommissionee->mWriteCancelFn);
 }
 
 void DeviceCommissioner::SendCommissioningReadRequest(DeviceProxy * proxy, Optional<System::Clock::Timeout> timeout,
                                                       app::AttributePathParams * readPaths, size_t readPathsSize)
 {
-    VerifyOrDie(!mReadClient); // we don't perform parallel reads
+    VerifyOrDie(!mCommissionee->mReadClient); // we don't perform parallel reads
 
     app::InteractionModelEngine * engine = app::InteractionModelEngine::GetInstance();
     app::ReadPrepareParams readParams(proxy->GetSecureSession().Value());
@@ -3084,7 +3532,7 @@ void DeviceCommissioner::SendCommissioningReadRequest(DeviceProxy * proxy, Optio
     readParams.mAttributePathParamsListSize = readPathsSize;
 
     // Take ownership of the attribute cache, so it can be released if SendRequest fails.
-    auto attributeCache = std::move(mAttributeCache);
+    auto attributeCache = std::move(mCommissionee->mAttributeCache);
     auto readClient     = chip::Platform::MakeUnique<app::ReadClient>(
         engine, proxy->GetExchangeManager(), attributeCache->GetBufferedCallback(), app::ReadClient::InteractionType::Read);
     CHIP_ERROR err = readClient->SendRequest(readParams);
@@ -3094,8 +3542,8 @@ void DeviceCommissioner::SendCommissioningReadRequest(DeviceProxy * proxy, Optio
         CommissioningStageComplete(err);
         return;
     }
-    mAttributeCache = std::move(attributeCache);
-    mReadClient     = std::move(readClient);
+    mCommissionee->mAttributeCache = std::move(attributeCache);
+    mCommissionee->mReadClient     = std::move(readClient);
 }
 
 void DeviceCommissioner::PerformCommissioningStep(DeviceProxy * proxy, CommissioningStage step, CommissioningParameters & params,
@@ -3103,6 +3551,9 @@ void DeviceCommissioner::PerformCommissioningStep(DeviceProxy * proxy, Commissio
                                                   Optional<System::Clock::Timeout> timeout)
 
 {
+    CommissioneeScope scope(*this, ResolveCommissionee(proxy->GetDeviceId()));
+    VerifyOrDie(mCommissionee != nullptr);
+
     MATTER_LOG_METRIC(kMetricDeviceCommissionerCommissionStage, step);
     MATTER_LOG_METRIC_BEGIN(MetricKeyForCommissioningStage(step));
 
@@ -3116,15 +3567,16 @@ void DeviceCommissioner::PerformCommissioningStep(DeviceProxy * proxy, Commissio
                         params.GetCompletionStatus().err.AsString());
     }
 
-    if (mPairingDelegate)
+    DevicePairingDelegate * pairingDelegate = PairingDelegateForCommissionee();
+    if (pairingDelegate)
     {
-        mPairingDelegate->OnCommissioningStageStart(PeerId(GetCompressedFabricId(), proxy->GetDeviceId()), step);
+        pairingDelegate->OnCommissioningStageStart(PeerId(GetCompressedFabricId(), proxy->GetDeviceId()), step);
     }
 
-    mCommissioningStepTimeout = timeout;
-    mCommissioningStage       = step;
-    mCommissioningDelegate    = delegate;
-    mDeviceBeingCommissioned  = proxy;
+    mCommissionee->mCommissioningStepTimeout = timeout;
+    mCommissionee->mCommissioningStage       = step;
+    mCommissionee->mCommissioningDelegate    = delegate;
+    mCommissionee->mDeviceBeingCommissioned  = proxy;
 
     // TODO: Extend timeouts to the DAC and Opcert requests.
     // TODO(cecille): We probably want something better than this for breadcrumbs.
@@ -3150,13 +3602,13 @@ void DeviceCommissioner::PerformCommissioningStep(DeviceProxy * proxy, Commissio
         // - SendCommissioningReadRequest when failing to send a read request.
         // - FinishReadingCommissioningInfo when the ReadCommissioningInfo stage is completed.
         // - CancelCommissioningInteractions
-        mAttributeCache = Platform::MakeUnique<app::ClusterStateCache>(*this);
+        mCommissionee->mAttributeCache = Platform::MakeUnique<app::ClusterStateCache>(*this);
 
         // Generally we need to make more than one read request, because as per spec a server only
         // supports a limited number of paths per Read Interaction. Because the actual number of
         // interactions we end up performing is dynamic, we track all of them within a single
         // commissioning stage.
-        mReadCommissioningInfoProgress = 0;
+        mCommissionee->mReadCommissioningInfoProgress = 0;
         ContinueReadingCommissioningInfo(params); // Note: assume params == delegate.GetCommissioningParameters()
         break;
     }
@@ -3581,26 +4033,26 @@ void DeviceCommissioner::PerformCommissioningStep(DeviceProxy * proxy, Commissio
         break;
     }
     case CommissioningStage::kRequestWiFiCredentials: {
-        if (!mPairingDelegate)
+        if (!pairingDelegate)
         {
             ChipLogError(Controller, "Unable to request Wi-Fi credentials: no delegate available");
             CommissioningStageComplete(CHIP_ERROR_INCORRECT_STATE);
             return;
         }
 
-        CHIP_ERROR err = mPairingDelegate->WiFiCredentialsNeeded(endpoint);
+        CHIP_ERROR err = pairingDelegate->WiFiCredentialsNeeded(endpoint);
         CommissioningStageComplete(err);
         return;
     }
     case CommissioningStage::kRequestThreadCredentials: {
-        if (!mPairingDelegate)
+        if (!pairingDelegate)
         {
             ChipLogError(Controller, "Unable to request Thread credentials: no delegate available");
             CommissioningStageComplete(CHIP_ERROR_INCORRECT_STATE);
             return;
         }
 
-        CHIP_ERROR err = mPairingDelegate->ThreadCredentialsNeeded(endpoint);
+        CHIP_ERROR err = pairingDelegate->ThreadCredentialsNeeded(endpoint);
         CommissioningStageComplete(err);
         return;
     }
@@ -3706,7 +4158,7 @@ void DeviceCommissioner::PerformCommissioningStep(DeviceProxy * proxy, Commissio
     }
     break;
     case CommissioningStage::kICDGetRegistrationInfo: {
-        GetPairingDelegate()->OnICDRegistrationInfoRequired();
+        pairingDelegate->OnICDRegistrationInfoRequired();
         return;
     }
     break;
@@ -3754,11 +4206,12 @@ void DeviceCommissioner::PerformCommissioningStep(DeviceProxy * proxy, Commissio
         // If there is an error, CommissioningStageComplete will be called from OnDeviceConnectionFailureFn.
         auto scopedPeerId = GetPeerScopedId(proxy->GetDeviceId());
         MATTER_LOG_METRIC_BEGIN(kMetricDeviceCommissioningOperationalSetup);
-        mSystemState->CASESessionMgr()->FindOrEstablishSession(scopedPeerId, &mOnDeviceConnectedCallback,
-                                                               &mOnDeviceConnectionFailureCallback
+        mSystemState->CASESessionMgr()->FindOrEstablishSession(scopedPeerId, &mCommissionee->mOnDeviceConnectedCallback,
+                                                               &mCommissionee->mOnDeviceConnectionFailureCallback
 #if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
                                                                ,
-                                                               /* attemptCount = */ 3, &mOnDeviceConnectionRetryCallback
+                                                               /* attemptCount = */ 3,
+                                                               &mCommissionee->mOnDeviceConnectionRetryCallback
 #endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
         );
     }
@@ -3853,7 +4306,7 @@ void DeviceCommissioner::PerformCommissioningStep(DeviceProxy * proxy, Commissio
         CleanupCommissioning(proxy, proxy->GetDeviceId(), params.GetCompletionStatus());
         break;
     case CommissioningStage::kError:
-        mCommissioningStage = CommissioningStage::kSecurePairing;
+        mCommissionee->mCommissioningStage = CommissioningStage::kSecurePairing;
         break;
     case CommissioningStage::kSecurePairing:
         break;
@@ -78,6 +78,12 @@
 
 namespace chip {
 
+namespace Test {
+
+class DeviceCommissionerTestAccess;
+
+} // namespace Test
+
 namespace Controller {
 
 inline constexpr uint16_t kNumMaxActiveDevices = CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_DEVICES;
@@ -476,6 +482,8 @@ class DLL_EXPORT DeviceCommissioner : public DeviceController,
 #endif
                                       public SessionEstablishmentDelegate
 {
+    friend class chip::Test::DeviceCommissionerTestAccess;
+
 public:
     DeviceCommissioner();
     ~DeviceCommissioner() override {}
@@ -499,6 +507,10 @@ public:
      *  Tears down the entirety of the stack, including destructing key objects in the system.
      *  This is not a thread-safe API, and should be called with external synchronization.
      *
+     *  The state of a commissionee whose device attestation verification or NOC chain generation is still in
+     *  progress is kept until the verifier or the credentials issuer calls back, which must happen before the
+     *  commissioner is destroyed.
+     *
      *  Please see implementation for more details.
      */
     void Shutdown() override;
@@ -699,9 +711,13 @@ public:
      * commissioning stage will return to kNeedsNetworkCreds so that the DevicePairingDelegate can re-attempt with new
      * network information. The DevicePairingDelegate can exit the commissioning process by calling StopPairing.
      *
+     * When several devices are being commissioned, this applies to the device whose commissioning callback is running, or
+     * to the only device waiting for network credentials. Use the NodeId overload in other cases.
+     *
      * @return CHIP_ERROR   The return status. Returns CHIP_ERROR_INCORRECT_STATE if not in the correct state (kNeedsNetworkCreds).
      */
     CHIP_ERROR NetworkCredentialsReady();
+    CHIP_ERROR NetworkCredentialsReady(NodeId remoteDeviceId);
 
     /**
      * @brief
@@ -718,12 +734,22 @@ public:
      * (kICDGetRegistrationInfo).
      */
     CHIP_ERROR ICDRegistrationInfoReady();
+    CHIP_ERROR ICDRegistrationInfoReady(NodeId remoteDeviceId);
 
     /**
      * @brief
      *  This function returns the current CommissioningStage for this commissioner.
+     *
+     *  When several devices are being commissioned, this is the stage of the device whose commissioning callback is
+     *  running, or of the only device being commissioned. Otherwise it is kSecurePairing.
      */
-    CommissioningStage GetCommissioningStage() { return mCommissioningStage; }
+    CommissioningStage GetCommissioningStage();
+
+    /**
+     * @brief
+     *  Returns the current CommissioningStage of the given device, or kSecurePairing if it is not being commissioned.
+     */
+    CommissioningStage GetCommissioningStage(NodeId remoteDeviceId);
 
 #if CONFIG_NETWORK_LAYER_BLE
 #if CHIP_DEVICE_CONFIG_ENABLE_BOTH_COMMISSIONER_AND_COMMISSIONEE
@@ -828,12 +854,13 @@ public:
 
     Credentials::DeviceAttestationVerifier * GetDeviceAttestationVerifier() const { return mDeviceAttestationVerifier; }
 
-    const CommissioningParameters & GetCommissioningParameters() { return mDefaultCommissioner->GetCommissioningParameters(); }
+    // Commissioning parameters of the device being commissioned (resolved as for GetCommissioningStage()), or of the default
+    // commissioner when no device is being commissioned.
+    const CommissioningParameters & GetCommissioningParameters();
+    const CommissioningParameters & GetCommissioningParameters(NodeId remoteDeviceId);
 
-    CHIP_ERROR UpdateCommissioningParameters(const CommissioningParameters & newParameters)
-    {
-        return mDefaultCommissioner->SetCommissioningParameters(newParameters);
-    }
+    CHIP_ERROR UpdateCommissioningParameters(const CommissioningParameters & newParameters);
+    CHIP_ERROR UpdateCommissioningParameters(NodeId remoteDeviceId, const CommissioningParameters & newParameters);
 
     // Reset the arm failsafe timer during commissioning.  If this returns
     // false, that means that the timer was already set for a longer time period
@@ -871,37 +898,168 @@ protected:
     }
 #endif // CHIP_CONFIG_ENABLE_READ_CLIENT
 
+private:
+    class CommissioneeState;
+
+    /**
+     * The callbacks a commissionee hands to the device attestation verifier and the operational credentials issuer. Those
+     * keep raw pointers to them and cannot be asked to drop them, so the callbacks are allocated apart from the
+     * CommissioneeState: when the state is released while some of them are pending (e.g. by Shutdown()), they are detached
+     * from it, drop their result, and free themselves once the last pending one has been called.
+     */
+    struct AsyncCallbacks
+    {
+        explicit AsyncCallbacks(CommissioneeState * commissionee);
+
+        // Called first by each callback, with its context. Returns the commissionee the result is for, or nullptr if it
+        // was released in the meantime.
+        static CommissioneeState * Complete(void * context);
+
+        CommissioneeState * mCommissionee;
+        // Attestation verifications and NOC chain generations whose callback has not been called yet.
+        uint8_t mPending = 0;
+
+        chip::Callback::Callback<Credentials::DeviceAttestationVerifier::OnAttestationInformationVerification>
+            mDeviceAttestationInformationVerificationCallback;
+        chip::Callback::Callback<OnNOCChainGeneration> mDeviceNOCChainCallback;
+    };
+
+    /**
+     * State of one device going through PASE establishment and commissioning.
+     *
+     * The commissioning code below works on the commissionee selected by the innermost CommissioneeScope (mCommissionee).
+     * Callbacks from the session, interaction and credentials layers get their CommissioneeState as context and select it
+     * again, so that up to CHIP_CONFIG_MAX_CONCURRENT_COMMISSIONEES devices can make progress independently.
+     */
+    class CommissioneeState : public SessionEstablishmentDelegate
+    {
+    public:
+        CommissioneeState(DeviceCommissioner & commissioner, NodeId nodeId);
+        ~CommissioneeState() override;
+
+        // SessionEstablishmentDelegate, for the PASE session with this commissionee
+        void OnSessionEstablishmentError(CHIP_ERROR error) override;
+        void OnSessionEstablished(const SessionHandle & session) override;
+
+        bool IsCommissioning() const
+        {
+            return mDeviceBeingCommissioned != nullptr || mCommissioningStage != CommissioningStage::kSecurePairing ||
+                mRunCommissioningAfterConnection;
+        }
+        bool IsIdle();
+
+        DeviceCommissioner & mDeviceCommissioner;
+        const NodeId mNodeId;
+
+        DeviceProxy * mDeviceBeingCommissioned               = nullptr;
+        CommissioneeDeviceProxy * mDeviceInPASEEstablishment = nullptr;
+
+        Optional<System::Clock::Timeout> mCommissioningStepTimeout; // Note: For multi-interaction steps this is per interaction
+        CommissioningStage mCommissioningStage = CommissioningStage::kSecurePairing;
+        uint8_t mReadCommissioningInfoProgress = 0; // see ContinueReadingCommissioningInfo()
+
+        bool mRunCommissioningAfterConnection = false;
+        Internal::InvokeCancelFn mInvokeCancelFn;
+        Internal::WriteCancelFn mWriteCancelFn;
+
+        // While we have an ongoing PASE attempt (i.e. after calling Pair() on the
+        // PASESession), track which RendezvousParameters we used for that attempt.
+        // This allows us to notify delegates about which thing it was we actually
+        // established PASE with, especially in the context of concatenated QR
+        // codes.
+        //
+        // This member only has a value while we are in the middle of session
+        // establishment.
+        std::optional<RendezvousParameters> mRendezvousParametersForPASEEstablishment;
+
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
-    Platform::UniquePtr<app::ClusterStateCache> mAttributeCache;
-    Platform::UniquePtr<app::ReadClient> mReadClient;
+        Platform::UniquePtr<app::ClusterStateCache> mAttributeCache;
+        Platform::UniquePtr<app::ReadClient> mReadClient;
 #endif // CHIP_CONFIG_ENABLE_READ_CLIENT
 
-private:
-    DevicePairingDelegate * mPairingDelegate = nullptr;
+        chip::Callback::Callback<OnDeviceConnected> mOnDeviceConnectedCallback;
+        chip::Callback::Callback<OnDeviceConnectionFailure> mOnDeviceConnectionFailureCallback;
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+        chip::Callback::Callback<OnDeviceConnectionRetry> mOnDeviceConnectionRetryCallback;
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+
+        // Allocated with the state by FindOrCreateCommissionee(). While the commissioner runs, the state is kept alive until
+        // the pending callbacks are done.
+        AsyncCallbacks * mAsyncCallbacks = nullptr;
+
+        // Only allocated when several devices can be commissioned with the built-in AutoCommissioner.
+        Platform::UniquePtr<AutoCommissioner> mAutoCommissioner;
+        // Commissioning delegate to call when PairDevice / Commission functions are used
+        CommissioningDelegate * mDefaultCommissioner;
+        CommissioningDelegate * mCommissioningDelegate =
+            nullptr; // Commissioning delegate that issued the PerformCommissioningStep command
+        CompletionStatus mCommissioningCompletionStatus;
+        Credentials::AttestationVerificationResult mAttestationResult;
+        Platform::UniquePtr<Credentials::DeviceAttestationVerifier::AttestationDeviceInfo> mAttestationDeviceInfo;
+
+        uint8_t mScopeDepth = 0; // number of CommissioneeScope objects selecting this commissionee
+    };
 
-    DeviceProxy * mDeviceBeingCommissioned               = nullptr;
-    CommissioneeDeviceProxy * mDeviceInPASEEstablishment = nullptr;
+    /**
+     * Selects a commissionee as mCommissionee for its lifetime, restoring the previous one when it ends. When the outermost
+     * scope for a commissionee ends and the commissionee has nothing left in progress, its state is released.
+     */
+    class CommissioneeScope
+    {
+    public:
+        CommissioneeScope(DeviceCommissioner & commissioner, CommissioneeState * commissionee);
+        // For callbacks whose context is a CommissioneeState.
+        explicit CommissioneeScope(void * context) :
+            CommissioneeScope(static_cast<CommissioneeState *>(context)->mDeviceCommissioner,
+                              static_cast<CommissioneeState *>(context))
+        {}
+        ~CommissioneeScope();
+
+        CommissioneeScope(const CommissioneeScope &)             = delete;
+        CommissioneeScope & operator=(const CommissioneeScope &) = delete;
+
+        DeviceCommissioner * GetCommissioner() const { return &mCommissioner; }
+
+    private:
+        DeviceCommissioner & mCommissioner;
+        CommissioneeState * mCommissionee;
+        CommissioneeState * mPrevious;
+    };
+
+    // Enough for a full set of PASE establishments and commissionings, plus one commissionee whose completion
+    // callback is starting another one.
+    static constexpr size_t kMaxCommissioneeStates = 2 * CHIP_CONFIG_MAX_CONCURRENT_COMMISSIONEES + 1;
+
+    CommissioneeState * FindCommissionee(NodeId nodeId);
+    CommissioneeState * FindOrCreateCommissionee(NodeId nodeId);
+    // The current commissionee, or else the only one being commissioned.
+    CommissioneeState * ResolveCommissionee();
+    // The current commissionee if it is for nodeId, or else the one for nodeId.
+    CommissioneeState * ResolveCommissionee(NodeId nodeId);
+    void ReleaseCommissionee(CommissioneeState * commissionee);
+    // Shutdown() steps: stop what is in progress for every commissionee, then release the commissionee devices and the
+    // commissionees that are not in use anymore.
+    void StopCommissionees();
+    void ReleaseCommissionees();
+    // BLE and Wi-Fi PAF PASE establishment is limited to one device at a time, see CanEstablishPASE().
+    CommissioneeState * FindCommissioneeEstablishingPASE(Transport::Type transportType);
+    bool CanEstablishPASE(Transport::Type transportType);
+    // Whether each commissionee gets its own AutoCommissioner, which is what allows commissioning devices concurrently.
+    bool UsesPerCommissioneeCommissioner() const
+    {
+        return CHIP_CONFIG_MAX_CONCURRENT_COMMISSIONEES > 1 && mDefaultCommissioner == &mAutoCommissioner;
+    }
+    // The pairing delegate to notify about the current commissionee. While the SetUpCodePairer waits for a PASE session
+    // with another device, this is the delegate it stands in for.
+    DevicePairingDelegate * PairingDelegateForCommissionee() const;
 
-    Optional<System::Clock::Timeout> mCommissioningStepTimeout; // Note: For multi-interaction steps this is per interaction
-    CommissioningStage mCommissioningStage = CommissioningStage::kSecurePairing;
-    uint8_t mReadCommissioningInfoProgress = 0; // see ContinueReadingCommissioningInfo()
+    DevicePairingDelegate * mPairingDelegate = nullptr;
 
-    bool mRunCommissioningAfterConnection = false;
-    Internal::InvokeCancelFn mInvokeCancelFn;
-    Internal::WriteCancelFn mWriteCancelFn;
+    ObjectPool<CommissioneeState, kMaxCommissioneeStates> mCommissionees;
+    CommissioneeState * mCommissionee = nullptr;
 
     ObjectPool<CommissioneeDeviceProxy, kNumMaxActiveDevices> mCommissioneeDevicePool;
 
-    // While we have an ongoing PASE attempt (i.e. after calling Pair() on the
-    // PASESession), track which RendezvousParameters we used for that attempt.
-    // This allows us to notify delegates about which thing it was we actually
-    // established PASE with, especially in the context of concatenated QR
-    // codes.
-    //
-    // This member only has a value while we are in the middle of session
-    // establishment.
-    std::optional<RendezvousParameters> mRendezvousParametersForPASEEstablishment;
-
 #if CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY // make this commissioner discoverable
     Protocols::UserDirectedCommissioning::UserDirectedCommissioningServer * mUdcServer = nullptr;
     // mUdcTransportMgr is for insecure communication (ex. user directed commissioning)
@@ -1134,25 +1292,11 @@ private:
 
     bool IsAttestationInformationMissing(const CommissioningParameters & params);
 
-    chip::Callback::Callback<OnDeviceConnected> mOnDeviceConnectedCallback;
-    chip::Callback::Callback<OnDeviceConnectionFailure> mOnDeviceConnectionFailureCallback;
-#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
-    chip::Callback::Callback<OnDeviceConnectionRetry> mOnDeviceConnectionRetryCallback;
-#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
-
-    chip::Callback::Callback<Credentials::DeviceAttestationVerifier::OnAttestationInformationVerification>
-        mDeviceAttestationInformationVerificationCallback;
-
-    chip::Callback::Callback<OnNOCChainGeneration> mDeviceNOCChainCallback;
     SetUpCodePairer mSetUpCodePairer;
     AutoCommissioner mAutoCommissioner;
-    CommissioningDelegate * mDefaultCommissioner =
-        &mAutoCommissioner; // Commissioning delegate to call when PairDevice / Commission functions are used
-    CommissioningDelegate * mCommissioningDelegate =
-        nullptr; // Commissioning delegate that issued the PerformCommissioningStep command
-    CompletionStatus mCommissioningCompletionStatus;
-    Credentials::AttestationVerificationResult mAttestationResult;
-    Platform::UniquePtr<Credentials::DeviceAttestationVerifier::AttestationDeviceInfo> mAttestationDeviceInfo;
+    // Commissioning delegate to call when PairDevice / Commission functions are used. When each commissionee has its own
+    // AutoCommissioner, this holds the parameters new commissionees start with.
+    CommissioningDelegate * mDefaultCommissioner = &mAutoCommissioner;
     Credentials::DeviceAttestationVerifier * mDeviceAttestationVerifier = nullptr;
 
 #if CHIP_DEVICE_CONFIG_ENABLE_JOINT_FABRIC
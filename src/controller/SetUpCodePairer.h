@@ -120,6 +120,19 @@ public:
     // whichever node we're pairing if kUndefinedNodeId is passed.
     bool StopPairing(NodeId remoteId = kUndefinedNodeId);
 
+    // Returns the pairing delegate that notifications about remoteId should go
+    // to, given the delegate registered on mCommissioner.  While we wait for
+    // PASE, we are registered in place of the original delegate, but only
+    // notifications about our own node are meant for us.
+    DevicePairingDelegate * ResolvePairingDelegate(NodeId remoteId, DevicePairingDelegate * registered) const
+    {
+        if (mWaitingForPASE && registered == this && remoteId != kUndefinedNodeId && remoteId != mRemoteId)
+        {
+            return mPairingDelegate;
+        }
+        return registered;
+    }
+
 private:
     // DevicePairingDelegate implementation.
     void OnStatusUpdate(DevicePairingDelegate::Status status) override;
@@ -0,0 +1,78 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <controller/CHIPDeviceController.h>
+
+namespace chip {
+
+namespace Test {
+// Provides access to the per-commissionee state of DeviceCommissioner class for testing
+class DeviceCommissionerTestAccess
+{
+public:
+    using CommissioneeState = Controller::DeviceCommissioner::CommissioneeState;
+    using CommissioneeScope = Controller::DeviceCommissioner::CommissioneeScope;
+
+    DeviceCommissionerTestAccess() = delete;
+    DeviceCommissionerTestAccess(Controller::DeviceCommissioner * commissioner) : mCommissioner(commissioner) {}
+
+    // Lets the commissioner run commissioning steps without a controller stack.
+    void SetInitialized(bool initialized)
+    {
+        mCommissioner->mState =
+            initialized ? Controller::DeviceCommissioner::State::Initialized : Controller::DeviceCommissioner::State::NotInitialized;
+    }
+
+    CommissioneeState * FindCommissionee(NodeId nodeId) { return mCommissioner->FindCommissionee(nodeId); }
+    CommissioneeState * FindOrCreateCommissionee(NodeId nodeId) { return mCommissioner->FindOrCreateCommissionee(nodeId); }
+    CommissioneeState * GetCurrentCommissionee() const { return mCommissioner->mCommissionee; }
+
+    size_t GetCommissioneeCount()
+    {
+        size_t count = 0;
+        mCommissioner->mCommissionees.ForEachActiveObject([&count](CommissioneeState *) {
+            count++;
+            return Loop::Continue;
+        });
+        return count;
+    }
+
+    // Puts the commissionee in the given stage, as PerformCommissioningStep() does.
+    void SetCommissioningStage(CommissioneeState * commissionee, DeviceProxy * device, Controller::CommissioningStage stage,
+                               Controller::CommissioningDelegate * delegate)
+    {
+        commissionee->mDeviceBeingCommissioned = device;
+        commissionee->mCommissioningStage      = stage;
+        commissionee->mCommissioningDelegate   = delegate;
+    }
+
+    uint8_t GetPendingAsyncCallbacks(CommissioneeState * commissionee) const { return commissionee->mAsyncCallbacks->mPending; }
+
+    // The commissionee part of DeviceCommissioner::Shutdown().
+    void ShutdownCommissionees()
+    {
+        mCommissioner->StopCommissionees();
+        mCommissioner->ReleaseCommissionees();
+    }
+
+private:
+    Controller::DeviceCommissioner * mCommissioner = nullptr;
+};
+
+} // namespace Test
+} // namespace chip
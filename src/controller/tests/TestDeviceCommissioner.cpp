@@ -0,0 +1,308 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <controller/CHIPDeviceController.h>
+#include <controller/CommissioningDelegate.h>
+#include <controller/tests/DeviceCommissionerTestAccess.h>
+#include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+
+#include <vector>
+
+using namespace chip;
+using namespace chip::Controller;
+using namespace chip::Credentials;
+
+using chip::Test::DeviceCommissionerTestAccess;
+
+namespace {
+
+constexpr NodeId kFirstNodeId  = 0x1001;
+constexpr NodeId kSecondNodeId = 0x1002;
+
+class FakeDeviceProxy : public DeviceProxy
+{
+public:
+    explicit FakeDeviceProxy(NodeId nodeId) : mNodeId(nodeId) {}
+
+    void Disconnect() override {}
+    NodeId GetDeviceId() const override { return mNodeId; }
+    Messaging::ExchangeManager * GetExchangeManager() const override { return nullptr; }
+    Optional<SessionHandle> GetSecureSession() const override { return NullOptional; }
+
+private:
+    bool IsSecureConnected() const override { return false; }
+
+    NodeId mNodeId;
+};
+
+/**
+ * Verifier holding on to the attestation callbacks until the test completes them, like a verifier that checks
+ * revocation lists asynchronously.
+ */
+class PendingAttestationVerifier : public DeviceAttestationVerifier
+{
+public:
+    void VerifyAttestationInformation(const AttestationInfo & info,
+                                      Callback::Callback<OnAttestationInformationVerification> * onCompletion) override
+    {
+        mPending.push_back(onCompletion);
+    }
+
+    AttestationVerificationResult ValidateCertificationDeclarationSignature(const ByteSpan & cmsEnvelopeBuffer,
+                                                                            ByteSpan & certDeclBuffer) override
+    {
+        return AttestationVerificationResult::kNotImplemented;
+    }
+
+    AttestationVerificationResult ValidateCertificateDeclarationPayload(const ByteSpan & certDeclBuffer,
+                                                                        const ByteSpan & firmwareInfo,
+                                                                        const DeviceInfoForAttestation & deviceInfo) override
+    {
+        return AttestationVerificationResult::kNotImplemented;
+    }
+
+    CHIP_ERROR VerifyNodeOperationalCSRInformation(const ByteSpan & nocsrElementsBuffer, const ByteSpan & attestationChallengeBuffer,
+                                                   const ByteSpan & attestationSignatureBuffer,
+                                                   const Crypto::P256PublicKey & dacPublicKey, const ByteSpan & csrNonce) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+    void CheckForRevokedDACChain(const AttestationInfo & info,
+                                 Callback::Callback<OnAttestationInformationVerification> * onCompletion) override
+    {
+        mPending.push_back(onCompletion);
+    }
+
+    size_t PendingCount() const { return mPending.size(); }
+
+    void Complete(size_t index, AttestationVerificationResult result)
+    {
+        ASSERT_LT(index, mPending.size());
+        Callback::Callback<OnAttestationInformationVerification> * onCompletion = mPending[index];
+        mPending.erase(mPending.begin() + static_cast<std::ptrdiff_t>(index));
+        onCompletion->mCall(onCompletion->mContext, Info(), result);
+    }
+
+    static const AttestationInfo & Info()
+    {
+        static const AttestationInfo info(ByteSpan(), ByteSpan(), ByteSpan(), ByteSpan(), ByteSpan(), ByteSpan(),
+                                          VendorId::TestVendor1, 0x8001);
+        return info;
+    }
+
+private:
+    std::vector<Callback::Callback<OnAttestationInformationVerification> *> mPending;
+};
+
+/**
+ * Commissioning delegate recording the steps reported as finished, and which commissionee was selected when they were.
+ */
+class RecordingCommissioningDelegate : public CommissioningDelegate
+{
+public:
+    struct Step
+    {
+        CHIP_ERROR err;
+        CommissioningStage stage;
+        NodeId currentNodeId;
+    };
+
+    explicit RecordingCommissioningDelegate(DeviceCommissionerTestAccess & access) : mAccess(access) {}
+
+    CHIP_ERROR SetCommissioningParameters(const CommissioningParameters & params) override { return CHIP_NO_ERROR; }
+    const CommissioningParameters & GetCommissioningParameters() const override { return mParams; }
+    void SetOperationalCredentialsDelegate(OperationalCredentialsDelegate * operationalCredentialsDelegate) override {}
+    CHIP_ERROR StartCommissioning(DeviceCommissioner * commissioner, CommissioneeDeviceProxy * proxy) override
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR CommissioningStepFinished(CHIP_ERROR err, CommissioningReport report) override
+    {
+        DeviceCommissionerTestAccess::CommissioneeState * current = mAccess.GetCurrentCommissionee();
+        mSteps.push_back({ err, report.stageCompleted, (current != nullptr) ? current->mNodeId : kUndefinedNodeId });
+        return CHIP_NO_ERROR;
+    }
+
+    std::vector<Step> mSteps;
+
+private:
+    DeviceCommissionerTestAccess & mAccess;
+    CommissioningParameters mParams;
+};
+
+class TestDeviceCommissioner : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        mCommissioner.SetDeviceAttestationVerifier(&mVerifier);
+        mAccess.SetInitialized(true);
+    }
+
+    void TearDown() override
+    {
+        mAccess.ShutdownCommissionees();
+        EXPECT_EQ(mAccess.GetCommissioneeCount(), 0u);
+        mAccess.SetInitialized(false);
+    }
+
+    // Creates a commissionee in the attestation verification stage, and starts the verification.
+    DeviceCommissionerTestAccess::CommissioneeState * StartVerification(FakeDeviceProxy & device)
+    {
+        DeviceCommissionerTestAccess::CommissioneeState * commissionee = mAccess.FindOrCreateCommissionee(device.GetDeviceId());
+        VerifyOrReturnValue(commissionee != nullptr, nullptr);
+
+        DeviceCommissionerTestAccess::CommissioneeScope scope(mCommissioner, commissionee);
+        mAccess.SetCommissioningStage(commissionee, &device, CommissioningStage::kAttestationVerification, &mDelegate);
+        EXPECT_EQ(mCommissioner.ValidateAttestationInfo(PendingAttestationVerifier::Info()), CHIP_NO_ERROR);
+        return commissionee;
+    }
+
+protected:
+    DeviceCommissioner mCommissioner;
+    DeviceCommissionerTestAccess mAccess{ &mCommissioner };
+    PendingAttestationVerifier mVerifier;
+    RecordingCommissioningDelegate mDelegate{ mAccess };
+    FakeDeviceProxy mFirstDevice{ kFirstNodeId };
+    FakeDeviceProxy mSecondDevice{ kSecondNodeId };
+};
+
+TEST_F(TestDeviceCommissioner, TestConcurrentCommissioneesCompleteIndependently)
+{
+    auto * first  = StartVerification(mFirstDevice);
+    auto * second = StartVerification(mSecondDevice);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_NE(first, second);
+
+    EXPECT_EQ(mVerifier.PendingCount(), 2u);
+    EXPECT_EQ(mAccess.GetPendingAsyncCallbacks(first), 1);
+    EXPECT_EQ(mAccess.GetPendingAsyncCallbacks(second), 1);
+    EXPECT_EQ(mAccess.GetCurrentCommissionee(), nullptr);
+
+    // The verifications complete in the opposite order, each reaching its own commissionee.
+    mVerifier.Complete(1, AttestationVerificationResult::kSuccess);
+    EXPECT_EQ(mAccess.GetPendingAsyncCallbacks(first), 1);
+    EXPECT_EQ(mAccess.GetPendingAsyncCallbacks(second), 0);
+
+    mVerifier.Complete(0, AttestationVerificationResult::kDacExpired);
+    EXPECT_EQ(mAccess.GetPendingAsyncCallbacks(first), 0);
+
+    ASSERT_EQ(mDelegate.mSteps.size(), 2u);
+    EXPECT_EQ(mDelegate.mSteps[0].currentNodeId, kSecondNodeId);
+    EXPECT_EQ(mDelegate.mSteps[0].err, CHIP_NO_ERROR);
+    EXPECT_EQ(mDelegate.mSteps[0].stage, CommissioningStage::kAttestationVerification);
+    EXPECT_EQ(mDelegate.mSteps[1].currentNodeId, kFirstNodeId);
+    EXPECT_EQ(mDelegate.mSteps[1].err, CHIP_ERROR_FAILED_DEVICE_ATTESTATION);
+
+    EXPECT_EQ(mAccess.GetCurrentCommissionee(), nullptr);
+    EXPECT_EQ(mAccess.FindCommissionee(kFirstNodeId), first);
+    EXPECT_EQ(mAccess.FindCommissionee(kSecondNodeId), second);
+}
+
+TEST_F(TestDeviceCommissioner, TestScopeIsRestoredAcrossAsyncCompletions)
+{
+    auto * first  = StartVerification(mFirstDevice);
+    auto * second = StartVerification(mSecondDevice);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+
+    {
+        // The second verification completes while the first commissionee is selected, e.g. from one of its callbacks.
+        DeviceCommissionerTestAccess::CommissioneeScope scope(mCommissioner, first);
+        mVerifier.Complete(1, AttestationVerificationResult::kSuccess);
+
+        ASSERT_EQ(mDelegate.mSteps.size(), 1u);
+        EXPECT_EQ(mDelegate.mSteps[0].currentNodeId, kSecondNodeId);
+        EXPECT_EQ(mAccess.GetCurrentCommissionee(), first);
+        EXPECT_EQ(mAccess.GetPendingAsyncCallbacks(second), 0);
+    }
+    EXPECT_EQ(mAccess.GetCurrentCommissionee(), nullptr);
+
+    mVerifier.Complete(0, AttestationVerificationResult::kSuccess);
+    ASSERT_EQ(mDelegate.mSteps.size(), 2u);
+    EXPECT_EQ(mDelegate.mSteps[1].currentNodeId, kFirstNodeId);
+    EXPECT_EQ(mAccess.GetCurrentCommissionee(), nullptr);
+}
+
+TEST_F(TestDeviceCommissioner, TestShutdownReleasesCommissioneeWithPendingCallback)
+{
+    auto * first  = StartVerification(mFirstDevice);
+    auto * second = StartVerification(mSecondDevice);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    mVerifier.Complete(1, AttestationVerificationResult::kSuccess);
+    mDelegate.mSteps.clear();
+
+    mAccess.ShutdownCommissionees();
+
+    // The state is released although the verifier still holds on to its callback.
+    EXPECT_EQ(mAccess.GetCommissioneeCount(), 0u);
+    EXPECT_EQ(mAccess.FindCommissionee(kFirstNodeId), nullptr);
+    EXPECT_EQ(mAccess.FindCommissionee(kSecondNodeId), nullptr);
+
+    // A new commissioning of the same node gets its own state.
+    auto * restarted = mAccess.FindOrCreateCommissionee(kFirstNodeId);
+    ASSERT_NE(restarted, nullptr);
+    EXPECT_EQ(mAccess.GetCommissioneeCount(), 1u);
+
+    // The late result is dropped.
+    mVerifier.Complete(0, AttestationVerificationResult::kSuccess);
+    EXPECT_TRUE(mDelegate.mSteps.empty());
+    EXPECT_EQ(mAccess.GetCommissioneeCount(), 1u);
+    EXPECT_EQ(mAccess.FindCommissionee(kFirstNodeId), restarted);
+    EXPECT_EQ(mAccess.GetPendingAsyncCallbacks(restarted), 0);
+    EXPECT_EQ(mAccess.GetCurrentCommissionee(), nullptr);
+}
+
+TEST_F(TestDeviceCommissioner, TestCommissionerDestroyedWithPendingCallback)
+{
+    {
+        DeviceCommissioner commissioner;
+        DeviceCommissionerTestAccess access(&commissioner);
+        commissioner.SetDeviceAttestationVerifier(&mVerifier);
+        access.SetInitialized(true);
+
+        auto * commissionee = access.FindOrCreateCommissionee(kFirstNodeId);
+        ASSERT_NE(commissionee, nullptr);
+        {
+            DeviceCommissionerTestAccess::CommissioneeScope scope(commissioner, commissionee);
+            access.SetCommissioningStage(commissionee, &mFirstDevice, CommissioningStage::kAttestationVerification, &mDelegate);
+            EXPECT_EQ(commissioner.ValidateAttestationInfo(PendingAttestationVerifier::Info()), CHIP_NO_ERROR);
+        }
+
+        access.ShutdownCommissionees();
+        EXPECT_EQ(access.GetCommissioneeCount(), 0u);
+        access.SetInitialized(false);
+    }
+
+    // The commissioner is gone: the late callback only frees itself.
+    ASSERT_EQ(mVerifier.PendingCount(), 1u);
+    mVerifier.Complete(0, AttestationVerificationResult::kSuccess);
+    EXPECT_TRUE(mDelegate.mSteps.empty());
+}
+
+} // namespace
@@ -17,14 +17,23 @@
 #include "FileAttestationTrustStore.h"
 
 #include <crypto/CHIPCryptoPAL.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <cerrno>
 #include <cstdio>
 #include <cstring>
 #include <string>
 
 extern "C" {
 #include <dirent.h>
+#include <unistd.h>
 }
 
+#ifdef __linux__
+#include <sys/inotify.h>
+#endif
+
 namespace chip {
 namespace Credentials {
 
@@ -50,6 +59,8 @@ FileAttestationTrustStore::FileAttestationTrustStore(const char * paaTrustStoreP
         VerifyOrReturn(paaCount());
     }
 
+    mTrustStorePath = paaTrustStorePath;
+    BuildIndex();
     mIsInitialized = true;
 }
 
@@ -140,10 +151,96 @@ FileAttestationTrustStore::~FileAttestationTrustStore()
 
 void FileAttestationTrustStore::Cleanup()
 {
+    if (mWatchFd >= 0)
+    {
+        close(mWatchFd);
+        mWatchFd = -1;
+    }
     mPAADerCerts.clear();
+    mPAAIndex.clear();
     mIsInitialized = false;
 }
 
+size_t FileAttestationTrustStore::SkidHash::operator()(const Skid & skid) const
+{
+    size_t hash;
+    static_assert(sizeof(hash) <= sizeof(Skid), "SKID too short to fill a hash");
+    memcpy(&hash, skid.data(), sizeof(hash));
+    return hash;
+}
+
+void FileAttestationTrustStore::BuildIndex() const
+{
+    mPAAIndex.clear();
+    mPAAIndex.reserve(mPAADerCerts.size());
+
+    for (size_t i = 0; i < mPAADerCerts.size(); i++)
+    {
+        Skid skid;
+        MutableByteSpan skidSpan{ skid };
+        const ByteSpan certSpan{ mPAADerCerts[i].data(), mPAADerCerts[i].size() };
+        if ((CHIP_NO_ERROR != Crypto::ExtractSKIDFromX509Cert(certSpan, skidSpan)) || (skidSpan.size() != skid.size()))
+        {
+            continue;
+        }
+
+        // On duplicate SKIDs, the first certificate loaded wins
+        mPAAIndex.emplace(skid, i);
+    }
+}
+
+CHIP_ERROR FileAttestationTrustStore::WatchForChanges()
+{
+    VerifyOrReturnError(mIsInitialized && !mTrustStorePath.empty(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mWatchFd < 0, CHIP_NO_ERROR);
+
+#ifdef __linux__
+    int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_POSIX(errno));
+
+    if (inotify_add_watch(fd, mTrustStorePath.c_str(), IN_CREATE | IN_CLOSE_WRITE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO) < 0)
+    {
+        CHIP_ERROR err = CHIP_ERROR_POSIX(errno);
+        close(fd);
+        return err;
+    }
+
+    mWatchFd = fd;
+    return CHIP_NO_ERROR;
+#else
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+void FileAttestationTrustStore::ReloadIfChanged() const
+{
+#ifdef __linux__
+    VerifyOrReturn(mWatchFd >= 0);
+
+    // Drain all pending events: any number of them results in a single reload
+    bool changed = false;
+    alignas(inotify_event) char events[1024];
+    while (read(mWatchFd, events, sizeof(events)) > 0)
+    {
+        changed = true;
+    }
+    VerifyOrReturn(changed);
+
+    std::vector<std::vector<uint8_t>> certs = LoadAllX509DerCerts(mTrustStorePath.c_str());
+    if (certs.empty())
+    {
+        ChipLogError(Support, "No PAA certificates found in %s, keeping the %u previously loaded", mTrustStorePath.c_str(),
+                     static_cast<unsigned>(mPAADerCerts.size()));
+        return;
+    }
+
+    mPAADerCerts = std::move(certs);
+    BuildIndex();
+    ChipLogProgress(Support, "Reloaded %u PAA certificates from %s", static_cast<unsigned>(mPAADerCerts.size()),
+                    mTrustStorePath.c_str());
+#endif
+}
+
 CHIP_ERROR FileAttestationTrustStore::GetProductAttestationAuthorityCert(const ByteSpan & skid,
                                                                          MutableByteSpan & outPaaDerBuffer) const
 {
@@ -158,23 +255,16 @@ CHIP_ERROR FileAttestationTrustStore::GetProductAttestationAuthorityCert(const B
     VerifyOrReturnError(!skid.empty() && (skid.data() != nullptr), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(skid.size() == Crypto::kSubjectKeyIdentifierLength, CHIP_ERROR_INVALID_ARGUMENT);
 
-    for (auto candidate : mPAADerCerts)
-    {
-        uint8_t skidBuf[Crypto::kSubjectKeyIdentifierLength] = { 0 };
-        MutableByteSpan candidateSkidSpan{ skidBuf };
-        if (CHIP_NO_ERROR != Crypto::ExtractSKIDFromX509Cert(ByteSpan{ candidate.data(), candidate.size() }, candidateSkidSpan))
-        {
-            continue;
-        }
+    ReloadIfChanged();
 
-        if (skid.data_equal(candidateSkidSpan))
-        {
-            // Found a match
-            return CopySpanToMutableSpan(ByteSpan{ candidate.data(), candidate.size() }, outPaaDerBuffer);
-        }
-    }
+    Skid key;
+    memcpy(key.data(), skid.data(), key.size());
+
+    auto found = mPAAIndex.find(key);
+    VerifyOrReturnError(found != mPAAIndex.end(), CHIP_ERROR_CA_CERT_NOT_FOUND);
 
-    return CHIP_ERROR_CA_CERT_NOT_FOUND;
+    const std::vector<uint8_t> & paa = mPAADerCerts[found->second];
+    return CopySpanToMutableSpan(ByteSpan{ paa.data(), paa.size() }, outPaaDerBuffer);
 }
 
 } // namespace Credentials
@@ -18,8 +18,11 @@
 
 #include <credentials/CHIPCert.h>
 #include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
+#include <crypto/CHIPCryptoPAL.h>
 
 #include <array>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace chip {
@@ -49,23 +52,61 @@ enum class CertificateValidationMode
 std::vector<std::vector<uint8_t>> LoadAllX509DerCerts(const char * trustStorePath,
                                                       CertificateValidationMode validationMode = CertificateValidationMode::kPAA);
 
+/**
+ * Attestation trust store serving the PAA certificates found in a directory.
+ *
+ * Certificates are parsed once when loaded and indexed by Subject Key Identifier, so that
+ * lookups do not depend on the number of PAAs in the store.
+ */
 class FileAttestationTrustStore : public AttestationTrustStore
 {
 public:
     FileAttestationTrustStore(const char * paaTrustStorePath = nullptr);
     ~FileAttestationTrustStore();
 
+    FileAttestationTrustStore(const FileAttestationTrustStore &)             = delete;
+    FileAttestationTrustStore & operator=(const FileAttestationTrustStore &) = delete;
+
     CHIP_ERROR GetProductAttestationAuthorityCert(const ByteSpan & skid, MutableByteSpan & outPaaDerBuffer) const override;
 
     bool IsInitialized() const { return mIsInitialized; }
     size_t paaCount() const { return mPAADerCerts.size(); };
 
+    /**
+     * @brief Reload the PAA certificates whenever the trust store directory changes.
+     *
+     * Changes are picked up by the next call to GetProductAttestationAuthorityCert(). A reload
+     * that finds no valid PAA certificate keeps the previously loaded certificates.
+     *
+     * Only available on Linux, where the directory is watched using inotify.
+     *
+     * @retval CHIP_ERROR_INCORRECT_STATE if the store was not initialized from a directory
+     * @retval CHIP_ERROR_NOT_IMPLEMENTED if directory watching is not supported on this platform
+     */
+    CHIP_ERROR WatchForChanges();
+
 protected:
-    std::vector<std::vector<uint8_t>> mPAADerCerts;
+    // Mutable so that changes to a watched directory can be applied during lookups.
+    mutable std::vector<std::vector<uint8_t>> mPAADerCerts;
 
 private:
+    using Skid = std::array<uint8_t, Crypto::kSubjectKeyIdentifierLength>;
+
+    struct SkidHash
+    {
+        // SKIDs are key hashes, so any of their bytes are already well distributed
+        size_t operator()(const Skid & skid) const;
+    };
+
     bool mIsInitialized = false;
+    std::string mTrustStorePath;
+    int mWatchFd = -1;
+
+    // Index of each certificate in mPAADerCerts, by SKID
+    mutable std::unordered_map<Skid, size_t, SkidHash> mPAAIndex;
 
+    void BuildIndex() const;
+    void ReloadIfChanged() const;
     void Cleanup();
 };
 
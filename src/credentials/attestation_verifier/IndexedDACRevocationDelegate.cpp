@@ -0,0 +1,197 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <credentials/attestation_verifier/IndexedDACRevocationDelegate.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemError.h>
+
+#include <cerrno>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace chip {
+namespace Credentials {
+
+namespace {
+
+template <typename FileIdentity>
+FileIdentity IdentityFromStat(const struct stat & st)
+{
+    FileIdentity identity;
+    identity.device           = static_cast<uint64_t>(st.st_dev);
+    identity.inode            = static_cast<uint64_t>(st.st_ino);
+    identity.size             = static_cast<uint64_t>(st.st_size);
+    identity.modificationTime = static_cast<int64_t>(st.st_mtime);
+    return identity;
+}
+
+} // namespace
+
+IndexedDACRevocationDelegate::~IndexedDACRevocationDelegate()
+{
+    Unmap();
+}
+
+CHIP_ERROR IndexedDACRevocationDelegate::SetRevocationSetIndexPath(std::string_view path)
+{
+    VerifyOrReturnError(!path.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    mPath = path;
+    return LoadIndex();
+}
+
+void IndexedDACRevocationDelegate::ClearRevocationSetIndexPath()
+{
+    Unmap();
+    mPath.clear();
+    mLastLoadAttempt = FileIdentity();
+}
+
+bool IndexedDACRevocationDelegate::IsRevocationSetIndexFile(const char * path)
+{
+    VerifyOrReturnValue(path != nullptr, false);
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    VerifyOrReturnValue(fd >= 0, false);
+
+    uint8_t magic[sizeof(RevocationSetIndex::kMagic)];
+    ssize_t readLength = read(fd, magic, sizeof(magic));
+    close(fd);
+
+    return (readLength == static_cast<ssize_t>(sizeof(magic))) && RevocationSetIndex::HasIndexMagic(ByteSpan(magic));
+}
+
+CHIP_ERROR IndexedDACRevocationDelegate::LoadIndex()
+{
+    int fd = open(mPath.c_str(), O_RDONLY | O_CLOEXEC);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_POSIX(errno),
+                        ChipLogError(NotSpecified, "Failed to open revocation set index %s", mPath.c_str()));
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        CHIP_ERROR err = CHIP_ERROR_POSIX(errno);
+        close(fd);
+        return err;
+    }
+    mLastLoadAttempt = IdentityFromStat<FileIdentity>(st);
+
+    const size_t length = static_cast<size_t>(st.st_size);
+    if (length < RevocationSetIndex::kHeaderLength)
+    {
+        close(fd);
+        ChipLogError(NotSpecified, "Revocation set index %s is truncated", mPath.c_str());
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    void * mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    VerifyOrReturnError(mapping != MAP_FAILED, CHIP_ERROR_POSIX(errno));
+
+    RevocationSetIndex index;
+    CHIP_ERROR err = index.Init(ByteSpan(static_cast<const uint8_t *>(mapping), length));
+    if (err != CHIP_NO_ERROR)
+    {
+        munmap(mapping, length);
+        ChipLogError(NotSpecified, "Invalid revocation set index %s: %" CHIP_ERROR_FORMAT, mPath.c_str(), err.Format());
+        return err;
+    }
+
+    // Only replace the current index once the new one is known to be valid
+    Unmap();
+    mMapping       = mapping;
+    mMappingLength = length;
+    mIndex         = index;
+
+    ChipLogProgress(NotSpecified, "Loaded %u revoked certificates from %s", static_cast<unsigned>(mIndex.EntryCount()),
+                    mPath.c_str());
+    return CHIP_NO_ERROR;
+}
+
+void IndexedDACRevocationDelegate::ReloadIfChanged()
+{
+    struct stat st;
+    VerifyOrReturn(stat(mPath.c_str(), &st) == 0);
+    VerifyOrReturn(!(IdentityFromStat<FileIdentity>(st) == mLastLoadAttempt));
+
+    // On failure, LoadIndex() keeps the current index
+    LoadIndex();
+}
+
+void IndexedDACRevocationDelegate::Unmap()
+{
+    mIndex.Clear();
+    if (mMapping != nullptr)
+    {
+        munmap(mMapping, mMappingLength);
+        mMapping       = nullptr;
+        mMappingLength = 0;
+    }
+}
+
+bool IndexedDACRevocationDelegate::IsCertificateRevoked(const ByteSpan & certDer) const
+{
+    RevocationSetIndex::Entry entry;
+    VerifyOrReturnValue(RevocationSetIndex::MakeEntryForCertificate(certDer, entry) == CHIP_NO_ERROR, false);
+    return mIndex.Contains(entry);
+}
+
+void IndexedDACRevocationDelegate::CheckForRevokedDACChain(
+    const DeviceAttestationVerifier::AttestationInfo & info,
+    Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> * onCompletion)
+{
+    AttestationVerificationResult attestationError = AttestationVerificationResult::kSuccess;
+
+    if (mPath.empty())
+    {
+        ChipLogProgress(NotSpecified, "WARNING: No revocation information available. Revocation checks will be skipped!");
+        onCompletion->mCall(onCompletion->mContext, info, attestationError);
+        return;
+    }
+
+    ReloadIfChanged();
+
+    if (IsCertificateRevoked(info.dacDerBuffer))
+    {
+        ChipLogProgress(NotSpecified, "Found revoked DAC in %s", mPath.c_str());
+        attestationError = AttestationVerificationResult::kDacRevoked;
+    }
+
+    if (IsCertificateRevoked(info.paiDerBuffer))
+    {
+        ChipLogProgress(NotSpecified, "Found revoked PAI in %s", mPath.c_str());
+
+        if (attestationError == AttestationVerificationResult::kDacRevoked)
+        {
+            attestationError = AttestationVerificationResult::kPaiAndDacRevoked;
+        }
+        else
+        {
+            attestationError = AttestationVerificationResult::kPaiRevoked;
+        }
+    }
+
+    onCompletion->mCall(onCompletion->mContext, info, attestationError);
+}
+
+} // namespace Credentials
+} // namespace chip
@@ -0,0 +1,108 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
+#include <credentials/attestation_verifier/RevocationSetIndex.h>
+#include <lib/support/Span.h>
+
+#include <string>
+#include <string_view>
+
+namespace chip {
+namespace Credentials {
+
+/**
+ * @brief Revocation delegate checking DAC chains against a compiled revocation set index.
+ *
+ * The index file (see RevocationSetIndex) is memory-mapped and each certificate check is a binary
+ * search. Before every check the file is checked for changes, and a changed index is mapped and
+ * validated before it replaces the current one, so a bad update never leaves the delegate without
+ * a revocation set.
+ *
+ * Index files must be replaced atomically (written to a temporary file, then renamed over the
+ * previous one), which is what the revocation set generator does.
+ *
+ * This is only available on POSIX platforms.
+ */
+class IndexedDACRevocationDelegate : public DeviceAttestationRevocationDelegate
+{
+public:
+    IndexedDACRevocationDelegate() = default;
+    ~IndexedDACRevocationDelegate() override;
+
+    IndexedDACRevocationDelegate(const IndexedDACRevocationDelegate &)             = delete;
+    IndexedDACRevocationDelegate & operator=(const IndexedDACRevocationDelegate &) = delete;
+
+    void CheckForRevokedDACChain(
+        const DeviceAttestationVerifier::AttestationInfo & info,
+        Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> * onCompletion) override;
+
+    /**
+     * @brief Set the path of the revocation set index and load it.
+     *
+     * @retval CHIP_ERROR_INVALID_ARGUMENT if the path is empty or the file is not a valid index
+     * @retval CHIP_ERROR_VERSION_MISMATCH if the index uses an unsupported format version
+     */
+    CHIP_ERROR SetRevocationSetIndexPath(std::string_view path);
+
+    /**
+     * @brief Unload the index. Revocation checks are skipped until a new path is set.
+     */
+    void ClearRevocationSetIndexPath();
+
+    /**
+     * @brief Number of revoked certificates in the loaded index.
+     */
+    size_t RevokedCertificateCount() const { return mIndex.EntryCount(); }
+
+    /**
+     * @brief Returns true if the file at `path` looks like a revocation set index, as opposed to
+     *        a JSON revocation set.
+     */
+    static bool IsRevocationSetIndexFile(const char * path);
+
+private:
+    struct FileIdentity
+    {
+        uint64_t device          = 0;
+        uint64_t inode           = 0;
+        uint64_t size            = 0;
+        int64_t modificationTime = 0;
+
+        bool operator==(const FileIdentity & other) const
+        {
+            return (device == other.device) && (inode == other.inode) && (size == other.size) &&
+                (modificationTime == other.modificationTime);
+        }
+    };
+
+    CHIP_ERROR LoadIndex();
+    void ReloadIfChanged();
+    void Unmap();
+    bool IsCertificateRevoked(const ByteSpan & certDer) const;
+
+    std::string mPath;
+    FileIdentity mLastLoadAttempt; // file last given to LoadIndex(), whether or not it was valid
+    void * mMapping       = nullptr;
+    size_t mMappingLength = 0;
+    RevocationSetIndex mIndex;
+};
+
+} // namespace Credentials
+} // namespace chip
@@ -0,0 +1,170 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <credentials/attestation_verifier/RevocationSetIndex.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace chip {
+namespace Credentials {
+
+namespace {
+
+constexpr size_t kMagicOffset      = 0;
+constexpr size_t kVersionOffset    = 4;
+constexpr size_t kEntryCountOffset = 8;
+
+constexpr size_t kIssuerOffset       = 0;
+constexpr size_t kAkidOffset         = kIssuerOffset + RevocationSetIndex::kIssuerHashLength;
+constexpr size_t kSerialLengthOffset = kAkidOffset + Crypto::kAuthorityKeyIdentifierLength;
+constexpr size_t kSerialOffset       = kSerialLengthOffset + 1;
+
+static_assert(kSerialOffset + Crypto::kMaxCertificateSerialNumberLength == RevocationSetIndex::kEntryLength,
+              "Entry layout does not match kEntryLength");
+
+const uint8_t * EntryAt(const uint8_t * entries, size_t index)
+{
+    return entries + (index * RevocationSetIndex::kEntryLength);
+}
+
+} // namespace
+
+CHIP_ERROR RevocationSetIndex::MakeEntry(const ByteSpan & issuerNameDer, const ByteSpan & akid, const ByteSpan & serialNumber,
+                                         Entry & outEntry)
+{
+    VerifyOrReturnError(!issuerNameDer.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(akid.size() == Crypto::kAuthorityKeyIdentifierLength, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!serialNumber.empty() && (serialNumber.size() <= Crypto::kMaxCertificateSerialNumberLength),
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    outEntry.fill(0);
+    ReturnErrorOnFailure(Crypto::Hash_SHA256(issuerNameDer.data(), issuerNameDer.size(), &outEntry[kIssuerOffset]));
+    memcpy(&outEntry[kAkidOffset], akid.data(), akid.size());
+    outEntry[kSerialLengthOffset] = static_cast<uint8_t>(serialNumber.size());
+    memcpy(&outEntry[kSerialOffset], serialNumber.data(), serialNumber.size());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RevocationSetIndex::MakeEntryForCertificate(const ByteSpan & certDer, Entry & outEntry)
+{
+    uint8_t issuerBuf[Crypto::kMaxCertificateDistinguishedNameLength];
+    MutableByteSpan issuer(issuerBuf);
+    ReturnErrorOnFailure(Crypto::ExtractIssuerFromX509Cert(certDer, issuer));
+
+    uint8_t akidBuf[Crypto::kAuthorityKeyIdentifierLength];
+    MutableByteSpan akid(akidBuf);
+    ReturnErrorOnFailure(Crypto::ExtractAKIDFromX509Cert(certDer, akid));
+
+    uint8_t serialNumberBuf[Crypto::kMaxCertificateSerialNumberLength];
+    MutableByteSpan serialNumber(serialNumberBuf);
+    ReturnErrorOnFailure(Crypto::ExtractSerialNumberFromX509Cert(certDer, serialNumber));
+
+    return MakeEntry(issuer, akid, serialNumber, outEntry);
+}
+
+bool RevocationSetIndex::HasIndexMagic(const ByteSpan & data)
+{
+    return (data.size() >= sizeof(kMagic)) && (memcmp(data.data() + kMagicOffset, kMagic, sizeof(kMagic)) == 0);
+}
+
+CHIP_ERROR RevocationSetIndex::Init(const ByteSpan & data)
+{
+    Clear();
+
+    VerifyOrReturnError(data.size() >= kHeaderLength, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(HasIndexMagic(data), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(data.data()[kVersionOffset] == kFormatVersion, CHIP_ERROR_VERSION_MISMATCH);
+
+    const size_t entryCount = Encoding::LittleEndian::Get32(data.data() + kEntryCountOffset);
+    VerifyOrReturnError((data.size() - kHeaderLength) / kEntryLength == entryCount, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError((data.size() - kHeaderLength) % kEntryLength == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const uint8_t * entries = data.data() + kHeaderLength;
+    for (size_t i = 1; i < entryCount; i++)
+    {
+        VerifyOrReturnError(memcmp(EntryAt(entries, i - 1), EntryAt(entries, i), kEntryLength) < 0, CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    mEntries    = entries;
+    mEntryCount = entryCount;
+    return CHIP_NO_ERROR;
+}
+
+void RevocationSetIndex::Clear()
+{
+    mEntries    = nullptr;
+    mEntryCount = 0;
+}
+
+bool RevocationSetIndex::Contains(const Entry & entry) const
+{
+    size_t low  = 0;
+    size_t high = mEntryCount;
+    while (low < high)
+    {
+        const size_t middle = low + (high - low) / 2;
+        const int order     = memcmp(EntryAt(mEntries, middle), entry.data(), kEntryLength);
+        if (order == 0)
+        {
+            return true;
+        }
+        if (order < 0)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return false;
+}
+
+CHIP_ERROR RevocationSetIndexBuilder::AddEntry(const ByteSpan & issuerNameDer, const ByteSpan & akid, const ByteSpan & serialNumber)
+{
+    RevocationSetIndex::Entry entry;
+    ReturnErrorOnFailure(RevocationSetIndex::MakeEntry(issuerNameDer, akid, serialNumber, entry));
+    mEntries.push_back(entry);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RevocationSetIndexBuilder::Build(std::vector<uint8_t> & outIndex)
+{
+    std::sort(mEntries.begin(), mEntries.end());
+    mEntries.erase(std::unique(mEntries.begin(), mEntries.end()), mEntries.end());
+    VerifyOrReturnError(mEntries.size() <= UINT32_MAX, CHIP_ERROR_NO_MEMORY);
+
+    outIndex.assign(RevocationSetIndex::kHeaderLength + mEntries.size() * RevocationSetIndex::kEntryLength, 0);
+    memcpy(outIndex.data() + kMagicOffset, RevocationSetIndex::kMagic, sizeof(RevocationSetIndex::kMagic));
+    outIndex[kVersionOffset] = RevocationSetIndex::kFormatVersion;
+    Encoding::LittleEndian::Put32(outIndex.data() + kEntryCountOffset, static_cast<uint32_t>(mEntries.size()));
+
+    uint8_t * out = outIndex.data() + RevocationSetIndex::kHeaderLength;
+    for (const auto & entry : mEntries)
+    {
+        memcpy(out, entry.data(), entry.size());
+        out += entry.size();
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace Credentials
+} // namespace chip
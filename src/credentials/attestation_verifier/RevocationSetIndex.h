@@ -0,0 +1,115 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
+
+#include <array>
+#include <vector>
+
+namespace chip {
+namespace Credentials {
+
+/**
+ * @brief Read-only view of a compiled device attestation revocation set.
+ *
+ * The index is a flat, sorted array of fixed-size entries, so that it can be memory-mapped and
+ * searched in O(log n) without any parsing. All multi-byte values are little-endian.
+ *
+ *   Header (kHeaderLength bytes):
+ *     magic           4 bytes, "MRSI"
+ *     version         1 byte, kFormatVersion
+ *     reserved        3 bytes, zero
+ *     entry count     uint32
+ *
+ *   Entries (kEntryLength bytes each), strictly ascending in byte order:
+ *     issuer          32 bytes, SHA-256 of the DER encoded issuer name
+ *     AKID            20 bytes, authority key identifier of the revoked certificate
+ *     serial length   1 byte
+ *     serial number   20 bytes, DER integer content bytes, zero-padded
+ *
+ * Indexes are generated from the JSON revocation set by `credentials/generate_revocation_set.py compile`,
+ * which also performs the CRL signer cross-validation that TestDACRevocationDelegateImpl does at lookup time.
+ */
+class RevocationSetIndex
+{
+public:
+    static constexpr uint8_t kMagic[]         = { 'M', 'R', 'S', 'I' };
+    static constexpr uint8_t kFormatVersion   = 1;
+    static constexpr size_t kHeaderLength     = 12;
+    static constexpr size_t kIssuerHashLength = Crypto::kSHA256_Hash_Length;
+    static constexpr size_t kEntryLength =
+        kIssuerHashLength + Crypto::kAuthorityKeyIdentifierLength + 1 + Crypto::kMaxCertificateSerialNumberLength;
+
+    using Entry = std::array<uint8_t, kEntryLength>;
+
+    /**
+     * @brief Build the index entry for an (issuer, AKID, serial number) triplet.
+     */
+    static CHIP_ERROR MakeEntry(const ByteSpan & issuerNameDer, const ByteSpan & akid, const ByteSpan & serialNumber,
+                                Entry & outEntry);
+
+    /**
+     * @brief Build the index entry that would revoke the given X.509 DER certificate.
+     */
+    static CHIP_ERROR MakeEntryForCertificate(const ByteSpan & certDer, Entry & outEntry);
+
+    /**
+     * @brief Returns true if `data` starts with a revocation set index header, of any version.
+     */
+    static bool HasIndexMagic(const ByteSpan & data);
+
+    /**
+     * @brief Validate `data` as an index and reference it. `data` must outlive this object.
+     *
+     * Validation checks the header, the size and the ordering of all entries, so that lookups
+     * on a corrupted index cannot give wrong answers.
+     */
+    CHIP_ERROR Init(const ByteSpan & data);
+    void Clear();
+
+    bool Contains(const Entry & entry) const;
+    size_t EntryCount() const { return mEntryCount; }
+
+private:
+    const uint8_t * mEntries = nullptr;
+    size_t mEntryCount       = 0;
+};
+
+/**
+ * @brief Builds a revocation set index in memory. Mainly useful for testing, indexes are
+ *        normally generated by the revocation set generator script.
+ */
+class RevocationSetIndexBuilder
+{
+public:
+    CHIP_ERROR AddEntry(const ByteSpan & issuerNameDer, const ByteSpan & akid, const ByteSpan & serialNumber);
+
+    /**
+     * @brief Sort and deduplicate all added entries and serialize the index into `outIndex`.
+     */
+    CHIP_ERROR Build(std::vector<uint8_t> & outIndex);
+
+private:
+    std::vector<RevocationSetIndex::Entry> mEntries;
+};
+
+} // namespace Credentials
+} // namespace chip
@@ -0,0 +1,211 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures PAA lookups by subject key identifier in a
+ *      FileAttestationTrustStore, for several store sizes, against the
+ *      linear scan over every certificate that the store used before its
+ *      certificates were indexed.
+ *
+ *      Usage: paa-lookup-benchmark
+ */
+
+#include <credentials/CHIPCert.h>
+#include <credentials/attestation_verifier/FileAttestationTrustStore.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::Credentials;
+
+namespace {
+
+constexpr size_t kPaaCounts[]      = { 1, 16, 64, 256 };
+constexpr size_t kLookupsPerRun    = 2048;
+constexpr size_t kLinearLookupsCap = 64; // the reference lookup gets slow with large stores
+
+struct TestPaa
+{
+    std::vector<uint8_t> der;
+    uint8_t skid[Crypto::kSubjectKeyIdentifierLength];
+};
+
+CHIP_ERROR GenerateTestPaa(uint64_t id, TestPaa & paa)
+{
+    Crypto::P256Keypair keypair;
+    ReturnErrorOnFailure(keypair.Initialize(Crypto::ECPKeyTarget::ECDSA));
+
+    ChipDN dn;
+    ReturnErrorOnFailure(dn.AddAttribute_MatterRCACId(id));
+
+    // Validity of 2023-01-01 to 2053-01-01, in CHIP epoch seconds
+    X509CertRequestParams params = { static_cast<int64_t>(id), 725846400, 1672531200, dn, dn };
+
+    paa.der.resize(kMaxDERCertLength);
+    MutableByteSpan derSpan(paa.der.data(), paa.der.size());
+    ReturnErrorOnFailure(NewRootX509Cert(params, keypair, derSpan));
+    paa.der.resize(derSpan.size());
+
+    MutableByteSpan skidSpan(paa.skid);
+    return Crypto::ExtractSKIDFromX509Cert(derSpan, skidSpan);
+}
+
+class TemporaryTrustStoreDirectory
+{
+public:
+    TemporaryTrustStoreDirectory()
+    {
+        char path[] = "/tmp/chip-paa-store-XXXXXX";
+        if (mkdtemp(path) != nullptr)
+        {
+            mPath = path;
+        }
+    }
+
+    ~TemporaryTrustStoreDirectory()
+    {
+        for (size_t i = 0; i < mFileCount; i++)
+        {
+            unlink(FilePath(i).c_str());
+        }
+        rmdir(mPath.c_str());
+    }
+
+    bool IsValid() const { return !mPath.empty(); }
+    const char * Path() const { return mPath.c_str(); }
+
+    bool AddCertificate(const TestPaa & paa)
+    {
+        FILE * file = fopen(FilePath(mFileCount).c_str(), "wb");
+        if (file == nullptr)
+        {
+            return false;
+        }
+        bool written = (fwrite(paa.der.data(), 1, paa.der.size(), file) == paa.der.size());
+        fclose(file);
+        mFileCount++;
+        return written;
+    }
+
+private:
+    std::string FilePath(size_t index) const { return mPath + "/paa-" + std::to_string(index) + ".der"; }
+
+    std::string mPath;
+    size_t mFileCount = 0;
+};
+
+// The lookup FileAttestationTrustStore used before certificates were indexed.
+CHIP_ERROR LinearScanLookup(const std::vector<std::vector<uint8_t>> & certs, const ByteSpan & skid, MutableByteSpan & outPaaDer)
+{
+    for (const auto & candidate : certs)
+    {
+        uint8_t skidBuf[Crypto::kSubjectKeyIdentifierLength] = { 0 };
+        MutableByteSpan candidateSkidSpan{ skidBuf };
+        if (CHIP_NO_ERROR != Crypto::ExtractSKIDFromX509Cert(ByteSpan{ candidate.data(), candidate.size() }, candidateSkidSpan))
+        {
+            continue;
+        }
+
+        if (skid.data_equal(candidateSkidSpan))
+        {
+            return CopySpanToMutableSpan(ByteSpan{ candidate.data(), candidate.size() }, outPaaDer);
+        }
+    }
+    return CHIP_ERROR_CA_CERT_NOT_FOUND;
+}
+
+CHIP_ERROR RunLookups(const std::vector<TestPaa> & paas, size_t paaCount)
+{
+    uint8_t buffer[kMaxDERCertLength];
+
+    TemporaryTrustStoreDirectory directory;
+    VerifyOrReturnError(directory.IsValid(), CHIP_ERROR_OPEN_FAILED);
+    for (size_t i = 0; i < paaCount; i++)
+    {
+        VerifyOrReturnError(directory.AddCertificate(paas[i]), CHIP_ERROR_WRITE_FAILED);
+    }
+
+    FileAttestationTrustStore store(directory.Path());
+    VerifyOrReturnError(store.paaCount() == paaCount, CHIP_ERROR_INTERNAL);
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kLookupsPerRun; i++)
+    {
+        MutableByteSpan outPaa(buffer);
+        ReturnErrorOnFailure(store.GetProductAttestationAuthorityCert(ByteSpan(paas[i % paaCount].skid), outPaa));
+    }
+    auto indexedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<std::vector<uint8_t>> certs = LoadAllX509DerCerts(directory.Path());
+    VerifyOrReturnError(certs.size() == paaCount, CHIP_ERROR_INTERNAL);
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kLinearLookupsCap; i++)
+    {
+        MutableByteSpan outPaa(buffer);
+        ReturnErrorOnFailure(LinearScanLookup(certs, ByteSpan(paas[i % paaCount].skid), outPaa));
+    }
+    auto linearNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    ChipLogProgress(Crypto, "%4u PAAs: indexed lookup %7llu ns, linear scan %9llu ns", static_cast<unsigned>(paaCount),
+                    static_cast<unsigned long long>(indexedNs / static_cast<long long>(kLookupsPerRun)),
+                    static_cast<unsigned long long>(linearNs / static_cast<long long>(kLinearLookupsCap)));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RunBenchmark()
+{
+    std::vector<TestPaa> paas(kPaaCounts[MATTER_ARRAY_SIZE(kPaaCounts) - 1]);
+    for (size_t i = 0; i < paas.size(); i++)
+    {
+        ReturnErrorOnFailure(GenerateTestPaa(i + 1, paas[i]));
+    }
+
+    for (size_t paaCount : kPaaCounts)
+    {
+        ReturnErrorOnFailure(RunLookups(paas, paaCount));
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    CHIP_ERROR err = RunBenchmark();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Crypto, "PAA lookup benchmark failed: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    Platform::MemoryShutdown();
+    return (err == CHIP_NO_ERROR) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,212 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures DAC chain revocation checks for several revocation set
+ *      sizes, with IndexedDACRevocationDelegate against the JSON-based
+ *      TestDACRevocationDelegateImpl, which parses the whole set on every
+ *      check.
+ *
+ *      Usage: revocation-check-benchmark
+ */
+
+#include <credentials/attestation_verifier/IndexedDACRevocationDelegate.h>
+#include <credentials/attestation_verifier/RevocationSetIndex.h>
+#include <credentials/attestation_verifier/TestDACRevocationDelegateImpl.h>
+#include <credentials/tests/CHIPAttCert_test_vectors.h>
+#include <lib/support/Base64.h>
+#include <lib/support/BytesToHex.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::Credentials;
+
+namespace {
+
+constexpr size_t kRevokedCounts[] = { 16, 1024, 16384 };
+constexpr size_t kChecksPerRun    = 256;
+constexpr size_t kJsonChecksCap   = 16; // the JSON delegate parses the whole set on every check
+
+// Issuer and AKID of TestCerts::sTestCert_DAC_FFF1_8000_0004_Cert, as found in a JSON revocation set
+constexpr char kDacIssuerB64[] =
+    "MEYxGDAWBgNVBAMMD01hdHRlciBUZXN0IFBBSTEUMBIGCisGAQQBgqJ8AgEMBEZGRjExFDASBgorBgEEAYKifAICDAQ4MDAw";
+constexpr char kDacAkidHex[] = "AF42B7094DEBD515EC6ECF33B81115225F325288";
+
+// Issuer, AKID and serial number of TestCerts::sTestCert_PAI_FFF1_8000_Cert
+constexpr char kPaiIssuerB64[] = "MDAxGDAWBgNVBAMMD01hdHRlciBUZXN0IFBBQTEUMBIGCisGAQQBgqJ8AgEMBEZGRjE=";
+constexpr char kPaiAkidHex[]   = "6AFD22771F511FECBF1641976710DCDC31A1717E";
+constexpr char kPaiSerialHex[] = "3E6CE6509AD840CD";
+
+// CRL signer of the DAC issuer, which is TestCerts::sTestCert_PAI_FFF1_8000_Cert itself
+constexpr char kDacCrlSignerB64[] =
+    "MIIB1DCCAXqgAwIBAgIIPmzmUJrYQM0wCgYIKoZIzj0EAwIwMDEYMBYGA1UEAwwPTWF0dGVyIFRlc3QgUEFBMRQwEgYKKwYBBAGConwCAQwERkZGMTAgFw0yMTA2Mj"
+    "gxNDIzNDNaGA85OTk5MTIzMTIzNTk1OVowRjEYMBYGA1UEAwwPTWF0dGVyIFRlc3QgUEFJMRQwEgYKKwYBBAGConwCAQwERkZGMTEUMBIGCisGAQQBgqJ8AgIMBDgw"
+    "MDAwWTATBgcqhkjOPQIBBggqhkjOPQMBBwNCAASA3fEbIo8+MfY7z1eY2hRiOuu96C7zeO6tv7GP4avOMdCO1LIGBLbMxtm1+rZOfeEMt0vgF8nsFRYFbXDyzQsio2"
+    "YwZDASBgNVHRMBAf8ECDAGAQH/AgEAMA4GA1UdDwEB/wQEAwIBBjAdBgNVHQ4EFgQUr0K3CU3r1RXsbs8zuBEVIl8yUogwHwYDVR0jBBgwFoAUav0idx9RH+y/FkGX"
+    "ZxDc3DGhcX4wCgYIKoZIzj0EAwIDSAAwRQIhAJbJyM8uAYhgBdj1vHLAe3X9mldpWsSRETETi+oDPOUDAiAlVJQ75X1T1sR199I+v8/CA2zSm6Y5PsfvrYcUq3GCGQ"
+    "==";
+
+CHIP_ERROR AddRevokedCertificate(RevocationSetIndexBuilder & builder, const char * issuerB64, const char * akidHex,
+                                 const std::string & serialHex)
+{
+    uint8_t issuer[Crypto::kMaxCertificateDistinguishedNameLength];
+    uint16_t issuerLength = Base64Decode(issuerB64, static_cast<uint16_t>(strlen(issuerB64)), issuer);
+    VerifyOrReturnError(issuerLength != UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+
+    uint8_t akid[Crypto::kAuthorityKeyIdentifierLength];
+    VerifyOrReturnError(Encoding::HexToBytes(akidHex, strlen(akidHex), akid, sizeof(akid)) == sizeof(akid),
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    uint8_t serial[Crypto::kMaxCertificateSerialNumberLength];
+    size_t serialLength = Encoding::HexToBytes(serialHex.data(), serialHex.size(), serial, sizeof(serial));
+    VerifyOrReturnError(serialLength != 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    return builder.AddEntry(ByteSpan(issuer, issuerLength), ByteSpan(akid), ByteSpan(serial, serialLength));
+}
+
+// Serial numbers of certificates that are not part of the checked chain, to make the revocation set large
+std::string FillerSerialHex(size_t index)
+{
+    char serialHex[17];
+    snprintf(serialHex, sizeof(serialHex), "%016llX", static_cast<unsigned long long>(0x4000000000000000ull + index * 7919));
+    return serialHex;
+}
+
+// Writes an index revoking the PAI of the checked chain and `fillerCount` unrelated DACs.
+CHIP_ERROR WriteIndex(const char * path, size_t fillerCount)
+{
+    RevocationSetIndexBuilder builder;
+    ReturnErrorOnFailure(AddRevokedCertificate(builder, kPaiIssuerB64, kPaiAkidHex, kPaiSerialHex));
+    for (size_t i = 0; i < fillerCount; i++)
+    {
+        ReturnErrorOnFailure(AddRevokedCertificate(builder, kDacIssuerB64, kDacAkidHex, FillerSerialHex(i)));
+    }
+
+    std::vector<uint8_t> index;
+    ReturnErrorOnFailure(builder.Build(index));
+
+    FILE * file = fopen(path, "wb");
+    VerifyOrReturnError(file != nullptr, CHIP_ERROR_OPEN_FAILED);
+    bool written = (fwrite(index.data(), 1, index.size(), file) == index.size());
+    fclose(file);
+    return written ? CHIP_NO_ERROR : CHIP_ERROR_WRITE_FAILED;
+}
+
+void OnAttestationInformationVerificationCallback(void * context, const DeviceAttestationVerifier::AttestationInfo & info,
+                                                  AttestationVerificationResult result)
+{
+    AttestationVerificationResult * pResult = reinterpret_cast<AttestationVerificationResult *>(context);
+    *pResult                                = result;
+}
+
+AttestationVerificationResult CheckChain(DeviceAttestationRevocationDelegate & delegate)
+{
+    const uint8_t unusedBuffer[] = { 0 };
+    const ByteSpan unused(unusedBuffer);
+    DeviceAttestationVerifier::AttestationInfo info(unused, unused, unused, TestCerts::sTestCert_PAI_FFF1_8000_Cert,
+                                                    TestCerts::sTestCert_DAC_FFF1_8000_0004_Cert, unused,
+                                                    static_cast<VendorId>(0xFFF1), 0x8000);
+
+    AttestationVerificationResult result = AttestationVerificationResult::kNotImplemented;
+    Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> callback(
+        OnAttestationInformationVerificationCallback, &result);
+    delegate.CheckForRevokedDACChain(info, &callback);
+    return result;
+}
+
+CHIP_ERROR RunChecks(const char * indexPath, size_t revokedCount)
+{
+    ReturnErrorOnFailure(WriteIndex(indexPath, revokedCount));
+
+    IndexedDACRevocationDelegate indexedDelegate;
+    ReturnErrorOnFailure(indexedDelegate.SetRevocationSetIndexPath(indexPath));
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kChecksPerRun; i++)
+    {
+        VerifyOrReturnError(CheckChain(indexedDelegate) == AttestationVerificationResult::kPaiRevoked, CHIP_ERROR_INTERNAL);
+    }
+    auto indexedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    std::string json = std::string(R"([{"type": "revocation_set", "issuer_subject_key_id": ")") + kDacAkidHex +
+        R"(", "issuer_name": ")" + kDacIssuerB64 + R"(", "crl_signer_cert": ")" + kDacCrlSignerB64 +
+        R"(", "revoked_serial_numbers": [)";
+    for (size_t i = 0; i < revokedCount; i++)
+    {
+        json += (i == 0 ? "\"" : ", \"") + FillerSerialHex(i) + "\"";
+    }
+    json += "]}]";
+
+    TestDACRevocationDelegateImpl jsonDelegate;
+    ReturnErrorOnFailure(jsonDelegate.SetDeviceAttestationRevocationData(json));
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kJsonChecksCap; i++)
+    {
+        VerifyOrReturnError(CheckChain(jsonDelegate) == AttestationVerificationResult::kSuccess, CHIP_ERROR_INTERNAL);
+    }
+    auto jsonNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    ChipLogProgress(Crypto, "%5u revoked certificates: indexed check %7llu ns, JSON check %10llu ns",
+                    static_cast<unsigned>(revokedCount),
+                    static_cast<unsigned long long>(indexedNs / static_cast<long long>(kChecksPerRun)),
+                    static_cast<unsigned long long>(jsonNs / static_cast<long long>(kJsonChecksCap)));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RunBenchmark(const char * indexPath)
+{
+    for (size_t revokedCount : kRevokedCounts)
+    {
+        ReturnErrorOnFailure(RunChecks(indexPath, revokedCount));
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    char indexPath[] = "/tmp/chip-revocation-index-XXXXXX";
+    int fd           = mkstemp(indexPath);
+    VerifyOrDie(fd >= 0);
+    close(fd);
+
+    CHIP_ERROR err = RunBenchmark(indexPath);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Crypto, "Revocation check benchmark failed: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+    unlink(indexPath);
+
+    Platform::MemoryShutdown();
+    return (err == CHIP_NO_ERROR) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,217 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <credentials/CHIPCert.h>
+#include <credentials/attestation_verifier/FileAttestationTrustStore.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/Span.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::Credentials;
+
+namespace {
+
+struct TestPaa
+{
+    std::vector<uint8_t> der;
+    uint8_t skid[Crypto::kSubjectKeyIdentifierLength];
+};
+
+CHIP_ERROR GenerateTestPaa(uint64_t id, TestPaa & paa)
+{
+    Crypto::P256Keypair keypair;
+    ReturnErrorOnFailure(keypair.Initialize(Crypto::ECPKeyTarget::ECDSA));
+
+    ChipDN dn;
+    ReturnErrorOnFailure(dn.AddAttribute_MatterRCACId(id));
+
+    // Validity of 2023-01-01 to 2053-01-01, in CHIP epoch seconds
+    X509CertRequestParams params = { static_cast<int64_t>(id), 725846400, 1672531200, dn, dn };
+
+    paa.der.resize(kMaxDERCertLength);
+    MutableByteSpan derSpan(paa.der.data(), paa.der.size());
+    ReturnErrorOnFailure(NewRootX509Cert(params, keypair, derSpan));
+    paa.der.resize(derSpan.size());
+
+    MutableByteSpan skidSpan(paa.skid);
+    return Crypto::ExtractSKIDFromX509Cert(derSpan, skidSpan);
+}
+
+class TemporaryTrustStoreDirectory
+{
+public:
+    TemporaryTrustStoreDirectory()
+    {
+        char path[] = "/tmp/chip-paa-store-XXXXXX";
+        if (mkdtemp(path) != nullptr)
+        {
+            mPath = path;
+        }
+    }
+
+    ~TemporaryTrustStoreDirectory()
+    {
+        for (size_t i = 0; i < mFileCount; i++)
+        {
+            unlink(FilePath(i).c_str());
+        }
+        rmdir(mPath.c_str());
+    }
+
+    bool IsValid() const { return !mPath.empty(); }
+    const char * Path() const { return mPath.c_str(); }
+
+    bool AddCertificate(const TestPaa & paa)
+    {
+        FILE * file = fopen(FilePath(mFileCount).c_str(), "wb");
+        if (file == nullptr)
+        {
+            return false;
+        }
+        bool written = (fwrite(paa.der.data(), 1, paa.der.size(), file) == paa.der.size());
+        fclose(file);
+        mFileCount++;
+        return written;
+    }
+
+    void RemoveAllCertificates()
+    {
+        for (size_t i = 0; i < mFileCount; i++)
+        {
+            unlink(FilePath(i).c_str());
+        }
+    }
+
+private:
+    std::string FilePath(size_t index) const { return mPath + "/paa-" + std::to_string(index) + ".der"; }
+
+    std::string mPath;
+    size_t mFileCount = 0;
+};
+
+class TestFileAttestationTrustStore : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+protected:
+    static void GeneratePaas(size_t count, std::vector<TestPaa> & paas)
+    {
+        paas.resize(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            ASSERT_EQ(GenerateTestPaa(i + 1, paas[i]), CHIP_NO_ERROR);
+        }
+    }
+};
+
+TEST_F(TestFileAttestationTrustStore, LookupBySkid)
+{
+    std::vector<TestPaa> paas;
+    GeneratePaas(8, paas);
+
+    TemporaryTrustStoreDirectory directory;
+    ASSERT_TRUE(directory.IsValid());
+    for (const auto & paa : paas)
+    {
+        ASSERT_TRUE(directory.AddCertificate(paa));
+    }
+
+    FileAttestationTrustStore store(directory.Path());
+    ASSERT_TRUE(store.IsInitialized());
+    EXPECT_EQ(store.paaCount(), paas.size());
+
+    uint8_t buffer[kMaxDERCertLength];
+    for (const auto & paa : paas)
+    {
+        MutableByteSpan outPaa(buffer);
+        ASSERT_EQ(store.GetProductAttestationAuthorityCert(ByteSpan(paa.skid), outPaa), CHIP_NO_ERROR);
+        EXPECT_TRUE(outPaa.data_equal(ByteSpan(paa.der.data(), paa.der.size())));
+    }
+
+    // Unknown SKID
+    uint8_t unknownSkid[Crypto::kSubjectKeyIdentifierLength] = { 0 };
+    MutableByteSpan outPaa(buffer);
+    EXPECT_EQ(store.GetProductAttestationAuthorityCert(ByteSpan(unknownSkid), outPaa), CHIP_ERROR_CA_CERT_NOT_FOUND);
+
+    // Malformed SKID
+    EXPECT_EQ(store.GetProductAttestationAuthorityCert(ByteSpan(paas[0].skid, sizeof(paas[0].skid) - 1), outPaa),
+              CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Output buffer too small
+    MutableByteSpan smallOutPaa(buffer, paas[0].der.size() - 1);
+    EXPECT_EQ(store.GetProductAttestationAuthorityCert(ByteSpan(paas[0].skid), smallOutPaa), CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
+TEST_F(TestFileAttestationTrustStore, EmptyDirectoryIsNotInitialized)
+{
+    TemporaryTrustStoreDirectory directory;
+    ASSERT_TRUE(directory.IsValid());
+
+    FileAttestationTrustStore store(directory.Path());
+    EXPECT_FALSE(store.IsInitialized());
+    EXPECT_EQ(store.paaCount(), 0u);
+    EXPECT_EQ(store.WatchForChanges(), CHIP_ERROR_INCORRECT_STATE);
+}
+
+#ifdef __linux__
+TEST_F(TestFileAttestationTrustStore, ReloadOnDirectoryChange)
+{
+    std::vector<TestPaa> paas;
+    GeneratePaas(2, paas);
+
+    TemporaryTrustStoreDirectory directory;
+    ASSERT_TRUE(directory.IsValid());
+    ASSERT_TRUE(directory.AddCertificate(paas[0]));
+
+    FileAttestationTrustStore store(directory.Path());
+    ASSERT_TRUE(store.IsInitialized());
+    ASSERT_EQ(store.WatchForChanges(), CHIP_NO_ERROR);
+
+    uint8_t buffer[kMaxDERCertLength];
+    MutableByteSpan outPaa(buffer);
+    EXPECT_EQ(store.GetProductAttestationAuthorityCert(ByteSpan(paas[1].skid), outPaa), CHIP_ERROR_CA_CERT_NOT_FOUND);
+
+    // A new certificate is picked up by the next lookup
+    ASSERT_TRUE(directory.AddCertificate(paas[1]));
+    outPaa = MutableByteSpan(buffer);
+    EXPECT_EQ(store.GetProductAttestationAuthorityCert(ByteSpan(paas[1].skid), outPaa), CHIP_NO_ERROR);
+    EXPECT_EQ(store.paaCount(), 2u);
+
+    // Emptying the directory keeps the last valid certificates
+    directory.RemoveAllCertificates();
+    outPaa = MutableByteSpan(buffer);
+    EXPECT_EQ(store.GetProductAttestationAuthorityCert(ByteSpan(paas[0].skid), outPaa), CHIP_NO_ERROR);
+    EXPECT_EQ(store.paaCount(), 2u);
+}
+#endif // __linux__
+
+} // namespace
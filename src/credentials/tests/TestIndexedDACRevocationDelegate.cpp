@@ -0,0 +1,281 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <credentials/attestation_verifier/IndexedDACRevocationDelegate.h>
+#include <credentials/attestation_verifier/RevocationSetIndex.h>
+#include <credentials/attestation_verifier/TestDACRevocationDelegateImpl.h>
+#include <credentials/tests/CHIPAttCert_test_vectors.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/Base64.h>
+#include <lib/support/BytesToHex.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/Span.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::Credentials;
+
+namespace {
+
+// Issuer and AKID of TestCerts::sTestCert_DAC_FFF1_8000_0004_Cert, as found in a JSON revocation set
+constexpr char kDacIssuerB64[] =
+    "MEYxGDAWBgNVBAMMD01hdHRlciBUZXN0IFBBSTEUMBIGCisGAQQBgqJ8AgEMBEZGRjExFDASBgorBgEEAYKifAICDAQ4MDAw";
+constexpr char kDacAkidHex[]   = "AF42B7094DEBD515EC6ECF33B81115225F325288";
+constexpr char kDacSerialHex[] = "0C694F7F866067B2";
+
+// Issuer and AKID of TestCerts::sTestCert_PAI_FFF1_8000_Cert
+constexpr char kPaiIssuerB64[] = "MDAxGDAWBgNVBAMMD01hdHRlciBUZXN0IFBBQTEUMBIGCisGAQQBgqJ8AgEMBEZGRjE=";
+constexpr char kPaiAkidHex[]   = "6AFD22771F511FECBF1641976710DCDC31A1717E";
+constexpr char kPaiSerialHex[] = "3E6CE6509AD840CD";
+
+struct RevokedCertificate
+{
+    const char * issuerB64;
+    const char * akidHex;
+    std::string serialHex;
+};
+
+CHIP_ERROR AddRevokedCertificate(RevocationSetIndexBuilder & builder, const RevokedCertificate & cert)
+{
+    uint8_t issuer[Crypto::kMaxCertificateDistinguishedNameLength];
+    uint16_t issuerLength = Base64Decode(cert.issuerB64, static_cast<uint16_t>(strlen(cert.issuerB64)), issuer);
+    VerifyOrReturnError(issuerLength != UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+
+    uint8_t akid[Crypto::kAuthorityKeyIdentifierLength];
+    VerifyOrReturnError(Encoding::HexToBytes(cert.akidHex, strlen(cert.akidHex), akid, sizeof(akid)) == sizeof(akid),
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    uint8_t serial[Crypto::kMaxCertificateSerialNumberLength];
+    size_t serialLength = Encoding::HexToBytes(cert.serialHex.data(), cert.serialHex.size(), serial, sizeof(serial));
+    VerifyOrReturnError(serialLength != 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    return builder.AddEntry(ByteSpan(issuer, issuerLength), ByteSpan(akid), ByteSpan(serial, serialLength));
+}
+
+// Serial numbers of certificates that are not part of the tested chain, to make the index realistically large
+std::string FillerSerialHex(size_t index)
+{
+    char serialHex[17];
+    snprintf(serialHex, sizeof(serialHex), "%016llX", static_cast<unsigned long long>(0x4000000000000000ull + index * 7919));
+    return serialHex;
+}
+
+std::vector<uint8_t> BuildIndex(const std::vector<RevokedCertificate> & revoked, size_t fillerCount = 0)
+{
+    RevocationSetIndexBuilder builder;
+    for (const auto & cert : revoked)
+    {
+        EXPECT_EQ(AddRevokedCertificate(builder, cert), CHIP_NO_ERROR);
+    }
+    for (size_t i = 0; i < fillerCount; i++)
+    {
+        EXPECT_EQ(AddRevokedCertificate(builder, { kDacIssuerB64, kDacAkidHex, FillerSerialHex(i) }), CHIP_NO_ERROR);
+    }
+
+    std::vector<uint8_t> index;
+    EXPECT_EQ(builder.Build(index), CHIP_NO_ERROR);
+    return index;
+}
+
+class TemporaryIndexFile
+{
+public:
+    TemporaryIndexFile()
+    {
+        char path[] = "/tmp/chip-revocation-index-XXXXXX";
+        int fd      = mkstemp(path);
+        if (fd >= 0)
+        {
+            close(fd);
+            mPath = path;
+        }
+    }
+
+    ~TemporaryIndexFile()
+    {
+        if (!mPath.empty())
+        {
+            unlink(mPath.c_str());
+        }
+    }
+
+    bool IsValid() const { return !mPath.empty(); }
+    const std::string & Path() const { return mPath; }
+
+    // Replace the file the way the revocation set generator does: write a new file and rename it over the old one.
+    bool Replace(const std::vector<uint8_t> & contents)
+    {
+        std::string temporaryPath = mPath + ".new";
+        FILE * file               = fopen(temporaryPath.c_str(), "wb");
+        if (file == nullptr)
+        {
+            return false;
+        }
+        bool written = (fwrite(contents.data(), 1, contents.size(), file) == contents.size());
+        fclose(file);
+        return written && (rename(temporaryPath.c_str(), mPath.c_str()) == 0);
+    }
+
+private:
+    std::string mPath;
+};
+
+void OnAttestationInformationVerificationCallback(void * context, const DeviceAttestationVerifier::AttestationInfo & info,
+                                                  AttestationVerificationResult result)
+{
+    AttestationVerificationResult * pResult = reinterpret_cast<AttestationVerificationResult *>(context);
+    *pResult                                = result;
+}
+
+class TestIndexedDACRevocationDelegate : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+protected:
+    AttestationVerificationResult CheckChain(DeviceAttestationRevocationDelegate & delegate)
+    {
+        const uint8_t unusedBuffer[] = { 0 };
+        const ByteSpan unused(unusedBuffer);
+        DeviceAttestationVerifier::AttestationInfo info(unused, unused, unused, TestCerts::sTestCert_PAI_FFF1_8000_Cert,
+                                                        TestCerts::sTestCert_DAC_FFF1_8000_0004_Cert, unused,
+                                                        static_cast<VendorId>(0xFFF1), 0x8000);
+
+        AttestationVerificationResult result = AttestationVerificationResult::kNotImplemented;
+        Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> callback(
+            OnAttestationInformationVerificationCallback, &result);
+        delegate.CheckForRevokedDACChain(info, &callback);
+        return result;
+    }
+};
+
+TEST_F(TestIndexedDACRevocationDelegate, IndexLookup)
+{
+    std::vector<uint8_t> data = BuildIndex({ { kDacIssuerB64, kDacAkidHex, kDacSerialHex } }, 100);
+
+    RevocationSetIndex index;
+    ASSERT_EQ(index.Init(ByteSpan(data.data(), data.size())), CHIP_NO_ERROR);
+    EXPECT_EQ(index.EntryCount(), 101u);
+
+    RevocationSetIndex::Entry entry;
+    ASSERT_EQ(RevocationSetIndex::MakeEntryForCertificate(TestCerts::sTestCert_DAC_FFF1_8000_0004_Cert, entry), CHIP_NO_ERROR);
+    EXPECT_TRUE(index.Contains(entry));
+
+    ASSERT_EQ(RevocationSetIndex::MakeEntryForCertificate(TestCerts::sTestCert_PAI_FFF1_8000_Cert, entry), CHIP_NO_ERROR);
+    EXPECT_FALSE(index.Contains(entry));
+
+    // Duplicates are removed when building
+    data = BuildIndex({ { kDacIssuerB64, kDacAkidHex, kDacSerialHex }, { kDacIssuerB64, kDacAkidHex, kDacSerialHex } });
+    ASSERT_EQ(index.Init(ByteSpan(data.data(), data.size())), CHIP_NO_ERROR);
+    EXPECT_EQ(index.EntryCount(), 1u);
+
+    // Empty index
+    data = BuildIndex({});
+    ASSERT_EQ(index.Init(ByteSpan(data.data(), data.size())), CHIP_NO_ERROR);
+    EXPECT_EQ(index.EntryCount(), 0u);
+    EXPECT_FALSE(index.Contains(entry));
+}
+
+TEST_F(TestIndexedDACRevocationDelegate, RejectsCorruptIndex)
+{
+    const std::vector<uint8_t> valid =
+        BuildIndex({ { kDacIssuerB64, kDacAkidHex, kDacSerialHex }, { kPaiIssuerB64, kPaiAkidHex, kPaiSerialHex } });
+    RevocationSetIndex index;
+    ASSERT_EQ(index.Init(ByteSpan(valid.data(), valid.size())), CHIP_NO_ERROR);
+
+    // Truncated header
+    EXPECT_EQ(index.Init(ByteSpan(valid.data(), RevocationSetIndex::kHeaderLength - 1)), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(index.EntryCount(), 0u);
+
+    // Bad magic
+    std::vector<uint8_t> corrupt = valid;
+    corrupt[0]                   = 'X';
+    EXPECT_EQ(index.Init(ByteSpan(corrupt.data(), corrupt.size())), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Unsupported version
+    corrupt    = valid;
+    corrupt[4] = RevocationSetIndex::kFormatVersion + 1;
+    EXPECT_EQ(index.Init(ByteSpan(corrupt.data(), corrupt.size())), CHIP_ERROR_VERSION_MISMATCH);
+
+    // Entry count does not match the size
+    EXPECT_EQ(index.Init(ByteSpan(valid.data(), valid.size() - 1)), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(index.Init(ByteSpan(valid.data(), valid.size() - RevocationSetIndex::kEntryLength)), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Entries out of order
+    corrupt = valid;
+    std::swap_ranges(corrupt.begin() + RevocationSetIndex::kHeaderLength,
+                     corrupt.begin() + RevocationSetIndex::kHeaderLength + RevocationSetIndex::kEntryLength,
+                     corrupt.begin() + RevocationSetIndex::kHeaderLength + RevocationSetIndex::kEntryLength);
+    EXPECT_EQ(index.Init(ByteSpan(corrupt.data(), corrupt.size())), CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(TestIndexedDACRevocationDelegate, CheckRevokedChain)
+{
+    TemporaryIndexFile file;
+    ASSERT_TRUE(file.IsValid());
+    ASSERT_TRUE(file.Replace(BuildIndex({ { kDacIssuerB64, kDacAkidHex, kDacSerialHex } })));
+
+    IndexedDACRevocationDelegate delegate;
+
+    // Without revocation data
+    EXPECT_EQ(CheckChain(delegate), AttestationVerificationResult::kSuccess);
+
+    EXPECT_TRUE(IndexedDACRevocationDelegate::IsRevocationSetIndexFile(file.Path().c_str()));
+    ASSERT_EQ(delegate.SetRevocationSetIndexPath(file.Path()), CHIP_NO_ERROR);
+    EXPECT_EQ(delegate.RevokedCertificateCount(), 1u);
+    EXPECT_EQ(CheckChain(delegate), AttestationVerificationResult::kDacRevoked);
+
+    // Updates are picked up by the next check
+    ASSERT_TRUE(file.Replace(BuildIndex({ { kPaiIssuerB64, kPaiAkidHex, kPaiSerialHex } })));
+    EXPECT_EQ(CheckChain(delegate), AttestationVerificationResult::kPaiRevoked);
+
+    ASSERT_TRUE(file.Replace(
+        BuildIndex({ { kDacIssuerB64, kDacAkidHex, kDacSerialHex }, { kPaiIssuerB64, kPaiAkidHex, kPaiSerialHex } }, 10)));
+    EXPECT_EQ(CheckChain(delegate), AttestationVerificationResult::kPaiAndDacRevoked);
+    EXPECT_EQ(delegate.RevokedCertificateCount(), 12u);
+
+    // An invalid update keeps the previous index
+    const std::vector<uint8_t> notAnIndex = { '[', ']' };
+    ASSERT_TRUE(file.Replace(notAnIndex));
+    EXPECT_FALSE(IndexedDACRevocationDelegate::IsRevocationSetIndexFile(file.Path().c_str()));
+    EXPECT_EQ(CheckChain(delegate), AttestationVerificationResult::kPaiAndDacRevoked);
+    EXPECT_EQ(delegate.RevokedCertificateCount(), 12u);
+
+    ASSERT_TRUE(file.Replace(BuildIndex({ { kPaiIssuerB64, kPaiAkidHex, "3E6CE6509AD840CE" } })));
+    EXPECT_EQ(CheckChain(delegate), AttestationVerificationResult::kSuccess);
+
+    delegate.ClearRevocationSetIndexPath();
+    EXPECT_EQ(delegate.RevokedCertificateCount(), 0u);
+    EXPECT_EQ(CheckChain(delegate), AttestationVerificationResult::kSuccess);
+
+    // Invalid paths
+    EXPECT_EQ(delegate.SetRevocationSetIndexPath(""), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_NE(delegate.SetRevocationSetIndexPath(file.Path() + ".missing"), CHIP_NO_ERROR);
+}
+
+} // namespace
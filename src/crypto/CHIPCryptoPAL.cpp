@@ -39,6 +39,8 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <algorithm>
+
 using chip::ByteSpan;
 using chip::MutableByteSpan;
 using chip::Encoding::BufferWriter;
@@ -238,6 +240,104 @@ CHIP_ERROR Find16BitUpperCaseHexAfterPrefix(const ByteSpan & buffer, const char
     return found_prefix_at_least_once ? CHIP_ERROR_WRONG_CERT_DN : CHIP_ERROR_NOT_FOUND;
 }
 
+// SHA-256 round constants (FIPS 180-4 section 4.2.2)
+constexpr uint32_t kSha256RoundConstants[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01,
+    0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116, 0x1e376c08,
+    0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+// SHA-256 initial hash value (FIPS 180-4 section 5.3.3)
+constexpr uint32_t kSha256InitialState[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+};
+
+constexpr size_t kPbkdf2Lanes = PBKDF2_sha256_MultiLane::kLanes;
+
+using Sha256LaneState = uint32_t[8][kPbkdf2Lanes];
+using Sha256LaneBlock = uint32_t[16][kPbkdf2Lanes];
+
+// On x86-64 Linux, also build an AVX2 version of the lane kernel and pick it at load time if the CPU supports it.
+#if defined(__x86_64__) && defined(__linux__) && defined(__has_attribute)
+#if __has_attribute(target_clones)
+#define CHIP_CRYPTO_SHA256_LANES_TARGET_CLONES __attribute__((target_clones("avx2", "default")))
+#endif
+#endif
+#ifndef CHIP_CRYPTO_SHA256_LANES_TARGET_CLONES
+#define CHIP_CRYPTO_SHA256_LANES_TARGET_CLONES
+#endif
+
+inline uint32_t RotateRight32(uint32_t value, unsigned int amount)
+{
+    return (value >> amount) | (value << (32 - amount));
+}
+
+/**
+ * @brief Run the SHA-256 compression function on one block for each of kPbkdf2Lanes independent hash states.
+ *
+ * The lane index is the innermost dimension of every array and every loop, so that each step of the
+ * compression is the same operation on kPbkdf2Lanes adjacent words, which compilers turn into vector code.
+ *
+ * The message schedule and working variables are left on the stack, since clearing them on every call costs a
+ * third of the throughput.  Callers run the function once more on non-secret input when done to overwrite them.
+ */
+CHIP_CRYPTO_SHA256_LANES_TARGET_CLONES void Sha256CompressLanes(Sha256LaneState & state, const Sha256LaneBlock & block)
+{
+    uint32_t schedule[64][kPbkdf2Lanes];
+    uint32_t working[8][kPbkdf2Lanes];
+
+    memcpy(schedule, block, sizeof(Sha256LaneBlock));
+    for (size_t t = 16; t < 64; t++)
+    {
+        for (size_t lane = 0; lane < kPbkdf2Lanes; lane++)
+        {
+            const uint32_t w15 = schedule[t - 15][lane];
+            const uint32_t w2  = schedule[t - 2][lane];
+            const uint32_t s0  = RotateRight32(w15, 7) ^ RotateRight32(w15, 18) ^ (w15 >> 3);
+            const uint32_t s1  = RotateRight32(w2, 17) ^ RotateRight32(w2, 19) ^ (w2 >> 10);
+            schedule[t][lane]  = schedule[t - 16][lane] + s0 + schedule[t - 7][lane] + s1;
+        }
+    }
+
+    memcpy(working, state, sizeof(Sha256LaneState));
+    for (size_t t = 0; t < 64; t++)
+    {
+        for (size_t lane = 0; lane < kPbkdf2Lanes; lane++)
+        {
+            const uint32_t a  = working[0][lane];
+            const uint32_t b  = working[1][lane];
+            const uint32_t c  = working[2][lane];
+            const uint32_t e  = working[4][lane];
+            const uint32_t f  = working[5][lane];
+            const uint32_t g  = working[6][lane];
+            const uint32_t t1 = working[7][lane] + (RotateRight32(e, 6) ^ RotateRight32(e, 11) ^ RotateRight32(e, 25)) +
+                ((e & f) ^ (~e & g)) + kSha256RoundConstants[t] + schedule[t][lane];
+            const uint32_t t2 = (RotateRight32(a, 2) ^ RotateRight32(a, 13) ^ RotateRight32(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+
+            working[7][lane] = g;
+            working[6][lane] = f;
+            working[5][lane] = e;
+            working[4][lane] = working[3][lane] + t1;
+            working[3][lane] = c;
+            working[2][lane] = b;
+            working[1][lane] = a;
+            working[0][lane] = t1 + t2;
+        }
+    }
+
+    for (size_t i = 0; i < 8; i++)
+    {
+        for (size_t lane = 0; lane < kPbkdf2Lanes; lane++)
+        {
+            state[i][lane] += working[i][lane];
+        }
+    }
+}
+
 } // namespace
 
 using HKDF_sha_crypto = HKDF_sha;
@@ -577,6 +677,54 @@ CHIP_ERROR Spake2pVerifier::Generate(uint32_t pbkdf2IterCount, const ByteSpan &
     uint8_t serializedWS[kSpake2p_WS_Length * 2] = { 0 };
     ReturnErrorOnFailure(ComputeWS(pbkdf2IterCount, salt, setupPin, serializedWS, sizeof(serializedWS)));
 
+    return ComputeFromWS(serializedWS);
+}
+
+CHIP_ERROR Spake2pVerifier::GenerateMultiple(uint32_t pbkdf2IterCount, Span<const ByteSpan> salts, Span<const uint32_t> setupPins,
+                                             Span<Spake2pVerifier> verifiers)
+{
+    constexpr size_t kBatchSize = PBKDF2_sha256_MultiLane::kLanes;
+
+    VerifyOrReturnError(salts.size() == verifiers.size() && setupPins.size() == verifiers.size(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(pbkdf2IterCount >= kSpake2p_Min_PBKDF_Iterations && pbkdf2IterCount <= kSpake2p_Max_PBKDF_Iterations,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    for (const ByteSpan & salt : salts)
+    {
+        VerifyOrReturnError(salt.size() >= kSpake2p_Min_PBKDF_Salt_Length && salt.size() <= kSpake2p_Max_PBKDF_Salt_Length,
+                            CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    PBKDF2_sha256_MultiLane pbkdf2;
+    uint8_t littleEndianSetupPINCodes[kBatchSize][sizeof(uint32_t)];
+    uint8_t serializedWS[kBatchSize][kSpake2p_WS_Length * 2];
+    PBKDF2_sha256_MultiLane::Input inputs[kBatchSize];
+
+    for (size_t first = 0; first < verifiers.size() && err == CHIP_NO_ERROR; first += kBatchSize)
+    {
+        const size_t count = std::min(kBatchSize, verifiers.size() - first);
+        for (size_t i = 0; i < count; i++)
+        {
+            Encoding::LittleEndian::Put32(littleEndianSetupPINCodes[i], setupPins[first + i]);
+            inputs[i].password = ByteSpan(littleEndianSetupPINCodes[i]);
+            inputs[i].salt     = salts[first + i];
+            inputs[i].output   = MutableByteSpan(serializedWS[i]);
+        }
+
+        err = pbkdf2.pbkdf2_sha256(Span<const PBKDF2_sha256_MultiLane::Input>(inputs, count), pbkdf2IterCount);
+        for (size_t i = 0; i < count && err == CHIP_NO_ERROR; i++)
+        {
+            err = verifiers[first + i].ComputeFromWS(serializedWS[i]);
+        }
+    }
+
+    ClearSecretData(&littleEndianSetupPINCodes[0][0], sizeof(littleEndianSetupPINCodes));
+    ClearSecretData(&serializedWS[0][0], sizeof(serializedWS));
+    return err;
+}
+
+CHIP_ERROR Spake2pVerifier::ComputeFromWS(const uint8_t * serializedWS)
+{
     CHIP_ERROR err = CHIP_NO_ERROR;
     size_t len;
 
@@ -616,6 +764,183 @@ CHIP_ERROR Spake2pVerifier::ComputeWS(uint32_t pbkdf2IterCount, const ByteSpan &
                                 pbkdf2IterCount, ws_len, ws);
 }
 
+CHIP_ERROR PBKDF2_sha256_MultiLane::pbkdf2_sha256(Span<const Input> inputs, unsigned int iteration_count)
+{
+    // Each lane derives one output block T_i of one input, identified by its input index and block index i.
+    struct LaneAssignment
+    {
+        size_t input;
+        uint32_t block;
+    };
+
+    constexpr uint8_t kInnerPad = 0x36;
+    constexpr uint8_t kOuterPad = 0x5c;
+
+    VerifyOrReturnError(iteration_count >= 1, CHIP_ERROR_INVALID_ARGUMENT);
+    for (const Input & input : inputs)
+    {
+        VerifyOrReturnError(!input.output.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(input.output.size() <= UINT32_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(input.password.data() != nullptr || input.password.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(input.salt.data() != nullptr || input.salt.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    Hash_SHA256_stream sha256;
+    LaneAssignment lanes[kLanes];
+    uint8_t key[kSHA256_Hash_Length * 2];
+    uint8_t digest[kSHA256_Hash_Length];
+    uint8_t blockIndex[sizeof(uint32_t)];
+    Sha256LaneBlock innerPadBlocks;
+    Sha256LaneBlock outerPadBlocks;
+    Sha256LaneBlock message;
+    Sha256LaneState innerState;
+    Sha256LaneState outerState;
+    Sha256LaneState hash;
+    uint32_t result[8][kLanes];
+
+    size_t nextInput   = 0;
+    uint32_t nextBlock = 1;
+    while (nextInput < inputs.size())
+    {
+        memset(innerPadBlocks, 0, sizeof(innerPadBlocks));
+        memset(outerPadBlocks, 0, sizeof(outerPadBlocks));
+        memset(message, 0, sizeof(message));
+
+        // Assign the next output blocks to lanes and compute U_1 = PRF(P, S || INT(i)) for each of them.
+        size_t laneCount = 0;
+        for (; laneCount < kLanes && nextInput < inputs.size(); laneCount++)
+        {
+            const Input & input = inputs[nextInput];
+            const size_t lane   = laneCount;
+            lanes[lane]         = { nextInput, nextBlock };
+
+            // HMAC keys longer than the block size are hashed first (RFC 2104 section 2)
+            memset(key, 0, sizeof(key));
+            if (input.password.size() > sizeof(key))
+            {
+                SuccessOrExit(err = Hash_SHA256(input.password.data(), input.password.size(), key));
+            }
+            else if (!input.password.empty())
+            {
+                memcpy(key, input.password.data(), input.password.size());
+            }
+            for (size_t i = 0; i < 16; i++)
+            {
+                const uint32_t keyWord  = Encoding::BigEndian::Get32(&key[i * sizeof(uint32_t)]);
+                innerPadBlocks[i][lane] = keyWord ^ (0x01010101u * kInnerPad);
+                outerPadBlocks[i][lane] = keyWord ^ (0x01010101u * kOuterPad);
+            }
+
+            Encoding::BigEndian::Put32(blockIndex, nextBlock);
+            for (size_t i = 0; i < sizeof(key); i++)
+            {
+                key[i] ^= kInnerPad;
+            }
+            SuccessOrExit(err = sha256.Begin());
+            SuccessOrExit(err = sha256.AddData(ByteSpan(key)));
+            SuccessOrExit(err = sha256.AddData(input.salt));
+            SuccessOrExit(err = sha256.AddData(ByteSpan(blockIndex)));
+            {
+                MutableByteSpan digestSpan(digest);
+                SuccessOrExit(err = sha256.Finish(digestSpan));
+            }
+            for (size_t i = 0; i < sizeof(key); i++)
+            {
+                key[i] ^= kInnerPad ^ kOuterPad;
+            }
+            SuccessOrExit(err = sha256.Begin());
+            SuccessOrExit(err = sha256.AddData(ByteSpan(key)));
+            SuccessOrExit(err = sha256.AddData(ByteSpan(digest)));
+            {
+                MutableByteSpan digestSpan(digest);
+                SuccessOrExit(err = sha256.Finish(digestSpan));
+            }
+            for (size_t i = 0; i < 8; i++)
+            {
+                message[i][lane] = Encoding::BigEndian::Get32(&digest[i * sizeof(uint32_t)]);
+                result[i][lane]  = message[i][lane];
+            }
+
+            if (static_cast<size_t>(nextBlock) * kSHA256_Hash_Length >= input.output.size())
+            {
+                nextInput++;
+                nextBlock = 1;
+            }
+            else
+            {
+                nextBlock++;
+            }
+        }
+
+        // The keyed hash states after the first block are the same for every iteration.
+        for (size_t i = 0; i < 8; i++)
+        {
+            for (size_t lane = 0; lane < kLanes; lane++)
+            {
+                innerState[i][lane] = kSha256InitialState[i];
+            }
+        }
+        memcpy(outerState, innerState, sizeof(outerState));
+        Sha256CompressLanes(innerState, innerPadBlocks);
+        Sha256CompressLanes(outerState, outerPadBlocks);
+
+        // Every later message is a previous 32-byte digest, padded to a single block after the 64-byte key block.
+        for (size_t lane = 0; lane < kLanes; lane++)
+        {
+            message[8][lane]  = 0x80000000u;
+            message[15][lane] = (64 + kSHA256_Hash_Length) * 8;
+        }
+
+        // U_j = PRF(P, U_{j-1}) and T_i = U_1 ^ U_2 ^ ... ^ U_c
+        for (unsigned int iteration = 1; iteration < iteration_count; iteration++)
+        {
+            memcpy(hash, innerState, sizeof(hash));
+            Sha256CompressLanes(hash, message);
+            memcpy(message, hash, sizeof(hash));
+            memcpy(hash, outerState, sizeof(hash));
+            Sha256CompressLanes(hash, message);
+            memcpy(message, hash, sizeof(hash));
+            for (size_t i = 0; i < 8; i++)
+            {
+                for (size_t lane = 0; lane < kLanes; lane++)
+                {
+                    result[i][lane] ^= hash[i][lane];
+                }
+            }
+        }
+
+        for (size_t lane = 0; lane < laneCount; lane++)
+        {
+            const MutableByteSpan & output = inputs[lanes[lane].input].output;
+            const size_t offset            = static_cast<size_t>(lanes[lane].block - 1) * kSHA256_Hash_Length;
+            for (size_t i = 0; i < 8; i++)
+            {
+                Encoding::BigEndian::Put32(&digest[i * sizeof(uint32_t)], result[i][lane]);
+            }
+            memcpy(output.data() + offset, digest, std::min(sizeof(digest), output.size() - offset));
+        }
+    }
+
+exit:
+    // Overwrite the stack frame of the lane kernel, see Sha256CompressLanes()
+    memset(message, 0, sizeof(message));
+    memset(hash, 0, sizeof(hash));
+    Sha256CompressLanes(hash, message);
+
+    sha256.Clear();
+    ClearSecretData(key);
+    ClearSecretData(digest);
+    ClearSecretData(reinterpret_cast<uint8_t *>(innerPadBlocks), sizeof(innerPadBlocks));
+    ClearSecretData(reinterpret_cast<uint8_t *>(outerPadBlocks), sizeof(outerPadBlocks));
+    ClearSecretData(reinterpret_cast<uint8_t *>(message), sizeof(message));
+    ClearSecretData(reinterpret_cast<uint8_t *>(innerState), sizeof(innerState));
+    ClearSecretData(reinterpret_cast<uint8_t *>(outerState), sizeof(outerState));
+    ClearSecretData(reinterpret_cast<uint8_t *>(hash), sizeof(hash));
+    ClearSecretData(reinterpret_cast<uint8_t *>(result), sizeof(result));
+    return err;
+}
+
 CHIP_ERROR ReadDerLength(Reader & reader, size_t & length)
 {
     length = 0;
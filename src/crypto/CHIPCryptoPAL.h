@@ -1156,6 +1156,34 @@ public:
                                      unsigned int iteration_count, uint32_t key_length, uint8_t * output);
 };
 
+/**
+ * @brief PBKDF2 (HMAC-SHA256) for a batch of independent inputs that share an iteration count.
+ *
+ * The output blocks of all inputs are derived kLanes at a time by a portable SHA-256 kernel that processes
+ * one block of every lane in lockstep, so that the compiler can keep the lanes in vector registers.  This is
+ * much faster than PBKDF2_sha256 for batches of derivations (e.g. SPAKE2+ verifiers for a production run), but
+ * slower for a single short derivation.
+ */
+class PBKDF2_sha256_MultiLane
+{
+public:
+    static constexpr size_t kLanes = 8;
+
+    struct Input
+    {
+        ByteSpan password;
+        ByteSpan salt;
+        MutableByteSpan output; // the key length is the size of the output buffer
+    };
+
+    /** @brief Derive the key of every input.
+     * @param inputs inputs to derive keys for
+     * @param iteration_count number of iterations to run for each input
+     * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR pbkdf2_sha256(Span<const Input> inputs, unsigned int iteration_count);
+};
+
 // TODO: Extract Spake2p to a separate header and replace the forward declaration with #include SessionKeystore.h
 class SessionKeystore;
 
@@ -1625,6 +1653,20 @@ public:
      */
     CHIP_ERROR Generate(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t setupPin);
 
+    /**
+     * @brief Generate several Spake2+ verifiers with the same iteration count, running their PBKDF2 derivations
+     *        together with PBKDF2_sha256_MultiLane.
+     *
+     * @param pbkdf2IterCount Iteration count for PBKDF2 function
+     * @param salts           Salt of each verifier
+     * @param setupPins       Setup PIN (passcode) of each verifier
+     * @param verifiers       The generated verifiers, one for each salt / setup PIN
+     *
+     * @return CHIP_ERROR     The result of Spake2+ verifier generation
+     */
+    static CHIP_ERROR GenerateMultiple(uint32_t pbkdf2IterCount, Span<const ByteSpan> salts, Span<const uint32_t> setupPins,
+                                       Span<Spake2pVerifier> verifiers);
+
     /**
      * @brief Compute the initiator values (w0s, w1s) used for PAKE input.
      *
@@ -1637,6 +1679,10 @@ public:
      * @return CHIP_ERROR     The result from running PBKDF2
      */
     static CHIP_ERROR ComputeWS(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t setupPin, uint8_t * ws, uint32_t ws_len);
+
+private:
+    // Compute mW0 and mL from the serialized (w0s, w1s) of length 2 * kSpake2p_WS_Length.
+    CHIP_ERROR ComputeFromWS(const uint8_t * serializedWS);
 };
 
 /**
@@ -1456,6 +1456,70 @@ TEST_F(TestChipCryptoPAL, TestPBKDF2_SHA256_TestVectors)
     EXPECT_GT(numOfTestsRan, 0);
 }
 
+TEST_F(TestChipCryptoPAL, TestPBKDF2_SHA256_MultiLane_TestVectors)
+{
+    HeapChecker heapChecker;
+    int numOfTestsRan = 0;
+    PBKDF2_sha256_MultiLane pbkdf2;
+    for (const pbkdf2_test_vector * vector : pbkdf2_sha256_test_vectors)
+    {
+        if (vector->plen > 0 && vector->result == CHIP_NO_ERROR)
+        {
+            numOfTestsRan++;
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_key;
+            out_key.Alloc(vector->key_len);
+            EXPECT_TRUE(out_key);
+
+            const PBKDF2_sha256_MultiLane::Input input = { ByteSpan(vector->password, vector->plen),
+                                                           ByteSpan(vector->salt, vector->slen),
+                                                           MutableByteSpan(out_key.Get(), vector->key_len) };
+            EXPECT_EQ(pbkdf2.pbkdf2_sha256(Span<const PBKDF2_sha256_MultiLane::Input>(&input, 1), vector->iter), CHIP_NO_ERROR);
+            EXPECT_EQ(memcmp(out_key.Get(), vector->key, vector->key_len), 0);
+        }
+    }
+    EXPECT_GT(numOfTestsRan, 0);
+}
+
+TEST_F(TestChipCryptoPAL, TestPBKDF2_SHA256_MultiLane_Batch)
+{
+    HeapChecker heapChecker;
+    constexpr size_t kInputCount       = PBKDF2_sha256_MultiLane::kLanes + 3;
+    constexpr unsigned int kIterations = 7;
+    // Key lengths cover partial, single and multiple output blocks, and passwords longer than the HMAC block size.
+    constexpr size_t kKeyLengths[]      = { 20, 32, 80 };
+    constexpr size_t kPasswordLengths[] = { 4, 64, 65, 100 };
+
+    uint8_t passwords[kInputCount][100];
+    uint8_t salts[kInputCount][32];
+    uint8_t keys[kInputCount][80];
+    PBKDF2_sha256_MultiLane::Input inputs[kInputCount];
+    for (size_t i = 0; i < kInputCount; i++)
+    {
+        memset(passwords[i], static_cast<int>(i + 1), sizeof(passwords[i]));
+        memset(salts[i], static_cast<int>(0xA0 + i), sizeof(salts[i]));
+        inputs[i].password = ByteSpan(passwords[i], kPasswordLengths[i % MATTER_ARRAY_SIZE(kPasswordLengths)]);
+        inputs[i].salt     = ByteSpan(salts[i], 16 + i);
+        inputs[i].output   = MutableByteSpan(keys[i], kKeyLengths[i % MATTER_ARRAY_SIZE(kKeyLengths)]);
+    }
+
+    PBKDF2_sha256_MultiLane pbkdf2;
+    EXPECT_EQ(pbkdf2.pbkdf2_sha256(Span<const PBKDF2_sha256_MultiLane::Input>(inputs), kIterations), CHIP_NO_ERROR);
+
+    TestPBKDF2_sha256 reference;
+    for (const PBKDF2_sha256_MultiLane::Input & input : inputs)
+    {
+        uint8_t expected[80];
+        EXPECT_EQ(reference.pbkdf2_sha256(input.password.data(), input.password.size(), input.salt.data(), input.salt.size(),
+                                          kIterations, static_cast<uint32_t>(input.output.size()), expected),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(input.output.data(), expected, input.output.size()), 0);
+    }
+
+    EXPECT_EQ(pbkdf2.pbkdf2_sha256(Span<const PBKDF2_sha256_MultiLane::Input>(inputs), 0), CHIP_ERROR_INVALID_ARGUMENT);
+    inputs[0].output = MutableByteSpan();
+    EXPECT_EQ(pbkdf2.pbkdf2_sha256(Span<const PBKDF2_sha256_MultiLane::Input>(inputs), kIterations), CHIP_ERROR_INVALID_ARGUMENT);
+}
+
 TEST_F(TestChipCryptoPAL, TestP256_Keygen)
 {
     HeapChecker heapChecker;
@@ -2152,6 +2216,38 @@ TEST_F(TestChipCryptoPAL, TestSPAKE2P_Reuse)
     EXPECT_EQ(spake2.Init(nullptr, 0), CHIP_NO_ERROR);
 }
 
+TEST_F(TestChipCryptoPAL, TestSPAKE2P_GenerateMultipleVerifiers)
+{
+    HeapChecker heapChecker;
+    constexpr size_t kVerifierCount          = 3;
+    const uint32_t setupPins[kVerifierCount] = { 20202021, 12345679, 87654321 };
+    uint8_t saltBuffers[kVerifierCount][kSpake2p_Max_PBKDF_Salt_Length];
+    ByteSpan salts[kVerifierCount];
+    for (size_t i = 0; i < kVerifierCount; i++)
+    {
+        memset(saltBuffers[i], static_cast<int>(0x50 + i), sizeof(saltBuffers[i]));
+        salts[i] = ByteSpan(saltBuffers[i], kSpake2p_Min_PBKDF_Salt_Length + i);
+    }
+
+    Spake2pVerifier verifiers[kVerifierCount];
+    EXPECT_EQ(Spake2pVerifier::GenerateMultiple(kSpake2p_Min_PBKDF_Iterations, Span<const ByteSpan>(salts),
+                                                Span<const uint32_t>(setupPins), Span<Spake2pVerifier>(verifiers)),
+              CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < kVerifierCount; i++)
+    {
+        Spake2pVerifier expected;
+        EXPECT_EQ(expected.Generate(kSpake2p_Min_PBKDF_Iterations, salts[i], setupPins[i]), CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(verifiers[i].mW0, expected.mW0, sizeof(expected.mW0)), 0);
+        EXPECT_EQ(memcmp(verifiers[i].mL, expected.mL, sizeof(expected.mL)), 0);
+    }
+
+    // The number of salts, setup PINs and verifiers must match
+    EXPECT_EQ(Spake2pVerifier::GenerateMultiple(kSpake2p_Min_PBKDF_Iterations, Span<const ByteSpan>(salts, 2),
+                                                Span<const uint32_t>(setupPins), Span<Spake2pVerifier>(verifiers)),
+              CHIP_ERROR_INVALID_ARGUMENT);
+}
+
 TEST_F(TestChipCryptoPAL, TestCompressedFabricIdentifier)
 {
     HeapChecker heapChecker;
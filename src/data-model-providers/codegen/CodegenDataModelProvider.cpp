@@ -54,33 +54,16 @@ namespace chip {
 namespace app {
 namespace {
 
-DataModel::AcceptedCommandEntry AcceptedCommandEntryFor(const ConcreteCommandPath & path)
-{
-    const CommandId commandId = path.mCommandId;
-
-    DataModel::AcceptedCommandEntry entry(
-        path.mCommandId,
-        BitFlags<DataModel::CommandQualityFlags>{}
-            .Set(DataModel::CommandQualityFlags::kTimed, CommandNeedsTimedInvoke(path.mClusterId, commandId))
-            .Set(DataModel::CommandQualityFlags::kFabricScoped, CommandIsFabricScoped(path.mClusterId, commandId))
-            .Set(DataModel::CommandQualityFlags::kLargeMessage, CommandHasLargePayload(path.mClusterId, commandId)),
-        RequiredPrivilege::ForInvokeCommand(path));
-
-    return entry;
-}
-
-DataModel::ServerClusterEntry ServerClusterEntryFrom(EndpointId endpointId, const EmberAfCluster & cluster)
+DataModel::ServerClusterEntry ServerClusterEntryFrom(EndpointId endpointId, ClusterId clusterId, const DataVersion * versionPtr)
 {
     DataModel::ServerClusterEntry entry;
 
-    entry.clusterId = cluster.clusterId;
+    entry.clusterId = clusterId;
 
-    DataVersion * versionPtr = emberAfDataVersionStorage(ConcreteClusterPath(endpointId, cluster.clusterId));
     if (versionPtr == nullptr)
     {
 #if CHIP_CONFIG_DATA_MODEL_EXTRA_LOGGING
-        ChipLogError(AppServer, "Failed to get data version for %d/" ChipLogFormatMEI, endpointId,
-                     ChipLogValueMEI(cluster.clusterId));
+        ChipLogError(AppServer, "Failed to get data version for %d/" ChipLogFormatMEI, endpointId, ChipLogValueMEI(clusterId));
 #endif
         entry.dataVersion = 0;
     }
@@ -95,30 +78,19 @@ DataModel::ServerClusterEntry ServerClusterEntryFrom(EndpointId endpointId, cons
     return entry;
 }
 
-DataModel::AttributeEntry AttributeEntryFrom(const ConcreteClusterPath & clusterPath, const EmberAfAttributeMetadata & attribute)
+/// Returns true if `clusterId` is in `knownClusters`.
+bool IsKnownCluster(ClusterId clusterId, const ReadOnlyBuffer<ClusterId> & knownClusters)
 {
-    const ConcreteAttributePath attributePath(clusterPath.mEndpointId, clusterPath.mClusterId, attribute.attributeId);
-
-    using DataModel::AttributeQualityFlags;
-
-    DataModel::AttributeEntry entry(
-        attribute.attributeId,
-        BitFlags<DataModel::AttributeQualityFlags>{}
-            .Set(AttributeQualityFlags::kListAttribute, (attribute.attributeType == ZCL_ARRAY_ATTRIBUTE_TYPE))
-            .Set(DataModel::AttributeQualityFlags::kTimed, attribute.MustUseTimedWrite()),
-        attribute.IsReadable() ? std::make_optional(RequiredPrivilege::ForReadAttribute(attributePath)) : std::nullopt,
-        attribute.IsWritable() ? std::make_optional(RequiredPrivilege::ForWriteAttribute(attributePath)) : std::nullopt);
-
-    // NOTE: we do NOT provide additional info for:
-    //    - IsExternal/IsAutomaticallyPersisted is not used by IM handling
-    //    - Several specification flags are not available (reportable, quieter reporting,
-    //      fixed, source attribution)
-
-    // TODO: Set additional flags:
-    // entry.flags.Set(DataModel::AttributeQualityFlags::kFabricScoped)
-    // entry.flags.Set(DataModel::AttributeQualityFlags::kFabricSensitive)
-    // entry.flags.Set(DataModel::AttributeQualityFlags::kChangesOmitted)
-    return entry;
+    // linear search as this is a somewhat compact number list, so performance is probably not too bad
+    // This results in smaller code than some memory allocation + std::sort + std::binary_search
+    for (ClusterId knownClusterId : knownClusters)
+    {
+        if (knownClusterId == clusterId)
+        {
+            return true;
+        }
+    }
+    return false;
 }
 
 DefaultAttributePersistenceProvider gDefaultAttributePersistence;
@@ -193,8 +165,27 @@ std::optional<DataModel::ActionReturnStatus> CodegenDataModelProvider::InvokeCom
     return std::nullopt;
 }
 
+const EmberMetadataSnapshot * CodegenDataModelProvider::CurrentMetadataSnapshot()
+{
+#if CHIP_CODEGEN_CONFIG_ENABLE_METADATA_SNAPSHOT
+    if (!mMetadataSnapshot.IsCurrent() && (mMetadataSnapshot.Build() != CHIP_NO_ERROR))
+    {
+        return nullptr;
+    }
+    return &mMetadataSnapshot;
+#else
+    return nullptr;
+#endif
+}
+
 CHIP_ERROR CodegenDataModelProvider::Endpoints(ReadOnlyBufferBuilder<DataModel::EndpointEntry> & builder)
 {
+    if (const EmberMetadataSnapshot * snapshot = CurrentMetadataSnapshot(); snapshot != nullptr)
+    {
+        // Snapshot lists are copied: a rebuild frees them while iterators may still hold the result.
+        return builder.AppendElements(snapshot->EndpointEntries());
+    }
+
     const uint16_t endpointCount = emberAfEndpointCount();
 
     ReturnErrorOnFailure(builder.EnsureAppendCapacity(endpointCount));
@@ -206,21 +197,7 @@ CHIP_ERROR CodegenDataModelProvider::Endpoints(ReadOnlyBufferBuilder<DataModel::
             continue;
         }
 
-        DataModel::EndpointEntry entry;
-        entry.id       = emberAfEndpointFromIndex(endpointIndex);
-        entry.parentId = emberAfParentEndpointFromIndex(endpointIndex);
-
-        switch (GetCompositionForEndpointIndex(endpointIndex))
-        {
-        case EndpointComposition::kFullFamily:
-            entry.compositionPattern = DataModel::EndpointCompositionPattern::kFullFamily;
-            break;
-        case EndpointComposition::kTree:
-        case EndpointComposition::kInvalid: // should NOT happen, but force compiler to check we validate all versions
-            entry.compositionPattern = DataModel::EndpointCompositionPattern::kTree;
-            break;
-        }
-        ReturnErrorOnFailure(builder.Append(entry));
+        ReturnErrorOnFailure(builder.Append(EmberMetadataSnapshot::EndpointEntryForIndex(endpointIndex)));
     }
 
     return CHIP_NO_ERROR;
@@ -260,7 +237,20 @@ CHIP_ERROR CodegenDataModelProvider::EventInfo(const ConcreteEventPath & path, D
 CHIP_ERROR CodegenDataModelProvider::ServerClusters(EndpointId endpointId,
                                                     ReadOnlyBufferBuilder<DataModel::ServerClusterEntry> & builder)
 {
-    const EmberAfEndpointType * endpoint = emberAfFindEndpointType(endpointId);
+    const EmberMetadataSnapshot * snapshot                   = CurrentMetadataSnapshot();
+    const EmberMetadataSnapshot::Endpoint * snapshotEndpoint = nullptr;
+    const EmberAfEndpointType * endpoint                     = nullptr;
+
+    if (snapshot != nullptr)
+    {
+        snapshotEndpoint = snapshot->FindEndpoint(endpointId);
+        VerifyOrReturnValue(snapshotEndpoint != nullptr, CHIP_ERROR_NOT_FOUND);
+        endpoint = snapshotEndpoint->emberEndpointType;
+    }
+    else
+    {
+        endpoint = emberAfFindEndpointType(endpointId);
+    }
 
     VerifyOrReturnValue(endpoint != nullptr, CHIP_ERROR_NOT_FOUND);
     VerifyOrReturnValue(endpoint->clusterCount > 0, CHIP_NO_ERROR);
@@ -308,6 +298,20 @@ CHIP_ERROR CodegenDataModelProvider::ServerClusters(EndpointId endpointId,
 
     ReadOnlyBuffer<ClusterId> knownClusters = knownClustersBuilder.TakeBuffer();
 
+    if (snapshotEndpoint != nullptr)
+    {
+        ReturnErrorOnFailure(builder.EnsureAppendCapacity(snapshotEndpoint->serverClusters.size()));
+        for (const auto & cluster : snapshotEndpoint->serverClusters)
+        {
+            if (IsKnownCluster(cluster.clusterId, knownClusters))
+            {
+                continue;
+            }
+            ReturnErrorOnFailure(builder.Append(ServerClusterEntryFrom(endpointId, cluster.clusterId, cluster.dataVersion)));
+        }
+        return CHIP_NO_ERROR;
+    }
+
     ReturnErrorOnFailure(builder.EnsureAppendCapacity(emberAfClusterCountForEndpointType(endpoint, /* server = */ true)));
 
     const EmberAfCluster * begin = endpoint->cluster;
@@ -319,25 +323,15 @@ CHIP_ERROR CodegenDataModelProvider::ServerClusters(EndpointId endpointId,
             continue;
         }
 
-        // linear search as this is a somewhat compact number list, so performance is probably not too bad
-        // This results in smaller code than some memory allocation + std::sort + std::binary_search
-        bool found = false;
-        for (ClusterId clusterId : knownClusters)
-        {
-            if (clusterId == cluster->clusterId)
-            {
-                found = true;
-                break;
-            }
-        }
-        if (found)
+        if (IsKnownCluster(cluster->clusterId, knownClusters))
         {
             // value already filled from the ServerClusterRegistry. That one has the correct/overriden
             // flags and data version
             continue;
         }
 
-        ReturnErrorOnFailure(builder.Append(ServerClusterEntryFrom(endpointId, *cluster)));
+        ReturnErrorOnFailure(builder.Append(ServerClusterEntryFrom(
+            endpointId, cluster->clusterId, emberAfDataVersionStorage(ConcreteClusterPath(endpointId, cluster->clusterId)))));
     }
 
     return CHIP_NO_ERROR;
@@ -351,15 +345,19 @@ CHIP_ERROR CodegenDataModelProvider::Attributes(const ConcreteClusterPath & path
         return cluster->Attributes(path, builder);
     }
 
+    if (const EmberMetadataSnapshot * snapshot = CurrentMetadataSnapshot(); snapshot != nullptr)
+    {
+        const EmberMetadataSnapshot::Cluster * snapshotCluster = snapshot->FindServerCluster(path);
+        VerifyOrReturnValue(snapshotCluster != nullptr, CHIP_ERROR_NOT_FOUND);
+        return builder.AppendElements(snapshotCluster->attributes);
+    }
+
     const EmberAfCluster * cluster = FindServerCluster(path);
 
     VerifyOrReturnValue(cluster != nullptr, CHIP_ERROR_NOT_FOUND);
     VerifyOrReturnValue(cluster->attributeCount > 0, CHIP_NO_ERROR);
     VerifyOrReturnValue(cluster->attributes != nullptr, CHIP_NO_ERROR);
 
-    // TODO: if ember would encode data in AttributeEntry form, we could reference things directly (shorter code,
-    //       although still allocation overhead due to global attributes not in metadata)
-    //
     // We have Attributes from ember + global attributes that are NOT in ember metadata.
     // We have to report them all
     constexpr size_t kGlobalAttributeNotInMetadataCount = MATTER_ARRAY_SIZE(GlobalAttributesNotInMetadata);
@@ -370,23 +368,12 @@ CHIP_ERROR CodegenDataModelProvider::Attributes(const ConcreteClusterPath & path
 
     for (auto & attribute : attributeSpan)
     {
-        ReturnErrorOnFailure(builder.Append(AttributeEntryFrom(path, attribute)));
+        ReturnErrorOnFailure(builder.Append(EmberMetadataSnapshot::AttributeEntryFrom(path, attribute)));
     }
 
     for (auto & attributeId : GlobalAttributesNotInMetadata)
     {
-
-        // This "GlobalListEntry" is specific for metadata that ember does not include
-        // in its attribute list metadata.
-        //
-        // By spec these Attribute/AcceptedCommands/GeneratedCommants lists are:
-        //   - lists of elements
-        //   - read-only, with read privilege view
-        //   - fixed value (no such flag exists, so this is not a quality flag we set/track)
-        DataModel::AttributeEntry globalListEntry(attributeId, DataModel::AttributeQualityFlags::kListAttribute,
-                                                  Access::Privilege::kView, std::nullopt);
-
-        ReturnErrorOnFailure(builder.Append(std::move(globalListEntry)));
+        ReturnErrorOnFailure(builder.Append(EmberMetadataSnapshot::GlobalListAttributeEntry(attributeId)));
     }
 
     return CHIP_NO_ERROR;
@@ -445,8 +432,19 @@ CHIP_ERROR CodegenDataModelProvider::AcceptedCommands(const ConcreteClusterPath
     // Some CommandHandlerInterface instances are registered of ALL endpoints, so make sure first that
     // the cluster actually exists on this endpoint before asking the CommandHandlerInterface what commands
     // it claims to support.
-    const EmberAfCluster * serverCluster = FindServerCluster(path);
-    VerifyOrReturnError(serverCluster != nullptr, CHIP_ERROR_NOT_FOUND);
+    const EmberMetadataSnapshot * snapshot                 = CurrentMetadataSnapshot();
+    const EmberMetadataSnapshot::Cluster * snapshotCluster = nullptr;
+    const EmberAfCluster * serverCluster                   = nullptr;
+    if (snapshot != nullptr)
+    {
+        snapshotCluster = snapshot->FindServerCluster(path);
+        VerifyOrReturnError(snapshotCluster != nullptr, CHIP_ERROR_NOT_FOUND);
+    }
+    else
+    {
+        serverCluster = FindServerCluster(path);
+        VerifyOrReturnError(serverCluster != nullptr, CHIP_ERROR_NOT_FOUND);
+    }
 
     CommandHandlerInterface * interface =
         CommandHandlerInterfaceRegistry::Instance().GetCommandHandler(path.mEndpointId, path.mClusterId);
@@ -458,23 +456,19 @@ CHIP_ERROR CodegenDataModelProvider::AcceptedCommands(const ConcreteClusterPath
         VerifyOrReturnError(err == CHIP_ERROR_NOT_IMPLEMENTED, err);
     }
 
-    VerifyOrReturnError(serverCluster->acceptedCommandList != nullptr, CHIP_NO_ERROR);
-
-    const chip::CommandId * endOfList = serverCluster->acceptedCommandList;
-    while (*endOfList != kInvalidCommandId)
+    if (snapshotCluster != nullptr)
     {
-        endOfList++;
+        return builder.AppendElements(snapshotCluster->acceptedCommands);
     }
-    const auto commandCount = static_cast<size_t>(endOfList - serverCluster->acceptedCommandList);
 
-    // TODO: if ember would store command entries, we could simplify this code to use static data
-    ReturnErrorOnFailure(builder.EnsureAppendCapacity(commandCount));
+    Span<const CommandId> commands = EmberMetadataSnapshot::CommandListSpan(serverCluster->acceptedCommandList);
+    ReturnErrorOnFailure(builder.EnsureAppendCapacity(commands.size()));
 
     ConcreteCommandPath commandPath = ConcreteCommandPath(path.mEndpointId, path.mClusterId, kInvalidCommandId);
-    for (const chip::CommandId * p = serverCluster->acceptedCommandList; p != endOfList; p++)
+    for (CommandId commandId : commands)
     {
-        commandPath.mCommandId = *p;
-        ReturnErrorOnFailure(builder.Append(AcceptedCommandEntryFor(commandPath)));
+        commandPath.mCommandId = commandId;
+        ReturnErrorOnFailure(builder.Append(EmberMetadataSnapshot::AcceptedCommandEntryFor(commandPath)));
     }
 
     return CHIP_NO_ERROR;
@@ -490,8 +484,19 @@ CHIP_ERROR CodegenDataModelProvider::GeneratedCommands(const ConcreteClusterPath
     // Some CommandHandlerInterface instances are registered of ALL endpoints, so make sure first that
     // the cluster actually exists on this endpoint before asking the CommandHandlerInterface what commands
     // it claims to support.
-    const EmberAfCluster * serverCluster = FindServerCluster(path);
-    VerifyOrReturnError(serverCluster != nullptr, CHIP_ERROR_NOT_FOUND);
+    const EmberMetadataSnapshot * snapshot                 = CurrentMetadataSnapshot();
+    const EmberMetadataSnapshot::Cluster * snapshotCluster = nullptr;
+    const EmberAfCluster * serverCluster                   = nullptr;
+    if (snapshot != nullptr)
+    {
+        snapshotCluster = snapshot->FindServerCluster(path);
+        VerifyOrReturnError(snapshotCluster != nullptr, CHIP_ERROR_NOT_FOUND);
+    }
+    else
+    {
+        serverCluster = FindServerCluster(path);
+        VerifyOrReturnError(serverCluster != nullptr, CHIP_ERROR_NOT_FOUND);
+    }
 
     CommandHandlerInterface * interface =
         CommandHandlerInterfaceRegistry::Instance().GetCommandHandler(path.mEndpointId, path.mClusterId);
@@ -503,15 +508,12 @@ CHIP_ERROR CodegenDataModelProvider::GeneratedCommands(const ConcreteClusterPath
         VerifyOrReturnError(err == CHIP_ERROR_NOT_IMPLEMENTED, err);
     }
 
-    VerifyOrReturnError(serverCluster->generatedCommandList != nullptr, CHIP_NO_ERROR);
-
-    const chip::CommandId * endOfList = serverCluster->generatedCommandList;
-    while (*endOfList != kInvalidCommandId)
+    if (snapshotCluster != nullptr)
     {
-        endOfList++;
+        return builder.ReferenceExisting(snapshotCluster->generatedCommands);
     }
-    const auto commandCount = static_cast<size_t>(endOfList - serverCluster->generatedCommandList);
-    return builder.ReferenceExisting({ serverCluster->generatedCommandList, commandCount });
+
+    return builder.ReferenceExisting(EmberMetadataSnapshot::CommandListSpan(serverCluster->generatedCommandList));
 }
 
 void CodegenDataModelProvider::InitDataModelForTesting()
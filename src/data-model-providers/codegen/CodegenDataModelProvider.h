@@ -25,6 +25,8 @@
 #include <app/data-model-provider/MetadataTypes.h>
 #include <app/server-cluster/SingleEndpointServerClusterRegistry.h>
 #include <app/util/af-types.h>
+#include <data-model-providers/codegen/CodegenProcessingConfig.h>
+#include <data-model-providers/codegen/EmberMetadataSnapshot.h>
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/support/ReadOnlyBuffer.h>
 
@@ -51,7 +53,13 @@ public:
 
     /// clears out internal caching. Especially useful in unit tests,
     /// where path caching does not really apply (the same path may result in different outcomes)
-    void Reset() { mPreviouslyFoundCluster = std::nullopt; }
+    void Reset()
+    {
+        mPreviouslyFoundCluster = std::nullopt;
+#if CHIP_CODEGEN_CONFIG_ENABLE_METADATA_SNAPSHOT
+        mMetadataSnapshot.Clear();
+#endif
+    }
 
     void SetPersistentStorageDelegate(PersistentStorageDelegate * delegate) { mPersistentStorageDelegate = delegate; }
     PersistentStorageDelegate * GetPersistentStorageDelegate() { return mPersistentStorageDelegate; }
@@ -134,6 +142,19 @@ private:
 
     /// Find the index of the given endpoint id
     std::optional<unsigned> TryFindEndpointIndex(EndpointId id) const;
+
+#if CHIP_CODEGEN_CONFIG_ENABLE_METADATA_SNAPSHOT
+    // Ember metadata converted to provider form, rebuilt whenever the ember metadata
+    // structure generation changes. Lists returned by metadata calls are copied out of it,
+    // since a rebuild frees the snapshot while callers may still hold earlier results.
+    EmberMetadataSnapshot mMetadataSnapshot;
+#endif
+
+    /// Returns a metadata snapshot for the current ember structure, rebuilding it if needed.
+    ///
+    /// Returns nullptr if snapshots are disabled or the snapshot could not be built, in which case
+    /// callers fall back to reading the ember tables directly.
+    const EmberMetadataSnapshot * CurrentMetadataSnapshot();
 };
 
 } // namespace app
@@ -0,0 +1,333 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <data-model-providers/codegen/EmberMetadataSnapshot.h>
+
+#include <access/Privilege.h>
+#include <app-common/zap-generated/attribute-type.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/GlobalAttributes.h>
+#include <app/RequiredPrivilege.h>
+#include <app/util/IMClusterCommandHandler.h>
+#include <app/util/attribute-metadata.h>
+#include <app/util/attribute-storage.h>
+#include <app/util/endpoint-config-api.h>
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+
+namespace chip {
+namespace app {
+namespace {
+
+constexpr size_t kGlobalAttributeNotInMetadataCount = MATTER_ARRAY_SIZE(GlobalAttributesNotInMetadata);
+
+template <typename T>
+CHIP_ERROR AllocateEntries(Platform::ScopedMemoryBuffer<T> & buffer, size_t count)
+{
+    // Always allocate at least one element so that empty lists still have valid storage
+    buffer.Calloc(std::max<size_t>(count, 1));
+    VerifyOrReturnError(buffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    return CHIP_NO_ERROR;
+}
+
+// For entry types without a default constructor: elements are placement-constructed by the caller
+template <typename T>
+CHIP_ERROR AllocateUninitialized(Platform::ScopedMemoryBuffer<uint8_t> & storage, size_t count, T *& entries)
+{
+    static_assert(std::is_trivially_destructible<T>::value, "entries are released without running destructors");
+
+    storage.Alloc(std::max<size_t>(count, 1) * sizeof(T));
+    VerifyOrReturnError(storage.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    entries = reinterpret_cast<T *>(storage.Get());
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+DataModel::EndpointEntry EmberMetadataSnapshot::EndpointEntryForIndex(uint16_t endpointIndex)
+{
+    DataModel::EndpointEntry entry;
+    entry.id       = emberAfEndpointFromIndex(endpointIndex);
+    entry.parentId = emberAfParentEndpointFromIndex(endpointIndex);
+
+    switch (GetCompositionForEndpointIndex(endpointIndex))
+    {
+    case EndpointComposition::kFullFamily:
+        entry.compositionPattern = DataModel::EndpointCompositionPattern::kFullFamily;
+        break;
+    case EndpointComposition::kTree:
+    case EndpointComposition::kInvalid: // should NOT happen, but force compiler to check we validate all versions
+        entry.compositionPattern = DataModel::EndpointCompositionPattern::kTree;
+        break;
+    }
+    return entry;
+}
+
+DataModel::AttributeEntry EmberMetadataSnapshot::AttributeEntryFrom(const ConcreteClusterPath & clusterPath,
+                                                                    const EmberAfAttributeMetadata & attribute)
+{
+    const ConcreteAttributePath attributePath(clusterPath.mEndpointId, clusterPath.mClusterId, attribute.attributeId);
+
+    using DataModel::AttributeQualityFlags;
+
+    DataModel::AttributeEntry entry(
+        attribute.attributeId,
+        BitFlags<DataModel::AttributeQualityFlags>{}
+            .Set(AttributeQualityFlags::kListAttribute, (attribute.attributeType == ZCL_ARRAY_ATTRIBUTE_TYPE))
+            .Set(DataModel::AttributeQualityFlags::kTimed, attribute.MustUseTimedWrite()),
+        attribute.IsReadable() ? std::make_optional(RequiredPrivilege::ForReadAttribute(attributePath)) : std::nullopt,
+        attribute.IsWritable() ? std::make_optional(RequiredPrivilege::ForWriteAttribute(attributePath)) : std::nullopt);
+
+    // NOTE: we do NOT provide additional info for:
+    //    - IsExternal/IsAutomaticallyPersisted is not used by IM handling
+    //    - Several specification flags are not available (reportable, quieter reporting,
+    //      fixed, source attribution)
+
+    // TODO: Set additional flags:
+    // entry.flags.Set(DataModel::AttributeQualityFlags::kFabricScoped)
+    // entry.flags.Set(DataModel::AttributeQualityFlags::kFabricSensitive)
+    // entry.flags.Set(DataModel::AttributeQualityFlags::kChangesOmitted)
+    return entry;
+}
+
+DataModel::AttributeEntry EmberMetadataSnapshot::GlobalListAttributeEntry(AttributeId attributeId)
+{
+    // This "GlobalListEntry" is specific for metadata that ember does not include
+    // in its attribute list metadata.
+    //
+    // By spec these Attribute/AcceptedCommands/GeneratedCommants lists are:
+    //   - lists of elements
+    //   - read-only, with read privilege view
+    //   - fixed value (no such flag exists, so this is not a quality flag we set/track)
+    return DataModel::AttributeEntry(attributeId, DataModel::AttributeQualityFlags::kListAttribute, Access::Privilege::kView,
+                                     std::nullopt);
+}
+
+DataModel::AcceptedCommandEntry EmberMetadataSnapshot::AcceptedCommandEntryFor(const ConcreteCommandPath & path)
+{
+    const CommandId commandId = path.mCommandId;
+
+    DataModel::AcceptedCommandEntry entry(
+        path.mCommandId,
+        BitFlags<DataModel::CommandQualityFlags>{}
+            .Set(DataModel::CommandQualityFlags::kTimed, CommandNeedsTimedInvoke(path.mClusterId, commandId))
+            .Set(DataModel::CommandQualityFlags::kFabricScoped, CommandIsFabricScoped(path.mClusterId, commandId))
+            .Set(DataModel::CommandQualityFlags::kLargeMessage, CommandHasLargePayload(path.mClusterId, commandId)),
+        RequiredPrivilege::ForInvokeCommand(path));
+
+    return entry;
+}
+
+Span<const CommandId> EmberMetadataSnapshot::CommandListSpan(const CommandId * list)
+{
+    VerifyOrReturnValue(list != nullptr, Span<const CommandId>());
+
+    const CommandId * endOfList = list;
+    while (*endOfList != kInvalidCommandId)
+    {
+        endOfList++;
+    }
+    return { list, static_cast<size_t>(endOfList - list) };
+}
+
+void EmberMetadataSnapshot::Clear()
+{
+    mEndpointEntries.Free();
+    mEndpoints.Free();
+    mClusters.Free();
+    mAttributeStorage.Free();
+    mAttributes = nullptr;
+    mAcceptedCommands.Free();
+    mEndpointCount = 0;
+    mEndpointHint  = 0;
+    mValid         = false;
+}
+
+bool EmberMetadataSnapshot::IsCurrent() const
+{
+    return mValid && (mGeneration == emberAfMetadataStructureGeneration());
+}
+
+CHIP_ERROR EmberMetadataSnapshot::Build()
+{
+    Clear();
+
+    const unsigned generation         = emberAfMetadataStructureGeneration();
+    const uint16_t endpointIndexLimit = emberAfEndpointCount();
+
+    // First pass: size all tables so that each is a single allocation
+    size_t endpointCount  = 0;
+    size_t clusterCount   = 0;
+    size_t attributeCount = 0;
+    size_t acceptedCount  = 0;
+    for (uint16_t endpointIndex = 0; endpointIndex < endpointIndexLimit; endpointIndex++)
+    {
+        if (!emberAfEndpointIndexIsEnabled(endpointIndex))
+        {
+            continue;
+        }
+        endpointCount++;
+
+        const EmberAfEndpointType * endpointType = emberAfFindEndpointType(emberAfEndpointFromIndex(endpointIndex));
+        if ((endpointType == nullptr) || (endpointType->cluster == nullptr))
+        {
+            continue;
+        }
+
+        for (const EmberAfCluster & cluster : Span<const EmberAfCluster>(endpointType->cluster, endpointType->clusterCount))
+        {
+            if (!cluster.IsServer())
+            {
+                continue;
+            }
+            clusterCount++;
+            if ((cluster.attributeCount > 0) && (cluster.attributes != nullptr))
+            {
+                attributeCount += cluster.attributeCount + kGlobalAttributeNotInMetadataCount;
+            }
+            acceptedCount += CommandListSpan(cluster.acceptedCommandList).size();
+        }
+    }
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    SuccessOrExit(err = AllocateEntries(mEndpointEntries, endpointCount));
+    SuccessOrExit(err = AllocateEntries(mEndpoints, endpointCount));
+    SuccessOrExit(err = AllocateEntries(mClusters, clusterCount));
+    SuccessOrExit(err = AllocateUninitialized(mAttributeStorage, attributeCount, mAttributes));
+    SuccessOrExit(err = AllocateEntries(mAcceptedCommands, acceptedCount));
+
+    {
+        // Second pass: fill in the tables
+        Cluster * nextCluster                          = mClusters.Get();
+        DataModel::AttributeEntry * nextAttribute      = mAttributes;
+        DataModel::AcceptedCommandEntry * nextAccepted = mAcceptedCommands.Get();
+
+        for (uint16_t endpointIndex = 0; endpointIndex < endpointIndexLimit; endpointIndex++)
+        {
+            if (!emberAfEndpointIndexIsEnabled(endpointIndex))
+            {
+                continue;
+            }
+
+            // Enabled endpoints cannot change in between the two passes
+            VerifyOrExit(mEndpointCount < endpointCount, err = CHIP_ERROR_INTERNAL);
+
+            const EndpointId endpointId              = emberAfEndpointFromIndex(endpointIndex);
+            const EmberAfEndpointType * endpointType = emberAfFindEndpointType(endpointId);
+            Cluster * firstCluster                   = nextCluster;
+
+            if ((endpointType != nullptr) && (endpointType->cluster != nullptr))
+            {
+                for (const EmberAfCluster & cluster : Span<const EmberAfCluster>(endpointType->cluster, endpointType->clusterCount))
+                {
+                    if (!cluster.IsServer())
+                    {
+                        continue;
+                    }
+
+                    const ConcreteClusterPath path(endpointId, cluster.clusterId);
+
+                    Cluster & entry    = *nextCluster++;
+                    entry.clusterId    = cluster.clusterId;
+                    entry.emberCluster = &cluster;
+                    entry.dataVersion  = emberAfDataVersionStorage(path);
+
+                    if ((cluster.attributeCount > 0) && (cluster.attributes != nullptr))
+                    {
+                        DataModel::AttributeEntry * firstAttribute = nextAttribute;
+                        for (const EmberAfAttributeMetadata & attribute :
+                             Span<const EmberAfAttributeMetadata>(cluster.attributes, cluster.attributeCount))
+                        {
+                            new (nextAttribute++) DataModel::AttributeEntry(AttributeEntryFrom(path, attribute));
+                        }
+                        for (AttributeId attributeId : GlobalAttributesNotInMetadata)
+                        {
+                            new (nextAttribute++) DataModel::AttributeEntry(GlobalListAttributeEntry(attributeId));
+                        }
+                        entry.attributes = { firstAttribute, static_cast<size_t>(nextAttribute - firstAttribute) };
+                    }
+
+                    Span<const CommandId> accepted                  = CommandListSpan(cluster.acceptedCommandList);
+                    DataModel::AcceptedCommandEntry * firstAccepted = nextAccepted;
+                    for (CommandId commandId : accepted)
+                    {
+                        *nextAccepted++ = AcceptedCommandEntryFor(ConcreteCommandPath(endpointId, cluster.clusterId, commandId));
+                    }
+                    entry.acceptedCommands  = { firstAccepted, accepted.size() };
+                    entry.generatedCommands = CommandListSpan(cluster.generatedCommandList);
+                }
+            }
+
+            mEndpointEntries[mEndpointCount]             = EndpointEntryForIndex(endpointIndex);
+            mEndpoints[mEndpointCount].endpointId        = endpointId;
+            mEndpoints[mEndpointCount].emberEndpointType = endpointType;
+            mEndpoints[mEndpointCount].serverClusters    = { firstCluster, static_cast<size_t>(nextCluster - firstCluster) };
+            mEndpointCount++;
+        }
+    }
+
+    mGeneration = generation;
+    mValid      = true;
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(AppServer, "Failed to build ember metadata snapshot: %" CHIP_ERROR_FORMAT, err.Format());
+        Clear();
+    }
+    return err;
+}
+
+const EmberMetadataSnapshot::Endpoint * EmberMetadataSnapshot::FindEndpoint(EndpointId endpointId) const
+{
+    VerifyOrReturnValue(mValid, nullptr);
+
+    if ((mEndpointHint < mEndpointCount) && (mEndpoints[mEndpointHint].endpointId == endpointId))
+    {
+        return &mEndpoints[mEndpointHint];
+    }
+
+    for (size_t i = 0; i < mEndpointCount; i++)
+    {
+        if (mEndpoints[i].endpointId == endpointId)
+        {
+            mEndpointHint = i;
+            return &mEndpoints[i];
+        }
+    }
+    return nullptr;
+}
+
+const EmberMetadataSnapshot::Cluster * EmberMetadataSnapshot::FindServerCluster(const ConcreteClusterPath & path) const
+{
+    const Endpoint * endpoint = FindEndpoint(path.mEndpointId);
+    VerifyOrReturnValue(endpoint != nullptr, nullptr);
+
+    for (const Cluster & cluster : endpoint->serverClusters)
+    {
+        if (cluster.clusterId == path.mClusterId)
+        {
+            return &cluster;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,116 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/ConcreteClusterPath.h>
+#include <app/ConcreteCommandPath.h>
+#include <app/data-model-provider/MetadataTypes.h>
+#include <app/util/af-types.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+
+namespace chip {
+namespace app {
+
+/// An immutable copy of the ember metadata structure, converted to the form returned
+/// by `DataModel::Provider` metadata calls.
+///
+/// Ember stores its metadata in generated tables (or application-provided tables for
+/// dynamic endpoints) that have to be searched and converted on every provider call.
+/// A snapshot does that conversion once for a given `emberAfMetadataStructureGeneration`,
+/// so that wildcard expansion only has to copy endpoint, attribute and command lists.
+///
+/// `Build` and `Clear` free the lists of the previous snapshot: callers must copy them
+/// rather than hand out references that could outlive a rebuild.
+///
+/// Only data that is fixed for a given structure generation is captured. Cluster data
+/// versions change at runtime and are referenced through their ember storage.
+class EmberMetadataSnapshot
+{
+public:
+    struct Cluster
+    {
+        ClusterId clusterId;
+        const EmberAfCluster * emberCluster;
+        DataVersion * dataVersion; // nullptr if ember has no version storage for this cluster
+        Span<const DataModel::AttributeEntry> attributes;
+        Span<const DataModel::AcceptedCommandEntry> acceptedCommands;
+        Span<const CommandId> generatedCommands;
+    };
+
+    struct Endpoint
+    {
+        EndpointId endpointId;
+        const EmberAfEndpointType * emberEndpointType;
+        Span<const Cluster> serverClusters;
+    };
+
+    EmberMetadataSnapshot() = default;
+
+    EmberMetadataSnapshot(const EmberMetadataSnapshot &)             = delete;
+    EmberMetadataSnapshot & operator=(const EmberMetadataSnapshot &) = delete;
+
+    /// Rebuilds the snapshot from the current ember metadata.
+    ///
+    /// On failure the snapshot is left empty and invalid.
+    CHIP_ERROR Build();
+
+    /// Releases all memory held by the snapshot and marks it invalid.
+    void Clear();
+
+    /// True if the snapshot was built for the current ember metadata structure generation.
+    bool IsCurrent() const;
+
+    /// All enabled endpoints, in ember index order.
+    Span<const DataModel::EndpointEntry> EndpointEntries() const { return { mEndpointEntries.Get(), mEndpointCount }; }
+
+    /// Finds an enabled endpoint. Returns nullptr if the endpoint does not exist or is disabled.
+    const Endpoint * FindEndpoint(EndpointId endpointId) const;
+
+    /// Finds a server cluster. Returns nullptr if it does not exist.
+    const Cluster * FindServerCluster(const ConcreteClusterPath & path) const;
+
+    /// Conversions from ember metadata, shared with the non-snapshot code paths.
+    static DataModel::EndpointEntry EndpointEntryForIndex(uint16_t endpointIndex);
+    static DataModel::AttributeEntry AttributeEntryFrom(const ConcreteClusterPath & clusterPath,
+                                                        const EmberAfAttributeMetadata & attribute);
+    static DataModel::AttributeEntry GlobalListAttributeEntry(AttributeId attributeId);
+    static DataModel::AcceptedCommandEntry AcceptedCommandEntryFor(const ConcreteCommandPath & path);
+
+    /// Span over a kInvalidCommandId terminated ember command list.
+    static Span<const CommandId> CommandListSpan(const CommandId * list);
+
+private:
+    Platform::ScopedMemoryBuffer<DataModel::EndpointEntry> mEndpointEntries;
+    Platform::ScopedMemoryBuffer<Endpoint> mEndpoints;
+    Platform::ScopedMemoryBuffer<Cluster> mClusters;
+    Platform::ScopedMemoryBuffer<uint8_t> mAttributeStorage; // backing memory for mAttributes
+    Platform::ScopedMemoryBuffer<DataModel::AcceptedCommandEntry> mAcceptedCommands;
+
+    DataModel::AttributeEntry * mAttributes = nullptr;
+    size_t mEndpointCount                   = 0;
+    unsigned mGeneration                    = 0;
+    bool mValid                             = false;
+
+    // Lookups are typically made for the same endpoint many times in a row
+    mutable size_t mEndpointHint = 0;
+};
+
+} // namespace app
+} // namespace chip
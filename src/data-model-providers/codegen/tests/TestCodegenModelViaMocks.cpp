@@ -1156,6 +1156,63 @@ TEST_F(TestCodegenModelViaMocks, IterateOverEndpoints)
     EXPECT_EQ(endpoints[2].compositionPattern, EndpointCompositionPattern::kFullFamily);
 }
 
+#if CHIP_CODEGEN_CONFIG_ENABLE_METADATA_SNAPSHOT
+TEST_F(TestCodegenModelViaMocks, MetadataSnapshotFollowsStructureChanges)
+{
+    UseMockNodeConfig config(gTestNodeConfig);
+    CodegenDataModelProviderWithContext model;
+
+    const ConcreteClusterPath path(kMockEndpoint2, MockClusterId(2));
+
+    // Unchanged metadata is served from the same snapshot
+    ReadOnlyBufferBuilder<DataModel::AttributeEntry> firstBuilder;
+    ReadOnlyBufferBuilder<DataModel::AttributeEntry> secondBuilder;
+    ASSERT_EQ(model.Attributes(path, firstBuilder), CHIP_NO_ERROR);
+    ASSERT_EQ(model.Attributes(path, secondBuilder), CHIP_NO_ERROR);
+
+    auto first  = firstBuilder.TakeBuffer();
+    auto second = secondBuilder.TakeBuffer();
+    ASSERT_FALSE(first.empty());
+    ASSERT_EQ(first.size(), second.size());
+    for (size_t i = 0; i < first.size(); i++)
+    {
+        EXPECT_EQ(first[i].attributeId, second[i].attributeId);
+    }
+    const AttributeId firstAttributeId = first[0].attributeId;
+
+    // clang-format off
+    const MockNodeConfig smallerConfig({
+        MockEndpointConfig(kMockEndpoint1, {
+            MockClusterConfig(MockClusterId(1), {
+                ClusterRevision::Id, FeatureMap::Id,
+            }),
+        }),
+    });
+    // clang-format on
+
+    // A structure change rebuilds the snapshot
+    SetMockNodeConfig(smallerConfig);
+
+    ReadOnlyBufferBuilder<DataModel::EndpointEntry> endpointsBuilder;
+    ASSERT_EQ(model.Endpoints(endpointsBuilder), CHIP_NO_ERROR);
+    auto endpoints = endpointsBuilder.TakeBuffer();
+    ASSERT_EQ(endpoints.size(), 1u);
+    EXPECT_EQ(endpoints[0].id, kMockEndpoint1);
+
+    ReadOnlyBufferBuilder<DataModel::AttributeEntry> missingBuilder;
+    EXPECT_EQ(model.Attributes(path, missingBuilder), CHIP_ERROR_NOT_FOUND);
+
+    // Lists returned before the rebuild remain valid
+    EXPECT_EQ(first[0].attributeId, firstAttributeId);
+
+    ReadOnlyBufferBuilder<DataModel::ServerClusterEntry> clustersBuilder;
+    ASSERT_EQ(model.ServerClusters(kMockEndpoint1, clustersBuilder), CHIP_NO_ERROR);
+    auto clusters = clustersBuilder.TakeBuffer();
+    ASSERT_EQ(clusters.size(), 1u);
+    EXPECT_EQ(clusters[0].clusterId, MockClusterId(1));
+}
+#endif // CHIP_CODEGEN_CONFIG_ENABLE_METADATA_SNAPSHOT
+
 TEST_F(TestCodegenModelViaMocks, IterateOverServerClusters)
 {
     UseMockNodeConfig config(gTestNodeConfig);
@@ -91,6 +91,18 @@
 #define CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE 100
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_LOCK_FREE_EVENT_QUEUE_SIZE
+ *
+ * The number of events held in the lock-free part of the event queue of POSIX platforms
+ * (see DeviceSafeQueue).  Events posted while it is full go to a mutex-protected overflow
+ * queue, so this bounds the fast path rather than the number of pending events.
+ * Must be a power of two.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LOCK_FREE_EVENT_QUEUE_SIZE
+#define CHIP_DEVICE_CONFIG_LOCK_FREE_EVENT_QUEUE_SIZE 256
+#endif
+
 /**
  * CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
  *
@@ -136,6 +148,21 @@
 #define CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE 1
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_BG_WORKER_COUNT
+ *
+ * The number of threads processing background events, on platforms that can run
+ * several of them (POSIX).  Background work, such as the signature and certificate
+ * validation steps of CASE, then runs concurrently for different sessions.
+ *
+ * Defaults to 1, which keeps background work serialized.  A product opts in to more
+ * workers once the work it schedules with ScheduleBackgroundWork() may run concurrently
+ * (see PlatformManager::ScheduleBackgroundWork).
+ */
+#ifndef CHIP_DEVICE_CONFIG_BG_WORKER_COUNT
+#define CHIP_DEVICE_CONFIG_BG_WORKER_COUNT 1
+#endif
+
 /**
  * CHIP_DEVICE_CONFIG_ICD_SLOW_POLL_INTERVAL
  *
@@ -376,6 +376,15 @@ inline ConnectivityChange GetConnectivityChange(bool prevState, bool newState)
  */
 typedef void (*AsyncWorkFunct)(intptr_t arg);
 
+/**
+ * A work item, as passed to PlatformManager::ScheduleWorkBatch().
+ */
+struct AsyncWorkItem
+{
+    AsyncWorkFunct WorkFunct;
+    intptr_t Arg;
+};
+
 } // namespace DeviceLayer
 } // namespace chip
 
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <lib/support/Span.h>
 #include <platform/AttributeList.h>
 #include <platform/CHIPDeviceConfig.h>
 #include <platform/CHIPDeviceEvent.h>
@@ -142,6 +143,17 @@ public:
      */
     CHIP_ERROR ScheduleWork(AsyncWorkFunct workFunct, intptr_t arg = 0);
 
+    /**
+     * Schedules a batch of work items, with the same semantics as calling
+     * ScheduleWork for each of them in order.  Platforms may wake the work
+     * item processing thread once for the whole batch rather than once per
+     * item.
+     *
+     * Stops at, and returns, the first error.  The work items scheduled
+     * before the error are still run.
+     */
+    CHIP_ERROR ScheduleWorkBatch(Span<const AsyncWorkItem> items);
+
     /**
      * Process work items until StopEventLoopTask is called.  RunEventLoop will
      * not return until work item processing is stopped.  Once it returns it
@@ -211,6 +223,12 @@ public:
      *
      * Delegates to PostBackgroundEvent (which will delegate to PostEvent if
      * CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING is not true).
+     *
+     * Unlike work scheduled with ScheduleWork, background work does not hold the
+     * stack lock, and, on platforms running CHIP_DEVICE_CONFIG_BG_WORKER_COUNT
+     * background workers, work items may run concurrently with each other and
+     * out of order.  Work that shares state with other background work must lock
+     * it; work that must follow other work must be scheduled once that work is done.
      */
     CHIP_ERROR ScheduleBackgroundWork(AsyncWorkFunct workFunct, intptr_t arg = 0);
 
@@ -246,6 +264,13 @@ public:
      */
     CHIP_ERROR StopBackgroundEventLoopTask();
 
+    /**
+     * Returns whether background events are processed by a background event loop, i.e. whether
+     * ScheduleBackgroundWork() moves work off the Matter event loop.  Callers may use this to do
+     * work inline rather than paying for the round trip through the event queue.
+     */
+    bool IsBackgroundEventLoopRunning();
+
 private:
     bool mInitialized                   = false;
     PlatformManagerDelegate * mDelegate = nullptr;
@@ -404,6 +429,11 @@ inline CHIP_ERROR PlatformManager::ScheduleWork(AsyncWorkFunct workFunct, intptr
     return static_cast<ImplClass *>(this)->_ScheduleWork(workFunct, arg);
 }
 
+inline CHIP_ERROR PlatformManager::ScheduleWorkBatch(Span<const AsyncWorkItem> items)
+{
+    return static_cast<ImplClass *>(this)->_ScheduleWorkBatch(items);
+}
+
 inline void PlatformManager::RunEventLoop()
 {
     static_cast<ImplClass *>(this)->_RunEventLoop();
@@ -504,6 +534,11 @@ inline CHIP_ERROR PlatformManager::StopBackgroundEventLoopTask()
     return static_cast<ImplClass *>(this)->_StopBackgroundEventLoopTask();
 }
 
+inline bool PlatformManager::IsBackgroundEventLoopRunning()
+{
+    return static_cast<ImplClass *>(this)->_IsBackgroundEventLoopRunning();
+}
+
 inline void PlatformManager::DispatchEvent(const ChipDeviceEvent * event)
 {
     static_cast<ImplClass *>(this)->_DispatchEvent(event);
@@ -58,11 +58,13 @@ protected:
     void _HandleServerStarted();
     void _HandleServerShuttingDown();
     CHIP_ERROR _ScheduleWork(AsyncWorkFunct workFunct, intptr_t arg);
+    CHIP_ERROR _ScheduleWorkBatch(Span<const AsyncWorkItem> items);
     CHIP_ERROR _ScheduleBackgroundWork(AsyncWorkFunct workFunct, intptr_t arg);
     CHIP_ERROR _PostBackgroundEvent(const ChipDeviceEvent * event);
     void _RunBackgroundEventLoop(void);
     CHIP_ERROR _StartBackgroundEventLoopTask(void);
     CHIP_ERROR _StopBackgroundEventLoopTask();
+    bool _IsBackgroundEventLoopRunning();
     void _DispatchEvent(const ChipDeviceEvent * event);
 
     // ===== Support methods that can be overridden by the implementation subclass.
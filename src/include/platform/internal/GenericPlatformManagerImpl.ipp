@@ -265,6 +265,16 @@ CHIP_ERROR GenericPlatformManagerImpl<ImplClass>::_ScheduleWork(AsyncWorkFunct w
     return err;
 }
 
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl<ImplClass>::_ScheduleWorkBatch(Span<const AsyncWorkItem> items)
+{
+    for (const AsyncWorkItem & item : items)
+    {
+        ReturnErrorOnFailure(Impl()->ScheduleWork(item.WorkFunct, item.Arg));
+    }
+    return CHIP_NO_ERROR;
+}
+
 template <class ImplClass>
 CHIP_ERROR GenericPlatformManagerImpl<ImplClass>::_ScheduleBackgroundWork(AsyncWorkFunct workFunct, intptr_t arg)
 {
@@ -305,6 +315,13 @@ CHIP_ERROR GenericPlatformManagerImpl<ImplClass>::_StopBackgroundEventLoopTask(v
     return CHIP_NO_ERROR;
 }
 
+template <class ImplClass>
+bool GenericPlatformManagerImpl<ImplClass>::_IsBackgroundEventLoopRunning(void)
+{
+    // Impl class must override to implement background event processing
+    return false;
+}
+
 template <class ImplClass>
 void GenericPlatformManagerImpl<ImplClass>::_DispatchEvent(const ChipDeviceEvent * event)
 {
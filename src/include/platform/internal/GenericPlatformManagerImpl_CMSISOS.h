@@ -80,6 +80,7 @@ protected:
     void _RunBackgroundEventLoop(void);
     CHIP_ERROR _StartBackgroundEventLoopTask(void);
     CHIP_ERROR _StopBackgroundEventLoopTask();
+    bool _IsBackgroundEventLoopRunning();
 
     // ===== Methods available to the implementation subclass.
 
@@ -323,6 +323,16 @@ CHIP_ERROR GenericPlatformManagerImpl_CMSISOS<ImplClass>::_StopBackgroundEventLo
 #endif
 }
 
+template <class ImplClass>
+bool GenericPlatformManagerImpl_CMSISOS<ImplClass>::_IsBackgroundEventLoopRunning(void)
+{
+#if defined(CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING) && CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    return mShouldRunBackgroundEventLoop.load();
+#else
+    return false;
+#endif
+}
+
 #if defined(CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING) && CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
 template <class ImplClass>
 void GenericPlatformManagerImpl_CMSISOS<ImplClass>::BackgroundEventLoopTaskMain(void * pvParameter)
@@ -35,6 +35,7 @@
 #include <atomic>
 #include <pthread.h>
 #include <queue>
+#include <vector>
 
 namespace chip {
 namespace DeviceLayer {
@@ -87,10 +88,16 @@ protected:
     bool _TryLockChipStack();
     void _UnlockChipStack();
     CHIP_ERROR _PostEvent(const ChipDeviceEvent * event);
+    CHIP_ERROR _ScheduleWorkBatch(Span<const AsyncWorkItem> items);
     void _RunEventLoop();
     CHIP_ERROR _StartEventLoopTask();
     CHIP_ERROR _StopEventLoopTask();
     CHIP_ERROR _StartChipTimer(System::Clock::Timeout duration);
+    CHIP_ERROR _PostBackgroundEvent(const ChipDeviceEvent * event);
+    void _RunBackgroundEventLoop();
+    CHIP_ERROR _StartBackgroundEventLoopTask();
+    CHIP_ERROR _StopBackgroundEventLoopTask();
+    bool _IsBackgroundEventLoopRunning();
     void _Shutdown();
 
 #if CHIP_STACK_LOCK_TRACKING_ENABLED
@@ -99,6 +106,12 @@ protected:
 
     // ===== Methods available to the implementation subclass.
 
+    /**
+     * Starts the background event loop on @p workerCount threads, which process background events
+     * concurrently.  _StartBackgroundEventLoopTask() starts CHIP_DEVICE_CONFIG_BG_WORKER_COUNT of them.
+     */
+    CHIP_ERROR StartBackgroundWorkers(size_t workerCount);
+
 private:
     // ===== Private members for use by this class only.
 
@@ -110,9 +123,27 @@ private:
 
     DeviceSafeQueue mChipEventQueue;
     std::atomic<bool> mShouldRunEventLoop{ true };
+    // Set by the first event posted since the event loop last started processing device events, so that
+    // a burst of events from other threads wakes the event loop once.
+    std::atomic<bool> mEventLoopWakePending{ false };
     static void * EventLoopTaskMain(void * arg);
+    void WakeEventLoop();
 #endif
     void ProcessDeviceEvents();
+
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    // Background events are handed to the first idle worker: mBackgroundEventLock protects the queue, the
+    // workers and mShouldRunBackgroundEventLoop, and mBackgroundEventCond wakes the workers.
+    pthread_mutex_t mBackgroundEventLock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t mBackgroundEventCond  = PTHREAD_COND_INITIALIZER;
+    std::queue<ChipDeviceEvent> mBackgroundEventQueue;
+    std::vector<pthread_t> mBackgroundWorkers;
+    bool mShouldRunBackgroundEventLoop = false;
+    // Mirrors mShouldRunBackgroundEventLoop for _IsBackgroundEventLoopRunning(), which does not take the lock.
+    std::atomic<bool> mBackgroundEventLoopRunning{ false };
+    static void * BackgroundWorkerMain(void * arg);
+    void ProcessBackgroundEvents();
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
 };
 
 // Instruct the compiler to instantiate the template only when explicitly told to do so.
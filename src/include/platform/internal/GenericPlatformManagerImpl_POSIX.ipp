@@ -170,19 +170,51 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostEvent(const ChipDev
 #else
     mChipEventQueue.Push(*event);
 
-    SystemLayerSocketsLoop().Signal(); // Trigger wake select on CHIP thread
+    WakeEventLoop();
+    return CHIP_NO_ERROR;
+#endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_ScheduleWorkBatch(Span<const AsyncWorkItem> items)
+{
+#if CHIP_SYSTEM_CONFIG_USE_LIBEV
+    return GenericPlatformManagerImpl<ImplClass>::_ScheduleWorkBatch(items);
+#else
+    for (const AsyncWorkItem & item : items)
+    {
+        ChipDeviceEvent event{ .Type = DeviceEventType::kCallWorkFunct };
+        event.CallWorkFunct = { .WorkFunct = item.WorkFunct, .Arg = item.Arg };
+        mChipEventQueue.Push(event);
+    }
+
+    WakeEventLoop();
     return CHIP_NO_ERROR;
 #endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
 }
 
 #if !CHIP_SYSTEM_CONFIG_USE_LIBEV
 
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::WakeEventLoop()
+{
+    // Only the first event posted since the event loop last cleared the flag needs to wake it:
+    // the event loop drains the whole queue once woken.
+    if (!mEventLoopWakePending.exchange(true, std::memory_order_acq_rel))
+    {
+        SystemLayerSocketsLoop().Signal(); // Trigger wake select on CHIP thread
+    }
+}
+
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::ProcessDeviceEvents()
 {
-    while (!mChipEventQueue.Empty())
+    // Clear the flag before draining, so that any event the drain might miss wakes the event loop again.
+    mEventLoopWakePending.exchange(false, std::memory_order_acq_rel);
+
+    ChipDeviceEvent event;
+    while (mChipEventQueue.TryPopFront(event))
     {
-        const ChipDeviceEvent event = mChipEventQueue.PopFront();
         Impl()->DispatchEvent(&event);
     }
 }
@@ -384,6 +416,172 @@ exit:
 #endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
 }
 
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostBackgroundEvent(const ChipDeviceEvent * event)
+{
+    VerifyOrReturnError(event->Type == DeviceEventType::kCallWorkFunct || event->Type == DeviceEventType::kNoOp,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    pthread_mutex_lock(&mBackgroundEventLock);
+    if (mShouldRunBackgroundEventLoop)
+    {
+        mBackgroundEventQueue.push(*event);
+        pthread_cond_signal(&mBackgroundEventCond);
+        pthread_mutex_unlock(&mBackgroundEventLock);
+        return CHIP_NO_ERROR;
+    }
+    pthread_mutex_unlock(&mBackgroundEventLock);
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+
+    // Without a running background event loop, background events are processed by the Matter event loop.
+    return Impl()->PostEvent(event);
+}
+
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::_RunBackgroundEventLoop()
+{
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    pthread_mutex_lock(&mBackgroundEventLock);
+    mShouldRunBackgroundEventLoop = true;
+    mBackgroundEventLoopRunning.store(true, std::memory_order_relaxed);
+    pthread_mutex_unlock(&mBackgroundEventLock);
+
+    ProcessBackgroundEvents();
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StartBackgroundEventLoopTask()
+{
+    return StartBackgroundWorkers(CHIP_DEVICE_CONFIG_BG_WORKER_COUNT);
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::StartBackgroundWorkers(size_t workerCount)
+{
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    VerifyOrReturnError(workerCount > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    pthread_mutex_lock(&mBackgroundEventLock);
+    if (mShouldRunBackgroundEventLoop || !mBackgroundWorkers.empty())
+    {
+        pthread_mutex_unlock(&mBackgroundEventLock);
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+    mShouldRunBackgroundEventLoop = true;
+    mBackgroundEventLoopRunning.store(true, std::memory_order_relaxed);
+
+    int err = 0;
+    mBackgroundWorkers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount && err == 0; i++)
+    {
+        pthread_t worker;
+        err = pthread_create(&worker, nullptr, BackgroundWorkerMain, this);
+        if (err == 0)
+        {
+            mBackgroundWorkers.push_back(worker);
+        }
+    }
+    pthread_mutex_unlock(&mBackgroundEventLock);
+
+    if (err != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to start background worker %u: %d", static_cast<unsigned>(mBackgroundWorkers.size()),
+                     err);
+        _StopBackgroundEventLoopTask();
+    }
+    return CHIP_ERROR_POSIX(err);
+#else
+    // Use foreground event loop for background events
+    return CHIP_NO_ERROR;
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StopBackgroundEventLoopTask()
+{
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    std::vector<pthread_t> workers;
+
+    pthread_mutex_lock(&mBackgroundEventLock);
+    mShouldRunBackgroundEventLoop = false;
+    mBackgroundEventLoopRunning.store(false, std::memory_order_relaxed);
+    workers.swap(mBackgroundWorkers);
+    pthread_cond_broadcast(&mBackgroundEventCond);
+    pthread_mutex_unlock(&mBackgroundEventLock);
+
+    // Work that is in progress completes before the workers exit.
+    for (pthread_t worker : workers)
+    {
+        if (pthread_equal(worker, pthread_self()))
+        {
+            pthread_detach(worker);
+            continue;
+        }
+        pthread_join(worker, nullptr);
+    }
+
+    // Hand the work that did not start to the Matter event loop, so that nothing that waits for it is left hanging.
+    pthread_mutex_lock(&mBackgroundEventLock);
+    std::queue<ChipDeviceEvent> pending;
+    pending.swap(mBackgroundEventQueue);
+    pthread_mutex_unlock(&mBackgroundEventLock);
+
+    for (; !pending.empty(); pending.pop())
+    {
+        ReturnErrorOnFailure(Impl()->PostEvent(&pending.front()));
+    }
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    return CHIP_NO_ERROR;
+}
+
+template <class ImplClass>
+bool GenericPlatformManagerImpl_POSIX<ImplClass>::_IsBackgroundEventLoopRunning()
+{
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    return mBackgroundEventLoopRunning.load(std::memory_order_relaxed);
+#else
+    return false;
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+}
+
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::ProcessBackgroundEvents()
+{
+    pthread_mutex_lock(&mBackgroundEventLock);
+    while (true)
+    {
+        while (mShouldRunBackgroundEventLoop && mBackgroundEventQueue.empty())
+        {
+            pthread_cond_wait(&mBackgroundEventCond, &mBackgroundEventLock);
+        }
+        if (!mShouldRunBackgroundEventLoop)
+        {
+            break;
+        }
+
+        ChipDeviceEvent event = mBackgroundEventQueue.front();
+        mBackgroundEventQueue.pop();
+
+        pthread_mutex_unlock(&mBackgroundEventLock);
+        Impl()->DispatchEvent(&event);
+        pthread_mutex_lock(&mBackgroundEventLock);
+    }
+    pthread_mutex_unlock(&mBackgroundEventLock);
+}
+
+template <class ImplClass>
+void * GenericPlatformManagerImpl_POSIX<ImplClass>::BackgroundWorkerMain(void * arg)
+{
+    static_cast<GenericPlatformManagerImpl_POSIX<ImplClass> *>(arg)->ProcessBackgroundEvents();
+    return nullptr;
+}
+
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
 {
@@ -394,6 +592,9 @@ void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
     //
     VerifyOrDie(mState.load(std::memory_order_relaxed) == State::kStopped);
 
+    // The background workers must not outlive the stack either.
+    _StopBackgroundEventLoopTask();
+
 #if !CHIP_SYSTEM_CONFIG_USE_LIBEV
     pthread_mutex_destroy(&mStateLock);
     pthread_cond_destroy(&mEventQueueStoppedCond);
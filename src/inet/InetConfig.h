@@ -213,6 +213,23 @@
 #define INET_CONFIG_TCP_SEND_QUEUE_POLL_INTERVAL_MSEC      500
 #endif // INET_CONFIG_TCP_SEND_QUEUE_POLL_INTERVAL_MSEC
 
+/**
+ *  @def INET_CONFIG_TCP_SEND_MAX_IOVECS
+ *
+ *  @brief
+ *    The maximum number of send queue buffers gathered into
+ *    a single sendmsg() call by the sockets implementation
+ *    of TCPEndPoint.
+ *
+ *  @details
+ *    Gathering the buffers hands consecutive messages, and
+ *    messages held in a chain of buffers, to the kernel in
+ *    one system call instead of one call per buffer.
+ */
+#ifndef INET_CONFIG_TCP_SEND_MAX_IOVECS
+#define INET_CONFIG_TCP_SEND_MAX_IOVECS                    16
+#endif // INET_CONFIG_TCP_SEND_MAX_IOVECS
+
 /**
  *  @def INET_CONFIG_DEFAULT_TCP_USER_TIMEOUT_MSEC
  *
@@ -295,4 +312,37 @@
 #define INET_CONFIG_UDP_SOCKET_MREQN 0
 #endif
 
+/**
+ *  @def INET_CONFIG_MAX_MULTICAST_INTERFACES
+ *
+ *  @brief
+ *    The maximum number of network interfaces kept by a
+ *    MulticastInterfaceCache.
+ *
+ *  @details
+ *    Interfaces beyond this number are not used to send multicast
+ *    messages when CHIP_SYSTEM_CONFIG_MULTICAST_HOMING is enabled, and
+ *    an error naming each of them is logged.
+ */
+#ifndef INET_CONFIG_MAX_MULTICAST_INTERFACES
+#define INET_CONFIG_MAX_MULTICAST_INTERFACES               16
+#endif // INET_CONFIG_MAX_MULTICAST_INTERFACES
+
+/**
+ *  @def INET_CONFIG_MULTICAST_INTERFACE_CACHE_MAX_AGE_MSEC
+ *
+ *  @brief
+ *    The time after which a MulticastInterfaceCache enumerates the
+ *    network interfaces again, when the platform cannot notify it of
+ *    interface changes.
+ *
+ *  @details
+ *    On Linux, the cache is invalidated through netlink notifications
+ *    instead, and this value only applies if the netlink socket cannot
+ *    be opened.
+ */
+#ifndef INET_CONFIG_MULTICAST_INTERFACE_CACHE_MAX_AGE_MSEC
+#define INET_CONFIG_MULTICAST_INTERFACE_CACHE_MAX_AGE_MSEC 5000
+#endif // INET_CONFIG_MULTICAST_INTERFACE_CACHE_MAX_AGE_MSEC
+
 // clang-format on
@@ -0,0 +1,198 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <inet/MulticastInterfaceCache.h>
+
+#include <inet/IPAddress.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#if INET_MULTICAST_INTERFACE_CACHE_USE_NETLINK
+#include <errno.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif // INET_MULTICAST_INTERFACE_CACHE_USE_NETLINK
+
+namespace chip {
+namespace Inet {
+
+Span<const MulticastInterfaceCache::Interface> MulticastInterfaceCache::GetInterfaces()
+{
+    if (IsStale())
+    {
+        Refresh();
+    }
+    return Span<const Interface>(mInterfaces, mInterfaceCount);
+}
+
+void MulticastInterfaceCache::Shutdown()
+{
+#if INET_MULTICAST_INTERFACE_CACHE_USE_NETLINK
+    if (mNetlinkSocket >= 0)
+    {
+        close(mNetlinkSocket);
+        mNetlinkSocket = -1;
+    }
+    mNetlinkSocketUnavailable = false;
+#endif // INET_MULTICAST_INTERFACE_CACHE_USE_NETLINK
+
+    mInterfaceCount = 0;
+    mValid          = false;
+}
+
+bool MulticastInterfaceCache::IsStale()
+{
+#if INET_MULTICAST_INTERFACE_CACHE_USE_NETLINK
+    // Subscribe before the first enumeration, so that no change after it goes unnoticed.
+    if (mNetlinkSocket < 0 && !mNetlinkSocketUnavailable)
+    {
+        OpenNetlinkSocket();
+    }
+
+    if (mNetlinkSocket >= 0)
+    {
+        // Always drain the notifications, so that the ones received before a refresh do not cause another one.
+        const bool changed = DrainNetlinkSocket();
+        return changed || !mValid;
+    }
+#endif // INET_MULTICAST_INTERFACE_CACHE_USE_NETLINK
+
+    return !mValid ||
+        (System::SystemClock().GetMonotonicTimestamp() - mRefreshTime) >=
+        System::Clock::Milliseconds32(INET_CONFIG_MULTICAST_INTERFACE_CACHE_MAX_AGE_MSEC);
+}
+
+void MulticastInterfaceCache::Refresh()
+{
+    InterfaceIterator interfaceIt;
+
+    mInterfaceCount = 0;
+    while (interfaceIt.Next())
+    {
+        if (!interfaceIt.SupportsMulticast() || !interfaceIt.IsUp())
+        {
+            continue;
+        }
+
+        IPAddress addr;
+        const InterfaceId interfaceId = interfaceIt.GetInterfaceId();
+        if (interfaceId.GetLinkLocalAddr(&addr) != CHIP_NO_ERROR)
+        {
+            continue;
+        }
+
+        if (mInterfaceCount == MATTER_ARRAY_SIZE(mInterfaces))
+        {
+            char name[InterfaceId::kMaxIfNameLength];
+            if (interfaceIt.GetInterfaceName(name, sizeof(name)) != CHIP_NO_ERROR)
+            {
+                name[0] = '\0';
+            }
+            ChipLogError(Inet, "Ignoring multicast interface %s beyond INET_CONFIG_MAX_MULTICAST_INTERFACES", name);
+            continue;
+        }
+
+        Interface & entry = mInterfaces[mInterfaceCount++];
+        entry.interfaceId = interfaceId;
+        if (interfaceIt.GetInterfaceName(entry.name, sizeof(entry.name)) != CHIP_NO_ERROR)
+        {
+            entry.name[0] = '\0';
+        }
+        ChipLogDetail(Inet, "Interface %s has a link local address", entry.name);
+    }
+
+    mValid       = true;
+    mRefreshTime = System::SystemClock().GetMonotonicTimestamp();
+}
+
+#if INET_MULTICAST_INTERFACE_CACHE_USE_NETLINK
+
+void MulticastInterfaceCache::OpenNetlinkSocket()
+{
+    int sock = socket(AF_NETLINK, SOCK_RAW | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_ROUTE);
+    if (sock < 0)
+    {
+        ChipLogError(Inet, "Failed to open netlink socket for interface changes: %d", errno);
+        mNetlinkSocketUnavailable = true;
+        return;
+    }
+
+    struct sockaddr_nl addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.nl_family = AF_NETLINK;
+    addr.nl_groups = RTMGRP_LINK | RTMGRP_IPV6_IFADDR;
+
+    if (bind(sock, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0)
+    {
+        ChipLogError(Inet, "Failed to bind netlink socket for interface changes: %d", errno);
+        close(sock);
+        mNetlinkSocketUnavailable = true;
+        return;
+    }
+
+    mNetlinkSocket = sock;
+    // Changes before the subscription are unknown.
+    mValid = false;
+}
+
+bool MulticastInterfaceCache::DrainNetlinkSocket()
+{
+    bool changed = false;
+    uint8_t buffer[4096];
+
+    while (true)
+    {
+        ssize_t length = recv(mNetlinkSocket, buffer, sizeof(buffer), MSG_DONTWAIT);
+        if (length > 0)
+        {
+            // Only link and IPv6 address notifications are subscribed to, and any of them may change the set.
+            changed = true;
+            continue;
+        }
+        if (length < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (length < 0 && errno == ENOBUFS)
+        {
+            // The socket overflowed and notifications were lost.
+            changed = true;
+            continue;
+        }
+        if (length < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            break;
+        }
+
+        ChipLogError(Inet, "Failed to read interface changes from netlink socket: %d", errno);
+        close(mNetlinkSocket);
+        mNetlinkSocket            = -1;
+        mNetlinkSocketUnavailable = true;
+        changed                   = true;
+        break;
+    }
+
+    return changed;
+}
+
+#endif // INET_MULTICAST_INTERFACE_CACHE_USE_NETLINK
+
+} // namespace Inet
+} // namespace chip
@@ -0,0 +1,106 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a cache of the network interfaces that multicast
+ *      messages are sent on when a message has to go out on every interface.
+ */
+
+#pragma once
+
+#include <inet/InetConfig.h>
+#include <inet/InetInterface.h>
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS && defined(__linux__)
+#define INET_MULTICAST_INTERFACE_CACHE_USE_NETLINK 1
+#else
+#define INET_MULTICAST_INTERFACE_CACHE_USE_NETLINK 0
+#endif
+
+namespace chip {
+namespace Inet {
+
+/**
+ * @brief   Snapshot of the interfaces that are up, support multicast and have an IPv6 link-local address.
+ *
+ * @details
+ *  Enumerating the interfaces takes a getifaddrs() call and a link-local address lookup per interface on
+ *  sockets-based systems, which is too expensive to repeat for every multicast message. This class keeps
+ *  the result until the interface configuration changes.
+ *
+ *  On Linux, changes are detected through a netlink socket subscribed to link and address notifications,
+ *  which is polled without blocking whenever the interfaces are requested. On other platforms, or if the
+ *  netlink socket cannot be opened, the snapshot is refreshed once it is older than
+ *  INET_CONFIG_MULTICAST_INTERFACE_CACHE_MAX_AGE_MSEC. Invalidate() forces a refresh on the next request.
+ *
+ *  Methods of this class are *not* thread-safe.
+ */
+class MulticastInterfaceCache
+{
+public:
+    struct Interface
+    {
+        InterfaceId interfaceId;
+        char name[InterfaceId::kMaxIfNameLength];
+    };
+
+    MulticastInterfaceCache() = default;
+    ~MulticastInterfaceCache() { Shutdown(); }
+
+    MulticastInterfaceCache(const MulticastInterfaceCache &)             = delete;
+    MulticastInterfaceCache & operator=(const MulticastInterfaceCache &) = delete;
+
+    /**
+     * Returns the current multicast interfaces, enumerating them first if the snapshot is stale.
+     *
+     * The returned span is valid until the next call to GetInterfaces(), Invalidate() or Shutdown().
+     */
+    Span<const Interface> GetInterfaces();
+
+    /**
+     * Drops the current snapshot, so that the next GetInterfaces() enumerates the interfaces again.
+     */
+    void Invalidate() { mValid = false; }
+
+    /**
+     * Drops the current snapshot and releases the change notification resources.
+     */
+    void Shutdown();
+
+private:
+    bool IsStale();
+    void Refresh();
+
+#if INET_MULTICAST_INTERFACE_CACHE_USE_NETLINK
+    void OpenNetlinkSocket();
+    bool DrainNetlinkSocket();
+
+    int mNetlinkSocket             = -1;
+    bool mNetlinkSocketUnavailable = false;
+#endif // INET_MULTICAST_INTERFACE_CACHE_USE_NETLINK
+
+    Interface mInterfaces[INET_CONFIG_MAX_MULTICAST_INTERFACES];
+    size_t mInterfaceCount = 0;
+    bool mValid            = false;
+    System::Clock::Timestamp mRefreshTime;
+};
+
+} // namespace Inet
+} // namespace chip
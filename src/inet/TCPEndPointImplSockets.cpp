@@ -41,6 +41,7 @@
 #include <sys/ioctl.h>
 #include <sys/select.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 // SOCK_CLOEXEC not defined on all platforms, e.g. iOS/macOS:
@@ -484,9 +485,30 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
     TCPEndPointHandle handle(this);
     while (!mSendQueue.IsNull())
     {
-        size_t bufLen = mSendQueue->DataLength();
+        // Gather the queued buffers, so that consecutive messages and messages held in a chain of buffers are handed
+        // to the kernel in a single call.
+        struct iovec sendIOV[INET_CONFIG_TCP_SEND_MAX_IOVECS];
+        size_t iovCount = 0;
+        size_t bufLen   = 0;
+        for (System::PacketBufferHandle buf = mSendQueue.Retain(); !buf.IsNull() && iovCount < MATTER_ARRAY_SIZE(sendIOV);
+             buf.Advance())
+        {
+            if (buf->DataLength() == 0)
+            {
+                continue;
+            }
+            sendIOV[iovCount].iov_base = buf->Start();
+            sendIOV[iovCount].iov_len  = buf->DataLength();
+            bufLen += buf->DataLength();
+            iovCount++;
+        }
 
-        ssize_t lenSentRaw = send(mSocket, mSendQueue->Start(), bufLen, sendFlags);
+        struct msghdr msgHeader;
+        memset(&msgHeader, 0, sizeof(msgHeader));
+        msgHeader.msg_iov    = sendIOV;
+        msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(iovCount);
+
+        ssize_t lenSentRaw = sendmsg(mSocket, &msgHeader, sendFlags);
 
         if (lenSentRaw == -1)
         {
@@ -508,21 +530,20 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
         // Mark the connection as being active.
         MarkActive();
 
-        if (lenSent < bufLen)
+        // Free the buffers that were sent completely, including any empty ones left at the head of the queue.
+        mSendQueue.Consume(lenSent);
+        while (!mSendQueue.IsNull() && mSendQueue->DataLength() == 0)
         {
-            mSendQueue->ConsumeHead(lenSent);
+            mSendQueue.FreeHead();
         }
-        else
+
+        if (mSendQueue.IsNull())
         {
-            mSendQueue.FreeHead();
-            if (mSendQueue.IsNull())
+            // Do not wait for ability to write on this endpoint.
+            err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
+            if (err != CHIP_NO_ERROR)
             {
-                // Do not wait for ability to write on this endpoint.
-                err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
-                if (err != CHIP_NO_ERROR)
-                {
-                    break;
-                }
+                break;
             }
         }
 
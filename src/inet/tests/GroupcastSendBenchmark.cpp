@@ -0,0 +1,133 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Compares the per-message work of sending a group message on every
+ *      multicast interface: enumerating the interfaces and cloning the
+ *      encrypted message for each of them, versus reading the interfaces
+ *      from MulticastInterfaceCache and sharing the message.
+ *
+ *      Usage: groupcast-send-benchmark
+ */
+
+#include <inet/IPAddress.h>
+#include <inet/MulticastInterfaceCache.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemPacketBuffer.h>
+
+#include <chrono>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace chip;
+using namespace chip::Inet;
+
+namespace {
+
+constexpr size_t kBenchmarkIterations = 1000;
+constexpr size_t kGroupMessageSize    = 100;
+
+// Enumerates the multicast interfaces the way MulticastInterfaceCache does, without caching.
+size_t EnumerateMulticastInterfaces(InterfaceId (&interfaces)[INET_CONFIG_MAX_MULTICAST_INTERFACES])
+{
+    InterfaceIterator interfaceIt;
+    size_t count = 0;
+
+    while (interfaceIt.Next() && count < MATTER_ARRAY_SIZE(interfaces))
+    {
+        IPAddress addr;
+        if (interfaceIt.SupportsMulticast() && interfaceIt.IsUp() &&
+            interfaceIt.GetInterfaceId().GetLinkLocalAddr(&addr) == CHIP_NO_ERROR)
+        {
+            interfaces[count++] = interfaceIt.GetInterfaceId();
+        }
+    }
+    return count;
+}
+
+double RatePerSecond(size_t count, std::chrono::steady_clock::duration elapsed)
+{
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    return seconds > 0 ? static_cast<double>(count) / seconds : 0;
+}
+
+CHIP_ERROR RunBenchmark()
+{
+    uint8_t payload[kGroupMessageSize];
+    memset(payload, 0xA5, sizeof(payload));
+
+    System::PacketBufferHandle message = System::PacketBufferHandle::NewWithData(payload, sizeof(payload));
+    VerifyOrReturnError(!message.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    // Per-message interface enumeration and one copy of the message per interface.
+    size_t uncachedSends = 0;
+    auto start           = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kBenchmarkIterations; i++)
+    {
+        InterfaceId interfaces[INET_CONFIG_MAX_MULTICAST_INTERFACES];
+        const size_t count = EnumerateMulticastInterfaces(interfaces);
+        for (size_t j = 0; j < count; j++)
+        {
+            System::PacketBufferHandle copy = message.CloneData();
+            VerifyOrReturnError(!copy.IsNull(), CHIP_ERROR_NO_MEMORY);
+            uncachedSends++;
+        }
+    }
+    const auto uncachedElapsed = std::chrono::steady_clock::now() - start;
+
+    // Cached interfaces and one shared message for every interface.
+    MulticastInterfaceCache cache;
+    size_t cachedSends = 0;
+    start              = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kBenchmarkIterations; i++)
+    {
+        const size_t count = cache.GetInterfaces().size();
+        for (size_t j = 0; j < count; j++)
+        {
+            System::PacketBufferHandle shared = message.Retain();
+            VerifyOrReturnError(!shared.IsNull(), CHIP_ERROR_NO_MEMORY);
+            cachedSends++;
+        }
+    }
+    const auto cachedElapsed = std::chrono::steady_clock::now() - start;
+
+    VerifyOrReturnError(cachedSends == uncachedSends, CHIP_ERROR_INTERNAL);
+
+    ChipLogProgress(Inet, "Groupcast send over %u interfaces: %.0f messages/s uncached, %.0f messages/s cached",
+                    static_cast<unsigned>(cache.GetInterfaces().size()), RatePerSecond(kBenchmarkIterations, uncachedElapsed),
+                    RatePerSecond(kBenchmarkIterations, cachedElapsed));
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    CHIP_ERROR err = RunBenchmark();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Groupcast send benchmark failed: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    Platform::MemoryShutdown();
+    return (err == CHIP_NO_ERROR) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
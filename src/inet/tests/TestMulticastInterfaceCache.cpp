@@ -0,0 +1,85 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Unit tests for MulticastInterfaceCache.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <inet/IPAddress.h>
+#include <inet/MulticastInterfaceCache.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+
+using namespace chip;
+using namespace chip::Inet;
+
+namespace {
+
+// Enumerates the multicast interfaces the way MulticastInterfaceCache does, without caching.
+size_t EnumerateMulticastInterfaces(InterfaceId (&interfaces)[INET_CONFIG_MAX_MULTICAST_INTERFACES])
+{
+    InterfaceIterator interfaceIt;
+    size_t count = 0;
+
+    while (interfaceIt.Next() && count < MATTER_ARRAY_SIZE(interfaces))
+    {
+        IPAddress addr;
+        if (interfaceIt.SupportsMulticast() && interfaceIt.IsUp() &&
+            interfaceIt.GetInterfaceId().GetLinkLocalAddr(&addr) == CHIP_NO_ERROR)
+        {
+            interfaces[count++] = interfaceIt.GetInterfaceId();
+        }
+    }
+    return count;
+}
+
+class TestMulticastInterfaceCache : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestMulticastInterfaceCache, MatchesInterfaceEnumeration)
+{
+    InterfaceId expected[INET_CONFIG_MAX_MULTICAST_INTERFACES];
+    const size_t expectedCount = EnumerateMulticastInterfaces(expected);
+
+    MulticastInterfaceCache cache;
+    auto interfaces = cache.GetInterfaces();
+    ASSERT_EQ(interfaces.size(), expectedCount);
+    for (size_t i = 0; i < expectedCount; i++)
+    {
+        EXPECT_EQ(interfaces[i].interfaceId, expected[i]);
+
+        char name[InterfaceId::kMaxIfNameLength];
+        EXPECT_EQ(expected[i].GetInterfaceName(name, sizeof(name)), CHIP_NO_ERROR);
+        EXPECT_STREQ(interfaces[i].name, name);
+    }
+
+    // Later requests, after an invalidation and after a shutdown return the same interfaces.
+    EXPECT_EQ(cache.GetInterfaces().size(), expectedCount);
+    cache.Invalidate();
+    EXPECT_EQ(cache.GetInterfaces().size(), expectedCount);
+    cache.Shutdown();
+    EXPECT_EQ(cache.GetInterfaces().size(), expectedCount);
+}
+
+} // namespace
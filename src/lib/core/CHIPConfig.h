@@ -163,6 +163,25 @@
 #define CHIP_CONFIG_MEMORY_DEBUG_DMALLOC 0
 #endif // CHIP_CONFIG_MEMORY_DEBUG_DMALLOC
 
+/**
+ *  @def CHIP_CONFIG_MEMORY_TRACKING
+ *
+ *  @brief
+ *    Enable (1) or disable (0) per-tag accounting of the chip::Platform
+ *    heap allocations, see lib/support/CHIPMemTracking.h.
+ *
+ *    Each allocation is prefixed with a small header recording its size
+ *    and tag, so memory from MemoryAlloc() and friends must never be
+ *    released with free(), nor malloc() memory with MemoryFree().
+ *
+ *  @note This configuration is only implemented when
+ *        #CHIP_CONFIG_MEMORY_MGMT_MALLOC is set.
+ *
+ */
+#ifndef CHIP_CONFIG_MEMORY_TRACKING
+#define CHIP_CONFIG_MEMORY_TRACKING 0
+#endif // CHIP_CONFIG_MEMORY_TRACKING
+
 /**
  *  @def CHIP_CONFIG_GLOBALS_LAZY_INIT
  *
@@ -1079,6 +1098,21 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_DEVICES 64
 #endif
 
+/**
+ * @def CHIP_CONFIG_MAX_CONCURRENT_COMMISSIONEES
+ *
+ * @brief Number of devices a DeviceCommissioner can establish PASE with, and
+ *        commission, at the same time.
+ *
+ *        When greater than 1, each commissionee gets its own heap-allocated
+ *        AutoCommissioner. Commissioners configured with a custom default
+ *        CommissioningDelegate still commission one device at a time, and
+ *        PASE over BLE or Wi-Fi PAF is limited to one device at a time.
+ */
+#ifndef CHIP_CONFIG_MAX_CONCURRENT_COMMISSIONEES
+#define CHIP_CONFIG_MAX_CONCURRENT_COMMISSIONEES 1
+#endif
+
 /**
  * @def CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_CASE_CLIENTS
  *
@@ -1669,6 +1703,38 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_SCENES_USE_DEFAULT_HANDLERS 1
 #endif // CHIP_CONFIG_SCENES_USE_DEFAULT_HANDLERS
 
+/**
+ * @def CHIP_CONFIG_SCENES_CACHE_SIZE
+ *
+ * @brief Number of decoded scenes the scene table keeps in RAM, so that recalling a scene does not read and decode it from
+ * persistent storage again. The cache is write-through: storage remains the source of truth and is updated on every change.
+ * Each cached scene takes sizeof(SceneTableEntry) bytes of RAM (about 600 bytes with the default extension field set sizes),
+ * so the cache is disabled by default; platforms and products with RAM to spare, such as Linux, enable it.
+ */
+#ifndef CHIP_CONFIG_SCENES_CACHE_SIZE
+#define CHIP_CONFIG_SCENES_CACHE_SIZE 0
+#endif // CHIP_CONFIG_SCENES_CACHE_SIZE
+
+/**
+ * @def CHIP_CONFIG_TRANSITION_SCHEDULER_GRANULARITY_MS
+ *
+ * @brief Width, in milliseconds, of the windows in which the transition steps of the level control and color
+ * control clusters share a timer tick (see app::TransitionScheduler). Steps are delayed by up to this much.
+ */
+#ifndef CHIP_CONFIG_TRANSITION_SCHEDULER_GRANULARITY_MS
+#define CHIP_CONFIG_TRANSITION_SCHEDULER_GRANULARITY_MS 10
+#endif // CHIP_CONFIG_TRANSITION_SCHEDULER_GRANULARITY_MS
+
+/**
+ * @def CHIP_CONFIG_TRANSITION_SCHEDULER_POOL_SIZE
+ *
+ * @brief Number of transition steps app::TransitionScheduler can hold when pools are statically allocated. Steps
+ * beyond it use their own system timer.
+ */
+#ifndef CHIP_CONFIG_TRANSITION_SCHEDULER_POOL_SIZE
+#define CHIP_CONFIG_TRANSITION_SCHEDULER_POOL_SIZE 16
+#endif // CHIP_CONFIG_TRANSITION_SCHEDULER_POOL_SIZE
+
 /**
  * @def CHIP_CONFIG_TIME_ZONE_LIST_MAX_SIZE
  *
@@ -1848,6 +1914,20 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_ICD_CLIENTS_INFO_STORAGE_CONCURRENT_ITERATORS 1
 #endif
 
+/**
+ * @def CHIP_CONFIG_ICD_CLIENT_CHECK_IN_NONCE_WINDOW
+ *
+ * @brief Number of upcoming check-in counters of each registered ICD client for which DefaultICDClientStorage precomputes the
+ *        check-in message nonce.
+ *
+ * A check-in message whose nonce was precomputed is matched to its client with a single lookup, and decrypted once.  Other
+ * messages, e.g. after the ICD skipped more check-ins than the window, are tried against the key of every client.  Each
+ * window slot costs one HMAC computation per client whenever the client is stored.  Set to 0 to disable the precomputation.
+ */
+#ifndef CHIP_CONFIG_ICD_CLIENT_CHECK_IN_NONCE_WINDOW
+#define CHIP_CONFIG_ICD_CLIENT_CHECK_IN_NONCE_WINDOW 4
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_THREAD_NETWORK_DIRECTORY_STORAGE_CAPACITY
  *
@@ -1937,6 +2017,19 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_BDX_LOG_TRANSFER_MAX_BLOCK_SIZE 1024
 #endif // CHIP_CONFIG_BDX_LOG_TRANSFER_MAX_BLOCK_SIZE
 
+/**
+ *  @def CHIP_CONFIG_BDX_WINDOWED_TRANSFER_MAX_BLOCKS_IN_FLIGHT
+ *
+ *  @brief
+ *    Maximum number of Blocks that the sender of a windowed BDX transfer (see bdx::TransferControlFlags::kWindowed)
+ *    sends before waiting for a BlockAck. The windowed mode is only meant for transfers over TCP, where it hides the
+ *    round trip time that otherwise limits the throughput to one Block per round trip.
+ *
+ */
+#ifndef CHIP_CONFIG_BDX_WINDOWED_TRANSFER_MAX_BLOCKS_IN_FLIGHT
+#define CHIP_CONFIG_BDX_WINDOWED_TRANSFER_MAX_BLOCKS_IN_FLIGHT 8
+#endif // CHIP_CONFIG_BDX_WINDOWED_TRANSFER_MAX_BLOCKS_IN_FLIGHT
+
 /**
  *  @def CHIP_CONFIG_TEST_GOOGLETEST
  *
@@ -49,6 +49,36 @@ using namespace chip::Encoding;
 
 static const uint8_t sTagSizes[] = { 0, 1, 2, 4, 2, 4, 6, 8 };
 
+namespace {
+
+constexpr uint8_t kInvalidElementType = 0xFF;
+
+// Number of bytes of the length/value field of each element type, indexed by the type bits of the control byte, or
+// kInvalidElementType for the values that are not element types.  Saves the type checks of GetTLVFieldSize() on every element.
+struct LenOrValSizeTable
+{
+    uint8_t bytes[kTLVTypeMask + 1] = {};
+
+    constexpr LenOrValSizeTable()
+    {
+        for (uint8_t type = 0; type <= kTLVTypeMask; type++)
+        {
+            const TLVElementType elemType = static_cast<TLVElementType>(type);
+            bytes[type] = IsValidTLVType(elemType) ? TLVFieldSizeToBytes(GetTLVFieldSize(elemType)) : kInvalidElementType;
+        }
+    }
+};
+
+constexpr LenOrValSizeTable sLenOrValSizes;
+
+static_assert(sLenOrValSizes.bytes[static_cast<uint8_t>(TLVElementType::Int64)] == 8);
+static_assert(sLenOrValSizes.bytes[static_cast<uint8_t>(TLVElementType::UTF8String_2ByteLength)] == 2);
+static_assert(sLenOrValSizes.bytes[static_cast<uint8_t>(TLVElementType::BooleanTrue)] == 0);
+static_assert(sLenOrValSizes.bytes[static_cast<uint8_t>(TLVElementType::EndOfContainer)] == 0);
+static_assert(sLenOrValSizes.bytes[static_cast<uint8_t>(TLVElementType::EndOfContainer) + 1] == kInvalidElementType);
+
+} // namespace
+
 TLVReader::TLVReader() :
     ImplicitProfileId(kProfileIdNotSpecified), AppData(nullptr), mElemLenOrVal(0), mBackingStore(nullptr), mReadPoint(nullptr),
     mBufEnd(nullptr), mLenRead(0), mMaxLen(0), mContainerType(kTLVType_NotSpecified), mControlByte(kTLVControlByte_NotSpecified),
@@ -747,9 +777,9 @@ CHIP_ERROR TLVReader::ReadElement()
     // Get the element's control byte.
     mControlByte = *mReadPoint;
 
-    // Extract the element type from the control byte. Fail if it's invalid.
-    TLVElementType elemType = ElementType();
-    VerifyOrReturnError(IsValidTLVType(elemType), CHIP_ERROR_INVALID_TLV_ELEMENT);
+    // Determine the number of bytes in the length/value field from the element type. Fail if the type is invalid.
+    const uint8_t valOrLenBytes = sLenOrValSizes.bytes[mControlByte & kTLVTypeMask];
+    VerifyOrReturnError(valOrLenBytes != kInvalidElementType, CHIP_ERROR_INVALID_TLV_ELEMENT);
 
     // Extract the tag control from the control byte.
     TLVTagControl tagControl = static_cast<TLVTagControl>(mControlByte & kTLVTagControlMask);
@@ -757,44 +787,59 @@ CHIP_ERROR TLVReader::ReadElement()
     // Determine the number of bytes in the element's tag, if any.
     uint8_t tagBytes = sTagSizes[tagControl >> kTLVTagControlShift];
 
-    // Extract the size of length/value field from the control byte.
-    TLVFieldSize lenOrValFieldSize = GetTLVFieldSize(elemType);
-
-    // Determine the number of bytes in the length/value field.
-    const uint8_t valOrLenBytes = TLVFieldSizeToBytes(lenOrValFieldSize);
-
     // Determine the number of bytes in the element's 'head'. This includes: the control byte, the tag bytes (if present), the
     // length bytes (if present), and for elements that don't have a length (e.g. integers), the value bytes.
     const uint8_t elemHeadBytes = static_cast<uint8_t>(1 + tagBytes + valOrLenBytes);
 
     // 17 = 1 control byte + 8 tag bytes + 8 length/value bytes
     uint8_t stagingBuf[17];
+    const uint8_t * p;
 
-    // Odd workaround: clang-tidy claims garbage value otherwise as it does not
-    // understand that ReadData initializes stagingBuf
-    stagingBuf[1] = 0;
+    if (static_cast<size_t>(mBufEnd - mReadPoint) >= elemHeadBytes)
+    {
+        // The head of the element is in the current input buffer, as it always is for contiguous input: parse it in place.
+        // +1 to skip over the control byte
+        p = mReadPoint + 1;
+        mReadPoint += elemHeadBytes;
+        mLenRead += elemHeadBytes;
+    }
+    else
+    {
+        // Odd workaround: clang-tidy claims garbage value otherwise as it does not
+        // understand that ReadData initializes stagingBuf
+        stagingBuf[1] = 0;
 
-    // If the head of the element goes past the end of the current input buffer,
-    // we need to read it into the staging buffer to parse it.  Just do that unconditionally,
-    // even if the head does not go past end of current buffer, to save codesize.
-    ReturnErrorOnFailure(ReadData(stagingBuf, elemHeadBytes));
+        // The head of the element goes past the end of the current input buffer, read it into the staging buffer to parse it.
+        ReturnErrorOnFailure(ReadData(stagingBuf, elemHeadBytes));
 
-    // +1 to skip over the control byte
-    const uint8_t * p = stagingBuf + 1;
+        // +1 to skip over the control byte
+        p = stagingBuf + 1;
+    }
 
     // Read the tag field, if present.
-    mElemTag      = ReadTag(tagControl, p);
-    mElemLenOrVal = 0;
+    mElemTag = ReadTag(tagControl, p);
 
     // Read the length/value field, if present.
-    // NOTE: this is works because even though we only memcpy a subset of values and leave
-    //       the rest 0. Value looks like "<le-byte> <le-byte> ... <le-byte> 0 0 ... 0"
-    //       which is the TLV format. HostSwap ensures this becomes a real host value
-    //       (should be a NOOP on LE machines, will full-swap on big-endian machines)
-    memcpy(&mElemLenOrVal, p, valOrLenBytes);
-    LittleEndian::HostSwap(mElemLenOrVal);
+    switch (valOrLenBytes)
+    {
+    case 1:
+        mElemLenOrVal = Read8(p);
+        break;
+    case 2:
+        mElemLenOrVal = LittleEndian::Read16(p);
+        break;
+    case 4:
+        mElemLenOrVal = LittleEndian::Read32(p);
+        break;
+    case 8:
+        mElemLenOrVal = LittleEndian::Read64(p);
+        break;
+    default:
+        mElemLenOrVal = 0;
+        break;
+    }
 
-    VerifyOrReturnError(!TLVTypeHasLength(elemType) || (mElemLenOrVal <= UINT32_MAX), CHIP_ERROR_NOT_IMPLEMENTED);
+    VerifyOrReturnError(!TLVTypeHasLength(ElementType()) || (mElemLenOrVal <= UINT32_MAX), CHIP_ERROR_NOT_IMPLEMENTED);
 
     return VerifyElement();
 }
@@ -939,11 +984,9 @@ CHIP_ERROR TLVReader::GetElementHeadLength(uint8_t & elemHeadBytes) const
     uint8_t tagBytes;
     uint8_t valOrLenBytes;
     TLVTagControl tagControl;
-    TLVFieldSize lenOrValFieldSize;
-    TLVElementType elemType = ElementType();
 
     // Verify element is of valid TLVType.
-    VerifyOrReturnError(IsValidTLVType(elemType), CHIP_ERROR_INVALID_TLV_ELEMENT);
+    VerifyOrReturnError(IsValidTLVType(ElementType()), CHIP_ERROR_INVALID_TLV_ELEMENT);
 
     // Extract the tag control from the control byte.
     tagControl = static_cast<TLVTagControl>(mControlByte & kTLVTagControlMask);
@@ -951,11 +994,8 @@ CHIP_ERROR TLVReader::GetElementHeadLength(uint8_t & elemHeadBytes) const
     // Determine the number of bytes in the element's tag, if any.
     tagBytes = sTagSizes[tagControl >> kTLVTagControlShift];
 
-    // Extract the size of length/value field from the control byte.
-    lenOrValFieldSize = GetTLVFieldSize(elemType);
-
     // Determine the number of bytes in the length/value field.
-    valOrLenBytes = TLVFieldSizeToBytes(lenOrValFieldSize);
+    valOrLenBytes = sLenOrValSizes.bytes[mControlByte & kTLVTypeMask];
 
     // Determine the number of bytes in the element's 'head'. This includes: the
     // control byte, the tag bytes (if present), the length bytes (if present),
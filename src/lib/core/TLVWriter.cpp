@@ -682,21 +682,61 @@ CHIP_ERROR TLVWriter::WriteElementHead(TLVElementType elemType, Tag tag, uint64_
 
     if (IsSpecialTag(tag))
     {
-        if (tagNum <= Tag::kContextTagMaxNum)
+        const bool isContextTag = (tagNum <= Tag::kContextTagMaxNum);
+        if (isContextTag)
         {
             if (mContainerType != kTLVType_Structure && mContainerType != kTLVType_List)
                 return CHIP_ERROR_INVALID_TLV_TAG;
-
-            writer.Put8(TLVTagControl::ContextSpecific | elemType);
-            writer.Put8(static_cast<uint8_t>(tagNum));
         }
         else
         {
             if (elemType != TLVElementType::EndOfContainer && mContainerType != kTLVType_NotSpecified &&
                 mContainerType != kTLVType_Array && mContainerType != kTLVType_List)
                 return CHIP_ERROR_INVALID_TLV_TAG;
+        }
+
+        const uint8_t controlByte = (isContextTag ? TLVTagControl::ContextSpecific : TLVTagControl::Anonymous) | elemType;
+        const uint8_t lengthSize  = TLVFieldSizeToBytes(GetTLVFieldSize(elemType));
+        const uint32_t headLen    = (isContextTag ? 2u : 1u) + lengthSize;
+
+        // Context and anonymous tags make up nearly every element of an Interaction Model payload.  When the whole head fits in
+        // the current buffer, write it in place rather than staging it for WriteData().
+        if (headLen <= mRemainingLen && (mLenWritten + headLen) <= mMaxLen)
+        {
+            uint8_t * p = mWritePoint;
+            Encoding::Write8(p, controlByte);
+            if (isContextTag)
+            {
+                Encoding::Write8(p, static_cast<uint8_t>(tagNum));
+            }
+            switch (lengthSize)
+            {
+            case 1:
+                Encoding::Write8(p, static_cast<uint8_t>(lenOrVal));
+                break;
+            case 2:
+                Encoding::LittleEndian::Write16(p, static_cast<uint16_t>(lenOrVal));
+                break;
+            case 4:
+                Encoding::LittleEndian::Write32(p, static_cast<uint32_t>(lenOrVal));
+                break;
+            case 8:
+                Encoding::LittleEndian::Write64(p, lenOrVal);
+                break;
+            default:
+                break;
+            }
 
-            writer.Put8(TLVTagControl::Anonymous | elemType);
+            mWritePoint = p;
+            mRemainingLen -= headLen;
+            mLenWritten += headLen;
+            return CHIP_NO_ERROR;
+        }
+
+        writer.Put8(controlByte);
+        if (isContextTag)
+        {
+            writer.Put8(static_cast<uint8_t>(tagNum));
         }
     }
     else
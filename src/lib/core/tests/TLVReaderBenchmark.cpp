@@ -0,0 +1,131 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures the TLVReader parse throughput on recorded Interaction Model
+ *      payloads held in a contiguous buffer.
+ *
+ *      Usage: tlv-reader-benchmark
+ */
+
+#include <lib/core/TLV.h>
+#include <lib/core/tests/TLVRecordedPayloads.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <chrono>
+#include <stdlib.h>
+
+using namespace chip;
+using namespace chip::TLV;
+using namespace chip::TLV::Testing;
+
+namespace {
+
+constexpr size_t kBenchmarkIterations = 20000;
+
+// Walks all the elements of the current container and returns a checksum of the values.
+CHIP_ERROR Walk(TLVReader & reader, uint64_t & checksum)
+{
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        uint64_t value = 0;
+
+        switch (reader.GetType())
+        {
+        case kTLVType_SignedInteger: {
+            int64_t signedValue;
+            ReturnErrorOnFailure(reader.Get(signedValue));
+            value = static_cast<uint64_t>(signedValue);
+            break;
+        }
+        case kTLVType_UnsignedInteger:
+            ReturnErrorOnFailure(reader.Get(value));
+            break;
+        case kTLVType_Boolean: {
+            bool boolValue;
+            ReturnErrorOnFailure(reader.Get(boolValue));
+            value = boolValue;
+            break;
+        }
+        case kTLVType_UTF8String:
+        case kTLVType_ByteString: {
+            ByteSpan bytes;
+            ReturnErrorOnFailure(reader.Get(bytes));
+            value = bytes.size() + (bytes.empty() ? 0 : bytes[0]);
+            break;
+        }
+        case kTLVType_Structure:
+        case kTLVType_Array:
+        case kTLVType_List: {
+            TLVType containerType;
+            ReturnErrorOnFailure(reader.EnterContainer(containerType));
+            ReturnErrorOnFailure(Walk(reader, value));
+            ReturnErrorOnFailure(reader.ExitContainer(containerType));
+            break;
+        }
+        default:
+            break;
+        }
+
+        checksum = checksum * 31 + value;
+    }
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
+CHIP_ERROR RunBenchmark()
+{
+    for (const RecordedPayload & payload : kRecordedPayloads)
+    {
+        uint64_t checksum = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < kBenchmarkIterations; i++)
+        {
+            ContiguousBufferTLVReader reader;
+            reader.Init(payload.data);
+            ReturnErrorOnFailure(Walk(reader, checksum));
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        const double seconds = std::chrono::duration<double>(elapsed).count();
+        const double bytes   = static_cast<double>(payload.data.size() * kBenchmarkIterations);
+        ChipLogProgress(Support, "TLV parse of a %u-byte %s: %.1f MB/s, %.0f ns per payload (checksum %llx)",
+                        static_cast<unsigned>(payload.data.size()), payload.name, bytes / seconds / 1e6,
+                        seconds * 1e9 / kBenchmarkIterations, static_cast<unsigned long long>(checksum));
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    CHIP_ERROR err = RunBenchmark();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Support, "TLV reader benchmark failed: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    Platform::MemoryShutdown();
+    return (err == CHIP_NO_ERROR) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
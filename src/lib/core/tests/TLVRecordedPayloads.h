@@ -0,0 +1,167 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Recorded Interaction Model payloads, shared by the TLVReader tests and
+ *      the TLV parse benchmark.
+ */
+
+#pragma once
+
+#include <lib/support/Span.h>
+
+#include <stdint.h>
+
+namespace chip {
+namespace TLV {
+namespace Testing {
+
+// Interaction Model payloads as sent on the wire, without their message headers.
+
+// ReportDataMessage answering a wildcard read of the Basic Information cluster on endpoint 0.
+inline constexpr uint8_t kWildcardReadReport[] = {
+    0x15, 0x36, 0x01, 0x15, 0x35, 0x01, 0x26, 0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24, 0x02,
+    0x00, 0x24, 0x03, 0x28, 0x24, 0x04, 0x00, 0x18, 0x24, 0x02, 0x11, 0x18, 0x18, 0x15, 0x35, 0x01,
+    0x26, 0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x28, 0x24, 0x04,
+    0x01, 0x18, 0x2c, 0x02, 0x0b, 0x54, 0x45, 0x53, 0x54, 0x5f, 0x56, 0x45, 0x4e, 0x44, 0x4f, 0x52,
+    0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24, 0x02, 0x00,
+    0x24, 0x03, 0x28, 0x24, 0x04, 0x02, 0x18, 0x25, 0x02, 0xf1, 0xff, 0x18, 0x18, 0x15, 0x35, 0x01,
+    0x26, 0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x28, 0x24, 0x04,
+    0x03, 0x18, 0x2c, 0x02, 0x0c, 0x54, 0x45, 0x53, 0x54, 0x5f, 0x50, 0x52, 0x4f, 0x44, 0x55, 0x43,
+    0x54, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24, 0x02,
+    0x00, 0x24, 0x03, 0x28, 0x24, 0x04, 0x04, 0x18, 0x25, 0x02, 0x01, 0x80, 0x18, 0x18, 0x15, 0x35,
+    0x01, 0x26, 0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x28, 0x24,
+    0x04, 0x05, 0x18, 0x2c, 0x02, 0x00, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0xe2, 0x11, 0x3c,
+    0x5a, 0x37, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x28, 0x24, 0x04, 0x06, 0x18, 0x2c, 0x02, 0x02,
+    0x58, 0x58, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24,
+    0x02, 0x00, 0x24, 0x03, 0x28, 0x24, 0x04, 0x07, 0x18, 0x24, 0x02, 0x00, 0x18, 0x18, 0x15, 0x35,
+    0x01, 0x26, 0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x28, 0x24,
+    0x04, 0x08, 0x18, 0x2c, 0x02, 0x0c, 0x54, 0x45, 0x53, 0x54, 0x5f, 0x56, 0x45, 0x52, 0x53, 0x49,
+    0x4f, 0x4e, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24,
+    0x02, 0x00, 0x24, 0x03, 0x28, 0x24, 0x04, 0x09, 0x18, 0x24, 0x02, 0x01, 0x18, 0x18, 0x15, 0x35,
+    0x01, 0x26, 0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x28, 0x24,
+    0x04, 0x0a, 0x18, 0x2c, 0x02, 0x03, 0x31, 0x2e, 0x30, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00,
+    0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x28, 0x24, 0x04, 0x0b, 0x18,
+    0x2c, 0x02, 0x08, 0x32, 0x30, 0x32, 0x30, 0x30, 0x31, 0x30, 0x31, 0x18, 0x18, 0x15, 0x35, 0x01,
+    0x26, 0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x28, 0x24, 0x04,
+    0x0c, 0x18, 0x2c, 0x02, 0x00, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0xe2, 0x11, 0x3c, 0x5a,
+    0x37, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x28, 0x24, 0x04, 0x0d, 0x18, 0x2c, 0x02, 0x00, 0x18,
+    0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24, 0x02, 0x00, 0x24,
+    0x03, 0x28, 0x24, 0x04, 0x0e, 0x18, 0x2c, 0x02, 0x00, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00,
+    0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x28, 0x24, 0x04, 0x0f, 0x18,
+    0x2c, 0x02, 0x07, 0x54, 0x45, 0x53, 0x54, 0x5f, 0x53, 0x4e, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26,
+    0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x28, 0x24, 0x04, 0x10,
+    0x18, 0x28, 0x02, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01,
+    0x24, 0x02, 0x00, 0x24, 0x03, 0x28, 0x24, 0x04, 0x12, 0x18, 0x2c, 0x02, 0x20, 0x30, 0x30, 0x31,
+    0x31, 0x32, 0x32, 0x33, 0x33, 0x34, 0x34, 0x35, 0x35, 0x36, 0x36, 0x37, 0x37, 0x38, 0x38, 0x39,
+    0x39, 0x41, 0x41, 0x42, 0x42, 0x43, 0x43, 0x44, 0x44, 0x45, 0x45, 0x46, 0x46, 0x18, 0x18, 0x15,
+    0x35, 0x01, 0x26, 0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x28,
+    0x24, 0x04, 0x13, 0x18, 0x35, 0x02, 0x24, 0x00, 0x03, 0x24, 0x01, 0x03, 0x18, 0x18, 0x18, 0x15,
+    0x35, 0x01, 0x26, 0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x28,
+    0x24, 0x04, 0x15, 0x18, 0x26, 0x02, 0x00, 0x01, 0x04, 0x01, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26,
+    0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x28, 0x24, 0x04, 0x16,
+    0x18, 0x24, 0x02, 0x01, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37,
+    0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x28, 0x25, 0x04, 0xfb, 0xff, 0x18, 0x36, 0x02, 0x04, 0x00,
+    0x04, 0x01, 0x04, 0x02, 0x04, 0x03, 0x04, 0x04, 0x04, 0x05, 0x04, 0x06, 0x04, 0x07, 0x04, 0x08,
+    0x04, 0x09, 0x04, 0x0a, 0x04, 0x0b, 0x04, 0x0c, 0x04, 0x0d, 0x04, 0x0e, 0x04, 0x0f, 0x04, 0x10,
+    0x04, 0x12, 0x04, 0x13, 0x04, 0x15, 0x04, 0x16, 0x05, 0xf8, 0xff, 0x05, 0xf9, 0xff, 0x05, 0xfb,
+    0xff, 0x05, 0xfc, 0xff, 0x05, 0xfd, 0xff, 0x18, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0xe2,
+    0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x28, 0x25, 0x04, 0xf9, 0xff, 0x18,
+    0x36, 0x02, 0x18, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01,
+    0x24, 0x02, 0x00, 0x24, 0x03, 0x28, 0x25, 0x04, 0xf8, 0xff, 0x18, 0x36, 0x02, 0x18, 0x18, 0x18,
+    0x15, 0x35, 0x01, 0x26, 0x00, 0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03,
+    0x28, 0x25, 0x04, 0xfc, 0xff, 0x18, 0x24, 0x02, 0x00, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00,
+    0xe2, 0x11, 0x3c, 0x5a, 0x37, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x28, 0x25, 0x04, 0xfd, 0xff,
+    0x18, 0x24, 0x02, 0x04, 0x18, 0x18, 0x18, 0x29, 0x04, 0x24, 0xff, 0x0c, 0x18,
+};
+
+// ReportDataMessage of a subscription to the On/Off, Level Control, Color Control and Temperature Measurement clusters
+// of 4 endpoints.
+inline constexpr uint8_t kSubscriptionReport[] = {
+    0x15, 0x26, 0x00, 0x41, 0x6b, 0x2f, 0x8d, 0x36, 0x01, 0x15, 0x35, 0x01, 0x26, 0x00, 0x4d, 0x00,
+    0x01, 0x00, 0x37, 0x01, 0x24, 0x02, 0x01, 0x24, 0x03, 0x06, 0x24, 0x04, 0x00, 0x18, 0x29, 0x02,
+    0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0x4e, 0x00, 0x01, 0x00, 0x37, 0x01, 0x24, 0x02, 0x01,
+    0x24, 0x03, 0x08, 0x24, 0x04, 0x00, 0x18, 0x24, 0x02, 0x28, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26,
+    0x00, 0x4e, 0x00, 0x01, 0x00, 0x37, 0x01, 0x24, 0x02, 0x01, 0x24, 0x03, 0x08, 0x25, 0x04, 0x00,
+    0x40, 0x18, 0x24, 0x02, 0xfe, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0x4f, 0x00, 0x01, 0x00,
+    0x37, 0x01, 0x24, 0x02, 0x01, 0x25, 0x03, 0x00, 0x03, 0x24, 0x04, 0x07, 0x18, 0x25, 0x02, 0x04,
+    0x01, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0x4f, 0x00, 0x01, 0x00, 0x37, 0x01, 0x24, 0x02,
+    0x01, 0x25, 0x03, 0x00, 0x03, 0x24, 0x04, 0x08, 0x18, 0x24, 0x02, 0x02, 0x18, 0x18, 0x15, 0x35,
+    0x01, 0x26, 0x00, 0x50, 0x00, 0x01, 0x00, 0x37, 0x01, 0x24, 0x02, 0x01, 0x25, 0x03, 0x02, 0x04,
+    0x24, 0x04, 0x00, 0x18, 0x21, 0x02, 0x43, 0x08, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0x4d,
+    0x00, 0x02, 0x00, 0x37, 0x01, 0x24, 0x02, 0x02, 0x24, 0x03, 0x06, 0x24, 0x04, 0x00, 0x18, 0x28,
+    0x02, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0x4e, 0x00, 0x02, 0x00, 0x37, 0x01, 0x24, 0x02,
+    0x02, 0x24, 0x03, 0x08, 0x24, 0x04, 0x00, 0x18, 0x24, 0x02, 0x50, 0x18, 0x18, 0x15, 0x35, 0x01,
+    0x26, 0x00, 0x4e, 0x00, 0x02, 0x00, 0x37, 0x01, 0x24, 0x02, 0x02, 0x24, 0x03, 0x08, 0x25, 0x04,
+    0x00, 0x40, 0x18, 0x24, 0x02, 0xfe, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0x4f, 0x00, 0x02,
+    0x00, 0x37, 0x01, 0x24, 0x02, 0x02, 0x25, 0x03, 0x00, 0x03, 0x24, 0x04, 0x07, 0x18, 0x25, 0x02,
+    0x0e, 0x01, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0x4f, 0x00, 0x02, 0x00, 0x37, 0x01, 0x24,
+    0x02, 0x02, 0x25, 0x03, 0x00, 0x03, 0x24, 0x04, 0x08, 0x18, 0x24, 0x02, 0x02, 0x18, 0x18, 0x15,
+    0x35, 0x01, 0x26, 0x00, 0x50, 0x00, 0x02, 0x00, 0x37, 0x01, 0x24, 0x02, 0x02, 0x25, 0x03, 0x02,
+    0x04, 0x24, 0x04, 0x00, 0x18, 0x21, 0x02, 0x20, 0x08, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00,
+    0x4d, 0x00, 0x03, 0x00, 0x37, 0x01, 0x24, 0x02, 0x03, 0x24, 0x03, 0x06, 0x24, 0x04, 0x00, 0x18,
+    0x29, 0x02, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0x4e, 0x00, 0x03, 0x00, 0x37, 0x01, 0x24,
+    0x02, 0x03, 0x24, 0x03, 0x08, 0x24, 0x04, 0x00, 0x18, 0x24, 0x02, 0x78, 0x18, 0x18, 0x15, 0x35,
+    0x01, 0x26, 0x00, 0x4e, 0x00, 0x03, 0x00, 0x37, 0x01, 0x24, 0x02, 0x03, 0x24, 0x03, 0x08, 0x25,
+    0x04, 0x00, 0x40, 0x18, 0x24, 0x02, 0xfe, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0x4f, 0x00,
+    0x03, 0x00, 0x37, 0x01, 0x24, 0x02, 0x03, 0x25, 0x03, 0x00, 0x03, 0x24, 0x04, 0x07, 0x18, 0x25,
+    0x02, 0x18, 0x01, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0x4f, 0x00, 0x03, 0x00, 0x37, 0x01,
+    0x24, 0x02, 0x03, 0x25, 0x03, 0x00, 0x03, 0x24, 0x04, 0x08, 0x18, 0x24, 0x02, 0x02, 0x18, 0x18,
+    0x15, 0x35, 0x01, 0x26, 0x00, 0x50, 0x00, 0x03, 0x00, 0x37, 0x01, 0x24, 0x02, 0x03, 0x25, 0x03,
+    0x02, 0x04, 0x24, 0x04, 0x00, 0x18, 0x21, 0x02, 0xfd, 0x07, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26,
+    0x00, 0x4d, 0x00, 0x04, 0x00, 0x37, 0x01, 0x24, 0x02, 0x04, 0x24, 0x03, 0x06, 0x24, 0x04, 0x00,
+    0x18, 0x28, 0x02, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0x4e, 0x00, 0x04, 0x00, 0x37, 0x01,
+    0x24, 0x02, 0x04, 0x24, 0x03, 0x08, 0x24, 0x04, 0x00, 0x18, 0x24, 0x02, 0xa0, 0x18, 0x18, 0x15,
+    0x35, 0x01, 0x26, 0x00, 0x4e, 0x00, 0x04, 0x00, 0x37, 0x01, 0x24, 0x02, 0x04, 0x24, 0x03, 0x08,
+    0x25, 0x04, 0x00, 0x40, 0x18, 0x24, 0x02, 0xfe, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0x4f,
+    0x00, 0x04, 0x00, 0x37, 0x01, 0x24, 0x02, 0x04, 0x25, 0x03, 0x00, 0x03, 0x24, 0x04, 0x07, 0x18,
+    0x25, 0x02, 0x22, 0x01, 0x18, 0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0x4f, 0x00, 0x04, 0x00, 0x37,
+    0x01, 0x24, 0x02, 0x04, 0x25, 0x03, 0x00, 0x03, 0x24, 0x04, 0x08, 0x18, 0x24, 0x02, 0x02, 0x18,
+    0x18, 0x15, 0x35, 0x01, 0x26, 0x00, 0x50, 0x00, 0x04, 0x00, 0x37, 0x01, 0x24, 0x02, 0x04, 0x25,
+    0x03, 0x02, 0x04, 0x24, 0x04, 0x00, 0x18, 0x21, 0x02, 0xda, 0x07, 0x18, 0x18, 0x18, 0x24, 0xff,
+    0x0c, 0x18,
+};
+
+// InvokeRequestMessage batching a MoveToLevel command for 4 endpoints.
+inline constexpr uint8_t kInvokeRequest[] = {
+    0x15, 0x28, 0x00, 0x28, 0x01, 0x36, 0x02, 0x15, 0x37, 0x00, 0x24, 0x00, 0x01, 0x24, 0x01, 0x08,
+    0x24, 0x02, 0x04, 0x18, 0x35, 0x01, 0x24, 0x00, 0x32, 0x34, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03,
+    0x00, 0x18, 0x24, 0x02, 0x01, 0x18, 0x15, 0x37, 0x00, 0x24, 0x00, 0x02, 0x24, 0x01, 0x08, 0x24,
+    0x02, 0x04, 0x18, 0x35, 0x01, 0x24, 0x00, 0x64, 0x34, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x00,
+    0x18, 0x24, 0x02, 0x02, 0x18, 0x15, 0x37, 0x00, 0x24, 0x00, 0x03, 0x24, 0x01, 0x08, 0x24, 0x02,
+    0x04, 0x18, 0x35, 0x01, 0x24, 0x00, 0x96, 0x34, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x00, 0x18,
+    0x24, 0x02, 0x03, 0x18, 0x15, 0x37, 0x00, 0x24, 0x00, 0x04, 0x24, 0x01, 0x08, 0x24, 0x02, 0x04,
+    0x18, 0x35, 0x01, 0x24, 0x00, 0xc8, 0x34, 0x01, 0x24, 0x02, 0x00, 0x24, 0x03, 0x00, 0x18, 0x24,
+    0x02, 0x04, 0x18, 0x18, 0x24, 0xff, 0x0c, 0x18,
+};
+
+struct RecordedPayload
+{
+    const char * name;
+    ByteSpan data;
+};
+
+inline const RecordedPayload kRecordedPayloads[] = {
+    { "wildcard read report", ByteSpan(kWildcardReadReport) },
+    { "subscription report", ByteSpan(kSubscriptionReport) },
+    { "invoke request", ByteSpan(kInvokeRequest) },
+};
+
+} // namespace Testing
+} // namespace TLV
+} // namespace chip
@@ -0,0 +1,200 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Consistency checks for TLVReader on recorded Interaction Model payloads.
+ *
+ *      Element heads that lie entirely in the current input buffer are parsed in place,
+ *      others go through a staging copy. Both paths must decode the same elements.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLV.h>
+#include <lib/core/tests/TLVRecordedPayloads.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/Span.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::TLV;
+using namespace chip::TLV::Testing;
+
+class TestTLVReaderThroughput : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+// Serves the input in chunks of a fixed size, so that element heads straddle buffer boundaries.
+class ChunkedBackingStore : public TLVBackingStore
+{
+public:
+    ChunkedBackingStore(ByteSpan data, uint32_t chunkSize) : mData(data), mChunkSize(chunkSize) {}
+
+    CHIP_ERROR OnInit(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        mOffset = 0;
+        return GetNextBuffer(reader, bufStart, bufLen);
+    }
+
+    CHIP_ERROR GetNextBuffer(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufStart = mData.data() + mOffset;
+        bufLen   = static_cast<uint32_t>(std::min<size_t>(mChunkSize, mData.size() - mOffset));
+        mOffset += bufLen;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnInit(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR GetNewBuffer(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR FinalizeBuffer(TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+private:
+    ByteSpan mData;
+    uint32_t mChunkSize;
+    size_t mOffset = 0;
+};
+
+// Walks all the elements of the current container, appending a description of each to `trace` when given, and returns a
+// checksum of the values.
+CHIP_ERROR Walk(TLVReader & reader, std::vector<uint64_t> * trace, uint64_t & checksum)
+{
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        const TLVType type = reader.GetType();
+        const Tag tag      = reader.GetTag();
+        uint64_t value     = 0;
+
+        switch (type)
+        {
+        case kTLVType_SignedInteger: {
+            int64_t signedValue;
+            ReturnErrorOnFailure(reader.Get(signedValue));
+            value = static_cast<uint64_t>(signedValue);
+            break;
+        }
+        case kTLVType_UnsignedInteger:
+            ReturnErrorOnFailure(reader.Get(value));
+            break;
+        case kTLVType_Boolean: {
+            bool boolValue;
+            ReturnErrorOnFailure(reader.Get(boolValue));
+            value = boolValue;
+            break;
+        }
+        case kTLVType_UTF8String:
+        case kTLVType_ByteString:
+            if (trace == nullptr)
+            {
+                ByteSpan bytes;
+                ReturnErrorOnFailure(reader.Get(bytes));
+                value = bytes.size() + (bytes.empty() ? 0 : bytes[0]);
+            }
+            else
+            {
+                // Strings may straddle the chunks of the input, copy them out.
+                uint8_t bytes[64];
+                VerifyOrReturnError(reader.GetLength() <= sizeof(bytes), CHIP_ERROR_BUFFER_TOO_SMALL);
+                ReturnErrorOnFailure(reader.GetBytes(bytes, sizeof(bytes)));
+                for (uint32_t i = 0; i < reader.GetLength(); i++)
+                {
+                    value = value * 31 + bytes[i];
+                }
+            }
+            break;
+        case kTLVType_Structure:
+        case kTLVType_Array:
+        case kTLVType_List: {
+            TLVType containerType;
+            ReturnErrorOnFailure(reader.EnterContainer(containerType));
+            ReturnErrorOnFailure(Walk(reader, trace, value));
+            ReturnErrorOnFailure(reader.ExitContainer(containerType));
+            break;
+        }
+        default:
+            break;
+        }
+
+        checksum = checksum * 31 + value;
+        if (trace != nullptr)
+        {
+            trace->push_back(static_cast<uint64_t>(type));
+            trace->push_back(TagNumFromTag(tag) | (static_cast<uint64_t>(ProfileIdFromTag(tag)) << 32));
+            trace->push_back(value);
+        }
+    }
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
+TEST_F(TestTLVReaderThroughput, ParsesIdenticallyAcrossBufferBoundaries)
+{
+    for (const RecordedPayload & payload : kRecordedPayloads)
+    {
+        std::vector<uint64_t> expected;
+        uint64_t checksum = 0;
+        ContiguousBufferTLVReader contiguousReader;
+        contiguousReader.Init(payload.data);
+        ASSERT_EQ(Walk(contiguousReader, &expected, checksum), CHIP_NO_ERROR);
+        EXPECT_GT(expected.size(), 3u * 20);
+
+        // Chunk sizes below the largest element head (17 bytes) exercise the staging path.
+        for (uint32_t chunkSize : { 1, 2, 3, 5, 7, 16, 17, 64 })
+        {
+            ChunkedBackingStore store(payload.data, chunkSize);
+            TLVReader reader;
+            ASSERT_EQ(reader.Init(store, static_cast<uint32_t>(payload.data.size())), CHIP_NO_ERROR);
+
+            std::vector<uint64_t> trace;
+            checksum = 0;
+            EXPECT_EQ(Walk(reader, &trace, checksum), CHIP_NO_ERROR) << payload.name << ", chunks of " << chunkSize;
+            EXPECT_EQ(trace, expected) << payload.name << ", chunks of " << chunkSize;
+        }
+    }
+}
+
+TEST_F(TestTLVReaderThroughput, RejectsTruncatedHeads)
+{
+    for (const RecordedPayload & payload : kRecordedPayloads)
+    {
+        // Every truncation of the payload ends in the middle of an element or of a container.
+        for (size_t length = 1; length < payload.data.size(); length++)
+        {
+            ContiguousBufferTLVReader reader;
+            reader.Init(payload.data.data(), length);
+            uint64_t checksum = 0;
+            EXPECT_NE(Walk(reader, nullptr, checksum), CHIP_NO_ERROR) << payload.name << ", " << length << " bytes";
+        }
+    }
+}
+
+} // namespace
@@ -25,10 +25,16 @@
 
 #include <lib/core/CHIPConfig.h>
 #include <lib/support/CHIPMem.h>
+#include <lib/support/CHIPMemTracking.h>
 #include <lib/support/VerificationMacrosNoLogging.h>
 
+#include <stdint.h>
 #include <stdlib.h>
 
+#if CHIP_CONFIG_MEMORY_TRACKING
+#include <cstddef>
+#endif // CHIP_CONFIG_MEMORY_TRACKING
+
 #ifndef NDEBUG
 #include <atomic>
 #include <cstdio>
@@ -68,6 +74,42 @@ static void VerifyInitialized(const char * func)
 
 #endif
 
+#if CHIP_CONFIG_MEMORY_TRACKING
+
+namespace {
+
+// Prefix of each block, keeping the memory returned to the caller aligned for any type.
+struct alignas(std::max_align_t) AllocationHeader
+{
+    size_t size;
+    MemoryTag tag;
+};
+
+constexpr size_t kMaxTrackedSize = SIZE_MAX - sizeof(AllocationHeader);
+
+void * Track(void * block, size_t size, MemoryTag tag)
+{
+    if (block == nullptr)
+    {
+        return nullptr;
+    }
+
+    AllocationHeader * header = static_cast<AllocationHeader *>(block);
+    header->size              = size;
+    header->tag               = tag;
+    Internal::RecordMemoryAllocation(tag, size);
+    return header + 1;
+}
+
+AllocationHeader * HeaderOf(const void * p)
+{
+    return static_cast<AllocationHeader *>(const_cast<void *>(p)) - 1;
+}
+
+} // namespace
+
+#endif // CHIP_CONFIG_MEMORY_TRACKING
+
 CHIP_ERROR MemoryAllocatorInit(void * buf, size_t bufSize)
 {
     // Logging can use Memory::Alloc, so we can't use logging with our
@@ -93,32 +135,92 @@ void MemoryAllocatorShutdown()
 void * MemoryAlloc(size_t size)
 {
     VERIFY_INITIALIZED();
+#if CHIP_CONFIG_MEMORY_TRACKING
+    if (size > kMaxTrackedSize)
+    {
+        return nullptr;
+    }
+    return Track(malloc(sizeof(AllocationHeader) + size), size, ScopedMemoryTag::Current());
+#else
     return malloc(size);
+#endif // CHIP_CONFIG_MEMORY_TRACKING
 }
 
 void * MemoryCalloc(size_t num, size_t size)
 {
     VERIFY_INITIALIZED();
+#if CHIP_CONFIG_MEMORY_TRACKING
+    if (size != 0 && num > kMaxTrackedSize / size)
+    {
+        return nullptr;
+    }
+    return Track(calloc(1, sizeof(AllocationHeader) + num * size), num * size, ScopedMemoryTag::Current());
+#else
     return calloc(num, size);
+#endif // CHIP_CONFIG_MEMORY_TRACKING
 }
 
 void * MemoryRealloc(void * p, size_t size)
 {
     VERIFY_INITIALIZED();
     VERIFY_POINTER(p);
+#if CHIP_CONFIG_MEMORY_TRACKING
+    if (p == nullptr)
+    {
+        return MemoryAlloc(size);
+    }
+    if (size > kMaxTrackedSize)
+    {
+        return nullptr;
+    }
+
+    AllocationHeader * header = HeaderOf(p);
+    const size_t oldSize      = header->size;
+    const MemoryTag tag       = header->tag;
+    void * block              = realloc(header, sizeof(AllocationHeader) + size);
+    if (block == nullptr)
+    {
+        // The original block is left untouched, and accounted for.
+        return nullptr;
+    }
+    Internal::RecordMemoryFree(tag, oldSize);
+    return Track(block, size, tag);
+#else
     return realloc(p, size);
+#endif // CHIP_CONFIG_MEMORY_TRACKING
 }
 
 void MemoryFree(void * p)
 {
     VERIFY_INITIALIZED();
     VERIFY_POINTER(p);
+#if CHIP_CONFIG_MEMORY_TRACKING
+    if (p != nullptr)
+    {
+        AllocationHeader * header = HeaderOf(p);
+        Internal::RecordMemoryFree(header->tag, header->size);
+        free(header);
+    }
+#else
     free(p);
+#endif // CHIP_CONFIG_MEMORY_TRACKING
 }
 
 bool MemoryInternalCheckPointer(const void * p, size_t min_size)
 {
 #if CHIP_CONFIG_MEMORY_DEBUG_DMALLOC
+#if CHIP_CONFIG_MEMORY_TRACKING
+    // dmalloc knows the blocks including their header.
+    if (p != nullptr)
+    {
+        if (min_size > kMaxTrackedSize)
+        {
+            return false;
+        }
+        p = HeaderOf(p);
+        min_size += sizeof(AllocationHeader);
+    }
+#endif // CHIP_CONFIG_MEMORY_TRACKING
     return CanCastTo<int>(min_size) && (p != nullptr) &&
         (dmalloc_verify_pnt(__FILE__, __LINE__, __func__, p, 1, static_cast<int>(min_size)) == MALLOC_VERIFY_NOERROR);
 #else  // CHIP_CONFIG_MEMORY_DEBUG_DMALLOC
@@ -0,0 +1,85 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/CHIPMemArena.h>
+
+#include <lib/core/CHIPConfig.h>
+
+namespace chip {
+namespace Platform {
+
+namespace {
+
+#if CHIP_SYSTEM_CONFIG_THREAD_LOCAL_STORAGE
+thread_local ScopedMemoryArena * tCurrentScope = nullptr;
+#else  // CHIP_SYSTEM_CONFIG_THREAD_LOCAL_STORAGE
+ScopedMemoryArena * tCurrentScope = nullptr;
+#endif // CHIP_SYSTEM_CONFIG_THREAD_LOCAL_STORAGE
+
+} // namespace
+
+MemoryArena::MemoryArena(void * buffer, size_t capacity) : mBuffer(static_cast<uint8_t *>(buffer)), mCapacity(capacity) {}
+
+void * MemoryArena::Allocate(size_t size)
+{
+    // Empty allocations still get a distinct byte, so the pointer is known to belong to the arena.
+    size = (size == 0) ? 1 : size;
+
+    // mUsed is always aligned, round the end of this allocation for the next one.
+    const size_t available = mCapacity - mUsed;
+    if (size > available)
+    {
+        return nullptr;
+    }
+    const size_t padding = (kAlignment - size % kAlignment) % kAlignment;
+    const size_t rounded = (padding > available - size) ? available : size + padding;
+
+    void * p = mBuffer + mUsed;
+    mLast    = mUsed;
+    mUsed += rounded;
+    mPeak = (mUsed > mPeak) ? mUsed : mPeak;
+    return p;
+}
+
+void MemoryArena::Free(void * p)
+{
+    if (p == mBuffer + mLast && mLast < mUsed)
+    {
+        mUsed = mLast;
+    }
+}
+
+ScopedMemoryArena::ScopedMemoryArena(MemoryArena & arena) :
+    mArena(arena), mInitialUsed(arena.Used()), mPrevious(tCurrentScope)
+{
+    tCurrentScope = this;
+}
+
+ScopedMemoryArena::~ScopedMemoryArena()
+{
+    mArena.Rewind(mInitialUsed);
+    tCurrentScope = mPrevious;
+}
+
+MemoryArena * ScopedMemoryArena::Current()
+{
+    return (tCurrentScope != nullptr) ? &tCurrentScope->mArena : nullptr;
+}
+
+} // namespace Platform
+} // namespace chip
@@ -0,0 +1,156 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines bump arenas for the temporary buffers of request-scoped
+ *      work, e.g. a CASE handshake step or a report run.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Platform {
+
+/**
+ * Bump allocator over a caller-provided buffer.
+ *
+ * Allocations are carved out of the buffer in order and released all at once by Reset(); only the most recent allocation can
+ * be released individually.  Not thread-safe.
+ */
+class MemoryArena
+{
+public:
+    static constexpr size_t kAlignment = alignof(std::max_align_t);
+
+    /**
+     * @param[in]  buffer    Memory of the arena, aligned to kAlignment.  Must outlive the arena.
+     * @param[in]  capacity  Size of the buffer.
+     */
+    MemoryArena(void * buffer, size_t capacity);
+
+    MemoryArena(const MemoryArena &)             = delete;
+    MemoryArena & operator=(const MemoryArena &) = delete;
+
+    /**
+     * Returns `size` bytes aligned to kAlignment, or nullptr if the arena is exhausted.
+     */
+    void * Allocate(size_t size);
+
+    /**
+     * Releases `p` if it is the most recent allocation, otherwise does nothing until Reset().
+     */
+    void Free(void * p);
+
+    /**
+     * Releases all the allocations.
+     */
+    void Reset() { Rewind(0); }
+
+    /**
+     * Returns whether `p` points into the buffer of the arena.
+     */
+    bool Contains(const void * p) const
+    {
+        return static_cast<const uint8_t *>(p) >= mBuffer && static_cast<const uint8_t *>(p) < mBuffer + mCapacity;
+    }
+
+    size_t Capacity() const { return mCapacity; }
+
+    /**
+     * Bytes currently allocated, including alignment padding.
+     */
+    size_t Used() const { return mUsed; }
+
+    /**
+     * Highest Used() since the arena was created.  Useful to size the buffer.
+     */
+    size_t Peak() const { return mPeak; }
+
+private:
+    friend class ScopedMemoryArena;
+
+    void Rewind(size_t used)
+    {
+        mUsed = used;
+        mLast = used;
+    }
+
+    uint8_t * const mBuffer;
+    const size_t mCapacity;
+    size_t mUsed = 0;
+    size_t mLast = 0; // Offset of the most recent allocation
+    size_t mPeak = 0;
+};
+
+/**
+ * A MemoryArena with an embedded buffer of `N` bytes.
+ */
+template <size_t N>
+class FixedMemoryArena : public MemoryArena
+{
+public:
+    FixedMemoryArena() : MemoryArena(mStorage, N) {}
+
+private:
+    alignas(MemoryArena::kAlignment) uint8_t mStorage[N];
+};
+
+/**
+ * Makes an arena the current arena of the thread, see Current(), for the lifetime of the object.  When the scope ends, the
+ * allocations made from the arena within it are released and the previous arena, if any, becomes current again.
+ *
+ * Subsystems opt into arenas by taking their temporary buffers from Current() when it is set, and the code driving the request
+ * decides whether to provide an arena:
+ *
+ *  @code
+ *    Platform::FixedMemoryArena<1024> arena;
+ *    Platform::ScopedMemoryArena scope(arena);
+ *    ReturnErrorOnFailure(EncodeResponse(request, response));
+ *  @endcode
+ *
+ * Without CHIP_SYSTEM_CONFIG_THREAD_LOCAL_STORAGE, the current arena is shared by all the threads, and scopes must only be
+ * installed from the Matter thread.
+ */
+class ScopedMemoryArena
+{
+public:
+    explicit ScopedMemoryArena(MemoryArena & arena);
+    ~ScopedMemoryArena();
+
+    ScopedMemoryArena(const ScopedMemoryArena &)             = delete;
+    ScopedMemoryArena & operator=(const ScopedMemoryArena &) = delete;
+
+    /**
+     * Returns the arena of the innermost scope of the current thread, or nullptr.
+     */
+    static MemoryArena * Current();
+
+private:
+    MemoryArena & mArena;
+    const size_t mInitialUsed;
+    ScopedMemoryArena * const mPrevious;
+};
+
+} // namespace Platform
+} // namespace chip
@@ -0,0 +1,132 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/CHIPMemTracking.h>
+
+#if CHIP_CONFIG_MEMORY_TRACKING
+#include <atomic>
+#endif // CHIP_CONFIG_MEMORY_TRACKING
+
+namespace chip {
+namespace Platform {
+
+namespace {
+
+const char * const kMemoryTagLabels[kMemoryTagCount] = {
+#define _CHIP_MEMORY_TAG_LABEL(name, label) label,
+    CHIP_MEMORY_TAGS(_CHIP_MEMORY_TAG_LABEL)
+#undef _CHIP_MEMORY_TAG_LABEL
+};
+
+#if CHIP_CONFIG_MEMORY_TRACKING
+
+// The accounting runs on every allocation from any thread, so the counters are relaxed atomics rather than lock-protected.
+struct TagCounters
+{
+    std::atomic<size_t> liveBytes{ 0 };
+    std::atomic<size_t> peakBytes{ 0 };
+    std::atomic<size_t> liveAllocations{ 0 };
+    std::atomic<uint64_t> allocationCount{ 0 };
+};
+
+TagCounters sTagCounters[kMemoryTagCount];
+
+#if CHIP_SYSTEM_CONFIG_THREAD_LOCAL_STORAGE
+thread_local MemoryTag tCurrentTag = MemoryTag::kUntagged;
+#else  // CHIP_SYSTEM_CONFIG_THREAD_LOCAL_STORAGE
+MemoryTag tCurrentTag = MemoryTag::kUntagged;
+#endif // CHIP_SYSTEM_CONFIG_THREAD_LOCAL_STORAGE
+
+void RaisePeak(TagCounters & counters, size_t liveBytes)
+{
+    size_t peak = counters.peakBytes.load(std::memory_order_relaxed);
+    while (liveBytes > peak && !counters.peakBytes.compare_exchange_weak(peak, liveBytes, std::memory_order_relaxed))
+    {
+    }
+}
+
+#endif // CHIP_CONFIG_MEMORY_TRACKING
+
+} // namespace
+
+const char * MemoryTagLabel(MemoryTag tag)
+{
+    const size_t index = static_cast<size_t>(tag);
+    return (index < kMemoryTagCount) ? kMemoryTagLabels[index] : "unknown";
+}
+
+#if CHIP_CONFIG_MEMORY_TRACKING
+
+ScopedMemoryTag::ScopedMemoryTag(MemoryTag tag) : mPreviousTag(tCurrentTag)
+{
+    tCurrentTag = tag;
+}
+
+ScopedMemoryTag::~ScopedMemoryTag()
+{
+    tCurrentTag = mPreviousTag;
+}
+
+MemoryTag ScopedMemoryTag::Current()
+{
+    return tCurrentTag;
+}
+
+MemoryTagStats GetMemoryTagStats(MemoryTag tag)
+{
+    const TagCounters & counters = sTagCounters[static_cast<size_t>(tag)];
+
+    MemoryTagStats stats;
+    stats.liveBytes       = counters.liveBytes.load(std::memory_order_relaxed);
+    stats.peakBytes       = counters.peakBytes.load(std::memory_order_relaxed);
+    stats.liveAllocations = counters.liveAllocations.load(std::memory_order_relaxed);
+    stats.allocationCount = counters.allocationCount.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void ResetMemoryTagPeaks()
+{
+    for (TagCounters & counters : sTagCounters)
+    {
+        counters.peakBytes.store(counters.liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+namespace Internal {
+
+void RecordMemoryAllocation(MemoryTag tag, size_t size)
+{
+    TagCounters & counters = sTagCounters[static_cast<size_t>(tag)];
+    counters.allocationCount.fetch_add(1, std::memory_order_relaxed);
+    counters.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+    RaisePeak(counters, counters.liveBytes.fetch_add(size, std::memory_order_relaxed) + size);
+}
+
+void RecordMemoryFree(MemoryTag tag, size_t size)
+{
+    TagCounters & counters = sTagCounters[static_cast<size_t>(tag)];
+    counters.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+    counters.liveBytes.fetch_sub(size, std::memory_order_relaxed);
+}
+
+} // namespace Internal
+
+#endif // CHIP_CONFIG_MEMORY_TRACKING
+
+} // namespace Platform
+} // namespace chip
@@ -0,0 +1,157 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the attribution of chip::Platform heap allocations to
+ *      subsystems, see CHIP_CONFIG_MEMORY_TRACKING.
+ *
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Platform {
+
+/**
+ * The memory tags, as (name, label) pairs.  Labels are short lowercase identifiers, suitable for metric keys.
+ */
+#define CHIP_MEMORY_TAGS(X)                                                                                                        \
+    X(Untagged, "untagged")                                                                                                        \
+    X(InteractionModel, "im")                                                                                                      \
+    X(Reporting, "reporting")                                                                                                      \
+    X(SecureChannel, "secure_channel")                                                                                             \
+    X(Crypto, "crypto")                                                                                                            \
+    X(Transport, "transport")                                                                                                      \
+    X(Dnssd, "dnssd")                                                                                                              \
+    X(Application, "app")
+
+/**
+ * Subsystem that allocations are attributed to, see ScopedMemoryTag.
+ */
+enum class MemoryTag : uint8_t
+{
+#define _CHIP_MEMORY_TAG_ENUM(name, label) k##name,
+    CHIP_MEMORY_TAGS(_CHIP_MEMORY_TAG_ENUM)
+#undef _CHIP_MEMORY_TAG_ENUM
+};
+
+#define _CHIP_MEMORY_TAG_COUNT(name, label) +1
+constexpr size_t kMemoryTagCount = 0 CHIP_MEMORY_TAGS(_CHIP_MEMORY_TAG_COUNT);
+#undef _CHIP_MEMORY_TAG_COUNT
+
+/**
+ * Statistics of the allocations of a tag.  The byte counts are the requested sizes, excluding the allocator overhead.
+ */
+struct MemoryTagStats
+{
+    size_t liveBytes         = 0; ///< Bytes currently allocated
+    size_t peakBytes         = 0; ///< Highest liveBytes since the last ResetMemoryTagPeaks()
+    size_t liveAllocations   = 0; ///< Blocks currently allocated
+    uint64_t allocationCount = 0; ///< Allocations made since startup, including reallocations
+};
+
+/**
+ * Returns the label of a tag, e.g. "im".
+ */
+const char * MemoryTagLabel(MemoryTag tag);
+
+#if CHIP_CONFIG_MEMORY_TRACKING
+
+/**
+ * Attributes the allocations made by the current thread to `tag` for the lifetime of the object.  Scopes nest, the innermost
+ * tag wins.  A reallocated block keeps the tag it was first allocated with.
+ *
+ *  Example usage:
+ *
+ *  @code
+ *    CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
+ *    {
+ *        Platform::ScopedMemoryTag memoryTag(Platform::MemoryTag::kReporting);
+ *        ...
+ *  @endcode
+ *
+ * Without CHIP_SYSTEM_CONFIG_THREAD_LOCAL_STORAGE, the tag is shared by all the threads, so the allocations that other threads
+ * make while a scope is active are attributed to its tag.
+ */
+class ScopedMemoryTag
+{
+public:
+    explicit ScopedMemoryTag(MemoryTag tag);
+    ~ScopedMemoryTag();
+
+    ScopedMemoryTag(const ScopedMemoryTag &)             = delete;
+    ScopedMemoryTag & operator=(const ScopedMemoryTag &) = delete;
+
+    /**
+     * Returns the tag of the allocations made by the current thread.
+     */
+    static MemoryTag Current();
+
+private:
+    MemoryTag mPreviousTag;
+};
+
+/**
+ * Returns a snapshot of the statistics of `tag`.  The fields are read one at a time, so a snapshot taken while other threads
+ * allocate may be slightly inconsistent.
+ */
+MemoryTagStats GetMemoryTagStats(MemoryTag tag);
+
+/**
+ * Restarts the peak of every tag from its current live bytes, e.g. to measure the peak of a single operation.
+ */
+void ResetMemoryTagPeaks();
+
+namespace Internal {
+
+// Accounting hooks for the memory allocator backends.
+void RecordMemoryAllocation(MemoryTag tag, size_t size);
+void RecordMemoryFree(MemoryTag tag, size_t size);
+
+} // namespace Internal
+
+#else // CHIP_CONFIG_MEMORY_TRACKING
+
+class ScopedMemoryTag
+{
+public:
+    explicit ScopedMemoryTag(MemoryTag tag) {}
+
+    ScopedMemoryTag(const ScopedMemoryTag &)             = delete;
+    ScopedMemoryTag & operator=(const ScopedMemoryTag &) = delete;
+
+    static MemoryTag Current() { return MemoryTag::kUntagged; }
+};
+
+inline MemoryTagStats GetMemoryTagStats(MemoryTag tag)
+{
+    return MemoryTagStats();
+}
+
+inline void ResetMemoryTagPeaks() {}
+
+#endif // CHIP_CONFIG_MEMORY_TRACKING
+
+} // namespace Platform
+} // namespace chip
@@ -0,0 +1,92 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/CounterLeaseStore.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+
+namespace chip {
+
+namespace {
+
+CHIP_ERROR GetStorageKey(CounterLeaseStore::Slot slot, StorageKeyName & key)
+{
+    switch (slot)
+    {
+    case CounterLeaseStore::Slot::kEventNumber:
+        key = DefaultStorageKeyAllocator::IMEventNumber();
+        return CHIP_NO_ERROR;
+    case CounterLeaseStore::Slot::kGroupDataCounter:
+        key = DefaultStorageKeyAllocator::GroupDataCounter();
+        return CHIP_NO_ERROR;
+    case CounterLeaseStore::Slot::kGroupControlCounter:
+        key = DefaultStorageKeyAllocator::GroupControlCounter();
+        return CHIP_NO_ERROR;
+    }
+    return CHIP_ERROR_INVALID_ARGUMENT;
+}
+
+} // namespace
+
+CHIP_ERROR PersistentStorageCounterLeaseStore::ReadLeaseEnd(Slot slot, uint64_t & leaseEnd)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    StorageKeyName key = StorageKeyName::Uninitialized();
+    ReturnErrorOnFailure(GetStorageKey(slot, key));
+
+    if (slot == Slot::kEventNumber)
+    {
+        // Stored little-endian by PersistedCounter<EventNumber>.
+        uint64_t valueLE = 0;
+        uint16_t size    = sizeof(valueLE);
+        ReturnErrorOnFailure(mStorage->SyncGetKeyValue(key.KeyName(), &valueLE, size));
+        VerifyOrReturnError(size == sizeof(valueLE), CHIP_ERROR_INCORRECT_STATE);
+        leaseEnd = Encoding::LittleEndian::HostSwap64(valueLE);
+        return CHIP_NO_ERROR;
+    }
+
+    // Stored in host order by GroupOutgoingCounters.
+    uint32_t value = 0;
+    uint16_t size  = sizeof(value);
+    ReturnErrorOnFailure(mStorage->SyncGetKeyValue(key.KeyName(), &value, size));
+    VerifyOrReturnError(size == sizeof(value), CHIP_ERROR_INCORRECT_STATE);
+    leaseEnd = value;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PersistentStorageCounterLeaseStore::StoreLeaseEnd(Slot slot, uint64_t leaseEnd)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    StorageKeyName key = StorageKeyName::Uninitialized();
+    ReturnErrorOnFailure(GetStorageKey(slot, key));
+
+    if (slot == Slot::kEventNumber)
+    {
+        uint64_t valueLE = Encoding::LittleEndian::HostSwap64(leaseEnd);
+        return mStorage->SyncSetKeyValue(key.KeyName(), &valueLE, sizeof(valueLE));
+    }
+
+    uint32_t value = static_cast<uint32_t>(leaseEnd);
+    return mStorage->SyncSetKeyValue(key.KeyName(), &value, sizeof(value));
+}
+
+} // namespace chip
@@ -0,0 +1,126 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * @brief
+ *   Storage interface for the lease ranges reserved by counters that must never
+ *   repeat a value across reboots, see LeasedCounter.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+
+#include <cstdint>
+
+namespace chip {
+
+/**
+ * @class CounterLeaseStore
+ *
+ * @brief
+ *   Persists, for each well-known counter, the end of the range of values the
+ *   counter has reserved (its lease).  After a reboot the counter resumes at the
+ *   stored lease end, so any value it may have vended before is skipped.
+ *
+ *   Implementations may complete RenewLeaseEnd() asynchronously, so that the
+ *   storage write does not block the Matter thread while the counter keeps
+ *   vending values from the part of its lease that is already durable.
+ */
+class CounterLeaseStore
+{
+public:
+    /// Counters whose leases are persisted.  The values are stable, they identify the counter in storage.
+    enum class Slot : uint8_t
+    {
+        kEventNumber         = 0, ///< Interaction Model event numbers
+        kGroupDataCounter    = 1, ///< Outgoing group data message counter
+        kGroupControlCounter = 2, ///< Outgoing group control message counter
+    };
+
+    static constexpr uint8_t kSlotCount = 3;
+
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() = default;
+
+        /**
+         * Called on the Matter thread once a renewal requested through RenewLeaseEnd() is durable (or failed).  `leaseEnd` is
+         * the lease end now stored for the slot, which is the most recent one requested for it.
+         */
+        virtual void OnLeaseRenewed(Slot slot, uint64_t leaseEnd, CHIP_ERROR err) = 0;
+    };
+
+    virtual ~CounterLeaseStore() = default;
+
+    /**
+     * Reads the lease end stored for `slot`.
+     *
+     * @return CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND if no lease was ever stored for the slot.
+     */
+    virtual CHIP_ERROR ReadLeaseEnd(Slot slot, uint64_t & leaseEnd) = 0;
+
+    /// Stores the lease end of `slot`, and only returns once it is durable.
+    virtual CHIP_ERROR StoreLeaseEnd(Slot slot, uint64_t leaseEnd) = 0;
+
+    /**
+     * Requests the lease end of `slot` to be stored, and reports completion to `delegate` through OnLeaseRenewed().
+     *
+     * The default implementation stores the lease synchronously and reports completion before returning.
+     *
+     * @return An error if the renewal could not be requested, in which case the delegate is not called.
+     */
+    virtual CHIP_ERROR RenewLeaseEnd(Slot slot, uint64_t leaseEnd, Delegate & delegate)
+    {
+        delegate.OnLeaseRenewed(slot, leaseEnd, StoreLeaseEnd(slot, leaseEnd));
+        return CHIP_NO_ERROR;
+    }
+
+    /// Drops the pending completions for `delegate`, which must be called before the delegate is destroyed.
+    virtual void CancelRenewals(Delegate &) {}
+};
+
+/**
+ * @class PersistentStorageCounterLeaseStore
+ *
+ * @brief
+ *   Keeps the counter leases in a PersistentStorageDelegate, under the keys and
+ *   in the formats used by PersistedCounter (event numbers) and
+ *   GroupOutgoingCounters (group message counters).  All the writes are
+ *   synchronous.
+ */
+class PersistentStorageCounterLeaseStore : public CounterLeaseStore
+{
+public:
+    PersistentStorageCounterLeaseStore() = default;
+    explicit PersistentStorageCounterLeaseStore(PersistentStorageDelegate * storage) : mStorage(storage) {}
+
+    void SetStorageDelegate(PersistentStorageDelegate * storage) { mStorage = storage; }
+
+    CHIP_ERROR ReadLeaseEnd(Slot slot, uint64_t & leaseEnd) override;
+    CHIP_ERROR StoreLeaseEnd(Slot slot, uint64_t leaseEnd) override;
+
+private:
+    PersistentStorageDelegate * mStorage = nullptr;
+};
+
+} // namespace chip
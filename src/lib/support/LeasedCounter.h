@@ -0,0 +1,210 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * @brief
+ *   A monotonically-increasing counter that reserves ranges of values in a
+ *   CounterLeaseStore and renews them ahead of exhaustion.
+ */
+
+#pragma once
+
+#include <lib/support/CHIPCounter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/CounterLeaseStore.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <type_traits>
+
+namespace chip {
+
+/**
+ * @class LeasedCounter
+ *
+ * @brief
+ *   A counter that never repeats a value across reboots, like PersistedCounter,
+ *   without writing to storage on the path that advances it.
+ *
+ * The counter only vends values below its lease end, which is durable in the
+ * store.  Once less than half of the lease is left, a new lease starting at the
+ * current value is requested through CounterLeaseStore::RenewLeaseEnd(), which
+ * the store may complete in the background while the counter keeps advancing
+ * through the rest of the current lease.  Only a counter that runs through its
+ * whole lease before the renewal completes stores a lease synchronously.
+ *
+ * Example, with a lease of 100 and a store completing renewals immediately:
+ *
+ *   - Output: 0, 1, ..., 50 (lease renewed up to 150), 51, 52 <reboot/reinit>
+ *   - Output: 150, 151, ...
+ *
+ * The counter wraps around like MonotonicallyIncreasingCounter.
+ */
+template <typename T>
+class LeasedCounter : public MonotonicallyIncreasingCounter<T>, private CounterLeaseStore::Delegate
+{
+    static_assert(std::is_unsigned<T>::value, "LeasedCounter relies on unsigned wrap-around");
+
+public:
+    LeasedCounter() = default;
+    ~LeasedCounter() override { Shutdown(); }
+
+    /**
+     *  @brief
+     *    Initialize a LeasedCounter object, and reserve its first lease.
+     *
+     *  @param[in] aStore         The store of the counter leases.
+     *  @param[in] aSlot          The slot of this counter in the store.
+     *  @param[in] aLeaseSize     The number of values reserved by each lease.
+     *  @param[in] aInitialValue  The value to start from if no lease was ever stored.
+     *
+     *  @return CHIP_ERROR_INVALID_INTEGER_VALUE if aLeaseSize is less than 2,
+     *          any error returned by the store otherwise.
+     */
+    CHIP_ERROR Init(CounterLeaseStore & aStore, CounterLeaseStore::Slot aSlot, T aLeaseSize, T aInitialValue = 0)
+    {
+        VerifyOrReturnError(aLeaseSize >= 2, CHIP_ERROR_INVALID_INTEGER_VALUE);
+
+        Shutdown();
+
+        T startValue      = aInitialValue;
+        uint64_t leaseEnd = 0;
+        CHIP_ERROR err    = aStore.ReadLeaseEnd(aSlot, leaseEnd);
+        if (err == CHIP_NO_ERROR)
+        {
+            startValue = static_cast<T>(leaseEnd);
+        }
+        else if (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+        {
+            return err;
+        }
+
+        // The first lease must be durable before any value is vended.
+        const T firstLeaseEnd = static_cast<T>(startValue + aLeaseSize);
+        ReturnErrorOnFailure(aStore.StoreLeaseEnd(aSlot, firstLeaseEnd));
+
+        mStore     = &aStore;
+        mSlot      = aSlot;
+        mLeaseSize = aLeaseSize;
+        mLeaseEnd  = firstLeaseEnd;
+
+        return MonotonicallyIncreasingCounter<T>::Init(startValue);
+    }
+
+    /**
+     *  @brief
+     *    Detach the counter from its store, cancelling any pending renewal.
+     *
+     *  Must be called before the store is shut down or destroyed.  The counter
+     *  cannot advance again until it is re-initialized.
+     */
+    void Shutdown()
+    {
+        if (mStore != nullptr)
+        {
+            mStore->CancelRenewals(*this);
+        }
+        mStore          = nullptr;
+        mRenewalPending = false;
+    }
+
+    /**
+     *  @brief Increment the counter, and renew the lease if it is running low.
+     *
+     *  @return Any error returned by a synchronous store of the lease, when the
+     *          lease ran out before it could be renewed.
+     */
+    CHIP_ERROR Advance() override { return AdvanceBy(1); }
+
+    /**
+     *  @brief Increment the counter by N, and renew the lease if it is running low.
+     *
+     *  @param value value of N
+     *
+     *  @return Any error returned by a synchronous store of the lease, when the
+     *          lease ran out before it could be renewed.
+     */
+    CHIP_ERROR AdvanceBy(T value) override
+    {
+        VerifyOrReturnError(mStore != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+        // If value is 0, we do not need to do anything
+        VerifyOrReturnError(value > 0, CHIP_NO_ERROR);
+
+        const T remaining = Remaining(mLeaseEnd);
+        ReturnErrorOnFailure(MonotonicallyIncreasingCounter<T>::AdvanceBy(value));
+
+        if (value >= remaining)
+        {
+            // The lease is exhausted: values past its end may only be vended once a new lease is durable.
+            ChipLogProgress(Support, "Counter %u ran out of its lease before renewal, storing a new one synchronously",
+                            static_cast<unsigned>(mSlot));
+            const T leaseEnd = static_cast<T>(this->GetValue() + mLeaseSize);
+            ReturnErrorOnFailure(mStore->StoreLeaseEnd(mSlot, leaseEnd));
+            mLeaseEnd       = leaseEnd;
+            mRenewalPending = false;
+            return CHIP_NO_ERROR;
+        }
+
+        if (!mRenewalPending && (remaining - value) <= mLeaseSize / 2)
+        {
+            mRenewalPending = true;
+            CHIP_ERROR err  = mStore->RenewLeaseEnd(mSlot, static_cast<T>(this->GetValue() + mLeaseSize), *this);
+            if (err != CHIP_NO_ERROR)
+            {
+                // The current lease is still valid, the renewal is retried on the next advance.
+                ChipLogError(Support, "Failed to request a lease for counter %u: %" CHIP_ERROR_FORMAT,
+                             static_cast<unsigned>(mSlot), err.Format());
+                mRenewalPending = false;
+            }
+        }
+
+        return CHIP_NO_ERROR;
+    }
+
+private:
+    // Number of values left in a lease ending at `leaseEnd`, which only is meaningful for leases covering the current value.
+    T Remaining(T leaseEnd) { return static_cast<T>(leaseEnd - this->GetValue()); }
+
+    void OnLeaseRenewed(CounterLeaseStore::Slot slot, uint64_t leaseEnd, CHIP_ERROR err) override
+    {
+        mRenewalPending = false;
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Support, "Failed to renew the lease of counter %u: %" CHIP_ERROR_FORMAT, static_cast<unsigned>(slot),
+                         err.Format());
+            return;
+        }
+
+        // Only move forward: a synchronous store may already have moved the lease past the renewed one.
+        const T renewedRemaining = Remaining(static_cast<T>(leaseEnd));
+        if (renewedRemaining > Remaining(mLeaseEnd) && renewedRemaining <= mLeaseSize)
+        {
+            mLeaseEnd = static_cast<T>(leaseEnd);
+        }
+    }
+
+    CounterLeaseStore * mStore    = nullptr;
+    CounterLeaseStore::Slot mSlot = CounterLeaseStore::Slot::kEventNumber;
+    T mLeaseSize                  = 0;
+    T mLeaseEnd                   = 0; // first value not covered by the durable lease
+    bool mRenewalPending          = false;
+};
+
+} // namespace chip
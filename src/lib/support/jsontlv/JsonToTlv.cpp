@@ -16,15 +16,18 @@
  */
 
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include <algorithm>
 #include <charconv>
-#include <sstream>
+#include <cmath>
+#include <limits>
 #include <string>
 #include <vector>
 
-#include <json/json.h>
 #include <lib/support/Base64.h>
+#include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/jsontlv/ElementTypes.h>
 #include <lib/support/jsontlv/JsonToTlv.h>
@@ -38,61 +41,611 @@ namespace {
 // This profile, but will be used for deciding what binary values to encode.
 constexpr uint32_t kTemporaryImplicitProfileId = 0xFF01;
 
-std::vector<std::string> SplitIntoFieldsBySeparator(const std::string & input, char separator)
+// Deepest nesting of JSON values accepted, the root value being at depth 1.
+constexpr size_t kMaxJsonNestingDepth = 1000;
+
+enum class JsonTokenType : uint8_t
+{
+    kNull,
+    kBoolean,
+    kSignedInteger,
+    kUnsignedInteger,
+    kReal,
+    kString,
+    kObject,
+    kArray,
+};
+
+/*
+ * A JSON value, as found by JsonParser. The tokens of a document are stored in document order, so an object
+ * is followed by a key string and a value for each of its members, and an array by each of its elements.
+ */
+struct JsonToken
+{
+    JsonTokenType type = JsonTokenType::kNull;
+
+    // Strings without escape sequences are located in the JSON text, the others in the unescaped strings buffer.
+    bool unescaped = false;
+    size_t offset  = 0;
+
+    // Length of a string, or number of members or elements of an object or array.
+    size_t size = 0;
+
+    // Index of the token that follows this value and everything it contains.
+    size_t next = 0;
+
+    union
+    {
+        bool boolean;
+        int64_t signedInteger;
+        uint64_t unsignedInteger;
+        double real;
+    } value = {};
+
+    // Conversions with the same semantics as the Json::Value ones.
+    bool IsNumeric() const
+    {
+        return type == JsonTokenType::kSignedInteger || type == JsonTokenType::kUnsignedInteger || type == JsonTokenType::kReal;
+    }
+
+    bool IsUInt64() const
+    {
+        switch (type)
+        {
+        case JsonTokenType::kSignedInteger:
+            return value.signedInteger >= 0;
+        case JsonTokenType::kUnsignedInteger:
+            return true;
+        case JsonTokenType::kReal:
+            return value.real >= 0 && value.real < 18446744073709551616.0 && IsIntegral(value.real);
+        default:
+            return false;
+        }
+    }
+
+    bool IsInt64() const
+    {
+        switch (type)
+        {
+        case JsonTokenType::kSignedInteger:
+            return true;
+        case JsonTokenType::kUnsignedInteger:
+            return value.unsignedInteger <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+        case JsonTokenType::kReal:
+            return value.real >= -9223372036854775808.0 && value.real < 9223372036854775808.0 && IsIntegral(value.real);
+        default:
+            return false;
+        }
+    }
+
+    uint64_t AsUInt64() const
+    {
+        switch (type)
+        {
+        case JsonTokenType::kSignedInteger:
+            return static_cast<uint64_t>(value.signedInteger);
+        case JsonTokenType::kReal:
+            return static_cast<uint64_t>(value.real);
+        default:
+            return value.unsignedInteger;
+        }
+    }
+
+    int64_t AsInt64() const
+    {
+        switch (type)
+        {
+        case JsonTokenType::kUnsignedInteger:
+            return static_cast<int64_t>(value.unsignedInteger);
+        case JsonTokenType::kReal:
+            return static_cast<int64_t>(value.real);
+        default:
+            return value.signedInteger;
+        }
+    }
+
+    template <typename T>
+    T AsFloatingPoint() const
+    {
+        switch (type)
+        {
+        case JsonTokenType::kSignedInteger:
+            return static_cast<T>(value.signedInteger);
+        case JsonTokenType::kUnsignedInteger:
+            return static_cast<T>(value.unsignedInteger);
+        default:
+            return static_cast<T>(value.real);
+        }
+    }
+
+private:
+    static bool IsIntegral(double d)
+    {
+        double integralPart;
+        return modf(d, &integralPart) == 0.0;
+    }
+};
+
+/*
+ * Tokenizes a JSON document into a flat list of JsonToken, without building a tree of values.
+ *
+ * The accepted syntax is the one of Json::Reader: comments are allowed where a value, a member name or a
+ * separator may appear, and anything after the root value is ignored.
+ */
+class JsonParser
 {
-    std::vector<std::string> substrings;
-    std::stringstream ss(input);
-    std::string substring;
+public:
+    JsonParser(const std::string & json, std::vector<JsonToken> & tokens, std::string & unescapedStrings) :
+        mBegin(json.data()), mPos(json.data()), mEnd(json.data() + json.size()), mTokens(tokens),
+        mUnescapedStrings(unescapedStrings)
+    {}
+
+    /*
+     * Tokenizes the root value. Any syntax error is reported as CHIP_ERROR_INTERNAL.
+     */
+    CHIP_ERROR Parse() { return ParseValue(1) ? CHIP_NO_ERROR : CHIP_ERROR_INTERNAL; }
+
+private:
+    bool ParseValue(size_t depth);
+    bool ParseObject(size_t depth);
+    bool ParseArray(size_t depth);
+    bool ParseString();
+    bool ParseNumber();
+    bool DecodeString(const char * current, const char * end);
+    bool DecodeUnicodeEscapeSequence(const char *& current, const char * end, uint32_t & codeUnit);
+    bool SkipSpacesAndComments();
 
-    while (std::getline(ss, substring, separator))
+    void SkipSpaces()
     {
-        substrings.push_back(std::move(substring));
+        while (mPos != mEnd && (*mPos == ' ' || *mPos == '\t' || *mPos == '\r' || *mPos == '\n'))
+        {
+            mPos++;
+        }
+    }
+
+    bool Consume(char c)
+    {
+        VerifyOrReturnValue(mPos != mEnd && *mPos == c, false);
+        mPos++;
+        return true;
+    }
+
+    bool ConsumeLiteral(const char * literal, size_t length)
+    {
+        VerifyOrReturnValue(static_cast<size_t>(mEnd - mPos) >= length && memcmp(mPos, literal, length) == 0, false);
+        mPos += length;
+        return true;
     }
 
-    return substrings;
+    JsonToken & AddToken(JsonTokenType type)
+    {
+        JsonToken & token = mTokens.emplace_back();
+        token.type        = type;
+        token.next        = mTokens.size();
+        return token;
+    }
+
+    const char * const mBegin;
+    const char * mPos;
+    const char * const mEnd;
+    std::vector<JsonToken> & mTokens;
+    std::string & mUnescapedStrings;
+};
+
+bool JsonParser::SkipSpacesAndComments()
+{
+    while (true)
+    {
+        SkipSpaces();
+        if (mEnd - mPos < 2 || *mPos != '/')
+        {
+            return true;
+        }
+
+        if (mPos[1] == '*')
+        {
+            const char * commentEnd = mPos + 2;
+            while (mEnd - commentEnd >= 2 && !(commentEnd[0] == '*' && commentEnd[1] == '/'))
+            {
+                commentEnd++;
+            }
+            VerifyOrReturnValue(mEnd - commentEnd >= 2, false);
+            mPos = commentEnd + 2;
+        }
+        else if (mPos[1] == '/')
+        {
+            while (mPos != mEnd && *mPos != '\n' && *mPos != '\r')
+            {
+                mPos++;
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
 }
 
-CHIP_ERROR JsonTypeStrToTlvType(const char * elementType, ElementTypeContext & type)
+bool JsonParser::ParseValue(size_t depth)
 {
-    if (strcmp(elementType, kElementTypeInt) == 0)
+    VerifyOrReturnValue(depth <= kMaxJsonNestingDepth, false);
+    VerifyOrReturnValue(SkipSpacesAndComments() && mPos != mEnd, false);
+
+    switch (*mPos)
+    {
+    case '{':
+        mPos++;
+        return ParseObject(depth);
+    case '[':
+        mPos++;
+        return ParseArray(depth);
+    case '"':
+        mPos++;
+        return ParseString();
+    case 't':
+        VerifyOrReturnValue(ConsumeLiteral("true", 4), false);
+        AddToken(JsonTokenType::kBoolean).value.boolean = true;
+        return true;
+    case 'f':
+        VerifyOrReturnValue(ConsumeLiteral("false", 5), false);
+        AddToken(JsonTokenType::kBoolean).value.boolean = false;
+        return true;
+    case 'n':
+        VerifyOrReturnValue(ConsumeLiteral("null", 4), false);
+        AddToken(JsonTokenType::kNull);
+        return true;
+    default:
+        VerifyOrReturnValue(*mPos == '-' || (*mPos >= '0' && *mPos <= '9'), false);
+        return ParseNumber();
+    }
+}
+
+bool JsonParser::ParseObject(size_t depth)
+{
+    const size_t index = mTokens.size();
+    size_t members     = 0;
+    AddToken(JsonTokenType::kObject);
+
+    VerifyOrReturnValue(SkipSpacesAndComments(), false);
+    if (!Consume('}'))
+    {
+        while (true)
+        {
+            VerifyOrReturnValue(Consume('"') && ParseString(), false);
+            SkipSpaces();
+            VerifyOrReturnValue(Consume(':'), false);
+            VerifyOrReturnValue(ParseValue(depth + 1), false);
+            members++;
+
+            VerifyOrReturnValue(SkipSpacesAndComments(), false);
+            if (Consume('}'))
+            {
+                break;
+            }
+            VerifyOrReturnValue(Consume(',') && SkipSpacesAndComments(), false);
+        }
+    }
+
+    mTokens[index].size = members;
+    mTokens[index].next = mTokens.size();
+    return true;
+}
+
+bool JsonParser::ParseArray(size_t depth)
+{
+    const size_t index = mTokens.size();
+    size_t elements    = 0;
+    AddToken(JsonTokenType::kArray);
+
+    SkipSpaces();
+    if (!Consume(']'))
+    {
+        while (true)
+        {
+            VerifyOrReturnValue(ParseValue(depth + 1), false);
+            elements++;
+
+            VerifyOrReturnValue(SkipSpacesAndComments(), false);
+            if (Consume(']'))
+            {
+                break;
+            }
+            VerifyOrReturnValue(Consume(','), false);
+        }
+    }
+
+    mTokens[index].size = elements;
+    mTokens[index].next = mTokens.size();
+    return true;
+}
+
+bool JsonParser::ParseString()
+{
+    const char * start = mPos;
+    bool hasEscapes    = false;
+
+    while (true)
+    {
+        VerifyOrReturnValue(mPos != mEnd, false);
+        char c = *mPos++;
+        if (c == '"')
+        {
+            break;
+        }
+        if (c == '\\')
+        {
+            VerifyOrReturnValue(mPos != mEnd, false);
+            hasEscapes = true;
+            mPos++;
+        }
+    }
+
+    const char * end  = mPos - 1;
+    JsonToken & token = AddToken(JsonTokenType::kString);
+    if (!hasEscapes)
+    {
+        token.offset = static_cast<size_t>(start - mBegin);
+        token.size   = static_cast<size_t>(end - start);
+        return true;
+    }
+
+    token.unescaped = true;
+    token.offset    = mUnescapedStrings.size();
+    VerifyOrReturnValue(DecodeString(start, end), false);
+    token.size = mUnescapedStrings.size() - token.offset;
+    return true;
+}
+
+bool JsonParser::DecodeString(const char * current, const char * end)
+{
+    while (current != end)
+    {
+        char c = *current++;
+        if (c != '\\')
+        {
+            mUnescapedStrings += c;
+            continue;
+        }
+
+        VerifyOrReturnValue(current != end, false);
+        char escape = *current++;
+        switch (escape)
+        {
+        case '"':
+        case '/':
+        case '\\':
+            mUnescapedStrings += escape;
+            break;
+        case 'b':
+            mUnescapedStrings += '\b';
+            break;
+        case 'f':
+            mUnescapedStrings += '\f';
+            break;
+        case 'n':
+            mUnescapedStrings += '\n';
+            break;
+        case 'r':
+            mUnescapedStrings += '\r';
+            break;
+        case 't':
+            mUnescapedStrings += '\t';
+            break;
+        case 'u': {
+            uint32_t codePoint;
+            VerifyOrReturnValue(DecodeUnicodeEscapeSequence(current, end, codePoint), false);
+            if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+            {
+                // Surrogate pair: the low surrogate has to follow as another \u escape.
+                uint32_t lowSurrogate;
+                VerifyOrReturnValue(end - current >= 6 && current[0] == '\\' && current[1] == 'u', false);
+                current += 2;
+                VerifyOrReturnValue(DecodeUnicodeEscapeSequence(current, end, lowSurrogate), false);
+                codePoint = 0x10000 + ((codePoint & 0x3FF) << 10) + (lowSurrogate & 0x3FF);
+            }
+
+            if (codePoint <= 0x7F)
+            {
+                mUnescapedStrings += static_cast<char>(codePoint);
+            }
+            else if (codePoint <= 0x7FF)
+            {
+                mUnescapedStrings += static_cast<char>(0xC0 | (codePoint >> 6));
+                mUnescapedStrings += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+            else if (codePoint <= 0xFFFF)
+            {
+                mUnescapedStrings += static_cast<char>(0xE0 | (codePoint >> 12));
+                mUnescapedStrings += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                mUnescapedStrings += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+            else
+            {
+                mUnescapedStrings += static_cast<char>(0xF0 | (codePoint >> 18));
+                mUnescapedStrings += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                mUnescapedStrings += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                mUnescapedStrings += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+            break;
+        }
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+bool JsonParser::DecodeUnicodeEscapeSequence(const char *& current, const char * end, uint32_t & codeUnit)
+{
+    VerifyOrReturnValue(end - current >= 4, false);
+
+    codeUnit = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        char c = *current++;
+        codeUnit <<= 4;
+        if (c >= '0' && c <= '9')
+        {
+            codeUnit += static_cast<uint32_t>(c - '0');
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            codeUnit += static_cast<uint32_t>(c - 'a' + 10);
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            codeUnit += static_cast<uint32_t>(c - 'A' + 10);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool JsonParser::ParseNumber()
+{
+    auto isDigit = [this]() { return mPos != mEnd && *mPos >= '0' && *mPos <= '9'; };
+
+    // Same extent as the number tokens of Json::Reader: [-]digits[.digits][(e|E)[+|-]digits], where every part
+    // may be empty.
+    const char * start = mPos;
+    Consume('-');
+    while (isDigit())
+    {
+        mPos++;
+    }
+    if (Consume('.'))
+    {
+        while (isDigit())
+        {
+            mPos++;
+        }
+    }
+    if (Consume('e') || Consume('E'))
+    {
+        if (!Consume('+'))
+        {
+            Consume('-');
+        }
+        while (isDigit())
+        {
+            mPos++;
+        }
+    }
+
+    // Integers that fit in 64 bits are kept exact, everything else is converted to a double.
+    const char * current        = start;
+    const bool isNegative       = (*current == '-');
+    const uint64_t maxMagnitude = isNegative ? static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + 1
+                                             : std::numeric_limits<uint64_t>::max();
+    uint64_t magnitude          = 0;
+    bool isInteger              = true;
+
+    if (isNegative)
+    {
+        current++;
+    }
+    while (current < mPos && isInteger)
+    {
+        char c = *current++;
+        if (c < '0' || c > '9')
+        {
+            isInteger = false;
+            break;
+        }
+
+        auto digit = static_cast<uint64_t>(c - '0');
+        if (magnitude >= maxMagnitude / 10 &&
+            (magnitude > maxMagnitude / 10 || current != mPos || digit > maxMagnitude % 10))
+        {
+            isInteger = false;
+            break;
+        }
+        magnitude = magnitude * 10 + digit;
+    }
+
+    if (isInteger)
+    {
+        if (isNegative)
+        {
+            AddToken(JsonTokenType::kSignedInteger).value.signedInteger =
+                (magnitude == maxMagnitude) ? std::numeric_limits<int64_t>::min() : -static_cast<int64_t>(magnitude);
+        }
+        else
+        {
+            AddToken(JsonTokenType::kUnsignedInteger).value.unsignedInteger = magnitude;
+        }
+        return true;
+    }
+
+    // strtod() needs a terminated string.
+    char buffer[64];
+    std::string longNumber;
+    const auto length  = static_cast<size_t>(mPos - start);
+    const char * chars = buffer;
+    if (length < sizeof(buffer))
+    {
+        memcpy(buffer, start, length);
+        buffer[length] = '\0';
+    }
+    else
+    {
+        longNumber.assign(start, length);
+        chars = longNumber.c_str();
+    }
+
+    char * parsedEnd = nullptr;
+    double real      = strtod(chars, &parsedEnd);
+    VerifyOrReturnValue(parsedEnd == chars + length && std::isfinite(real), false);
+
+    AddToken(JsonTokenType::kReal).value.real = real;
+    return true;
+}
+
+CHIP_ERROR JsonTypeStrToTlvType(const CharSpan & elementType, ElementTypeContext & type)
+{
+    if (elementType.data_equal(CharSpan::fromCharString(kElementTypeInt)))
     {
         type.tlvType = TLV::kTLVType_SignedInteger;
     }
-    else if (strcmp(elementType, kElementTypeUInt) == 0)
+    else if (elementType.data_equal(CharSpan::fromCharString(kElementTypeUInt)))
     {
         type.tlvType = TLV::kTLVType_UnsignedInteger;
     }
-    else if (strcmp(elementType, kElementTypeBool) == 0)
+    else if (elementType.data_equal(CharSpan::fromCharString(kElementTypeBool)))
     {
         type.tlvType = TLV::kTLVType_Boolean;
     }
-    else if (strcmp(elementType, kElementTypeFloat) == 0)
+    else if (elementType.data_equal(CharSpan::fromCharString(kElementTypeFloat)))
     {
         type.tlvType  = TLV::kTLVType_FloatingPointNumber;
         type.isDouble = false;
     }
-    else if (strcmp(elementType, kElementTypeDouble) == 0)
+    else if (elementType.data_equal(CharSpan::fromCharString(kElementTypeDouble)))
     {
         type.tlvType  = TLV::kTLVType_FloatingPointNumber;
         type.isDouble = true;
     }
-    else if (strcmp(elementType, kElementTypeBytes) == 0)
+    else if (elementType.data_equal(CharSpan::fromCharString(kElementTypeBytes)))
     {
         type.tlvType = TLV::kTLVType_ByteString;
     }
-    else if (strcmp(elementType, kElementTypeString) == 0)
+    else if (elementType.data_equal(CharSpan::fromCharString(kElementTypeString)))
     {
         type.tlvType = TLV::kTLVType_UTF8String;
     }
-    else if (strcmp(elementType, kElementTypeNull) == 0)
+    else if (elementType.data_equal(CharSpan::fromCharString(kElementTypeNull)))
     {
         type.tlvType = TLV::kTLVType_Null;
     }
-    else if (strcmp(elementType, kElementTypeStruct) == 0)
+    else if (elementType.data_equal(CharSpan::fromCharString(kElementTypeStruct)))
     {
         type.tlvType = TLV::kTLVType_Structure;
     }
-    else if (strncmp(elementType, kElementTypeArray, strlen(kElementTypeArray)) == 0)
+    else if (elementType.size() >= strlen(kElementTypeArray) &&
+             memcmp(elementType.data(), kElementTypeArray, strlen(kElementTypeArray)) == 0)
     {
         type.tlvType = TLV::kTLVType_Array;
     }
@@ -104,14 +657,45 @@ CHIP_ERROR JsonTypeStrToTlvType(const char * elementType, ElementTypeContext & t
     return CHIP_NO_ERROR;
 }
 
+/*
+ * Splits the input into the fields between separators, the way repeated std::getline() calls do: there is
+ * no empty field after a trailing separator. Returns the number of fields, of which the first maxFields are
+ * stored.
+ */
+size_t SplitIntoFieldsBySeparator(const CharSpan & input, char separator, CharSpan * fields, size_t maxFields)
+{
+    size_t count      = 0;
+    const char * next = input.data();
+    const char * end  = input.data() + input.size();
+
+    while (next != end)
+    {
+        auto * separatorPos    = static_cast<const char *>(memchr(next, separator, static_cast<size_t>(end - next)));
+        const char * fieldEnd = (separatorPos != nullptr) ? separatorPos : end;
+        if (count < maxFields)
+        {
+            fields[count] = CharSpan(next, static_cast<size_t>(fieldEnd - next));
+        }
+        count++;
+        next = (separatorPos != nullptr) ? separatorPos + 1 : end;
+    }
+
+    return count;
+}
+
 struct ElementContext
 {
-    std::string jsonName;
     TLV::Tag tag = TLV::AnonymousTag();
     ElementTypeContext type;
     ElementTypeContext subType;
 };
 
+struct ObjectMember
+{
+    ElementContext context;
+    size_t keyIndex; // Token of the member name, followed by the token of the member value.
+};
+
 bool CompareByTag(const ElementContext & a, const ElementContext & b)
 {
     // If tags are of the same type compare by tag number
@@ -149,7 +733,7 @@ CHIP_ERROR InternalConvertTlvTag(uint32_t tagNumber, TLV::Tag & tag, const uint3
 }
 
 template <typename T>
-CHIP_ERROR ParseNumericalField(const std::string & decimalString, T & outValue)
+CHIP_ERROR ParseNumericalField(const CharSpan & decimalString, T & outValue)
 {
     const char * start_ptr       = decimalString.data();
     const char * end_ptr         = decimalString.data() + decimalString.size();
@@ -158,71 +742,112 @@ CHIP_ERROR ParseNumericalField(const std::string & decimalString, T & outValue)
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR ParseJsonName(const std::string & name, ElementContext & elementCtx, uint32_t implicitProfileId)
+CHIP_ERROR ParseJsonName(const CharSpan & name, ElementContext & elementCtx, uint32_t implicitProfileId)
 {
-    uint32_t tagNumber                  = 0;
-    const char * elementType            = nullptr;
-    std::vector<std::string> nameFields = SplitIntoFieldsBySeparator(name, ':');
-    TLV::Tag tag                        = TLV::AnonymousTag();
+    uint32_t tagNumber = 0;
+    CharSpan elementType;
+    CharSpan nameFields[3];
+    TLV::Tag tag = TLV::AnonymousTag();
     ElementTypeContext type;
     ElementTypeContext subType;
 
-    if (nameFields.size() == 2)
+    size_t fieldCount = SplitIntoFieldsBySeparator(name, ':', nameFields, MATTER_ARRAY_SIZE(nameFields));
+    if (fieldCount == 2)
     {
         ReturnErrorOnFailure(ParseNumericalField(nameFields[0], tagNumber));
-        elementType = nameFields[1].c_str();
+        elementType = nameFields[1];
     }
-    else if (nameFields.size() == 3)
+    else if (fieldCount == 3)
     {
         ReturnErrorOnFailure(ParseNumericalField(nameFields[1], tagNumber));
-        elementType = nameFields[2].c_str();
+        elementType = nameFields[2];
     }
     else
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
+    // The element type is compared as a C string.
+    auto * nul = static_cast<const char *>(memchr(elementType.data(), '\0', elementType.size()));
+    if (nul != nullptr)
+    {
+        elementType.reduce_size(static_cast<size_t>(nul - elementType.data()));
+    }
+
     ReturnErrorOnFailure(InternalConvertTlvTag(tagNumber, tag, implicitProfileId));
     ReturnErrorOnFailure(JsonTypeStrToTlvType(elementType, type));
 
     if (type.tlvType == TLV::kTLVType_Array)
     {
-        std::vector<std::string> arrayFields = SplitIntoFieldsBySeparator(elementType, '-');
-        VerifyOrReturnError(arrayFields.size() == 2, CHIP_ERROR_INVALID_ARGUMENT);
+        CharSpan arrayFields[2];
+        VerifyOrReturnError(SplitIntoFieldsBySeparator(elementType, '-', arrayFields, MATTER_ARRAY_SIZE(arrayFields)) == 2,
+                            CHIP_ERROR_INVALID_ARGUMENT);
 
-        if (strcmp(arrayFields[1].c_str(), kElementTypeEmpty) == 0)
+        if (arrayFields[1].data_equal(CharSpan::fromCharString(kElementTypeEmpty)))
         {
             subType.tlvType = TLV::kTLVType_NotSpecified;
         }
         else
         {
-            ReturnErrorOnFailure(JsonTypeStrToTlvType(arrayFields[1].c_str(), subType));
+            ReturnErrorOnFailure(JsonTypeStrToTlvType(arrayFields[1], subType));
         }
     }
 
-    elementCtx.jsonName = name;
-    elementCtx.tag      = tag;
-    elementCtx.type     = type;
-    elementCtx.subType  = subType;
+    elementCtx.tag     = tag;
+    elementCtx.type    = type;
+    elementCtx.subType = subType;
 
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR EncodeTlvElement(const Json::Value & val, TLV::TLVWriter & writer, const ElementContext & elementCtx)
+/*
+ * Encodes tokenized JSON values as TLV elements.
+ *
+ * The members of each JSON object are written in tag order, with the members of the objects being encoded
+ * stacked in a single vector that is reused for the whole document. Only that vector and the buffer of
+ * decoded byte strings allocate memory, and only when they need to grow.
+ */
+class JsonToTlvEncoder
 {
-    TLV::Tag tag = elementCtx.tag;
+public:
+    JsonToTlvEncoder(const std::string & json, const std::vector<JsonToken> & tokens, const std::string & unescapedStrings) :
+        mJson(json), mTokens(tokens), mUnescapedStrings(unescapedStrings)
+    {}
+
+    CHIP_ERROR EncodeTlvElement(size_t index, TLV::TLVWriter & writer, const ElementContext & elementCtx);
+
+private:
+    CHIP_ERROR EncodeStructure(size_t index, TLV::TLVWriter & writer);
+
+    CharSpan GetString(const JsonToken & token) const
+    {
+        const std::string & source = token.unescaped ? mUnescapedStrings : mJson;
+        return CharSpan(source.data() + token.offset, token.size);
+    }
+
+    const std::string & mJson;
+    const std::vector<JsonToken> & mTokens;
+    const std::string & mUnescapedStrings;
+    std::vector<ObjectMember> mMembers;
+    std::vector<uint8_t> mByteString;
+};
+
+CHIP_ERROR JsonToTlvEncoder::EncodeTlvElement(size_t index, TLV::TLVWriter & writer, const ElementContext & elementCtx)
+{
+    const JsonToken & val = mTokens[index];
+    TLV::Tag tag          = elementCtx.tag;
 
     switch (elementCtx.type.tlvType)
     {
     case TLV::kTLVType_UnsignedInteger: {
         uint64_t v = 0;
-        if (val.isUInt64())
+        if (val.IsUInt64())
         {
-            v = val.asUInt64();
+            v = val.AsUInt64();
         }
-        else if (val.isString())
+        else if (val.type == JsonTokenType::kString)
         {
-            ReturnErrorOnFailure(ParseNumericalField(val.asString(), v));
+            ReturnErrorOnFailure(ParseNumericalField(GetString(val), v));
         }
         else
         {
@@ -234,13 +859,13 @@ CHIP_ERROR EncodeTlvElement(const Json::Value & val, TLV::TLVWriter & writer, co
 
     case TLV::kTLVType_SignedInteger: {
         int64_t v = 0;
-        if (val.isInt64())
+        if (val.IsInt64())
         {
-            v = val.asInt64();
+            v = val.AsInt64();
         }
-        else if (val.isString())
+        else if (val.type == JsonTokenType::kString)
         {
-            ReturnErrorOnFailure(ParseNumericalField(val.asString(), v));
+            ReturnErrorOnFailure(ParseNumericalField(GetString(val), v));
         }
         else
         {
@@ -251,28 +876,28 @@ CHIP_ERROR EncodeTlvElement(const Json::Value & val, TLV::TLVWriter & writer, co
     }
 
     case TLV::kTLVType_Boolean: {
-        VerifyOrReturnError(val.isBool(), CHIP_ERROR_INVALID_ARGUMENT);
-        ReturnErrorOnFailure(writer.Put(tag, val.asBool()));
+        VerifyOrReturnError(val.type == JsonTokenType::kBoolean, CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(writer.Put(tag, val.value.boolean));
         break;
     }
 
     case TLV::kTLVType_FloatingPointNumber: {
-        if (val.isNumeric())
+        if (val.IsNumeric())
         {
             if (elementCtx.type.isDouble)
             {
-                ReturnErrorOnFailure(writer.Put(tag, val.asDouble()));
+                ReturnErrorOnFailure(writer.Put(tag, val.AsFloatingPoint<double>()));
             }
             else
             {
-                ReturnErrorOnFailure(writer.Put(tag, val.asFloat()));
+                ReturnErrorOnFailure(writer.Put(tag, val.AsFloatingPoint<float>()));
             }
         }
-        else if (val.isString())
+        else if (val.type == JsonTokenType::kString)
         {
-            const std::string valAsString = val.asString();
-            bool isPositiveInfinity       = (valAsString == kFloatingPointPositiveInfinity);
-            bool isNegativeInfinity       = (valAsString == kFloatingPointNegativeInfinity);
+            const CharSpan valAsString = GetString(val);
+            bool isPositiveInfinity    = valAsString.data_equal(CharSpan::fromCharString(kFloatingPointPositiveInfinity));
+            bool isNegativeInfinity    = valAsString.data_equal(CharSpan::fromCharString(kFloatingPointNegativeInfinity));
             VerifyOrReturnError(isPositiveInfinity || isNegativeInfinity, CHIP_ERROR_INVALID_ARGUMENT);
             if (elementCtx.type.isDouble)
             {
@@ -305,82 +930,61 @@ CHIP_ERROR EncodeTlvElement(const Json::Value & val, TLV::TLVWriter & writer, co
     }
 
     case TLV::kTLVType_ByteString: {
-        VerifyOrReturnError(val.isString(), CHIP_ERROR_INVALID_ARGUMENT);
-        const std::string valAsString = val.asString();
-        size_t encodedLen             = valAsString.length();
+        VerifyOrReturnError(val.type == JsonTokenType::kString, CHIP_ERROR_INVALID_ARGUMENT);
+        const CharSpan valAsString = GetString(val);
+        size_t encodedLen          = valAsString.size();
         VerifyOrReturnError(CanCastTo<uint16_t>(encodedLen), CHIP_ERROR_INVALID_ARGUMENT);
 
         // Check if the length is a multiple of 4 as strict padding is required.
         VerifyOrReturnError(encodedLen % 4 == 0, CHIP_ERROR_INVALID_ARGUMENT);
 
-        Platform::ScopedMemoryBuffer<uint8_t> byteString;
-        byteString.Alloc(BASE64_MAX_DECODED_LEN(static_cast<uint16_t>(encodedLen)));
-        VerifyOrReturnError(byteString.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+        mByteString.resize(BASE64_MAX_DECODED_LEN(static_cast<uint16_t>(encodedLen)));
 
-        auto decodedLen = Base64Decode(valAsString.c_str(), static_cast<uint16_t>(encodedLen), byteString.Get());
+        auto decodedLen = Base64Decode(valAsString.data(), static_cast<uint16_t>(encodedLen), mByteString.data());
         VerifyOrReturnError(decodedLen < UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
-        ReturnErrorOnFailure(writer.PutBytes(tag, byteString.Get(), decodedLen));
+        ReturnErrorOnFailure(writer.PutBytes(tag, mByteString.data(), decodedLen));
         break;
     }
 
     case TLV::kTLVType_UTF8String: {
-        VerifyOrReturnError(val.isString(), CHIP_ERROR_INVALID_ARGUMENT);
-        const std::string valAsString = val.asString();
+        VerifyOrReturnError(val.type == JsonTokenType::kString, CHIP_ERROR_INVALID_ARGUMENT);
+        const CharSpan valAsString = GetString(val);
         ReturnErrorOnFailure(writer.PutString(tag, valAsString.data(), static_cast<uint32_t>(valAsString.size())));
         break;
     }
 
     case TLV::kTLVType_Null: {
-        VerifyOrReturnError(val.isNull(), CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(val.type == JsonTokenType::kNull, CHIP_ERROR_INVALID_ARGUMENT);
         ReturnErrorOnFailure(writer.PutNull(tag));
         break;
     }
 
     case TLV::kTLVType_Structure: {
         TLV::TLVType containerType;
-        VerifyOrReturnError(val.isObject(), CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(val.type == JsonTokenType::kObject, CHIP_ERROR_INVALID_ARGUMENT);
         ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, containerType));
-
-        std::vector<std::string> jsonNames = val.getMemberNames();
-        std::vector<ElementContext> nestedElementsCtx;
-
-        for (size_t i = 0; i < jsonNames.size(); i++)
-        {
-            ElementContext ctx;
-            ReturnErrorOnFailure(ParseJsonName(jsonNames[i], ctx, writer.ImplicitProfileId));
-            nestedElementsCtx.push_back(ctx);
-        }
-
-        // Sort Json object elements by Tag number (low to high).
-        // Note that all sorted Context Tags will appear first followed by all sorted Common Tags.
-        std::sort(nestedElementsCtx.begin(), nestedElementsCtx.end(), CompareByTag);
-
-        for (auto & ctx : nestedElementsCtx)
-        {
-            ReturnErrorOnFailure(EncodeTlvElement(val[ctx.jsonName], writer, ctx));
-        }
-
+        ReturnErrorOnFailure(EncodeStructure(index, writer));
         ReturnErrorOnFailure(writer.EndContainer(containerType));
         break;
     }
 
     case TLV::kTLVType_Array: {
         TLV::TLVType containerType;
-        VerifyOrReturnError(val.isArray(), CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(val.type == JsonTokenType::kArray, CHIP_ERROR_INVALID_ARGUMENT);
         ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Array, containerType));
 
         if (elementCtx.subType.tlvType == TLV::kTLVType_NotSpecified)
         {
-            VerifyOrReturnError(val.size() == 0, CHIP_ERROR_INVALID_ARGUMENT);
+            VerifyOrReturnError(val.size == 0, CHIP_ERROR_INVALID_ARGUMENT);
         }
         else
         {
             ElementContext nestedElementCtx;
             nestedElementCtx.tag  = TLV::AnonymousTag();
             nestedElementCtx.type = elementCtx.subType;
-            for (Json::ArrayIndex i = 0; i < val.size(); i++)
+            for (size_t i = index + 1; i < val.next; i = mTokens[i].next)
             {
-                ReturnErrorOnFailure(EncodeTlvElement(val[i], writer, nestedElementCtx));
+                ReturnErrorOnFailure(EncodeTlvElement(i, writer, nestedElementCtx));
             }
         }
 
@@ -396,6 +1000,58 @@ CHIP_ERROR EncodeTlvElement(const Json::Value & val, TLV::TLVWriter & writer, co
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR JsonToTlvEncoder::EncodeStructure(size_t index, TLV::TLVWriter & writer)
+{
+    const size_t first = mMembers.size();
+
+    // The members of nested objects are stacked above the ones of this object.
+    auto popMembers = ScopeExit([&]() { mMembers.resize(first); });
+
+    for (size_t i = index + 1; i < mTokens[index].next; i = mTokens[i + 1].next)
+    {
+        ObjectMember member;
+        member.keyIndex = i;
+        ReturnErrorOnFailure(ParseJsonName(GetString(mTokens[i]), member.context, writer.ImplicitProfileId));
+        mMembers.push_back(member);
+    }
+
+    // Sort Json object elements by Tag number (low to high).
+    // Note that all sorted Context Tags will appear first followed by all sorted Common Tags.
+    // Members with the same tag number keep the order of their names, and for members with the same name,
+    // the last one in the document is the one that gets encoded.
+    auto nameOf = [this](const ObjectMember & member) { return GetString(mTokens[member.keyIndex]); };
+    std::sort(mMembers.begin() + static_cast<std::ptrdiff_t>(first), mMembers.end(),
+              [&](const ObjectMember & a, const ObjectMember & b) {
+                  if (CompareByTag(a.context, b.context) || CompareByTag(b.context, a.context))
+                  {
+                      return CompareByTag(a.context, b.context);
+                  }
+                  CharSpan aName = nameOf(a);
+                  CharSpan bName = nameOf(b);
+                  int result     = memcmp(aName.data(), bName.data(), std::min(aName.size(), bName.size()));
+                  if (result != 0 || aName.size() != bName.size())
+                  {
+                      return result != 0 ? result < 0 : aName.size() < bName.size();
+                  }
+                  return a.keyIndex < b.keyIndex;
+              });
+
+    const size_t last = mMembers.size();
+    for (size_t i = first; i < last; i++)
+    {
+        if (i + 1 < last && nameOf(mMembers[i]).data_equal(nameOf(mMembers[i + 1])))
+        {
+            continue;
+        }
+
+        // Nested objects may grow the member stack, so nothing may refer to it across EncodeTlvElement().
+        const ObjectMember member = mMembers[i];
+        ReturnErrorOnFailure(EncodeTlvElement(member.keyIndex + 1, writer, member.context));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 } // namespace
 
 CHIP_ERROR JsonToTlv(const std::string & jsonString, MutableByteSpan & tlv)
@@ -411,10 +1067,10 @@ CHIP_ERROR JsonToTlv(const std::string & jsonString, MutableByteSpan & tlv)
 
 CHIP_ERROR JsonToTlv(const std::string & jsonString, TLV::TLVWriter & writer)
 {
-    Json::Reader reader;
-    Json::Value json;
-    bool result = reader.parse(jsonString, json);
-    VerifyOrReturnError(result, CHIP_ERROR_INTERNAL);
+    std::vector<JsonToken> tokens;
+    std::string unescapedStrings;
+    JsonParser parser(jsonString, tokens, unescapedStrings);
+    ReturnErrorOnFailure(parser.Parse());
 
     ElementContext elementCtx;
     elementCtx.type = { TLV::kTLVType_Structure, false };
@@ -427,7 +1083,8 @@ CHIP_ERROR JsonToTlv(const std::string & jsonString, TLV::TLVWriter & writer)
         writer.ImplicitProfileId = kTemporaryImplicitProfileId;
     }
 
-    return EncodeTlvElement(json, writer, elementCtx);
+    JsonToTlvEncoder encoder(jsonString, tokens, unescapedStrings);
+    return encoder.EncodeTlvElement(0, writer, elementCtx);
 }
 
 CHIP_ERROR ConvertTlvTag(uint32_t tagNumber, TLV::Tag & tag)
@@ -15,11 +15,17 @@
  *    limitations under the License.
  */
 
-#include "lib/support/CHIPMemString.h"
-#include "lib/support/ScopedBuffer.h"
-#include <json/json.h>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/Base64.h>
+#include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/jsontlv/ElementTypes.h>
 #include <lib/support/jsontlv/TlvToJson.h>
@@ -77,6 +83,60 @@ const char * GetJsonElementStrFromType(const ElementTypeContext & ctx)
     }
 };
 
+/*
+ * Decodes the UTF-8 sequence starting at `c` and leaves `c` on its last byte. Malformed, truncated, overlong
+ * and surrogate sequences decode to U+FFFD, the same way JSON writers escape them.
+ */
+uint32_t DecodeUtf8CodePoint(const char *& c, const char * end)
+{
+    constexpr uint32_t kReplacementCharacter = 0xFFFD;
+    auto continuation                        = [&c](size_t i) { return static_cast<uint32_t>(static_cast<uint8_t>(c[i]) & 0x3F); };
+
+    uint32_t firstByte = static_cast<uint8_t>(*c);
+    if (firstByte < 0x80)
+    {
+        return firstByte;
+    }
+
+    if (firstByte < 0xE0)
+    {
+        VerifyOrReturnValue(end - c >= 2, kReplacementCharacter);
+        uint32_t codePoint = ((firstByte & 0x1F) << 6) | continuation(1);
+        c += 1;
+        return codePoint < 0x80 ? kReplacementCharacter : codePoint;
+    }
+
+    if (firstByte < 0xF0)
+    {
+        VerifyOrReturnValue(end - c >= 3, kReplacementCharacter);
+        uint32_t codePoint = ((firstByte & 0x0F) << 12) | (continuation(1) << 6) | continuation(2);
+        c += 2;
+        if (codePoint >= 0xD800 && codePoint <= 0xDFFF)
+        {
+            return kReplacementCharacter;
+        }
+        return codePoint < 0x800 ? kReplacementCharacter : codePoint;
+    }
+
+    if (firstByte < 0xF8)
+    {
+        VerifyOrReturnValue(end - c >= 4, kReplacementCharacter);
+        uint32_t codePoint = ((firstByte & 0x07) << 18) | (continuation(1) << 12) | (continuation(2) << 6) | continuation(3);
+        c += 3;
+        return codePoint < 0x10000 ? kReplacementCharacter : codePoint;
+    }
+
+    return kReplacementCharacter;
+}
+
+// The JSON text is laid out exactly like Json::StyledWriter lays out the equivalent Json::Value tree, so that the
+// output does not depend on whether it was produced by this converter or by a JSON library.
+constexpr size_t kIndentSize  = 3;
+constexpr size_t kRightMargin = 74;
+
+// Longest element name: "4294967295:ARRAY-DOUBLE".
+constexpr size_t kMaxJsonElementNameLength = 23;
+
 /*
  * Encapsulates the element information required to construct a JSON element name string in a JSON object.
  *
@@ -96,73 +156,153 @@ struct JsonObjectElementContext
         }
     }
 
-    std::string GenerateJsonElementName() const
+    /*
+     * Writes the element name into the given buffer, which must hold kMaxJsonElementNameLength characters,
+     * and returns its length.
+     */
+    size_t GenerateJsonElementName(char * name) const
     {
-        std::string str = "???";
+        uint32_t tagNumber = 0;
+        char * end         = name;
+
         if (TLV::IsContextTag(tag))
         {
             // common case for context tags: raw value
-            str = std::to_string(TLV::TagNumFromTag(tag));
+            tagNumber = TLV::TagNumFromTag(tag);
+        }
+        else if (TLV::IsProfileTag(tag) && TLV::ProfileIdFromTag(tag) == implicitProfileId)
+        {
+            tagNumber = TLV::TagNumFromTag(tag);
         }
         else if (TLV::IsProfileTag(tag))
         {
-            if (TLV::ProfileIdFromTag(tag) == implicitProfileId)
-            {
-                str = std::to_string(TLV::TagNumFromTag(tag));
-            }
-            else
-            {
-                uint32_t tagNumber = (static_cast<uint32_t>(TLV::VendorIdFromTag(tag)) << 16) | TLV::TagNumFromTag(tag);
-                str                = std::to_string(tagNumber);
-            }
+            tagNumber = (static_cast<uint32_t>(TLV::VendorIdFromTag(tag)) << 16) | TLV::TagNumFromTag(tag);
         }
-        str = str + ":" + GetJsonElementStrFromType(type);
+
+        if (TLV::IsContextTag(tag) || TLV::IsProfileTag(tag))
+        {
+            end = std::to_chars(name, name + kMaxJsonElementNameLength, tagNumber).ptr;
+        }
+        else
+        {
+            end = Append(end, "???");
+        }
+
+        *end++ = ':';
+        end    = Append(end, GetJsonElementStrFromType(type));
         if (type.tlvType == TLV::kTLVType_Array)
         {
-            str = str + "-" + GetJsonElementStrFromType(subType);
+            *end++ = '-';
+            end    = Append(end, GetJsonElementStrFromType(subType));
         }
-        return str;
+        return static_cast<size_t>(end - name);
     }
 
     TLV::Tag tag;
     uint32_t implicitProfileId;
     ElementTypeContext type;
     ElementTypeContext subType;
+
+private:
+    static char * Append(char * out, const char * str)
+    {
+        size_t length = strlen(str);
+        memcpy(out, str, length);
+        return out + length;
+    }
 };
 
 /*
- * This templated function inserts a name/value pair into the Json object.
- * The value is templated to be of type T and accepts any of the following types:
- *
- *      bool, uint*_t, int*_t, char *, float, double, std::string, Json::Value
+ * A member of a TLV structure, collected while scanning the structure so that the members can be written in the
+ * order of their JSON names.
+ */
+struct StructMember
+{
+    TLV::TLVReader reader; // Positioned on the member.
+    size_t position;       // Position of the member within the TLV structure.
+    uint8_t nameLength;
+    char name[kMaxJsonElementNameLength];
+};
+
+/*
+ * Writes a TLV structure as JSON text straight into the output string, without building a Json::Value tree.
  *
- * This method uses the provided element context to generate Json name string.
+ * The JSON object members are sorted by name and arrays are written on a single line when they fit within
+ * the right margin, as Json::StyledWriter does. Elements only allocate memory when the output string or the
+ * member stack needs to grow; both are reused for the whole conversion.
  */
-template <typename T>
-void InsertJsonElement(Json::Value & json, const JsonObjectElementContext & ctx, T val)
+class TlvToJsonWriter
 {
-    if (json.isArray())
+public:
+    TlvToJsonWriter(std::string & jsonString) : mOut(jsonString) {}
+
+    /*
+     * Given a TLVReader positioned at TLV structure this function:
+     *   - enters structure
+     *   - converts all elements of a structure into JSON object representation
+     *   - exits structure
+     */
+    CHIP_ERROR WriteStruct(TLV::TLVReader & reader);
+
+private:
+    CHIP_ERROR WriteValue(TLV::TLVReader & reader);
+    CHIP_ERROR WriteArray(TLV::TLVReader & reader);
+    CHIP_ERROR GetArraySubType(const TLV::TLVReader & reader, ElementTypeContext & subType);
+    void WriteString(const char * str, size_t length);
+    void WriteDouble(double value);
+
+    template <typename T>
+    void WriteInteger(T value, bool quoted)
     {
-        json.append(val);
+        char buffer[24];
+        auto length = static_cast<size_t>(std::to_chars(buffer, buffer + sizeof(buffer), value).ptr - buffer);
+        if (quoted)
+        {
+            mOut += '"';
+        }
+        mOut.append(buffer, length);
+        if (quoted)
+        {
+            mOut += '"';
+        }
     }
-    else
+
+    void WriteIndent()
     {
-        json[ctx.GenerateJsonElementName()] = val;
+        if (!mOut.empty())
+        {
+            char last = mOut.back();
+            if (last == ' ') // already indented
+            {
+                return;
+            }
+            if (last != '\n')
+            {
+                mOut += '\n';
+            }
+        }
+        mOut.append(mIndent, ' ');
     }
-}
 
-static CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj);
+    void WriteWithIndent(char c)
+    {
+        WriteIndent();
+        mOut += c;
+    }
 
-/*
- * Given a TLVReader positioned at TLV structure this function:
- *   - enters structure
- *   - converts all elements of a structure into JSON object representation
- *   - exits structure
- */
-CHIP_ERROR TlvStructToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
+    std::string & mOut;
+    size_t mIndent = 0;
+    std::vector<StructMember> mMembers;
+};
+
+CHIP_ERROR TlvToJsonWriter::WriteStruct(TLV::TLVReader & reader)
 {
     CHIP_ERROR err;
     TLV::TLVType containerType;
+    const size_t first = mMembers.size();
+
+    // The members of nested structures are stacked above the ones of this structure.
+    auto popMembers = ScopeExit([&]() { mMembers.resize(first); });
 
     ReturnErrorOnFailure(reader.EnterContainer(containerType));
 
@@ -176,52 +316,223 @@ CHIP_ERROR TlvStructToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
             VerifyOrReturnError(TLV::TagNumFromTag(tag) > UINT8_MAX, CHIP_ERROR_INVALID_TLV_TAG);
         }
 
-        // Recursively convert to JSON the item within the struct.
-        ReturnErrorOnFailure(TlvToJson(reader, jsonObj));
+        JsonObjectElementContext context(reader);
+        if (context.type.tlvType == TLV::kTLVType_Array)
+        {
+            ReturnErrorOnFailure(GetArraySubType(reader, context.subType));
+        }
+
+        StructMember & member = mMembers.emplace_back();
+        member.reader         = reader;
+        member.position       = mMembers.size() - first;
+        member.nameLength     = static_cast<uint8_t>(context.GenerateJsonElementName(member.name));
     }
 
     VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    return reader.ExitContainer(containerType);
+    ReturnErrorOnFailure(reader.ExitContainer(containerType));
+
+    std::sort(mMembers.begin() + static_cast<std::ptrdiff_t>(first), mMembers.end(),
+              [](const StructMember & a, const StructMember & b) {
+                  int result = memcmp(a.name, b.name, std::min(a.nameLength, b.nameLength));
+                  if (result != 0)
+                  {
+                      return result < 0;
+                  }
+                  if (a.nameLength != b.nameLength)
+                  {
+                      return a.nameLength < b.nameLength;
+                  }
+                  return a.position < b.position;
+              });
+
+    const size_t last = mMembers.size();
+    if (first == last)
+    {
+        mOut += "{}";
+        return CHIP_NO_ERROR;
+    }
+
+    WriteWithIndent('{');
+    mIndent += kIndentSize;
+
+    for (size_t i = first; i < last; i++)
+    {
+        // Nested structures may grow the member stack, so nothing may refer to it across WriteValue().
+        TLV::TLVReader memberReader = mMembers[i].reader;
+
+        if (i + 1 < last && mMembers[i].nameLength == mMembers[i + 1].nameLength &&
+            memcmp(mMembers[i].name, mMembers[i + 1].name, mMembers[i].nameLength) == 0)
+        {
+            // A later member with the same name replaces this one in the JSON object, but this one still
+            // has to be a valid element.
+            const size_t mark = mOut.size();
+            ReturnErrorOnFailure(WriteValue(memberReader));
+            mOut.resize(mark);
+            continue;
+        }
+
+        WriteIndent();
+        mOut += '"';
+        mOut.append(mMembers[i].name, mMembers[i].nameLength);
+        mOut += "\" : ";
+        ReturnErrorOnFailure(WriteValue(memberReader));
+        if (i + 1 < last)
+        {
+            mOut += ',';
+        }
+    }
+
+    mIndent -= kIndentSize;
+    WriteWithIndent('}');
+    return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
+CHIP_ERROR TlvToJsonWriter::GetArraySubType(const TLV::TLVReader & reader, ElementTypeContext & subType)
 {
-    JsonObjectElementContext context(reader);
+    TLV::TLVReader elementReader = reader;
+    TLV::TLVType containerType;
 
-    switch (reader.GetType())
+    ReturnErrorOnFailure(elementReader.EnterContainer(containerType));
+
+    CHIP_ERROR err = elementReader.Next();
+    if (err == CHIP_END_OF_TLV)
     {
-    case TLV::kTLVType_UnsignedInteger: {
-        uint64_t v;
-        ReturnErrorOnFailure(reader.Get(v));
-        if (CanCastTo<uint32_t>(v))
+        return CHIP_NO_ERROR;
+    }
+    ReturnErrorOnFailure(err);
+
+    subType.tlvType = elementReader.GetType();
+    if (subType.tlvType == TLV::kTLVType_FloatingPointNumber)
+    {
+        subType.isDouble = elementReader.IsElementDouble();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TlvToJsonWriter::WriteArray(TLV::TLVReader & reader)
+{
+    CHIP_ERROR err;
+    TLV::TLVType containerType;
+    ElementTypeContext subType;
+    size_t count           = 0;
+    bool hasNonEmptyStruct = false;
+
+    // First pass: validate the elements and find out whether the array goes on a single line.
+    TLV::TLVReader elementReader = reader;
+    ReturnErrorOnFailure(elementReader.EnterContainer(containerType));
+
+    while ((err = elementReader.Next()) == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(elementReader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
+        VerifyOrReturnError(elementReader.GetType() != TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+        ElementTypeContext nextSubType;
+        nextSubType.tlvType = elementReader.GetType();
+        if (nextSubType.tlvType == TLV::kTLVType_FloatingPointNumber)
+        {
+            nextSubType.isDouble = elementReader.IsElementDouble();
+        }
+
+        if (count == 0)
         {
-            InsertJsonElement(jsonObj, context, v);
+            subType = nextSubType;
         }
         else
         {
-            InsertJsonElement(jsonObj, context, std::to_string(v));
+            VerifyOrReturnError(subType.tlvType == nextSubType.tlvType && subType.isDouble == nextSubType.isDouble,
+                                CHIP_ERROR_INVALID_TLV_ELEMENT);
         }
-        break;
+
+        if (nextSubType.tlvType == TLV::kTLVType_Structure && !hasNonEmptyStruct)
+        {
+            TLV::TLVReader structReader = elementReader;
+            TLV::TLVType structType;
+            ReturnErrorOnFailure(structReader.EnterContainer(structType));
+            CHIP_ERROR structErr = structReader.Next();
+            VerifyOrReturnError(structErr == CHIP_NO_ERROR || structErr == CHIP_END_OF_TLV, structErr);
+            hasNonEmptyStruct = (structErr == CHIP_NO_ERROR);
+        }
+
+        count++;
     }
 
-    case TLV::kTLVType_SignedInteger: {
-        int64_t v;
-        ReturnErrorOnFailure(reader.Get(v));
-        if (CanCastTo<int32_t>(v))
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    if (count == 0)
+    {
+        mOut += "[]";
+        return reader.Skip();
+    }
+
+    if (count * 3 < kRightMargin && !hasNonEmptyStruct)
+    {
+        // Single line: "[ a, b, c ]", as long as it stays within the right margin.
+        const size_t mark = mOut.size();
+        elementReader     = reader;
+        ReturnErrorOnFailure(elementReader.EnterContainer(containerType));
+
+        mOut += "[ ";
+        for (size_t i = 0; i < count && mOut.size() - mark + 2 < kRightMargin; i++)
         {
-            InsertJsonElement(jsonObj, context, v);
+            ReturnErrorOnFailure(elementReader.Next());
+            if (i > 0)
+            {
+                mOut += ", ";
+            }
+            ReturnErrorOnFailure(WriteValue(elementReader));
         }
-        else
+        mOut += " ]";
+
+        if (mOut.size() - mark < kRightMargin)
         {
-            InsertJsonElement(jsonObj, context, std::to_string(v));
+            return reader.Skip();
         }
+        mOut.resize(mark);
+    }
+
+    WriteWithIndent('[');
+    mIndent += kIndentSize;
+
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    for (size_t i = 0; i < count; i++)
+    {
+        ReturnErrorOnFailure(reader.Next());
+        WriteIndent();
+        ReturnErrorOnFailure(WriteValue(reader));
+        if (i + 1 < count)
+        {
+            mOut += ',';
+        }
+    }
+    ReturnErrorOnFailure(reader.ExitContainer(containerType));
+
+    mIndent -= kIndentSize;
+    WriteWithIndent(']');
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TlvToJsonWriter::WriteValue(TLV::TLVReader & reader)
+{
+    switch (reader.GetType())
+    {
+    case TLV::kTLVType_UnsignedInteger: {
+        uint64_t v;
+        ReturnErrorOnFailure(reader.Get(v));
+        WriteInteger(v, !CanCastTo<uint32_t>(v));
+        break;
+    }
+
+    case TLV::kTLVType_SignedInteger: {
+        int64_t v;
+        ReturnErrorOnFailure(reader.Get(v));
+        WriteInteger(v, !CanCastTo<int32_t>(v));
         break;
     }
 
     case TLV::kTLVType_Boolean: {
         bool v;
         ReturnErrorOnFailure(reader.Get(v));
-        InsertJsonElement(jsonObj, context, v);
+        mOut += v ? "true" : "false";
         break;
     }
 
@@ -230,15 +541,15 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
         ReturnErrorOnFailure(reader.Get(v));
         if (v == std::numeric_limits<double>::infinity())
         {
-            InsertJsonElement(jsonObj, context, kFloatingPointPositiveInfinity);
+            WriteString(kFloatingPointPositiveInfinity, strlen(kFloatingPointPositiveInfinity));
         }
         else if (v == -std::numeric_limits<double>::infinity())
         {
-            InsertJsonElement(jsonObj, context, kFloatingPointNegativeInfinity);
+            WriteString(kFloatingPointNegativeInfinity, strlen(kFloatingPointNegativeInfinity));
         }
         else
         {
-            InsertJsonElement(jsonObj, context, v);
+            WriteDouble(v);
         }
         break;
     }
@@ -247,86 +558,133 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
         ByteSpan span;
         ReturnErrorOnFailure(reader.Get(span));
 
-        Platform::ScopedMemoryBuffer<char> byteString;
-        byteString.Alloc(BASE64_ENCODED_LEN(span.size()) + 1);
-        VerifyOrReturnError(byteString.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-
-        auto encodedLen              = Base64Encode(span.data(), static_cast<uint16_t>(span.size()), byteString.Get());
-        byteString.Get()[encodedLen] = '\0';
-
-        InsertJsonElement(jsonObj, context, byteString.Get());
+        // Base64 characters never need escaping, so encode straight into the output.
+        const auto inLen  = static_cast<uint16_t>(span.size());
+        const size_t mark = mOut.size();
+        mOut.resize(mark + BASE64_ENCODED_LEN(inLen) + 2);
+        mOut[mark]      = '"';
+        auto encodedLen = Base64Encode(span.data(), inLen, &mOut[mark + 1]);
+        mOut.resize(mark + 1 + encodedLen);
+        mOut += '"';
         break;
     }
 
     case TLV::kTLVType_UTF8String: {
         CharSpan span;
         ReturnErrorOnFailure(reader.Get(span));
-
-        std::string str(span.data(), span.size());
-        InsertJsonElement(jsonObj, context, str);
+        WriteString(span.data(), span.size());
         break;
     }
 
     case TLV::kTLVType_Null: {
-        InsertJsonElement(jsonObj, context, Json::Value());
+        mOut += "null";
         break;
     }
 
     case TLV::kTLVType_Structure: {
-        Json::Value jsonStruct(Json::objectValue);
-        ReturnErrorOnFailure(TlvStructToJson(reader, jsonStruct));
-        InsertJsonElement(jsonObj, context, jsonStruct);
+        ReturnErrorOnFailure(WriteStruct(reader));
         break;
     }
 
     case TLV::kTLVType_Array: {
-        CHIP_ERROR err;
-        Json::Value jsonArray(Json::arrayValue);
-        ElementTypeContext prevSubType;
-        ElementTypeContext nextSubType;
-        TLV::TLVType containerType;
+        ReturnErrorOnFailure(WriteArray(reader));
+        break;
+    }
 
-        ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    default:
+        return CHIP_ERROR_INVALID_TLV_ELEMENT;
+        break;
+    }
 
-        while ((err = reader.Next()) == CHIP_NO_ERROR)
-        {
-            VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
-            VerifyOrReturnError(reader.GetType() != TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
+    return CHIP_NO_ERROR;
+}
 
-            nextSubType.tlvType = reader.GetType();
-            if (nextSubType.tlvType == TLV::kTLVType_FloatingPointNumber)
-            {
-                nextSubType.isDouble = reader.IsElementDouble();
-            }
+void TlvToJsonWriter::WriteDouble(double value)
+{
+    if (std::isnan(value))
+    {
+        mOut += "null";
+        return;
+    }
+
+    char buffer[32];
+    int length = snprintf(buffer, sizeof(buffer), "%.17g", value);
+    VerifyOrDie(length > 0 && static_cast<size_t>(length) < sizeof(buffer));
+    mOut.append(buffer, static_cast<size_t>(length));
+
+    // Keep the number recognizable as a floating point one.
+    if (memchr(buffer, '.', static_cast<size_t>(length)) == nullptr && memchr(buffer, 'e', static_cast<size_t>(length)) == nullptr)
+    {
+        mOut += ".0";
+    }
+}
 
-            if (jsonArray.empty())
+/*
+ * Writes a quoted JSON string. Control characters and quotes are escaped and non-ASCII characters are
+ * written as \u escapes of their UTF-16 code units, with U+FFFD replacing malformed UTF-8 sequences.
+ */
+void TlvToJsonWriter::WriteString(const char * str, size_t length)
+{
+    static constexpr char kHexDigits[] = "0123456789abcdef";
+    auto appendHex                     = [this](uint32_t codeUnit) {
+        char escape[6] = { '\\', 'u', kHexDigits[(codeUnit >> 12) & 0xF], kHexDigits[(codeUnit >> 8) & 0xF],
+                           kHexDigits[(codeUnit >> 4) & 0xF], kHexDigits[codeUnit & 0xF] };
+        mOut.append(escape, sizeof(escape));
+    };
+
+    mOut += '"';
+
+    const char * end = str + length;
+    for (const char * c = str; c != end; ++c)
+    {
+        const auto byte = static_cast<uint8_t>(*c);
+        if (byte >= 0x20 && byte < 0x80 && byte != '"' && byte != '\\')
+        {
+            mOut += *c;
+            continue;
+        }
+
+        switch (*c)
+        {
+        case '"':
+            mOut += "\\\"";
+            break;
+        case '\\':
+            mOut += "\\\\";
+            break;
+        case '\b':
+            mOut += "\\b";
+            break;
+        case '\f':
+            mOut += "\\f";
+            break;
+        case '\n':
+            mOut += "\\n";
+            break;
+        case '\r':
+            mOut += "\\r";
+            break;
+        case '\t':
+            mOut += "\\t";
+            break;
+        default: {
+            uint32_t codePoint = DecodeUtf8CodePoint(c, end);
+            if (codePoint < 0x10000)
             {
-                prevSubType = nextSubType;
+                appendHex(codePoint);
             }
             else
             {
-                VerifyOrReturnError(prevSubType.tlvType == nextSubType.tlvType && prevSubType.isDouble == nextSubType.isDouble,
-                                    CHIP_ERROR_INVALID_TLV_ELEMENT);
+                codePoint -= 0x10000;
+                appendHex(0xD800 + ((codePoint >> 10) & 0x3FF));
+                appendHex(0xDC00 + (codePoint & 0x3FF));
             }
-
-            // Recursively convert to JSON the encompassing item within the array.
-            ReturnErrorOnFailure(TlvToJson(reader, jsonArray));
+            break;
+        }
         }
-
-        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-        ReturnErrorOnFailure(reader.ExitContainer(containerType));
-
-        context.subType = prevSubType;
-        InsertJsonElement(jsonObj, context, jsonArray);
-        break;
-    }
-
-    default:
-        return CHIP_ERROR_INVALID_TLV_ELEMENT;
-        break;
     }
 
-    return CHIP_NO_ERROR;
+    mOut += '"';
 }
 
 } // namespace
@@ -350,11 +708,17 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, std::string & jsonString)
     // During json conversion, a implicit profile ID is required
     ImplicitProfileIdChange implicitProfileIdChange(reader, kTemporaryImplicitProfileId);
 
-    Json::Value jsonObject(Json::objectValue);
-    ReturnErrorOnFailure(TlvStructToJson(reader, jsonObject));
+    jsonString.clear();
+
+    TlvToJsonWriter writer(jsonString);
+    CHIP_ERROR err = writer.WriteStruct(reader);
+    if (err != CHIP_NO_ERROR)
+    {
+        jsonString.clear();
+        return err;
+    }
 
-    Json::StyledWriter writer;
-    jsonString = writer.write(jsonObject);
+    jsonString += '\n';
     return CHIP_NO_ERROR;
 }
 } // namespace chip
@@ -0,0 +1,222 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures the TLV <-> JSON converters on a large attribute dump, against
+ *      the jsoncpp parse and write steps of a Json::Value tree of the same
+ *      document, which the converters no longer go through.
+ *
+ *      Usage: json-tlv-benchmark
+ */
+
+#include <json/json.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/jsontlv/JsonToTlv.h>
+#include <lib/support/jsontlv/TlvToJson.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <chrono>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+using namespace chip;
+
+namespace {
+
+constexpr uint32_t kImplicitProfileId = 0xFF01;
+constexpr size_t kDumpBufferSize      = 512 * 1024;
+constexpr size_t kDumpEndpoints       = 300;
+constexpr size_t kBenchmarkIterations = 20;
+
+// Access control entry, shaped like the ones of the Access Control cluster.
+CHIP_ERROR EncodeAccessControlEntry(TLV::TLVWriter & writer, uint8_t fabricIndex, size_t subjectCount)
+{
+    TLV::TLVType entry;
+    TLV::TLVType list;
+
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, entry));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(1), static_cast<uint8_t>(5)));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(2), static_cast<uint8_t>(2)));
+
+    ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(3), TLV::kTLVType_Array, list));
+    for (size_t i = 0; i < subjectCount; i++)
+    {
+        ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), static_cast<uint64_t>(0xFFFFFFFD00010000ull + i)));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(list));
+
+    ReturnErrorOnFailure(writer.PutNull(TLV::ContextTag(4)));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(254), fabricIndex));
+    return writer.EndContainer(entry);
+}
+
+/*
+ * Encodes a dump of `endpointCount` endpoints, each with a few clusters worth of attributes:
+ * lists of structures, labels, certificates, measurements and manufacturer-specific attributes.
+ * Members are in tag order, as JsonToTlv() encodes them.
+ */
+CHIP_ERROR EncodeAttributeDump(TLV::TLVWriter & writer, size_t endpointCount)
+{
+    TLV::TLVType dump;
+    uint8_t certificate[400];
+
+    for (size_t i = 0; i < sizeof(certificate); i++)
+    {
+        certificate[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, dump));
+    for (size_t endpoint = 0; endpoint < endpointCount; endpoint++)
+    {
+        TLV::TLVType attributes;
+        TLV::TLVType list;
+        auto endpointTag = (endpoint <= UINT8_MAX) ? TLV::ContextTag(static_cast<uint8_t>(endpoint))
+                                                   : TLV::ProfileTag(kImplicitProfileId, static_cast<uint32_t>(endpoint));
+
+        ReturnErrorOnFailure(writer.StartContainer(endpointTag, TLV::kTLVType_Structure, attributes));
+
+        ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(0), TLV::kTLVType_Array, list));
+        for (uint8_t fabricIndex = 1; fabricIndex <= 4; fabricIndex++)
+        {
+            ReturnErrorOnFailure(EncodeAccessControlEntry(writer, fabricIndex, fabricIndex));
+        }
+        ReturnErrorOnFailure(writer.EndContainer(list));
+
+        ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(1), TLV::kTLVType_Array, list));
+        for (uint32_t cluster = 0; cluster < 30; cluster++)
+        {
+            ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), cluster * 3 + 0x1D));
+        }
+        ReturnErrorOnFailure(writer.EndContainer(list));
+
+        ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(2), TLV::kTLVType_Array, list));
+        ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), static_cast<uint16_t>(0x0100)));
+        ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), static_cast<uint16_t>(0x0101)));
+        ReturnErrorOnFailure(writer.EndContainer(list));
+
+        ReturnErrorOnFailure(writer.PutString(TLV::ContextTag(3), "Living room \"ceiling\" light\n\xe2\x82\xac"));
+        ReturnErrorOnFailure(writer.PutBytes(TLV::ContextTag(4), certificate, sizeof(certificate)));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(5), static_cast<float>(21.5f + static_cast<float>(endpoint))));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(6), 1.0 / 3.0));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(7), static_cast<int64_t>(-5000000000ll)));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(8), true));
+        ReturnErrorOnFailure(writer.PutNull(TLV::ContextTag(9)));
+
+        ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(10), TLV::kTLVType_Array, list));
+        ReturnErrorOnFailure(writer.EndContainer(list));
+
+        ReturnErrorOnFailure(writer.Put(TLV::ProfileTag(0xFFF1, 0, 0x0001), static_cast<int8_t>(-3)));
+        ReturnErrorOnFailure(writer.Put(TLV::ProfileTag(kImplicitProfileId, 0xFFFC), static_cast<uint32_t>(0x1F)));
+
+        ReturnErrorOnFailure(writer.EndContainer(attributes));
+    }
+    return writer.EndContainer(dump);
+}
+
+CHIP_ERROR EncodeAttributeDump(std::vector<uint8_t> & tlv, size_t endpointCount)
+{
+    TLV::TLVWriter writer;
+
+    tlv.resize(kDumpBufferSize);
+    writer.Init(tlv.data(), tlv.size());
+    writer.ImplicitProfileId = kImplicitProfileId;
+
+    ReturnErrorOnFailure(EncodeAttributeDump(writer, endpointCount));
+    ReturnErrorOnFailure(writer.Finalize());
+    tlv.resize(writer.GetLengthWritten());
+    return CHIP_NO_ERROR;
+}
+
+double MegabytesPerSecond(size_t bytes, std::chrono::steady_clock::duration elapsed)
+{
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    return seconds > 0 ? static_cast<double>(bytes) / seconds / 1e6 : 0;
+}
+
+CHIP_ERROR RunBenchmark()
+{
+    std::vector<uint8_t> tlv;
+    ReturnErrorOnFailure(EncodeAttributeDump(tlv, kDumpEndpoints));
+
+    std::string json;
+    ReturnErrorOnFailure(TlvToJson(ByteSpan(tlv.data(), tlv.size()), json));
+
+    std::vector<uint8_t> output(tlv.size());
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kBenchmarkIterations; i++)
+    {
+        std::string converted;
+        ReturnErrorOnFailure(TlvToJson(ByteSpan(tlv.data(), tlv.size()), converted));
+    }
+    const auto tlvToJsonElapsed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kBenchmarkIterations; i++)
+    {
+        MutableByteSpan converted(output.data(), output.size());
+        ReturnErrorOnFailure(JsonToTlv(json, converted));
+    }
+    const auto jsonToTlvElapsed = std::chrono::steady_clock::now() - start;
+
+    // The Json::Value tree steps that the converters no longer go through.
+    Json::Value tree;
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kBenchmarkIterations; i++)
+    {
+        Json::Reader reader;
+        VerifyOrReturnError(reader.parse(json, tree), CHIP_ERROR_INVALID_ARGUMENT);
+    }
+    const auto treeParseElapsed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kBenchmarkIterations; i++)
+    {
+        Json::StyledWriter writer;
+        VerifyOrReturnError(writer.write(tree).size() == json.size(), CHIP_ERROR_INTERNAL);
+    }
+    const auto treeWriteElapsed = std::chrono::steady_clock::now() - start;
+
+    const size_t jsonBytes = json.size() * kBenchmarkIterations;
+    ChipLogProgress(Support, "Attribute dump of %u bytes of TLV, %u bytes of JSON", static_cast<unsigned>(tlv.size()),
+                    static_cast<unsigned>(json.size()));
+    ChipLogProgress(Support, "TlvToJson: %.1f MB/s of JSON, Json::StyledWriter alone: %.1f MB/s",
+                    MegabytesPerSecond(jsonBytes, tlvToJsonElapsed), MegabytesPerSecond(jsonBytes, treeWriteElapsed));
+    ChipLogProgress(Support, "JsonToTlv: %.1f MB/s of JSON, Json::Reader alone: %.1f MB/s",
+                    MegabytesPerSecond(jsonBytes, jsonToTlvElapsed), MegabytesPerSecond(jsonBytes, treeParseElapsed));
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    CHIP_ERROR err = RunBenchmark();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Support, "JSON/TLV conversion benchmark failed: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    Platform::MemoryShutdown();
+    return (err == CHIP_NO_ERROR) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
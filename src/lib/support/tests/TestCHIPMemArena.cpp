@@ -0,0 +1,146 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CHIPMemArena.h>
+
+#include <stdint.h>
+
+using namespace chip;
+using namespace chip::Platform;
+
+namespace {
+
+class TestCHIPMemArena : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+bool IsAligned(const void * p)
+{
+    return reinterpret_cast<uintptr_t>(p) % MemoryArena::kAlignment == 0;
+}
+
+TEST_F(TestCHIPMemArena, AllocatesAlignedBlocks)
+{
+    FixedMemoryArena<8 * MemoryArena::kAlignment> arena;
+    EXPECT_EQ(arena.Capacity(), 8 * MemoryArena::kAlignment);
+
+    uint8_t * p1 = static_cast<uint8_t *>(arena.Allocate(1));
+    uint8_t * p2 = static_cast<uint8_t *>(arena.Allocate(MemoryArena::kAlignment + 1));
+    uint8_t * p3 = static_cast<uint8_t *>(arena.Allocate(0));
+    ASSERT_NE(p1, nullptr);
+    ASSERT_NE(p2, nullptr);
+    ASSERT_NE(p3, nullptr);
+    EXPECT_TRUE(IsAligned(p1));
+    EXPECT_TRUE(IsAligned(p2));
+    EXPECT_TRUE(IsAligned(p3));
+    EXPECT_EQ(p2, p1 + MemoryArena::kAlignment);
+    EXPECT_EQ(p3, p2 + 2 * MemoryArena::kAlignment);
+    EXPECT_TRUE(arena.Contains(p3));
+    EXPECT_EQ(arena.Used(), 4 * MemoryArena::kAlignment);
+
+    // Exhausted, the remaining space is not enough.
+    EXPECT_EQ(arena.Allocate(4 * MemoryArena::kAlignment + 1), nullptr);
+    EXPECT_NE(arena.Allocate(4 * MemoryArena::kAlignment), nullptr);
+    EXPECT_EQ(arena.Allocate(1), nullptr);
+    EXPECT_EQ(arena.Used(), arena.Capacity());
+
+    arena.Reset();
+    EXPECT_EQ(arena.Used(), 0u);
+    EXPECT_EQ(arena.Peak(), arena.Capacity());
+    EXPECT_EQ(arena.Allocate(1), p1);
+}
+
+TEST_F(TestCHIPMemArena, FreesOnlyTheMostRecentBlock)
+{
+    FixedMemoryArena<256> arena;
+
+    void * p1 = arena.Allocate(10);
+    void * p2 = arena.Allocate(10);
+    ASSERT_NE(p2, nullptr);
+
+    arena.Free(p1);
+    EXPECT_EQ(arena.Used(), 2 * MemoryArena::kAlignment);
+
+    arena.Free(p2);
+    EXPECT_EQ(arena.Used(), MemoryArena::kAlignment);
+    EXPECT_EQ(arena.Allocate(10), p2);
+
+    // A block freed twice is released once.
+    arena.Free(p2);
+    arena.Free(p2);
+    EXPECT_EQ(arena.Used(), MemoryArena::kAlignment);
+}
+
+TEST_F(TestCHIPMemArena, ScopeReleasesItsAllocations)
+{
+    FixedMemoryArena<256> arena;
+    EXPECT_EQ(ScopedMemoryArena::Current(), nullptr);
+
+    void * before = arena.Allocate(10);
+    ASSERT_NE(before, nullptr);
+
+    {
+        ScopedMemoryArena scope(arena);
+        EXPECT_EQ(ScopedMemoryArena::Current(), &arena);
+        EXPECT_TRUE(arena.Contains(ScopedMemoryArena::Current()->Allocate(10)));
+        EXPECT_TRUE(arena.Contains(ScopedMemoryArena::Current()->Allocate(10)));
+        EXPECT_EQ(arena.Used(), 3 * MemoryArena::kAlignment);
+    }
+
+    // Only the allocations made within the scope are released with it.
+    EXPECT_EQ(ScopedMemoryArena::Current(), nullptr);
+    EXPECT_EQ(arena.Used(), MemoryArena::kAlignment);
+    EXPECT_EQ(arena.Peak(), 3 * MemoryArena::kAlignment);
+}
+
+TEST_F(TestCHIPMemArena, ScopesNest)
+{
+    FixedMemoryArena<256> outer;
+    FixedMemoryArena<256> inner;
+
+    ScopedMemoryArena outerScope(outer);
+    EXPECT_TRUE(outer.Contains(ScopedMemoryArena::Current()->Allocate(10)));
+
+    {
+        ScopedMemoryArena innerScope(inner);
+        EXPECT_EQ(ScopedMemoryArena::Current(), &inner);
+        EXPECT_TRUE(inner.Contains(ScopedMemoryArena::Current()->Allocate(10)));
+
+        {
+            // A nested scope on the same arena only releases its own allocations.
+            ScopedMemoryArena sameArenaScope(inner);
+            EXPECT_TRUE(inner.Contains(ScopedMemoryArena::Current()->Allocate(10)));
+            EXPECT_EQ(inner.Used(), 2 * MemoryArena::kAlignment);
+        }
+        EXPECT_EQ(ScopedMemoryArena::Current(), &inner);
+        EXPECT_EQ(inner.Used(), MemoryArena::kAlignment);
+    }
+
+    EXPECT_EQ(ScopedMemoryArena::Current(), &outer);
+    EXPECT_EQ(inner.Used(), 0u);
+    EXPECT_EQ(outer.Used(), MemoryArena::kAlignment);
+}
+
+} // namespace
@@ -0,0 +1,157 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CHIPMemTracking.h>
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::Platform;
+
+namespace {
+
+class TestCHIPMemTracking : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestCHIPMemTracking, TagLabels)
+{
+    EXPECT_STREQ(MemoryTagLabel(MemoryTag::kUntagged), "untagged");
+    EXPECT_STREQ(MemoryTagLabel(MemoryTag::kInteractionModel), "im");
+    EXPECT_STREQ(MemoryTagLabel(MemoryTag::kApplication), "app");
+    EXPECT_STREQ(MemoryTagLabel(static_cast<MemoryTag>(kMemoryTagCount)), "unknown");
+}
+
+#if CHIP_CONFIG_MEMORY_TRACKING && CHIP_CONFIG_MEMORY_MGMT_MALLOC
+
+// The application tag is not used by the stack, so nothing else allocates with it during the tests.
+constexpr MemoryTag kTestTag = MemoryTag::kApplication;
+
+TEST_F(TestCHIPMemTracking, AttributesAllocationsToTheCurrentTag)
+{
+    const MemoryTagStats before = GetMemoryTagStats(kTestTag);
+
+    void * untagged = MemoryAlloc(10);
+    ASSERT_NE(untagged, nullptr);
+    EXPECT_EQ(GetMemoryTagStats(kTestTag).allocationCount, before.allocationCount);
+
+    void * tagged = nullptr;
+    {
+        ScopedMemoryTag memoryTag(kTestTag);
+        EXPECT_EQ(ScopedMemoryTag::Current(), kTestTag);
+
+        tagged = MemoryAlloc(100);
+        ASSERT_NE(tagged, nullptr);
+        memset(tagged, 0xA5, 100);
+
+        // Nested tags win.
+        ScopedMemoryTag innerTag(MemoryTag::kUntagged);
+        MemoryFree(MemoryAlloc(50));
+    }
+    EXPECT_EQ(ScopedMemoryTag::Current(), MemoryTag::kUntagged);
+
+    MemoryTagStats stats = GetMemoryTagStats(kTestTag);
+    EXPECT_EQ(stats.liveBytes, before.liveBytes + 100);
+    EXPECT_EQ(stats.liveAllocations, before.liveAllocations + 1);
+    EXPECT_EQ(stats.allocationCount, before.allocationCount + 1);
+
+    // Blocks are released to their own tag, whatever the current one.
+    MemoryFree(tagged);
+    MemoryFree(untagged);
+    stats = GetMemoryTagStats(kTestTag);
+    EXPECT_EQ(stats.liveBytes, before.liveBytes);
+    EXPECT_EQ(stats.liveAllocations, before.liveAllocations);
+}
+
+TEST_F(TestCHIPMemTracking, ReallocatedBlocksKeepTheirTag)
+{
+    const MemoryTagStats before = GetMemoryTagStats(kTestTag);
+
+    uint8_t * p = nullptr;
+    {
+        ScopedMemoryTag memoryTag(kTestTag);
+        p = static_cast<uint8_t *>(MemoryCalloc(4, 8));
+        ASSERT_NE(p, nullptr);
+        for (size_t i = 0; i < 32; i++)
+        {
+            EXPECT_EQ(p[i], 0);
+        }
+        p[31] = 0x5A;
+    }
+    EXPECT_EQ(GetMemoryTagStats(kTestTag).liveBytes, before.liveBytes + 32);
+
+    p = static_cast<uint8_t *>(MemoryRealloc(p, 1000));
+    ASSERT_NE(p, nullptr);
+    EXPECT_EQ(p[31], 0x5A);
+
+    MemoryTagStats stats = GetMemoryTagStats(kTestTag);
+    EXPECT_EQ(stats.liveBytes, before.liveBytes + 1000);
+    EXPECT_EQ(stats.liveAllocations, before.liveAllocations + 1);
+    EXPECT_EQ(stats.allocationCount, before.allocationCount + 2);
+
+    MemoryFree(p);
+    EXPECT_EQ(GetMemoryTagStats(kTestTag).liveBytes, before.liveBytes);
+}
+
+TEST_F(TestCHIPMemTracking, TracksPeaks)
+{
+    ScopedMemoryTag memoryTag(kTestTag);
+    ResetMemoryTagPeaks();
+    const size_t baseline = GetMemoryTagStats(kTestTag).liveBytes;
+    EXPECT_EQ(GetMemoryTagStats(kTestTag).peakBytes, baseline);
+
+    void * p1 = MemoryAlloc(300);
+    void * p2 = MemoryAlloc(200);
+    MemoryFree(p1);
+    MemoryFree(p2);
+    void * p3 = MemoryAlloc(100);
+
+    MemoryTagStats stats = GetMemoryTagStats(kTestTag);
+    EXPECT_EQ(stats.peakBytes, baseline + 500);
+    EXPECT_EQ(stats.liveBytes, baseline + 100);
+
+    ResetMemoryTagPeaks();
+    EXPECT_EQ(GetMemoryTagStats(kTestTag).peakBytes, baseline + 100);
+    MemoryFree(p3);
+}
+
+TEST_F(TestCHIPMemTracking, RejectsOversizedAllocations)
+{
+    const MemoryTagStats before = GetMemoryTagStats(MemoryTag::kUntagged);
+
+    EXPECT_EQ(MemoryAlloc(SIZE_MAX), nullptr);
+    EXPECT_EQ(MemoryCalloc(SIZE_MAX / 2, 4), nullptr);
+
+    void * p = MemoryAlloc(10);
+    ASSERT_NE(p, nullptr);
+    EXPECT_EQ(MemoryRealloc(p, SIZE_MAX), nullptr);
+    MemoryFree(p);
+
+    EXPECT_EQ(GetMemoryTagStats(MemoryTag::kUntagged).liveBytes, before.liveBytes);
+}
+
+#endif // CHIP_CONFIG_MEMORY_TRACKING && CHIP_CONFIG_MEMORY_MGMT_MALLOC
+
+} // namespace
@@ -0,0 +1,217 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Layout checks for the TLV <-> JSON converters on large attribute dumps.
+ *
+ *      The converters lay out JSON text exactly like Json::StyledWriter does, so the
+ *      output must come back unchanged when it is parsed and written again by jsoncpp.
+ */
+
+#include <string>
+#include <vector>
+
+#include <pw_unit_test/framework.h>
+
+#include <json/json.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/jsontlv/JsonToTlv.h>
+#include <lib/support/jsontlv/TlvToJson.h>
+
+namespace {
+
+using namespace chip;
+
+constexpr uint32_t kImplicitProfileId = 0xFF01;
+constexpr size_t kDumpBufferSize      = 512 * 1024;
+
+class TestJsonTlvThroughput : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+// Access control entry, shaped like the ones of the Access Control cluster.
+CHIP_ERROR EncodeAccessControlEntry(TLV::TLVWriter & writer, uint8_t fabricIndex, size_t subjectCount)
+{
+    TLV::TLVType entry;
+    TLV::TLVType list;
+
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, entry));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(1), static_cast<uint8_t>(5)));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(2), static_cast<uint8_t>(2)));
+
+    ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(3), TLV::kTLVType_Array, list));
+    for (size_t i = 0; i < subjectCount; i++)
+    {
+        ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), static_cast<uint64_t>(0xFFFFFFFD00010000ull + i)));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(list));
+
+    ReturnErrorOnFailure(writer.PutNull(TLV::ContextTag(4)));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(254), fabricIndex));
+    return writer.EndContainer(entry);
+}
+
+/*
+ * Encodes a dump of `endpointCount` endpoints, each with a few clusters worth of attributes:
+ * lists of structures, labels, certificates, measurements and manufacturer-specific attributes.
+ * Members are in tag order, as JsonToTlv() encodes them.
+ */
+CHIP_ERROR EncodeAttributeDump(TLV::TLVWriter & writer, size_t endpointCount)
+{
+    TLV::TLVType dump;
+    uint8_t certificate[400];
+
+    for (size_t i = 0; i < sizeof(certificate); i++)
+    {
+        certificate[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, dump));
+    for (size_t endpoint = 0; endpoint < endpointCount; endpoint++)
+    {
+        TLV::TLVType attributes;
+        TLV::TLVType list;
+        auto endpointTag = (endpoint <= UINT8_MAX) ? TLV::ContextTag(static_cast<uint8_t>(endpoint))
+                                                   : TLV::ProfileTag(kImplicitProfileId, static_cast<uint32_t>(endpoint));
+
+        ReturnErrorOnFailure(writer.StartContainer(endpointTag, TLV::kTLVType_Structure, attributes));
+
+        ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(0), TLV::kTLVType_Array, list));
+        for (uint8_t fabricIndex = 1; fabricIndex <= 4; fabricIndex++)
+        {
+            ReturnErrorOnFailure(EncodeAccessControlEntry(writer, fabricIndex, fabricIndex));
+        }
+        ReturnErrorOnFailure(writer.EndContainer(list));
+
+        ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(1), TLV::kTLVType_Array, list));
+        for (uint32_t cluster = 0; cluster < 30; cluster++)
+        {
+            ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), cluster * 3 + 0x1D));
+        }
+        ReturnErrorOnFailure(writer.EndContainer(list));
+
+        ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(2), TLV::kTLVType_Array, list));
+        ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), static_cast<uint16_t>(0x0100)));
+        ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), static_cast<uint16_t>(0x0101)));
+        ReturnErrorOnFailure(writer.EndContainer(list));
+
+        ReturnErrorOnFailure(writer.PutString(TLV::ContextTag(3), "Living room \"ceiling\" light\n\xe2\x82\xac"));
+        ReturnErrorOnFailure(writer.PutBytes(TLV::ContextTag(4), certificate, sizeof(certificate)));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(5), static_cast<float>(21.5f + static_cast<float>(endpoint))));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(6), 1.0 / 3.0));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(7), static_cast<int64_t>(-5000000000ll)));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(8), true));
+        ReturnErrorOnFailure(writer.PutNull(TLV::ContextTag(9)));
+
+        ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(10), TLV::kTLVType_Array, list));
+        ReturnErrorOnFailure(writer.EndContainer(list));
+
+        ReturnErrorOnFailure(writer.Put(TLV::ProfileTag(0xFFF1, 0, 0x0001), static_cast<int8_t>(-3)));
+        ReturnErrorOnFailure(writer.Put(TLV::ProfileTag(kImplicitProfileId, 0xFFFC), static_cast<uint32_t>(0x1F)));
+
+        ReturnErrorOnFailure(writer.EndContainer(attributes));
+    }
+    return writer.EndContainer(dump);
+}
+
+CHIP_ERROR EncodeAttributeDump(std::vector<uint8_t> & tlv, size_t endpointCount)
+{
+    TLV::TLVWriter writer;
+
+    tlv.resize(kDumpBufferSize);
+    writer.Init(tlv.data(), tlv.size());
+    writer.ImplicitProfileId = kImplicitProfileId;
+
+    ReturnErrorOnFailure(EncodeAttributeDump(writer, endpointCount));
+    ReturnErrorOnFailure(writer.Finalize());
+    tlv.resize(writer.GetLengthWritten());
+    return CHIP_NO_ERROR;
+}
+
+std::string RewriteWithJsoncpp(const std::string & json)
+{
+    Json::Reader reader;
+    Json::Value value;
+    EXPECT_TRUE(reader.parse(json, value));
+
+    Json::StyledWriter writer;
+    return writer.write(value);
+}
+
+TEST_F(TestJsonTlvThroughput, AttributeDumpMatchesStyledWriter)
+{
+    std::vector<uint8_t> tlv;
+    ASSERT_EQ(EncodeAttributeDump(tlv, 300), CHIP_NO_ERROR);
+
+    std::string json;
+    ASSERT_EQ(TlvToJson(ByteSpan(tlv.data(), tlv.size()), json), CHIP_NO_ERROR);
+    EXPECT_EQ(json, RewriteWithJsoncpp(json));
+
+    std::vector<uint8_t> roundTrip(tlv.size());
+    MutableByteSpan roundTripSpan(roundTrip.data(), roundTrip.size());
+    ASSERT_EQ(JsonToTlv(json, roundTripSpan), CHIP_NO_ERROR);
+    EXPECT_TRUE(roundTripSpan.data_equal(ByteSpan(tlv.data(), tlv.size())));
+}
+
+TEST_F(TestJsonTlvThroughput, ArrayLayoutMatchesStyledWriter)
+{
+    // Arrays go on a single line only if they have fewer than 25 elements, no non-empty structure and
+    // fit within the right margin of 74 characters.
+    for (size_t count : { 0u, 1u, 8u, 9u, 24u, 25u })
+    {
+        for (uint32_t value : { 7u, 1000u })
+        {
+            uint8_t buf[1024];
+            TLV::TLVWriter writer;
+            TLV::TLVType outer;
+            TLV::TLVType array;
+
+            writer.Init(buf);
+            ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer), CHIP_NO_ERROR);
+            ASSERT_EQ(writer.StartContainer(TLV::ContextTag(1), TLV::kTLVType_Array, array), CHIP_NO_ERROR);
+            for (size_t i = 0; i < count; i++)
+            {
+                ASSERT_EQ(writer.Put(TLV::AnonymousTag(), value), CHIP_NO_ERROR);
+            }
+            ASSERT_EQ(writer.EndContainer(array), CHIP_NO_ERROR);
+
+            ASSERT_EQ(writer.StartContainer(TLV::ContextTag(2), TLV::kTLVType_Array, array), CHIP_NO_ERROR);
+            for (size_t i = 0; i < count; i++)
+            {
+                TLV::TLVType entry;
+                ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, entry), CHIP_NO_ERROR);
+                ASSERT_EQ(writer.EndContainer(entry), CHIP_NO_ERROR);
+            }
+            ASSERT_EQ(writer.EndContainer(array), CHIP_NO_ERROR);
+
+            ASSERT_EQ(writer.EndContainer(outer), CHIP_NO_ERROR);
+            ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+            std::string json;
+            ASSERT_EQ(TlvToJson(ByteSpan(buf, writer.GetLengthWritten()), json), CHIP_NO_ERROR);
+            EXPECT_EQ(json, RewriteWithJsoncpp(json));
+        }
+    }
+}
+
+} // namespace
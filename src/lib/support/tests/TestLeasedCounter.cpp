@@ -0,0 +1,299 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CounterLeaseStore.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/LeasedCounter.h>
+#include <lib/support/PersistedCounter.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+
+using namespace chip;
+
+namespace {
+
+using Slot = CounterLeaseStore::Slot;
+
+// Store completing renewals only when the test asks for it, like a store writing in the background.
+class DeferredCounterLeaseStore : public CounterLeaseStore
+{
+public:
+    CHIP_ERROR ReadLeaseEnd(Slot slot, uint64_t & leaseEnd) override
+    {
+        VerifyOrReturnError(mHasLease, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+        leaseEnd = mDurableLeaseEnd;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR StoreLeaseEnd(Slot slot, uint64_t leaseEnd) override
+    {
+        mSynchronousStores++;
+        mHasLease        = true;
+        mDurableLeaseEnd = leaseEnd;
+        mRequestedEnd    = leaseEnd;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR RenewLeaseEnd(Slot slot, uint64_t leaseEnd, Delegate & delegate) override
+    {
+        mRenewals++;
+        mSlot         = slot;
+        mRequestedEnd = leaseEnd;
+        mDelegate     = &delegate;
+        return CHIP_NO_ERROR;
+    }
+
+    void CancelRenewals(Delegate & delegate) override
+    {
+        if (mDelegate == &delegate)
+        {
+            mDelegate = nullptr;
+        }
+    }
+
+    // Makes the most recently requested lease durable and reports it.
+    void CompleteRenewal()
+    {
+        mHasLease           = true;
+        mDurableLeaseEnd    = mRequestedEnd;
+        Delegate * delegate = mDelegate;
+        mDelegate           = nullptr;
+        if (delegate != nullptr)
+        {
+            delegate->OnLeaseRenewed(mSlot, mDurableLeaseEnd, CHIP_NO_ERROR);
+        }
+    }
+
+    bool HasPendingRenewal() const { return mDelegate != nullptr; }
+
+    bool mHasLease              = false;
+    uint64_t mDurableLeaseEnd   = 0;
+    uint64_t mRequestedEnd      = 0;
+    unsigned mSynchronousStores = 0;
+    unsigned mRenewals          = 0;
+    Slot mSlot                  = Slot::kEventNumber;
+    Delegate * mDelegate        = nullptr;
+};
+
+TEST(TestLeasedCounter, TestOutOfBoxAndReboot)
+{
+    TestPersistentStorageDelegate storage;
+    PersistentStorageCounterLeaseStore store(&storage);
+
+    {
+        LeasedCounter<uint64_t> counter;
+        EXPECT_EQ(counter.Init(store, Slot::kEventNumber, 100), CHIP_NO_ERROR);
+        EXPECT_EQ(counter.GetValue(), 0ULL);
+
+        uint64_t leaseEnd = 0;
+        EXPECT_EQ(store.ReadLeaseEnd(Slot::kEventNumber, leaseEnd), CHIP_NO_ERROR);
+        EXPECT_EQ(leaseEnd, 100ULL);
+
+        // The lease is renewed once half of it is used.
+        for (int i = 0; i < 49; i++)
+        {
+            EXPECT_EQ(counter.Advance(), CHIP_NO_ERROR);
+        }
+        EXPECT_EQ(store.ReadLeaseEnd(Slot::kEventNumber, leaseEnd), CHIP_NO_ERROR);
+        EXPECT_EQ(leaseEnd, 100ULL);
+
+        EXPECT_EQ(counter.Advance(), CHIP_NO_ERROR);
+        EXPECT_EQ(counter.GetValue(), 50ULL);
+        EXPECT_EQ(store.ReadLeaseEnd(Slot::kEventNumber, leaseEnd), CHIP_NO_ERROR);
+        EXPECT_EQ(leaseEnd, 150ULL);
+
+        EXPECT_EQ(counter.AdvanceBy(2), CHIP_NO_ERROR);
+        EXPECT_EQ(counter.GetValue(), 52ULL);
+    }
+
+    // Now we "reboot", and resume at the end of the last lease.
+    LeasedCounter<uint64_t> counter;
+    EXPECT_EQ(counter.Init(store, Slot::kEventNumber, 100), CHIP_NO_ERROR);
+    EXPECT_EQ(counter.GetValue(), 150ULL);
+}
+
+TEST(TestLeasedCounter, TestCompatibleWithExistingStorage)
+{
+    TestPersistentStorageDelegate storage;
+    PersistentStorageCounterLeaseStore store(&storage);
+
+    // Event numbers pick up from where a PersistedCounter left them.
+    {
+        PersistedCounter<uint64_t> persisted;
+        EXPECT_EQ(persisted.Init(&storage, DefaultStorageKeyAllocator::IMEventNumber(), 0x10000), CHIP_NO_ERROR);
+    }
+    LeasedCounter<uint64_t> eventNumber;
+    EXPECT_EQ(eventNumber.Init(store, Slot::kEventNumber, 0x10000), CHIP_NO_ERROR);
+    EXPECT_EQ(eventNumber.GetValue(), 0x10000ULL);
+
+    // Group counters are stored in host order, as GroupOutgoingCounters does.
+    uint32_t groupValue = 0x12345;
+    EXPECT_EQ(storage.SyncSetKeyValue(DefaultStorageKeyAllocator::GroupDataCounter().KeyName(), &groupValue, sizeof(groupValue)),
+              CHIP_NO_ERROR);
+    LeasedCounter<uint32_t> groupCounter;
+    EXPECT_EQ(groupCounter.Init(store, Slot::kGroupDataCounter, 1000, 7), CHIP_NO_ERROR);
+    EXPECT_EQ(groupCounter.GetValue(), 0x12345u);
+
+    uint16_t size = sizeof(groupValue);
+    EXPECT_EQ(storage.SyncGetKeyValue(DefaultStorageKeyAllocator::GroupDataCounter().KeyName(), &groupValue, size),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(groupValue, 0x12345u + 1000u);
+
+    // Without a stored lease, the counter starts at the initial value.
+    LeasedCounter<uint32_t> controlCounter;
+    EXPECT_EQ(controlCounter.Init(store, Slot::kGroupControlCounter, 1000, 7), CHIP_NO_ERROR);
+    EXPECT_EQ(controlCounter.GetValue(), 7u);
+}
+
+TEST(TestLeasedCounter, TestInitErrors)
+{
+    TestPersistentStorageDelegate storage;
+    PersistentStorageCounterLeaseStore store(&storage);
+    LeasedCounter<uint64_t> counter;
+
+    EXPECT_EQ(counter.Advance(), CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_EQ(counter.Init(store, Slot::kEventNumber, 1), CHIP_ERROR_INVALID_INTEGER_VALUE);
+
+    storage.AddPoisonKey(DefaultStorageKeyAllocator::IMEventNumber().KeyName());
+    EXPECT_NE(counter.Init(store, Slot::kEventNumber, 100), CHIP_NO_ERROR);
+    EXPECT_EQ(counter.Advance(), CHIP_ERROR_INCORRECT_STATE);
+}
+
+TEST(TestLeasedCounter, TestRenewsInBackground)
+{
+    DeferredCounterLeaseStore store;
+    LeasedCounter<uint64_t> counter;
+
+    EXPECT_EQ(counter.Init(store, Slot::kEventNumber, 100), CHIP_NO_ERROR);
+    EXPECT_EQ(store.mSynchronousStores, 1u);
+
+    // The counter keeps advancing through the rest of its lease while the renewal is pending, and only asks once.
+    for (int i = 0; i < 99; i++)
+    {
+        EXPECT_EQ(counter.Advance(), CHIP_NO_ERROR);
+        EXPECT_LT(counter.GetValue(), store.mDurableLeaseEnd);
+    }
+    EXPECT_EQ(counter.GetValue(), 99ULL);
+    EXPECT_EQ(store.mRenewals, 1u);
+    EXPECT_EQ(store.mRequestedEnd, 150ULL);
+    EXPECT_EQ(store.mSynchronousStores, 1u);
+
+    store.CompleteRenewal();
+
+    for (int i = 0; i < 50; i++)
+    {
+        EXPECT_EQ(counter.Advance(), CHIP_NO_ERROR);
+        EXPECT_LT(counter.GetValue(), store.mDurableLeaseEnd);
+        if (store.HasPendingRenewal())
+        {
+            store.CompleteRenewal();
+        }
+    }
+    EXPECT_EQ(counter.GetValue(), 149ULL);
+    EXPECT_EQ(store.mSynchronousStores, 1u);
+    EXPECT_EQ(store.mRenewals, 2u);
+}
+
+TEST(TestLeasedCounter, TestStoresSynchronouslyWhenLeaseRunsOut)
+{
+    DeferredCounterLeaseStore store;
+    LeasedCounter<uint64_t> counter;
+
+    EXPECT_EQ(counter.Init(store, Slot::kEventNumber, 100), CHIP_NO_ERROR);
+
+    // The renewal never completes, so the counter must store a lease itself rather than vend values past the durable one.
+    for (int i = 0; i < 250; i++)
+    {
+        EXPECT_EQ(counter.Advance(), CHIP_NO_ERROR);
+        EXPECT_LT(counter.GetValue(), store.mDurableLeaseEnd);
+    }
+    EXPECT_EQ(store.mSynchronousStores, 3u);
+
+    // A renewal completing after a synchronous store moved the lease further does not move the lease back.
+    EXPECT_EQ(counter.AdvanceBy(1000), CHIP_NO_ERROR);
+    EXPECT_EQ(counter.GetValue(), 1250ULL);
+    EXPECT_EQ(store.mDurableLeaseEnd, 1350ULL);
+    store.mRequestedEnd = 1300;
+    store.CompleteRenewal();
+    store.mDurableLeaseEnd = 1350;
+
+    for (int i = 0; i < 99; i++)
+    {
+        EXPECT_EQ(counter.Advance(), CHIP_NO_ERROR);
+        EXPECT_LT(counter.GetValue(), store.mDurableLeaseEnd);
+    }
+    EXPECT_EQ(counter.GetValue(), 1349ULL);
+}
+
+TEST(TestLeasedCounter, TestWrapAround)
+{
+    DeferredCounterLeaseStore store;
+    LeasedCounter<uint8_t> counter;
+
+    EXPECT_EQ(counter.Init(store, Slot::kGroupControlCounter, 16, 250), CHIP_NO_ERROR);
+    EXPECT_EQ(store.mDurableLeaseEnd, 10ULL);
+
+    for (int i = 0; i < 600; i++)
+    {
+        EXPECT_EQ(counter.Advance(), CHIP_NO_ERROR);
+        // Values left in the durable lease, modulo 256.
+        const uint8_t remaining = static_cast<uint8_t>(static_cast<uint8_t>(store.mDurableLeaseEnd) - counter.GetValue());
+        EXPECT_GT(remaining, 0);
+        EXPECT_LE(remaining, 16);
+        if (store.HasPendingRenewal())
+        {
+            store.CompleteRenewal();
+        }
+    }
+    EXPECT_EQ(store.mSynchronousStores, 1u);
+}
+
+TEST(TestLeasedCounter, TestDestructionCancelsRenewal)
+{
+    DeferredCounterLeaseStore store;
+    {
+        LeasedCounter<uint32_t> counter;
+        EXPECT_EQ(counter.Init(store, Slot::kGroupDataCounter, 10), CHIP_NO_ERROR);
+        EXPECT_EQ(counter.AdvanceBy(6), CHIP_NO_ERROR);
+        EXPECT_TRUE(store.HasPendingRenewal());
+    }
+    EXPECT_FALSE(store.HasPendingRenewal());
+    store.CompleteRenewal();
+    EXPECT_EQ(store.mDurableLeaseEnd, 16ULL);
+}
+
+TEST(TestLeasedCounter, TestShutdownDetachesFromStore)
+{
+    LeasedCounter<uint32_t> counter;
+    {
+        // The store goes away before the counter, as a server's store may.
+        DeferredCounterLeaseStore store;
+        EXPECT_EQ(counter.Init(store, Slot::kEventNumber, 10), CHIP_NO_ERROR);
+        EXPECT_EQ(counter.AdvanceBy(6), CHIP_NO_ERROR);
+        EXPECT_TRUE(store.HasPendingRenewal());
+
+        counter.Shutdown();
+        EXPECT_FALSE(store.HasPendingRenewal());
+    }
+    EXPECT_EQ(counter.Advance(), CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_EQ(counter.GetValue(), 6u);
+}
+
+} // namespace
@@ -28,26 +28,112 @@ namespace chip {
 namespace DeviceLayer {
 namespace Internal {
 
+DeviceSafeQueue::DeviceSafeQueue()
+{
+    for (size_t i = 0; i < kRingSize; i++)
+    {
+        mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+}
+
 void DeviceSafeQueue::Push(const ChipDeviceEvent & event)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    mEventQueue.push(event);
+    // While the overflow queue holds events, newer ones must follow them there to stay in order.
+    if (!mOverflowActive.load(std::memory_order_acquire) && TryPushToRing(event))
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mOverflowQueueLock);
+    mOverflowActive.store(true, std::memory_order_release);
+    mOverflowQueue.push(event);
 }
 
 bool DeviceSafeQueue::Empty()
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    return mEventQueue.empty();
+    const Slot & slot = mSlots[mDequeuePosition & (kRingSize - 1)];
+    return slot.mSequence.load(std::memory_order_acquire) != mDequeuePosition + 1 &&
+        !mOverflowActive.load(std::memory_order_acquire);
+}
+
+bool DeviceSafeQueue::TryPopFront(ChipDeviceEvent & event)
+{
+    // The ring only holds events pushed before the overflow queue was used, or after it was emptied, so it comes first.
+    if (TryPopFromRing(event))
+    {
+        return true;
+    }
+
+    // A position claimed by a producer that has not written its event yet must be popped before any overflow event, which
+    // may have been pushed after it by the same producer.  That producer wakes the consumer once it has written the event.
+    if (!mOverflowActive.load(std::memory_order_acquire) || mEnqueuePosition.load(std::memory_order_acquire) != mDequeuePosition)
+    {
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(mOverflowQueueLock);
+    if (mOverflowQueue.empty())
+    {
+        mOverflowActive.store(false, std::memory_order_release);
+        return false;
+    }
+
+    event = mOverflowQueue.front();
+    mOverflowQueue.pop();
+    if (mOverflowQueue.empty())
+    {
+        mOverflowActive.store(false, std::memory_order_release);
+    }
+    return true;
 }
 
-ChipDeviceEvent DeviceSafeQueue::PopFront()
+bool DeviceSafeQueue::TryPushToRing(const ChipDeviceEvent & event)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
+    size_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+    Slot * slot;
+
+    while (true)
+    {
+        slot                  = &mSlots[position & (kRingSize - 1)];
+        const size_t sequence = slot->mSequence.load(std::memory_order_acquire);
+        if (sequence == position)
+        {
+            // The slot is free: claim the position.
+            if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (static_cast<ptrdiff_t>(sequence - position) < 0)
+        {
+            // The slot still holds the event from the previous lap: the ring is full.
+            return false;
+        }
+        else
+        {
+            // Another producer claimed the position first.
+            position = mEnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
 
-    const ChipDeviceEvent event = mEventQueue.front();
-    mEventQueue.pop();
+    slot->mEvent = event;
+    slot->mSequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+bool DeviceSafeQueue::TryPopFromRing(ChipDeviceEvent & event)
+{
+    Slot & slot = mSlots[mDequeuePosition & (kRingSize - 1)];
+    if (slot.mSequence.load(std::memory_order_acquire) != mDequeuePosition + 1)
+    {
+        // Empty, or the producer that claimed the position has not written its event yet.
+        return false;
+    }
 
-    return event;
+    event = slot.mEvent;
+    slot.mSequence.store(mDequeuePosition + kRingSize, std::memory_order_release);
+    mDequeuePosition++;
+    return true;
 }
 
 } // namespace Internal
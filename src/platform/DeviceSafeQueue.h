@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
 #include <queue>
 
@@ -39,24 +40,64 @@ namespace Internal {
  *  @class DeviceSafeQueue
  *
  *  @brief
- *      This class represents a thread-safe message queue implemented with C++ Standard Library, the message queue
- *      is used by the CHIP event loop to hold incoming messages. Each message is sequentially dequeued, decoded,
- *      and then an action is performed.
+ *      This class represents a thread-safe message queue, used by the CHIP event loop to hold incoming messages.
+ *      Each message is sequentially dequeued, decoded, and then an action is performed.
  *
+ *      Any number of threads may push events, while a single thread (the CHIP event loop) pops them. Pushes go to
+ *      a bounded lock-free ring of CHIP_DEVICE_CONFIG_LOCK_FREE_EVENT_QUEUE_SIZE events, so that posting events from
+ *      other threads does not contend on a lock. When the ring is full, events go to a mutex-protected overflow
+ *      queue until the consumer has emptied it, which keeps the events of each producer in order.
  */
 class DeviceSafeQueue
 {
 public:
-    DeviceSafeQueue()  = default;
+    DeviceSafeQueue();
     ~DeviceSafeQueue() = default;
 
+    /**
+     * Pushes an event.  May be called from any thread.
+     */
     void Push(const ChipDeviceEvent & event);
+
+    /**
+     * Whether the queue is empty.  Only meaningful on the consumer thread, and events being pushed concurrently
+     * may not be seen yet.
+     */
     bool Empty();
-    ChipDeviceEvent PopFront();
+
+    /**
+     * Pops the oldest event into `event`.  Must only be called from the consumer thread.
+     *
+     * @return false if there is no event to pop.
+     */
+    bool TryPopFront(ChipDeviceEvent & event);
 
 private:
-    std::queue<ChipDeviceEvent> mEventQueue;
-    std::mutex mEventQueueLock;
+    static constexpr size_t kRingSize = CHIP_DEVICE_CONFIG_LOCK_FREE_EVENT_QUEUE_SIZE;
+    static_assert(kRingSize > 0 && (kRingSize & (kRingSize - 1)) == 0,
+                  "CHIP_DEVICE_CONFIG_LOCK_FREE_EVENT_QUEUE_SIZE must be a power of two");
+
+    // Avoids false sharing between the producer and consumer positions.
+    static constexpr size_t kCacheLineSize = 64;
+
+    // A ring slot.  `mSequence` tells the slot's state for the position `pos` that maps to it: equal to `pos` when
+    // the slot is free for a producer, `pos + 1` once the event has been written for the consumer.
+    struct Slot
+    {
+        std::atomic<size_t> mSequence;
+        ChipDeviceEvent mEvent;
+    };
+
+    bool TryPushToRing(const ChipDeviceEvent & event);
+    bool TryPopFromRing(ChipDeviceEvent & event);
+
+    Slot mSlots[kRingSize];
+    alignas(kCacheLineSize) std::atomic<size_t> mEnqueuePosition{ 0 };
+    alignas(kCacheLineSize) size_t mDequeuePosition = 0;
+
+    std::atomic<bool> mOverflowActive{ false };
+    std::queue<ChipDeviceEvent> mOverflowQueue;
+    std::mutex mOverflowQueueLock;
 
     DeviceSafeQueue(const DeviceSafeQueue &)             = delete;
     DeviceSafeQueue & operator=(const DeviceSafeQueue &) = delete;
@@ -64,6 +64,11 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 
+// Linux devices and bridges, which recall scenes on many endpoints, can spare the RAM for a few decoded scenes
+#ifndef CHIP_CONFIG_SCENES_CACHE_SIZE
+#define CHIP_CONFIG_SCENES_CACHE_SIZE 4
+#endif // CHIP_CONFIG_SCENES_CACHE_SIZE
+
 // ==================== Security Configuration Overrides ====================
 
 #ifndef CHIP_CONFIG_KVS_PATH
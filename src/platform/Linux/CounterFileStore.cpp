@@ -0,0 +1,455 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <platform/Linux/CounterFileStore.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TypeTraits.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/PlatformManager.h>
+#include <system/SystemError.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace PersistedStorage {
+
+namespace {
+
+// Each copy of the lease table is stored as (all little-endian):
+//
+//   magic (4) | version (1) | slot count (1) | stored slots bitmap (1) | reserved (1) | sequence (4) |
+//   lease ends (8 each) | FNV-1a checksum of all the previous bytes (4)
+//
+// The file holds two copies, the table with sequence number N being written to copy (N - 1) % 2.
+constexpr uint32_t kMagic         = 0x52544e43; // "CNTR"
+constexpr uint8_t kVersion        = 1;
+constexpr size_t kLeaseEndsOffset = 12;
+constexpr size_t kChecksumOffset  = kLeaseEndsOffset + CounterFileStore::kFileSlotCount * sizeof(uint64_t);
+constexpr size_t kRecordSize      = kChecksumOffset + sizeof(uint32_t);
+constexpr size_t kCopyCount       = 2;
+
+struct LeaseTable
+{
+    uint32_t sequence;
+    uint8_t storedSlots;
+    uint64_t leaseEnds[CounterFileStore::kFileSlotCount];
+};
+
+uint32_t Checksum(const uint8_t * data, size_t size)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+void EncodeTable(const LeaseTable & table, uint8_t * record)
+{
+    memset(record, 0, kRecordSize);
+    Encoding::LittleEndian::Put32(&record[0], kMagic);
+    record[4] = kVersion;
+    record[5] = CounterFileStore::kFileSlotCount;
+    record[6] = table.storedSlots;
+    Encoding::LittleEndian::Put32(&record[8], table.sequence);
+    for (size_t i = 0; i < CounterFileStore::kFileSlotCount; i++)
+    {
+        Encoding::LittleEndian::Put64(&record[kLeaseEndsOffset + i * sizeof(uint64_t)], table.leaseEnds[i]);
+    }
+    Encoding::LittleEndian::Put32(&record[kChecksumOffset], Checksum(record, kChecksumOffset));
+}
+
+bool DecodeTable(const uint8_t * record, LeaseTable & table)
+{
+    if (Encoding::LittleEndian::Get32(&record[0]) != kMagic || record[4] != kVersion ||
+        record[5] != CounterFileStore::kFileSlotCount ||
+        Encoding::LittleEndian::Get32(&record[kChecksumOffset]) != Checksum(record, kChecksumOffset))
+    {
+        return false;
+    }
+
+    table.storedSlots = record[6];
+    table.sequence    = Encoding::LittleEndian::Get32(&record[8]);
+    for (size_t i = 0; i < CounterFileStore::kFileSlotCount; i++)
+    {
+        table.leaseEnds[i] = Encoding::LittleEndian::Get64(&record[kLeaseEndsOffset + i * sizeof(uint64_t)]);
+    }
+    return true;
+}
+
+// Whether sequence number `a` was written after `b`, allowing for wrap-around.
+bool IsNewer(uint32_t a, uint32_t b)
+{
+    return static_cast<int32_t>(a - b) > 0;
+}
+
+uint8_t SlotBit(CounterLeaseStore::Slot slot)
+{
+    return static_cast<uint8_t>(1u << to_underlying(slot));
+}
+
+} // namespace
+
+CounterFileStore::~CounterFileStore()
+{
+    Shutdown();
+}
+
+CHIP_ERROR CounterFileStore::Init(const char * path, PersistentStorageDelegate * legacyStorage)
+{
+    VerifyOrReturnError(path != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> writeLock(mWriteLock);
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mFd < 0, CHIP_ERROR_INCORRECT_STATE);
+
+    int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_POSIX(errno));
+
+    uint8_t file[kCopyCount * kRecordSize];
+    ssize_t readSize;
+    do
+    {
+        readSize = pread(fd, file, sizeof(file), 0);
+    } while (readSize < 0 && errno == EINTR);
+    if (readSize < 0)
+    {
+        CHIP_ERROR err = CHIP_ERROR_POSIX(errno);
+        close(fd);
+        return err;
+    }
+
+    LeaseTable tables[kCopyCount];
+    const LeaseTable * current = nullptr;
+    for (size_t i = 0; i < kCopyCount; i++)
+    {
+        if (static_cast<size_t>(readSize) >= (i + 1) * kRecordSize && DecodeTable(&file[i * kRecordSize], tables[i]) &&
+            (current == nullptr || IsNewer(tables[i].sequence, current->sequence)))
+        {
+            current = &tables[i];
+        }
+    }
+
+    if (current == nullptr && static_cast<size_t>(readSize) > kRecordSize)
+    {
+        // The second copy is only written once the first one is complete, so both of them cannot be damaged by one write.
+        ChipLogError(DeviceLayer, "Counter file %s is corrupted", path);
+        close(fd);
+        return CHIP_ERROR_INTEGRITY_CHECK_FAILED;
+    }
+    if (current == nullptr && readSize > 0)
+    {
+        // Only the very first write was interrupted, before any counter could use the lease it was storing.
+        ChipLogProgress(DeviceLayer, "Discarding the incomplete counter file %s", path);
+    }
+
+    mFd             = fd;
+    mSequence       = (current != nullptr) ? current->sequence : 0;
+    mStoredSlots    = (current != nullptr) ? current->storedSlots : 0;
+    mRequestedSlots = 0;
+    mWrittenSlots   = 0;
+    mFailedSlots    = 0;
+    mWriteScheduled = false;
+    for (size_t i = 0; i < kFileSlotCount; i++)
+    {
+        mLeaseEnds[i]        = (current != nullptr) ? current->leaseEnds[i] : 0;
+        mDurableLeaseEnds[i] = mLeaseEnds[i];
+        mDelegates[i]        = nullptr;
+    }
+
+    mWorkContext        = std::make_shared<WorkContext>();
+    mWorkContext->store = this;
+
+    mLegacyStore.SetStorageDelegate(legacyStorage);
+    mHasLegacyStore = (legacyStorage != nullptr);
+
+    return CHIP_NO_ERROR;
+}
+
+void CounterFileStore::Shutdown()
+{
+    WorkContextRef context;
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        context = std::move(mWorkContext);
+    }
+    if (context)
+    {
+        // Waits for the work running, if any.  The work still queued then finds no store.
+        std::lock_guard<std::mutex> workLock(context->lock);
+        context->store = nullptr;
+    }
+
+    std::lock_guard<std::mutex> writeLock(mWriteLock);
+    std::lock_guard<std::mutex> lock(mLock);
+
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+
+    mRequestedSlots = 0;
+    mWrittenSlots   = 0;
+    mFailedSlots    = 0;
+    mWriteScheduled = false;
+    for (auto & delegate : mDelegates)
+    {
+        delegate = nullptr;
+    }
+    mHasLegacyStore = false;
+}
+
+CHIP_ERROR CounterFileStore::ReadLeaseEnd(Slot slot, uint64_t & leaseEnd)
+{
+    VerifyOrReturnError(to_underlying(slot) < kSlotCount, CHIP_ERROR_INVALID_ARGUMENT);
+
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+        if (mStoredSlots & SlotBit(slot))
+        {
+            leaseEnd = mLeaseEnds[to_underlying(slot)];
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    VerifyOrReturnError(mHasLegacyStore, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    return mLegacyStore.ReadLeaseEnd(slot, leaseEnd);
+}
+
+CHIP_ERROR CounterFileStore::StoreLeaseEnd(Slot slot, uint64_t leaseEnd)
+{
+    VerifyOrReturnError(to_underlying(slot) < kSlotCount, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> writeLock(mWriteLock);
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+        mLeaseEnds[to_underlying(slot)] = leaseEnd;
+        mStoredSlots |= SlotBit(slot);
+    }
+    return WriteTable();
+}
+
+CHIP_ERROR CounterFileStore::RenewLeaseEnd(Slot slot, uint64_t leaseEnd, Delegate & delegate)
+{
+    VerifyOrReturnError(to_underlying(slot) < kSlotCount, CHIP_ERROR_INVALID_ARGUMENT);
+
+    bool scheduleWrite;
+    WorkContextRef context;
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+        context                         = mWorkContext;
+        mLeaseEnds[to_underlying(slot)] = leaseEnd;
+        mDelegates[to_underlying(slot)] = &delegate;
+        mStoredSlots |= SlotBit(slot);
+        mRequestedSlots |= SlotBit(slot);
+        scheduleWrite   = !mWriteScheduled;
+        mWriteScheduled = true;
+    }
+
+    if (scheduleWrite)
+    {
+        CHIP_ERROR err = QueueWork(context, WriteInBackground, true);
+        if (err != CHIP_NO_ERROR)
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            mWriteScheduled = false;
+            mRequestedSlots = static_cast<uint8_t>(mRequestedSlots & ~SlotBit(slot));
+            mDelegates[to_underlying(slot)] = nullptr;
+            return err;
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void CounterFileStore::CancelRenewals(Delegate & delegate)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    for (auto & registered : mDelegates)
+    {
+        if (registered == &delegate)
+        {
+            registered = nullptr;
+        }
+    }
+}
+
+CHIP_ERROR CounterFileStore::QueueWork(const WorkContextRef & context, void (*work)(intptr_t), bool inBackground)
+{
+    auto * ref = Platform::New<WorkContextRef>(context);
+    VerifyOrReturnError(ref != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    CHIP_ERROR err = inBackground ? PlatformMgr().ScheduleBackgroundWork(work, reinterpret_cast<intptr_t>(ref))
+                                  : PlatformMgr().ScheduleWork(work, reinterpret_cast<intptr_t>(ref));
+    if (err != CHIP_NO_ERROR)
+    {
+        Platform::Delete(ref);
+    }
+    return err;
+}
+
+CounterFileStore * CounterFileStore::TakeWorkContext(intptr_t work, WorkContextRef & context, std::unique_lock<std::mutex> & lock)
+{
+    auto * ref = reinterpret_cast<WorkContextRef *>(work);
+    context    = std::move(*ref);
+    Platform::Delete(ref);
+
+    lock = std::unique_lock<std::mutex>(context->lock);
+    return context->store;
+}
+
+void CounterFileStore::WriteInBackground(intptr_t work)
+{
+    WorkContextRef context;
+    std::unique_lock<std::mutex> workLock;
+    CounterFileStore * self = TakeWorkContext(work, context, workLock);
+    VerifyOrReturn(self != nullptr);
+
+    std::lock_guard<std::mutex> writeLock(self->mWriteLock);
+
+    uint8_t slots;
+    {
+        std::lock_guard<std::mutex> lock(self->mLock);
+        self->mWriteScheduled = false;
+        slots                 = self->mRequestedSlots;
+        self->mRequestedSlots = 0;
+    }
+    VerifyOrReturn(slots != 0);
+
+    CHIP_ERROR err = self->WriteTable();
+    {
+        std::lock_guard<std::mutex> lock(self->mLock);
+        if (err == CHIP_NO_ERROR)
+        {
+            self->mWrittenSlots |= slots;
+        }
+        else
+        {
+            ChipLogError(DeviceLayer, "Failed to write the counter file: %" CHIP_ERROR_FORMAT, err.Format());
+            self->mFailedSlots |= slots;
+            self->mWriteError = err;
+        }
+    }
+
+    err = QueueWork(context, ReportRenewals, false);
+    if (err != CHIP_NO_ERROR)
+    {
+        // The counters store their next lease synchronously once they run out of the current one.
+        ChipLogError(DeviceLayer, "Failed to report counter lease renewals: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+void CounterFileStore::ReportRenewals(intptr_t work)
+{
+    WorkContextRef context;
+    std::unique_lock<std::mutex> workLock;
+    CounterFileStore * self = TakeWorkContext(work, context, workLock);
+    VerifyOrReturn(self != nullptr);
+
+    struct Report
+    {
+        Delegate * delegate;
+        Slot slot;
+        uint64_t leaseEnd;
+        CHIP_ERROR err;
+    };
+    Report reports[kFileSlotCount];
+    size_t reportCount = 0;
+
+    // Collect the reports first, the delegates may request another renewal.
+    {
+        std::lock_guard<std::mutex> lock(self->mLock);
+        for (uint8_t i = 0; i < kSlotCount; i++)
+        {
+            const Slot slot = static_cast<Slot>(i);
+            if (((self->mWrittenSlots | self->mFailedSlots) & SlotBit(slot)) == 0 || self->mDelegates[i] == nullptr)
+            {
+                continue;
+            }
+            const bool failed      = (self->mFailedSlots & SlotBit(slot)) != 0;
+            reports[reportCount++] = { self->mDelegates[i], slot, self->mDurableLeaseEnds[i],
+                                       failed ? self->mWriteError : CHIP_NO_ERROR };
+            self->mDelegates[i]    = nullptr;
+        }
+        self->mWrittenSlots = 0;
+        self->mFailedSlots  = 0;
+    }
+
+    for (size_t i = 0; i < reportCount; i++)
+    {
+        reports[i].delegate->OnLeaseRenewed(reports[i].slot, reports[i].leaseEnd, reports[i].err);
+    }
+}
+
+CHIP_ERROR CounterFileStore::WriteTable()
+{
+    LeaseTable table;
+    int fd;
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+        fd                = mFd;
+        table.sequence    = mSequence + 1;
+        table.storedSlots = mStoredSlots;
+        memcpy(table.leaseEnds, mLeaseEnds, sizeof(table.leaseEnds));
+    }
+
+    uint8_t record[kRecordSize];
+    EncodeTable(table, record);
+
+    // Alternate between the copies: the previous table stays intact until this one is durable.  The sequence number only
+    // advances once the write succeeded, so a failed write is retried over the same copy.
+    off_t offset         = static_cast<off_t>(((table.sequence - 1) % kCopyCount) * kRecordSize);
+    const uint8_t * data = record;
+    size_t remaining     = sizeof(record);
+    while (remaining > 0)
+    {
+        ssize_t written = pwrite(fd, data, remaining, offset);
+        if (written < 0)
+        {
+            VerifyOrReturnError(errno == EINTR, CHIP_ERROR_POSIX(errno));
+            continue;
+        }
+        data += written;
+        offset += written;
+        remaining -= static_cast<size_t>(written);
+    }
+    VerifyOrReturnError(fdatasync(fd) == 0, CHIP_ERROR_POSIX(errno));
+
+    std::lock_guard<std::mutex> lock(mLock);
+    mSequence = table.sequence;
+    memcpy(mDurableLeaseEnds, table.leaseEnds, sizeof(mDurableLeaseEnds));
+    return CHIP_NO_ERROR;
+}
+
+} // namespace PersistedStorage
+} // namespace DeviceLayer
+} // namespace chip
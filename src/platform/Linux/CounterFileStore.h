@@ -0,0 +1,123 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Counter lease store for Linux, keeping the leases in a small
+ *          fixed-size file instead of the key-value store.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/support/CounterLeaseStore.h>
+
+#include <memory>
+#include <mutex>
+
+namespace chip {
+namespace DeviceLayer {
+namespace PersistedStorage {
+
+/**
+ * Keeps the leases of all the counters in one fixed-size file, next to the key-value store.
+ *
+ * Each write replaces one of two copies of the lease table in place with pwrite() and makes it durable with fdatasync(),
+ * alternating between the copies so that an interrupted write always leaves the previous table intact.  Unlike a write to the
+ * INI key-value store, it does not rewrite a whole file.
+ *
+ * Renewals are written through PlatformManager::ScheduleBackgroundWork() and reported on the Matter thread, and renewals
+ * requested while a write is queued share that write.  The queued work only refers to the store until it is shut down, so
+ * work still queued when the store is shut down or destroyed does nothing.
+ */
+class CounterFileStore : public CounterLeaseStore
+{
+public:
+    CounterFileStore() = default;
+    ~CounterFileStore() override;
+
+    /**
+     * Opens the counter file at `path`, creating it if needed.
+     *
+     * Counters without a lease in the file are read from `legacyStorage`, where they were kept before the file existed, so
+     * that they do not go backwards when moving to the file.
+     */
+    CHIP_ERROR Init(const char * path, PersistentStorageDelegate * legacyStorage = nullptr);
+
+    /// Waits for a write or report in progress and closes the file.  Renewals still queued are neither written nor reported.
+    /// Must not be called from Delegate::OnLeaseRenewed().
+    void Shutdown();
+
+    CHIP_ERROR ReadLeaseEnd(Slot slot, uint64_t & leaseEnd) override;
+    CHIP_ERROR StoreLeaseEnd(Slot slot, uint64_t leaseEnd) override;
+    CHIP_ERROR RenewLeaseEnd(Slot slot, uint64_t leaseEnd, Delegate & delegate) override;
+    void CancelRenewals(Delegate & delegate) override;
+
+    // Slots reserved in the file, so that counters can be added without changing its layout.
+    static constexpr uint8_t kFileSlotCount = 8;
+    static_assert(kSlotCount <= kFileSlotCount, "The counter file has no room for all the slots");
+
+private:
+    // Refers the queued work to the store, until the store is shut down.  The lock is held while the work runs.
+    struct WorkContext
+    {
+        std::mutex lock;
+        CounterFileStore * store = nullptr;
+    };
+    using WorkContextRef = std::shared_ptr<WorkContext>;
+
+    // Queues `work` on the background workers or on the Matter thread, passing it a new reference to `context`.
+    static CHIP_ERROR QueueWork(const WorkContextRef & context, void (*work)(intptr_t), bool inBackground);
+    // Takes the reference queued with `work` and returns the store it refers to, with `lock` holding the context lock, or
+    // nullptr if the store was shut down.
+    static CounterFileStore * TakeWorkContext(intptr_t work, WorkContextRef & context, std::unique_lock<std::mutex> & lock);
+
+    static void WriteInBackground(intptr_t work);
+    static void ReportRenewals(intptr_t work);
+
+    // Writes the lease table to the next copy in the file.  Must be called with mWriteLock held.
+    CHIP_ERROR WriteTable();
+
+    std::mutex mWriteLock; // serializes the writes to the file
+    std::mutex mLock;      // protects the members below
+
+    int mFd            = -1;
+    uint32_t mSequence = 0; // sequence number of the last table written
+
+    uint64_t mLeaseEnds[kFileSlotCount]        = {}; // most recently requested lease ends
+    uint64_t mDurableLeaseEnds[kFileSlotCount] = {}; // lease ends of the last table written
+    uint8_t mStoredSlots                       = 0;  // bitmap of the slots set in mLeaseEnds
+
+    // Renewals waiting for the next write, and renewals written (or failed) waiting to be reported.
+    uint8_t mRequestedSlots = 0;
+    uint8_t mWrittenSlots   = 0;
+    uint8_t mFailedSlots    = 0;
+    CHIP_ERROR mWriteError  = CHIP_NO_ERROR;
+    bool mWriteScheduled    = false;
+
+    Delegate * mDelegates[kFileSlotCount] = {};
+
+    WorkContextRef mWorkContext; // set while the file is open
+
+    PersistentStorageCounterLeaseStore mLegacyStore;
+    bool mHasLegacyStore = false;
+};
+
+} // namespace PersistedStorage
+} // namespace DeviceLayer
+} // namespace chip
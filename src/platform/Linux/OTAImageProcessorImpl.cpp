@@ -21,10 +21,46 @@
 
 #include "OTAImageProcessorImpl.h"
 
+#include <system/SystemError.h>
+
+#include <errno.h>
+#include <fcntl.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
 namespace chip {
 
+namespace {
+
+/// Returns the length of the digest for truncated SHA-256 digest types, or 0 for digests that cannot be verified here.
+size_t Sha256DigestLength(OTAImageDigestType type)
+{
+    switch (type)
+    {
+    case OTAImageDigestType::kSha256:
+        return 32;
+    case OTAImageDigestType::kSha256_128:
+        return 16;
+    case OTAImageDigestType::kSha256_120:
+        return 15;
+    case OTAImageDigestType::kSha256_96:
+        return 12;
+    case OTAImageDigestType::kSha256_64:
+        return 8;
+    case OTAImageDigestType::kSha256_32:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+} // namespace
+
+OTAImageProcessorImpl::~OTAImageProcessorImpl()
+{
+    StopWriter();
+}
+
 CHIP_ERROR OTAImageProcessorImpl::PrepareDownload()
 {
     if (mImageFile == nullptr)
@@ -39,6 +75,8 @@ CHIP_ERROR OTAImageProcessorImpl::PrepareDownload()
 
 CHIP_ERROR OTAImageProcessorImpl::Finalize()
 {
+    VerifyOrReturnError(mWriterThread.joinable(), CHIP_ERROR_INCORRECT_STATE);
+
     DeviceLayer::PlatformMgr().ScheduleWork(HandleFinalize, reinterpret_cast<intptr_t>(this));
     return CHIP_NO_ERROR;
 }
@@ -63,16 +101,27 @@ CHIP_ERROR OTAImageProcessorImpl::Abort()
 
 CHIP_ERROR OTAImageProcessorImpl::ProcessBlock(ByteSpan & block)
 {
-    if (!mOfs.is_open() || !mOfs.good())
+    if (!mWriterThread.joinable())
     {
         return CHIP_ERROR_INTERNAL;
     }
 
-    // Store block data for HandleProcessBlock to access
-    CHIP_ERROR err = SetBlock(block);
-    if (err != CHIP_NO_ERROR)
+    // The header is small and parsed in place; only the payload is handed to the writer thread.
+    ByteSpan payload = block;
+    mHeaderStatus    = ProcessHeader(payload);
+    if (mHeaderStatus != CHIP_NO_ERROR)
+    {
+        ChipLogError(SoftwareUpdate, "Image does not contain a valid header");
+        mHeaderStatus = CHIP_ERROR_INVALID_FILE_IDENTIFIER;
+    }
+    else
     {
-        ChipLogError(SoftwareUpdate, "Cannot set block data: %" CHIP_ERROR_FORMAT, err.Format());
+        CHIP_ERROR err = EnqueueBlock(payload);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(SoftwareUpdate, "Cannot queue block data: %" CHIP_ERROR_FORMAT, err.Format());
+            mHeaderStatus = err;
+        }
     }
 
     DeviceLayer::PlatformMgr().ScheduleWork(HandleProcessBlock, reinterpret_cast<intptr_t>(this));
@@ -125,32 +174,59 @@ void OTAImageProcessorImpl::HandlePrepareDownload(intptr_t context)
         return;
     }
 
+    imageProcessor->StopWriter();
     unlink(imageProcessor->mImageFile);
 
     imageProcessor->mParams.downloadedBytes = 0;
     imageProcessor->mParams.totalFileBytes  = 0;
+    imageProcessor->mHeaderStatus           = CHIP_NO_ERROR;
+    imageProcessor->mImageVerified          = false;
+    imageProcessor->mHasExpectedDigest      = false;
     imageProcessor->mHeaderParser.Init();
-    imageProcessor->mOfs.open(imageProcessor->mImageFile, std::ofstream::out | std::ofstream::ate | std::ofstream::app);
-    if (!imageProcessor->mOfs.good())
+
+    imageProcessor->mDownloader->OnPreparedForDownload(imageProcessor->StartWriter());
+}
+
+void OTAImageProcessorImpl::HandleFinalize(intptr_t context)
+{
+    auto * imageProcessor = reinterpret_cast<OTAImageProcessorImpl *>(context);
+    if (imageProcessor == nullptr)
     {
-        imageProcessor->mDownloader->OnPreparedForDownload(CHIP_ERROR_OPEN_FAILED);
         return;
     }
 
-    imageProcessor->mDownloader->OnPreparedForDownload(CHIP_NO_ERROR);
+    // The writer thread reports completion through HandleWriterDone once the queue is drained.
+    {
+        std::lock_guard<std::mutex> lock(imageProcessor->mQueueLock);
+        imageProcessor->mFinalizeRequested = true;
+    }
+    imageProcessor->mQueueCondition.notify_all();
 }
 
-void OTAImageProcessorImpl::HandleFinalize(intptr_t context)
+void OTAImageProcessorImpl::HandleWriterDone(intptr_t context)
 {
     auto * imageProcessor = reinterpret_cast<OTAImageProcessorImpl *>(context);
-    if (imageProcessor == nullptr)
+    if (imageProcessor == nullptr || !imageProcessor->mWriterThread.joinable())
     {
+        // Aborted while the completion was in flight.
         return;
     }
 
-    imageProcessor->mOfs.close();
-    imageProcessor->ReleaseBlock();
+    CHIP_ERROR status;
+    {
+        std::lock_guard<std::mutex> lock(imageProcessor->mQueueLock);
+        status = imageProcessor->mWriterStatus;
+    }
+    imageProcessor->StopWriter();
 
+    if (status != CHIP_NO_ERROR)
+    {
+        ChipLogError(SoftwareUpdate, "OTA image verification failed: %" CHIP_ERROR_FORMAT, status.Format());
+        unlink(imageProcessor->mImageFile);
+        return;
+    }
+
+    imageProcessor->mImageVerified = true;
     ChipLogProgress(SoftwareUpdate, "OTA image downloaded to %s", imageProcessor->mImageFile);
 }
 
@@ -162,6 +238,12 @@ void OTAImageProcessorImpl::HandleApply(intptr_t context)
     OTARequestorInterface * requestor = chip::GetRequestorInstance();
     VerifyOrReturn(requestor != nullptr);
 
+    if (!imageProcessor->mImageVerified)
+    {
+        ChipLogError(SoftwareUpdate, "Refusing to apply an OTA image that was not completely written and verified");
+        return;
+    }
+
     // Move the downloaded image to the location where the new image is to be executed from
     unlink(kImageExecPath);
     rename(imageProcessor->mImageFile, kImageExecPath);
@@ -180,9 +262,9 @@ void OTAImageProcessorImpl::HandleAbort(intptr_t context)
         return;
     }
 
-    imageProcessor->mOfs.close();
+    imageProcessor->StopWriter();
+    imageProcessor->mImageVerified = false;
     unlink(imageProcessor->mImageFile);
-    imageProcessor->ReleaseBlock();
 }
 
 void OTAImageProcessorImpl::HandleProcessBlock(intptr_t context)
@@ -199,22 +281,46 @@ void OTAImageProcessorImpl::HandleProcessBlock(intptr_t context)
         return;
     }
 
-    ByteSpan block   = imageProcessor->mBlock;
-    CHIP_ERROR error = imageProcessor->ProcessHeader(block);
-    if (error != CHIP_NO_ERROR)
+    if (imageProcessor->mHeaderStatus != CHIP_NO_ERROR)
     {
-        ChipLogError(SoftwareUpdate, "Image does not contain a valid header");
-        imageProcessor->mDownloader->EndDownload(CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+        imageProcessor->mDownloader->EndDownload(imageProcessor->mHeaderStatus);
         return;
     }
 
-    if (!imageProcessor->mOfs.write(reinterpret_cast<const char *>(block.data()), static_cast<std::streamsize>(block.size())))
+    bool canFetch;
+    {
+        std::lock_guard<std::mutex> lock(imageProcessor->mQueueLock);
+        VerifyOrReturn(imageProcessor->mWriterStatus == CHIP_NO_ERROR,
+                       imageProcessor->mDownloader->EndDownload(imageProcessor->mWriterStatus));
+
+        // When the writer falls behind, defer the next fetch until it frees a queue slot.
+        canFetch                       = imageProcessor->mQueueCount < kWriterQueueDepth;
+        imageProcessor->mFetchPending = !canFetch;
+    }
+
+    if (canFetch)
+    {
+        imageProcessor->mDownloader->FetchNextData();
+    }
+}
+
+void OTAImageProcessorImpl::HandleBlockWritten(intptr_t context)
+{
+    auto * imageProcessor = reinterpret_cast<OTAImageProcessorImpl *>(context);
+    VerifyOrReturn(imageProcessor != nullptr && imageProcessor->mDownloader != nullptr);
+
+    CHIP_ERROR status;
+    {
+        std::lock_guard<std::mutex> lock(imageProcessor->mQueueLock);
+        status = imageProcessor->mWriterStatus;
+    }
+
+    if (status != CHIP_NO_ERROR)
     {
-        imageProcessor->mDownloader->EndDownload(CHIP_ERROR_WRITE_FAILED);
+        imageProcessor->mDownloader->EndDownload(status);
         return;
     }
 
-    imageProcessor->mParams.downloadedBytes += block.size();
     imageProcessor->mDownloader->FetchNextData();
 }
 
@@ -230,49 +336,186 @@ CHIP_ERROR OTAImageProcessorImpl::ProcessHeader(ByteSpan & block)
         ReturnErrorOnFailure(error);
 
         mParams.totalFileBytes = header.mPayloadSize;
+
+        // The header digest points into the parser buffer, so keep a copy for verification.
+        mExpectedDigestLen = Sha256DigestLength(header.mImageDigestType);
+        mHasExpectedDigest = (mExpectedDigestLen != 0) && (header.mImageDigest.size() == mExpectedDigestLen);
+        if (mHasExpectedDigest)
+        {
+            memcpy(mExpectedDigest, header.mImageDigest.data(), mExpectedDigestLen);
+        }
         mHeaderParser.Clear();
     }
 
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR OTAImageProcessorImpl::SetBlock(ByteSpan & block)
+CHIP_ERROR OTAImageProcessorImpl::EnqueueBlock(const ByteSpan & block)
 {
-    if (block.empty())
+    VerifyOrReturnError(!block.empty(), CHIP_NO_ERROR);
+
     {
-        ReleaseBlock();
-        return CHIP_NO_ERROR;
+        std::lock_guard<std::mutex> lock(mQueueLock);
+        ReturnErrorOnFailure(mWriterStatus);
+        VerifyOrReturnError(mQueueCount < kWriterQueueDepth, CHIP_ERROR_NO_MEMORY);
+
+        QueuedBlock & slot = mQueue[(mQueueHead + mQueueCount) % kWriterQueueDepth];
+        if (slot.mCapacity < block.size())
+        {
+            slot.mBuffer.Alloc(block.size());
+            VerifyOrReturnError(slot.mBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+            slot.mCapacity = block.size();
+        }
+        memcpy(slot.mBuffer.Get(), block.data(), block.size());
+        slot.mLength = block.size();
+        mQueueCount++;
+    }
+    mQueueCondition.notify_one();
+
+    mParams.downloadedBytes += block.size();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageProcessorImpl::StartWriter()
+{
+    mFd = open(mImageFile, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_OPEN_FAILED);
+
+    mWriteOffset = 0;
+    if (mPayloadHash.Begin() != CHIP_NO_ERROR)
+    {
+        close(mFd);
+        mFd = -1;
+        return CHIP_ERROR_INTERNAL;
     }
-    if (mBlock.size() < block.size())
+
+    {
+        std::lock_guard<std::mutex> lock(mQueueLock);
+        mQueueHead         = 0;
+        mQueueCount        = 0;
+        mStopWriter        = false;
+        mFinalizeRequested = false;
+        mFetchPending      = false;
+        mWriterStatus      = CHIP_NO_ERROR;
+    }
+
+    mWriterThread = std::thread(&OTAImageProcessorImpl::WriterLoop, this);
+    return CHIP_NO_ERROR;
+}
+
+void OTAImageProcessorImpl::StopWriter()
+{
+    if (mWriterThread.joinable())
     {
-        if (!mBlock.empty())
         {
-            ReleaseBlock();
+            std::lock_guard<std::mutex> lock(mQueueLock);
+            mStopWriter = true;
         }
-        uint8_t * mBlock_ptr = static_cast<uint8_t *>(chip::Platform::MemoryAlloc(block.size()));
-        if (mBlock_ptr == nullptr)
+        mQueueCondition.notify_all();
+        mWriterThread.join();
+    }
+
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+
+    for (auto & slot : mQueue)
+    {
+        slot.mBuffer.Free();
+        slot.mCapacity = 0;
+        slot.mLength   = 0;
+    }
+    mQueueHead  = 0;
+    mQueueCount = 0;
+}
+
+void OTAImageProcessorImpl::WriterLoop()
+{
+    std::unique_lock<std::mutex> lock(mQueueLock);
+    while (true)
+    {
+        mQueueCondition.wait(lock, [this] { return mStopWriter || mQueueCount > 0 || mFinalizeRequested; });
+        if (mStopWriter)
+        {
+            return;
+        }
+
+        if (mQueueCount == 0)
+        {
+            // Finalize requested and every block has landed: the digest is already up to date.
+            lock.unlock();
+            CHIP_ERROR err = FinishDigest();
+            lock.lock();
+            if (mWriterStatus == CHIP_NO_ERROR)
+            {
+                mWriterStatus = err;
+            }
+            mFinalizeRequested = false;
+            DeviceLayer::PlatformMgr().ScheduleWork(HandleWriterDone, reinterpret_cast<intptr_t>(this));
+            return;
+        }
+
+        QueuedBlock & slot = mQueue[mQueueHead];
+        ByteSpan block(slot.mBuffer.Get(), slot.mLength);
+
+        lock.unlock();
+        CHIP_ERROR err = WriteBlock(block);
+        lock.lock();
+
+        mQueueHead = (mQueueHead + 1) % kWriterQueueDepth;
+        mQueueCount--;
+
+        if (err != CHIP_NO_ERROR && mWriterStatus == CHIP_NO_ERROR)
         {
-            return CHIP_ERROR_NO_MEMORY;
+            ChipLogError(SoftwareUpdate, "Failed to write OTA block: %" CHIP_ERROR_FORMAT, err.Format());
+            mWriterStatus = err;
+        }
+
+        if (mFetchPending)
+        {
+            mFetchPending = false;
+            DeviceLayer::PlatformMgr().ScheduleWork(HandleBlockWritten, reinterpret_cast<intptr_t>(this));
         }
-        mBlock = MutableByteSpan(mBlock_ptr, block.size());
     }
-    CHIP_ERROR err = CopySpanToMutableSpan(block, mBlock);
-    if (err != CHIP_NO_ERROR)
+}
+
+CHIP_ERROR OTAImageProcessorImpl::WriteBlock(const ByteSpan & block)
+{
+    const uint8_t * data = block.data();
+    size_t remaining     = block.size();
+    while (remaining > 0)
     {
-        ChipLogError(SoftwareUpdate, "Cannot copy block data: %" CHIP_ERROR_FORMAT, err.Format());
-        return err;
+        ssize_t written = pwrite(mFd, data, remaining, static_cast<off_t>(mWriteOffset));
+        if (written < 0)
+        {
+            VerifyOrReturnError(errno == EINTR, CHIP_ERROR_POSIX(errno));
+            continue;
+        }
+        data += written;
+        remaining -= static_cast<size_t>(written);
+        mWriteOffset += static_cast<uint64_t>(written);
     }
-    return CHIP_NO_ERROR;
+
+    return mPayloadHash.AddData(block);
 }
 
-CHIP_ERROR OTAImageProcessorImpl::ReleaseBlock()
+CHIP_ERROR OTAImageProcessorImpl::FinishDigest()
 {
-    if (mBlock.data() != nullptr)
+    VerifyOrReturnError(fdatasync(mFd) == 0, CHIP_ERROR_POSIX(errno));
+
+    uint8_t digestBuffer[Crypto::kSHA256_Hash_Length];
+    MutableByteSpan digest(digestBuffer);
+    ReturnErrorOnFailure(mPayloadHash.Finish(digest));
+
+    if (!mHasExpectedDigest)
     {
-        chip::Platform::MemoryFree(mBlock.data());
+        ChipLogProgress(SoftwareUpdate, "OTA image digest type is not SHA-256 based, skipping verification");
+        return CHIP_NO_ERROR;
     }
 
-    mBlock = MutableByteSpan();
+    VerifyOrReturnError(memcmp(digest.data(), mExpectedDigest, mExpectedDigestLen) == 0, CHIP_ERROR_INTEGRITY_CHECK_FAILED);
     return CHIP_NO_ERROR;
 }
 
@@ -19,20 +19,37 @@
 #pragma once
 
 #include <app/clusters/ota-requestor/OTADownloader.h>
+#include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/OTAImageHeader.h>
+#include <lib/support/ScopedBuffer.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <platform/OTAImageProcessor.h>
 
-#include <fstream>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 namespace chip {
 
 // Full file path to where the new image will be executed from post-download
 static char kImageExecPath[] = "/tmp/ota.update";
 
+/**
+ * Linux OTA image processor.
+ *
+ * Downloaded blocks are handed off to a dedicated writer thread through a bounded queue, so the
+ * Matter event loop never blocks on disk I/O. The writer appends the payload with pwrite() and
+ * feeds it to a streaming SHA-256, so the image digest from the OTA header is verified as soon as
+ * the last block has been written, without re-reading the file.
+ */
 class OTAImageProcessorImpl : public OTAImageProcessorInterface
 {
 public:
+    // Number of blocks that may be queued for the writer thread before the download is throttled.
+    static constexpr size_t kWriterQueueDepth = 8;
+
+    ~OTAImageProcessorImpl();
+
     //////////// OTAImageProcessorInterface Implementation ///////////////
     CHIP_ERROR PrepareDownload() override;
     CHIP_ERROR Finalize() override;
@@ -52,24 +69,55 @@ private:
     static void HandleApply(intptr_t context);
     static void HandleAbort(intptr_t context);
     static void HandleProcessBlock(intptr_t context);
+    static void HandleBlockWritten(intptr_t context);
+    static void HandleWriterDone(intptr_t context);
 
     CHIP_ERROR ProcessHeader(ByteSpan & block);
 
     /**
-     * Called to allocate memory for mBlock if necessary and set it to block
+     * Copy the payload part of a block into a free writer queue slot.
      */
-    CHIP_ERROR SetBlock(ByteSpan & block);
+    CHIP_ERROR EnqueueBlock(const ByteSpan & block);
 
-    /**
-     * Called to release allocated memory for mBlock
-     */
-    CHIP_ERROR ReleaseBlock();
+    CHIP_ERROR StartWriter();
+    void StopWriter();
+    void WriterLoop();
+    CHIP_ERROR WriteBlock(const ByteSpan & block);
+    CHIP_ERROR FinishDigest();
+
+    struct QueuedBlock
+    {
+        Platform::ScopedMemoryBuffer<uint8_t> mBuffer;
+        size_t mCapacity = 0;
+        size_t mLength   = 0;
+    };
+
+    // State shared with the writer thread, guarded by mQueueLock.
+    std::mutex mQueueLock;
+    std::condition_variable mQueueCondition;
+    QueuedBlock mQueue[kWriterQueueDepth];
+    size_t mQueueHead        = 0;
+    size_t mQueueCount       = 0;
+    bool mStopWriter         = false;
+    bool mFinalizeRequested  = false;
+    bool mFetchPending       = false;
+    CHIP_ERROR mWriterStatus = CHIP_NO_ERROR;
+
+    // Owned by the writer thread while it is running.
+    std::thread mWriterThread;
+    int mFd               = -1;
+    uint64_t mWriteOffset = 0;
+    Crypto::Hash_SHA256_stream mPayloadHash;
 
-    std::ofstream mOfs;
-    MutableByteSpan mBlock;
+    // Matter thread state.
     OTADownloader * mDownloader;
     OTAImageHeaderParser mHeaderParser;
     const char * mImageFile = nullptr;
+    CHIP_ERROR mHeaderStatus  = CHIP_NO_ERROR;
+    bool mImageVerified       = false;
+    bool mHasExpectedDigest   = false;
+    size_t mExpectedDigestLen = 0;
+    uint8_t mExpectedDigest[Crypto::kSHA256_Hash_Length];
 };
 
 } // namespace chip
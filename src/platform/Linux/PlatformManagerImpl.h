@@ -97,6 +97,12 @@ public:
 
     System::Clock::Timestamp GetStartTime() { return mStartTime; }
 
+    /**
+     * Starts the background event loop with @p workerCount threads instead of
+     * CHIP_DEVICE_CONFIG_BG_WORKER_COUNT, e.g. to size the session establishment crypto pool at runtime.
+     */
+    using Internal::GenericPlatformManagerImpl_POSIX<PlatformManagerImpl>::StartBackgroundWorkers;
+
 private:
     // ===== Methods that implement the PlatformManager abstract interface.
 
@@ -84,6 +84,15 @@ private:
         return _PostEvent(&event);
     }
 
+    CHIP_ERROR _ScheduleWorkBatch(Span<const AsyncWorkItem> items)
+    {
+        for (const AsyncWorkItem & item : items)
+        {
+            ReturnErrorOnFailure(_ScheduleWork(item.WorkFunct, item.Arg));
+        }
+        return CHIP_NO_ERROR;
+    }
+
     void _RunEventLoop()
     {
         do
@@ -161,6 +170,7 @@ private:
     void _RunBackgroundEventLoop(void) {}
     CHIP_ERROR _StartBackgroundEventLoopTask(void) { return CHIP_ERROR_NOT_IMPLEMENTED; }
     CHIP_ERROR _StopBackgroundEventLoopTask() { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    bool _IsBackgroundEventLoopRunning() { return false; }
 
     CHIP_ERROR _StartChipTimer(System::Clock::Timeout duration) { return CHIP_ERROR_NOT_IMPLEMENTED; }
 
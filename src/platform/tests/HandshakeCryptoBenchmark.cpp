@@ -0,0 +1,158 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures the rate of CASE handshakes whose crypto runs on the
+ *      background workers of the POSIX platform manager, for several
+ *      worker counts, e.g. to pick CHIP_DEVICE_CONFIG_BG_WORKER_COUNT.
+ *
+ *      Usage: handshake-crypto-benchmark [worker-count...]
+ */
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+using namespace chip;
+using namespace chip::DeviceLayer;
+
+namespace {
+
+constexpr size_t kHandshakeCount = 200;
+
+Crypto::P256Keypair sPeerEphemeralKey;
+std::atomic<size_t> sHandshakesCompleted{ 0 };
+std::atomic<size_t> sHandshakesFailed{ 0 };
+
+void CompleteHandshake(intptr_t)
+{
+    sHandshakesCompleted++;
+}
+
+// The asymmetric crypto of one side of a CASE handshake: an ephemeral key pair, the shared secret, the
+// signature of its own TBS data, and the checks of the peer's certificate chain and signature.
+CHIP_ERROR HandshakeCrypto()
+{
+    static constexpr uint8_t kTbsData[] = "CASE TBS data";
+
+    Crypto::P256Keypair ephemeralKey;
+    ReturnErrorOnFailure(ephemeralKey.Initialize(Crypto::ECPKeyTarget::ECDH));
+
+    Crypto::P256ECDHDerivedSecret sharedSecret;
+    ReturnErrorOnFailure(ephemeralKey.ECDH_derive_secret(sPeerEphemeralKey.Pubkey(), sharedSecret));
+
+    Crypto::P256ECDSASignature signature;
+    ReturnErrorOnFailure(ephemeralKey.ECDSA_sign_msg(kTbsData, sizeof(kTbsData), signature));
+    for (size_t i = 0; i < 3; i++)
+    {
+        ReturnErrorOnFailure(ephemeralKey.Pubkey().ECDSA_validate_msg_signature(kTbsData, sizeof(kTbsData), signature));
+    }
+    return CHIP_NO_ERROR;
+}
+
+void RunHandshakeCrypto(intptr_t)
+{
+    if (HandshakeCrypto() != CHIP_NO_ERROR || PlatformMgr().ScheduleWork(CompleteHandshake) != CHIP_NO_ERROR)
+    {
+        sHandshakesFailed++;
+    }
+}
+
+// Runs the crypto of kHandshakeCount concurrent handshakes on workerCount background workers, completing each of
+// them on the Matter thread, and returns the rate of completed handshakes.
+CHIP_ERROR RunHandshakeCryptoBenchmark(size_t workerCount, double & rate)
+{
+    sHandshakesCompleted = 0;
+    sHandshakesFailed    = 0;
+    ReturnErrorOnFailure(PlatformMgrImpl().StartBackgroundWorkers(workerCount));
+    ReturnErrorOnFailure(PlatformMgr().StartEventLoopTask());
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kHandshakeCount; i++)
+    {
+        if (PlatformMgr().ScheduleBackgroundWork(RunHandshakeCrypto) != CHIP_NO_ERROR)
+        {
+            sHandshakesFailed++;
+        }
+    }
+    for (size_t t = 0; sHandshakesCompleted + sHandshakesFailed < kHandshakeCount && t < 60000; t++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    ReturnErrorOnFailure(PlatformMgr().StopEventLoopTask());
+    ReturnErrorOnFailure(PlatformMgr().StopBackgroundEventLoopTask());
+
+    VerifyOrReturnError(sHandshakesCompleted == kHandshakeCount, CHIP_ERROR_INTERNAL);
+    rate = seconds > 0 ? static_cast<double>(kHandshakeCount) / seconds : 0;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    std::vector<size_t> workerCounts;
+    for (int i = 1; i < argc; i++)
+    {
+        int workerCount = atoi(argv[i]);
+        if (workerCount <= 0)
+        {
+            ChipLogError(DeviceLayer, "Invalid worker count: %s", argv[i]);
+            return EXIT_FAILURE;
+        }
+        workerCounts.push_back(static_cast<size_t>(workerCount));
+    }
+    if (workerCounts.empty())
+    {
+        workerCounts = { 1, 2, 4 };
+    }
+
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+    VerifyOrDie(PlatformMgr().InitChipStack() == CHIP_NO_ERROR);
+    VerifyOrDie(sPeerEphemeralKey.Initialize(Crypto::ECPKeyTarget::ECDH) == CHIP_NO_ERROR);
+
+    int status = EXIT_SUCCESS;
+    for (size_t workerCount : workerCounts)
+    {
+        double rate    = 0;
+        CHIP_ERROR err = RunHandshakeCryptoBenchmark(workerCount, rate);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DeviceLayer, "Handshake crypto on %u background workers failed: %" CHIP_ERROR_FORMAT,
+                         static_cast<unsigned>(workerCount), err.Format());
+            status = EXIT_FAILURE;
+            break;
+        }
+        ChipLogProgress(DeviceLayer, "Handshake crypto on %u background workers: %.0f sessions/s",
+                        static_cast<unsigned>(workerCount), rate);
+    }
+
+    PlatformMgr().Shutdown();
+    Platform::MemoryShutdown();
+    return status;
+}
@@ -0,0 +1,153 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures the rate at which the event loop task of the platform
+ *      manager runs work items posted from several threads, scheduled one
+ *      at a time with ScheduleWork() or in batches with
+ *      ScheduleWorkBatch().
+ *
+ *      Usage: schedule-work-benchmark [batch-size...]
+ */
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+using namespace chip;
+using namespace chip::DeviceLayer;
+
+namespace {
+
+constexpr size_t kProducerCount    = 4;
+constexpr size_t kItemsPerProducer = 20000;
+constexpr size_t kTotalItems       = kProducerCount * kItemsPerProducer;
+
+std::atomic<size_t> sRunCount{ 0 };
+std::atomic<size_t> sScheduleFailures{ 0 };
+
+void CountWork(intptr_t)
+{
+    sRunCount++;
+}
+
+// Posts the items of one producer, one at a time or in batches.
+void Produce(const std::vector<AsyncWorkItem> & items)
+{
+    for (size_t posted = 0; posted < kItemsPerProducer; posted += items.size())
+    {
+        CHIP_ERROR err = CHIP_NO_ERROR;
+        if (items.size() == 1)
+        {
+            err = PlatformMgr().ScheduleWork(CountWork);
+        }
+        else
+        {
+            err = PlatformMgr().ScheduleWorkBatch(Span<const AsyncWorkItem>(items.data(), items.size()));
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            sScheduleFailures++;
+        }
+    }
+}
+
+CHIP_ERROR RunScheduleWorkBenchmark(size_t batchSize, double & rate)
+{
+    // Batches must divide the items of each producer evenly.
+    VerifyOrReturnError(kItemsPerProducer % batchSize == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    const std::vector<AsyncWorkItem> items(batchSize, AsyncWorkItem{ CountWork, 0 });
+
+    sRunCount         = 0;
+    sScheduleFailures = 0;
+    ReturnErrorOnFailure(PlatformMgr().StartEventLoopTask());
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < kProducerCount; p++)
+    {
+        producers.emplace_back(Produce, std::cref(items));
+    }
+    for (auto & producer : producers)
+    {
+        producer.join();
+    }
+
+    for (size_t t = 0; sRunCount < kTotalItems && t < 10000; t++)
+        chip::test_utils::SleepMillis(1);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    ReturnErrorOnFailure(PlatformMgr().StopEventLoopTask());
+    VerifyOrReturnError(sScheduleFailures == 0, CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(sRunCount == kTotalItems, CHIP_ERROR_TIMEOUT);
+
+    rate = seconds > 0 ? static_cast<double>(kTotalItems) / seconds : 0;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    std::vector<size_t> batchSizes;
+    for (int i = 1; i < argc; i++)
+    {
+        int batchSize = atoi(argv[i]);
+        if (batchSize <= 0)
+        {
+            ChipLogError(DeviceLayer, "Invalid batch size: %s", argv[i]);
+            return EXIT_FAILURE;
+        }
+        batchSizes.push_back(static_cast<size_t>(batchSize));
+    }
+    if (batchSizes.empty())
+    {
+        batchSizes = { 1, 32 };
+    }
+
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+    VerifyOrDie(PlatformMgr().InitChipStack() == CHIP_NO_ERROR);
+
+    int status = EXIT_SUCCESS;
+    for (size_t batchSize : batchSizes)
+    {
+        double rate    = 0;
+        CHIP_ERROR err = RunScheduleWorkBenchmark(batchSize, rate);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DeviceLayer, "Cross-thread ScheduleWork in batches of %u failed: %" CHIP_ERROR_FORMAT,
+                         static_cast<unsigned>(batchSize), err.Format());
+            status = EXIT_FAILURE;
+            break;
+        }
+        ChipLogProgress(DeviceLayer, "Cross-thread ScheduleWork in batches of %u: %.0f items/s", static_cast<unsigned>(batchSize),
+                        rate);
+    }
+
+    PlatformMgr().Shutdown();
+    Platform::MemoryShutdown();
+    return status;
+}
@@ -0,0 +1,286 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Unit tests for the Linux counter lease file.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/LeasedCounter.h>
+#include <lib/support/PersistedCounter.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <platform/Linux/CounterFileStore.h>
+#include <platform/TestOnlyCommissionableDataProvider.h>
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer;
+using namespace chip::DeviceLayer::PersistedStorage;
+
+namespace {
+
+using Slot = CounterLeaseStore::Slot;
+
+constexpr size_t kCounterFileSize = 160;
+
+class TestCounterFileStore : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
+
+        // Required by the internals of the device layer when the stack is initialized.
+        static TestOnlyCommissionableDataProvider commissionable_data_provider;
+        SetCommissionableDataProvider(&commissionable_data_provider);
+    }
+
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        strcpy(mPath, "/tmp/chip-counters-XXXXXX");
+        int fd = mkstemp(mPath);
+        ASSERT_GE(fd, 0);
+        close(fd);
+    }
+
+    void TearDown() override { unlink(mPath); }
+
+    off_t FileSize()
+    {
+        struct stat st;
+        return (stat(mPath, &st) == 0) ? st.st_size : -1;
+    }
+
+    void Overwrite(off_t offset, const char * bytes)
+    {
+        int fd = open(mPath, O_WRONLY);
+        ASSERT_GE(fd, 0);
+        EXPECT_EQ(pwrite(fd, bytes, strlen(bytes), offset), static_cast<ssize_t>(strlen(bytes)));
+        close(fd);
+    }
+
+    char mPath[32];
+};
+
+class RecordingDelegate : public CounterLeaseStore::Delegate
+{
+public:
+    void OnLeaseRenewed(Slot slot, uint64_t leaseEnd, CHIP_ERROR err) override
+    {
+        mCalls++;
+        mSlot     = slot;
+        mLeaseEnd = leaseEnd;
+        mError    = err;
+        PlatformMgr().StopEventLoopTask();
+    }
+
+    unsigned mCalls    = 0;
+    Slot mSlot         = Slot::kEventNumber;
+    uint64_t mLeaseEnd = 0;
+    CHIP_ERROR mError  = CHIP_NO_ERROR;
+};
+
+void StopOnTimeout(System::Layer *, void *)
+{
+    PlatformMgr().StopEventLoopTask();
+}
+
+TEST_F(TestCounterFileStore, TestStoresAndReloadsLeases)
+{
+    {
+        CounterFileStore store;
+        EXPECT_EQ(store.Init(mPath), CHIP_NO_ERROR);
+
+        uint64_t leaseEnd = 0;
+        EXPECT_EQ(store.ReadLeaseEnd(Slot::kEventNumber, leaseEnd), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+        EXPECT_EQ(store.StoreLeaseEnd(Slot::kEventNumber, 100), CHIP_NO_ERROR);
+        EXPECT_EQ(store.StoreLeaseEnd(Slot::kGroupDataCounter, 7), CHIP_NO_ERROR);
+        for (uint64_t i = 0; i < 10; i++)
+        {
+            EXPECT_EQ(store.StoreLeaseEnd(Slot::kGroupControlCounter, 0x100000000ULL + i), CHIP_NO_ERROR);
+        }
+    }
+
+    // Both copies of the table are written in place, the file does not grow.
+    EXPECT_EQ(FileSize(), static_cast<off_t>(kCounterFileSize));
+
+    CounterFileStore store;
+    EXPECT_EQ(store.Init(mPath), CHIP_NO_ERROR);
+
+    uint64_t leaseEnd = 0;
+    EXPECT_EQ(store.ReadLeaseEnd(Slot::kEventNumber, leaseEnd), CHIP_NO_ERROR);
+    EXPECT_EQ(leaseEnd, 100ULL);
+    EXPECT_EQ(store.ReadLeaseEnd(Slot::kGroupDataCounter, leaseEnd), CHIP_NO_ERROR);
+    EXPECT_EQ(leaseEnd, 7ULL);
+    EXPECT_EQ(store.ReadLeaseEnd(Slot::kGroupControlCounter, leaseEnd), CHIP_NO_ERROR);
+    EXPECT_EQ(leaseEnd, 0x100000009ULL);
+
+    // The store is initialized once.
+    EXPECT_EQ(store.Init(mPath), CHIP_ERROR_INCORRECT_STATE);
+}
+
+TEST_F(TestCounterFileStore, TestSurvivesInterruptedWrites)
+{
+    // An interrupted very first write leaves no lease that a counter may have used.
+    Overwrite(0, "garbage");
+    {
+        CounterFileStore store;
+        EXPECT_EQ(store.Init(mPath), CHIP_NO_ERROR);
+        EXPECT_EQ(store.StoreLeaseEnd(Slot::kEventNumber, 100), CHIP_NO_ERROR);
+        EXPECT_EQ(store.StoreLeaseEnd(Slot::kEventNumber, 200), CHIP_NO_ERROR);
+    }
+
+    // Damage the second copy, as a write interrupted halfway would: the previous table is used.
+    Overwrite(kCounterFileSize / 2 + 12, "garbage");
+    {
+        CounterFileStore store;
+        EXPECT_EQ(store.Init(mPath), CHIP_NO_ERROR);
+
+        uint64_t leaseEnd = 0;
+        EXPECT_EQ(store.ReadLeaseEnd(Slot::kEventNumber, leaseEnd), CHIP_NO_ERROR);
+        EXPECT_EQ(leaseEnd, 100ULL);
+    }
+
+    // With both copies damaged, the counters cannot be trusted any more.
+    Overwrite(12, "garbage");
+    CounterFileStore store;
+    EXPECT_EQ(store.Init(mPath), CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+
+    uint64_t leaseEnd = 0;
+    EXPECT_EQ(store.ReadLeaseEnd(Slot::kEventNumber, leaseEnd), CHIP_ERROR_INCORRECT_STATE);
+}
+
+TEST_F(TestCounterFileStore, TestMovesCountersFromLegacyStorage)
+{
+    TestPersistentStorageDelegate storage;
+    {
+        PersistedCounter<uint64_t> persisted;
+        EXPECT_EQ(persisted.Init(&storage, DefaultStorageKeyAllocator::IMEventNumber(), 0x10000), CHIP_NO_ERROR);
+    }
+
+    {
+        CounterFileStore store;
+        EXPECT_EQ(store.Init(mPath, &storage), CHIP_NO_ERROR);
+
+        LeasedCounter<uint64_t> counter;
+        EXPECT_EQ(counter.Init(store, Slot::kEventNumber, 0x10000), CHIP_NO_ERROR);
+        EXPECT_EQ(counter.GetValue(), 0x10000ULL);
+
+        uint64_t leaseEnd = 0;
+        EXPECT_EQ(store.ReadLeaseEnd(Slot::kGroupDataCounter, leaseEnd), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    }
+
+    // The lease is now kept in the file.
+    CounterFileStore store;
+    EXPECT_EQ(store.Init(mPath), CHIP_NO_ERROR);
+
+    uint64_t leaseEnd = 0;
+    EXPECT_EQ(store.ReadLeaseEnd(Slot::kEventNumber, leaseEnd), CHIP_NO_ERROR);
+    EXPECT_EQ(leaseEnd, 0x20000ULL);
+}
+
+TEST_F(TestCounterFileStore, TestRenewsInBackground)
+{
+    CounterFileStore store;
+    RecordingDelegate delegate;
+
+    EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+    EXPECT_EQ(PlatformMgr().StartBackgroundEventLoopTask(), CHIP_NO_ERROR);
+
+    EXPECT_EQ(store.Init(mPath), CHIP_NO_ERROR);
+    EXPECT_EQ(store.StoreLeaseEnd(Slot::kEventNumber, 100), CHIP_NO_ERROR);
+    EXPECT_EQ(store.RenewLeaseEnd(Slot::kEventNumber, 150, delegate), CHIP_NO_ERROR);
+
+    EXPECT_EQ(SystemLayer().StartTimer(System::Clock::Seconds32(10), StopOnTimeout, nullptr), CHIP_NO_ERROR);
+    PlatformMgr().RunEventLoop();
+    SystemLayer().CancelTimer(StopOnTimeout, nullptr);
+
+    EXPECT_EQ(delegate.mCalls, 1u);
+    EXPECT_EQ(delegate.mSlot, Slot::kEventNumber);
+    EXPECT_EQ(delegate.mLeaseEnd, 150ULL);
+    EXPECT_EQ(delegate.mError, CHIP_NO_ERROR);
+
+    // A cancelled renewal is not reported, but the lease is still stored, here by the next synchronous write.
+    EXPECT_EQ(store.RenewLeaseEnd(Slot::kGroupDataCounter, 1000, delegate), CHIP_NO_ERROR);
+    store.CancelRenewals(delegate);
+    EXPECT_EQ(store.StoreLeaseEnd(Slot::kGroupControlCounter, 5), CHIP_NO_ERROR);
+
+    EXPECT_EQ(SystemLayer().StartTimer(System::Clock::Milliseconds32(200), StopOnTimeout, nullptr), CHIP_NO_ERROR);
+    PlatformMgr().RunEventLoop();
+    EXPECT_EQ(delegate.mCalls, 1u);
+
+    CounterFileStore reopened;
+    EXPECT_EQ(reopened.Init(mPath), CHIP_NO_ERROR);
+
+    uint64_t leaseEnd = 0;
+    EXPECT_EQ(reopened.ReadLeaseEnd(Slot::kEventNumber, leaseEnd), CHIP_NO_ERROR);
+    EXPECT_EQ(leaseEnd, 150ULL);
+    EXPECT_EQ(reopened.ReadLeaseEnd(Slot::kGroupDataCounter, leaseEnd), CHIP_NO_ERROR);
+    EXPECT_EQ(leaseEnd, 1000ULL);
+    EXPECT_EQ(reopened.ReadLeaseEnd(Slot::kGroupControlCounter, leaseEnd), CHIP_NO_ERROR);
+    EXPECT_EQ(leaseEnd, 5ULL);
+
+    EXPECT_EQ(PlatformMgr().StopBackgroundEventLoopTask(), CHIP_NO_ERROR);
+    PlatformMgr().Shutdown();
+}
+
+TEST_F(TestCounterFileStore, TestShutdownDetachesQueuedWork)
+{
+    RecordingDelegate delegate;
+
+    EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+
+    // The renewal is queued before the background workers run, and the store is gone by the time they do.
+    {
+        CounterFileStore store;
+        EXPECT_EQ(store.Init(mPath), CHIP_NO_ERROR);
+        EXPECT_EQ(store.StoreLeaseEnd(Slot::kEventNumber, 100), CHIP_NO_ERROR);
+        EXPECT_EQ(store.RenewLeaseEnd(Slot::kEventNumber, 150, delegate), CHIP_NO_ERROR);
+    }
+
+    EXPECT_EQ(PlatformMgr().StartBackgroundEventLoopTask(), CHIP_NO_ERROR);
+    EXPECT_EQ(SystemLayer().StartTimer(System::Clock::Milliseconds32(200), StopOnTimeout, nullptr), CHIP_NO_ERROR);
+    PlatformMgr().RunEventLoop();
+    EXPECT_EQ(delegate.mCalls, 0u);
+
+    CounterFileStore reopened;
+    EXPECT_EQ(reopened.Init(mPath), CHIP_NO_ERROR);
+
+    uint64_t leaseEnd = 0;
+    EXPECT_EQ(reopened.ReadLeaseEnd(Slot::kEventNumber, leaseEnd), CHIP_NO_ERROR);
+    EXPECT_EQ(leaseEnd, 100ULL);
+
+    EXPECT_EQ(PlatformMgr().StopBackgroundEventLoopTask(), CHIP_NO_ERROR);
+    PlatformMgr().Shutdown();
+}
+
+} // namespace
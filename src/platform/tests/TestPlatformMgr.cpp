@@ -29,6 +29,8 @@
 #include <string.h>
 
 #include <atomic>
+#include <thread>
+#include <vector>
 
 #include <pw_unit_test/framework.h>
 
@@ -205,6 +207,239 @@ TEST_F(TestPlatformMgr, RunEventLoopStopBeforeSleep)
     PlatformMgr().Shutdown();
 }
 
+static size_t sBatchRunCount;
+static bool sBatchRunInOrder;
+
+static void RecordBatchItem(intptr_t arg)
+{
+    sBatchRunInOrder = sBatchRunInOrder && (static_cast<size_t>(arg) == sBatchRunCount);
+    sBatchRunCount++;
+}
+
+static void RunScheduleWorkBatch(size_t batchSize)
+{
+    stopRan          = false;
+    sBatchRunCount   = 0;
+    sBatchRunInOrder = true;
+
+    EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+
+    std::vector<AsyncWorkItem> items;
+    for (size_t i = 0; i < batchSize; i++)
+    {
+        items.push_back({ RecordBatchItem, static_cast<intptr_t>(i) });
+    }
+    items.push_back({ StopTheLoop, 0 });
+    EXPECT_EQ(PlatformMgr().ScheduleWorkBatch(Span<const AsyncWorkItem>(items.data(), items.size())), CHIP_NO_ERROR);
+
+    PlatformMgr().RunEventLoop();
+    EXPECT_TRUE(stopRan);
+    EXPECT_EQ(sBatchRunCount, batchSize);
+    EXPECT_TRUE(sBatchRunInOrder);
+
+    PlatformMgr().Shutdown();
+}
+
+TEST_F(TestPlatformMgr, ScheduleWorkBatch)
+{
+    RunScheduleWorkBatch(16);
+}
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+TEST_F(TestPlatformMgr, ScheduleWorkBatchLargerThanLockFreeQueue)
+{
+    // Part of the batch goes through the overflow queue of POSIX platforms, and must still run in order.
+    RunScheduleWorkBatch(3 * CHIP_DEVICE_CONFIG_LOCK_FREE_EVENT_QUEUE_SIZE);
+}
+
+constexpr size_t kOrderedProducerCount = 4;
+static size_t sOrderedRunCount;
+static size_t sOrderedNextItem[kOrderedProducerCount];
+static bool sOrderedRunInOrder;
+
+static void RecordOrderedItem(intptr_t arg)
+{
+    const size_t producer = static_cast<size_t>(arg) % kOrderedProducerCount;
+    const size_t item     = static_cast<size_t>(arg) / kOrderedProducerCount;
+
+    sOrderedRunInOrder         = sOrderedRunInOrder && (item == sOrderedNextItem[producer]);
+    sOrderedNextItem[producer] = item + 1;
+    sOrderedRunCount++;
+}
+
+TEST_F(TestPlatformMgr, ScheduleWorkKeepsProducerOrderThroughOverflow)
+{
+    // Each producer fills the lock-free queue and overflows it, while the others and the event loop race with it: the items
+    // of each producer must still run in the order it posted them.
+    constexpr size_t kItemsPerProducer = 4 * CHIP_DEVICE_CONFIG_LOCK_FREE_EVENT_QUEUE_SIZE;
+    constexpr size_t kRounds           = 20;
+
+    EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+    EXPECT_EQ(PlatformMgr().StartEventLoopTask(), CHIP_NO_ERROR);
+
+    for (size_t round = 0; round < kRounds; round++)
+    {
+        PlatformMgr().LockChipStack();
+        sOrderedRunCount   = 0;
+        sOrderedRunInOrder = true;
+        memset(sOrderedNextItem, 0, sizeof(sOrderedNextItem));
+        PlatformMgr().UnlockChipStack();
+
+        std::vector<std::thread> producers;
+        for (size_t p = 0; p < kOrderedProducerCount; p++)
+        {
+            producers.emplace_back([p]() {
+                for (size_t item = 0; item < kItemsPerProducer; item++)
+                {
+                    const auto arg = static_cast<intptr_t>(item * kOrderedProducerCount + p);
+                    EXPECT_EQ(PlatformMgr().ScheduleWork(RecordOrderedItem, arg), CHIP_NO_ERROR);
+                }
+            });
+        }
+        for (auto & producer : producers)
+        {
+            producer.join();
+        }
+
+        size_t runCount = 0;
+        for (size_t t = 0; runCount < kOrderedProducerCount * kItemsPerProducer && t < 10000; t++)
+        {
+            chip::test_utils::SleepMillis(1);
+            PlatformMgr().LockChipStack();
+            runCount = sOrderedRunCount;
+            PlatformMgr().UnlockChipStack();
+        }
+
+        PlatformMgr().LockChipStack();
+        EXPECT_EQ(sOrderedRunCount, kOrderedProducerCount * kItemsPerProducer);
+        EXPECT_TRUE(sOrderedRunInOrder);
+        PlatformMgr().UnlockChipStack();
+    }
+
+    EXPECT_EQ(PlatformMgr().StopEventLoopTask(), CHIP_NO_ERROR);
+    PlatformMgr().Shutdown();
+}
+
+static std::atomic<size_t> sCrossThreadRunCount{ 0 };
+
+static void CountCrossThreadWork(intptr_t)
+{
+    sCrossThreadRunCount++;
+}
+
+// Posts work items from several threads, one at a time or in batches, and checks that the event loop task ran all of them.
+static void RunCrossThreadScheduleWork(size_t batchSize)
+{
+    constexpr size_t kProducerCount    = 4;
+    constexpr size_t kItemsPerProducer = 2048;
+    constexpr size_t kTotalItems       = kProducerCount * kItemsPerProducer;
+
+    sCrossThreadRunCount = 0;
+    EXPECT_EQ(PlatformMgr().StartEventLoopTask(), CHIP_NO_ERROR);
+
+    // Batches must divide the items of each producer evenly.
+    EXPECT_EQ(kItemsPerProducer % batchSize, 0u);
+    const std::vector<AsyncWorkItem> items(batchSize, AsyncWorkItem{ CountCrossThreadWork, 0 });
+
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < kProducerCount; p++)
+    {
+        producers.emplace_back([&items]() {
+            for (size_t posted = 0; posted < kItemsPerProducer; posted += items.size())
+            {
+                if (items.size() == 1)
+                {
+                    EXPECT_EQ(PlatformMgr().ScheduleWork(CountCrossThreadWork), CHIP_NO_ERROR);
+                }
+                else
+                {
+                    EXPECT_EQ(PlatformMgr().ScheduleWorkBatch(Span<const AsyncWorkItem>(items.data(), items.size())),
+                              CHIP_NO_ERROR);
+                }
+            }
+        });
+    }
+    for (auto & producer : producers)
+    {
+        producer.join();
+    }
+
+    for (size_t t = 0; sCrossThreadRunCount < kTotalItems && t < 10000; t++)
+        chip::test_utils::SleepMillis(1);
+
+    EXPECT_EQ(sCrossThreadRunCount, kTotalItems);
+    EXPECT_EQ(PlatformMgr().StopEventLoopTask(), CHIP_NO_ERROR);
+}
+
+TEST_F(TestPlatformMgr, CrossThreadScheduleWork)
+{
+    EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+
+    RunCrossThreadScheduleWork(1);
+    RunCrossThreadScheduleWork(32);
+
+    PlatformMgr().Shutdown();
+}
+
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+#if CHIP_DEVICE_LAYER_TARGET_LINUX && CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
+static std::thread::id sMatterThreadId;
+static std::atomic<size_t> sBackgroundRunCount{ 0 };
+static std::atomic<bool> sBackgroundRanOnMatterThread{ false };
+
+static void RecordBackgroundWork(intptr_t)
+{
+    if (std::this_thread::get_id() == sMatterThreadId)
+    {
+        sBackgroundRanOnMatterThread = true;
+    }
+    sBackgroundRunCount++;
+}
+
+TEST_F(TestPlatformMgr, BackgroundWorkers)
+{
+    constexpr size_t kItemCount = 64;
+
+    stopRan                      = false;
+    sMatterThreadId              = std::this_thread::get_id();
+    sBackgroundRunCount          = 0;
+    sBackgroundRanOnMatterThread = false;
+
+    EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+    EXPECT_FALSE(PlatformMgr().IsBackgroundEventLoopRunning());
+
+    EXPECT_EQ(PlatformMgr().StartBackgroundEventLoopTask(), CHIP_NO_ERROR);
+    EXPECT_TRUE(PlatformMgr().IsBackgroundEventLoopRunning());
+    EXPECT_EQ(PlatformMgr().StartBackgroundEventLoopTask(), CHIP_ERROR_INCORRECT_STATE);
+
+    for (size_t i = 0; i < kItemCount; i++)
+    {
+        EXPECT_EQ(PlatformMgr().ScheduleBackgroundWork(RecordBackgroundWork), CHIP_NO_ERROR);
+    }
+    for (size_t t = 0; sBackgroundRunCount < kItemCount && t < 1000; t++)
+        chip::test_utils::SleepMillis(1);
+    EXPECT_EQ(sBackgroundRunCount, kItemCount);
+    EXPECT_FALSE(sBackgroundRanOnMatterThread);
+
+    EXPECT_EQ(PlatformMgr().StopBackgroundEventLoopTask(), CHIP_NO_ERROR);
+    EXPECT_FALSE(PlatformMgr().IsBackgroundEventLoopRunning());
+
+    // Without workers, background work runs on the Matter event loop.
+    EXPECT_EQ(PlatformMgr().ScheduleBackgroundWork(RecordBackgroundWork), CHIP_NO_ERROR);
+    PlatformMgr().ScheduleWork(StopTheLoop);
+    PlatformMgr().RunEventLoop();
+    EXPECT_TRUE(stopRan);
+    EXPECT_EQ(sBackgroundRunCount, kItemCount + 1);
+    EXPECT_TRUE(sBackgroundRanOnMatterThread);
+
+    PlatformMgr().Shutdown();
+}
+
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX && CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
 TEST_F(TestPlatformMgr, TryLockChipStack)
 {
     EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
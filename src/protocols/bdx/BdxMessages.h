@@ -58,6 +58,14 @@ enum class TransferControlFlags : uint8_t
     kSenderDrive   = (1U << 4),
     kReceiverDrive = (1U << 5),
     kAsync         = (1U << 6),
+
+    // Non-standard extension using bit 7 of the Transfer Control field, which the BDX specification reserves: a future revision
+    // of the specification may assign it a different meaning.  Only understood by this implementation, and only used over TCP
+    // (see TransferSession::SetTransportIsTcp()), where Blocks are delivered in order and may be larger than an IPv6 MTU.
+    // Proposed along with kSenderDrive in a TransferInit and echoed in the Accept message when both nodes support it, in which
+    // case the sender may keep several Blocks in flight and BlockAck messages acknowledge all Blocks up to their counter.
+    // Implementations that do not know this bit never echo it, and the transfer then uses the standard synchronous mode.
+    kWindowed = (1U << 7),
 };
 
 enum class RangeControlFlags : uint8_t
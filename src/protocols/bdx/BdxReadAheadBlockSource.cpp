@@ -0,0 +1,561 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <protocols/bdx/BdxReadAheadBlockSource.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemError.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace chip {
+namespace bdx {
+
+CHIP_ERROR ReadAheadFileReader::Init(DispatchFunction dispatch, uint16_t maxBlockSize, size_t bufferCount)
+{
+    VerifyOrReturnError(!IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(dispatch != nullptr && maxBlockSize > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(bufferCount > 0 && bufferCount <= kMaxBuffers, CHIP_ERROR_INVALID_ARGUMENT);
+
+    for (size_t i = 0; i < bufferCount; i++)
+    {
+        mBuffers[i] = Buffer();
+        mBuffers[i].mData.Alloc(maxBlockSize);
+        if (mBuffers[i].mData.Get() == nullptr)
+        {
+            for (size_t j = 0; j < i; j++)
+            {
+                mBuffers[j].mData.Free();
+            }
+            return CHIP_ERROR_NO_MEMORY;
+        }
+    }
+
+    mDispatch           = dispatch;
+    mBufferCount        = bufferCount;
+    mBufferSize         = maxBlockSize;
+    mUseCounter         = 0;
+    mReadCount          = 0;
+    mQueueHead          = kNoBuffer;
+    mQueueTail          = kNoBuffer;
+    mStop               = false;
+    mNotificationQueued = false;
+
+    mWorker = std::thread(&ReadAheadFileReader::WorkerLoop, this);
+    return CHIP_NO_ERROR;
+}
+
+void ReadAheadFileReader::Shutdown()
+{
+    VerifyOrReturn(IsInitialized());
+
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mStop = true;
+    }
+    mWorkAvailable.notify_all();
+    mWorker.join();
+
+    for (auto & source : mSources)
+    {
+        if (source != nullptr)
+        {
+            source->Close();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mLock);
+    for (size_t i = 0; i < mBufferCount; i++)
+    {
+        mBuffers[i].mData.Free();
+        mBuffers[i] = Buffer();
+    }
+    for (auto & file : mFiles)
+    {
+        if (file.mFd >= 0)
+        {
+            close(file.mFd);
+        }
+        file = OpenFile();
+    }
+    mBufferCount = 0;
+}
+
+CHIP_ERROR ReadAheadFileReader::OpenFileLocked(const char * path, uint8_t & outFile)
+{
+    size_t pathLen = strnlen(path, kMaxFileDesignatorLen + 1);
+    VerifyOrReturnError(pathLen > 0 && pathLen <= kMaxFileDesignatorLen, CHIP_ERROR_INVALID_ARGUMENT);
+
+    uint8_t freeSlot = kNoFile;
+    for (uint8_t i = 0; i < kMaxOpenFiles; i++)
+    {
+        OpenFile & file = mFiles[i];
+        if (file.mFd >= 0 && strcmp(file.mPath, path) == 0)
+        {
+            file.mRefs++;
+            outFile = i;
+            return CHIP_NO_ERROR;
+        }
+        if (file.mFd < 0 && freeSlot == kNoFile)
+        {
+            freeSlot = i;
+        }
+    }
+    VerifyOrReturnError(freeSlot != kNoFile, CHIP_ERROR_NO_MEMORY);
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_OPEN_FAILED);
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size < 0)
+    {
+        close(fd);
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    OpenFile & file = mFiles[freeSlot];
+    memcpy(file.mPath, path, pathLen);
+    file.mPath[pathLen] = '\0';
+    file.mSize          = static_cast<uint64_t>(fileStat.st_size);
+    file.mFd            = fd;
+    file.mRefs          = 1;
+    outFile             = freeSlot;
+    return CHIP_NO_ERROR;
+}
+
+void ReadAheadFileReader::ReleaseFileLocked(uint8_t file)
+{
+    VerifyOrReturn(file < kMaxOpenFiles && mFiles[file].mRefs > 0);
+    mFiles[file].mRefs--;
+    // The descriptor is closed by the worker once no read for the file is outstanding.
+    mWorkAvailable.notify_one();
+}
+
+void ReadAheadFileReader::CloseIdleFilesLocked()
+{
+    for (uint8_t i = 0; i < kMaxOpenFiles; i++)
+    {
+        OpenFile & file = mFiles[i];
+        if (file.mFd < 0 || file.mRefs > 0)
+        {
+            continue;
+        }
+
+        bool busy = false;
+        for (size_t b = 0; b < mBufferCount; b++)
+        {
+            Buffer & buffer = mBuffers[b];
+            if (buffer.mFile != i)
+            {
+                continue;
+            }
+            if (buffer.mState == BufferState::kLoading || buffer.mState == BufferState::kQueued)
+            {
+                busy = true;
+            }
+            else
+            {
+                buffer.mState = BufferState::kEmpty;
+                buffer.mFile  = kNoFile;
+            }
+        }
+
+        if (!busy)
+        {
+            close(file.mFd);
+            file = OpenFile();
+        }
+    }
+}
+
+uint16_t ReadAheadFileReader::FindBufferLocked(uint8_t file, uint64_t offset) const
+{
+    for (uint16_t i = 0; i < mBufferCount; i++)
+    {
+        const Buffer & buffer = mBuffers[i];
+        if (buffer.mFile == file && buffer.mOffset == offset && buffer.mState != BufferState::kEmpty)
+        {
+            return i;
+        }
+    }
+    return kNoBuffer;
+}
+
+uint16_t ReadAheadFileReader::RequestLocked(uint8_t file, uint64_t offset, size_t length)
+{
+    uint16_t index = FindBufferLocked(file, offset);
+    if (index != kNoBuffer && mBuffers[index].mLength >= length)
+    {
+        return index;
+    }
+
+    // Reuse an empty buffer, else evict the least recently used idle one.
+    uint16_t victim = kNoBuffer;
+    for (uint16_t i = 0; i < mBufferCount; i++)
+    {
+        const Buffer & buffer = mBuffers[i];
+        if (buffer.mState == BufferState::kEmpty)
+        {
+            victim = i;
+            break;
+        }
+        if ((buffer.mState == BufferState::kReady || buffer.mState == BufferState::kFailed) && buffer.mPins == 0 &&
+            (victim == kNoBuffer || buffer.mLastUse < mBuffers[victim].mLastUse))
+        {
+            victim = i;
+        }
+    }
+    VerifyOrReturnValue(victim != kNoBuffer, kNoBuffer);
+
+    Buffer & buffer     = mBuffers[victim];
+    buffer.mFile        = file;
+    buffer.mOffset      = offset;
+    buffer.mLength      = length;
+    buffer.mError       = CHIP_NO_ERROR;
+    buffer.mLastUse     = ++mUseCounter;
+    buffer.mState       = BufferState::kQueued;
+    buffer.mNextQueued  = kNoBuffer;
+
+    if (mQueueTail == kNoBuffer)
+    {
+        mQueueHead = victim;
+    }
+    else
+    {
+        mBuffers[mQueueTail].mNextQueued = victim;
+    }
+    mQueueTail = victim;
+    mWorkAvailable.notify_one();
+
+    return victim;
+}
+
+bool ReadAheadFileReader::HasPendingReadsLocked() const
+{
+    for (size_t i = 0; i < mBufferCount; i++)
+    {
+        if (mBuffers[i].mState == BufferState::kQueued || mBuffers[i].mState == BufferState::kLoading)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+CHIP_ERROR ReadAheadFileReader::RegisterSource(ReadAheadBlockSource * source)
+{
+    for (auto & slot : mSources)
+    {
+        if (slot == nullptr)
+        {
+            slot = source;
+            return CHIP_NO_ERROR;
+        }
+    }
+    return CHIP_ERROR_NO_MEMORY;
+}
+
+void ReadAheadFileReader::UnregisterSource(ReadAheadBlockSource * source)
+{
+    for (auto & slot : mSources)
+    {
+        if (slot == source)
+        {
+            slot = nullptr;
+        }
+    }
+}
+
+void ReadAheadFileReader::WorkerLoop()
+{
+    std::unique_lock<std::mutex> lock(mLock);
+    while (true)
+    {
+        CloseIdleFilesLocked();
+        mWorkAvailable.wait(lock, [this] {
+            if (mStop || mQueueHead != kNoBuffer)
+            {
+                return true;
+            }
+            for (const auto & file : mFiles)
+            {
+                if (file.mFd >= 0 && file.mRefs == 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        });
+        if (mStop)
+        {
+            return;
+        }
+        if (mQueueHead == kNoBuffer)
+        {
+            continue;
+        }
+
+        uint16_t index = mQueueHead;
+        Buffer & buffer = mBuffers[index];
+        mQueueHead      = buffer.mNextQueued;
+        if (mQueueHead == kNoBuffer)
+        {
+            mQueueTail = kNoBuffer;
+        }
+        buffer.mNextQueued = kNoBuffer;
+        buffer.mState      = BufferState::kLoading;
+
+        int fd          = mFiles[buffer.mFile].mFd;
+        uint8_t * data  = buffer.mData.Get();
+        uint64_t offset = buffer.mOffset;
+        size_t length   = buffer.mLength;
+
+        // The buffer is in the loading state, so nothing else touches it while unlocked.
+        lock.unlock();
+        size_t total   = 0;
+        CHIP_ERROR err = CHIP_NO_ERROR;
+        while (total < length)
+        {
+            ssize_t result = pread(fd, data + total, length - total, static_cast<off_t>(offset + total));
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                err = CHIP_ERROR_POSIX(errno);
+                break;
+            }
+            if (result == 0)
+            {
+                break;
+            }
+            total += static_cast<size_t>(result);
+        }
+        lock.lock();
+
+        mReadCount++;
+        buffer.mLength = total;
+        buffer.mError  = err;
+        buffer.mState  = (err == CHIP_NO_ERROR) ? BufferState::kReady : BufferState::kFailed;
+
+        if (!mNotificationQueued)
+        {
+            mNotificationQueued = true;
+            if (mDispatch(HandleBuffersLoaded, reinterpret_cast<intptr_t>(this)) != CHIP_NO_ERROR)
+            {
+                mNotificationQueued = false;
+            }
+        }
+    }
+}
+
+void ReadAheadFileReader::HandleBuffersLoaded(intptr_t context)
+{
+    auto * reader = reinterpret_cast<ReadAheadFileReader *>(context);
+
+    {
+        std::lock_guard<std::mutex> lock(reader->mLock);
+        reader->mNotificationQueued = false;
+    }
+
+    for (auto * source : reader->mSources)
+    {
+        if (source == nullptr || !source->mWaiting)
+        {
+            continue;
+        }
+
+        bool ready;
+        {
+            std::lock_guard<std::mutex> lock(reader->mLock);
+            uint16_t index = reader->FindBufferLocked(source->mFile, source->mWaitingOffset);
+            ready          = (index == kNoBuffer) || (reader->mBuffers[index].mState == BufferState::kReady) ||
+                (reader->mBuffers[index].mState == BufferState::kFailed);
+        }
+
+        if (ready)
+        {
+            source->mWaiting = false;
+            if (source->mCallback != nullptr)
+            {
+                source->mCallback->OnBlockReady(*source);
+            }
+        }
+    }
+}
+
+CHIP_ERROR ReadAheadBlockSource::Open(ReadAheadFileReader & reader, const char * path, uint16_t blockSize, uint64_t startOffset,
+                                      uint64_t length, uint8_t readAheadDepth, Callback * callback)
+{
+    VerifyOrReturnError(!IsOpen(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(reader.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(path != nullptr && blockSize > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(blockSize <= reader.mBufferSize, CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(reader.RegisterSource(this));
+
+    uint64_t fileSize;
+    {
+        std::lock_guard<std::mutex> lock(reader.mLock);
+        CHIP_ERROR err = reader.OpenFileLocked(path, mFile);
+        if (err != CHIP_NO_ERROR)
+        {
+            reader.UnregisterSource(this);
+            return err;
+        }
+        fileSize = reader.mFiles[mFile].mSize;
+    }
+
+    mReader         = &reader;
+    mCallback       = callback;
+    mBlockSize      = blockSize;
+    mReadAheadDepth = readAheadDepth;
+    mWaiting        = false;
+    mPinnedBuffer   = ReadAheadFileReader::kNoBuffer;
+    mEndOffset      = fileSize;
+    if (length > 0 && startOffset < fileSize && length < fileSize - startOffset)
+    {
+        mEndOffset = startOffset + length;
+    }
+
+    // Start reading right away so the first BlockQuery is likely served from memory.
+    if (startOffset < mEndOffset)
+    {
+        std::lock_guard<std::mutex> lock(reader.mLock);
+        reader.RequestLocked(mFile, startOffset, BlockLengthAt(startOffset));
+        PrefetchLocked(startOffset);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void ReadAheadBlockSource::Close()
+{
+    VerifyOrReturn(IsOpen());
+
+    {
+        std::lock_guard<std::mutex> lock(mReader->mLock);
+        UnpinLocked();
+        mReader->ReleaseFileLocked(mFile);
+    }
+    mReader->UnregisterSource(this);
+
+    mReader   = nullptr;
+    mCallback = nullptr;
+    mWaiting  = false;
+    mFile     = ReadAheadFileReader::kNoFile;
+}
+
+size_t ReadAheadBlockSource::BlockLengthAt(uint64_t offset) const
+{
+    VerifyOrReturnValue(offset < mEndOffset, 0);
+    uint64_t remaining = mEndOffset - offset;
+    return (remaining < mBlockSize) ? static_cast<size_t>(remaining) : mBlockSize;
+}
+
+void ReadAheadBlockSource::UnpinLocked()
+{
+    if (mPinnedBuffer != ReadAheadFileReader::kNoBuffer)
+    {
+        mReader->mBuffers[mPinnedBuffer].mPins--;
+        mPinnedBuffer = ReadAheadFileReader::kNoBuffer;
+    }
+}
+
+void ReadAheadBlockSource::PrefetchLocked(uint64_t offset)
+{
+    for (uint8_t i = 1; i <= mReadAheadDepth; i++)
+    {
+        uint64_t nextOffset = offset + static_cast<uint64_t>(i) * mBlockSize;
+        size_t nextLength   = BlockLengthAt(nextOffset);
+        if (nextLength == 0)
+        {
+            break;
+        }
+        if (mReader->RequestLocked(mFile, nextOffset, nextLength) == ReadAheadFileReader::kNoBuffer)
+        {
+            // Pool exhausted by in-flight reads: the remaining blocks will be requested later.
+            break;
+        }
+    }
+}
+
+CHIP_ERROR ReadAheadBlockSource::GetBlock(uint64_t offset, ByteSpan & block, bool & isEof)
+{
+    VerifyOrReturnError(IsOpen(), CHIP_ERROR_INCORRECT_STATE);
+
+    std::lock_guard<std::mutex> lock(mReader->mLock);
+    UnpinLocked();
+
+    size_t length = BlockLengthAt(offset);
+    if (length == 0)
+    {
+        block = ByteSpan();
+        isEof = true;
+        return CHIP_NO_ERROR;
+    }
+
+    uint16_t index = mReader->RequestLocked(mFile, offset, length);
+    if (index == ReadAheadFileReader::kNoBuffer)
+    {
+        // Every buffer is pinned or in flight. Completion of an in-flight read frees one up, so wait for it.
+        VerifyOrReturnError(mReader->HasPendingReadsLocked(), CHIP_ERROR_NO_MEMORY);
+        mWaiting       = true;
+        mWaitingOffset = offset;
+        return CHIP_ERROR_IN_PROGRESS;
+    }
+
+    ReadAheadFileReader::Buffer & buffer = mReader->mBuffers[index];
+    buffer.mLastUse                      = ++mReader->mUseCounter;
+    PrefetchLocked(offset);
+
+    switch (buffer.mState)
+    {
+    case ReadAheadFileReader::BufferState::kReady:
+        break;
+    case ReadAheadFileReader::BufferState::kFailed: {
+        CHIP_ERROR err = buffer.mError;
+        buffer.mState  = ReadAheadFileReader::BufferState::kEmpty;
+        buffer.mFile   = ReadAheadFileReader::kNoFile;
+        return err;
+    }
+    default:
+        mWaiting       = true;
+        mWaitingOffset = offset;
+        return CHIP_ERROR_IN_PROGRESS;
+    }
+
+    // A short read means the file shrank underneath the transfer.
+    VerifyOrReturnError(buffer.mLength >= length, CHIP_ERROR_READ_FAILED);
+
+    buffer.mPins++;
+    mPinnedBuffer = index;
+    block         = ByteSpan(buffer.mData.Get(), length);
+    isEof         = (offset + length >= mEndOffset);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace bdx
+} // namespace chip
@@ -0,0 +1,236 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Asynchronous, read-ahead file block source for BDX senders.
+ *
+ *      A ReadAheadFileReader owns a worker thread and a pool of block buffers. Each BDX transfer opens a
+ *      ReadAheadBlockSource on the shared reader; the source hands out the block for a BlockQuery and
+ *      prefetches the following blocks on the worker thread. Transfers of the same file share buffers, so
+ *      concurrent requestors downloading the same image read each block from disk only once.
+ *
+ *      This is only available on POSIX platforms.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+#include <protocols/bdx/BdxMessages.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace chip {
+namespace bdx {
+
+class ReadAheadBlockSource;
+
+class ReadAheadFileReader
+{
+public:
+    /**
+     * Function used by the worker thread to run work in the context that owns the block sources
+     * (typically the Matter event loop, e.g. DeviceLayer::PlatformMgr().ScheduleWork). Must be thread-safe.
+     */
+    using DispatchFunction = CHIP_ERROR (*)(void (*work)(intptr_t), intptr_t arg);
+
+    static constexpr size_t kMaxBuffers   = 64;
+    static constexpr size_t kMaxOpenFiles = 8;
+    static constexpr size_t kMaxSources   = 16;
+
+    ReadAheadFileReader() = default;
+    ~ReadAheadFileReader() { Shutdown(); }
+
+    ReadAheadFileReader(const ReadAheadFileReader &)             = delete;
+    ReadAheadFileReader & operator=(const ReadAheadFileReader &) = delete;
+
+    /**
+     * Allocate `bufferCount` buffers of `maxBlockSize` bytes and start the worker thread.
+     */
+    CHIP_ERROR Init(DispatchFunction dispatch, uint16_t maxBlockSize, size_t bufferCount = kMaxBuffers);
+
+    /**
+     * Stop the worker thread and release all buffers. All sources must have been closed, and work
+     * already handed to the dispatch function must not run after the reader is destroyed.
+     */
+    void Shutdown();
+
+    bool IsInitialized() const { return mWorker.joinable(); }
+
+    /**
+     * Largest block size that sources opened on this reader may use, 0 if the reader is not initialized.
+     */
+    size_t MaxBlockSize() const { return IsInitialized() ? mBufferSize : 0; }
+
+    /**
+     * Number of pread() calls issued by the worker thread since Init.
+     */
+    size_t ReadCount() const
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        return mReadCount;
+    }
+
+private:
+    friend class ReadAheadBlockSource;
+
+    static constexpr uint8_t kNoFile    = UINT8_MAX;
+    static constexpr uint16_t kNoBuffer = UINT16_MAX;
+
+    enum class BufferState : uint8_t
+    {
+        kEmpty,
+        kQueued,
+        kLoading,
+        kReady,
+        kFailed,
+    };
+
+    struct Buffer
+    {
+        Platform::ScopedMemoryBuffer<uint8_t> mData;
+        uint64_t mOffset     = 0;
+        uint64_t mLastUse    = 0;
+        size_t mLength       = 0;
+        CHIP_ERROR mError    = CHIP_NO_ERROR;
+        uint16_t mPins       = 0;
+        uint16_t mNextQueued = kNoBuffer;
+        uint8_t mFile        = kNoFile;
+        BufferState mState   = BufferState::kEmpty;
+    };
+
+    struct OpenFile
+    {
+        char mPath[kMaxFileDesignatorLen + 1];
+        uint64_t mSize = 0;
+        int mFd        = -1;
+        uint16_t mRefs = 0;
+    };
+
+    // Called on the owner context, with mLock held.
+    CHIP_ERROR OpenFileLocked(const char * path, uint8_t & outFile);
+    void ReleaseFileLocked(uint8_t file);
+    uint16_t FindBufferLocked(uint8_t file, uint64_t offset) const;
+    uint16_t RequestLocked(uint8_t file, uint64_t offset, size_t length);
+    bool HasPendingReadsLocked() const;
+
+    // Called on the owner context.
+    CHIP_ERROR RegisterSource(ReadAheadBlockSource * source);
+    void UnregisterSource(ReadAheadBlockSource * source);
+
+    void WorkerLoop();
+    void CloseIdleFilesLocked();
+    static void HandleBuffersLoaded(intptr_t context);
+
+    mutable std::mutex mLock;
+    std::condition_variable mWorkAvailable;
+    std::thread mWorker;
+
+    DispatchFunction mDispatch = nullptr;
+    Buffer mBuffers[kMaxBuffers];
+    OpenFile mFiles[kMaxOpenFiles];
+    size_t mBufferCount      = 0;
+    size_t mBufferSize       = 0;
+    uint64_t mUseCounter     = 0;
+    size_t mReadCount        = 0;
+    uint16_t mQueueHead      = kNoBuffer;
+    uint16_t mQueueTail      = kNoBuffer;
+    bool mStop               = false;
+    bool mNotificationQueued = false;
+
+    // Only accessed on the owner context.
+    ReadAheadBlockSource * mSources[kMaxSources] = {};
+};
+
+/**
+ * Per-transfer view of a file served through a ReadAheadFileReader.
+ *
+ * All methods must be called from the reader's owner context.
+ */
+class ReadAheadBlockSource
+{
+public:
+    class Callback
+    {
+    public:
+        virtual ~Callback() = default;
+
+        /**
+         * Called on the owner context when a block previously reported as CHIP_ERROR_IN_PROGRESS by
+         * GetBlock() has been read. The callee is expected to call GetBlock() again.
+         */
+        virtual void OnBlockReady(ReadAheadBlockSource & source) = 0;
+    };
+
+    static constexpr uint8_t kDefaultReadAheadDepth = 4;
+
+    ReadAheadBlockSource() = default;
+    ~ReadAheadBlockSource() { Close(); }
+
+    /**
+     * @param reader          shared reader serving the file
+     * @param path            null-terminated path of the file to serve
+     * @param blockSize       negotiated BDX block size
+     * @param startOffset     negotiated start offset of the transfer
+     * @param length          negotiated transfer length, 0 meaning until end of file
+     * @param readAheadDepth  number of blocks to prefetch past the one being served
+     * @param callback        notified when a pending block becomes available
+     */
+    CHIP_ERROR Open(ReadAheadFileReader & reader, const char * path, uint16_t blockSize, uint64_t startOffset, uint64_t length,
+                    uint8_t readAheadDepth, Callback * callback);
+    void Close();
+
+    bool IsOpen() const { return mReader != nullptr; }
+
+    /**
+     * Get the block of the transfer starting at `offset` bytes from the start of the file.
+     *
+     * @retval CHIP_NO_ERROR            `block` is valid until the next call to GetBlock() or Close()
+     * @retval CHIP_ERROR_IN_PROGRESS   the block is being read; Callback::OnBlockReady() will be called
+     * @retval other                    the block could not be read
+     */
+    CHIP_ERROR GetBlock(uint64_t offset, ByteSpan & block, bool & isEof);
+
+    /**
+     * End offset (exclusive) of the transfer within the file.
+     */
+    uint64_t EndOffset() const { return mEndOffset; }
+
+private:
+    friend class ReadAheadFileReader;
+
+    void UnpinLocked();
+    void PrefetchLocked(uint64_t offset);
+    size_t BlockLengthAt(uint64_t offset) const;
+
+    ReadAheadFileReader * mReader = nullptr;
+    Callback * mCallback          = nullptr;
+    uint64_t mEndOffset           = 0;
+    uint64_t mWaitingOffset       = 0;
+    uint16_t mBlockSize           = 0;
+    uint16_t mPinnedBuffer        = ReadAheadFileReader::kNoBuffer;
+    uint8_t mFile                 = ReadAheadFileReader::kNoFile;
+    uint8_t mReadAheadDepth       = 0;
+    bool mWaiting                 = false;
+};
+
+} // namespace bdx
+} // namespace chip
@@ -25,11 +25,23 @@ constexpr uint8_t kBdxVersion = 0; ///< The version of this implementation of th
 /**
  * @brief
  *   Allocate a new PacketBuffer and write data from a BDX message struct.
+ *
+ *   If largePayload is true, the buffer may be larger than the IPv6 MTU (only for messages sent over TCP).
  */
-CHIP_ERROR WriteToPacketBuffer(const ::chip::bdx::BdxMessage & msgStruct, ::chip::System::PacketBufferHandle & msgBuf)
+CHIP_ERROR WriteToPacketBuffer(const ::chip::bdx::BdxMessage & msgStruct, ::chip::System::PacketBufferHandle & msgBuf,
+                               bool largePayload = false)
 {
     size_t msgDataSize = msgStruct.MessageSize();
-    ::chip::Encoding::LittleEndian::PacketBufferWriter bbuf(chip::MessagePacketBuffer::New(msgDataSize), msgDataSize);
+    ::chip::System::PacketBufferHandle buffer;
+    if (largePayload && msgDataSize > ::chip::System::PacketBuffer::kMaxSize - ::chip::MessagePacketBuffer::kMaxFooterSize)
+    {
+        buffer = ::chip::System::PacketBufferHandle::New(msgDataSize + ::chip::MessagePacketBuffer::kMaxFooterSize);
+    }
+    else
+    {
+        buffer = chip::MessagePacketBuffer::New(msgDataSize);
+    }
+    ::chip::Encoding::LittleEndian::PacketBufferWriter bbuf(std::move(buffer), msgDataSize);
     if (bbuf.IsNull())
     {
         return CHIP_ERROR_NO_MEMORY;
@@ -142,6 +154,9 @@ void TransferSession::GetNextAction(OutputEvent & event)
 CHIP_ERROR TransferSession::StartTransfer(TransferRole role, const TransferInitData & initData, System::Clock::Timeout timeout)
 {
     VerifyOrReturnError(mState == TransferState::kUnitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mTransportIsTcp ||
+                            !BitFlags<TransferControlFlags>(initData.TransferCtlFlags).Has(TransferControlFlags::kWindowed),
+                        CHIP_ERROR_INVALID_ARGUMENT);
 
     mRole    = role;
     mTimeout = timeout;
@@ -185,6 +200,7 @@ CHIP_ERROR TransferSession::WaitForTransfer(TransferRole role, BitFlags<Transfer
                                             uint16_t maxBlockSize, System::Clock::Timeout timeout)
 {
     VerifyOrReturnError(mState == TransferState::kUnitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mTransportIsTcp || !xferControlOpts.Has(TransferControlFlags::kWindowed), CHIP_ERROR_INVALID_ARGUMENT);
 
     // Used to determine compatibility with any future TransferInit parameters
     mRole                  = role;
@@ -213,6 +229,10 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
 
     mTransferMaxBlockSize = acceptData.MaxBlockSize;
 
+    // Only confirm the windowed mode if both nodes support it, over TCP, and only for a sender drive transfer
+    mWindowedTransfer = mTransportIsTcp && proposedControlOpts.Has(TransferControlFlags::kWindowed) &&
+        mSuppportedXferOpts.Has(TransferControlFlags::kWindowed) && (acceptData.ControlMode == TransferControlFlags::kSenderDrive);
+
     if (mRole == TransferRole::kSender)
     {
         mStartOffset    = acceptData.StartOffset;
@@ -220,6 +240,7 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
 
         ReceiveAccept acceptMsg;
         acceptMsg.TransferCtlFlags.Set(acceptData.ControlMode);
+        acceptMsg.TransferCtlFlags.Set(TransferControlFlags::kWindowed, mWindowedTransfer);
         acceptMsg.Version        = mTransferVersion;
         acceptMsg.MaxBlockSize   = acceptData.MaxBlockSize;
         acceptMsg.StartOffset    = acceptData.StartOffset;
@@ -239,6 +260,7 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
     {
         SendAccept acceptMsg;
         acceptMsg.TransferCtlFlags.Set(acceptData.ControlMode);
+        acceptMsg.TransferCtlFlags.Set(TransferControlFlags::kWindowed, mWindowedTransfer);
         acceptMsg.Version        = mTransferVersion;
         acceptMsg.MaxBlockSize   = acceptData.MaxBlockSize;
         acceptMsg.Metadata       = acceptData.Metadata;
@@ -324,10 +346,7 @@ CHIP_ERROR TransferSession::PrepareBlockQueryWithSkip(const uint64_t & bytesToSk
 
 CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
 {
-    VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mRole == TransferRole::kSender, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(CanPrepareBlock(), CHIP_ERROR_INCORRECT_STATE);
 
     // Verify non-zero data is provided and is no longer than MaxBlockSize (BlockEOF may contain 0 length data)
     VerifyOrReturnError((inData.Data != nullptr) && (inData.Length <= mTransferMaxBlockSize), CHIP_ERROR_INVALID_ARGUMENT);
@@ -337,7 +356,7 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
     blockMsg.Data         = inData.Data;
     blockMsg.DataLength   = inData.Length;
 
-    ReturnErrorOnFailure(WriteToPacketBuffer(blockMsg, mPendingMsgHandle));
+    ReturnErrorOnFailure(WriteToPacketBuffer(blockMsg, mPendingMsgHandle, mWindowedTransfer));
 
     const MessageType msgType = inData.IsEof ? MessageType::BlockEOF : MessageType::Block;
 
@@ -358,6 +377,21 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
     return CHIP_NO_ERROR;
 }
 
+bool TransferSession::CanPrepareBlock() const
+{
+    if (mState != TransferState::kTransferInProgress || mRole != TransferRole::kSender || mPendingOutput != OutputEventType::kNone)
+    {
+        return false;
+    }
+
+    if (mWindowedTransfer)
+    {
+        return GetNumBlocksInFlight() < CHIP_CONFIG_BDX_WINDOWED_TRANSFER_MAX_BLOCKS_IN_FLIGHT;
+    }
+
+    return !mAwaitingResponse;
+}
+
 CHIP_ERROR TransferSession::PrepareBlockAck()
 {
     VerifyOrReturnError(mRole == TransferRole::kReceiver, CHIP_ERROR_INCORRECT_STATE);
@@ -417,6 +451,8 @@ void TransferSession::Reset()
     mStartOffset           = 0;
     mTransferLength        = 0;
     mTransferMaxBlockSize  = 0;
+    mWindowedTransfer      = false;
+    mTransportIsTcp        = false;
 
     mPendingMsgHandle = nullptr;
 
@@ -426,6 +462,8 @@ void TransferSession::Reset()
     mLastQueryNum      = 0;
     mNextQueryNum      = 0;
 
+    mNextUnackedBlockNum = 0;
+
     mTimeout                = System::Clock::kZero;
     mTimeoutStartTime       = System::Clock::kZero;
     mShouldInitTimeoutStart = true;
@@ -717,6 +755,13 @@ void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
     mNumBytesProcessed += blockMsg.DataLength;
     mLastBlockNum = blockMsg.BlockCounter;
 
+    if (mWindowedTransfer)
+    {
+        // The sender does not wait for a BlockAck before sending the next Block
+        mLastQueryNum = blockMsg.BlockCounter + 1;
+        return;
+    }
+
     mAwaitingResponse = false;
 }
 
@@ -755,12 +800,22 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
 void TransferSession::HandleBlockAck(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    // In a windowed transfer, acknowledgements of the Blocks sent before the BlockEOF may arrive after it
+    VerifyOrReturn((mState == TransferState::kTransferInProgress) ||
+                       (mWindowedTransfer && mState == TransferState::kAwaitingEOFAck),
+                   PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     BlockAck ackMsg;
     const CHIP_ERROR err = ackMsg.Parse(std::move(msgData));
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
+
+    if (mWindowedTransfer)
+    {
+        HandleWindowedBlockAck(ackMsg.BlockCounter);
+        return;
+    }
+
     VerifyOrReturn(ackMsg.BlockCounter == mLastBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
 
     mPendingOutput = OutputEventType::kAckReceived;
@@ -770,6 +825,21 @@ void TransferSession::HandleBlockAck(System::PacketBufferHandle msgData)
     mAwaitingResponse = (mControlMode == TransferControlFlags::kReceiverDrive);
 }
 
+void TransferSession::HandleWindowedBlockAck(uint32_t blockCounter)
+{
+    // The acknowledged Block must be in flight, and a BlockEOF is only acknowledged by a BlockAckEOF
+    const uint32_t numBlocksAcked = blockCounter - mNextUnackedBlockNum + 1;
+    VerifyOrReturn(numBlocksAcked <= GetNumBlocksInFlight(), PrepareStatusReport(StatusCode::kBadBlockCounter));
+    VerifyOrReturn(mState != TransferState::kAwaitingEOFAck || blockCounter != mLastBlockNum,
+                   PrepareStatusReport(StatusCode::kBadBlockCounter));
+
+    mNextUnackedBlockNum = blockCounter + 1;
+
+    mPendingOutput = OutputEventType::kAckReceived;
+
+    mAwaitingResponse = (GetNumBlocksInFlight() > 0);
+}
+
 void TransferSession::HandleBlockAckEOF(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
@@ -783,7 +853,8 @@ void TransferSession::HandleBlockAckEOF(System::PacketBufferHandle msgData)
 
     mPendingOutput = OutputEventType::kAckEOFReceived;
 
-    mAwaitingResponse = false;
+    mNextUnackedBlockNum = mNextBlockNum;
+    mAwaitingResponse    = false;
 
     mState = TransferState::kTransferDone;
 
@@ -804,7 +875,9 @@ void TransferSession::ResolveTransferControlOptions(const BitFlags<TransferContr
 
     // Ensure there are options supported by both nodes. Async gets priority.
     // If there is only one common option, choose that one. Otherwise the application must pick.
-    const BitFlags<TransferControlFlags> commonOpts(proposed & mSuppportedXferOpts);
+    // The windowed mode is not a drive mode, it is only confirmed in AcceptTransfer()
+    BitFlags<TransferControlFlags> commonOpts(proposed & mSuppportedXferOpts);
+    commonOpts.Clear(TransferControlFlags::kWindowed);
     if (!commonOpts.HasAny())
     {
         PrepareStatusReport(StatusCode::kTransferMethodNotSupported);
@@ -826,17 +899,20 @@ void TransferSession::ResolveTransferControlOptions(const BitFlags<TransferContr
 CHIP_ERROR TransferSession::VerifyProposedMode(const BitFlags<TransferControlFlags> & proposed)
 {
     TransferControlFlags mode;
+    const bool windowed = proposed.Has(TransferControlFlags::kWindowed);
+    BitFlags<TransferControlFlags> driveMode(proposed);
+    driveMode.Clear(TransferControlFlags::kWindowed);
 
     // Must specify only one mode in Accept messages
-    if (proposed.HasOnly(TransferControlFlags::kAsync))
+    if (driveMode.HasOnly(TransferControlFlags::kAsync))
     {
         mode = TransferControlFlags::kAsync;
     }
-    else if (proposed.HasOnly(TransferControlFlags::kReceiverDrive))
+    else if (driveMode.HasOnly(TransferControlFlags::kReceiverDrive))
     {
         mode = TransferControlFlags::kReceiverDrive;
     }
-    else if (proposed.HasOnly(TransferControlFlags::kSenderDrive))
+    else if (driveMode.HasOnly(TransferControlFlags::kSenderDrive))
     {
         mode = TransferControlFlags::kSenderDrive;
     }
@@ -857,6 +933,16 @@ CHIP_ERROR TransferSession::VerifyProposedMode(const BitFlags<TransferControlFla
         return CHIP_ERROR_INTERNAL;
     }
 
+    // The windowed mode can only be confirmed if it was proposed, over TCP, and only applies to sender drive
+    if (windowed &&
+        (!mTransportIsTcp || !mSuppportedXferOpts.Has(TransferControlFlags::kWindowed) ||
+         mode != TransferControlFlags::kSenderDrive))
+    {
+        PrepareStatusReport(StatusCode::kTransferMethodNotSupported);
+        return CHIP_ERROR_INTERNAL;
+    }
+    mWindowedTransfer = windowed;
+
     return CHIP_NO_ERROR;
 }
 
@@ -186,6 +186,15 @@ public:
      */
     void GetNextAction(OutputEvent & event);
 
+    /**
+     * @brief
+     *   Indicate whether the messages of the transfer are carried over TCP, e.g. from Session::AllowsLargePayload().
+     *
+     *   The windowed mode (TransferControlFlags::kWindowed) uses a bit the BDX specification reserves, so it is only proposed or
+     *   accepted over TCP.  Must be called before StartTransfer() or WaitForTransfer(); Reset() clears it.
+     */
+    void SetTransportIsTcp(bool isTcp) { mTransportIsTcp = isTcp; }
+
     /**
      * @brief
      *   Initializes the TransferSession object and prepares a TransferInit message (emitted via PollOutput()).
@@ -198,7 +207,8 @@ public:
      * @param timeout   The amount of time to wait for a response before considering the transfer failed
      *
      * @return CHIP_ERROR Result of initialization and preparation of a TransferInit message. May also indicate if the
-     *                    TransferSession object is unable to handle this request.
+     *                    TransferSession object is unable to handle this request. CHIP_ERROR_INVALID_ARGUMENT if initData
+     *                    proposes the windowed mode and the transport is not TCP.
      */
     CHIP_ERROR StartTransfer(TransferRole role, const TransferInitData & initData, System::Clock::Timeout timeout);
 
@@ -214,7 +224,8 @@ public:
      * @param timeout         The amount of time to wait for a response before considering the transfer failed
      *
      * @return CHIP_ERROR Result of initialization. May also indicate if the TransferSession object is unable to handle this
-     *                    request.
+     *                    request. CHIP_ERROR_INVALID_ARGUMENT if xferControlOpts has the windowed mode and the transport is not
+     *                    TCP.
      */
     CHIP_ERROR WaitForTransfer(TransferRole role, BitFlags<TransferControlFlags> xferControlOpts, uint16_t maxBlockSize,
                                System::Clock::Timeout timeout);
@@ -265,6 +276,10 @@ public:
      * @brief
      *   Prepare a Block message. The Block counter will be populated automatically.
      *
+     *   In a windowed transfer (see TransferControlFlags::kWindowed), up to CHIP_CONFIG_BDX_WINDOWED_TRANSFER_MAX_BLOCKS_IN_FLIGHT
+     *   Blocks may be prepared before the first of them is acknowledged, and Blocks may be larger than a regular PacketBuffer.
+     *   Use CanPrepareBlock() to find out whether another Block can be sent.
+     *
      * @param inData Contains data for filling out the Block message
      *
      * @return CHIP_ERROR The result of the preparation of a Block message. May also indicate if the TransferSession object
@@ -276,6 +291,9 @@ public:
      * @brief
      *   Prepare a BlockAck message. The Block counter will be populated automatically.
      *
+     *   In a windowed transfer, the BlockAck acknowledges all Blocks received so far. The sender does not wait for it before
+     *   sending the next Block, but stops once its window is full, so each received Block should still be acknowledged.
+     *
      * @return CHIP_ERROR The result of the preparation of a BlockAck message. May also indicate if the TransferSession object
      *                    is unable to handle this request.
      */
@@ -318,6 +336,8 @@ public:
     uint64_t GetStartOffset() const { return mStartOffset; }
     uint64_t GetTransferLength() const { return mTransferLength; }
     uint16_t GetTransferBlockSize() const { return mTransferMaxBlockSize; }
+    bool IsWindowedTransfer() const { return mWindowedTransfer; }
+    uint32_t GetNumBlocksInFlight() const { return mNextBlockNum - mNextUnackedBlockNum; }
     uint32_t GetNextBlockNum() const { return mNextBlockNum; }
     uint32_t GetNextQueryNum() const { return mNextQueryNum; }
     size_t GetNumBytesProcessed() const { return mNumBytesProcessed; }
@@ -327,6 +347,13 @@ public:
         return mTransferRequestData.FileDesignator;
     }
 
+    /**
+     * @brief
+     *   Indicates whether PrepareBlock() can be called now: the transfer is in progress, there is no pending output, and either
+     *   the previous Block was acknowledged or, in a windowed transfer, the window is not full.
+     */
+    bool CanPrepareBlock() const;
+
     TransferSession();
 
 private:
@@ -355,6 +382,7 @@ private:
     void HandleBlockEOF(System::PacketBufferHandle msgData);
     void HandleBlockAck(System::PacketBufferHandle msgData);
     void HandleBlockAckEOF(System::PacketBufferHandle msgData);
+    void HandleWindowedBlockAck(uint32_t blockCounter);
 
     /**
      * @brief
@@ -379,6 +407,7 @@ private:
     // Indicate supported options pre- transfer accept
     BitFlags<TransferControlFlags> mSuppportedXferOpts;
     uint16_t mMaxSupportedBlockSize = 0;
+    bool mTransportIsTcp            = false;
 
     // Used to govern transfer once it has been accepted
     TransferControlFlags mControlMode;
@@ -386,6 +415,7 @@ private:
     uint64_t mStartOffset          = 0; ///< 0 represents no offset
     uint64_t mTransferLength       = 0; ///< 0 represents indefinite length
     uint16_t mTransferMaxBlockSize = 0;
+    bool mWindowedTransfer         = false;
 
     // Used to store event data before it is emitted via PollOutput()
     System::PacketBufferHandle mPendingMsgHandle;
@@ -403,6 +433,9 @@ private:
     uint32_t mLastQueryNum = 0;
     uint32_t mNextQueryNum = 0;
 
+    // Used by the sender of a windowed transfer: Blocks from this one to mNextBlockNum (excluded) are not acknowledged yet
+    uint32_t mNextUnackedBlockNum = 0;
+
     System::Clock::Timeout mTimeout            = System::Clock::kZero;
     System::Clock::Timestamp mTimeoutStartTime = System::Clock::kZero;
     bool mShouldInitTimeoutStart               = true;
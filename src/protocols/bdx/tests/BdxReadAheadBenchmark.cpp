@@ -0,0 +1,216 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures several requestors downloading the same image in lockstep,
+ *      as an OTA provider sees after a fleet-wide software update
+ *      announcement. Compares per-transfer synchronous reads against the
+ *      shared ReadAheadFileReader.
+ *
+ *      Usage: bdx-read-ahead-benchmark [requestor-count]
+ */
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <protocols/bdx/BdxReadAheadBlockSource.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::bdx;
+
+namespace {
+
+constexpr uint16_t kBlockSize       = 1024;
+constexpr size_t kFileSize          = 512 * kBlockSize;
+constexpr size_t kDefaultRequestors = 8;
+
+// Stands in for the Matter event loop: work posted by the reader's worker thread is run by the benchmark.
+std::mutex sLock;
+std::condition_variable sCondition;
+std::deque<std::pair<void (*)(intptr_t), intptr_t>> sQueue;
+
+CHIP_ERROR Dispatch(void (*work)(intptr_t), intptr_t arg)
+{
+    {
+        std::lock_guard<std::mutex> lock(sLock);
+        sQueue.emplace_back(work, arg);
+    }
+    sCondition.notify_one();
+    return CHIP_NO_ERROR;
+}
+
+bool RunPending()
+{
+    std::deque<std::pair<void (*)(intptr_t), intptr_t>> work;
+    {
+        std::unique_lock<std::mutex> lock(sLock);
+        if (!sCondition.wait_for(lock, std::chrono::seconds(5), [] { return !sQueue.empty(); }))
+        {
+            return false;
+        }
+        work.swap(sQueue);
+    }
+    for (auto & item : work)
+    {
+        item.first(item.second);
+    }
+    return true;
+}
+
+CHIP_ERROR GetBlockBlocking(ReadAheadBlockSource & source, uint64_t offset, ByteSpan & block, bool & isEof)
+{
+    while (true)
+    {
+        CHIP_ERROR err = source.GetBlock(offset, block, isEof);
+        if (err != CHIP_ERROR_IN_PROGRESS)
+        {
+            return err;
+        }
+        VerifyOrReturnError(RunPending(), CHIP_ERROR_TIMEOUT);
+    }
+}
+
+CHIP_ERROR CreateFile(char * path)
+{
+    int fd = mkstemp(path);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_POSIX(errno));
+
+    std::vector<uint8_t> data(kFileSize);
+    for (size_t i = 0; i < kFileSize; i++)
+    {
+        data[i] = static_cast<uint8_t>(i * 31);
+    }
+    ssize_t written = write(fd, data.data(), kFileSize);
+    close(fd);
+    VerifyOrReturnError(written == static_cast<ssize_t>(kFileSize), CHIP_ERROR_WRITE_FAILED);
+    return CHIP_NO_ERROR;
+}
+
+// Baseline: one ifstream per transfer, as BdxOtaSender does without the read-ahead source.
+CHIP_ERROR RunSynchronous(const char * path, size_t requestors)
+{
+    std::vector<std::ifstream> streams(requestors);
+    for (auto & stream : streams)
+    {
+        stream.open(path, std::ifstream::binary);
+        VerifyOrReturnError(stream.good(), CHIP_ERROR_OPEN_FAILED);
+    }
+    uint8_t buffer[kBlockSize];
+    for (uint64_t offset = 0; offset < kFileSize; offset += kBlockSize)
+    {
+        for (auto & stream : streams)
+        {
+            stream.seekg(static_cast<std::streamoff>(offset));
+            stream.read(reinterpret_cast<char *>(buffer), kBlockSize);
+            VerifyOrReturnError(stream.gcount() == kBlockSize, CHIP_ERROR_READ_FAILED);
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RunReadAhead(ReadAheadFileReader & reader, const char * path, size_t requestors)
+{
+    std::vector<ReadAheadBlockSource> sources(requestors);
+    for (auto & source : sources)
+    {
+        ReturnErrorOnFailure(source.Open(reader, path, kBlockSize, 0, 0, ReadAheadBlockSource::kDefaultReadAheadDepth, nullptr));
+    }
+    for (uint64_t offset = 0; offset < kFileSize; offset += kBlockSize)
+    {
+        for (auto & source : sources)
+        {
+            ByteSpan block;
+            bool isEof;
+            ReturnErrorOnFailure(GetBlockBlocking(source, offset, block, isEof));
+            VerifyOrReturnError(block.size() == kBlockSize, CHIP_ERROR_READ_FAILED);
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+long long MicrosecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return static_cast<long long>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+CHIP_ERROR RunBenchmark(char * path, size_t requestors)
+{
+    ReturnErrorOnFailure(CreateFile(path));
+
+    auto start = std::chrono::steady_clock::now();
+    ReturnErrorOnFailure(RunSynchronous(path, requestors));
+    long long syncUs = MicrosecondsSince(start);
+
+    ReadAheadFileReader reader;
+    ReturnErrorOnFailure(reader.Init(Dispatch, kBlockSize));
+    start                 = std::chrono::steady_clock::now();
+    CHIP_ERROR err        = RunReadAhead(reader, path, requestors);
+    long long readAheadUs = MicrosecondsSince(start);
+    size_t readCount      = reader.ReadCount();
+    reader.Shutdown();
+    ReturnErrorOnFailure(err);
+
+    ChipLogProgress(BDX, "%u requestors x %u blocks: synchronous %lld us, read-ahead %lld us (%u disk reads)",
+                    static_cast<unsigned>(requestors), static_cast<unsigned>(kFileSize / kBlockSize), syncUs, readAheadUs,
+                    static_cast<unsigned>(readCount));
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    size_t requestors = kDefaultRequestors;
+    if (argc > 1)
+    {
+        int count = atoi(argv[1]);
+        if (count <= 0)
+        {
+            ChipLogError(BDX, "Invalid requestor count: %s", argv[1]);
+            return EXIT_FAILURE;
+        }
+        requestors = static_cast<size_t>(count);
+    }
+
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    char path[]    = "/tmp/bdx-readahead-XXXXXX";
+    CHIP_ERROR err = RunBenchmark(path, requestors);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(BDX, "Read-ahead benchmark failed: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+    unlink(path);
+
+    Platform::MemoryShutdown();
+    return (err == CHIP_NO_ERROR) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
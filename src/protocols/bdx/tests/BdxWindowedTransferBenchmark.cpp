@@ -0,0 +1,317 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Transfers a file between two bdx::TransferSession objects over a
+ *      simulated TCP link with a fixed delay and bandwidth, once in the
+ *      standard sender drive mode and once in the windowed mode. The link
+ *      throughput is simulated and does not depend on the machine; the
+ *      processing throughput is measured.
+ *
+ *      Usage: bdx-windowed-transfer-benchmark
+ */
+
+#include <lib/core/CHIPSafeCasts.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <protocols/bdx/BdxMessages.h>
+#include <protocols/bdx/BdxTransferSession.h>
+#include <system/SystemPacketBuffer.h>
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::bdx;
+
+namespace {
+
+using OutputEventType = TransferSession::OutputEventType;
+
+constexpr System::Clock::Timeout kTimeout = System::Clock::Seconds16(30);
+constexpr uint32_t kWindowSize            = CHIP_CONFIG_BDX_WINDOWED_TRANSFER_MAX_BLOCKS_IN_FLIGHT;
+
+// 4 MiB over a 100 Mbit/s link with a 10 ms round trip time.
+constexpr size_t kFileSize                           = 4 * 1024 * 1024;
+constexpr System::Clock::Microseconds64 kOneWayDelay = System::Clock::Microseconds64(5000);
+constexpr uint64_t kBytesPerSecond                   = 100 * 1000 * 1000 / 8;
+
+constexpr uint16_t kStandardBlockSize = 1024;
+// Windowed transfers go over TCP and may use blocks larger than a regular PacketBuffer, if such buffers can be allocated.
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+constexpr uint16_t kWindowedBlockSize = (System::PacketBuffer::kMaxAllocSize > 16384 + 256) ? 16384 : kStandardBlockSize;
+#else
+constexpr uint16_t kWindowedBlockSize = kStandardBlockSize;
+#endif
+
+char kFileDesignator[] = "bdx-windowed.bin";
+
+CHIP_ERROR Deliver(TransferSession::OutputEvent & event, TransferSession & destination, System::Clock::Timestamp curTime)
+{
+    VerifyOrReturnError(event.EventType == OutputEventType::kMsgToSend, CHIP_ERROR_INCORRECT_STATE);
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetMessageType(event.msgTypeData.ProtocolId, event.msgTypeData.MessageType);
+    return destination.HandleMessageReceived(payloadHeader, std::move(event.MsgData), curTime);
+}
+
+/**
+ * A file transfer between two TransferSession objects over a simulated TCP link.
+ *
+ * Each direction of the link transmits one message at a time at `bytesPerSecond`, and delivers it `oneWayDelay`
+ * after its transmission ends. Sessions react to events immediately, so the simulated time only covers the link.
+ */
+class LoopbackTransfer
+{
+public:
+    LoopbackTransfer(const std::vector<uint8_t> & file, System::Clock::Microseconds64 oneWayDelay, uint64_t bytesPerSecond) :
+        mFile(file), mOneWayDelay(oneWayDelay), mBytesPerSecond(bytesPerSecond)
+    {}
+
+    CHIP_ERROR Run(bool windowed, uint16_t blockSize)
+    {
+        BitFlags<TransferControlFlags> opts(TransferControlFlags::kSenderDrive);
+        opts.Set(TransferControlFlags::kWindowed, windowed);
+
+        mSender.SetTransportIsTcp(true);
+        mReceiver.SetTransportIsTcp(true);
+        ReturnErrorOnFailure(mReceiver.WaitForTransfer(TransferRole::kReceiver, opts, blockSize, kTimeout));
+
+        TransferSession::TransferInitData initData;
+        initData.TransferCtlFlags = opts;
+        initData.MaxBlockSize     = blockSize;
+        initData.Length           = mFile.size();
+        initData.FileDesignator   = Uint8::from_char(kFileDesignator);
+        initData.FileDesLength    = static_cast<uint16_t>(strlen(kFileDesignator));
+        ReturnErrorOnFailure(mSender.StartTransfer(TransferRole::kSender, initData, kTimeout));
+
+        ReturnErrorOnFailure(ServiceSender());
+        while (!mSenderDone)
+        {
+            ReturnErrorOnFailure(DeliverNextMessage());
+            ReturnErrorOnFailure(ServiceReceiver());
+            ReturnErrorOnFailure(ServiceSender());
+        }
+
+        VerifyOrReturnError(mReceivedBytes == mFile.size(), CHIP_ERROR_INTERNAL);
+        VerifyOrReturnError(mSender.IsWindowedTransfer() == windowed, CHIP_ERROR_INTERNAL);
+        return CHIP_NO_ERROR;
+    }
+
+    System::Clock::Microseconds64 GetSimulatedDuration() const { return mNow; }
+    size_t GetMessageCount() const { return mMessageCount; }
+
+private:
+    // Per message bytes added by the TCP/IP and Matter message headers.
+    static constexpr size_t kMessageOverhead = 80;
+
+    struct InFlightMessage
+    {
+        System::Clock::Microseconds64 arrivalTime;
+        TransferSession::OutputEvent event;
+    };
+
+    System::Clock::Timestamp Now() const { return std::chrono::duration_cast<System::Clock::Timestamp>(mNow); }
+
+    void Send(TransferSession::OutputEvent & event, std::deque<InFlightMessage> & link, System::Clock::Microseconds64 & linkFreeAt)
+    {
+        const uint64_t bytes = event.MsgData->TotalLength() + kMessageOverhead;
+        const System::Clock::Microseconds64 transmitTime(bytes * 1000000 / mBytesPerSecond);
+
+        linkFreeAt = std::max(linkFreeAt, mNow) + transmitTime;
+        link.push_back(InFlightMessage{ linkFreeAt + mOneWayDelay, std::move(event) });
+        mMessageCount++;
+    }
+
+    CHIP_ERROR DeliverNextMessage()
+    {
+        std::deque<InFlightMessage> * link = nullptr;
+        TransferSession * destination      = nullptr;
+        if (!mToReceiver.empty() && (mToSender.empty() || mToReceiver.front().arrivalTime <= mToSender.front().arrivalTime))
+        {
+            link        = &mToReceiver;
+            destination = &mReceiver;
+        }
+        else
+        {
+            VerifyOrReturnError(!mToSender.empty(), CHIP_ERROR_INCORRECT_STATE);
+            link        = &mToSender;
+            destination = &mSender;
+        }
+
+        mNow = std::max(mNow, link->front().arrivalTime);
+        TransferSession::OutputEvent event(std::move(link->front().event));
+        link->pop_front();
+        return Deliver(event, *destination, Now());
+    }
+
+    CHIP_ERROR ServiceSender()
+    {
+        while (true)
+        {
+            TransferSession::OutputEvent event;
+            mSender.PollOutput(event, Now());
+            switch (event.EventType)
+            {
+            case OutputEventType::kNone:
+                if (mEofSent || !mSender.CanPrepareBlock())
+                {
+                    return CHIP_NO_ERROR;
+                }
+                ReturnErrorOnFailure(PrepareNextBlock());
+                break;
+            case OutputEventType::kMsgToSend:
+                Send(event, mToReceiver, mToReceiverFreeAt);
+                break;
+            case OutputEventType::kAcceptReceived:
+            case OutputEventType::kAckReceived:
+                break;
+            case OutputEventType::kAckEOFReceived:
+                mSenderDone = true;
+                break;
+            default:
+                ChipLogError(BDX, "Unexpected sender event %s", TransferSession::OutputEvent::TypeToString(event.EventType));
+                return CHIP_ERROR_INTERNAL;
+            }
+        }
+    }
+
+    CHIP_ERROR PrepareNextBlock()
+    {
+        const size_t length = std::min<size_t>(mSender.GetTransferBlockSize(), mFile.size() - mSentBytes);
+
+        TransferSession::BlockData blockData;
+        blockData.Data   = mFile.data() + mSentBytes;
+        blockData.Length = length;
+        blockData.IsEof  = (mSentBytes + length == mFile.size());
+        ReturnErrorOnFailure(mSender.PrepareBlock(blockData));
+
+        mSentBytes += length;
+        mEofSent = blockData.IsEof;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR ServiceReceiver()
+    {
+        while (true)
+        {
+            TransferSession::OutputEvent event;
+            mReceiver.PollOutput(event, Now());
+            switch (event.EventType)
+            {
+            case OutputEventType::kNone:
+                return CHIP_NO_ERROR;
+            case OutputEventType::kMsgToSend:
+                Send(event, mToSender, mToSenderFreeAt);
+                break;
+            case OutputEventType::kInitReceived: {
+                TransferSession::TransferAcceptData acceptData;
+                acceptData.ControlMode  = mReceiver.GetControlMode();
+                acceptData.MaxBlockSize = mReceiver.GetTransferBlockSize();
+                ReturnErrorOnFailure(mReceiver.AcceptTransfer(acceptData));
+                break;
+            }
+            case OutputEventType::kBlockReceived:
+                VerifyOrReturnError(mReceivedBytes + event.blockdata.Length <= mFile.size(), CHIP_ERROR_INTERNAL);
+                VerifyOrReturnError(memcmp(event.blockdata.Data, mFile.data() + mReceivedBytes, event.blockdata.Length) == 0,
+                                    CHIP_ERROR_INTERNAL);
+                mReceivedBytes += event.blockdata.Length;
+                ReturnErrorOnFailure(mReceiver.PrepareBlockAck());
+                break;
+            default:
+                ChipLogError(BDX, "Unexpected receiver event %s", TransferSession::OutputEvent::TypeToString(event.EventType));
+                return CHIP_ERROR_INTERNAL;
+            }
+        }
+    }
+
+    const std::vector<uint8_t> & mFile;
+    const System::Clock::Microseconds64 mOneWayDelay;
+    const uint64_t mBytesPerSecond;
+
+    TransferSession mSender;
+    TransferSession mReceiver;
+
+    std::deque<InFlightMessage> mToReceiver;
+    std::deque<InFlightMessage> mToSender;
+    System::Clock::Microseconds64 mToReceiverFreeAt{ 0 };
+    System::Clock::Microseconds64 mToSenderFreeAt{ 0 };
+    System::Clock::Microseconds64 mNow{ 0 };
+
+    size_t mSentBytes     = 0;
+    size_t mReceivedBytes = 0;
+    size_t mMessageCount  = 0;
+    bool mEofSent         = false;
+    bool mSenderDone      = false;
+};
+
+double MegabytesPerSecond(size_t bytes, double seconds)
+{
+    return seconds > 0 ? static_cast<double>(bytes) / seconds / 1e6 : 0;
+}
+
+CHIP_ERROR RunBenchmark()
+{
+    std::vector<uint8_t> file(kFileSize);
+    for (size_t i = 0; i < file.size(); i++)
+    {
+        file[i] = static_cast<uint8_t>((i * 31) ^ (i >> 8));
+    }
+
+    LoopbackTransfer standard(file, kOneWayDelay, kBytesPerSecond);
+    auto start = std::chrono::steady_clock::now();
+    ReturnErrorOnFailure(standard.Run(false, kStandardBlockSize));
+    const double standardCpuSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    LoopbackTransfer windowed(file, kOneWayDelay, kBytesPerSecond);
+    start = std::chrono::steady_clock::now();
+    ReturnErrorOnFailure(windowed.Run(true, kWindowedBlockSize));
+    const double windowedCpuSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const double standardSeconds = std::chrono::duration<double>(standard.GetSimulatedDuration()).count();
+    const double windowedSeconds = std::chrono::duration<double>(windowed.GetSimulatedDuration()).count();
+
+    ChipLogProgress(BDX, "Standard mode, %u byte blocks: %.2f MB/s on the link, %u messages, %.1f MB/s processing",
+                    kStandardBlockSize, MegabytesPerSecond(kFileSize, standardSeconds),
+                    static_cast<unsigned>(standard.GetMessageCount()), MegabytesPerSecond(kFileSize, standardCpuSeconds));
+    ChipLogProgress(BDX, "Windowed mode, %u byte blocks, %u in flight: %.2f MB/s on the link, %u messages, %.1f MB/s processing",
+                    kWindowedBlockSize, static_cast<unsigned>(kWindowSize), MegabytesPerSecond(kFileSize, windowedSeconds),
+                    static_cast<unsigned>(windowed.GetMessageCount()), MegabytesPerSecond(kFileSize, windowedCpuSeconds));
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    CHIP_ERROR err = RunBenchmark();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(BDX, "Windowed transfer benchmark failed: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    Platform::MemoryShutdown();
+    return (err == CHIP_NO_ERROR) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,299 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <protocols/bdx/BdxReadAheadBlockSource.h>
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+using namespace ::chip;
+using namespace ::chip::bdx;
+
+namespace {
+
+constexpr uint16_t kBlockSize = 1024;
+
+// Stands in for the Matter event loop: work posted by the reader's worker thread is run by the test.
+class TestDispatcher
+{
+public:
+    static CHIP_ERROR Dispatch(void (*work)(intptr_t), intptr_t arg)
+    {
+        {
+            std::lock_guard<std::mutex> lock(sLock);
+            sQueue.emplace_back(work, arg);
+        }
+        sCondition.notify_one();
+        return CHIP_NO_ERROR;
+    }
+
+    // Wait for at least one work item and run everything queued.
+    static bool RunPending(std::chrono::milliseconds timeout = std::chrono::milliseconds(5000))
+    {
+        std::deque<std::pair<void (*)(intptr_t), intptr_t>> work;
+        {
+            std::unique_lock<std::mutex> lock(sLock);
+            if (!sCondition.wait_for(lock, timeout, [] { return !sQueue.empty(); }))
+            {
+                return false;
+            }
+            work.swap(sQueue);
+        }
+        for (auto & item : work)
+        {
+            item.first(item.second);
+        }
+        return true;
+    }
+
+    static void Clear()
+    {
+        std::lock_guard<std::mutex> lock(sLock);
+        sQueue.clear();
+    }
+
+private:
+    static std::mutex sLock;
+    static std::condition_variable sCondition;
+    static std::deque<std::pair<void (*)(intptr_t), intptr_t>> sQueue;
+};
+
+std::mutex TestDispatcher::sLock;
+std::condition_variable TestDispatcher::sCondition;
+std::deque<std::pair<void (*)(intptr_t), intptr_t>> TestDispatcher::sQueue;
+
+uint8_t PatternByte(uint64_t offset)
+{
+    return static_cast<uint8_t>((offset * 31) ^ (offset >> 8));
+}
+
+class ReadyCounter : public ReadAheadBlockSource::Callback
+{
+public:
+    void OnBlockReady(ReadAheadBlockSource & source) override { mCount++; }
+    size_t mCount = 0;
+};
+
+// Fetch a block, running dispatched work until it becomes available.
+CHIP_ERROR GetBlockBlocking(ReadAheadBlockSource & source, uint64_t offset, ByteSpan & block, bool & isEof)
+{
+    while (true)
+    {
+        CHIP_ERROR err = source.GetBlock(offset, block, isEof);
+        if (err != CHIP_ERROR_IN_PROGRESS)
+        {
+            return err;
+        }
+        VerifyOrReturnError(TestDispatcher::RunPending(), CHIP_ERROR_TIMEOUT);
+    }
+}
+
+bool CheckBlock(ByteSpan block, uint64_t offset)
+{
+    for (size_t i = 0; i < block.size(); i++)
+    {
+        if (block.data()[i] != PatternByte(offset + i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+class TestBdxReadAheadBlockSource : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override { TestDispatcher::Clear(); }
+    void TearDown() override
+    {
+        mReader.Shutdown();
+        TestDispatcher::Clear();
+        if (mPath[0] != '\0')
+        {
+            unlink(mPath);
+            mPath[0] = '\0';
+        }
+    }
+
+    void CreateFile(size_t size)
+    {
+        strcpy(mPath, "/tmp/bdx-readahead-XXXXXX");
+        int fd = mkstemp(mPath);
+        ASSERT_GE(fd, 0);
+
+        std::vector<uint8_t> data(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            data[i] = PatternByte(i);
+        }
+        ASSERT_EQ(write(fd, data.data(), size), static_cast<ssize_t>(size));
+        close(fd);
+    }
+
+protected:
+    ReadAheadFileReader mReader;
+    char mPath[64] = {};
+};
+
+TEST_F(TestBdxReadAheadBlockSource, TestSequentialTransfer)
+{
+    constexpr size_t kFileSize = 10 * kBlockSize + 100;
+    CreateFile(kFileSize);
+    ASSERT_EQ(mReader.Init(TestDispatcher::Dispatch, kBlockSize, 8), CHIP_NO_ERROR);
+
+    ReadyCounter callback;
+    ReadAheadBlockSource source;
+    ASSERT_EQ(source.Open(mReader, mPath, kBlockSize, 0, 0, 4, &callback), CHIP_NO_ERROR);
+    EXPECT_EQ(source.EndOffset(), kFileSize);
+
+    uint64_t offset = 0;
+    bool isEof      = false;
+    while (!isEof)
+    {
+        ByteSpan block;
+        ASSERT_EQ(GetBlockBlocking(source, offset, block, isEof), CHIP_NO_ERROR);
+        EXPECT_TRUE(CheckBlock(block, offset));
+        offset += block.size();
+    }
+    EXPECT_EQ(offset, kFileSize);
+
+    // Every block was read from disk exactly once.
+    EXPECT_EQ(mReader.ReadCount(), 11u);
+
+    // Asking past the end reports EOF with an empty block.
+    ByteSpan block;
+    EXPECT_EQ(source.GetBlock(kFileSize, block, isEof), CHIP_NO_ERROR);
+    EXPECT_TRUE(block.empty());
+    EXPECT_TRUE(isEof);
+
+    source.Close();
+    EXPECT_FALSE(source.IsOpen());
+}
+
+TEST_F(TestBdxReadAheadBlockSource, TestOffsetAndLength)
+{
+    CreateFile(8 * kBlockSize);
+    ASSERT_EQ(mReader.Init(TestDispatcher::Dispatch, kBlockSize, 8), CHIP_NO_ERROR);
+
+    ReadAheadBlockSource source;
+    ASSERT_EQ(source.Open(mReader, mPath, kBlockSize, 500, kBlockSize + 10, 2, nullptr), CHIP_NO_ERROR);
+    EXPECT_EQ(source.EndOffset(), 500u + kBlockSize + 10);
+
+    ByteSpan block;
+    bool isEof = true;
+    ASSERT_EQ(GetBlockBlocking(source, 500, block, isEof), CHIP_NO_ERROR);
+    EXPECT_EQ(block.size(), kBlockSize);
+    EXPECT_FALSE(isEof);
+    EXPECT_TRUE(CheckBlock(block, 500));
+
+    ASSERT_EQ(GetBlockBlocking(source, 500 + kBlockSize, block, isEof), CHIP_NO_ERROR);
+    EXPECT_EQ(block.size(), 10u);
+    EXPECT_TRUE(isEof);
+    EXPECT_TRUE(CheckBlock(block, 500 + kBlockSize));
+}
+
+TEST_F(TestBdxReadAheadBlockSource, TestCallbackNotifiesWaitingSource)
+{
+    CreateFile(4 * kBlockSize);
+    ASSERT_EQ(mReader.Init(TestDispatcher::Dispatch, kBlockSize, 4), CHIP_NO_ERROR);
+
+    ReadyCounter callback;
+    ReadAheadBlockSource source;
+    ASSERT_EQ(source.Open(mReader, mPath, kBlockSize, 0, 0, 0, &callback), CHIP_NO_ERROR);
+
+    // Drain the initial read so the third block is guaranteed not to be loaded yet.
+    ASSERT_TRUE(TestDispatcher::RunPending());
+    EXPECT_EQ(callback.mCount, 0u);
+
+    ByteSpan block;
+    bool isEof;
+    ASSERT_EQ(source.GetBlock(2 * kBlockSize, block, isEof), CHIP_ERROR_IN_PROGRESS);
+    ASSERT_TRUE(TestDispatcher::RunPending());
+    EXPECT_EQ(callback.mCount, 1u);
+
+    ASSERT_EQ(source.GetBlock(2 * kBlockSize, block, isEof), CHIP_NO_ERROR);
+    EXPECT_TRUE(CheckBlock(block, 2 * kBlockSize));
+}
+
+TEST_F(TestBdxReadAheadBlockSource, TestInvalidArguments)
+{
+    CreateFile(kBlockSize);
+
+    ReadAheadBlockSource source;
+    EXPECT_EQ(source.Open(mReader, mPath, kBlockSize, 0, 0, 1, nullptr), CHIP_ERROR_INCORRECT_STATE);
+
+    EXPECT_EQ(mReader.Init(nullptr, kBlockSize), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(mReader.Init(TestDispatcher::Dispatch, kBlockSize, ReadAheadFileReader::kMaxBuffers + 1),
+              CHIP_ERROR_INVALID_ARGUMENT);
+    ASSERT_EQ(mReader.Init(TestDispatcher::Dispatch, kBlockSize, 4), CHIP_NO_ERROR);
+    EXPECT_EQ(mReader.Init(TestDispatcher::Dispatch, kBlockSize, 4), CHIP_ERROR_INCORRECT_STATE);
+
+    EXPECT_EQ(source.Open(mReader, mPath, kBlockSize + 1, 0, 0, 1, nullptr), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(source.Open(mReader, "/nonexistent/bdx-readahead", kBlockSize, 0, 0, 1, nullptr), CHIP_ERROR_OPEN_FAILED);
+    EXPECT_FALSE(source.IsOpen());
+
+    ByteSpan block;
+    bool isEof;
+    EXPECT_EQ(source.GetBlock(0, block, isEof), CHIP_ERROR_INCORRECT_STATE);
+}
+
+TEST_F(TestBdxReadAheadBlockSource, TestConcurrentTransfersShareReads)
+{
+    constexpr size_t kRequestors = 4;
+    constexpr size_t kFileSize   = 16 * kBlockSize;
+    CreateFile(kFileSize);
+    ASSERT_EQ(mReader.Init(TestDispatcher::Dispatch, kBlockSize), CHIP_NO_ERROR);
+
+    ReadAheadBlockSource sources[kRequestors];
+    for (auto & source : sources)
+    {
+        ASSERT_EQ(source.Open(mReader, mPath, kBlockSize, 0, 0, ReadAheadBlockSource::kDefaultReadAheadDepth, nullptr),
+                  CHIP_NO_ERROR);
+    }
+    for (uint64_t offset = 0; offset < kFileSize; offset += kBlockSize)
+    {
+        for (auto & source : sources)
+        {
+            ByteSpan block;
+            bool isEof;
+            ASSERT_EQ(GetBlockBlocking(source, offset, block, isEof), CHIP_NO_ERROR);
+            ASSERT_EQ(block.size(), kBlockSize);
+            EXPECT_TRUE(CheckBlock(block, offset));
+        }
+    }
+
+    // Transfers of the same file in lockstep read every block from disk once.
+    EXPECT_EQ(mReader.ReadCount(), kFileSize / kBlockSize);
+}
+
+} // namespace
@@ -0,0 +1,568 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Unit tests for the windowed mode of bdx::TransferSession.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPSafeCasts.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <protocols/bdx/BdxMessages.h>
+#include <protocols/bdx/BdxTransferSession.h>
+#include <protocols/secure_channel/StatusReport.h>
+#include <system/SystemPacketBuffer.h>
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <string.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::bdx;
+
+namespace {
+
+using OutputEventType = TransferSession::OutputEventType;
+
+constexpr System::Clock::Timestamp kNoAdvanceTime = System::Clock::kZero;
+constexpr System::Clock::Timeout kTimeout         = System::Clock::Seconds16(30);
+constexpr uint32_t kWindowSize                    = CHIP_CONFIG_BDX_WINDOWED_TRANSFER_MAX_BLOCKS_IN_FLIGHT;
+
+constexpr uint16_t kStandardBlockSize = 1024;
+// Windowed transfers go over TCP and may use blocks larger than a regular PacketBuffer, if such buffers can be allocated.
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+constexpr uint16_t kWindowedBlockSize = (System::PacketBuffer::kMaxAllocSize > 16384 + 256) ? 16384 : kStandardBlockSize;
+#else
+constexpr uint16_t kWindowedBlockSize = kStandardBlockSize;
+#endif
+
+char kFileDesignator[] = "bdx-windowed.bin";
+
+CHIP_ERROR Deliver(TransferSession::OutputEvent & event, TransferSession & destination,
+                   System::Clock::Timestamp curTime = kNoAdvanceTime)
+{
+    VerifyOrReturnError(event.EventType == OutputEventType::kMsgToSend, CHIP_ERROR_INCORRECT_STATE);
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetMessageType(event.msgTypeData.ProtocolId, event.msgTypeData.MessageType);
+    return destination.HandleMessageReceived(payloadHeader, std::move(event.MsgData), curTime);
+}
+
+OutputEventType PollAndDeliver(TransferSession & source, TransferSession & destination)
+{
+    TransferSession::OutputEvent event;
+    source.PollOutput(event, kNoAdvanceTime);
+    if (event.EventType == OutputEventType::kMsgToSend)
+    {
+        EXPECT_EQ(Deliver(event, destination), CHIP_NO_ERROR);
+    }
+    return event.EventType;
+}
+
+OutputEventType PollEventType(TransferSession & session)
+{
+    TransferSession::OutputEvent event;
+    session.PollOutput(event, kNoAdvanceTime);
+    return event.EventType;
+}
+
+/**
+ * Negotiates a sender drive transfer initiated by the sender, proposing the windowed mode if `senderWindowed` and
+ * supporting it on the receiver if `receiverWindowed`.
+ */
+void NegotiateSenderDrive(TransferSession & sender, TransferSession & receiver, bool senderWindowed, bool receiverWindowed,
+                          uint16_t blockSize)
+{
+    BitFlags<TransferControlFlags> senderOpts(TransferControlFlags::kSenderDrive);
+    senderOpts.Set(TransferControlFlags::kWindowed, senderWindowed);
+    BitFlags<TransferControlFlags> receiverOpts(TransferControlFlags::kSenderDrive);
+    receiverOpts.Set(TransferControlFlags::kWindowed, receiverWindowed);
+
+    sender.SetTransportIsTcp(true);
+    receiver.SetTransportIsTcp(true);
+    ASSERT_EQ(receiver.WaitForTransfer(TransferRole::kReceiver, receiverOpts, blockSize, kTimeout), CHIP_NO_ERROR);
+
+    TransferSession::TransferInitData initData;
+    initData.TransferCtlFlags = senderOpts;
+    initData.MaxBlockSize     = blockSize;
+    initData.FileDesignator   = Uint8::from_char(kFileDesignator);
+    initData.FileDesLength    = static_cast<uint16_t>(strlen(kFileDesignator));
+    ASSERT_EQ(sender.StartTransfer(TransferRole::kSender, initData, kTimeout), CHIP_NO_ERROR);
+
+    ASSERT_EQ(PollAndDeliver(sender, receiver), OutputEventType::kMsgToSend);
+    ASSERT_EQ(PollEventType(receiver), OutputEventType::kInitReceived);
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = receiver.GetControlMode();
+    acceptData.MaxBlockSize = blockSize;
+    ASSERT_EQ(receiver.AcceptTransfer(acceptData), CHIP_NO_ERROR);
+
+    ASSERT_EQ(PollAndDeliver(receiver, sender), OutputEventType::kMsgToSend);
+    ASSERT_EQ(PollEventType(sender), OutputEventType::kAcceptReceived);
+}
+
+CHIP_ERROR PrepareAndDeliverBlock(TransferSession & sender, TransferSession & receiver, uint8_t fill, bool isEof = false)
+{
+    uint8_t data[kStandardBlockSize];
+    memset(data, fill, sizeof(data));
+
+    TransferSession::BlockData blockData;
+    blockData.Data   = data;
+    blockData.Length = sizeof(data);
+    blockData.IsEof  = isEof;
+    ReturnErrorOnFailure(sender.PrepareBlock(blockData));
+
+    VerifyOrReturnError(PollAndDeliver(sender, receiver) == OutputEventType::kMsgToSend, CHIP_ERROR_INTERNAL);
+
+    TransferSession::OutputEvent event;
+    receiver.PollOutput(event, kNoAdvanceTime);
+    VerifyOrReturnError(event.EventType == OutputEventType::kBlockReceived, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(event.blockdata.Length == sizeof(data) && event.blockdata.Data[0] == fill, CHIP_ERROR_INTERNAL);
+    return CHIP_NO_ERROR;
+}
+
+/**
+ * A file transfer between two TransferSession objects over a simulated TCP link.
+ *
+ * Each direction of the link transmits one message at a time at `bytesPerSecond`, and delivers it `oneWayDelay`
+ * after its transmission ends. Sessions react to events immediately, so the simulated time only covers the link.
+ */
+class LoopbackTransfer
+{
+public:
+    LoopbackTransfer(const std::vector<uint8_t> & file, System::Clock::Microseconds64 oneWayDelay, uint64_t bytesPerSecond) :
+        mFile(file), mOneWayDelay(oneWayDelay), mBytesPerSecond(bytesPerSecond)
+    {}
+
+    CHIP_ERROR Run(bool windowed, uint16_t blockSize)
+    {
+        BitFlags<TransferControlFlags> opts(TransferControlFlags::kSenderDrive);
+        opts.Set(TransferControlFlags::kWindowed, windowed);
+
+        mSender.SetTransportIsTcp(true);
+        mReceiver.SetTransportIsTcp(true);
+        ReturnErrorOnFailure(mReceiver.WaitForTransfer(TransferRole::kReceiver, opts, blockSize, kTimeout));
+
+        TransferSession::TransferInitData initData;
+        initData.TransferCtlFlags = opts;
+        initData.MaxBlockSize     = blockSize;
+        initData.Length           = mFile.size();
+        initData.FileDesignator   = Uint8::from_char(kFileDesignator);
+        initData.FileDesLength    = static_cast<uint16_t>(strlen(kFileDesignator));
+        ReturnErrorOnFailure(mSender.StartTransfer(TransferRole::kSender, initData, kTimeout));
+
+        ReturnErrorOnFailure(ServiceSender());
+        while (!mSenderDone)
+        {
+            ReturnErrorOnFailure(DeliverNextMessage());
+            ReturnErrorOnFailure(ServiceReceiver());
+            ReturnErrorOnFailure(ServiceSender());
+        }
+
+        VerifyOrReturnError(mReceivedBytes == mFile.size(), CHIP_ERROR_INTERNAL);
+        VerifyOrReturnError(mSender.IsWindowedTransfer() == windowed, CHIP_ERROR_INTERNAL);
+        return CHIP_NO_ERROR;
+    }
+
+    System::Clock::Microseconds64 GetSimulatedDuration() const { return mNow; }
+    size_t GetMessageCount() const { return mMessageCount; }
+
+private:
+    // Per message bytes added by the TCP/IP and Matter message headers.
+    static constexpr size_t kMessageOverhead = 80;
+
+    struct InFlightMessage
+    {
+        System::Clock::Microseconds64 arrivalTime;
+        TransferSession::OutputEvent event;
+    };
+
+    System::Clock::Timestamp Now() const { return std::chrono::duration_cast<System::Clock::Timestamp>(mNow); }
+
+    void Send(TransferSession::OutputEvent & event, std::deque<InFlightMessage> & link, System::Clock::Microseconds64 & linkFreeAt)
+    {
+        const uint64_t bytes = event.MsgData->TotalLength() + kMessageOverhead;
+        const System::Clock::Microseconds64 transmitTime(bytes * 1000000 / mBytesPerSecond);
+
+        linkFreeAt = std::max(linkFreeAt, mNow) + transmitTime;
+        link.push_back(InFlightMessage{ linkFreeAt + mOneWayDelay, std::move(event) });
+        mMessageCount++;
+    }
+
+    CHIP_ERROR DeliverNextMessage()
+    {
+        std::deque<InFlightMessage> * link = nullptr;
+        TransferSession * destination      = nullptr;
+        if (!mToReceiver.empty() && (mToSender.empty() || mToReceiver.front().arrivalTime <= mToSender.front().arrivalTime))
+        {
+            link        = &mToReceiver;
+            destination = &mReceiver;
+        }
+        else
+        {
+            VerifyOrReturnError(!mToSender.empty(), CHIP_ERROR_INCORRECT_STATE);
+            link        = &mToSender;
+            destination = &mSender;
+        }
+
+        mNow = std::max(mNow, link->front().arrivalTime);
+        TransferSession::OutputEvent event(std::move(link->front().event));
+        link->pop_front();
+        return Deliver(event, *destination, Now());
+    }
+
+    CHIP_ERROR ServiceSender()
+    {
+        while (true)
+        {
+            TransferSession::OutputEvent event;
+            mSender.PollOutput(event, Now());
+            switch (event.EventType)
+            {
+            case OutputEventType::kNone:
+                if (mEofSent || !mSender.CanPrepareBlock())
+                {
+                    return CHIP_NO_ERROR;
+                }
+                ReturnErrorOnFailure(PrepareNextBlock());
+                break;
+            case OutputEventType::kMsgToSend:
+                Send(event, mToReceiver, mToReceiverFreeAt);
+                break;
+            case OutputEventType::kAcceptReceived:
+            case OutputEventType::kAckReceived:
+                break;
+            case OutputEventType::kAckEOFReceived:
+                mSenderDone = true;
+                break;
+            default:
+                ChipLogError(BDX, "Unexpected sender event %s", TransferSession::OutputEvent::TypeToString(event.EventType));
+                return CHIP_ERROR_INTERNAL;
+            }
+        }
+    }
+
+    CHIP_ERROR PrepareNextBlock()
+    {
+        const size_t length = std::min<size_t>(mSender.GetTransferBlockSize(), mFile.size() - mSentBytes);
+
+        TransferSession::BlockData blockData;
+        blockData.Data   = mFile.data() + mSentBytes;
+        blockData.Length = length;
+        blockData.IsEof  = (mSentBytes + length == mFile.size());
+        ReturnErrorOnFailure(mSender.PrepareBlock(blockData));
+
+        mSentBytes += length;
+        mEofSent = blockData.IsEof;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR ServiceReceiver()
+    {
+        while (true)
+        {
+            TransferSession::OutputEvent event;
+            mReceiver.PollOutput(event, Now());
+            switch (event.EventType)
+            {
+            case OutputEventType::kNone:
+                return CHIP_NO_ERROR;
+            case OutputEventType::kMsgToSend:
+                Send(event, mToSender, mToSenderFreeAt);
+                break;
+            case OutputEventType::kInitReceived: {
+                TransferSession::TransferAcceptData acceptData;
+                acceptData.ControlMode  = mReceiver.GetControlMode();
+                acceptData.MaxBlockSize = mReceiver.GetTransferBlockSize();
+                ReturnErrorOnFailure(mReceiver.AcceptTransfer(acceptData));
+                break;
+            }
+            case OutputEventType::kBlockReceived:
+                VerifyOrReturnError(mReceivedBytes + event.blockdata.Length <= mFile.size(), CHIP_ERROR_INTERNAL);
+                VerifyOrReturnError(memcmp(event.blockdata.Data, mFile.data() + mReceivedBytes, event.blockdata.Length) == 0,
+                                    CHIP_ERROR_INTERNAL);
+                mReceivedBytes += event.blockdata.Length;
+                ReturnErrorOnFailure(mReceiver.PrepareBlockAck());
+                break;
+            default:
+                ChipLogError(BDX, "Unexpected receiver event %s", TransferSession::OutputEvent::TypeToString(event.EventType));
+                return CHIP_ERROR_INTERNAL;
+            }
+        }
+    }
+
+    const std::vector<uint8_t> & mFile;
+    const System::Clock::Microseconds64 mOneWayDelay;
+    const uint64_t mBytesPerSecond;
+
+    TransferSession mSender;
+    TransferSession mReceiver;
+
+    std::deque<InFlightMessage> mToReceiver;
+    std::deque<InFlightMessage> mToSender;
+    System::Clock::Microseconds64 mToReceiverFreeAt{ 0 };
+    System::Clock::Microseconds64 mToSenderFreeAt{ 0 };
+    System::Clock::Microseconds64 mNow{ 0 };
+
+    size_t mSentBytes     = 0;
+    size_t mReceivedBytes = 0;
+    size_t mMessageCount  = 0;
+    bool mEofSent         = false;
+    bool mSenderDone      = false;
+};
+
+class TestBdxWindowedTransfer : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestBdxWindowedTransfer, NegotiatesWindowedModeWhenBothNodesSupportIt)
+{
+    TransferSession sender;
+    TransferSession receiver;
+    NegotiateSenderDrive(sender, receiver, true, true, kStandardBlockSize);
+
+    EXPECT_TRUE(sender.IsWindowedTransfer());
+    EXPECT_TRUE(receiver.IsWindowedTransfer());
+    EXPECT_EQ(sender.GetControlMode(), TransferControlFlags::kSenderDrive);
+    EXPECT_EQ(receiver.GetControlMode(), TransferControlFlags::kSenderDrive);
+}
+
+TEST_F(TestBdxWindowedTransfer, NegotiatesWindowedModeInReceiveAccept)
+{
+    TransferSession sender;
+    TransferSession receiver;
+    const BitFlags<TransferControlFlags> opts(TransferControlFlags::kSenderDrive, TransferControlFlags::kWindowed);
+
+    sender.SetTransportIsTcp(true);
+    receiver.SetTransportIsTcp(true);
+    ASSERT_EQ(sender.WaitForTransfer(TransferRole::kSender, opts, kStandardBlockSize, kTimeout), CHIP_NO_ERROR);
+
+    TransferSession::TransferInitData initData;
+    initData.TransferCtlFlags = opts;
+    initData.MaxBlockSize     = kStandardBlockSize;
+    initData.FileDesignator   = Uint8::from_char(kFileDesignator);
+    initData.FileDesLength    = static_cast<uint16_t>(strlen(kFileDesignator));
+    ASSERT_EQ(receiver.StartTransfer(TransferRole::kReceiver, initData, kTimeout), CHIP_NO_ERROR);
+    ASSERT_EQ(PollAndDeliver(receiver, sender), OutputEventType::kMsgToSend);
+    ASSERT_EQ(PollEventType(sender), OutputEventType::kInitReceived);
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = sender.GetControlMode();
+    acceptData.MaxBlockSize = kStandardBlockSize;
+    ASSERT_EQ(sender.AcceptTransfer(acceptData), CHIP_NO_ERROR);
+    ASSERT_EQ(PollAndDeliver(sender, receiver), OutputEventType::kMsgToSend);
+    ASSERT_EQ(PollEventType(receiver), OutputEventType::kAcceptReceived);
+
+    EXPECT_TRUE(sender.IsWindowedTransfer());
+    EXPECT_TRUE(receiver.IsWindowedTransfer());
+}
+
+TEST_F(TestBdxWindowedTransfer, FallsBackToStandardModeWithoutPeerSupport)
+{
+    // Proposed by the sender only: the Accept message does not confirm it and blocks are sent one at a time.
+    {
+        TransferSession sender;
+        TransferSession receiver;
+        NegotiateSenderDrive(sender, receiver, true, false, kStandardBlockSize);
+
+        EXPECT_FALSE(sender.IsWindowedTransfer());
+        EXPECT_FALSE(receiver.IsWindowedTransfer());
+
+        EXPECT_TRUE(sender.CanPrepareBlock());
+        EXPECT_EQ(PrepareAndDeliverBlock(sender, receiver, 1), CHIP_NO_ERROR);
+        EXPECT_FALSE(sender.CanPrepareBlock());
+        EXPECT_EQ(PrepareAndDeliverBlock(sender, receiver, 2), CHIP_ERROR_INCORRECT_STATE);
+    }
+
+    // Supported by the receiver only: never proposed, so never used.
+    {
+        TransferSession sender;
+        TransferSession receiver;
+        NegotiateSenderDrive(sender, receiver, false, true, kStandardBlockSize);
+
+        EXPECT_FALSE(sender.IsWindowedTransfer());
+        EXPECT_FALSE(receiver.IsWindowedTransfer());
+    }
+}
+
+TEST_F(TestBdxWindowedTransfer, RejectsWindowedModeWithoutTcp)
+{
+    const BitFlags<TransferControlFlags> opts(TransferControlFlags::kSenderDrive, TransferControlFlags::kWindowed);
+
+    TransferSession sender;
+    EXPECT_EQ(sender.WaitForTransfer(TransferRole::kSender, opts, kStandardBlockSize, kTimeout), CHIP_ERROR_INVALID_ARGUMENT);
+
+    TransferSession receiver;
+    TransferSession::TransferInitData initData;
+    initData.TransferCtlFlags = opts;
+    initData.MaxBlockSize     = kStandardBlockSize;
+    initData.FileDesignator   = Uint8::from_char(kFileDesignator);
+    initData.FileDesLength    = static_cast<uint16_t>(strlen(kFileDesignator));
+    EXPECT_EQ(receiver.StartTransfer(TransferRole::kReceiver, initData, kTimeout), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Reset() forgets the transport.
+    sender.SetTransportIsTcp(true);
+    sender.Reset();
+    EXPECT_EQ(sender.WaitForTransfer(TransferRole::kSender, opts, kStandardBlockSize, kTimeout), CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(TestBdxWindowedTransfer, RejectsWindowedAcceptThatWasNotProposed)
+{
+    TransferSession sender;
+    sender.SetTransportIsTcp(true);
+    ASSERT_EQ(sender.WaitForTransfer(TransferRole::kSender, BitFlags<TransferControlFlags>(TransferControlFlags::kSenderDrive),
+                                     kStandardBlockSize, kTimeout),
+              CHIP_NO_ERROR);
+
+    TransferSession receiver;
+    receiver.SetTransportIsTcp(true);
+    TransferSession::TransferInitData initData;
+    initData.TransferCtlFlags = TransferControlFlags::kSenderDrive;
+    initData.MaxBlockSize     = kStandardBlockSize;
+    initData.FileDesignator   = Uint8::from_char(kFileDesignator);
+    initData.FileDesLength    = static_cast<uint16_t>(strlen(kFileDesignator));
+    ASSERT_EQ(receiver.StartTransfer(TransferRole::kReceiver, initData, kTimeout), CHIP_NO_ERROR);
+    ASSERT_EQ(PollAndDeliver(receiver, sender), OutputEventType::kMsgToSend);
+    ASSERT_EQ(PollEventType(sender), OutputEventType::kInitReceived);
+
+    // Forge a ReceiveAccept that confirms the windowed mode.
+    ReceiveAccept acceptMsg;
+    acceptMsg.TransferCtlFlags.Set(TransferControlFlags::kSenderDrive).Set(TransferControlFlags::kWindowed);
+    acceptMsg.MaxBlockSize = kStandardBlockSize;
+    Encoding::LittleEndian::PacketBufferWriter writer(System::PacketBufferHandle::New(acceptMsg.MessageSize()),
+                                                      acceptMsg.MessageSize());
+    acceptMsg.WriteToBuffer(writer);
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetMessageType(MessageType::ReceiveAccept);
+    ASSERT_EQ(receiver.HandleMessageReceived(payloadHeader, writer.Finalize(), kNoAdvanceTime), CHIP_NO_ERROR);
+
+    TransferSession::OutputEvent event;
+    receiver.PollOutput(event, kNoAdvanceTime);
+    ASSERT_EQ(event.EventType, OutputEventType::kMsgToSend);
+    Protocols::SecureChannel::StatusReport report;
+    ASSERT_EQ(report.Parse(std::move(event.MsgData)), CHIP_NO_ERROR);
+    EXPECT_EQ(report.GetProtocolCode(), to_underlying(StatusCode::kTransferMethodNotSupported));
+    EXPECT_FALSE(receiver.IsWindowedTransfer());
+}
+
+TEST_F(TestBdxWindowedTransfer, KeepsWindowOfBlocksInFlight)
+{
+    TransferSession sender;
+    TransferSession receiver;
+    NegotiateSenderDrive(sender, receiver, true, true, kStandardBlockSize);
+    ASSERT_TRUE(sender.IsWindowedTransfer());
+
+    // The sender fills its window without waiting for any BlockAck.
+    for (uint32_t i = 0; i < kWindowSize; i++)
+    {
+        ASSERT_TRUE(sender.CanPrepareBlock());
+        ASSERT_EQ(PrepareAndDeliverBlock(sender, receiver, static_cast<uint8_t>(i)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(sender.GetNumBlocksInFlight(), kWindowSize);
+    EXPECT_FALSE(sender.CanPrepareBlock());
+    EXPECT_EQ(PrepareAndDeliverBlock(sender, receiver, 0xFF), CHIP_ERROR_INCORRECT_STATE);
+
+    // A single BlockAck acknowledges all blocks received so far.
+    ASSERT_EQ(receiver.PrepareBlockAck(), CHIP_NO_ERROR);
+    ASSERT_EQ(PollAndDeliver(receiver, sender), OutputEventType::kMsgToSend);
+    EXPECT_EQ(PollEventType(sender), OutputEventType::kAckReceived);
+    EXPECT_EQ(sender.GetNumBlocksInFlight(), 0u);
+
+    // Send two more blocks and the BlockEOF, acknowledging the first block only after the BlockEOF went out.
+    ASSERT_EQ(PrepareAndDeliverBlock(sender, receiver, 1), CHIP_NO_ERROR);
+    ASSERT_EQ(receiver.PrepareBlockAck(), CHIP_NO_ERROR);
+    TransferSession::OutputEvent lateAck;
+    receiver.PollOutput(lateAck, kNoAdvanceTime);
+    ASSERT_EQ(lateAck.EventType, OutputEventType::kMsgToSend);
+
+    ASSERT_EQ(PrepareAndDeliverBlock(sender, receiver, 2), CHIP_NO_ERROR);
+    ASSERT_EQ(PrepareAndDeliverBlock(sender, receiver, 3, true), CHIP_NO_ERROR);
+    EXPECT_EQ(sender.GetNumBlocksInFlight(), 3u);
+    EXPECT_FALSE(sender.CanPrepareBlock());
+
+    ASSERT_EQ(Deliver(lateAck, sender), CHIP_NO_ERROR);
+    EXPECT_EQ(PollEventType(sender), OutputEventType::kAckReceived);
+    EXPECT_EQ(sender.GetNumBlocksInFlight(), 2u);
+
+    ASSERT_EQ(receiver.PrepareBlockAck(), CHIP_NO_ERROR);
+    ASSERT_EQ(PollAndDeliver(receiver, sender), OutputEventType::kMsgToSend);
+    EXPECT_EQ(PollEventType(sender), OutputEventType::kAckEOFReceived);
+    EXPECT_EQ(sender.GetNumBlocksInFlight(), 0u);
+    EXPECT_EQ(PollEventType(sender), OutputEventType::kNone);
+}
+
+TEST_F(TestBdxWindowedTransfer, RejectsBlockAckForBlockNotInFlight)
+{
+    TransferSession sender;
+    TransferSession receiver;
+    NegotiateSenderDrive(sender, receiver, true, true, kStandardBlockSize);
+
+    ASSERT_EQ(PrepareAndDeliverBlock(sender, receiver, 0), CHIP_NO_ERROR);
+    ASSERT_EQ(PrepareAndDeliverBlock(sender, receiver, 1), CHIP_NO_ERROR);
+
+    CounterMessage ackMsg;
+    ackMsg.BlockCounter = 2;
+    Encoding::LittleEndian::PacketBufferWriter writer(System::PacketBufferHandle::New(ackMsg.MessageSize()), ackMsg.MessageSize());
+    ackMsg.WriteToBuffer(writer);
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetMessageType(MessageType::BlockAck);
+    ASSERT_EQ(sender.HandleMessageReceived(payloadHeader, writer.Finalize(), kNoAdvanceTime), CHIP_NO_ERROR);
+
+    TransferSession::OutputEvent event;
+    sender.PollOutput(event, kNoAdvanceTime);
+    ASSERT_EQ(event.EventType, OutputEventType::kMsgToSend);
+    Protocols::SecureChannel::StatusReport report;
+    ASSERT_EQ(report.Parse(std::move(event.MsgData)), CHIP_NO_ERROR);
+    EXPECT_EQ(report.GetProtocolCode(), to_underlying(StatusCode::kBadBlockCounter));
+}
+
+TEST_F(TestBdxWindowedTransfer, WindowedTransferOutpacesStandardModeOverSlowLink)
+{
+    // 256 KiB over a 100 Mbit/s link with a 10 ms round trip time.
+    constexpr size_t kFileSize                           = 256 * 1024;
+    constexpr System::Clock::Microseconds64 kOneWayDelay = System::Clock::Microseconds64(5000);
+    constexpr uint64_t kBytesPerSecond                   = 100 * 1000 * 1000 / 8;
+
+    std::vector<uint8_t> file(kFileSize);
+    for (size_t i = 0; i < file.size(); i++)
+    {
+        file[i] = static_cast<uint8_t>((i * 31) ^ (i >> 8));
+    }
+
+    LoopbackTransfer standard(file, kOneWayDelay, kBytesPerSecond);
+    ASSERT_EQ(standard.Run(false, kStandardBlockSize), CHIP_NO_ERROR);
+
+    LoopbackTransfer windowed(file, kOneWayDelay, kBytesPerSecond);
+    ASSERT_EQ(windowed.Run(true, kWindowedBlockSize), CHIP_NO_ERROR);
+
+    // The standard mode is bound by one block per round trip, the windowed mode by the link bandwidth.
+    EXPECT_LT(windowed.GetSimulatedDuration(), standard.GetSimulatedDuration());
+}
+
+} // namespace
@@ -34,6 +34,7 @@
 #include <lib/core/CHIPSafeCasts.h>
 #include <lib/support/CHIPFaultInjection.h>
 #include <lib/support/CHIPMem.h>
+#include <lib/support/CHIPMemTracking.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/ScopedBuffer.h>
@@ -153,205 +154,6 @@ static constexpr ExchangeContext::Timeout kExpectedLowProcessingTime    = System
 static constexpr ExchangeContext::Timeout kExpectedSigma1ProcessingTime = kExpectedLowProcessingTime;
 static constexpr ExchangeContext::Timeout kExpectedHighProcessingTime   = System::Clock::Seconds16(30);
 
-// Helper for managing a session's outstanding work.
-// Holds work data which is provided to a scheduled work callback (standalone),
-// then (if not canceled) to a scheduled after work callback (on the session).
-template <class DATA>
-class CASESession::WorkHelper
-{
-public:
-    // Work callback, processed in the background via `PlatformManager::ScheduleBackgroundWork`.
-    // This is a non-member function which does not use the associated session.
-    // The return value is passed to the after work callback (called afterward).
-    // Set `cancel` to true if calling the after work callback is not necessary.
-    typedef CHIP_ERROR (*WorkCallback)(DATA & data, bool & cancel);
-
-    // After work callback, processed in the main Matter task via `PlatformManager::ScheduleWork`.
-    // This is a member function to be called on the associated session after the work callback.
-    // The `status` value is the result of the work callback (called beforehand), or the status of
-    // queueing the after work callback back to the Matter thread, if the work callback succeeds
-    // but queueing fails.
-    //
-    // When this callback is called asynchronously (i.e. via ScheduleWork), the helper guarantees
-    // that it will keep itself (and hence `data`) alive until the callback completes.
-    typedef CHIP_ERROR (CASESession::*AfterWorkCallback)(DATA & data, CHIP_ERROR status);
-
-public:
-    // Create a work helper using the specified session, work callback, after work callback, and data (template arg).
-    // Lifetime is managed by sharing between the caller (typically the session) and the helper itself (while work is scheduled).
-    static Platform::SharedPtr<WorkHelper> Create(CASESession & session, WorkCallback workCallback,
-                                                  AfterWorkCallback afterWorkCallback)
-    {
-        struct EnableShared : public WorkHelper
-        {
-            EnableShared(CASESession & session, WorkCallback workCallback, AfterWorkCallback afterWorkCallback) :
-                WorkHelper(session, workCallback, afterWorkCallback)
-            {}
-        };
-        auto ptr = Platform::MakeShared<EnableShared>(session, workCallback, afterWorkCallback);
-        if (ptr)
-        {
-            ptr->mWeakPtr = ptr; // used by `ScheduleWork`
-        }
-        return ptr;
-    }
-
-    // Do the work immediately.
-    // No scheduling, no outstanding work, no shared lifetime management.
-    //
-    // The caller must guarantee that it keeps the helper alive across this call, most likely by
-    // holding a reference to it on the stack.
-    CHIP_ERROR DoWork()
-    {
-        // Ensure that this function is being called from main Matter thread
-        assertChipStackLockedByCurrentThread();
-
-        VerifyOrReturnError(mSession && mWorkCallback && mAfterWorkCallback, CHIP_ERROR_INCORRECT_STATE);
-        auto * helper   = this;
-        bool cancel     = false;
-        helper->mStatus = helper->mWorkCallback(helper->mData, cancel);
-        if (!cancel)
-        {
-            helper->mStatus = (helper->mSession->*(helper->mAfterWorkCallback))(helper->mData, helper->mStatus);
-        }
-        return helper->mStatus;
-    }
-
-    // Schedule the work for later execution.
-    // If lifetime is managed, the helper shares management while work is outstanding.
-    CHIP_ERROR ScheduleWork()
-    {
-        VerifyOrReturnError(mSession && mWorkCallback && mAfterWorkCallback, CHIP_ERROR_INCORRECT_STATE);
-        // Hold strong ptr while work is outstanding
-        mStrongPtr  = mWeakPtr.lock(); // set in `Create`
-        auto status = DeviceLayer::PlatformMgr().ScheduleBackgroundWork(WorkHandler, reinterpret_cast<intptr_t>(this));
-        if (status != CHIP_NO_ERROR)
-        {
-            // Release strong ptr since scheduling failed.
-            mStrongPtr.reset();
-        }
-        return status;
-    }
-
-    // Cancel the work, by clearing the associated session.
-    void CancelWork() { mSession.store(nullptr); }
-
-    bool IsCancelled() const { return mSession.load() == nullptr; }
-
-    // This API returns true when background thread fails to schedule the AfterWorkCallback
-    bool UnableToScheduleAfterWorkCallback() { return mScheduleAfterWorkFailed.load(); }
-
-    // Do after work immediately.
-    // No scheduling, no outstanding work, no shared lifetime management.
-    void DoAfterWork()
-    {
-        VerifyOrDie(UnableToScheduleAfterWorkCallback());
-        AfterWorkHandler(reinterpret_cast<intptr_t>(this));
-    }
-
-private:
-    // Create a work helper using the specified session, work callback, after work callback, and data (template arg).
-    // Lifetime is not managed, see `Create` for that option.
-    WorkHelper(CASESession & session, WorkCallback workCallback, AfterWorkCallback afterWorkCallback) :
-        mSession(&session), mWorkCallback(workCallback), mAfterWorkCallback(afterWorkCallback)
-    {}
-
-    // Handler for the work callback.
-    static void WorkHandler(intptr_t arg)
-    {
-        auto * helper = reinterpret_cast<WorkHelper *>(arg);
-        // Hold strong ptr while work is handled
-        auto strongPtr(std::move(helper->mStrongPtr));
-        VerifyOrReturn(!helper->IsCancelled());
-        bool cancel = false;
-        // Execute callback in background thread; data must be OK with this
-        helper->mStatus = helper->mWorkCallback(helper->mData, cancel);
-        VerifyOrReturn(!cancel && !helper->IsCancelled());
-        // Hold strong ptr to ourselves while work is outstanding
-        helper->mStrongPtr.swap(strongPtr);
-        auto status = DeviceLayer::PlatformMgr().ScheduleWork(AfterWorkHandler, reinterpret_cast<intptr_t>(helper));
-        if (status != CHIP_NO_ERROR)
-        {
-            ChipLogError(SecureChannel, "Failed to Schedule the AfterWorkCallback on foreground thread: %" CHIP_ERROR_FORMAT,
-                         status.Format());
-
-            // We failed to schedule after work callback, so setting mScheduleAfterWorkFailed flag to true
-            // This can be checked from foreground thread and after work callback can be retried
-            helper->mStatus = status;
-
-            // Release strong ptr to self since scheduling failed, because nothing guarantees
-            // that AfterWorkHandler will get called at this point to release the reference,
-            // and we don't want to leak.  That said, we want to ensure that "helper" stays
-            // alive through the end of this function (so we can set mScheduleAfterWorkFailed
-            // on it), but also want to avoid racing on the single SharedPtr instance in
-            // helper->mStrongPtr.  That means we need to not touch helper->mStrongPtr after
-            // writing to mScheduleAfterWorkFailed.
-            //
-            // The simplest way to do this is to move the reference in helper->mStrongPtr to
-            // our stack, where it outlives all our accesses to "helper".
-            strongPtr.swap(helper->mStrongPtr);
-
-            // helper and any of its state should not be touched after storing mScheduleAfterWorkFailed.
-            helper->mScheduleAfterWorkFailed.store(true);
-        }
-    }
-
-    // Handler for the after work callback.
-    static void AfterWorkHandler(intptr_t arg)
-    {
-        // Ensure that this function is being called from main Matter thread
-        assertChipStackLockedByCurrentThread();
-
-        auto * helper = reinterpret_cast<WorkHelper *>(arg);
-        // Hold strong ptr while work is handled, and ensure that helper->mStrongPtr does not keep
-        // holding a reference.
-        auto strongPtr(std::move(helper->mStrongPtr));
-        if (!strongPtr)
-        {
-            // This can happen if scheduling AfterWorkHandler failed.  Just grab a strong ref
-            // to handler directly, to fulfill our API contract of holding a strong reference
-            // across the after-work callback.  At this point, we are guaranteed that the
-            // background thread is not touching the helper anymore.
-            strongPtr = helper->mWeakPtr.lock();
-        }
-        if (auto * session = helper->mSession.load())
-        {
-            // Execute callback in Matter thread; session should be OK with this
-            (session->*(helper->mAfterWorkCallback))(helper->mData, helper->mStatus);
-        }
-    }
-
-private:
-    // Lifetime management: `ScheduleWork` sets `mStrongPtr` from `mWeakPtr`.
-    Platform::WeakPtr<WorkHelper> mWeakPtr;
-
-    // Lifetime management: `ScheduleWork` sets `mStrongPtr` from `mWeakPtr`.
-    Platform::SharedPtr<WorkHelper> mStrongPtr;
-
-    // Associated session, cleared by `CancelWork`.
-    std::atomic<CASESession *> mSession;
-
-    // Work callback, called by `WorkHandler`.
-    WorkCallback mWorkCallback;
-
-    // After work callback, called by `AfterWorkHandler`.
-    AfterWorkCallback mAfterWorkCallback;
-
-    // Return value of `mWorkCallback`, passed to `mAfterWorkCallback`.
-    CHIP_ERROR mStatus;
-
-    // If background thread fails to schedule AfterWorkCallback then this flag is set to true
-    // and CASEServer then can check this one and run the AfterWorkCallback for us.
-    //
-    // When this happens, the write to this boolean _must_ be the last code that touches this
-    // object on the background thread.  After that, the Matter thread owns the object.
-    std::atomic<bool> mScheduleAfterWorkFailed{ false };
-
-public:
-    // Data passed to `mWorkCallback` and `mAfterWorkCallback`.
-    DATA mData;
-};
-
 CASESession::~CASESession()
 {
     // Let's clear out any security state stored in the object, before destroying it.
@@ -369,6 +171,11 @@ void CASESession::Clear()
 {
     MATTER_TRACE_SCOPE("Clear", "CASESession");
     // Cancel any outstanding work.
+    if (mHandleSigma2Helper)
+    {
+        mHandleSigma2Helper->CancelWork();
+        mHandleSigma2Helper.reset();
+    }
     if (mSendSigma3Helper)
     {
         mSendSigma3Helper->CancelWork();
@@ -489,6 +296,7 @@ CHIP_ERROR CASESession::EstablishSession(SessionManager & sessionManager, Fabric
                                          Optional<ReliableMessageProtocolConfig> mrpLocalConfig)
 {
     MATTER_TRACE_SCOPE("EstablishSession", "CASESession");
+    Platform::ScopedMemoryTag memoryTag(Platform::MemoryTag::kSecureChannel);
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     // Return early on error here, as we have not initialized any state yet
@@ -1436,27 +1244,18 @@ CHIP_ERROR CASESession::ParseSigma2Resume(ContiguousBufferTLVReader & tlvReader,
 CHIP_ERROR CASESession::HandleSigma2_and_SendSigma3(System::PacketBufferHandle && msg)
 {
     MATTER_TRACE_SCOPE("HandleSigma2_and_SendSigma3", "CASESession");
-    CHIP_ERROR err = HandleSigma2(std::move(msg));
-    MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma1, err);
-    SuccessOrExit(err);
-
-    MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma3);
-    err = SendSigma3a();
-    if (CHIP_NO_ERROR != err)
-    {
-        MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma3, err);
-    }
-
-exit:
-    if (CHIP_NO_ERROR != err)
+    // Sigma3 is sent by HandleSigma2c, once the responder's credentials and signature are validated in the background.
+    CHIP_ERROR err = HandleSigma2a(std::move(msg));
+    if (err != CHIP_NO_ERROR)
     {
+        MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma1, err);
         SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
         mState = State::kInitialized;
     }
     return err;
 }
 
-CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
+CHIP_ERROR CASESession::HandleSigma2a(System::PacketBufferHandle && msg)
 {
     MATTER_TRACE_SCOPE("HandleSigma2", "CASESession");
     ChipLogProgress(SecureChannel, "Received Sigma2 msg");
@@ -1467,12 +1266,15 @@ CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
     size_t buflen       = msg->DataLength();
     VerifyOrReturnError(buf != nullptr, CHIP_ERROR_MESSAGE_INCOMPLETE);
 
-    FabricId fabricId = kUndefinedFabricId;
+    auto helper = WorkHelper<HandleSigma2Data>::Create(*this, &HandleSigma2b, &CASESession::HandleSigma2c);
+    VerifyOrReturnError(helper, CHIP_ERROR_NO_MEMORY);
+    auto & data = helper->mData;
+
     {
         VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
         const auto * fabricInfo = mFabricsTable->FindFabricWithIndex(mFabricIndex);
         VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_INCORRECT_STATE);
-        fabricId = fabricInfo->GetFabricId();
+        data.fabricId = fabricInfo->GetFabricId();
     }
 
     System::PacketBufferTLVReader tlvReader;
@@ -1503,68 +1305,125 @@ CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
                                          nullptr, 0, parsedSigma2.msgR2MIC.data(), parsedSigma2.msgR2MIC.size(), sr2k.KeyHandle(),
                                          kTBEData2_Nonce, kTBEDataNonceLength, parsedSigma2.msgR2EncryptedPayload.data()));
 
-    parsedSigma2.msgR2Decrypted = std::move(parsedSigma2.msgR2Encrypted);
+    // The spans of parsedSigma2TBEData point into the decrypted buffer, which moves to the work data with them.
+    data.msgR2Decrypted         = std::move(parsedSigma2.msgR2Encrypted);
     size_t msgR2DecryptedLength = parsedSigma2.msgR2EncryptedPayload.size();
 
     ContiguousBufferTLVReader decryptedDataTlvReader;
-    decryptedDataTlvReader.Init(parsedSigma2.msgR2Decrypted.Get(), msgR2DecryptedLength);
+    decryptedDataTlvReader.Init(data.msgR2Decrypted.Get(), msgR2DecryptedLength);
     ParsedSigma2TBEData parsedSigma2TBEData;
     ReturnErrorOnFailure(ParseSigma2TBEData(decryptedDataTlvReader, parsedSigma2TBEData));
 
-    // Validate responder identity located in msgR2Decrypted
-    // Constructing responder identity
-    P256PublicKey responderPublicKey;
-    {
-        NodeId responderNodeId;
+    data.responderNOC      = parsedSigma2TBEData.responderNOC;
+    data.responderICAC     = parsedSigma2TBEData.responderICAC;
+    data.resumptionId      = parsedSigma2TBEData.resumptionId;
+    data.tbsData2Signature = parsedSigma2TBEData.tbsData2Signature;
 
-        CompressedFabricId unused;
-        FabricId responderFabricId;
-        ReturnErrorOnFailure(SetEffectiveTime());
-        ReturnErrorOnFailure(mFabricsTable->VerifyCredentials(mFabricIndex, parsedSigma2TBEData.responderNOC,
-                                                              parsedSigma2TBEData.responderICAC, mValidContext, unused,
-                                                              responderFabricId, responderNodeId, responderPublicKey));
-        VerifyOrReturnError(fabricId == responderFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
-        // Verify that responderNodeId (from responderNOC) matches one that was included
-        // in the computation of the Destination Identifier when generating Sigma1.
-        VerifyOrReturnError(mPeerNodeId == responderNodeId, CHIP_ERROR_INVALID_CASE_PARAMETER);
-    }
-
-    // Construct msgR2Signed and validate the signature in msgR2Decrypted.
-    size_t msgR2SignedLen = EstimateStructOverhead(parsedSigma2TBEData.responderNOC.size(),  // resonderNOC
-                                                   parsedSigma2TBEData.responderICAC.size(), // responderICAC
-                                                   kP256_PublicKey_Length,                   // responderEphPubKey
-                                                   kP256_PublicKey_Length                    // initiatorEphPubKey
+    // Construct msgR2Signed, whose signature is validated in the background along with the responder identity.
+    size_t msgR2SignedLen = EstimateStructOverhead(data.responderNOC.size(),  // resonderNOC
+                                                   data.responderICAC.size(), // responderICAC
+                                                   kP256_PublicKey_Length,    // responderEphPubKey
+                                                   kP256_PublicKey_Length     // initiatorEphPubKey
     );
 
-    chip::Platform::ScopedMemoryBuffer<uint8_t> msgR2Signed;
-    VerifyOrReturnError(msgR2Signed.Alloc(msgR2SignedLen), CHIP_ERROR_NO_MEMORY);
-    MutableByteSpan msgR2SignedSpan{ msgR2Signed.Get(), msgR2SignedLen };
+    VerifyOrReturnError(data.msgR2Signed.Alloc(msgR2SignedLen), CHIP_ERROR_NO_MEMORY);
+    data.msgR2SignedSpan = MutableByteSpan{ data.msgR2Signed.Get(), msgR2SignedLen };
+
+    ReturnErrorOnFailure(ConstructTBSData(data.responderNOC, data.responderICAC, ByteSpan(mRemotePubKey, mRemotePubKey.Length()),
+                                          ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()),
+                                          data.msgR2SignedSpan));
+
+    {
+        MutableByteSpan fabricRCAC{ data.rootCertBuf };
+        ReturnErrorOnFailure(mFabricsTable->FetchRootCert(mFabricIndex, fabricRCAC));
+        data.fabricRCAC = fabricRCAC;
+        ReturnErrorOnFailure(SetEffectiveTime());
+        data.validContext = mValidContext;
+    }
+
+    data.peerNodeId                         = mPeerNodeId;
+    data.responderSessionId                 = parsedSigma2.responderSessionId;
+    data.responderSessionParams             = parsedSigma2.responderSessionParams;
+    data.responderSessionParamStructPresent = parsedSigma2.responderSessionParamStructPresent;
 
-    ReturnErrorOnFailure(ConstructTBSData(parsedSigma2TBEData.responderNOC, parsedSigma2TBEData.responderICAC,
-                                          ByteSpan(mRemotePubKey, mRemotePubKey.Length()),
-                                          ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()), msgR2SignedSpan));
+    ReturnErrorOnFailure(helper->ScheduleWork());
+    mHandleSigma2Helper = helper;
+    mExchangeCtxt.Value()->WillSendMessage();
+    mState = State::kHandleSigma2Pending;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::HandleSigma2b(HandleSigma2Data & data, bool & cancel)
+{
+    // Validate responder identity located in msgR2Decrypted
+    CompressedFabricId unused;
+    FabricId responderFabricId;
+    NodeId responderNodeId;
+    P256PublicKey responderPublicKey;
+    ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.responderNOC, data.responderICAC, data.fabricRCAC, data.validContext,
+                                                        unused, responderFabricId, responderNodeId, responderPublicKey));
+    VerifyOrReturnError(data.fabricId == responderFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
+    // Verify that responderNodeId (from responderNOC) matches one that was included
+    // in the computation of the Destination Identifier when generating Sigma1.
+    VerifyOrReturnError(data.peerNodeId == responderNodeId, CHIP_ERROR_INVALID_CASE_PARAMETER);
 
     // Validate signature
-    ReturnErrorOnFailure(responderPublicKey.ECDSA_validate_msg_signature(msgR2SignedSpan.data(), msgR2SignedSpan.size(),
-                                                                         parsedSigma2TBEData.tbsData2Signature));
+    ReturnErrorOnFailure(responderPublicKey.ECDSA_validate_msg_signature(data.msgR2SignedSpan.data(), data.msgR2SignedSpan.size(),
+                                                                         data.tbsData2Signature));
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::HandleSigma2c(HandleSigma2Data & data, CHIP_ERROR status)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    VerifyOrExit(mState == State::kHandleSigma2Pending, err = CHIP_ERROR_INCORRECT_STATE);
+
+    SuccessOrExit(err = status);
 
     ChipLogDetail(SecureChannel, "Peer " ChipLogFormatScopedNodeId " assigned session ID %d", ChipLogValueScopedNodeId(GetPeer()),
-                  parsedSigma2.responderSessionId);
-    SetPeerSessionId(parsedSigma2.responderSessionId);
+                  data.responderSessionId);
+    SetPeerSessionId(data.responderSessionId);
 
-    std::copy(parsedSigma2TBEData.resumptionId.begin(), parsedSigma2TBEData.resumptionId.end(), mNewResumptionId.begin());
+    std::copy(data.resumptionId.begin(), data.resumptionId.end(), mNewResumptionId.begin());
 
     // Retrieve peer CASE Authenticated Tags (CATs) from peer's NOC.
-    ReturnErrorOnFailure(ExtractCATsFromOpCert(parsedSigma2TBEData.responderNOC, mPeerCATs));
+    SuccessOrExit(err = ExtractCATsFromOpCert(data.responderNOC, mPeerCATs));
 
-    if (parsedSigma2.responderSessionParamStructPresent)
+    if (data.responderSessionParamStructPresent)
     {
-        SetRemoteSessionParameters(parsedSigma2.responderSessionParams);
+        SetRemoteSessionParameters(data.responderSessionParams);
         mExchangeCtxt.Value()->GetSessionHandle()->AsUnauthenticatedSession()->SetRemoteSessionParameters(
             GetRemoteSessionParameters());
     }
 
-    return CHIP_NO_ERROR;
+exit:
+    mHandleSigma2Helper.reset();
+
+    MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma1, err);
+
+    if (err == CHIP_NO_ERROR)
+    {
+        MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma3);
+        err = SendSigma3a();
+        if (err != CHIP_NO_ERROR)
+        {
+            MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma3, err);
+        }
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+        // Abort the pending establish, which is normally done by CASESession::OnMessageReceived,
+        // but in the background processing case must be done here.
+        DiscardExchange();
+        AbortPendingEstablish(err);
+    }
+
+    return err;
 }
 
 CHIP_ERROR CASESession::ParseSigma2(ContiguousBufferTLVReader & tlvReader, ParsedSigma2 & outParsedSigma2)
@@ -2467,6 +2326,7 @@ CHIP_ERROR CASESession::OnMessageReceived(ExchangeContext * ec, const PayloadHea
                                           System::PacketBufferHandle && msg)
 {
     MATTER_TRACE_SCOPE("OnMessageReceived", "CASESession");
+    Platform::ScopedMemoryTag memoryTag(Platform::MemoryTag::kSecureChannel);
     CHIP_ERROR err                            = ValidateReceivedMessage(ec, payloadHeader, msg);
     Protocols::SecureChannel::MsgType msgType = static_cast<Protocols::SecureChannel::MsgType>(payloadHeader.GetMessageType());
     SuccessOrExit(err);
@@ -2644,6 +2504,13 @@ bool CASESession::InvokeBackgroundWorkWatchdog()
 {
     bool watchdogFired = false;
 
+    if (mHandleSigma2Helper && mHandleSigma2Helper->UnableToScheduleAfterWorkCallback())
+    {
+        ChipLogError(SecureChannel, "HandleSigma2Helper was unable to schedule the AfterWorkCallback");
+        mHandleSigma2Helper->DoAfterWork();
+        watchdogFired = true;
+    }
+
     if (mSendSigma3Helper && mSendSigma3Helper->UnableToScheduleAfterWorkCallback())
     {
         ChipLogError(SecureChannel, "SendSigma3Helper was unable to schedule the AfterWorkCallback");
@@ -2674,6 +2541,7 @@ SessionEstablishmentStage CASESession::MapCASEStateToSessionEstablishmentStage(S
     case State::kSentSigma2:
     case State::kSentSigma2Resume:
         return SessionEstablishmentStage::kSentSigma2;
+    case State::kHandleSigma2Pending:
     case State::kSendSigma3Pending:
         return SessionEstablishmentStage::kReceivedSigma2;
     case State::kSentSigma3:
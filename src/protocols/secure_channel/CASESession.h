@@ -42,6 +42,7 @@
 #include <protocols/secure_channel/PairingSession.h>
 #include <protocols/secure_channel/SessionEstablishmentExchangeDispatch.h>
 #include <protocols/secure_channel/SessionResumptionStorage.h>
+#include <protocols/secure_channel/SessionWorkHelper.h>
 #include <system/SystemClock.h>
 #include <system/SystemPacketBuffer.h>
 #include <system/TLVPacketBufferBackingStore.h>
@@ -182,6 +183,7 @@ public:
         kFinishedViaResume   = 7,
         kSendSigma3Pending   = 8,
         kHandleSigma3Pending = 9,
+        kHandleSigma2Pending = 10,
     };
 
     State GetState() { return mState; }
@@ -290,6 +292,33 @@ protected:
         bool responderSessionParamStructPresent = false;
     };
 
+    struct HandleSigma2Data
+    {
+        // Decrypted TBEData2, which backs responderNOC, responderICAC and resumptionId.
+        Platform::ScopedMemoryBufferWithSize<uint8_t> msgR2Decrypted;
+        ByteSpan responderNOC;
+        ByteSpan responderICAC;
+        ByteSpan resumptionId;
+
+        chip::Platform::ScopedMemoryBuffer<uint8_t> msgR2Signed;
+        MutableByteSpan msgR2SignedSpan;
+
+        uint8_t rootCertBuf[Credentials::kMaxCHIPCertLength];
+        ByteSpan fabricRCAC;
+
+        Crypto::P256ECDSASignature tbsData2Signature;
+
+        FabricId fabricId;
+        // Node ID included in the Destination Identifier of Sigma1, which the responder NOC must match.
+        NodeId peerNodeId;
+
+        SessionParameters responderSessionParams;
+        uint16_t responderSessionId;
+        bool responderSessionParamStructPresent = false;
+
+        Credentials::ValidationContext validContext;
+    };
+
     struct SendSigma3Data
     {
         FabricIndex fabricIndex;
@@ -464,6 +493,8 @@ protected:
 
     static CHIP_ERROR HandleSigma3b(HandleSigma3Data & data, bool & cancel);
 
+    static CHIP_ERROR HandleSigma2b(HandleSigma2Data & data, bool & cancel);
+
 private:
     friend class TestCASESession;
 
@@ -499,7 +530,8 @@ private:
     CHIP_ERROR SendSigma2Resume(System::PacketBufferHandle && msg_R2_resume);
 
     CHIP_ERROR HandleSigma2_and_SendSigma3(System::PacketBufferHandle && msg);
-    CHIP_ERROR HandleSigma2(System::PacketBufferHandle && msg);
+    CHIP_ERROR HandleSigma2a(System::PacketBufferHandle && msg);
+    CHIP_ERROR HandleSigma2c(HandleSigma2Data & data, CHIP_ERROR status);
     CHIP_ERROR HandleSigma2Resume(System::PacketBufferHandle && msg);
 
     CHIP_ERROR SendSigma3a();
@@ -584,7 +616,8 @@ private:
     uint8_t mInitiatorRandom[kSigmaParamRandomNumberSize];
 
     template <class DATA>
-    class WorkHelper;
+    using WorkHelper = SessionWorkHelper<CASESession, DATA>;
+    Platform::SharedPtr<WorkHelper<HandleSigma2Data>> mHandleSigma2Helper;
     Platform::SharedPtr<WorkHelper<SendSigma3Data>> mSendSigma3Helper;
     Platform::SharedPtr<WorkHelper<HandleSigma3Data>> mHandleSigma3Helper;
 
@@ -102,10 +102,12 @@ public:
     static constexpr uint16_t kMinPayloadSize =
         Crypto::CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES + sizeof(CounterType) + Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES;
 
-private:
     /**
      * @brief Generate the Nonce for the Check-In message
      *
+     * The nonce only depends on the key and the counter, receivers can use it to find the sender of a message before trying to
+     * decrypt it.
+     *
      * @param[in]   hmacKeyHandle Key handle to use with the HMAC algorithm
      * @param[in]   counter       Check-In Counter value to use as message of the HMAC algorithm
      * @param[out]  output        output buffer for the generated Nonce.
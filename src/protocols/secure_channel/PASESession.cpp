@@ -115,6 +115,9 @@ const char kSpake2pContext[] = "CHIP PAKE V1 Commissioning";
 static constexpr ExchangeContext::Timeout kExpectedLowProcessingTime  = System::Clock::Seconds16(2);
 static constexpr ExchangeContext::Timeout kExpectedHighProcessingTime = System::Clock::Seconds16(30);
 
+// Interval at which the initiator checks that the background ComputeWS work could schedule HandleComputeWS.
+static constexpr System::Clock::Timeout kBackgroundWorkWatchdogInterval = System::Clock::Seconds16(1);
+
 PASESession::~PASESession()
 {
     // Let's clear out any security state stored in the object, before destroying it.
@@ -145,6 +148,13 @@ void PASESession::Clear()
     mSpake2p.Clear();
     mCommissioningHash.Clear();
 
+    if (mComputeWSHelper)
+    {
+        CancelBackgroundWorkWatchdogTimer();
+        mComputeWSHelper->CancelWork();
+        mComputeWSHelper.reset();
+    }
+
     mIterationCount = 0;
     mSaltLength     = 0;
     if (mSalt != nullptr)
@@ -533,7 +543,6 @@ CHIP_ERROR PASESession::HandlePBKDFParamResponse(System::PacketBufferHandle && m
     uint8_t random[kPBKDFParamRandomNumberSize];
 
     ByteSpan salt;
-    uint8_t serializedWS[kSpake2p_WS_Length * 2] = { 0 };
 
     ChipLogDetail(SecureChannel, "Received PBKDF param response");
 
@@ -602,24 +611,110 @@ CHIP_ERROR PASESession::HandlePBKDFParamResponse(System::PacketBufferHandle && m
     err = SetupSpake2p();
     SuccessOrExit(err);
 
-    err = Spake2pVerifier::ComputeWS(mIterationCount, salt, mSetupPINCode, serializedWS, sizeof(serializedWS));
-    SuccessOrExit(err);
+    if (DeviceLayer::PlatformMgr().IsBackgroundEventLoopRunning())
+    {
+        // PBKDF2 dominates the initiator's cost at high iteration counts, so derive w0 and w1 on a
+        // background worker and send Pake1 from HandleComputeWS.
+        auto helper = WorkHelper<ComputeWSData>::Create(*this, &ComputeWS, &PASESession::HandleComputeWS);
+        VerifyOrExit(helper, err = CHIP_ERROR_NO_MEMORY);
+        SuccessOrExit(err = helper->mData.Init(mSetupPINCode, mIterationCount, salt));
+        SuccessOrExit(err = helper->ScheduleWork());
+        mComputeWSHelper = helper;
+        SuccessOrExit(err = StartBackgroundWorkWatchdogTimer());
+        // Nothing is expected from the peer until Pake1 has been sent.
+        mNextExpectedMsg.ClearValue();
+        mExchangeCtxt.Value()->WillSendMessage();
+    }
+    else
+    {
+        ComputeWSData data;
+        bool unused = false;
+        SuccessOrExit(err = data.Init(mSetupPINCode, mIterationCount, salt));
+        SuccessOrExit(err = ComputeWS(data, unused));
+        SuccessOrExit(err = BeginProverAndSendMsg1(data));
+    }
 
-    err = mSpake2p.BeginProver(nullptr, 0, nullptr, 0, &serializedWS[0], kSpake2p_WS_Length, &serializedWS[kSpake2p_WS_Length],
-                               kSpake2p_WS_Length);
-    SuccessOrExit(err);
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+    }
+    return err;
+}
 
-    err = SendMsg1();
-    SuccessOrExit(err);
+CHIP_ERROR PASESession::ComputeWS(ComputeWSData & data, bool & cancel)
+{
+    return Spake2pVerifier::ComputeWS(data.iterationCount, ByteSpan(data.salt, data.saltLength), data.setupPINCode,
+                                      data.serializedWS, sizeof(data.serializedWS));
+}
+
+CHIP_ERROR PASESession::HandleComputeWS(ComputeWSData & data, CHIP_ERROR status)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    CancelBackgroundWorkWatchdogTimer();
+    mComputeWSHelper.reset();
+
+    VerifyOrExit(mExchangeCtxt.HasValue(), err = CHIP_ERROR_INCORRECT_STATE);
+    SuccessOrExit(err = status);
+    SuccessOrExit(err = BeginProverAndSendMsg1(data));
 
 exit:
     if (err != CHIP_NO_ERROR)
     {
         SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+        // This is normally done by OnMessageReceived, but in the background processing case must be done here.
+        DiscardExchange();
+        Clear();
+        ChipLogError(SecureChannel, "Failed during PASE session setup: %" CHIP_ERROR_FORMAT, err.Format());
+        MATTER_TRACE_COUNTER("PASEFail");
+        // Do this last in case the delegate frees us.
+        NotifySessionEstablishmentError(err);
     }
     return err;
 }
 
+bool PASESession::InvokeBackgroundWorkWatchdog()
+{
+    VerifyOrReturnValue(mComputeWSHelper && mComputeWSHelper->UnableToScheduleAfterWorkCallback(), false);
+
+    ChipLogError(SecureChannel, "ComputeWSHelper was unable to schedule the AfterWorkCallback");
+    mComputeWSHelper->DoAfterWork();
+    return true;
+}
+
+void PASESession::HandleBackgroundWorkWatchdogTimer(System::Layer * layer, void * context)
+{
+    auto * session = static_cast<PASESession *>(context);
+    VerifyOrReturn(!session->InvokeBackgroundWorkWatchdog());
+
+    // ComputeWS is still running, or HandleComputeWS is scheduled: check again later.
+    CHIP_ERROR err = session->StartBackgroundWorkWatchdogTimer();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Failed to restart the PASE background work watchdog: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+CHIP_ERROR PASESession::StartBackgroundWorkWatchdogTimer()
+{
+    VerifyOrReturnError(mSessionManager != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    return mSessionManager->SystemLayer()->StartTimer(kBackgroundWorkWatchdogInterval, HandleBackgroundWorkWatchdogTimer, this);
+}
+
+void PASESession::CancelBackgroundWorkWatchdogTimer()
+{
+    VerifyOrReturn(mSessionManager != nullptr);
+    mSessionManager->SystemLayer()->CancelTimer(HandleBackgroundWorkWatchdogTimer, this);
+}
+
+CHIP_ERROR PASESession::BeginProverAndSendMsg1(ComputeWSData & data)
+{
+    ReturnErrorOnFailure(mSpake2p.BeginProver(nullptr, 0, nullptr, 0, &data.serializedWS[0], kSpake2p_WS_Length,
+                                              &data.serializedWS[kSpake2p_WS_Length], kSpake2p_WS_Length));
+    return SendMsg1();
+}
+
 CHIP_ERROR PASESession::SendMsg1()
 {
     MATTER_TRACE_SCOPE("SendMsg1", "PASESession");
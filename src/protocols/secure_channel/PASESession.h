@@ -37,6 +37,7 @@
 #include <protocols/secure_channel/Constants.h>
 #include <protocols/secure_channel/PairingSession.h>
 #include <protocols/secure_channel/SessionEstablishmentExchangeDispatch.h>
+#include <protocols/secure_channel/SessionWorkHelper.h>
 #include <system/SystemPacketBuffer.h>
 #include <system/TLVPacketBufferBackingStore.h>
 #include <transport/CryptoContext.h>
@@ -140,6 +141,10 @@ public:
      **/
     void Clear();
 
+    // Returns true if the PASE session handshake was stuck due to failing to schedule work on the Matter thread.
+    // If this function returns true, the stuck step has been completed, sending Pake1 or failing the handshake.
+    bool InvokeBackgroundWorkWatchdog();
+
     //// ExchangeDelegate Implementation ////
     /**
      * @brief
@@ -192,6 +197,37 @@ private:
     CHIP_ERROR SendPBKDFParamResponse(ByteSpan initiatorRandom, bool initiatorHasPBKDFParams);
     CHIP_ERROR HandlePBKDFParamResponse(System::PacketBufferHandle && msg);
 
+    // Data for the PBKDF2 derivation of w0 and w1 (see ComputeWS), which may run on a background thread.
+    struct ComputeWSData
+    {
+        ~ComputeWSData() { Crypto::ClearSecretData(serializedWS); }
+
+        CHIP_ERROR Init(uint32_t pinCode, uint32_t iterations, const ByteSpan & saltSpan)
+        {
+            VerifyOrReturnError(saltSpan.size() <= sizeof(salt), CHIP_ERROR_INVALID_ARGUMENT);
+            setupPINCode   = pinCode;
+            iterationCount = iterations;
+            saltLength     = saltSpan.size();
+            memcpy(salt, saltSpan.data(), saltLength);
+            return CHIP_NO_ERROR;
+        }
+
+        uint32_t setupPINCode;
+        uint32_t iterationCount;
+        uint8_t salt[Crypto::kSpake2p_Max_PBKDF_Salt_Length];
+        size_t saltLength;
+        uint8_t serializedWS[Crypto::kSpake2p_WS_Length * 2];
+    };
+
+    static CHIP_ERROR ComputeWS(ComputeWSData & data, bool & cancel);
+    CHIP_ERROR HandleComputeWS(ComputeWSData & data, CHIP_ERROR status);
+    CHIP_ERROR BeginProverAndSendMsg1(ComputeWSData & data);
+
+    // Nothing is received while ComputeWS runs in the background, so this timer runs the watchdog instead.
+    static void HandleBackgroundWorkWatchdogTimer(System::Layer * layer, void * context);
+    CHIP_ERROR StartBackgroundWorkWatchdogTimer();
+    void CancelBackgroundWorkWatchdogTimer();
+
     CHIP_ERROR SendMsg1();
 
     CHIP_ERROR HandleMsg1_and_SendMsg2(System::PacketBufferHandle && msg);
@@ -234,6 +270,10 @@ private:
     uint16_t mSaltLength     = 0;
     uint8_t * mSalt          = nullptr;
 
+    template <class DATA>
+    using WorkHelper = SessionWorkHelper<PASESession, DATA>;
+    Platform::SharedPtr<WorkHelper<ComputeWSData>> mComputeWSHelper;
+
     struct Spake2pErrorMsg
     {
         Spake2pErrorType error;
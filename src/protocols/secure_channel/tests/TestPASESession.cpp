@@ -33,6 +33,7 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/UnitTestUtils.h>
 #include <messaging/tests/MessagingContext.h>
+#include <platform/CHIPDeviceLayer.h>
 #include <protocols/secure_channel/PASESession.h>
 #include <stdarg.h>
 
@@ -478,6 +479,85 @@ TEST_F(TestPASESession, SecurePairingFailedHandshake)
     EXPECT_EQ(delegateCommissioner.mNumPairingErrors, 1u);
 }
 
+TEST_F(TestPASESession, SecurePairingHandshakeInBackgroundTest)
+{
+    // With the background event loop running, the commissioner derives w0 and w1 on a background worker, and sends
+    // Pake1 once HandleComputeWS runs on the Matter thread.
+    ASSERT_EQ(DeviceLayer::PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+    DeviceLayer::SetSystemLayerForTesting(&GetSystemLayer());
+    if (DeviceLayer::PlatformMgr().StartBackgroundEventLoopTask() != CHIP_NO_ERROR ||
+        !DeviceLayer::PlatformMgr().IsBackgroundEventLoopRunning())
+    {
+        DeviceLayer::PlatformMgr().StopBackgroundEventLoopTask();
+        DeviceLayer::SetSystemLayerForTesting(nullptr);
+        DeviceLayer::PlatformMgr().Shutdown();
+        GTEST_SKIP() << "No background event loop on this platform";
+    }
+
+    {
+        TemporarySessionManager sessionManager(*this);
+
+        TestSecurePairingDelegate delegateCommissioner;
+        TestSecurePairingDelegate delegateAccessory;
+        PASESession pairingCommissioner;
+        PASESession pairingAccessory;
+
+        auto & loopback = GetLoopback();
+        loopback.Reset();
+        loopback.mSentMessageCount = 0;
+
+        ExchangeContext * contextCommissioner = NewUnauthenticatedExchangeToBob(&pairingCommissioner);
+
+        EXPECT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(
+                      Protocols::SecureChannel::MsgType::PBKDFParamRequest, &pairingAccessory),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(pairingAccessory.WaitForPairing(sessionManager, sTestSpake2p01_PASEVerifier, sTestSpake2p01_IterationCount,
+                                                  ByteSpan(sTestSpake2p01_Salt),
+                                                  Optional<ReliableMessageProtocolConfig>::Missing(), &delegateAccessory),
+                  CHIP_NO_ERROR);
+        DrainAndServiceIO();
+
+        EXPECT_EQ(pairingCommissioner.Pair(sessionManager, sTestSpake2p01_PinCode,
+                                           Optional<ReliableMessageProtocolConfig>::Missing(), contextCommissioner,
+                                           &delegateCommissioner),
+                  CHIP_NO_ERROR);
+        DrainAndServiceIO();
+
+        // The handshake stops at the PBKDFParamResponse until HandleComputeWS is run.  The watchdog leaves it alone
+        // since nothing failed to be scheduled.
+        EXPECT_EQ(delegateCommissioner.mNumPairingComplete, 0u);
+        EXPECT_FALSE(pairingCommissioner.InvokeBackgroundWorkWatchdog());
+
+        for (int i = 0; i < 100 && delegateCommissioner.mNumPairingComplete + delegateCommissioner.mNumPairingErrors == 0; ++i)
+        {
+            chip::test_utils::SleepMillis(10);
+            DeviceLayer::PlatformMgr().ScheduleWork([](intptr_t) { DeviceLayer::PlatformMgr().StopEventLoopTask(); });
+            DeviceLayer::PlatformMgr().RunEventLoop();
+            DrainAndServiceIO();
+        }
+
+        EXPECT_GE(loopback.mSentMessageCount, sTestPaseMessageCount);
+        EXPECT_EQ(delegateAccessory.mNumPairingErrors, 0u);
+        EXPECT_EQ(delegateAccessory.mNumPairingComplete, 1u);
+        EXPECT_EQ(delegateCommissioner.mNumPairingErrors, 0u);
+        EXPECT_EQ(delegateCommissioner.mNumPairingComplete, 1u);
+        EXPECT_FALSE(pairingCommissioner.InvokeBackgroundWorkWatchdog());
+
+        // Evict the PASE sessions before the PASESession objects go away, as in SecurePairingHandshakeTestCommon.
+        auto session = pairingCommissioner.CopySecureSession();
+        ASSERT_TRUE(session.HasValue());
+        session.Value()->AsSecureSession()->MarkForEviction();
+        session = pairingAccessory.CopySecureSession();
+        ASSERT_TRUE(session.HasValue());
+        session.Value()->AsSecureSession()->MarkForEviction();
+        DrainAndServiceIO();
+    }
+
+    EXPECT_EQ(DeviceLayer::PlatformMgr().StopBackgroundEventLoopTask(), CHIP_NO_ERROR);
+    DeviceLayer::SetSystemLayerForTesting(nullptr);
+    DeviceLayer::PlatformMgr().Shutdown();
+}
+
 TEST_F(TestPASESession, PASEVerifierSerializeTest)
 {
     Spake2pVerifier verifier;
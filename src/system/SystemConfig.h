@@ -381,6 +381,47 @@
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 15
 #endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_ALLOCATOR
+ *
+ *  @brief
+ *      When packet buffers are allocated using malloc (CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE is 0), this selects whether
+ *      freed buffers are kept in free lists of a few size classes and reused by the next allocations (1), or returned to
+ *      the heap right away (0).
+ *
+ *      This avoids heap contention and fragmentation on devices allocating many buffers from several threads, e.g. controllers
+ *      receiving reports and mDNS traffic.  The cached buffers are bounded by
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE and CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SHARED_CACHE_SIZE.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_ALLOCATOR
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_ALLOCATOR 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_ALLOCATOR */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE
+ *
+ *  @brief
+ *      The number of free packet buffers of each size class that each thread keeps for its own allocations, without locking,
+ *      when CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_ALLOCATOR is enabled.
+ *
+ *      This may be set to zero (0) on platforms without thread-local storage; all the free buffers are then shared, and each
+ *      allocation takes a lock.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE 16
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SHARED_CACHE_SIZE
+ *
+ *  @brief
+ *      The number of free packet buffers of each size class shared by all the threads when
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_ALLOCATOR is enabled.  Buffers freed beyond it are returned to the heap.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SHARED_CACHE_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SHARED_CACHE_SIZE 32
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SHARED_CACHE_SIZE */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_LWIP_PBUF_RAM
  *
@@ -677,10 +718,12 @@ struct LwIPEvent;
  *
  *  Use the POSIX pipe() function to create an anonymous data stream.
  *
- *  Defaults to enabled if the system is using sockets (except for Zephyr RTOS).
+ *  Defaults to enabled if the system is using sockets (except for Zephyr RTOS and Linux). Linux uses
+ *  an eventfd instead, which takes a single descriptor and folds repeated wakeups into one counter.
  */
 #ifndef CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE
-#if (CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK) && !defined(__ZEPHYR__) && !defined(__MBED__)
+#if (CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK) && !defined(__ZEPHYR__) && !defined(__MBED__) &&     \
+    !defined(__linux__)
 #define CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE 1
 #else
 #define CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE 0
@@ -27,6 +27,7 @@
 #include <system/SystemFaultInjection.h>
 #include <system/SystemLayer.h>
 #include <system/SystemLayerImplFreeRTOS.h>
+#include <system/SystemPacketBufferSlab.h>
 
 namespace chip {
 namespace System {
@@ -47,6 +48,11 @@ CHIP_ERROR LayerImplFreeRTOS::Init()
 
 void LayerImplFreeRTOS::Shutdown()
 {
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+    // Return the free packet buffer blocks to the heap, which is usually shut down after the system layer
+    PacketBufferSlab::ReleaseCachedBlocks();
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+
     mLayerState.ResetFromInitialized();
 }
 
@@ -27,6 +27,7 @@
 #include <system/SystemFaultInjection.h>
 #include <system/SystemLayer.h>
 #include <system/SystemLayerImplSelect.h>
+#include <system/SystemPacketBufferSlab.h>
 
 #include <algorithm>
 #include <errno.h>
@@ -104,6 +105,11 @@ void LayerImplSelect::Shutdown()
     mWakeEvent.Close(*this);
 #endif // !CHIP_SYSTEM_CONFIG_USE_LIBEV
 
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+    // Return the free packet buffer blocks to the heap, which is usually shut down after the system layer
+    PacketBufferSlab::ReleaseCachedBlocks();
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+
     mLayerState.ResetFromShuttingDown(); // Return to uninitialized state to permit re-initialization.
 }
 
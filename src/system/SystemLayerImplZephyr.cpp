@@ -26,6 +26,7 @@
 #include <system/SystemFaultInjection.h>
 #include <system/SystemLayer.h>
 #include <system/SystemLayerImplZephyr.h>
+#include <system/SystemPacketBufferSlab.h>
 
 namespace chip {
 namespace System {
@@ -42,6 +43,11 @@ CHIP_ERROR LayerImplZephyr::Init()
 
 void LayerImplZephyr::Shutdown()
 {
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+    // Return the free packet buffer blocks to the heap, which is usually shut down after the system layer
+    PacketBufferSlab::ReleaseCachedBlocks();
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+
     mLayerState.ResetFromInitialized();
 }
 
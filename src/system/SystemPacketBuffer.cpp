@@ -58,6 +58,10 @@
 #include <lib/support/CHIPMem.h>
 #endif
 
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+#include <system/SystemPacketBufferSlab.h>
+#endif
+
 namespace chip {
 namespace System {
 
@@ -109,6 +113,30 @@ PacketBuffer * PacketBuffer::BuildFreeList()
 // Heap allocation for PacketBuffer objects.
 //
 
+namespace {
+
+void * AllocateBlock(size_t blockSize)
+{
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+    return PacketBufferSlab::Allocate(blockSize);
+#else
+    return chip::Platform::MemoryAlloc(blockSize);
+#endif
+}
+
+} // namespace
+
+void PacketBuffer::FreeBlock(PacketBuffer * aPacket, size_t aBlockSize)
+{
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+    // The size class of the block follows from the allocation size recorded by New() and RightSize().
+    PacketBufferSlab::Free(aPacket, aBlockSize);
+#else
+    IgnoreUnusedVariable(aBlockSize);
+    chip::Platform::MemoryFree(aPacket);
+#endif
+}
+
 #if CHIP_SYSTEM_PACKETBUFFER_HAS_CHECK
 void PacketBuffer::InternalCheck(const PacketBuffer * buffer)
 {
@@ -143,8 +171,16 @@ void PacketBufferHandle::InternalRightSize()
         return;
     }
 
-    const size_t blockSize   = usedSize + PacketBuffer::kStructureSize;
-    PacketBuffer * newBuffer = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(blockSize));
+    const size_t blockSize = usedSize + PacketBuffer::kStructureSize;
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+    // Copying only saves memory if the data fits in a smaller size class.
+    if (PacketBufferSlab::RoundedBlockSize(blockSize) >=
+        PacketBufferSlab::RoundedBlockSize(mBuffer->alloc_size + PacketBuffer::kStructureSize))
+    {
+        return;
+    }
+#endif
+    PacketBuffer * newBuffer = reinterpret_cast<PacketBuffer *>(AllocateBlock(blockSize));
     if (newBuffer == nullptr)
     {
         ChipLogError(chipSystemLayer, "PacketBuffer: pool EMPTY.");
@@ -619,7 +655,7 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
     // sumOfSizes is essentially (kStructureSize + lAllocSize) which we already
     // checked to fit in a size_t.
     const size_t lBlockSize = static_cast<size_t>(sumOfSizes);
-    lPacket                 = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(lBlockSize));
+    lPacket                 = reinterpret_cast<PacketBuffer *>(AllocateBlock(lBlockSize));
 
 #else
 #error "Unimplemented PacketBuffer storage case"
@@ -699,14 +735,15 @@ void PacketBuffer::Free(PacketBuffer * aPacket)
         {
             SYSTEM_STATS_DECREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
-            ::chip::Platform::MemoryDebugCheckPointer(aPacket, aPacket->alloc_size + kStructureSize);
+            const size_t lBlockSize = aPacket->alloc_size + kStructureSize;
+            ::chip::Platform::MemoryDebugCheckPointer(aPacket, lBlockSize);
 #endif
             aPacket->Clear();
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
             aPacket->next = sFreeList;
             sFreeList     = aPacket;
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
-            chip::Platform::MemoryFree(aPacket);
+            FreeBlock(aPacket, lBlockSize);
 #endif
             aPacket       = lNextPacket;
         }
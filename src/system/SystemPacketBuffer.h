@@ -391,6 +391,10 @@ private:
     static void InternalCheck(const PacketBuffer * buffer);
 #endif
 
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+    static void FreeBlock(PacketBuffer * aPacket, size_t aBlockSize);
+#endif
+
     void AddRef();
     bool HasSoleOwnership() const { return (this->ref == 1); }
     static void Free(PacketBuffer * aPacket);
@@ -411,6 +415,7 @@ private:
 
     friend class PacketBufferHandle;
     friend class TestSystemPacketBuffer;
+    friend class PacketBufferSlab;
 };
 
 static_assert(sizeof(pbuf) == sizeof(PacketBuffer), "PacketBuffer must not have additional members");
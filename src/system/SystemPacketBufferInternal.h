@@ -38,6 +38,17 @@
 #define CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP 0
 #endif
 
+/**
+ * CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+ *
+ * True if packet buffers allocated using Platform::MemoryAlloc are recycled through size-class free lists.
+ */
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP && CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_ALLOCATOR
+#define CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB 1
+#else
+#define CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB 0
+#endif
+
 /**
  * CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
  *
@@ -0,0 +1,287 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <system/SystemPacketBufferSlab.h>
+
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+
+#include <lib/support/CHIPMem.h>
+#include <system/SystemMutex.h>
+#include <system/SystemPacketBuffer.h>
+#include <system/SystemStats.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace System {
+
+// The classes are meant for acknowledgements and small messages, typical reports, and full-size packets.  A smaller
+// CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX just makes the first classes redundant.
+const size_t PacketBufferSlab::kClassBlockSizes[kSizeClassCount] = {
+    std::min<size_t>(256, PacketBuffer::kBlockSize),
+    std::min<size_t>(768, PacketBuffer::kBlockSize),
+    PacketBuffer::kBlockSize,
+};
+
+namespace {
+
+struct FreeBlock
+{
+    FreeBlock * next;
+};
+
+constexpr size_t kNoSizeClass = PacketBufferSlab::kSizeClassCount;
+
+class SharedLists
+{
+public:
+    SharedLists() { Mutex::Init(mMutex); }
+
+    // Moves up to `maxCount` blocks of the class to `head`, returns the number moved.
+    size_t Take(size_t sizeClass, FreeBlock *& head, size_t maxCount)
+    {
+        mMutex.Lock();
+        size_t count = 0;
+        while (count < maxCount && mHeads[sizeClass] != nullptr)
+        {
+            FreeBlock * block  = mHeads[sizeClass];
+            mHeads[sizeClass]  = block->next;
+            block->next        = head;
+            head               = block;
+            mCounts[sizeClass] = mCounts[sizeClass] - 1;
+            count++;
+        }
+        mMutex.Unlock();
+        return count;
+    }
+
+    // Adds the blocks of the list to the class.  Unless `unbounded`, blocks beyond the capacity of the shared list are returned
+    // to the heap.
+    void Give(size_t sizeClass, FreeBlock * head, bool unbounded = false)
+    {
+        FreeBlock * excess = nullptr;
+
+        mMutex.Lock();
+        while (head != nullptr)
+        {
+            FreeBlock * block = head;
+            head              = block->next;
+            if (unbounded || mCounts[sizeClass] < CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SHARED_CACHE_SIZE)
+            {
+                block->next       = mHeads[sizeClass];
+                mHeads[sizeClass] = block;
+                mCounts[sizeClass]++;
+            }
+            else
+            {
+                block->next = excess;
+                excess      = block;
+            }
+        }
+        mMutex.Unlock();
+
+        FreeToHeap(excess);
+    }
+
+    void ReleaseAll()
+    {
+        for (size_t sizeClass = 0; sizeClass < PacketBufferSlab::kSizeClassCount; sizeClass++)
+        {
+            mMutex.Lock();
+            FreeBlock * head   = mHeads[sizeClass];
+            mHeads[sizeClass]  = nullptr;
+            mCounts[sizeClass] = 0;
+            mMutex.Unlock();
+
+            FreeToHeap(head);
+        }
+    }
+
+    static void FreeToHeap(FreeBlock * head)
+    {
+        while (head != nullptr)
+        {
+            FreeBlock * block = head;
+            head              = block->next;
+            Platform::MemoryFree(block);
+            SYSTEM_STATS_COUNT_PACKETBUFFER_ALLOCATION(Stats::kPacketBufferHeapFrees);
+        }
+    }
+
+private:
+    Mutex mMutex;
+    FreeBlock * mHeads[PacketBufferSlab::kSizeClassCount] = {};
+    size_t mCounts[PacketBufferSlab::kSizeClassCount]     = {};
+};
+
+SharedLists sSharedLists;
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE > 0
+
+// Number of blocks moved at once between a thread cache and the shared lists.
+constexpr size_t kTransferBatchSize = (CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE + 1) / 2;
+
+struct ThreadCache
+{
+    FreeBlock * heads[PacketBufferSlab::kSizeClassCount] = {};
+    size_t counts[PacketBufferSlab::kSizeClassCount]     = {};
+
+    // Moves up to `count` blocks of the class to the shared lists.
+    void Flush(size_t sizeClass, size_t count, bool unbounded = false)
+    {
+        FreeBlock * head = nullptr;
+        size_t moved     = 0;
+        while (moved < count && heads[sizeClass] != nullptr)
+        {
+            FreeBlock * block = heads[sizeClass];
+            heads[sizeClass]  = block->next;
+            block->next       = head;
+            head              = block;
+            moved++;
+        }
+        counts[sizeClass] -= moved;
+        if (moved > 0)
+        {
+            sSharedLists.Give(sizeClass, head, unbounded);
+            SYSTEM_STATS_COUNT_PACKETBUFFER_ALLOCATION(Stats::kPacketBufferSharedCacheTransfers);
+        }
+    }
+
+    ~ThreadCache()
+    {
+        // The thread may exit after Platform::MemoryShutdown(), so keep its blocks rather than freeing them; the shared lists
+        // are trimmed back to their capacity by the next blocks freed to them.
+        for (size_t sizeClass = 0; sizeClass < PacketBufferSlab::kSizeClassCount; sizeClass++)
+        {
+            Flush(sizeClass, counts[sizeClass], true);
+        }
+    }
+};
+
+thread_local ThreadCache tThreadCache;
+
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE > 0
+
+} // namespace
+
+size_t PacketBufferSlab::SizeClass(size_t blockSize)
+{
+    for (size_t sizeClass = 0; sizeClass < kSizeClassCount; sizeClass++)
+    {
+        if (blockSize <= kClassBlockSizes[sizeClass])
+        {
+            return sizeClass;
+        }
+    }
+    return kNoSizeClass;
+}
+
+size_t PacketBufferSlab::RoundedBlockSize(size_t blockSize)
+{
+    const size_t sizeClass = SizeClass(blockSize);
+    return (sizeClass == kNoSizeClass) ? blockSize : kClassBlockSizes[sizeClass];
+}
+
+void * PacketBufferSlab::Allocate(size_t blockSize)
+{
+    SYSTEM_STATS_COUNT_PACKETBUFFER_ALLOCATION(Stats::kPacketBufferAllocations);
+
+    const size_t sizeClass = SizeClass(blockSize);
+    if (sizeClass != kNoSizeClass)
+    {
+        FreeBlock * block = nullptr;
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE > 0
+        ThreadCache & cache = tThreadCache;
+        if (cache.counts[sizeClass] == 0)
+        {
+            cache.counts[sizeClass] = sSharedLists.Take(sizeClass, cache.heads[sizeClass], kTransferBatchSize);
+            if (cache.counts[sizeClass] > 0)
+            {
+                SYSTEM_STATS_COUNT_PACKETBUFFER_ALLOCATION(Stats::kPacketBufferSharedCacheTransfers);
+            }
+        }
+        if (cache.counts[sizeClass] > 0)
+        {
+            block                   = cache.heads[sizeClass];
+            cache.heads[sizeClass]  = block->next;
+            cache.counts[sizeClass] = cache.counts[sizeClass] - 1;
+        }
+#else
+        if (sSharedLists.Take(sizeClass, block, 1) > 0)
+        {
+            SYSTEM_STATS_COUNT_PACKETBUFFER_ALLOCATION(Stats::kPacketBufferSharedCacheTransfers);
+        }
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE > 0
+        if (block != nullptr)
+        {
+            return block;
+        }
+        blockSize = kClassBlockSizes[sizeClass];
+    }
+
+    SYSTEM_STATS_COUNT_PACKETBUFFER_ALLOCATION(Stats::kPacketBufferHeapAllocations);
+    return Platform::MemoryAlloc(blockSize);
+}
+
+void PacketBufferSlab::Free(void * block, size_t blockSize)
+{
+    SYSTEM_STATS_COUNT_PACKETBUFFER_ALLOCATION(Stats::kPacketBufferFrees);
+
+    const size_t sizeClass = SizeClass(blockSize);
+    if (sizeClass == kNoSizeClass)
+    {
+        Platform::MemoryFree(block);
+        SYSTEM_STATS_COUNT_PACKETBUFFER_ALLOCATION(Stats::kPacketBufferHeapFrees);
+        return;
+    }
+
+    FreeBlock * freeBlock = static_cast<FreeBlock *>(block);
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE > 0
+    ThreadCache & cache = tThreadCache;
+    if (cache.counts[sizeClass] >= CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE)
+    {
+        cache.Flush(sizeClass, kTransferBatchSize);
+    }
+    freeBlock->next        = cache.heads[sizeClass];
+    cache.heads[sizeClass] = freeBlock;
+    cache.counts[sizeClass]++;
+#else
+    freeBlock->next = nullptr;
+    sSharedLists.Give(sizeClass, freeBlock);
+    SYSTEM_STATS_COUNT_PACKETBUFFER_ALLOCATION(Stats::kPacketBufferSharedCacheTransfers);
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE > 0
+}
+
+void PacketBufferSlab::ReleaseCachedBlocks()
+{
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE > 0
+    ThreadCache & cache = tThreadCache;
+    for (size_t sizeClass = 0; sizeClass < kSizeClassCount; sizeClass++)
+    {
+        SharedLists::FreeToHeap(cache.heads[sizeClass]);
+        cache.heads[sizeClass]  = nullptr;
+        cache.counts[sizeClass] = 0;
+    }
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE > 0
+    sSharedLists.ReleaseAll();
+}
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
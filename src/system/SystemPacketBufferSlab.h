@@ -0,0 +1,81 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Size-class allocator for the memory blocks of heap packet buffers.
+ *      This is not part of the public PacketBuffer interface.
+ */
+
+#pragma once
+
+#include <system/SystemPacketBufferInternal.h>
+
+#include <stddef.h>
+
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+
+namespace chip {
+namespace System {
+
+/**
+ * Allocator of the memory blocks of packet buffers, see CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_ALLOCATOR.
+ *
+ * Blocks are rounded up to a few size classes, the largest one fitting a maximum-size regular packet buffer.  Freed blocks are
+ * kept in a cache of the freeing thread, then in free lists shared by all the threads, and returned to the heap only beyond
+ * CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE and CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SHARED_CACHE_SIZE blocks of
+ * their class.  Threads move blocks to and from the shared lists in batches, so most allocations take no lock.
+ *
+ * Blocks larger than the largest class, e.g. large buffers for TCP, are allocated from and freed to the heap directly.
+ */
+class PacketBufferSlab
+{
+public:
+    static constexpr size_t kSizeClassCount = 3;
+
+    /**
+     * Returns a block of at least `blockSize` bytes, or nullptr if the heap is exhausted.
+     */
+    static void * Allocate(size_t blockSize);
+
+    /**
+     * Releases a block returned by Allocate(), given the same `blockSize`.
+     */
+    static void Free(void * block, size_t blockSize);
+
+    /**
+     * Returns the actual size of the blocks returned by Allocate(blockSize).
+     */
+    static size_t RoundedBlockSize(size_t blockSize);
+
+    /**
+     * Returns the free blocks cached by the calling thread and the shared ones to the heap.  The system layer calls it when it
+     * shuts down.
+     */
+    static void ReleaseCachedBlocks();
+
+private:
+    static const size_t kClassBlockSizes[kSizeClassCount];
+
+    static size_t SizeClass(size_t blockSize);
+};
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
@@ -33,6 +33,10 @@
 
 #include <string.h>
 
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_ALLOCATOR
+#include <atomic>
+#endif
+
 namespace chip {
 namespace System {
 namespace Stats {
@@ -103,6 +107,35 @@ bool Difference(Snapshot & result, Snapshot & after, Snapshot & before)
     return leak;
 }
 
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_ALLOCATOR
+
+static const Label sPacketBufferAllocationStrings[kNumPacketBufferAllocationCounters] = {
+    "Packet buffer allocations",
+    "Packet buffer heap allocations",
+    "Packet buffer frees",
+    "Packet buffer heap frees",
+    "Packet buffer shared cache transfers",
+};
+
+static std::atomic<uint64_t> sPacketBufferAllocationCounts[kNumPacketBufferAllocationCounters];
+
+void CountPacketBufferAllocation(PacketBufferAllocationCounter counter)
+{
+    sPacketBufferAllocationCounts[counter].fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t GetPacketBufferAllocationCount(PacketBufferAllocationCounter counter)
+{
+    return sPacketBufferAllocationCounts[counter].load(std::memory_order_relaxed);
+}
+
+const Label * GetPacketBufferAllocationStrings()
+{
+    return sPacketBufferAllocationStrings;
+}
+
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_ALLOCATOR
+
 #if CHIP_SYSTEM_CONFIG_USE_LWIP && LWIP_STATS && MEMP_STATS
 
 void UpdateLwipPbufCounts(void)
@@ -93,6 +93,26 @@ void UpdateLwipPbufCounts(void);
 typedef const char * Label;
 const Label * GetStrings();
 
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_ALLOCATOR
+/**
+ * Cumulative counters of the packet buffer slab allocator, see CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_ALLOCATOR.  Unlike the
+ * resources above, they count events rather than objects in use, and may be updated from any thread.
+ */
+enum PacketBufferAllocationCounter
+{
+    kPacketBufferAllocations,
+    kPacketBufferHeapAllocations,
+    kPacketBufferFrees,
+    kPacketBufferHeapFrees,
+    kPacketBufferSharedCacheTransfers,
+    kNumPacketBufferAllocationCounters
+};
+
+void CountPacketBufferAllocation(PacketBufferAllocationCounter counter);
+uint64_t GetPacketBufferAllocationCount(PacketBufferAllocationCounter counter);
+const Label * GetPacketBufferAllocationStrings();
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_ALLOCATOR
+
 } // namespace Stats
 } // namespace System
 } // namespace chip
@@ -137,6 +157,12 @@ const Label * GetStrings();
         chip::System::Stats::GetResourcesInUse()[entry] = 0;                                                                       \
     } while (0)
 
+#define SYSTEM_STATS_COUNT_PACKETBUFFER_ALLOCATION(counter)                                                                        \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        chip::System::Stats::CountPacketBufferAllocation(counter);                                                                 \
+    } while (0)
+
 #if CHIP_SYSTEM_CONFIG_USE_LWIP && LWIP_STATS && MEMP_STATS
 #define SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS()                                                                                     \
     do                                                                                                                             \
@@ -168,6 +194,8 @@ const Label * GetStrings();
 
 #define SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS()
 
+#define SYSTEM_STATS_COUNT_PACKETBUFFER_ALLOCATION(counter)
+
 #define SYSTEM_STATS_TEST_IN_USE(entry, expected) (true)
 #define SYSTEM_STATS_TEST_HIGH_WATER_MARK(entry, expected) (true)
 #define SYSTEM_STATS_RESET_HIGH_WATER_MARK_FOR_TESTING(entry)
@@ -164,7 +164,11 @@ ssize_t WriteEvent(int eventFd)
 
 CHIP_ERROR WakeEvent::Open(LayerSockets & systemLayer)
 {
+#if defined(EFD_NONBLOCK) && defined(EFD_CLOEXEC)
+    mReadFD = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#else
     mReadFD = ::eventfd(0, 0);
+#endif
     if (mReadFD == -1)
     {
         return CHIP_ERROR_POSIX(errno);
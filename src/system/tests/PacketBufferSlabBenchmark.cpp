@@ -0,0 +1,151 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures packet buffer allocation churn on one and several threads:
+ *      blocks from the heap, from PacketBufferSlab, and the whole
+ *      PacketBufferHandle::New path on top of the slab. Requires
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_ALLOCATOR.
+ *
+ *      Usage: packet-buffer-slab-benchmark
+ */
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemPacketBuffer.h>
+#include <system/SystemPacketBufferSlab.h>
+#include <system/SystemStats.h>
+
+#include <chrono>
+#include <random>
+#include <stdlib.h>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace chip;
+using namespace chip::System;
+
+namespace {
+
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+
+// Each thread keeps a window of live buffers of mixed sizes, replacing a random one at each step, like a controller holding
+// a few pending messages while receiving reports and mDNS traffic.
+template <typename Allocate, typename Free>
+double Churn(size_t threadCount, Allocate allocate, Free free)
+{
+    constexpr size_t kSteps      = 100000;
+    constexpr size_t kWindowSize = 32;
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&, t] {
+            std::minstd_rand random(static_cast<uint32_t>(t + 1));
+            std::vector<std::pair<void *, size_t>> window(kWindowSize, { nullptr, 0 });
+            for (size_t step = 0; step < kSteps; step++)
+            {
+                auto & slot = window[random() % kWindowSize];
+                if (slot.first != nullptr)
+                {
+                    free(slot.first, slot.second);
+                }
+                // Mostly acknowledgements and small messages, some reports, a few full-size packets.
+                const uint32_t kind = static_cast<uint32_t>(random() % 10);
+                slot.second         = (kind < 6) ? 60 + random() % 100 : (kind < 9) ? 300 + random() % 300 : 1200;
+                slot.first          = allocate(slot.second);
+            }
+            for (auto & slot : window)
+            {
+                free(slot.first, slot.second);
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(kSteps * threadCount);
+}
+
+CHIP_ERROR RunBenchmark()
+{
+    for (size_t threadCount : { 1, 4 })
+    {
+        // The blocks the heap configuration would allocate, without the slab
+        const double heapNs = Churn(
+            threadCount, [](size_t size) { return Platform::MemoryAlloc(sizeof(pbuf) + size); },
+            [](void * block, size_t) { Platform::MemoryFree(block); });
+        const double slabNs = Churn(
+            threadCount, [](size_t size) { return PacketBufferSlab::Allocate(sizeof(pbuf) + size); },
+            [](void * block, size_t size) { PacketBufferSlab::Free(block, sizeof(pbuf) + size); });
+        // The whole PacketBuffer allocation path, on top of the slab
+        const double packetBufferNs = Churn(
+            threadCount,
+            [](size_t size) { return static_cast<void *>(PacketBufferHandle::New(size, 0).UnsafeRelease()); },
+            [](void * buffer, size_t) { PacketBufferHandle::Adopt(static_cast<PacketBuffer *>(buffer)); });
+
+        ChipLogProgress(chipSystemLayer,
+                        "Packet buffer churn with %u threads: %.1f ns per block from the heap, %.1f ns from the slab, "
+                        "%.1f ns per PacketBufferHandle::New",
+                        static_cast<unsigned>(threadCount), heapNs, slabNs, packetBufferNs);
+    }
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    const Stats::Label * labels = Stats::GetPacketBufferAllocationStrings();
+    for (size_t i = 0; i < Stats::kNumPacketBufferAllocationCounters; i++)
+    {
+        ChipLogProgress(chipSystemLayer, "%s: %llu", labels[i],
+                        static_cast<unsigned long long>(
+                            Stats::GetPacketBufferAllocationCount(static_cast<Stats::PacketBufferAllocationCounter>(i))));
+    }
+#endif
+
+    PacketBufferSlab::ReleaseCachedBlocks();
+    return CHIP_NO_ERROR;
+}
+
+#else
+
+CHIP_ERROR RunBenchmark()
+{
+    ChipLogError(chipSystemLayer, "Packet buffers do not come from the slab, see CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_ALLOCATOR");
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+}
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    CHIP_ERROR err = RunBenchmark();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipSystemLayer, "Packet buffer slab benchmark failed: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    Platform::MemoryShutdown();
+    return (err == CHIP_NO_ERROR) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
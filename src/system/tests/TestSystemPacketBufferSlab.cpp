@@ -0,0 +1,204 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <system/SystemLayerImpl.h>
+#include <system/SystemPacketBuffer.h>
+#include <system/SystemPacketBufferSlab.h>
+#include <system/SystemStats.h>
+
+#include <random>
+#include <thread>
+#include <vector>
+
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+
+using namespace chip;
+using namespace chip::System;
+
+namespace {
+
+class TestSystemPacketBufferSlab : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite()
+    {
+        PacketBufferSlab::ReleaseCachedBlocks();
+        chip::Platform::MemoryShutdown();
+    }
+};
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+uint64_t Count(Stats::PacketBufferAllocationCounter counter)
+{
+    return Stats::GetPacketBufferAllocationCount(counter);
+}
+#endif
+
+TEST_F(TestSystemPacketBufferSlab, RoundsToSizeClasses)
+{
+    EXPECT_EQ(PacketBufferSlab::RoundedBlockSize(1), 256u);
+    EXPECT_EQ(PacketBufferSlab::RoundedBlockSize(256), 256u);
+    EXPECT_EQ(PacketBufferSlab::RoundedBlockSize(257), 768u);
+    EXPECT_GE(PacketBufferSlab::RoundedBlockSize(800), PacketBuffer::kMaxSizeWithoutReserve);
+
+    // Large buffers are left to the heap.
+    EXPECT_EQ(PacketBufferSlab::RoundedBlockSize(10000), 10000u);
+}
+
+TEST_F(TestSystemPacketBufferSlab, ReusesFreedBuffers)
+{
+    PacketBufferHandle handle = PacketBufferHandle::New(100);
+    ASSERT_FALSE(handle.IsNull());
+    const uint8_t * start = handle->Start();
+    handle                = nullptr;
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    const uint64_t heapAllocations = Count(Stats::kPacketBufferHeapAllocations);
+    const uint64_t heapFrees       = Count(Stats::kPacketBufferHeapFrees);
+#endif
+
+    // Buffers of the same size class come back from the cache, most recently freed first.
+    for (size_t size : { 10, 100, 150 })
+    {
+        handle = PacketBufferHandle::New(size);
+        ASSERT_FALSE(handle.IsNull());
+        EXPECT_EQ(handle->Start(), start);
+        EXPECT_GE(handle->AvailableDataLength(), size);
+        handle = nullptr;
+    }
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    EXPECT_EQ(Count(Stats::kPacketBufferHeapAllocations), heapAllocations);
+    EXPECT_EQ(Count(Stats::kPacketBufferHeapFrees), heapFrees);
+#endif
+}
+
+TEST_F(TestSystemPacketBufferSlab, RightSizesAcrossSizeClasses)
+{
+    static const char kPayload[] = "Joy!";
+
+    PacketBufferHandle handle = PacketBufferHandle::New(PacketBuffer::kMaxSizeWithoutReserve, 0);
+    ASSERT_FALSE(handle.IsNull());
+    memcpy(handle->Start(), kPayload, sizeof kPayload);
+    handle->SetDataLength(sizeof kPayload);
+
+    // The data fits in the smallest class, the buffer moves there.
+    const uint8_t * start = handle->Start();
+    handle.RightSize();
+    EXPECT_NE(handle->Start(), start);
+    EXPECT_EQ(handle->AllocSize(), sizeof kPayload);
+    EXPECT_EQ(memcmp(handle->Start(), kPayload, sizeof kPayload), 0);
+
+    // Data in the same class as the buffer is not copied, there is nothing to save.
+    handle = PacketBufferHandle::New(200, 0);
+    ASSERT_FALSE(handle.IsNull());
+    handle->SetDataLength(100);
+    start = handle->Start();
+    handle.RightSize();
+    EXPECT_EQ(handle->Start(), start);
+    EXPECT_EQ(handle->AllocSize(), 200u);
+}
+
+TEST_F(TestSystemPacketBufferSlab, BoundsCachedBuffers)
+{
+    constexpr size_t kBufferCount = 200;
+    constexpr size_t kMaxCachedCount =
+        CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE + CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SHARED_CACHE_SIZE;
+    static_assert(kBufferCount > kMaxCachedCount, "The test must free more buffers than can be cached");
+
+    std::vector<PacketBufferHandle> handles;
+    for (size_t i = 0; i < kBufferCount; i++)
+    {
+        handles.push_back(PacketBufferHandle::New(100));
+        ASSERT_FALSE(handles.back().IsNull());
+    }
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    const uint64_t heapFrees = Count(Stats::kPacketBufferHeapFrees);
+#endif
+    handles.clear();
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    EXPECT_GE(Count(Stats::kPacketBufferHeapFrees) - heapFrees, kBufferCount - kMaxCachedCount);
+#endif
+
+    // Once the caches are released, buffers come from the heap again.
+    PacketBufferSlab::ReleaseCachedBlocks();
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    const uint64_t heapAllocations = Count(Stats::kPacketBufferHeapAllocations);
+#endif
+    PacketBufferHandle handle = PacketBufferHandle::New(100);
+    ASSERT_FALSE(handle.IsNull());
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    EXPECT_EQ(Count(Stats::kPacketBufferHeapAllocations) - heapAllocations, 1u);
+#endif
+}
+
+TEST_F(TestSystemPacketBufferSlab, ReleasesCachedBlocksOnLayerShutdown)
+{
+    LayerImpl layer;
+    ASSERT_EQ(layer.Init(), CHIP_NO_ERROR);
+
+    // The block of the freed buffer is cached until the system layer shuts down.
+    PacketBufferHandle handle = PacketBufferHandle::New(100);
+    ASSERT_FALSE(handle.IsNull());
+    handle = nullptr;
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    const uint64_t heapFrees = Count(Stats::kPacketBufferHeapFrees);
+#endif
+    layer.Shutdown();
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    EXPECT_GE(Count(Stats::kPacketBufferHeapFrees) - heapFrees, 1u);
+
+    const uint64_t heapAllocations = Count(Stats::kPacketBufferHeapAllocations);
+#endif
+    handle = PacketBufferHandle::New(100);
+    ASSERT_FALSE(handle.IsNull());
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    EXPECT_EQ(Count(Stats::kPacketBufferHeapAllocations) - heapAllocations, 1u);
+#endif
+}
+
+TEST_F(TestSystemPacketBufferSlab, SharesBuffersBetweenThreads)
+{
+    // Buffers freed by a thread that exits are not lost.
+    std::thread([] {
+        std::vector<PacketBufferHandle> handles;
+        for (size_t i = 0; i < 8; i++)
+        {
+            handles.push_back(PacketBufferHandle::New(500));
+        }
+    }).join();
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    const uint64_t heapAllocations = Count(Stats::kPacketBufferHeapAllocations);
+#endif
+    PacketBufferHandle handle = PacketBufferHandle::New(500);
+    ASSERT_FALSE(handle.IsNull());
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    EXPECT_EQ(Count(Stats::kPacketBufferHeapAllocations), heapAllocations);
+#endif
+}
+
+} // namespace
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
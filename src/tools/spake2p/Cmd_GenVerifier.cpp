@@ -25,17 +25,20 @@
 
 #include "spake2p.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 #include <CHIPVersion.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <lib/support/Base64.h>
 #include <lib/support/CHIPArgParser.hpp>
 #include <lib/support/CHIPMem.h>
-#include <protocols/secure_channel/PASESession.h>
 #include <setup_payload/SetupPayload.h>
 
 using namespace chip::Crypto;
@@ -58,6 +61,7 @@ OptionDef gCmdOptionDefs[] =
     { "salt-len",        kArgumentRequired, 'l' },
     { "salt",            kArgumentRequired, 's' },
     { "out",             kArgumentRequired, 'o' },
+    { "jobs",            kArgumentRequired, 'j' },
     { }
 };
 
@@ -127,6 +131,13 @@ const char * const gCmdOptionHelp =
     "           index of the parameter set in the list,'pin-code','iteration-count','salt'(Base-64 encoded),'verifier'(Base-64 encoded)\n"
     "           ....\n"
     "\n"
+    "   -j, --jobs <int>\n"
+    "\n"
+    "       The number of threads used to generate verifiers. If not specified, one thread is used.\n"
+    "       Verifiers are generated in batches whose PBKDF2 computations run together, so generating\n"
+    "       many parameter sets is faster than generating them one at a time even with a single thread.\n"
+    "       The output does not depend on the number of threads.\n"
+    "\n"
     ;
 
 OptionSet gCmdOptions =
@@ -159,8 +170,25 @@ uint8_t gSalt[BASE64_MAX_DECODED_LEN(BASE64_ENCODED_LEN(kSpake2p_Max_PBKDF_Salt_
 uint8_t gSaltDecodedLen   = 0;
 uint8_t gSaltLen          = 0;
 const char * gOutFileName = nullptr;
+uint32_t gJobs            = 1;
 std::ifstream gPinCodeFile;
 
+constexpr uint32_t kMaxJobs = 256;
+
+// Number of parameter sets generated together by Spake2pVerifier::GenerateMultiple().
+constexpr size_t kBatchSize = PBKDF2_sha256_MultiLane::kLanes;
+
+// Number of batches per thread that are generated before their parameter sets are written out.
+constexpr size_t kBatchesPerJobPerWindow = 4;
+
+struct ParameterSet
+{
+    uint32_t pinCode;
+    uint8_t salt[kSpake2p_Max_PBKDF_Salt_Length];
+    chip::ByteSpan saltSpan;
+    Spake2pVerifier verifier;
+};
+
 static uint32_t GetNextPinCode()
 {
     if (!gPinCodeFile.is_open())
@@ -262,6 +290,14 @@ bool HandleOption(const char * progName, OptionSet * optSet, int id, const char
         gOutFileName = arg;
         break;
 
+    case 'j':
+        if (!ParseInt(arg, gJobs) || gJobs == 0 || gJobs > kMaxJobs)
+        {
+            PrintArgError("%s: Invalid value specified for jobs parameter: %s\n", progName, arg);
+            return false;
+        }
+        break;
+
     default:
         PrintArgError("%s: Unhandled option: %s\n", progName, name);
         return false;
@@ -270,6 +306,129 @@ bool HandleOption(const char * progName, OptionSet * optSet, int id, const char
     return true;
 }
 
+// Picks the PIN code and salt of the next parameter set: the first set uses the 'pin-code' and 'salt' parameters if
+// specified, later ones use the next PIN code from the PIN code file if any, and random values otherwise.
+bool PrepareParameterSet(ParameterSet & set)
+{
+    if (gSaltDecodedLen == 0)
+    {
+        CHIP_ERROR err = chip::Crypto::DRBG_get_bytes(set.salt, gSaltLen);
+        if (err != CHIP_NO_ERROR)
+        {
+            std::cerr << "DRBG_get_bytes() failed.\n";
+            return false;
+        }
+    }
+    else
+    {
+        memcpy(set.salt, gSalt, gSaltLen);
+    }
+    set.saltSpan = chip::ByteSpan(set.salt, gSaltLen);
+
+    if (gPinCode == chip::kSetupPINCodeUndefinedValue)
+    {
+        CHIP_ERROR err = chip::SetupPayload::generateRandomSetupPin(gPinCode);
+        if (err != CHIP_NO_ERROR)
+        {
+            std::cerr << "generateRandomSetupPin() failed.\n";
+            return false;
+        }
+    }
+    set.pinCode = gPinCode;
+
+    // If the file with PIN codes is not provided, the PIN code of the next set will be randomly generated.
+    gPinCode = GetNextPinCode();
+    // The Salt of the next set will be randomly generated.
+    gSaltDecodedLen = 0;
+    return true;
+}
+
+// Generates the verifiers of the given parameter sets, kBatchSize sets at a time, spreading the batches over gJobs threads.
+bool GenerateVerifiers(std::vector<ParameterSet> & sets)
+{
+    const size_t batchCount = (sets.size() + kBatchSize - 1) / kBatchSize;
+    std::atomic<size_t> nextBatch{ 0 };
+    std::atomic<bool> failed{ false };
+
+    auto worker = [&]() {
+        std::vector<chip::ByteSpan> salts(kBatchSize);
+        std::vector<uint32_t> pinCodes(kBatchSize);
+        std::vector<Spake2pVerifier> verifiers(kBatchSize);
+
+        for (size_t batch = nextBatch++; batch < batchCount && !failed; batch = nextBatch++)
+        {
+            const size_t first = batch * kBatchSize;
+            const size_t count = std::min(kBatchSize, sets.size() - first);
+            for (size_t i = 0; i < count; i++)
+            {
+                salts[i]    = sets[first + i].saltSpan;
+                pinCodes[i] = sets[first + i].pinCode;
+            }
+
+            CHIP_ERROR err =
+                Spake2pVerifier::GenerateMultiple(gIterationCount, chip::Span<const chip::ByteSpan>(salts.data(), count),
+                                                  chip::Span<const uint32_t>(pinCodes.data(), count),
+                                                  chip::Span<Spake2pVerifier>(verifiers.data(), count));
+            if (err != CHIP_NO_ERROR)
+            {
+                failed = true;
+                break;
+            }
+            for (size_t i = 0; i < count; i++)
+            {
+                sets[first + i].verifier = verifiers[i];
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 1; i < std::min<size_t>(gJobs, batchCount); i++)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+
+    if (failed)
+    {
+        std::cerr << "Spake2pVerifier::GenerateMultiple() failed.\n";
+        return false;
+    }
+    return true;
+}
+
+bool WriteParameterSet(std::ostream & outStream, uint32_t index, const ParameterSet & set)
+{
+    Spake2pVerifierSerialized serializedVerifier;
+    chip::MutableByteSpan serializedVerifierSpan(serializedVerifier);
+    CHIP_ERROR err = set.verifier.Serialize(serializedVerifierSpan);
+    if (err != CHIP_NO_ERROR)
+    {
+        std::cerr << "Spake2pVerifier::Serialize() failed.\n";
+        return false;
+    }
+
+    char saltB64[BASE64_ENCODED_LEN(kSpake2p_Max_PBKDF_Salt_Length) + 1];
+    uint32_t saltB64Len = chip::Base64Encode32(set.salt, gSaltLen, saltB64);
+    saltB64[saltB64Len] = '\0';
+
+    char verifierB64[BASE64_ENCODED_LEN(kSpake2p_VerifierSerialized_Length) + 1];
+    uint32_t verifierB64Len     = chip::Base64Encode32(serializedVerifier, kSpake2p_VerifierSerialized_Length, verifierB64);
+    verifierB64[verifierB64Len] = '\0';
+
+    outStream << index << "," << std::setfill('0') << std::setw(8) << set.pinCode << "," << gIterationCount << "," << saltB64 << ","
+              << verifierB64 << "\n";
+    if (outStream.fail())
+    {
+        std::cerr << "Error writing to output file: " << strerror(errno) << "\n";
+        return false;
+    }
+    return true;
+}
+
 } // namespace
 
 bool Cmd_GenVerifier(int argc, char * argv[])
@@ -331,61 +490,25 @@ bool Cmd_GenVerifier(int argc, char * argv[])
         std::cerr << "Error writing to output file: " << strerror(errno) << "\n";
     }
 
-    for (uint32_t i = 0; i < gCount; i++)
-    {
-        uint8_t salt[kSpake2p_Max_PBKDF_Salt_Length];
-        if (gSaltDecodedLen == 0)
-        {
-            CHIP_ERROR err = chip::Crypto::DRBG_get_bytes(salt, gSaltLen);
-            if (err != CHIP_NO_ERROR)
-            {
-                std::cerr << "DRBG_get_bytes() failed.\n";
-                return false;
-            }
-        }
-        else
-        {
-            memcpy(salt, gSalt, gSaltLen);
-        }
+    // Parameter sets are generated in windows so that the output is written progressively for large counts.
+    const size_t windowSize = kBatchSize * kBatchesPerJobPerWindow * gJobs;
+    std::vector<ParameterSet> sets;
+    sets.reserve(std::min<size_t>(windowSize, gCount));
 
-        Spake2pVerifier verifier;
-        CHIP_ERROR err = chip::PASESession::GeneratePASEVerifier(verifier, gIterationCount, chip::ByteSpan(salt, gSaltLen),
-                                                                 (gPinCode == chip::kSetupPINCodeUndefinedValue), gPinCode);
-        if (err != CHIP_NO_ERROR)
+    for (uint32_t first = 0; first < gCount; first += static_cast<uint32_t>(sets.size()))
+    {
+        sets.resize(std::min<size_t>(windowSize, gCount - first));
+        for (ParameterSet & set : sets)
         {
-            std::cerr << "GeneratePASEVerifier() failed.\n";
-            return false;
+            VerifyOrReturnValue(PrepareParameterSet(set), false);
         }
 
-        Spake2pVerifierSerialized serializedVerifier;
-        chip::MutableByteSpan serializedVerifierSpan(serializedVerifier);
-        err = verifier.Serialize(serializedVerifierSpan);
-        if (err != CHIP_NO_ERROR)
-        {
-            std::cerr << "Spake2pVerifier::Serialize() failed.\n";
-            return false;
-        }
+        VerifyOrReturnValue(GenerateVerifiers(sets), false);
 
-        char saltB64[BASE64_ENCODED_LEN(kSpake2p_Max_PBKDF_Salt_Length) + 1];
-        uint32_t saltB64Len = chip::Base64Encode32(salt, gSaltLen, saltB64);
-        saltB64[saltB64Len] = '\0';
-
-        char verifierB64[BASE64_ENCODED_LEN(kSpake2p_VerifierSerialized_Length) + 1];
-        uint32_t verifierB64Len     = chip::Base64Encode32(serializedVerifier, kSpake2p_VerifierSerialized_Length, verifierB64);
-        verifierB64[verifierB64Len] = '\0';
-
-        (*outStream) << i << "," << std::setfill('0') << std::setw(8) << gPinCode << "," << gIterationCount << "," << saltB64 << ","
-                     << verifierB64 << "\n";
-        if (outStream->fail())
+        for (size_t i = 0; i < sets.size(); i++)
         {
-            std::cerr << "Error writing to output file: " << strerror(errno) << "\n";
-            return false;
+            VerifyOrReturnValue(WriteParameterSet(*outStream, first + static_cast<uint32_t>(i), sets[i]), false);
         }
-
-        // If the file with PIN codes is not provided, the PIN code on next iteration will be randomly generated.
-        gPinCode = GetNextPinCode();
-        // On the next iteration the Salt will be randomly generated.
-        gSaltDecodedLen = 0;
     }
 
     gPinCodeFile.close();
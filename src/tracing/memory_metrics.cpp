@@ -0,0 +1,94 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <tracing/memory_metrics.h>
+
+#include <lib/support/CHIPMemTracking.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <matter/tracing/build_config.h>
+#include <tracing/metric_event.h>
+
+#include <stdint.h>
+
+namespace chip {
+namespace Tracing {
+
+#if CHIP_CONFIG_MEMORY_TRACKING
+
+#if MATTER_TRACING_ENABLED
+
+namespace {
+
+struct MemoryTagMetricKeys
+{
+    MetricKey live;
+    MetricKey peak;
+    MetricKey count;
+};
+
+constexpr MemoryTagMetricKeys kMemoryTagMetricKeys[] = {
+#define _CHIP_MEMORY_TAG_METRIC_KEYS(name, label)                                                                                  \
+    { "core_mem_" label "_live", "core_mem_" label "_peak", "core_mem_" label "_count" },
+    CHIP_MEMORY_TAGS(_CHIP_MEMORY_TAG_METRIC_KEYS)
+#undef _CHIP_MEMORY_TAG_METRIC_KEYS
+};
+
+static_assert(sizeof(kMemoryTagMetricKeys) / sizeof(kMemoryTagMetricKeys[0]) == Platform::kMemoryTagCount,
+              "Every memory tag needs metric keys");
+
+// Metrics carry 32-bit values.
+uint32_t Saturate(uint64_t value)
+{
+    return (value > UINT32_MAX) ? UINT32_MAX : static_cast<uint32_t>(value);
+}
+
+} // namespace
+
+#endif // MATTER_TRACING_ENABLED
+
+void LogMemoryTagMetrics()
+{
+    for (size_t i = 0; i < Platform::kMemoryTagCount; i++)
+    {
+        const Platform::MemoryTag tag        = static_cast<Platform::MemoryTag>(i);
+        const Platform::MemoryTagStats stats = Platform::GetMemoryTagStats(tag);
+        if (stats.allocationCount == 0)
+        {
+            continue;
+        }
+
+        ChipLogProgress(Support, "Memory tag %s: %lu bytes live in %lu blocks, peak %lu bytes, %llu allocations",
+                        Platform::MemoryTagLabel(tag), static_cast<unsigned long>(stats.liveBytes),
+                        static_cast<unsigned long>(stats.liveAllocations), static_cast<unsigned long>(stats.peakBytes),
+                        static_cast<unsigned long long>(stats.allocationCount));
+
+#if MATTER_TRACING_ENABLED
+        const MemoryTagMetricKeys & metricKeys = kMemoryTagMetricKeys[i];
+        MATTER_LOG_METRIC(metricKeys.live, Saturate(stats.liveBytes));
+        MATTER_LOG_METRIC(metricKeys.peak, Saturate(stats.peakBytes));
+        MATTER_LOG_METRIC(metricKeys.count, Saturate(stats.allocationCount));
+#endif // MATTER_TRACING_ENABLED
+    }
+}
+
+#else // CHIP_CONFIG_MEMORY_TRACKING
+
+void LogMemoryTagMetrics() {}
+
+#endif // CHIP_CONFIG_MEMORY_TRACKING
+
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,35 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+namespace chip {
+namespace Tracing {
+
+/// Dumps the allocation statistics of the memory tags (see lib/support/CHIPMemTracking.h)
+/// to the log, and emits them as metrics to the registered tracing backends, with keys
+/// "core_mem_<tag>_live", "core_mem_<tag>_peak" and "core_mem_<tag>_count".
+///
+/// Tags without any allocation are skipped. Does nothing unless CHIP_CONFIG_MEMORY_TRACKING
+/// is enabled.
+///
+/// Thread safety:
+///    Same as the MATTER_LOG_METRIC macros, the statistics themselves may be read from
+///    any thread.
+void LogMemoryTagMetrics();
+
+} // namespace Tracing
+} // namespace chip
@@ -272,6 +272,7 @@ CHIP_ERROR GroupOutgoingCounters::Init(chip::PersistentStorageDelegate * storage
 
     // Spec 4.5.1.3
     mStorage      = storage_delegate;
+    mUseLeases    = false;
     uint16_t size = static_cast<uint16_t>(sizeof(uint32_t));
     uint32_t temp;
     CHIP_ERROR err;
@@ -314,13 +315,42 @@ CHIP_ERROR GroupOutgoingCounters::Init(chip::PersistentStorageDelegate * storage
     return mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::GroupDataCounter().KeyName(), &temp, size);
 }
 
+CHIP_ERROR GroupOutgoingCounters::Init(chip::CounterLeaseStore & leaseStore)
+{
+    // Spec 4.5.1.3: counters without a stored value start at a random value.
+    ReturnErrorOnFailure(mLeasedControlCounter.Init(leaseStore, CounterLeaseStore::Slot::kGroupControlCounter,
+                                                    GROUP_MSG_COUNTER_MIN_INCREMENT,
+                                                    (chip::Crypto::GetRandU32() & kMessageCounterRandomInitMask) + 1));
+    ReturnErrorOnFailure(mLeasedDataCounter.Init(leaseStore, CounterLeaseStore::Slot::kGroupDataCounter,
+                                                 GROUP_MSG_COUNTER_MIN_INCREMENT,
+                                                 (chip::Crypto::GetRandU32() & kMessageCounterRandomInitMask) + 1));
+    mStorage   = nullptr;
+    mUseLeases = true;
+    return CHIP_NO_ERROR;
+}
+
+void GroupOutgoingCounters::Shutdown()
+{
+    mLeasedControlCounter.Shutdown();
+    mLeasedDataCounter.Shutdown();
+}
+
 uint32_t GroupOutgoingCounters::GetCounter(bool isControl)
 {
+    if (mUseLeases)
+    {
+        return (isControl) ? mLeasedControlCounter.GetValue() : mLeasedDataCounter.GetValue();
+    }
     return (isControl) ? mGroupControlCounter : mGroupDataCounter;
 }
 
 CHIP_ERROR GroupOutgoingCounters::IncrementCounter(bool isControl)
 {
+    if (mUseLeases)
+    {
+        return (isControl) ? mLeasedControlCounter.Advance() : mLeasedDataCounter.Advance();
+    }
+
     uint32_t temp  = 0;
     uint16_t size  = static_cast<uint16_t>(sizeof(uint32_t));
     uint32_t value = 0;
@@ -28,6 +28,8 @@
 #include <lib/core/DataModelTypes.h>
 #include <lib/core/NodeId.h>
 #include <lib/core/PeerId.h>
+#include <lib/support/CounterLeaseStore.h>
+#include <lib/support/LeasedCounter.h>
 #include <lib/support/Span.h>
 #include <transport/PeerMessageCounter.h>
 
@@ -82,6 +84,18 @@ public:
     GroupOutgoingCounters(){};
     GroupOutgoingCounters(chip::PersistentStorageDelegate * storage_delegate);
     CHIP_ERROR Init(chip::PersistentStorageDelegate * storage_delegate);
+
+    /**
+     * Keep the counters in a counter lease store instead, which reserves GROUP_MSG_COUNTER_MIN_INCREMENT values at a time
+     * and renews the reservation ahead of exhaustion, rather than reading and writing the storage as the counters advance.
+     */
+    CHIP_ERROR Init(chip::CounterLeaseStore & leaseStore);
+
+    /**
+     * Detach the counters from their counter lease store, if any, which must happen before the store is shut down.
+     */
+    void Shutdown();
+
     uint32_t GetCounter(bool isControl);
     CHIP_ERROR IncrementCounter(bool isControl);
 
@@ -91,6 +105,11 @@ protected:
     uint32_t mGroupDataCounter                 = 0;
     uint32_t mGroupControlCounter              = 0;
     chip::PersistentStorageDelegate * mStorage = nullptr;
+
+    // Used instead of the members above when initialized with a counter lease store.
+    bool mUseLeases = false;
+    chip::LeasedCounter<uint32_t> mLeasedDataCounter;
+    chip::LeasedCounter<uint32_t> mLeasedControlCounter;
 };
 
 } // namespace Transport
@@ -100,7 +100,7 @@ SessionManager::~SessionManager()
 CHIP_ERROR SessionManager::Init(System::Layer * systemLayer, TransportMgrBase * transportMgr,
                                 Transport::MessageCounterManagerInterface * messageCounterManager,
                                 chip::PersistentStorageDelegate * storageDelegate, FabricTable * fabricTable,
-                                Crypto::SessionKeystore & sessionKeystore)
+                                Crypto::SessionKeystore & sessionKeystore, CounterLeaseStore * counterLeaseStore)
 {
     VerifyOrReturnError(mState == State::kNotReady, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(transportMgr != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
@@ -119,7 +119,14 @@ CHIP_ERROR SessionManager::Init(System::Layer * systemLayer, TransportMgrBase *
 
     mGlobalUnencryptedMessageCounter.Init();
 
-    ReturnErrorOnFailure(mGroupClientCounter.Init(storageDelegate));
+    if (counterLeaseStore != nullptr)
+    {
+        ReturnErrorOnFailure(mGroupClientCounter.Init(*counterLeaseStore));
+    }
+    else
+    {
+        ReturnErrorOnFailure(mGroupClientCounter.Init(storageDelegate));
+    }
 
     mTransportMgr->SetSessionManager(this);
 
@@ -153,6 +160,11 @@ void SessionManager::Shutdown()
     // mUnauthenticatedSessions.  We can only hope they got shut down properly.
 
     mMessageCounterManager = nullptr;
+    mGroupClientCounter.Shutdown();
+
+#if CHIP_SYSTEM_CONFIG_MULTICAST_HOMING
+    mMulticastInterfaces.Shutdown();
+#endif // CHIP_SYSTEM_CONFIG_MULTICAST_HOMING
 
     mSystemLayer  = nullptr;
     mTransportMgr = nullptr;
@@ -447,51 +459,39 @@ CHIP_ERROR SessionManager::SendPreparedMessage(const SessionHandle & sessionHand
 #if CHIP_SYSTEM_CONFIG_MULTICAST_HOMING
     if (sessionHandle->GetSessionType() == Transport::Session::SessionType::kGroupOutgoing)
     {
-        chip::Inet::InterfaceIterator interfaceIt;
-        chip::Inet::InterfaceId interfaceId = chip::Inet::InterfaceId::Null();
-        chip::Inet::IPAddress addr;
-        bool interfaceFound = false;
+        const auto interfaces = mMulticastInterfaces.GetInterfaces();
 
-        while (interfaceIt.Next())
+        if (interfaces.empty())
         {
-            char name[Inet::InterfaceId::kMaxIfNameLength];
-            interfaceIt.GetInterfaceName(name, Inet::InterfaceId::kMaxIfNameLength);
-            if (interfaceIt.SupportsMulticast() && interfaceIt.IsUp())
+            ChipLogError(Inet, "No valid Interface found.. Sending to the default one.. ");
+        }
+        else
+        {
+            bool sent      = false;
+            CHIP_ERROR err = CHIP_ERROR_INCORRECT_STATE;
+            for (size_t i = 0; i < interfaces.size() && mTransportMgr != nullptr; i++)
             {
-                interfaceId = interfaceIt.GetInterfaceId();
-                if (CHIP_NO_ERROR == interfaceId.GetLinkLocalAddr(&addr))
+                // Transports do not modify the messages they send, so every interface sends the same encrypted buffer.
+                const bool isLast               = (i + 1 == interfaces.size());
+                PacketBufferHandle interfaceBuf = isLast ? std::move(msgBuf) : msgBuf.Retain();
+
+                multicastAddress.SetInterface(interfaces[i].interfaceId);
+                CHIP_ERROR sendErr = mTransportMgr->SendMessage(multicastAddress, std::move(interfaceBuf));
+                if (sendErr != CHIP_NO_ERROR)
                 {
-                    ChipLogDetail(Inet, "Interface %s has a link local address", name);
-
-                    interfaceFound             = true;
-                    PacketBufferHandle tempBuf = msgBuf.CloneData();
-                    VerifyOrReturnError(!tempBuf.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
-                    VerifyOrReturnError(!tempBuf->HasChainedBuffer(), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
-
-                    destination = &(multicastAddress.SetInterface(interfaceId));
-                    if (mTransportMgr != nullptr)
-                    {
-                        if (CHIP_NO_ERROR != mTransportMgr->SendMessage(*destination, std::move(tempBuf)))
-                        {
-                            ChipLogError(Inet, "Failed to send Multicast message on interface %s", name);
-                        }
-                        else
-                        {
-                            ChipLogDetail(Inet, "Successfully send Multicast message on interface %s", name);
-                        }
-                    }
+                    ChipLogError(Inet, "Failed to send Multicast message on interface %s: %" CHIP_ERROR_FORMAT, interfaces[i].name,
+                                 sendErr.Format());
+                    err = sendErr;
+                }
+                else
+                {
+                    ChipLogDetail(Inet, "Successfully send Multicast message on interface %s", interfaces[i].name);
+                    sent = true;
                 }
             }
-        }
 
-        if (!interfaceFound)
-        {
-            ChipLogError(Inet, "No valid Interface found.. Sending to the default one.. ");
-        }
-        else
-        {
-            // Always return No error, because we expect some interface to fails and others to always succeed (e.g. lo interface)
-            return CHIP_NO_ERROR;
+            // Some interfaces are expected to fail while others succeed (e.g. lo interface): only fail if none of them sent it.
+            return sent ? CHIP_NO_ERROR : err;
         }
     }
 
@@ -31,9 +31,13 @@
 #include <crypto/RandUtils.h>
 #include <crypto/SessionKeystore.h>
 #include <inet/IPAddress.h>
+#if CHIP_SYSTEM_CONFIG_MULTICAST_HOMING
+#include <inet/MulticastInterfaceCache.h>
+#endif // CHIP_SYSTEM_CONFIG_MULTICAST_HOMING
 #include <lib/core/CHIPCore.h>
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/CounterLeaseStore.h>
 #include <lib/support/DLLUtil.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <protocols/secure_channel/Constants.h>
@@ -431,11 +435,13 @@ public:
      * @param storageDelegate       Persistent storage implementation
      * @param fabricTable           Fabric table to hold information about joined fabrics
      * @param sessionKeystore       Session keystore for management of symmetric encryption keys
+     * @param counterLeaseStore     Optional store for the outgoing group message counters, which are kept in
+     *                              storageDelegate when null
      */
     CHIP_ERROR Init(System::Layer * systemLayer, TransportMgrBase * transportMgr,
                     Transport::MessageCounterManagerInterface * messageCounterManager,
                     chip::PersistentStorageDelegate * storageDelegate, FabricTable * fabricTable,
-                    Crypto::SessionKeystore & sessionKeystore);
+                    Crypto::SessionKeystore & sessionKeystore, CounterLeaseStore * counterLeaseStore = nullptr);
 
     /**
      * @brief
@@ -575,6 +581,11 @@ private:
 
     GlobalUnencryptedMessageCounter mGlobalUnencryptedMessageCounter;
 
+#if CHIP_SYSTEM_CONFIG_MULTICAST_HOMING
+    // Interfaces that group messages are sent on, kept across sends.
+    Inet::MulticastInterfaceCache mMulticastInterfaces;
+#endif // CHIP_SYSTEM_CONFIG_MULTICAST_HOMING
+
     /**
      * @brief Parse, decrypt, validate, and dispatch a secure unicast message.
      *
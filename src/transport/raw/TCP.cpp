@@ -30,8 +30,10 @@
 #include <lib/support/logging/CHIPLogging.h>
 #include <transport/raw/MessageHeader.h>
 
+#include <algorithm>
 #include <inttypes.h>
 #include <limits>
+#include <string.h>
 
 namespace chip {
 namespace Transport {
@@ -63,6 +65,42 @@ CHIP_ERROR GetPeerAddress(Inet::TCPEndPoint & endPoint, PeerAddress & outAddr)
     return CHIP_NO_ERROR;
 }
 
+// Splits the head of `received`, which holds a complete message of `messageSize` bytes followed by the start of the next
+// one, so that the head can be passed upstream without copying the message: the trailing bytes are moved to a buffer of
+// their own, which takes the place of the head in `received`. When the length of the next message is already known, that
+// buffer is sized to hold all of it, so that the rest of the message can later be appended in place.
+CHIP_ERROR SplitHeadAfterMessage(System::PacketBufferHandle & received, size_t messageSize, System::PacketBufferHandle & outMessage)
+{
+    const uint8_t * trailingData = received->Start() + messageSize;
+    const size_t trailingLength  = received->DataLength() - messageSize;
+    size_t trailingCapacity      = trailingLength;
+
+    if (trailingLength >= kPacketSizeBytes)
+    {
+        const size_t nextMessageLength = kPacketSizeBytes + LittleEndian::Get32(trailingData);
+        trailingCapacity               = std::max(trailingLength, std::min(nextMessageLength, System::PacketBuffer::kMaxAllocSize));
+    }
+
+    System::PacketBufferHandle trailing = System::PacketBufferHandle::New(trailingCapacity, 0);
+    if (trailing.IsNull() && trailingCapacity > trailingLength)
+    {
+        trailing = System::PacketBufferHandle::New(trailingLength, 0);
+    }
+    VerifyOrReturnError(!trailing.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    memcpy(trailing->Start(), trailingData, trailingLength);
+    trailing->SetDataLength(trailingLength);
+
+    outMessage = received.PopHead();
+    outMessage->SetDataLength(messageSize);
+    if (!received.IsNull())
+    {
+        trailing->AddToEnd(std::move(received));
+    }
+    received = std::move(trailing);
+    return CHIP_NO_ERROR;
+}
+
 } // namespace
 
 TCPBase::~TCPBase()
@@ -420,17 +458,36 @@ CHIP_ERROR TCPBase::ProcessSingleMessage(const PeerAddress & peerAddress, Active
     // `state->mReceived->Start()` currently points to the message data.
     // On exit, `state->mReceived` will have had `messageSize` bytes consumed, no matter what.
     System::PacketBufferHandle message;
+    const size_t headLength = state.mReceived->DataLength();
 
-    if (state.mReceived->DataLength() == messageSize)
+    if (headLength == messageSize)
     {
         // In this case, the head packet buffer contains exactly the message.
         // This is common because typical messages fit in a network packet, and are delivered as such.
         // Peel off the head to pass upstream, which effectively consumes it from `state->mReceived`.
         message = state.mReceived.PopHead();
     }
+    else if (headLength > messageSize && headLength - messageSize <= messageSize)
+    {
+        // The head packet buffer contains the message followed by the start of the next one, which is typical of
+        // large messages streamed back to back (e.g. chunked reports). Move the shorter trailing data out of the head
+        // rather than copying the message, so that the head holds exactly the message and can be peeled off.
+        ReturnErrorOnFailure(SplitHeadAfterMessage(state.mReceived, messageSize, message));
+    }
+    else if (headLength < messageSize && state.mReceived->AvailableDataLength() >= messageSize - headLength)
+    {
+        // The message continues in the following buffers, and the head packet buffer has room for the rest of it.
+        // Append the rest to the head rather than copying the whole message to a fresh buffer.
+        const size_t remainingLength = messageSize - headLength;
+        message                      = state.mReceived.PopHead();
+        CHIP_ERROR err               = state.mReceived->Read(message->Start() + headLength, remainingLength);
+        state.mReceived.Consume(remainingLength);
+        ReturnErrorOnFailure(err);
+        message->SetDataLength(messageSize);
+    }
     else
     {
-        // The message is either longer or shorter than the head buffer.
+        // The message is either much shorter than the head buffer, or longer than the head buffer can hold.
         // In either case, copy the message to a fresh linear buffer to pass upstream. We always copy, rather than provide
         // a shared reference to the current buffer, in case upper layers manipulate the buffer in ways that would affect
         // our use, e.g. chaining it elsewhere or reusing space beyond the current message.
@@ -0,0 +1,178 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+
+/**
+ *    @file
+ *      Measures the throughput of the TCP transport for large messages
+ *      streamed back to back over loopback, like the chunks of a large read
+ *      or subscription report.
+ *
+ *      Usage: tcp-stream-benchmark
+ */
+
+#include "NetworkTestHelpers.h"
+
+#include <crypto/RandUtils.h>
+#include <inet/IPAddress.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemPacketBuffer.h>
+#include <transport/TransportMgr.h>
+#include <transport/raw/MessageHeader.h>
+#include <transport/raw/TCP.h>
+
+#include <chrono>
+#include <stdlib.h>
+
+using namespace chip;
+using namespace chip::Inet;
+using namespace chip::Transport;
+
+namespace {
+
+constexpr size_t kMaxTcpActiveConnectionCount = 4;
+constexpr size_t kMaxTcpPendingPackets        = 4;
+
+using TCPImpl = Transport::TCP<kMaxTcpActiveConnectionCount, kMaxTcpPendingPackets>;
+
+constexpr NodeId kSourceNodeId      = 123654;
+constexpr NodeId kDestinationNodeId = 111222333;
+constexpr uint32_t kMessageCounter  = 18;
+
+constexpr size_t kMessageCount       = 256;
+constexpr size_t kMessagePayloadSize = 48 * 1024;
+
+uint8_t PatternByte(size_t messageIndex, size_t offset)
+{
+    return static_cast<uint8_t>(messageIndex + offset);
+}
+
+// Counts the messages received on the loopback connection and checks their contents.
+class StreamReceiver : public TransportMgrDelegate
+{
+public:
+    void OnMessageReceived(const Transport::PeerAddress & source, System::PacketBufferHandle && msgBuf,
+                           Transport::MessageTransportContext * transCtxt) override
+    {
+        // Hold the incoming connection so that it is not closed after the first message.
+        if (transCtxt != nullptr && mIncoming.IsNull())
+        {
+            mIncoming = transCtxt->conn;
+        }
+
+        PacketHeader header;
+        if (header.DecodeAndConsume(msgBuf) != CHIP_NO_ERROR || msgBuf->DataLength() != kMessagePayloadSize)
+        {
+            mCorrupted = true;
+        }
+        else
+        {
+            for (size_t i = 0; i < kMessagePayloadSize; i++)
+            {
+                mCorrupted = mCorrupted || (msgBuf->Start()[i] != PatternByte(mReceivedCount, i));
+            }
+        }
+        mReceivedCount++;
+    }
+
+    void HandleConnectionAttemptComplete(ActiveTCPConnectionHandle & conn, CHIP_ERROR conErr) override
+    {
+        mConnected = (conErr == CHIP_NO_ERROR);
+    }
+
+    void ReleaseConnection() { mIncoming.Release(); }
+
+    bool mConnected       = false;
+    bool mCorrupted       = false;
+    size_t mReceivedCount = 0;
+
+private:
+    ActiveTCPConnectionHandle mIncoming;
+};
+
+CHIP_ERROR RunBenchmark(Test::IOContext & ioContext)
+{
+    IPAddress addr;
+    VerifyOrReturnError(IPAddress::FromString("::1", addr), CHIP_ERROR_INVALID_ADDRESS);
+    const uint16_t port = static_cast<uint16_t>(CHIP_PORT + Crypto::GetRandU16() % 100);
+
+    TCPImpl tcp;
+    ReturnErrorOnFailure(
+        tcp.Init(Transport::TcpListenParameters(ioContext.GetTCPEndPointManager()).SetAddressType(addr.Type()).SetListenPort(port)));
+
+    StreamReceiver receiver;
+    TransportMgrBase transportMgr;
+    transportMgr.SetSessionManager(&receiver);
+    ReturnErrorOnFailure(transportMgr.Init(&tcp));
+
+    ActiveTCPConnectionHandle connection;
+    ReturnErrorOnFailure(tcp.TCPConnect(Transport::PeerAddress::TCP(addr, port), nullptr, connection));
+    ioContext.DriveIOUntil(System::Clock::Seconds16(5), [&receiver]() { return receiver.mConnected; });
+    VerifyOrReturnError(receiver.mConnected, CHIP_ERROR_TIMEOUT);
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kMessageCount; i++)
+    {
+        System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMessagePayloadSize);
+        // Buffers this large can only be allocated when packet buffers come from the heap.
+        VerifyOrReturnError(!buffer.IsNull() && buffer->AvailableDataLength() >= kMessagePayloadSize, CHIP_ERROR_NO_MEMORY);
+        for (size_t j = 0; j < kMessagePayloadSize; j++)
+        {
+            buffer->Start()[j] = PatternByte(i, j);
+        }
+        buffer->SetDataLength(kMessagePayloadSize);
+
+        PacketHeader header;
+        header.SetSourceNodeId(kSourceNodeId)
+            .SetDestinationNodeId(kDestinationNodeId)
+            .SetMessageCounter(static_cast<uint32_t>(kMessageCounter + i));
+        ReturnErrorOnFailure(header.EncodeBeforeData(buffer));
+        ReturnErrorOnFailure(tcp.SendMessage(Transport::PeerAddress::TCP(addr, port), std::move(buffer)));
+    }
+
+    ioContext.DriveIOUntil(System::Clock::Seconds16(20), [&receiver]() { return receiver.mReceivedCount >= kMessageCount; });
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    connection.Release();
+    receiver.ReleaseConnection();
+    ioContext.DriveIOUntil(System::Clock::Seconds16(5), [&tcp]() { return !tcp.HasActiveConnections(); });
+    tcp.Close();
+
+    VerifyOrReturnError(receiver.mReceivedCount == kMessageCount, CHIP_ERROR_TIMEOUT);
+    VerifyOrReturnError(!receiver.mCorrupted, CHIP_ERROR_INTERNAL);
+
+    ChipLogProgress(Inet, "Streamed %u messages of %u bytes over TCP: %.1f MB/s", static_cast<unsigned>(kMessageCount),
+                    static_cast<unsigned>(kMessagePayloadSize),
+                    seconds > 0 ? static_cast<double>(kMessageCount * kMessagePayloadSize) / seconds / 1e6 : 0);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main()
+{
+    Test::IOContext ioContext;
+    VerifyOrDie(ioContext.Init() == CHIP_NO_ERROR);
+
+    CHIP_ERROR err = RunBenchmark(ioContext);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "TCP stream benchmark failed: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    ioContext.Shutdown();
+    return (err == CHIP_NO_ERROR) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
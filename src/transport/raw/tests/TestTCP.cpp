@@ -69,6 +69,15 @@ const char PAYLOAD_B_RESPONSE[] = "Hi!";
 const char messageSize_TEST[]   = "\x00\x00\x00\x00";
 const size_t kMaxIncoming       = 2;
 
+// Large messages streamed back to back, like the chunks of a large read or subscription report.
+constexpr size_t kLargeMessageCount       = 64;
+constexpr size_t kLargeMessagePayloadSize = 48 * 1024;
+
+uint8_t LargeMessagePatternByte(size_t messageIndex, size_t offset)
+{
+    return static_cast<uint8_t>(messageIndex + offset);
+}
+
 uint16_t GetRandomPort()
 {
     return static_cast<uint16_t>(CHIP_PORT + chip::Crypto::GetRandU16() % 100);
@@ -231,6 +240,50 @@ public:
         SetCallback(nullptr);
     }
 
+    void LargeMessageStreamTest(TCPImpl & tcp, const IPAddress & addr, uint16_t port)
+    {
+        SetCallback([](const uint8_t * message, size_t length, int count, ActiveTCPConnectionHandle & conn, void * data) {
+            VerifyOrReturnError(length == kLargeMessagePayloadSize, CHIP_ERROR_INCORRECT_STATE);
+            for (size_t i = 0; i < length; i++)
+            {
+                VerifyOrReturnError(message[i] == LargeMessagePatternByte(static_cast<size_t>(count), i),
+                                    CHIP_ERROR_INCORRECT_STATE);
+            }
+            return CHIP_NO_ERROR;
+        });
+
+        CHIP_ERROR err = tcp.TCPConnect(Transport::PeerAddress::TCP(addr, port), nullptr, refHolder);
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+        mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5), [this]() { return mHandleConnectionCompleteCalled; });
+        EXPECT_TRUE(mHandleConnectionCompleteCalled);
+
+        for (size_t i = 0; i < kLargeMessageCount; i++)
+        {
+            chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::New(kLargeMessagePayloadSize);
+            ASSERT_FALSE(buffer.IsNull());
+            for (size_t j = 0; j < kLargeMessagePayloadSize; j++)
+            {
+                buffer->Start()[j] = LargeMessagePatternByte(i, j);
+            }
+            buffer->SetDataLength(kLargeMessagePayloadSize);
+
+            PacketHeader header;
+            header.SetSourceNodeId(kSourceNodeId)
+                .SetDestinationNodeId(kDestinationNodeId)
+                .SetMessageCounter(static_cast<uint32_t>(kMessageCounter + i));
+            EXPECT_EQ(header.EncodeBeforeData(buffer), CHIP_NO_ERROR);
+
+            err = tcp.SendMessage(Transport::PeerAddress::TCP(addr, port), std::move(buffer));
+            EXPECT_EQ(err, CHIP_NO_ERROR);
+        }
+
+        mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(20),
+                                 [this]() { return mReceiveHandlerCallCount >= static_cast<int>(kLargeMessageCount); });
+        EXPECT_EQ(mReceiveHandlerCallCount, static_cast<int>(kLargeMessageCount));
+
+        SetCallback(nullptr);
+    }
+
     void MultipleConnectionTest(TCPImpl & tcp, const IPAddress & addr, uint16_t port)
     {
         ActiveTCPConnectionHandle firstConnection;
@@ -846,6 +899,22 @@ TEST_F(TestTCP, CheckTCPEndpointAfterCloseTest)
     ASSERT_TRUE(lEndPoint.IsNull());
 }
 
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+TEST_F(TestTCP, LargeMessageStreamTest)
+{
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    uint16_t port = GetRandomPort();
+    MockTransportMgrDelegate gMockTransportMgrDelegate(mIOContext);
+    gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr, port);
+    gMockTransportMgrDelegate.LargeMessageStreamTest(tcp, addr, port);
+    gMockTransportMgrDelegate.DisconnectTest(tcp);
+}
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+
 TEST_F(TestTCP, CheckProcessReceivedBuffer)
 {
     TCPImpl tcp;
@@ -909,6 +978,38 @@ TEST_F(TestTCP, CheckProcessReceivedBuffer)
     EXPECT_EQ(err, CHIP_NO_ERROR);
     EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 2);
 
+    // Test two messages in a single packet buffer, the second one shorter than the first.
+    gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+    EXPECT_TRUE(testData[0].Init((const uint32_t[]){ 151, 0 }));
+    EXPECT_TRUE(testData[1].Init((const uint32_t[]){ 52, 0 }));
+    buf = System::PacketBufferHandle::New(testData[0].mTotalLength + testData[1].mTotalLength, 0);
+    ASSERT_FALSE(buf.IsNull());
+    memcpy(buf->Start(), testData[0].mPayload, testData[0].mTotalLength);
+    memcpy(buf->Start() + testData[0].mTotalLength, testData[1].mPayload, testData[1].mTotalLength);
+    buf->SetDataLength(testData[0].mTotalLength + testData[1].mTotalLength);
+    err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, std::move(buf));
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 2);
+
+    // Test a packet buffer holding a message and the start of the next one, which is completed by a later buffer.
+    gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+    EXPECT_TRUE(testData[0].Init((const uint32_t[]){ 161, 0 }));
+    EXPECT_TRUE(testData[1].Init((const uint32_t[]){ 162, 0 }));
+    constexpr size_t kSplitLength = 40;
+    buf                           = System::PacketBufferHandle::New(testData[0].mTotalLength + kSplitLength, 0);
+    ASSERT_FALSE(buf.IsNull());
+    memcpy(buf->Start(), testData[0].mPayload, testData[0].mTotalLength);
+    memcpy(buf->Start() + testData[0].mTotalLength, testData[1].mPayload, kSplitLength);
+    buf->SetDataLength(testData[0].mTotalLength + kSplitLength);
+    err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, std::move(buf));
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 1);
+    buf = System::PacketBufferHandle::NewWithData(testData[1].mPayload + kSplitLength, testData[1].mTotalLength - kSplitLength);
+    ASSERT_FALSE(buf.IsNull());
+    err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, std::move(buf));
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 2);
+
     // Test a single packet buffer that is larger than
     // kMaxSizeWithoutReserve but less than CHIP_CONFIG_MAX_LARGE_PAYLOAD_SIZE_BYTES.
     gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
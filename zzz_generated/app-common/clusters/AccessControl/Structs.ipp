@@ -21,6 +21,7 @@
 #include <clusters/AccessControl/Structs.h>
 
 #include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructFieldCodec.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -173,45 +174,34 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 } // namespace AccessRestrictionEntryStruct
 
 namespace AccessControlTargetStruct {
+constexpr DataModel::StructFieldDescriptor kFieldDescriptors[] = {
+    DataModel::StructField<Fields::kCluster, &Type::cluster, &DecodableType::cluster>,
+    DataModel::StructField<Fields::kEndpoint, &Type::endpoint, &DecodableType::endpoint>,
+    DataModel::StructField<Fields::kDeviceType, &Type::deviceType, &DecodableType::deviceType>,
+};
+
 CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 {
-    DataModel::WrappedStructEncoder encoder{ aWriter, aTag };
-    encoder.Encode(to_underlying(Fields::kCluster), cluster);
-    encoder.Encode(to_underlying(Fields::kEndpoint), endpoint);
-    encoder.Encode(to_underlying(Fields::kDeviceType), deviceType);
-    return encoder.Finalize();
+    return DataModel::EncodeStructFields(aWriter, aTag, Span(kFieldDescriptors), this);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kCluster))
-        {
-            err = DataModel::Decode(reader, cluster);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpoint))
-        {
-            err = DataModel::Decode(reader, endpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kDeviceType))
-        {
-            err = DataModel::Decode(reader, deviceType);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStructFields(reader, Span(kFieldDescriptors), this);
 }
 
 } // namespace AccessControlTargetStruct
 
 namespace AccessControlEntryStruct {
+constexpr DataModel::StructFieldDescriptor kFieldDescriptors[] = {
+    DataModel::FabricSensitiveStructField<Fields::kPrivilege, &Type::privilege, &DecodableType::privilege>,
+    DataModel::FabricSensitiveStructField<Fields::kAuthMode, &Type::authMode, &DecodableType::authMode>,
+    DataModel::FabricSensitiveStructField<Fields::kSubjects, &Type::subjects, &DecodableType::subjects>,
+    DataModel::FabricSensitiveStructField<Fields::kTargets, &Type::targets, &DecodableType::targets>,
+    DataModel::FabricSensitiveStructField<Fields::kAuxiliaryType, &Type::auxiliaryType, &DecodableType::auxiliaryType>,
+    DataModel::FabricIndexStructField<Fields::kFabricIndex, &Type::fabricIndex, &DecodableType::fabricIndex>,
+};
+
 CHIP_ERROR Type::EncodeForWrite(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 {
     return DoEncode(aWriter, aTag, NullOptional);
@@ -224,75 +214,13 @@ CHIP_ERROR Type::EncodeForRead(TLV::TLVWriter & aWriter, TLV::Tag aTag, FabricIn
 
 CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optional<FabricIndex> & aAccessingFabricIndex) const
 {
-    bool includeSensitive = !aAccessingFabricIndex.HasValue() || (aAccessingFabricIndex.Value() == fabricIndex);
-
-    DataModel::WrappedStructEncoder encoder{ aWriter, aTag };
-
-    if (includeSensitive)
-    {
-        encoder.Encode(to_underlying(Fields::kPrivilege), privilege);
-    }
-    if (includeSensitive)
-    {
-        encoder.Encode(to_underlying(Fields::kAuthMode), authMode);
-    }
-    if (includeSensitive)
-    {
-        encoder.Encode(to_underlying(Fields::kSubjects), subjects);
-    }
-    if (includeSensitive)
-    {
-        encoder.Encode(to_underlying(Fields::kTargets), targets);
-    }
-    if (includeSensitive)
-    {
-        encoder.Encode(to_underlying(Fields::kAuxiliaryType), auxiliaryType);
-    }
-    if (aAccessingFabricIndex.HasValue())
-    {
-        encoder.Encode(to_underlying(Fields::kFabricIndex), fabricIndex);
-    }
-
-    return encoder.Finalize();
+    return DataModel::EncodeFabricScopedStructFields(aWriter, aTag, Span(kFieldDescriptors), this, fabricIndex,
+                                                     aAccessingFabricIndex);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPrivilege))
-        {
-            err = DataModel::Decode(reader, privilege);
-        }
-        else if (__context_tag == to_underlying(Fields::kAuthMode))
-        {
-            err = DataModel::Decode(reader, authMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kSubjects))
-        {
-            err = DataModel::Decode(reader, subjects);
-        }
-        else if (__context_tag == to_underlying(Fields::kTargets))
-        {
-            err = DataModel::Decode(reader, targets);
-        }
-        else if (__context_tag == to_underlying(Fields::kAuxiliaryType))
-        {
-            err = DataModel::Decode(reader, auxiliaryType);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStructFields(reader, Span(kFieldDescriptors), this);
 }
 
 } // namespace AccessControlEntryStruct
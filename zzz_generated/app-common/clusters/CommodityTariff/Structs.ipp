@@ -21,6 +21,7 @@
 #include <clusters/CommodityTariff/Structs.h>
 
 #include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructFieldCodec.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -30,421 +31,197 @@ namespace CommodityTariff {
 namespace Structs {
 
 namespace PeakPeriodStruct {
+constexpr DataModel::StructFieldDescriptor kFieldDescriptors[] = {
+    DataModel::StructField<Fields::kSeverity, &Type::severity, &DecodableType::severity>,
+    DataModel::StructField<Fields::kPeakPeriod, &Type::peakPeriod, &DecodableType::peakPeriod>,
+};
+
 CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 {
-    DataModel::WrappedStructEncoder encoder{ aWriter, aTag };
-    encoder.Encode(to_underlying(Fields::kSeverity), severity);
-    encoder.Encode(to_underlying(Fields::kPeakPeriod), peakPeriod);
-    return encoder.Finalize();
+    return DataModel::EncodeStructFields(aWriter, aTag, Span(kFieldDescriptors), this);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kSeverity))
-        {
-            err = DataModel::Decode(reader, severity);
-        }
-        else if (__context_tag == to_underlying(Fields::kPeakPeriod))
-        {
-            err = DataModel::Decode(reader, peakPeriod);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStructFields(reader, Span(kFieldDescriptors), this);
 }
 
 } // namespace PeakPeriodStruct
 
 namespace AuxiliaryLoadSwitchSettingsStruct {
+constexpr DataModel::StructFieldDescriptor kFieldDescriptors[] = {
+    DataModel::StructField<Fields::kNumber, &Type::number, &DecodableType::number>,
+    DataModel::StructField<Fields::kRequiredState, &Type::requiredState, &DecodableType::requiredState>,
+};
+
 CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 {
-    DataModel::WrappedStructEncoder encoder{ aWriter, aTag };
-    encoder.Encode(to_underlying(Fields::kNumber), number);
-    encoder.Encode(to_underlying(Fields::kRequiredState), requiredState);
-    return encoder.Finalize();
+    return DataModel::EncodeStructFields(aWriter, aTag, Span(kFieldDescriptors), this);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kNumber))
-        {
-            err = DataModel::Decode(reader, number);
-        }
-        else if (__context_tag == to_underlying(Fields::kRequiredState))
-        {
-            err = DataModel::Decode(reader, requiredState);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStructFields(reader, Span(kFieldDescriptors), this);
 }
 
 } // namespace AuxiliaryLoadSwitchSettingsStruct
 
 namespace TariffPriceStruct {
+constexpr DataModel::StructFieldDescriptor kFieldDescriptors[] = {
+    DataModel::StructField<Fields::kPriceType, &Type::priceType, &DecodableType::priceType>,
+    DataModel::StructField<Fields::kPrice, &Type::price, &DecodableType::price>,
+    DataModel::StructField<Fields::kPriceLevel, &Type::priceLevel, &DecodableType::priceLevel>,
+};
+
 CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 {
-    DataModel::WrappedStructEncoder encoder{ aWriter, aTag };
-    encoder.Encode(to_underlying(Fields::kPriceType), priceType);
-    encoder.Encode(to_underlying(Fields::kPrice), price);
-    encoder.Encode(to_underlying(Fields::kPriceLevel), priceLevel);
-    return encoder.Finalize();
+    return DataModel::EncodeStructFields(aWriter, aTag, Span(kFieldDescriptors), this);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kPriceType))
-        {
-            err = DataModel::Decode(reader, priceType);
-        }
-        else if (__context_tag == to_underlying(Fields::kPrice))
-        {
-            err = DataModel::Decode(reader, price);
-        }
-        else if (__context_tag == to_underlying(Fields::kPriceLevel))
-        {
-            err = DataModel::Decode(reader, priceLevel);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStructFields(reader, Span(kFieldDescriptors), this);
 }
 
 } // namespace TariffPriceStruct
 
 namespace TariffComponentStruct {
+constexpr DataModel::StructFieldDescriptor kFieldDescriptors[] = {
+    DataModel::StructField<Fields::kTariffComponentID, &Type::tariffComponentID, &DecodableType::tariffComponentID>,
+    DataModel::StructField<Fields::kPrice, &Type::price, &DecodableType::price>,
+    DataModel::StructField<Fields::kFriendlyCredit, &Type::friendlyCredit, &DecodableType::friendlyCredit>,
+    DataModel::StructField<Fields::kAuxiliaryLoad, &Type::auxiliaryLoad, &DecodableType::auxiliaryLoad>,
+    DataModel::StructField<Fields::kPeakPeriod, &Type::peakPeriod, &DecodableType::peakPeriod>,
+    DataModel::StructField<Fields::kPowerThreshold, &Type::powerThreshold, &DecodableType::powerThreshold>,
+    DataModel::StructField<Fields::kThreshold, &Type::threshold, &DecodableType::threshold>,
+    DataModel::StructField<Fields::kLabel, &Type::label, &DecodableType::label>,
+    DataModel::StructField<Fields::kPredicted, &Type::predicted, &DecodableType::predicted>,
+};
+
 CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 {
-    DataModel::WrappedStructEncoder encoder{ aWriter, aTag };
-    encoder.Encode(to_underlying(Fields::kTariffComponentID), tariffComponentID);
-    encoder.Encode(to_underlying(Fields::kPrice), price);
-    encoder.Encode(to_underlying(Fields::kFriendlyCredit), friendlyCredit);
-    encoder.Encode(to_underlying(Fields::kAuxiliaryLoad), auxiliaryLoad);
-    encoder.Encode(to_underlying(Fields::kPeakPeriod), peakPeriod);
-    encoder.Encode(to_underlying(Fields::kPowerThreshold), powerThreshold);
-    encoder.Encode(to_underlying(Fields::kThreshold), threshold);
-    encoder.Encode(to_underlying(Fields::kLabel), label);
-    encoder.Encode(to_underlying(Fields::kPredicted), predicted);
-    return encoder.Finalize();
+    return DataModel::EncodeStructFields(aWriter, aTag, Span(kFieldDescriptors), this);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kTariffComponentID))
-        {
-            err = DataModel::Decode(reader, tariffComponentID);
-        }
-        else if (__context_tag == to_underlying(Fields::kPrice))
-        {
-            err = DataModel::Decode(reader, price);
-        }
-        else if (__context_tag == to_underlying(Fields::kFriendlyCredit))
-        {
-            err = DataModel::Decode(reader, friendlyCredit);
-        }
-        else if (__context_tag == to_underlying(Fields::kAuxiliaryLoad))
-        {
-            err = DataModel::Decode(reader, auxiliaryLoad);
-        }
-        else if (__context_tag == to_underlying(Fields::kPeakPeriod))
-        {
-            err = DataModel::Decode(reader, peakPeriod);
-        }
-        else if (__context_tag == to_underlying(Fields::kPowerThreshold))
-        {
-            err = DataModel::Decode(reader, powerThreshold);
-        }
-        else if (__context_tag == to_underlying(Fields::kThreshold))
-        {
-            err = DataModel::Decode(reader, threshold);
-        }
-        else if (__context_tag == to_underlying(Fields::kLabel))
-        {
-            err = DataModel::Decode(reader, label);
-        }
-        else if (__context_tag == to_underlying(Fields::kPredicted))
-        {
-            err = DataModel::Decode(reader, predicted);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStructFields(reader, Span(kFieldDescriptors), this);
 }
 
 } // namespace TariffComponentStruct
 
 namespace CalendarPeriodStruct {
+constexpr DataModel::StructFieldDescriptor kFieldDescriptors[] = {
+    DataModel::StructField<Fields::kStartDate, &Type::startDate, &DecodableType::startDate>,
+    DataModel::StructField<Fields::kDayPatternIDs, &Type::dayPatternIDs, &DecodableType::dayPatternIDs>,
+};
+
 CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 {
-    DataModel::WrappedStructEncoder encoder{ aWriter, aTag };
-    encoder.Encode(to_underlying(Fields::kStartDate), startDate);
-    encoder.Encode(to_underlying(Fields::kDayPatternIDs), dayPatternIDs);
-    return encoder.Finalize();
+    return DataModel::EncodeStructFields(aWriter, aTag, Span(kFieldDescriptors), this);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kStartDate))
-        {
-            err = DataModel::Decode(reader, startDate);
-        }
-        else if (__context_tag == to_underlying(Fields::kDayPatternIDs))
-        {
-            err = DataModel::Decode(reader, dayPatternIDs);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStructFields(reader, Span(kFieldDescriptors), this);
 }
 
 } // namespace CalendarPeriodStruct
 
 namespace DayEntryStruct {
+constexpr DataModel::StructFieldDescriptor kFieldDescriptors[] = {
+    DataModel::StructField<Fields::kDayEntryID, &Type::dayEntryID, &DecodableType::dayEntryID>,
+    DataModel::StructField<Fields::kStartTime, &Type::startTime, &DecodableType::startTime>,
+    DataModel::StructField<Fields::kDuration, &Type::duration, &DecodableType::duration>,
+    DataModel::StructField<Fields::kRandomizationOffset, &Type::randomizationOffset, &DecodableType::randomizationOffset>,
+    DataModel::StructField<Fields::kRandomizationType, &Type::randomizationType, &DecodableType::randomizationType>,
+};
+
 CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 {
-    DataModel::WrappedStructEncoder encoder{ aWriter, aTag };
-    encoder.Encode(to_underlying(Fields::kDayEntryID), dayEntryID);
-    encoder.Encode(to_underlying(Fields::kStartTime), startTime);
-    encoder.Encode(to_underlying(Fields::kDuration), duration);
-    encoder.Encode(to_underlying(Fields::kRandomizationOffset), randomizationOffset);
-    encoder.Encode(to_underlying(Fields::kRandomizationType), randomizationType);
-    return encoder.Finalize();
+    return DataModel::EncodeStructFields(aWriter, aTag, Span(kFieldDescriptors), this);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kDayEntryID))
-        {
-            err = DataModel::Decode(reader, dayEntryID);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartTime))
-        {
-            err = DataModel::Decode(reader, startTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else if (__context_tag == to_underlying(Fields::kRandomizationOffset))
-        {
-            err = DataModel::Decode(reader, randomizationOffset);
-        }
-        else if (__context_tag == to_underlying(Fields::kRandomizationType))
-        {
-            err = DataModel::Decode(reader, randomizationType);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStructFields(reader, Span(kFieldDescriptors), this);
 }
 
 } // namespace DayEntryStruct
 
 namespace DayPatternStruct {
+constexpr DataModel::StructFieldDescriptor kFieldDescriptors[] = {
+    DataModel::StructField<Fields::kDayPatternID, &Type::dayPatternID, &DecodableType::dayPatternID>,
+    DataModel::StructField<Fields::kDaysOfWeek, &Type::daysOfWeek, &DecodableType::daysOfWeek>,
+    DataModel::StructField<Fields::kDayEntryIDs, &Type::dayEntryIDs, &DecodableType::dayEntryIDs>,
+};
+
 CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 {
-    DataModel::WrappedStructEncoder encoder{ aWriter, aTag };
-    encoder.Encode(to_underlying(Fields::kDayPatternID), dayPatternID);
-    encoder.Encode(to_underlying(Fields::kDaysOfWeek), daysOfWeek);
-    encoder.Encode(to_underlying(Fields::kDayEntryIDs), dayEntryIDs);
-    return encoder.Finalize();
+    return DataModel::EncodeStructFields(aWriter, aTag, Span(kFieldDescriptors), this);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kDayPatternID))
-        {
-            err = DataModel::Decode(reader, dayPatternID);
-        }
-        else if (__context_tag == to_underlying(Fields::kDaysOfWeek))
-        {
-            err = DataModel::Decode(reader, daysOfWeek);
-        }
-        else if (__context_tag == to_underlying(Fields::kDayEntryIDs))
-        {
-            err = DataModel::Decode(reader, dayEntryIDs);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStructFields(reader, Span(kFieldDescriptors), this);
 }
 
 } // namespace DayPatternStruct
 
 namespace DayStruct {
+constexpr DataModel::StructFieldDescriptor kFieldDescriptors[] = {
+    DataModel::StructField<Fields::kDate, &Type::date, &DecodableType::date>,
+    DataModel::StructField<Fields::kDayType, &Type::dayType, &DecodableType::dayType>,
+    DataModel::StructField<Fields::kDayEntryIDs, &Type::dayEntryIDs, &DecodableType::dayEntryIDs>,
+};
+
 CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 {
-    DataModel::WrappedStructEncoder encoder{ aWriter, aTag };
-    encoder.Encode(to_underlying(Fields::kDate), date);
-    encoder.Encode(to_underlying(Fields::kDayType), dayType);
-    encoder.Encode(to_underlying(Fields::kDayEntryIDs), dayEntryIDs);
-    return encoder.Finalize();
+    return DataModel::EncodeStructFields(aWriter, aTag, Span(kFieldDescriptors), this);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kDate))
-        {
-            err = DataModel::Decode(reader, date);
-        }
-        else if (__context_tag == to_underlying(Fields::kDayType))
-        {
-            err = DataModel::Decode(reader, dayType);
-        }
-        else if (__context_tag == to_underlying(Fields::kDayEntryIDs))
-        {
-            err = DataModel::Decode(reader, dayEntryIDs);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStructFields(reader, Span(kFieldDescriptors), this);
 }
 
 } // namespace DayStruct
 
 namespace TariffInformationStruct {
+constexpr DataModel::StructFieldDescriptor kFieldDescriptors[] = {
+    DataModel::StructField<Fields::kTariffLabel, &Type::tariffLabel, &DecodableType::tariffLabel>,
+    DataModel::StructField<Fields::kProviderName, &Type::providerName, &DecodableType::providerName>,
+    DataModel::StructField<Fields::kCurrency, &Type::currency, &DecodableType::currency>,
+    DataModel::StructField<Fields::kBlockMode, &Type::blockMode, &DecodableType::blockMode>,
+};
+
 CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 {
-    DataModel::WrappedStructEncoder encoder{ aWriter, aTag };
-    encoder.Encode(to_underlying(Fields::kTariffLabel), tariffLabel);
-    encoder.Encode(to_underlying(Fields::kProviderName), providerName);
-    encoder.Encode(to_underlying(Fields::kCurrency), currency);
-    encoder.Encode(to_underlying(Fields::kBlockMode), blockMode);
-    return encoder.Finalize();
+    return DataModel::EncodeStructFields(aWriter, aTag, Span(kFieldDescriptors), this);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kTariffLabel))
-        {
-            err = DataModel::Decode(reader, tariffLabel);
-        }
-        else if (__context_tag == to_underlying(Fields::kProviderName))
-        {
-            err = DataModel::Decode(reader, providerName);
-        }
-        else if (__context_tag == to_underlying(Fields::kCurrency))
-        {
-            err = DataModel::Decode(reader, currency);
-        }
-        else if (__context_tag == to_underlying(Fields::kBlockMode))
-        {
-            err = DataModel::Decode(reader, blockMode);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStructFields(reader, Span(kFieldDescriptors), this);
 }
 
 } // namespace TariffInformationStruct
 
 namespace TariffPeriodStruct {
+constexpr DataModel::StructFieldDescriptor kFieldDescriptors[] = {
+    DataModel::StructField<Fields::kLabel, &Type::label, &DecodableType::label>,
+    DataModel::StructField<Fields::kDayEntryIDs, &Type::dayEntryIDs, &DecodableType::dayEntryIDs>,
+    DataModel::StructField<Fields::kTariffComponentIDs, &Type::tariffComponentIDs, &DecodableType::tariffComponentIDs>,
+};
+
 CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 {
-    DataModel::WrappedStructEncoder encoder{ aWriter, aTag };
-    encoder.Encode(to_underlying(Fields::kLabel), label);
-    encoder.Encode(to_underlying(Fields::kDayEntryIDs), dayEntryIDs);
-    encoder.Encode(to_underlying(Fields::kTariffComponentIDs), tariffComponentIDs);
-    return encoder.Finalize();
+    return DataModel::EncodeStructFields(aWriter, aTag, Span(kFieldDescriptors), this);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kLabel))
-        {
-            err = DataModel::Decode(reader, label);
-        }
-        else if (__context_tag == to_underlying(Fields::kDayEntryIDs))
-        {
-            err = DataModel::Decode(reader, dayEntryIDs);
-        }
-        else if (__context_tag == to_underlying(Fields::kTariffComponentIDs))
-        {
-            err = DataModel::Decode(reader, tariffComponentIDs);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStructFields(reader, Span(kFieldDescriptors), this);
 }
 
 } // namespace TariffPeriodStruct
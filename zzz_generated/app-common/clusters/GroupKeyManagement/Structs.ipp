@@ -21,6 +21,7 @@
 #include <clusters/GroupKeyManagement/Structs.h>
 
 #include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructFieldCodec.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {
@@ -90,6 +91,12 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 } // namespace GroupInfoMapStruct
 
 namespace GroupKeyMapStruct {
+constexpr DataModel::StructFieldDescriptor kFieldDescriptors[] = {
+    DataModel::StructField<Fields::kGroupId, &Type::groupId, &DecodableType::groupId>,
+    DataModel::StructField<Fields::kGroupKeySetID, &Type::groupKeySetID, &DecodableType::groupKeySetID>,
+    DataModel::FabricIndexStructField<Fields::kFabricIndex, &Type::fabricIndex, &DecodableType::fabricIndex>,
+};
+
 CHIP_ERROR Type::EncodeForWrite(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 {
     return DoEncode(aWriter, aTag, NullOptional);
@@ -102,108 +109,37 @@ CHIP_ERROR Type::EncodeForRead(TLV::TLVWriter & aWriter, TLV::Tag aTag, FabricIn
 
 CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optional<FabricIndex> & aAccessingFabricIndex) const
 {
-
-    DataModel::WrappedStructEncoder encoder{ aWriter, aTag };
-
-    encoder.Encode(to_underlying(Fields::kGroupId), groupId);
-    encoder.Encode(to_underlying(Fields::kGroupKeySetID), groupKeySetID);
-    if (aAccessingFabricIndex.HasValue())
-    {
-        encoder.Encode(to_underlying(Fields::kFabricIndex), fabricIndex);
-    }
-
-    return encoder.Finalize();
+    return DataModel::EncodeFabricScopedStructFields(aWriter, aTag, Span(kFieldDescriptors), this, fabricIndex,
+                                                     aAccessingFabricIndex);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kGroupId))
-        {
-            err = DataModel::Decode(reader, groupId);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupKeySetID))
-        {
-            err = DataModel::Decode(reader, groupKeySetID);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStructFields(reader, Span(kFieldDescriptors), this);
 }
 
 } // namespace GroupKeyMapStruct
 
 namespace GroupKeySetStruct {
+constexpr DataModel::StructFieldDescriptor kFieldDescriptors[] = {
+    DataModel::StructField<Fields::kGroupKeySetID, &Type::groupKeySetID, &DecodableType::groupKeySetID>,
+    DataModel::StructField<Fields::kGroupKeySecurityPolicy, &Type::groupKeySecurityPolicy, &DecodableType::groupKeySecurityPolicy>,
+    DataModel::StructField<Fields::kEpochKey0, &Type::epochKey0, &DecodableType::epochKey0>,
+    DataModel::StructField<Fields::kEpochStartTime0, &Type::epochStartTime0, &DecodableType::epochStartTime0>,
+    DataModel::StructField<Fields::kEpochKey1, &Type::epochKey1, &DecodableType::epochKey1>,
+    DataModel::StructField<Fields::kEpochStartTime1, &Type::epochStartTime1, &DecodableType::epochStartTime1>,
+    DataModel::StructField<Fields::kEpochKey2, &Type::epochKey2, &DecodableType::epochKey2>,
+    DataModel::StructField<Fields::kEpochStartTime2, &Type::epochStartTime2, &DecodableType::epochStartTime2>,
+};
+
 CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 {
-    DataModel::WrappedStructEncoder encoder{ aWriter, aTag };
-    encoder.Encode(to_underlying(Fields::kGroupKeySetID), groupKeySetID);
-    encoder.Encode(to_underlying(Fields::kGroupKeySecurityPolicy), groupKeySecurityPolicy);
-    encoder.Encode(to_underlying(Fields::kEpochKey0), epochKey0);
-    encoder.Encode(to_underlying(Fields::kEpochStartTime0), epochStartTime0);
-    encoder.Encode(to_underlying(Fields::kEpochKey1), epochKey1);
-    encoder.Encode(to_underlying(Fields::kEpochStartTime1), epochStartTime1);
-    encoder.Encode(to_underlying(Fields::kEpochKey2), epochKey2);
-    encoder.Encode(to_underlying(Fields::kEpochStartTime2), epochStartTime2);
-    return encoder.Finalize();
+    return DataModel::EncodeStructFields(aWriter, aTag, Span(kFieldDescriptors), this);
 }
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        uint8_t __context_tag = 0;
-        CHIP_ERROR err        = __iterator.Next(__context_tag);
-        VerifyOrReturnError(err != CHIP_ERROR_END_OF_TLV, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(err);
-
-        if (__context_tag == to_underlying(Fields::kGroupKeySetID))
-        {
-            err = DataModel::Decode(reader, groupKeySetID);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupKeySecurityPolicy))
-        {
-            err = DataModel::Decode(reader, groupKeySecurityPolicy);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochKey0))
-        {
-            err = DataModel::Decode(reader, epochKey0);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochStartTime0))
-        {
-            err = DataModel::Decode(reader, epochStartTime0);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochKey1))
-        {
-            err = DataModel::Decode(reader, epochKey1);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochStartTime1))
-        {
-            err = DataModel::Decode(reader, epochStartTime1);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochKey2))
-        {
-            err = DataModel::Decode(reader, epochKey2);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochStartTime2))
-        {
-            err = DataModel::Decode(reader, epochStartTime2);
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStructFields(reader, Span(kFieldDescriptors), this);
 }
 
 } // namespace GroupKeySetStruct
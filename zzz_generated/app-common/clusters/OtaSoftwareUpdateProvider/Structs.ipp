@@ -21,6 +21,7 @@
 #include <clusters/OtaSoftwareUpdateProvider/Structs.h>
 
 #include <app/data-model/StructDecodeIterator.h>
+#include <app/data-model/StructFieldCodec.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
 namespace chip {